@@ -866,9 +866,27 @@ The available options are
 "line_range",
 "linetable_version",
 "segment_selector_size",
+"segment_size",
+"compress_type",
+"compress_threads",
 and
-"segment_size".
+"optimize_line_table".
 .DE
+.P
+"compress_type=1" (zlib) or "compress_type=2" (zstd)
+enables \f(CWdwarf_compress_section_bytes()\fP
+(see below). It is an error if libdwarf was built
+without zlib and zstd.
+"compress_threads" is the number of threads zstd
+may use to compress each section.
+.P
+"optimize_line_table=1" makes the producer ignore
+"line_base" and "line_range" and instead pick the
+pair giving the smallest .debug_line for the rows
+added, and encode each row as the shortest mix of
+special opcodes, DW_LNS_const_add_pc,
+DW_LNS_advance_pc and DW_LNS_advance_line.
+
 .P
 For example, to set the line-table generation
 default value of is_stmt to 0
@@ -1336,6 +1354,44 @@ It is unwise to call this before
 \f(CWdwarf_transform_to_disk_form() \fP has been called.
 .P
 
+.H 3 "dwarf_compress_section_bytes()"
+.DS
+\f(CWint dwarf_compress_section_bytes(
+        Dwarf_P_Debug dbg,
+        Dwarf_Ptr        section_bytes,
+        Dwarf_Unsigned   length,
+        Dwarf_Unsigned   section_alignment,
+        Dwarf_Ptr      * compressed_bytes,
+        Dwarf_Unsigned * compressed_length,
+        Dwarf_Error    * error)\fP
+.DE
+The function \f(CWdwarf_compress_section_bytes() \fP
+takes the complete, final, bytes of one section
+(all the \f(CWdwarf_get_section_bytes_a()\fP
+buffers for that section concatenated, with
+any relocations the caller does itself already applied)
+and returns
+through \f(CW*compressed_bytes\fP
+an \f(CWElf32_Chdr\fP or \f(CWElf64_Chdr\fP
+(chosen by the address size)
+followed by the zlib or zstd compressed data.
+\f(CWsection_alignment\fP is the alignment
+of the uncompressed section and is recorded
+in the Chdr.
+The caller writes the returned bytes as
+the section content and sets \f(CWSHF_COMPRESSED\fP
+in the section header flags.
+.P
+It returns \f(CWDW_DLV_NO_ENTRY\fP if no
+"compress_type" was given to
+\f(CWdwarf_producer_init()\fP
+or if compressing would not make the section smaller,
+in which case the section should be written
+as it is.
+.P
+The memory space of the compressed bytes is freed
+by the \f(CWdwarf_producer_finish_a() \fP call.
+
 .H 3 "dwarf_pro_get_string_stats()"
 .DS
 \f(CWint dwarf_pro_get_string_stats(
@@ -2873,6 +2929,39 @@ refer to this source file in calls to
 
 On error, it returns \f(CWDW_DLV_ERROR\fP.
 
+.H 3 "dwarf_add_file_decl_b()"
+.DS
+\f(CWint dwarf_add_file_decl_b(
+        Dwarf_P_Debug dbg,
+        char *name,
+        Dwarf_Unsigned dir_idx,
+        Dwarf_Unsigned time_mod,
+        Dwarf_Unsigned length,
+        Dwarf_Form_Data16 *md5,
+        Dwarf_Unsigned *file_entry_count_out,
+        Dwarf_Error *error)\fP
+.DE
+New in October 2026.
+The function \f(CWdwarf_add_file_decl_b()\fP is
+\f(CWdwarf_add_file_decl_a()\fP
+with one more argument:
+\f(CWmd5\fP
+points to the MD5 digest of the file content,
+or is null if it is not known.
+.P
+In a DWARF5 line table header
+directory entry 0 is the
+\f(CWDW_AT_comp_dir\fP
+of the compilation unit and
+file entry 0 repeats the first file added,
+so the indexes returned here and by
+\f(CWdwarf_add_directory_decl_a()\fP
+mean the same thing in every DWARF version.
+The file entries record DW_LNCT_timestamp
+and DW_LNCT_size when any file has a nonzero
+value for them, and DW_LNCT_MD5
+when every file was given an MD5.
+
 .H 2 "Fast Access (aranges) Operations"
 These functions operate on the .debug_aranges section.  
 
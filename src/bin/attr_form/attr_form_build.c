@@ -28,6 +28,7 @@
 #include <config.h>
 
 #include <stdlib.h> /* exit() */
+#include <string.h> /* memset() */
 
 #include "dwarf.h"
 #include "libdwarf.h"
@@ -87,11 +88,22 @@ by the code in dwarfdump reading this output.
 Any lines commented with C comments are stripped
 by the initial C pre-processor invocation.
 
+So the check itself need not search, the standard
+pass also writes attr_formclass_std_mask[],
+indexed by attribute, of formclass bits, and
+the extended pass writes a perfect hash of
+attribute to formclass bits,
+attr_formclass_ext_hash[][2].
+dwarfdump's check is then a single probe.
+
 */
 
 #define AF_STANDARD 1
 #define AF_EXTENDED 2
 
+/*  Far more than the number of entries in either list. */
+#define AF_TABLE_MAXIMUM 1000
+
 static const char *usage[] = {
     "Usage: attr_form_build <options>",
     "    -i input-table-path",
@@ -144,6 +156,128 @@ process_args(int argc, char *argv[])
     }
 }
 
+static unsigned int af_attrs[AF_TABLE_MAXIMUM];
+static unsigned int af_classes[AF_TABLE_MAXIMUM];
+static unsigned af_count;
+
+/*  Per attribute (one entry per attribute) a mask of
+    legal formclass bits.  */
+static unsigned int af_hash_keys[AF_TABLE_MAXIMUM];
+static unsigned int af_hash_masks[AF_TABLE_MAXIMUM];
+static unsigned af_hash_count;
+
+static void
+describe_af_key(FILE *f,unsigned int key)
+{
+    const char *name = 0;
+    int res = 0;
+
+    res = dwarf_get_AT_name(key,&name);
+    if (res != DW_DLV_OK) {
+        name = "<no name known for the attribute>";
+    }
+    fprintf(f,"%s",name);
+}
+
+static void
+record_af_entry(unsigned int attr,unsigned int formclass)
+{
+    unsigned k = 0;
+
+    if (af_count >= AF_TABLE_MAXIMUM) {
+        bad_line_input("Too many attr/formclass entries,"
+            " max %u",AF_TABLE_MAXIMUM);
+    }
+    if (formclass >= BITS_PER_WORD) {
+        bad_line_input("formclass %u does not fit a"
+            " formclass mask",formclass);
+    }
+    af_attrs[af_count] = attr;
+    af_classes[af_count] = formclass;
+    ++af_count;
+    for (k = 0; k < af_hash_count; ++k) {
+        if (af_hash_keys[k] == attr) {
+            break;
+        }
+    }
+    if (k == af_hash_count) {
+        af_hash_keys[k] = attr;
+        af_hash_masks[k] = 0;
+        ++af_hash_count;
+    }
+    af_hash_masks[k] |= ((unsigned)1) << formclass;
+}
+
+static void
+emit_af_entries(FILE *fileOut)
+{
+    unsigned i = 0;
+
+    for (i = 0; i < af_count; ++i) {
+        unsigned int attr = af_attrs[i];
+        unsigned int num = af_classes[i];
+        int res = 0;
+        const char *name  = 0;
+
+        fprintf(fileOut,"{0x%02x,%2u,%d},",
+            attr,num,
+            standard_flag? AF_STANDARD:AF_EXTENDED);
+        res = dwarf_get_AT_name(attr,&name);
+        if (res != DW_DLV_OK) {
+            printf("Unknown attribute number of 0x%x,"
+                " Giving up\n",num);
+            exit(EXIT_FAILURE);
+        }
+        fprintf(fileOut,"/*%s ",name);
+        res = dwarf_get_FORM_CLASS_name(num,&name);
+        if (res != DW_DLV_OK) {
+            printf("Unknown form class number of 0x%x,"
+                " Giving up\n",num);
+            exit(EXIT_FAILURE);
+        }
+        fprintf(fileOut,"%s ",name);
+        fprintf(fileOut,"%s*/\n",
+            standard_flag?"Std":"Ext");
+    }
+}
+
+/*  Standard attributes are all below DW_AT_last
+    so a direct-indexed mask works. */
+static void
+emit_std_mask(FILE *fileOut)
+{
+    unsigned int mask[DW_AT_last];
+    unsigned k = 0;
+
+    memset(mask,0,sizeof(mask));
+    for (k = 0; k < af_hash_count; ++k) {
+        if (af_hash_keys[k] >= DW_AT_last) {
+            bad_line_input("standard attribute 0x%x exceeds"
+                " standard table size",af_hash_keys[k]);
+        }
+        mask[af_hash_keys[k]] = af_hash_masks[k];
+    }
+    fprintf(fileOut,"%s\n", "#ifndef SKIP_AF_CHECK");
+    fprintf(fileOut,"#define AF_STD_ATTR_COUNT %d\n\n",
+        DW_AT_last);
+    fprintf(fileOut,"static const unsigned int"
+        " attr_formclass_std_mask[AF_STD_ATTR_COUNT] = {\n");
+    for (k = 0; k < DW_AT_last; ++k) {
+        if (k%5 == 0) {
+            fprintf(fileOut,"    ");
+        }
+        fprintf(fileOut,"0x%08x,",mask[k]);
+        if (k%5 == 4) {
+            fprintf(fileOut,"\n");
+        }
+    }
+    if (k%5) {
+        fprintf(fileOut,"\n");
+    }
+    fprintf(fileOut,"};\n");
+    fprintf(fileOut,"%s\n", "#endif /* SKIP_AF_CHECK */");
+}
+
 static void *attr_check_dups;
 static void
 check_for_dup_attr(unsigned attr)
@@ -237,6 +371,27 @@ main(int argc, char **argv)
     if (num != MAGIC_TOKEN_VALUE) {
         bad_line_input("Expected 0xffffffff");
     }
+    while (!feof(stdin)) {
+        unsigned int attr = 0;
+
+        input_eof = read_value(&attr,fileInp);
+        if (IS_EOF == input_eof) {
+            /* Reached normal eof */
+            break;
+        }
+        check_for_dup_attr(attr);
+        input_eof = read_value(&num,fileInp);
+        if (IS_EOF == input_eof) {
+            bad_line_input("Not terminated correctly..");
+        }
+        while (num != MAGIC_TOKEN_VALUE) {
+            record_af_entry(attr,num);
+            input_eof = read_value(&num,fileInp);
+            if (IS_EOF == input_eof) {
+                bad_line_input("Not terminated correctly.");
+            }
+        }
+    }
     if (standard_flag) {
         fprintf(fileOut,"/* Generated table, do not edit. */\n");
         fprintf(fileOut,"/* Generated for source version %s */\n",
@@ -253,6 +408,7 @@ main(int argc, char **argv)
         fprintf(fileOut,"%s\n", "extern \"C\" {");
         fprintf(fileOut,"%s\n",
             "#endif /* __cplusplus */");
+        emit_std_mask(fileOut);
 
         fprintf(fileOut,"struct af_table_s {\n");
         fprintf(fileOut,"    Dwarf_Half attr;\n");
@@ -260,51 +416,16 @@ main(int argc, char **argv)
         fprintf(fileOut,"    unsigned char section;\n");
         fprintf(fileOut,"}  attr_formclass_table[] = {\n");
     }
-    while (!feof(stdin)) {
-        unsigned int attr = 0;
-
-        input_eof = read_value(&attr,fileInp);
-        if (IS_EOF == input_eof) {
-            /* Reached normal eof */
-            break;
-        }
-        check_for_dup_attr(attr);
-        input_eof = read_value(&num,fileInp);
-        if (IS_EOF == input_eof) {
-            bad_line_input("Not terminated correctly..");
-        }
-        while (num != MAGIC_TOKEN_VALUE) {
-            int res = 0;
-            const char *name  = 0;
-
-            fprintf(fileOut,"{0x%02x,%2u,%d},",
-                attr,num,
-                standard_flag? AF_STANDARD:AF_EXTENDED);
-            res = dwarf_get_AT_name(attr,&name);
-            if (res != DW_DLV_OK) {
-                printf("Unknown attribute number of 0x%x,"
-                    " Giving up\n",num);
-                exit(EXIT_FAILURE);
-            }
-            fprintf(fileOut,"/*%s ",name);
-            res = dwarf_get_FORM_CLASS_name(num,&name);
-            if (res != DW_DLV_OK) {
-                printf("Unknown form class number of 0x%x,"
-                    " Giving up\n",num);
-                exit(EXIT_FAILURE);
-            }
-            fprintf(fileOut,"%s ",name);
-            fprintf(fileOut,"%s*/\n",
-                standard_flag?"Std":"Ext");
-            input_eof = read_value(&num,fileInp);
-            if (IS_EOF == input_eof) {
-                bad_line_input("Not terminated correctly.");
-            }
-        }
-    }
+    emit_af_entries(fileOut);
     if (extended_flag) {
         fprintf(fileOut,"{ 0,0,0 }\n");
         fprintf(fileOut,"}; /* end af_table extended */\n");
+        fprintf(fileOut,"%s\n", "#ifndef SKIP_AF_CHECK");
+        emit_perfect_hash(fileOut,"AF_EXT",
+            "attr_formclass_ext_hash",
+            af_hash_keys,af_hash_masks,af_hash_count,
+            describe_af_key);
+        fprintf(fileOut,"%s\n", "#endif /* SKIP_AF_CHECK */");
         fprintf(fileOut,"%s\n",
             "#ifdef __cplusplus");
         fprintf(fileOut,"%s\n",
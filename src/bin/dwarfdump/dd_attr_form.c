@@ -41,6 +41,8 @@
 #include "dd_tsearchbal.h"
 #include "dd_naming.h"
 #include "dd_attr_form.h"
+#include "dd_checkcache.h"
+#include "dd_tag_common.h"
 #include "dwarfdump-af-table.h"
 
 #if 0
@@ -222,37 +224,35 @@ destroy_attr_form_trees(void)
 /*  SKIP_AF_CHECK defined means this is in scripts/ddbuild.sh
     and this checking makes no sense and will not compile. */
 #ifndef SKIP_AF_CHECK
-static Dwarf_Bool
+/*  The generated tables give, per attribute, a mask
+    of the legal formclasses: direct-indexed for
+    the standard table and a perfect hash for the
+    extensions table. So no search is needed. */
+Dwarf_Bool
 legal_attr_formclass_combination(Dwarf_Half attr,
     Dwarf_Half fc)
 {
-    Three_Key_Entry *e = 0;
-    Three_Key_Entry *re = 0;
-    void *ret = 0;
-    int res = 0;
+    unsigned int fcbit = 0;
+    unsigned slot = 0;
 
-    res = make_3key(attr,fc,0,0,0,0,&e);
-    if (res!= DW_DLV_OK) {
-        /*  Hiding some sort of botch/malloc issue */
-        return TRUE;
-    }
-    ret = dwarf_tfind(e,&threekey_attr_form_base,
-        std_compare_3key_entry);
-    if (!ret) {
+    if (fc >= BITS_PER_WORD) {
         /*  Surprising combo. */
-        free(e);
         return FALSE;
     }
-    re = *(Three_Key_Entry **)ret;
-    if (!glflags.gf_suppress_check_extensions_tables) {
-        free(e);
+    fcbit = ((unsigned int)1) << fc;
+    if (attr < AF_STD_ATTR_COUNT &&
+        (attr_formclass_std_mask[attr] & fcbit)) {
         return TRUE;
     }
-    if (re->std_or_exten == AF_STD) {
-        free(e);
+    if (glflags.gf_suppress_check_extensions_tables) {
+        return FALSE;
+    }
+    slot = DD_PERFECT_HASH_SLOT(attr,AF_EXT_HASH_MULT,
+        AF_EXT_HASH_SHIFT);
+    if (attr_formclass_ext_hash[slot][0] == attr &&
+        (attr_formclass_ext_hash[slot][1] & fcbit)) {
         return TRUE;
     }
-    free(e);
     return FALSE;
 }
 
@@ -297,11 +297,7 @@ record_attr_form_use(
     int pd_dwarf_names_print_on_error,
     int die_stack_indent_level)
 {
-    Three_Key_Entry *e =  0;
-    Three_Key_Entry *re =  0;
-    void *ret =  0;
     Dwarf_Small std_or_exten = 0;
-    int res = 0;
 
     (void)dbg;
     (void)tag;
@@ -321,8 +317,51 @@ record_attr_form_use(
     check_attr_formclass_combination(dbg,
         tag,attr,fclass,pd_dwarf_names_print_on_error,
         die_stack_indent_level);
+    if (glflags.gf_check_cache_recording) {
+        checkcache_note_usage(CHECKCACHE_ATTR_FORM_USAGE,
+            attr,fclass,form);
+    }
 #endif /* SKIP_AF_CHECK */
-    res = make_3key(attr,fclass,form,std_or_exten,0,1,&e);
+    add_attr_form_use(attr,fclass,form,std_or_exten,1);
+}
+
+/*  Counts count uses of the attr/formclass/form
+    combination. Also used to add counts from
+    dd_checkcache.c for a CU whose checks are reused. */
+void
+add_attr_form_use(Dwarf_Half attr,
+    Dwarf_Half fclass,
+    Dwarf_Half form,
+    Dwarf_Small std_or_exten,
+    Dwarf_Unsigned count)
+{
+    Three_Key_Entry  key;
+    Three_Key_Entry *e =  0;
+    Three_Key_Entry *re =  0;
+    void *ret =  0;
+    int res = 0;
+
+    if (!std_or_exten) {
+        if (attr >= DW_AT_lo_user || form > DW_FORM_addrx4) {
+            std_or_exten = AF_EXTEN;
+        } else {
+            std_or_exten = AF_STD;
+        }
+    }
+    /*  Nearly always the combination was seen before,
+        so look with a local key and malloc only
+        when a new entry is needed. */
+    key.key1 = attr;
+    key.key2 = fclass;
+    key.key3 = form;
+    ret = dwarf_tfind(&key,&threekey_attr_form_base,
+        std_compare_3key_entry);
+    if (ret) {
+        re = *(Three_Key_Entry **)ret;
+        re->count += count;
+        return;
+    }
+    res = make_3key(attr,fclass,form,std_or_exten,0,count,&e);
     if (res!= DW_DLV_OK) {
         /*  Could print something */
         return;
@@ -341,7 +380,7 @@ record_attr_form_use(
         return;
     }
     /* Was already entered.*/
-    ++re->count;
+    re->count += count;
     /* Clean out the local malloc */
     free_func_3key_entry(e);
     return;
@@ -65,6 +65,12 @@ void record_attr_form_use(Dwarf_Debug dbg,
     Dwarf_Half fclass, Dwarf_Half form,
     int pd_dwarf_names_print_on_error,
     int die_stack_indent_level);
+void add_attr_form_use(Dwarf_Half attr,
+    Dwarf_Half fclass, Dwarf_Half form,
+    Dwarf_Small std_or_exten,
+    Dwarf_Unsigned count);
+Dwarf_Bool legal_attr_formclass_combination(Dwarf_Half attr,
+    Dwarf_Half fc);
 
 /*  The standard main tree for attr_form data.
     Starting out as simple global variables. */
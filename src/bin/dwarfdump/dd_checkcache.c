@@ -0,0 +1,1907 @@
+/*
+  Copyright 2026 David Anderson. All rights reserved.
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of version 2 of the GNU General
+  Public License as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU General Public
+  License along with this program; if not, write the Free
+  Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+  Boston MA 02110-1301, USA.
+
+*/
+
+/*  dd_checkcache.c, .h implement --check-cache=<path>.
+
+    With -k checking (and no printing) each CU is
+    given a digest of everything its checks read:
+    the dwarfdump options, the code limits used by
+    the range checks, the CU header values, its
+    abbreviations and its DIEs.  Attribute values
+    are hashed as resolved: the strings, addresses,
+    location and range list entries and line table
+    the CU refers to, never the offsets into shared
+    sections, so changing one CU leaves the digests
+    of the others alone.
+    A CU whose digest is in the cache file
+    is not re-read: the check counts and the
+    usage counts (-ku -kE and the attr/form report)
+    it contributed last time are added back in,
+    and with -kG its messages go into the
+    unique-errors table so later CUs print
+    the same messages as without the cache.
+    The error messages of such a CU are not repeated.
+    Checks that span all CUs (macros) are always done.
+
+    A CU referring outside itself (DW_FORM_ref_addr,
+    DW_FORM_ref_sig8, supplementary-file forms,
+    expression operators naming other CUs) or
+    a split-dwarf CU is always checked and never cached.
+
+    The cache file is text, rewritten at the end of the
+    run with the CUs seen in this run.
+        dwarfdump-check-cache 2
+        cu <digest>
+        k <category> <checks> <errors>
+        g <major errors> <macro notes> <check errors>
+            <debug_addr missing> <search-by-address error code>
+        u <kind> <key1> <key2> <key3> <count>
+        e <message, backslash and newline escaped>
+        w <in valid code> <need valid code> <seen PU>
+            <seen PU base> <seen PU high> <PU base> <PU high>
+        p <PU name, escaped as e>
+        end
+    All numbers are hex.  */
+
+#include <config.h>
+
+#include <stdio.h>  /* FILE fclose() fopen() fprintf() fputs()
+    getc() printf() putc() remove() rename() */
+#include <stdlib.h> /* calloc() free() malloc() */
+#include <string.h> /* memcpy() memset() strcmp() strlen() strncmp() */
+#ifdef HAVE_STDINT_H
+#include <stdint.h> /* uintptr_t */
+#endif /* HAVE_STDINT_H */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "libdwarf_private.h"
+#include "dd_globals.h"
+#include "dd_tsearchbal.h"
+#include "dd_esb.h"
+#include "dd_esb_using_functions.h"
+#include "dd_sanitized.h"
+#include "dd_safe_strcpy.h"
+#include "dd_compiler_info.h"
+#include "dd_attr_form.h"
+#include "dd_checkcache.h"
+
+#define CHECKCACHE_MAGIC "dwarfdump-check-cache 2"
+#define CC_FNV_OFFSET 0xcbf29ce484222325ULL
+#define CC_FNV_PRIME  0x00000100000001b3ULL
+
+/*  The entries of ce_walk[]. */
+#define CC_WALK_IN_VALID_CODE   0
+#define CC_WALK_NEED_VALID_CODE 1
+#define CC_WALK_SEEN_PU         2
+#define CC_WALK_SEEN_PU_BASE    3
+#define CC_WALK_SEEN_PU_HIGH    4
+#define CC_WALK_PU_BASE         5
+#define CC_WALK_PU_HIGH         6
+#define CC_WALK_COUNT           7
+
+struct cc_usage_s {
+    int            cu_kind;
+    unsigned       cu_k1;
+    unsigned       cu_k2;
+    unsigned       cu_k3;
+    Dwarf_Unsigned cu_count;
+};
+
+struct cc_entry_s {
+    Dwarf_Unsigned     ce_digest;
+    Dwarf_Bool         ce_used;
+    Dwarf_Check_Result ce_results[LAST_CATEGORY];
+    Dwarf_Unsigned     ce_major_errors;
+    Dwarf_Unsigned     ce_macronotes;
+    Dwarf_Unsigned     ce_check_error;
+    Dwarf_Unsigned     ce_addr_missing;
+    Dwarf_Unsigned     ce_addr_errcode;
+    Dwarf_Unsigned     ce_usage_count;
+    struct cc_usage_s *ce_usage;
+    Dwarf_Unsigned     ce_error_count;
+    char             **ce_errors;
+    /*  The subprogram state the DIE checks leave
+        for the next CU. */
+    Dwarf_Unsigned     ce_walk[CC_WALK_COUNT];
+    char              *ce_pu_name;
+};
+
+static Dwarf_Bool cc_active;
+static Dwarf_Unsigned cc_options_digest = CC_FNV_OFFSET;
+static void * cc_entries;
+static Dwarf_Unsigned cc_reused_count;
+static Dwarf_Unsigned cc_checked_count;
+static Dwarf_Unsigned cc_reused_with_errors;
+
+/*  Per object file. */
+static Dwarf_Debug cc_shared_dbg;
+static Dwarf_Bool cc_shared_ok;
+static Dwarf_Unsigned cc_shared_digest;
+
+/*  The CU currently being checked and recorded. */
+static Dwarf_Bool cc_cu_storable;
+static Dwarf_Unsigned cc_cu_digest;
+static Dwarf_Check_Result cc_cu_results[LAST_CATEGORY];
+static Dwarf_Unsigned cc_cu_major_errors;
+static Dwarf_Unsigned cc_cu_macronotes;
+static Dwarf_Unsigned cc_cu_check_error;
+static char cc_cu_addr_missing;
+static int cc_cu_addr_errcode;
+static void * cc_journal;
+static Dwarf_Unsigned cc_journal_count;
+static char **cc_cu_errors;
+static Dwarf_Unsigned cc_cu_error_count;
+static Dwarf_Unsigned cc_cu_error_space;
+
+/*  For the tree walks. */
+static struct cc_entry_s *cc_walk_entry;
+static FILE *cc_walk_file;
+
+static Dwarf_Unsigned
+cc_hash_bytes(Dwarf_Unsigned h,const Dwarf_Small *p,
+    Dwarf_Unsigned len)
+{
+    Dwarf_Unsigned i = 0;
+
+    for ( ; i < len; ++i) {
+        h ^= p[i];
+        h *= CC_FNV_PRIME;
+    }
+    return h;
+}
+
+static Dwarf_Unsigned
+cc_hash_number(Dwarf_Unsigned h,Dwarf_Unsigned v)
+{
+    Dwarf_Small b[8];
+    int i = 0;
+
+    for (i = 0; i < 8; ++i) {
+        b[i] = (Dwarf_Small)(v & 0xff);
+        v >>= 8;
+    }
+    return cc_hash_bytes(h,b,sizeof(b));
+}
+
+static Dwarf_Unsigned
+cc_hash_string(Dwarf_Unsigned h,const char *s)
+{
+    if (!s) {
+        s = "";
+    }
+    return cc_hash_bytes(h,(const Dwarf_Small *)s,strlen(s)+1);
+}
+
+static int
+cc_compare_entry(const void *l, const void *r)
+{
+    const struct cc_entry_s *le = (const struct cc_entry_s *)l;
+    const struct cc_entry_s *re = (const struct cc_entry_s *)r;
+
+    if (le->ce_digest < re->ce_digest) {
+        return -1;
+    }
+    if (le->ce_digest > re->ce_digest) {
+        return 1;
+    }
+    return 0;
+}
+
+static void
+cc_free_errors(char **errors,Dwarf_Unsigned count)
+{
+    Dwarf_Unsigned i = 0;
+
+    for (i = 0; i < count; ++i) {
+        free(errors[i]);
+    }
+    free(errors);
+}
+
+static void
+cc_free_entry(void *e)
+{
+    struct cc_entry_s *ce = (struct cc_entry_s *)e;
+
+    free(ce->ce_usage);
+    cc_free_errors(ce->ce_errors,ce->ce_error_count);
+    free(ce->ce_pu_name);
+    free(ce);
+}
+
+/*  Appends a copy of text to *errors, growing it
+    as needed. Returns FALSE if out of memory. */
+static Dwarf_Bool
+cc_add_error(char ***errors,Dwarf_Unsigned *count,
+    Dwarf_Unsigned *space,const char *text)
+{
+    char *copy = 0;
+    size_t len = strlen(text);
+
+    if (*count >= *space) {
+        Dwarf_Unsigned newspace = *space? *space*2 : 16;
+        char **n = 0;
+
+        n = (char **)calloc(newspace,sizeof(char *));
+        if (!n) {
+            return FALSE;
+        }
+        if (*count) {
+            memcpy(n,*errors,*count*sizeof(char *));
+        }
+        free(*errors);
+        *errors = n;
+        *space = newspace;
+    }
+    copy = (char *)malloc(len+1);
+    if (!copy) {
+        return FALSE;
+    }
+    memcpy(copy,text,len+1);
+    (*errors)[*count] = copy;
+    ++*count;
+    return TRUE;
+}
+
+static int
+cc_compare_usage(const void *l, const void *r)
+{
+    const struct cc_usage_s *lu = (const struct cc_usage_s *)l;
+    const struct cc_usage_s *ru = (const struct cc_usage_s *)r;
+
+    if (lu->cu_kind != ru->cu_kind) {
+        return lu->cu_kind < ru->cu_kind? -1:1;
+    }
+    if (lu->cu_k1 != ru->cu_k1) {
+        return lu->cu_k1 < ru->cu_k1? -1:1;
+    }
+    if (lu->cu_k2 != ru->cu_k2) {
+        return lu->cu_k2 < ru->cu_k2? -1:1;
+    }
+    if (lu->cu_k3 != ru->cu_k3) {
+        return lu->cu_k3 < ru->cu_k3? -1:1;
+    }
+    return 0;
+}
+
+static void
+cc_free_usage(void *u)
+{
+    free(u);
+}
+
+static void
+cc_journal_destroy(void)
+{
+    if (cc_journal) {
+        dwarf_tdestroy(cc_journal,cc_free_usage);
+        cc_journal = 0;
+    }
+    cc_journal_count = 0;
+    cc_free_errors(cc_cu_errors,cc_cu_error_count);
+    cc_cu_errors = 0;
+    cc_cu_error_count = 0;
+    cc_cu_error_space = 0;
+}
+
+/*  Hashes the options given (not the object name,
+    not --check-cache itself) and the dwarfdump version
+    so a cache from a different run setup never matches. */
+void
+checkcache_note_options(int argc, char **argv)
+{
+    int i = 0;
+    const char *ccopt = "--check-cache=";
+
+    cc_options_digest = cc_hash_string(CC_FNV_OFFSET,
+        PACKAGE_VERSION);
+    /*  The last argument is the object file. */
+    for (i = 1; i < argc-1; ++i) {
+        const char *a = argv[i];
+
+        if (!strncmp(a,ccopt,strlen(ccopt))) {
+            continue;
+        }
+        cc_options_digest = cc_hash_string(cc_options_digest,a);
+    }
+}
+
+/*  Reads a hex number, leaving *sp after it.
+    Returns FALSE if there is no number. */
+static Dwarf_Bool
+cc_read_hex(char **sp,Dwarf_Unsigned *out)
+{
+    char *s = *sp;
+    Dwarf_Unsigned v = 0;
+    int digits = 0;
+
+    while (*s == ' ') {
+        ++s;
+    }
+    for ( ; ; ++s, ++digits) {
+        char c = *s;
+
+        if (c >= '0' && c <= '9') {
+            v = (v << 4) | (Dwarf_Unsigned)(c - '0');
+        } else if (c >= 'a' && c <= 'f') {
+            v = (v << 4) | (Dwarf_Unsigned)(c - 'a' + 10);
+        } else {
+            break;
+        }
+    }
+    if (!digits || digits > 16) {
+        return FALSE;
+    }
+    *sp = s;
+    *out = v;
+    return TRUE;
+}
+
+static Dwarf_Bool
+cc_read_hexes(char *s,Dwarf_Unsigned *vals,int count)
+{
+    int i = 0;
+
+    for (i = 0; i < count; ++i) {
+        if (!cc_read_hex(&s,&vals[i])) {
+            return FALSE;
+        }
+    }
+    return TRUE;
+}
+
+static Dwarf_Bool
+cc_add_usage_to_entry(struct cc_entry_s *e,
+    Dwarf_Unsigned *vals,Dwarf_Unsigned *space)
+{
+    struct cc_usage_s *u = 0;
+
+    if (e->ce_usage_count >= *space) {
+        Dwarf_Unsigned newspace = *space? *space*2 : 64;
+        struct cc_usage_s *n = 0;
+
+        n = (struct cc_usage_s *)calloc(newspace,
+            sizeof(struct cc_usage_s));
+        if (!n) {
+            return FALSE;
+        }
+        if (e->ce_usage_count) {
+            memcpy(n,e->ce_usage,
+                e->ce_usage_count*sizeof(struct cc_usage_s));
+        }
+        free(e->ce_usage);
+        e->ce_usage = n;
+        *space = newspace;
+    }
+    u = e->ce_usage + e->ce_usage_count;
+    u->cu_kind = (int)vals[0];
+    u->cu_k1 = (unsigned)vals[1];
+    u->cu_k2 = (unsigned)vals[2];
+    u->cu_k3 = (unsigned)vals[3];
+    u->cu_count = vals[4];
+    ++e->ce_usage_count;
+    return TRUE;
+}
+
+/*  Reads one line, of any length, without its newline.
+    Returns FALSE at end of file. */
+static Dwarf_Bool
+cc_read_line(FILE *f,struct esb_s *line)
+{
+    int c = 0;
+
+    esb_empty_string(line);
+    c = getc(f);
+    if (c == EOF) {
+        return FALSE;
+    }
+    for ( ; c != EOF && c != '\n'; c = getc(f)) {
+        char ch[2];
+
+        ch[0] = (char)c;
+        ch[1] = 0;
+        esb_append(line,ch);
+    }
+    return TRUE;
+}
+
+/*  Texts are kept one per line with
+    backslash and newline escaped. */
+static void
+cc_write_text(FILE *f,const char *tag,const char *s)
+{
+    fputs(tag,f);
+    for ( ; *s; ++s) {
+        if (*s == '\\') {
+            fputs("\\\\",f);
+        } else if (*s == '\n') {
+            fputs("\\n",f);
+        } else {
+            putc(*s,f);
+        }
+    }
+    putc('\n',f);
+}
+
+/*  Undoes cc_write_text() in place.
+    Returns FALSE for a bad escape. */
+static Dwarf_Bool
+cc_unescape_text(char *s)
+{
+    char *out = s;
+
+    for ( ; *s; ++s) {
+        if (*s == '\\') {
+            ++s;
+            if (*s == '\\') {
+                *out++ = '\\';
+            } else if (*s == 'n') {
+                *out++ = '\n';
+            } else {
+                return FALSE;
+            }
+        } else {
+            *out++ = *s;
+        }
+    }
+    *out = 0;
+    return TRUE;
+}
+
+/*  Returns FALSE if the file is not a readable cache.
+    Whatever was read before a problem is kept. */
+static Dwarf_Bool
+cc_read_file(FILE *f)
+{
+    struct esb_s linebuf;
+    char *line = 0;
+    struct cc_entry_s *e = 0;
+    Dwarf_Unsigned space = 0;
+    Dwarf_Unsigned errspace = 0;
+    Dwarf_Unsigned vals[CC_WALK_COUNT];
+    Dwarf_Bool ok = TRUE;
+
+    esb_constructor(&linebuf);
+    if (!cc_read_line(f,&linebuf) ||
+        strcmp(esb_get_string(&linebuf),CHECKCACHE_MAGIC)) {
+        esb_destructor(&linebuf);
+        return FALSE;
+    }
+    while (cc_read_line(f,&linebuf)) {
+        line = esb_get_string(&linebuf);
+        if (!strncmp(line,"cu ",3)) {
+            if (e) {
+                break;
+            }
+            e = (struct cc_entry_s *)calloc(1,
+                sizeof(struct cc_entry_s));
+            if (!e) {
+                return FALSE;
+            }
+            space = 0;
+            errspace = 0;
+            if (!cc_read_hexes(line+3,vals,1)) {
+                break;
+            }
+            e->ce_digest = vals[0];
+        } else if (!e) {
+            ok = FALSE;
+            break;
+        } else if (!strncmp(line,"k ",2)) {
+            if (!cc_read_hexes(line+2,vals,3) ||
+                vals[0] >= LAST_CATEGORY ||
+                vals[0] == total_check_result) {
+                break;
+            }
+            e->ce_results[vals[0]].checks = (int)vals[1];
+            e->ce_results[vals[0]].errors = (int)vals[2];
+        } else if (!strncmp(line,"g ",2)) {
+            if (!cc_read_hexes(line+2,vals,5)) {
+                break;
+            }
+            e->ce_major_errors = vals[0];
+            e->ce_macronotes = vals[1];
+            e->ce_check_error = vals[2];
+            e->ce_addr_missing = vals[3];
+            e->ce_addr_errcode = vals[4];
+        } else if (!strncmp(line,"u ",2)) {
+            if (!cc_read_hexes(line+2,vals,5) ||
+                !cc_add_usage_to_entry(e,vals,&space)) {
+                break;
+            }
+        } else if (!strncmp(line,"w ",2)) {
+            if (!cc_read_hexes(line+2,e->ce_walk,CC_WALK_COUNT)) {
+                break;
+            }
+        } else if (!strncmp(line,"p ",2)) {
+            size_t len = 0;
+
+            if (e->ce_pu_name || !cc_unescape_text(line+2)) {
+                break;
+            }
+            len = strlen(line+2);
+            e->ce_pu_name = (char *)malloc(len+1);
+            if (!e->ce_pu_name) {
+                break;
+            }
+            memcpy(e->ce_pu_name,line+2,len+1);
+        } else if (!strncmp(line,"e ",2)) {
+            if (!cc_unescape_text(line+2) ||
+                !cc_add_error(&e->ce_errors,&e->ce_error_count,
+                &errspace,line+2)) {
+                break;
+            }
+        } else if (!strcmp(line,"end")) {
+            void *ret = 0;
+
+            if (!e->ce_pu_name) {
+                /* Every entry has a p line. */
+                break;
+            }
+            ret = dwarf_tsearch(e,&cc_entries,cc_compare_entry);
+            if (!ret || *(struct cc_entry_s **)ret != e) {
+                /* Out of memory or a duplicate. */
+                cc_free_entry(e);
+            }
+            e = 0;
+        } else {
+            break;
+        }
+    }
+    esb_destructor(&linebuf);
+    if (e) {
+        /* A partial entry, the file is damaged. */
+        cc_free_entry(e);
+        return FALSE;
+    }
+    return ok;
+}
+
+void
+checkcache_open(void)
+{
+    FILE *f = 0;
+
+    cc_active = FALSE;
+    if (!glflags.check_cache_file) {
+        return;
+    }
+    if (!glflags.gf_do_check_dwarf || glflags.gf_do_print_dwarf ||
+        glflags.gf_search_is_on || glflags.gf_cu_name_flag) {
+        printf("NOTE: --check-cache applies only to -k checking "
+            "of all CUs without printing or searching. "
+            "Ignored.\n");
+        return;
+    }
+    cc_active = TRUE;
+    cc_reused_count = 0;
+    cc_checked_count = 0;
+    cc_reused_with_errors = 0;
+    cc_shared_dbg = 0;
+    f = fopen(glflags.check_cache_file,"r");
+    if (!f) {
+        /* First run, nothing cached yet. */
+        return;
+    }
+    if (!cc_read_file(f)) {
+        printf("NOTE: check cache %s is not usable, "
+            "all CUs will be checked.\n",
+            sanitized(glflags.check_cache_file));
+    }
+    fclose(f);
+}
+
+static void
+cc_write_entry(const void *nodep,const DW_VISIT which,
+    const int depth)
+{
+    struct cc_entry_s *e = *(struct cc_entry_s **)nodep;
+    FILE *f = cc_walk_file;
+    Dwarf_Unsigned i = 0;
+
+    (void)depth;
+    if (which != dwarf_postorder && which != dwarf_leaf) {
+        return;
+    }
+    if (!e->ce_used) {
+        /* Not in this object any more. */
+        return;
+    }
+    fprintf(f,"cu %" DW_PR_DUx "\n",e->ce_digest);
+    for (i = 0; i < LAST_CATEGORY; ++i) {
+        Dwarf_Check_Result *r = &e->ce_results[i];
+
+        if (i == total_check_result) {
+            /* Recomputed from the others. */
+            continue;
+        }
+        if (r->checks || r->errors) {
+            fprintf(f,"k %" DW_PR_DUx " %x %x\n",i,
+                (unsigned)r->checks,(unsigned)r->errors);
+        }
+    }
+    fprintf(f,"g %" DW_PR_DUx " %" DW_PR_DUx " %" DW_PR_DUx
+        " %" DW_PR_DUx " %" DW_PR_DUx "\n",
+        e->ce_major_errors,e->ce_macronotes,e->ce_check_error,
+        e->ce_addr_missing,e->ce_addr_errcode);
+    for (i = 0; i < e->ce_usage_count; ++i) {
+        struct cc_usage_s *u = &e->ce_usage[i];
+
+        fprintf(f,"u %x %x %x %x %" DW_PR_DUx "\n",
+            (unsigned)u->cu_kind,u->cu_k1,u->cu_k2,u->cu_k3,
+            u->cu_count);
+    }
+    for (i = 0; i < e->ce_error_count; ++i) {
+        cc_write_text(f,"e ",e->ce_errors[i]);
+    }
+    fprintf(f,"w");
+    for (i = 0; i < CC_WALK_COUNT; ++i) {
+        fprintf(f," %" DW_PR_DUx,e->ce_walk[i]);
+    }
+    fprintf(f,"\n");
+    cc_write_text(f,"p ",e->ce_pu_name? e->ce_pu_name : "");
+    fprintf(f,"end\n");
+}
+
+void
+checkcache_close(void)
+{
+    struct esb_s tmpname;
+    FILE *f = 0;
+    int res = 0;
+
+    if (!cc_active) {
+        return;
+    }
+    cc_active = FALSE;
+    cc_journal_destroy();
+    esb_constructor(&tmpname);
+    esb_append(&tmpname,glflags.check_cache_file);
+    esb_append(&tmpname,".tmp");
+    f = fopen(esb_get_string(&tmpname),"w");
+    if (!f) {
+        printf("ERROR: unable to write check cache %s\n",
+            sanitized(esb_get_string(&tmpname)));
+        glflags.gf_count_major_errors++;
+    } else {
+        fprintf(f,"%s\n",CHECKCACHE_MAGIC);
+        cc_walk_file = f;
+        dwarf_twalk(cc_entries,cc_write_entry);
+        cc_walk_file = 0;
+        res = fclose(f);
+        if (!res) {
+            /*  rename() will not replace an existing
+                file everywhere. */
+            remove(glflags.check_cache_file);
+            res = rename(esb_get_string(&tmpname),
+                glflags.check_cache_file);
+        }
+        if (res) {
+            printf("ERROR: unable to replace check cache %s\n",
+                sanitized(glflags.check_cache_file));
+            glflags.gf_count_major_errors++;
+        }
+    }
+    esb_destructor(&tmpname);
+    if (cc_entries) {
+        dwarf_tdestroy(cc_entries,cc_free_entry);
+        cc_entries = 0;
+    }
+    cc_shared_dbg = 0;
+    if (cc_reused_with_errors && glflags.gf_check_verbose_mode) {
+        printf("NOTE: the check messages of %" DW_PR_DUu
+            " reused CUs are not repeated.\n",
+            cc_reused_with_errors);
+    }
+    printf("Check cache: %" DW_PR_DUu " CUs reused, %"
+        DW_PR_DUu " checked\n",
+        cc_reused_count,cc_checked_count);
+}
+
+/*  What a CU digest needs to know of the CU
+    while its DIEs are hashed. */
+struct cc_cu_s {
+    Dwarf_Half     cc_version;
+    Dwarf_Half     cc_offset_size;
+    Dwarf_Off      cc_cuoff;
+    Dwarf_Unsigned cc_culen;
+    int            cc_depth;
+    Dwarf_Bool     cc_has_pu;
+};
+
+static Dwarf_Unsigned
+cc_hash_buckets(Dwarf_Unsigned h,Bucket_Group *g)
+{
+    Bucket *b = 0;
+
+    if (!g) {
+        return cc_hash_number(h,0);
+    }
+    h = cc_hash_number(h,g->lower);
+    h = cc_hash_number(h,g->upper);
+    for (b = g->pHead; b; b = b->pNext) {
+        int i = 0;
+
+        for (i = 0; i < b->nEntries; ++i) {
+            Bucket_Data *d = &b->Entries[i];
+
+            h = cc_hash_string(h,d->name);
+            h = cc_hash_number(h,d->low);
+            h = cc_hash_number(h,d->high);
+        }
+    }
+    return h;
+}
+
+/*  The part of every CU digest that is the same
+    for all CUs of an object: the options and the code
+    limits the range checks use.  No section is hashed
+    here, each CU hashes only what it refers to,
+    including the linkonce sections it looks up. */
+static Dwarf_Bool
+cc_linkonce_empty(void)
+{
+    Bucket_Group *g = glflags.pLinkonceInfo;
+
+    return !g || !g->pHead || !g->pHead->nEntries;
+}
+
+/*  The range checks accept a subprogram address
+    range found in the linkonce section named
+    .text.<name>, so what is there is part of
+    the digest of a CU with that name. */
+static void
+cc_hash_linkonce_name(const char *name,Dwarf_Unsigned *hp)
+{
+    Bucket *b = 0;
+    const char *prefix = ".text.";
+    size_t plen = strlen(prefix);
+
+    if (cc_linkonce_empty()) {
+        return;
+    }
+    for (b = glflags.pLinkonceInfo->pHead; b; b = b->pNext) {
+        int i = 0;
+
+        for (i = 0; i < b->nEntries; ++i) {
+            Bucket_Data *d = &b->Entries[i];
+
+            if (d->name && !strncmp(d->name,prefix,plen) &&
+                !strcmp(d->name+plen,name)) {
+                *hp = cc_hash_number(*hp,d->low);
+                *hp = cc_hash_number(*hp,d->high);
+                return;
+            }
+        }
+    }
+    *hp = cc_hash_number(*hp,0);
+}
+
+static Dwarf_Bool
+cc_compute_shared_digest(Dwarf_Debug dbg)
+{
+    Dwarf_Unsigned h = cc_options_digest;
+    Dwarf_Debug tied = 0;
+
+    dwarf_get_tied_dbg(dbg,&tied,0);
+    if (tied) {
+        /*  Skeleton CUs take data from the tied
+            object. Not cached. */
+        return FALSE;
+    }
+    h = cc_hash_buckets(h,glflags.pRangesInfo);
+    cc_shared_digest = h;
+    return TRUE;
+}
+
+/*  Adds the bytes of the abbreviation table starting
+    at abbrev_offset, but not the offset itself. */
+static Dwarf_Bool
+cc_hash_abbrevs(Dwarf_Debug dbg,Dwarf_Unsigned abbrev_offset,
+    Dwarf_Unsigned *hp)
+{
+    const Dwarf_Small *data = 0;
+    Dwarf_Unsigned size = 0;
+    Dwarf_Unsigned off = abbrev_offset;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_get_section_bytes(dbg,".debug_abbrev",
+        &data,&size,&err);
+    if (res != DW_DLV_OK) {
+        DROP_ERROR_INSTANCE(dbg,res,err);
+        return FALSE;
+    }
+    for (;;) {
+        Dwarf_Abbrev ab = 0;
+        Dwarf_Unsigned len = 0;
+        Dwarf_Unsigned attrcount = 0;
+
+        res = dwarf_get_abbrev(dbg,off,&ab,&len,&attrcount,&err);
+        if (res != DW_DLV_OK) {
+            DROP_ERROR_INSTANCE(dbg,res,err);
+            return FALSE;
+        }
+        dwarf_dealloc(dbg,ab,DW_DLA_ABBREV);
+        if (!len || len > size - off) {
+            return FALSE;
+        }
+        off += len;
+        if (len == 1) {
+            /* The null entry ending this table. */
+            break;
+        }
+    }
+    *hp = cc_hash_bytes(*hp,data+abbrev_offset,off-abbrev_offset);
+    return TRUE;
+}
+
+static Dwarf_Unsigned
+cc_read_number(const Dwarf_Small *p,int len,Dwarf_Bool bigend)
+{
+    Dwarf_Unsigned v = 0;
+    int i = 0;
+
+    for (i = 0; i < len; ++i) {
+        v = (v << 8) | p[bigend? i : len-1-i];
+    }
+    return v;
+}
+
+/*  Adds the file names of the line table,
+    as dwarf_srcfiles() resolves them. */
+static Dwarf_Bool
+cc_hash_srcfiles(Dwarf_Debug dbg,Dwarf_Die cu_die,
+    Dwarf_Unsigned *hp)
+{
+    char **srcfiles = 0;
+    Dwarf_Signed count = 0;
+    Dwarf_Signed i = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_srcfiles(cu_die,&srcfiles,&count,&err);
+    if (res != DW_DLV_OK) {
+        DROP_ERROR_INSTANCE(dbg,res,err);
+        return FALSE;
+    }
+    *hp = cc_hash_number(*hp,(Dwarf_Unsigned)count);
+    for (i = 0; i < count; ++i) {
+        *hp = cc_hash_string(*hp,srcfiles[i]);
+        dwarf_dealloc(dbg,srcfiles[i],DW_DLA_STRING);
+    }
+    dwarf_dealloc(dbg,srcfiles,DW_DLA_LIST);
+    return TRUE;
+}
+
+/*  The line checks accept a line address outside
+    the code limits if any linkonce section holds it.
+    Adds, per line, whether one does. */
+static Dwarf_Bool
+cc_hash_linkonce_lines(Dwarf_Debug dbg,Dwarf_Die cu_die,
+    Dwarf_Unsigned *hp)
+{
+    Dwarf_Unsigned version = 0;
+    Dwarf_Small table_count = 0;
+    Dwarf_Line_Context context = 0;
+    Dwarf_Line *lines = 0;
+    Dwarf_Signed count = 0;
+    Dwarf_Signed i = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    if (cc_linkonce_empty() || !glflags.gf_check_lines) {
+        return TRUE;
+    }
+    res = dwarf_srclines_b(cu_die,&version,&table_count,
+        &context,&err);
+    if (res == DW_DLV_ERROR) {
+        DROP_ERROR_INSTANCE(dbg,res,err);
+        return FALSE;
+    }
+    if (res == DW_DLV_NO_ENTRY) {
+        return TRUE;
+    }
+    if (table_count != 1) {
+        /* Two-level tables are not followed. */
+        dwarf_srclines_dealloc_b(context);
+        return table_count == 0;
+    }
+    res = dwarf_srclines_from_linecontext(context,&lines,
+        &count,&err);
+    if (res == DW_DLV_ERROR) {
+        DROP_ERROR_INSTANCE(dbg,res,err);
+        dwarf_srclines_dealloc_b(context);
+        return FALSE;
+    }
+    for (i = 0; res == DW_DLV_OK && i < count; ++i) {
+        Dwarf_Addr pc = 0;
+
+        res = dwarf_lineaddr(lines[i],&pc,&err);
+        if (res == DW_DLV_OK) {
+            *hp = cc_hash_number(*hp,FindAddressInBucketGroup(
+                glflags.pLinkonceInfo,pc));
+        }
+    }
+    dwarf_srclines_dealloc_b(context);
+    if (res == DW_DLV_ERROR) {
+        DROP_ERROR_INSTANCE(dbg,res,err);
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/*  Adds the line table unit DW_AT_stmt_list names.
+    Before DWARF5 the unit holds no offsets and is
+    hashed whole.  A DWARF5 header names its directories
+    and files by offsets into .debug_line_str, so for it
+    the fixed header fields, the resolved file names and
+    the line program are hashed instead. */
+static Dwarf_Bool
+cc_hash_line_unit(Dwarf_Debug dbg,Dwarf_Die cu_die,
+    Dwarf_Attribute attr,Dwarf_Unsigned *hp)
+{
+    Dwarf_Off lineoff = 0;
+    const Dwarf_Small *data = 0;
+    const Dwarf_Small *unit = 0;
+    Dwarf_Unsigned size = 0;
+    Dwarf_Unsigned unitlen = 0;
+    Dwarf_Unsigned lensize = 4;
+    Dwarf_Unsigned offsize = 4;
+    Dwarf_Unsigned version = 0;
+    Dwarf_Unsigned pos = 0;
+    Dwarf_Unsigned headerlen = 0;
+    Dwarf_Unsigned progstart = 0;
+    Dwarf_Unsigned fixedend = 0;
+    Dwarf_Bool bigend = FALSE;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_global_formref(attr,&lineoff,&err);
+    if (res != DW_DLV_OK) {
+        DROP_ERROR_INSTANCE(dbg,res,err);
+        return FALSE;
+    }
+    res = dwarf_get_section_bytes(dbg,".debug_line",
+        &data,&size,&err);
+    if (res != DW_DLV_OK) {
+        DROP_ERROR_INSTANCE(dbg,res,err);
+        return FALSE;
+    }
+    dwarf_machine_architecture(dbg,0,0,&bigend,0,0,0,0,0,0,0);
+    if (lineoff > size || size - lineoff < 4) {
+        return FALSE;
+    }
+    unit = data + lineoff;
+    unitlen = cc_read_number(unit,4,bigend);
+    if (unitlen == 0xffffffff) {
+        if (size - lineoff < 12) {
+            return FALSE;
+        }
+        unitlen = cc_read_number(unit+4,8,bigend);
+        lensize = 12;
+        offsize = 8;
+    }
+    if (unitlen > size - lineoff - lensize || unitlen < 2) {
+        return FALSE;
+    }
+    unitlen += lensize;
+    version = cc_read_number(unit+lensize,2,bigend);
+    if (!cc_hash_linkonce_lines(dbg,cu_die,hp)) {
+        return FALSE;
+    }
+    if (version < DWVERSION5) {
+        *hp = cc_hash_bytes(*hp,unit,unitlen);
+        return TRUE;
+    }
+    /*  version, address_size, segment_selector_size,
+        header_length. */
+    pos = lensize + 2 + 2;
+    if (pos + offsize > unitlen) {
+        return FALSE;
+    }
+    headerlen = cc_read_number(unit+pos,(int)offsize,bigend);
+    pos += offsize;
+    if (headerlen > unitlen - pos) {
+        return FALSE;
+    }
+    progstart = pos + headerlen;
+    /*  minimum_instruction_length through opcode_base,
+        then standard_opcode_lengths. */
+    if (pos + 6 > progstart || !unit[pos+5]) {
+        return FALSE;
+    }
+    fixedend = pos + 6 + unit[pos+5] - 1;
+    if (fixedend > progstart) {
+        return FALSE;
+    }
+    *hp = cc_hash_bytes(*hp,unit,fixedend);
+    if (!cc_hash_srcfiles(dbg,cu_die,hp)) {
+        return FALSE;
+    }
+    *hp = cc_hash_bytes(*hp,unit+progstart,unitlen-progstart);
+    return TRUE;
+}
+
+/*  A .debug_info offset in an expression is hashed
+    relative to the CU. One outside the CU makes
+    the CU depend on another, so not cacheable. */
+static Dwarf_Bool
+cc_hash_info_offset(struct cc_cu_s *cu,Dwarf_Unsigned off,
+    Dwarf_Unsigned *hp)
+{
+    if (off < cu->cc_cuoff || off - cu->cc_cuoff >= cu->cc_culen) {
+        return FALSE;
+    }
+    *hp = cc_hash_number(*hp,off - cu->cc_cuoff);
+    return TRUE;
+}
+
+/*  Adds one location expression, operator by operator.
+    A few operators have operands libdwarf returns
+    as pointers to bytes; the bytes are hashed. */
+static Dwarf_Bool
+cc_hash_locexpr(Dwarf_Debug dbg,Dwarf_Locdesc_c locdesc,
+    Dwarf_Unsigned opcount,struct cc_cu_s *cu,
+    Dwarf_Unsigned *hp)
+{
+    Dwarf_Unsigned i = 0;
+    Dwarf_Error err = 0;
+
+    for (i = 0; i < opcount; ++i) {
+        Dwarf_Small op = 0;
+        Dwarf_Unsigned op1 = 0;
+        Dwarf_Unsigned op2 = 0;
+        Dwarf_Unsigned op3 = 0;
+        Dwarf_Unsigned branchoff = 0;
+        int res = 0;
+
+        res = dwarf_get_location_op_value_c(locdesc,i,
+            &op,&op1,&op2,&op3,&branchoff,&err);
+        if (res != DW_DLV_OK) {
+            DROP_ERROR_INSTANCE(dbg,res,err);
+            return FALSE;
+        }
+        *hp = cc_hash_number(*hp,op);
+        *hp = cc_hash_number(*hp,branchoff);
+        switch (op) {
+        case DW_OP_implicit_value:
+        case DW_OP_entry_value:
+        case DW_OP_GNU_entry_value:
+            *hp = cc_hash_number(*hp,op1);
+            *hp = cc_hash_bytes(*hp,
+                (const Dwarf_Small *)(uintptr_t)op2,op1);
+            break;
+        case DW_OP_const_type:
+        case DW_OP_GNU_const_type:
+            *hp = cc_hash_number(*hp,op1);
+            *hp = cc_hash_number(*hp,op2);
+            *hp = cc_hash_bytes(*hp,
+                (const Dwarf_Small *)(uintptr_t)op3,op2);
+            break;
+        case DW_OP_call_ref:
+        case DW_OP_implicit_pointer:
+        case DW_OP_GNU_implicit_pointer:
+        case DW_OP_GNU_variable_value:
+            if (!cc_hash_info_offset(cu,op1,hp)) {
+                return FALSE;
+            }
+            *hp = cc_hash_number(*hp,op2);
+            break;
+        default:
+            *hp = cc_hash_number(*hp,op1);
+            *hp = cc_hash_number(*hp,op2);
+            *hp = cc_hash_number(*hp,op3);
+            break;
+        }
+    }
+    return TRUE;
+}
+
+/*  Adds the entries of a location list or the single
+    expression of an exprloc, not where they are. */
+static Dwarf_Bool
+cc_hash_locations(Dwarf_Debug dbg,Dwarf_Attribute attr,
+    struct cc_cu_s *cu,Dwarf_Unsigned *hp)
+{
+    Dwarf_Loc_Head_c head = 0;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Unsigned i = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_get_loclist_c(attr,&head,&count,&err);
+    if (res != DW_DLV_OK) {
+        DROP_ERROR_INSTANCE(dbg,res,err);
+        return FALSE;
+    }
+    *hp = cc_hash_number(*hp,count);
+    for (i = 0; i < count; ++i) {
+        Dwarf_Small lle = 0;
+        Dwarf_Unsigned rawlow = 0;
+        Dwarf_Unsigned rawhigh = 0;
+        Dwarf_Bool noaddr = FALSE;
+        Dwarf_Addr low = 0;
+        Dwarf_Addr high = 0;
+        Dwarf_Unsigned opcount = 0;
+        Dwarf_Locdesc_c locdesc = 0;
+        Dwarf_Small source = 0;
+        Dwarf_Unsigned exproff = 0;
+        Dwarf_Unsigned descoff = 0;
+
+        res = dwarf_get_locdesc_entry_d(head,i,&lle,
+            &rawlow,&rawhigh,&noaddr,&low,&high,
+            &opcount,&locdesc,&source,&exproff,&descoff,&err);
+        if (res != DW_DLV_OK) {
+            DROP_ERROR_INSTANCE(dbg,res,err);
+            dwarf_dealloc_loc_head_c(head);
+            return FALSE;
+        }
+        *hp = cc_hash_number(*hp,lle);
+        *hp = cc_hash_number(*hp,rawlow);
+        *hp = cc_hash_number(*hp,rawhigh);
+        *hp = cc_hash_number(*hp,noaddr);
+        *hp = cc_hash_number(*hp,low);
+        *hp = cc_hash_number(*hp,high);
+        *hp = cc_hash_number(*hp,source);
+        *hp = cc_hash_number(*hp,opcount);
+        if (!cc_hash_locexpr(dbg,locdesc,opcount,cu,hp)) {
+            dwarf_dealloc_loc_head_c(head);
+            return FALSE;
+        }
+    }
+    dwarf_dealloc_loc_head_c(head);
+    return TRUE;
+}
+
+/*  Adds the entries of a .debug_ranges or
+    .debug_rnglists range list, not where it is. */
+static Dwarf_Bool
+cc_hash_ranges(Dwarf_Debug dbg,Dwarf_Die die,
+    Dwarf_Attribute attr,Dwarf_Half form,
+    struct cc_cu_s *cu,Dwarf_Unsigned *hp)
+{
+    Dwarf_Unsigned value = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    if (form == DW_FORM_rnglistx) {
+        res = dwarf_formudata(attr,&value,&err);
+    } else {
+        res = dwarf_global_formref(attr,&value,&err);
+    }
+    if (res != DW_DLV_OK) {
+        DROP_ERROR_INSTANCE(dbg,res,err);
+        return FALSE;
+    }
+    if (cu->cc_version < DWVERSION5) {
+        Dwarf_Ranges *ranges = 0;
+        Dwarf_Signed count = 0;
+        Dwarf_Signed i = 0;
+        Dwarf_Unsigned bytecount = 0;
+        Dwarf_Off realoff = 0;
+
+        res = dwarf_get_ranges_b(dbg,value,die,&realoff,
+            &ranges,&count,&bytecount,&err);
+        if (res != DW_DLV_OK) {
+            DROP_ERROR_INSTANCE(dbg,res,err);
+            return FALSE;
+        }
+        *hp = cc_hash_number(*hp,(Dwarf_Unsigned)count);
+        for (i = 0; i < count; ++i) {
+            *hp = cc_hash_number(*hp,ranges[i].dwr_type);
+            *hp = cc_hash_number(*hp,ranges[i].dwr_addr1);
+            *hp = cc_hash_number(*hp,ranges[i].dwr_addr2);
+        }
+        dwarf_dealloc_ranges(dbg,ranges,count);
+    } else {
+        Dwarf_Rnglists_Head head = 0;
+        Dwarf_Unsigned count = 0;
+        Dwarf_Unsigned globoff = 0;
+        Dwarf_Unsigned i = 0;
+
+        res = dwarf_rnglists_get_rle_head(attr,form,value,
+            &head,&count,&globoff,&err);
+        if (res != DW_DLV_OK) {
+            DROP_ERROR_INSTANCE(dbg,res,err);
+            return FALSE;
+        }
+        *hp = cc_hash_number(*hp,count);
+        for (i = 0; i < count; ++i) {
+            unsigned entrylen = 0;
+            unsigned code = 0;
+            Dwarf_Unsigned raw1 = 0;
+            Dwarf_Unsigned raw2 = 0;
+            Dwarf_Bool noaddr = FALSE;
+            Dwarf_Unsigned cooked1 = 0;
+            Dwarf_Unsigned cooked2 = 0;
+
+            res = dwarf_get_rnglists_entry_fields_a(head,i,
+                &entrylen,&code,&raw1,&raw2,&noaddr,
+                &cooked1,&cooked2,&err);
+            if (res != DW_DLV_OK) {
+                DROP_ERROR_INSTANCE(dbg,res,err);
+                dwarf_dealloc_rnglists_head(head);
+                return FALSE;
+            }
+            *hp = cc_hash_number(*hp,entrylen);
+            *hp = cc_hash_number(*hp,code);
+            *hp = cc_hash_number(*hp,raw1);
+            *hp = cc_hash_number(*hp,raw2);
+            *hp = cc_hash_number(*hp,noaddr);
+            *hp = cc_hash_number(*hp,cooked1);
+            *hp = cc_hash_number(*hp,cooked2);
+        }
+        dwarf_dealloc_rnglists_head(head);
+    }
+    return TRUE;
+}
+
+/*  Adds one attribute: its number, its forms and
+    its value with every section offset replaced by
+    what is found there.  Returns FALSE if the value
+    cannot be read or the CU refers outside itself. */
+static Dwarf_Bool
+cc_hash_attr(Dwarf_Debug dbg,Dwarf_Die die,
+    Dwarf_Attribute attr,struct cc_cu_s *cu,Dwarf_Unsigned *hp)
+{
+    Dwarf_Half attrnum = 0;
+    Dwarf_Half form = 0;
+    Dwarf_Half directform = 0;
+    enum Dwarf_Form_Class fc = DW_FORM_CLASS_UNKNOWN;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_whatattr(attr,&attrnum,&err);
+    if (res == DW_DLV_OK) {
+        res = dwarf_whatform(attr,&form,&err);
+    }
+    if (res == DW_DLV_OK) {
+        res = dwarf_whatform_direct(attr,&directform,&err);
+    }
+    if (res != DW_DLV_OK) {
+        DROP_ERROR_INSTANCE(dbg,res,err);
+        return FALSE;
+    }
+    *hp = cc_hash_number(*hp,attrnum);
+    *hp = cc_hash_number(*hp,form);
+    *hp = cc_hash_number(*hp,directform);
+    switch (form) {
+    case DW_FORM_ref_addr:
+    case DW_FORM_ref_sig8:
+    case DW_FORM_GNU_ref_alt:
+    case DW_FORM_ref_sup4:
+    case DW_FORM_ref_sup8:
+    case DW_FORM_GNU_strp_alt:
+    case DW_FORM_strp_sup:
+        /*  As checkcache_note_form(). */
+        return FALSE;
+    default:
+        break;
+    }
+    fc = dwarf_get_form_class(cu->cc_version,attrnum,
+        cu->cc_offset_size,form);
+    switch (fc) {
+    case DW_FORM_CLASS_STRING: {
+        char *s = 0;
+
+        res = dwarf_formstring(attr,&s,&err);
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        *hp = cc_hash_string(*hp,s);
+        if (attrnum == DW_AT_name ||
+            attrnum == DW_AT_linkage_name ||
+            attrnum == DW_AT_MIPS_linkage_name) {
+            cc_hash_linkonce_name(s,hp);
+        }
+        return TRUE;
+    }
+    case DW_FORM_CLASS_ADDRESS: {
+        Dwarf_Addr addr = 0;
+
+        res = dwarf_formaddr(attr,&addr,&err);
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        *hp = cc_hash_number(*hp,addr);
+        return TRUE;
+    }
+    case DW_FORM_CLASS_REFERENCE: {
+        Dwarf_Off off = 0;
+        Dwarf_Bool is_info = TRUE;
+
+        res = dwarf_formref(attr,&off,&is_info,&err);
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        *hp = cc_hash_number(*hp,off);
+        return TRUE;
+    }
+    case DW_FORM_CLASS_FLAG: {
+        Dwarf_Bool flag = FALSE;
+
+        res = dwarf_formflag(attr,&flag,&err);
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        *hp = cc_hash_number(*hp,flag);
+        return TRUE;
+    }
+    case DW_FORM_CLASS_CONSTANT:
+        if (form == DW_FORM_data16) {
+            Dwarf_Form_Data16 d16;
+
+            res = dwarf_formdata16(attr,&d16,&err);
+            if (res != DW_DLV_OK) {
+                break;
+            }
+            *hp = cc_hash_bytes(*hp,
+                (const Dwarf_Small *)&d16,sizeof(d16));
+        } else if (form == DW_FORM_sdata ||
+            form == DW_FORM_implicit_const) {
+            Dwarf_Signed sval = 0;
+
+            res = dwarf_formsdata(attr,&sval,&err);
+            if (res != DW_DLV_OK) {
+                break;
+            }
+            *hp = cc_hash_number(*hp,(Dwarf_Unsigned)sval);
+        } else {
+            Dwarf_Unsigned uval = 0;
+
+            res = dwarf_formudata(attr,&uval,&err);
+            if (res != DW_DLV_OK) {
+                break;
+            }
+            *hp = cc_hash_number(*hp,uval);
+        }
+        return TRUE;
+    case DW_FORM_CLASS_BLOCK: {
+        Dwarf_Block *block = 0;
+
+        res = dwarf_formblock(attr,&block,&err);
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        *hp = cc_hash_number(*hp,block->bl_len);
+        *hp = cc_hash_bytes(*hp,
+            (const Dwarf_Small *)block->bl_data,block->bl_len);
+        dwarf_dealloc(dbg,block,DW_DLA_BLOCK);
+        return TRUE;
+    }
+    case DW_FORM_CLASS_EXPRLOC:
+    case DW_FORM_CLASS_LOCLIST:
+    case DW_FORM_CLASS_LOCLISTPTR:
+        return cc_hash_locations(dbg,attr,cu,hp);
+    case DW_FORM_CLASS_RANGELISTPTR:
+    case DW_FORM_CLASS_RNGLIST:
+        return cc_hash_ranges(dbg,die,attr,form,cu,hp);
+    case DW_FORM_CLASS_LINEPTR:
+        return cc_hash_line_unit(dbg,die,attr,hp);
+    case DW_FORM_CLASS_MACPTR:
+    case DW_FORM_CLASS_MACROPTR:
+    case DW_FORM_CLASS_ADDRPTR:
+    case DW_FORM_CLASS_LOCLISTSPTR:
+    case DW_FORM_CLASS_RNGLISTSPTR:
+    case DW_FORM_CLASS_STROFFSETSPTR:
+    case DW_FORM_CLASS_FRAMEPTR:
+        /*  Bases and offsets into shared sections.
+            What the CU finds through them is hashed
+            where it is used; the macro checks are
+            not cached. */
+        return TRUE;
+    default:
+        if (form == DW_FORM_sec_offset) {
+            /*  An offset for an attribute libdwarf
+                does not know, the checks do not
+                follow it. */
+            return TRUE;
+        }
+        return FALSE;
+    }
+    DROP_ERROR_INSTANCE(dbg,res,err);
+    return FALSE;
+}
+
+static Dwarf_Bool
+cc_hash_die(Dwarf_Debug dbg,Dwarf_Die die,struct cc_cu_s *cu,
+    Dwarf_Unsigned *hp)
+{
+    Dwarf_Half tag = 0;
+    Dwarf_Off dieoff = 0;
+    Dwarf_Attribute *atlist = 0;
+    Dwarf_Signed atcount = 0;
+    Dwarf_Signed i = 0;
+    Dwarf_Bool ok = TRUE;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_tag(die,&tag,&err);
+    if (res == DW_DLV_OK) {
+        res = dwarf_die_CU_offset(die,&dieoff,&err);
+    }
+    if (res != DW_DLV_OK) {
+        DROP_ERROR_INSTANCE(dbg,res,err);
+        return FALSE;
+    }
+    if (cu->cc_depth == 1 && tag == DW_TAG_subprogram) {
+        cu->cc_has_pu = TRUE;
+    }
+    *hp = cc_hash_number(*hp,dieoff);
+    *hp = cc_hash_number(*hp,tag);
+    *hp = cc_hash_number(*hp,dwarf_die_abbrev_code(die));
+    res = dwarf_attrlist(die,&atlist,&atcount,&err);
+    if (res == DW_DLV_ERROR) {
+        DROP_ERROR_INSTANCE(dbg,res,err);
+        return FALSE;
+    }
+    *hp = cc_hash_number(*hp,(Dwarf_Unsigned)atcount);
+    for (i = 0; i < atcount; ++i) {
+        if (ok) {
+            ok = cc_hash_attr(dbg,die,atlist[i],cu,hp);
+        }
+        dwarf_dealloc_attribute(atlist[i]);
+    }
+    if (atlist) {
+        dwarf_dealloc(dbg,atlist,DW_DLA_LIST);
+    }
+    return ok;
+}
+
+/*  Hashes die, its children and its following
+    siblings.  die belongs to the caller. */
+static Dwarf_Bool
+cc_hash_die_tree(Dwarf_Debug dbg,Dwarf_Die die,
+    struct cc_cu_s *cu,Dwarf_Unsigned *hp)
+{
+    Dwarf_Die cur = die;
+    Dwarf_Bool ok = TRUE;
+
+    while (ok) {
+        Dwarf_Die child = 0;
+        Dwarf_Die sib = 0;
+        Dwarf_Error err = 0;
+        int res = 0;
+
+        ok = cc_hash_die(dbg,cur,cu,hp);
+        if (ok) {
+            res = dwarf_child(cur,&child,&err);
+            if (res == DW_DLV_OK) {
+                /* Marks where the children end. */
+                *hp = cc_hash_number(*hp,1);
+                ++cu->cc_depth;
+                ok = cc_hash_die_tree(dbg,child,cu,hp);
+                --cu->cc_depth;
+                dwarf_dealloc_die(child);
+            } else if (res == DW_DLV_ERROR) {
+                DROP_ERROR_INSTANCE(dbg,res,err);
+                ok = FALSE;
+            }
+            *hp = cc_hash_number(*hp,0);
+        }
+        if (ok) {
+            res = dwarf_siblingof_c(cur,&sib,&err);
+            if (res == DW_DLV_ERROR) {
+                DROP_ERROR_INSTANCE(dbg,res,err);
+                ok = FALSE;
+            }
+        }
+        if (cur != die) {
+            dwarf_dealloc_die(cur);
+        }
+        if (!ok || res == DW_DLV_NO_ENTRY) {
+            break;
+        }
+        cur = sib;
+    }
+    return ok;
+}
+
+/*  The digest of a CU is made from its header values,
+    its abbreviations and its DIEs, with the values
+    each check reads resolved: strings and addresses,
+    the entries of its location and range lists and
+    its line table.  Offsets into .debug_info (other
+    than within the CU), .debug_abbrev, .debug_str,
+    .debug_line and the other shared sections are not
+    hashed, so a change in one CU does not change the
+    digest of another. */
+static Dwarf_Bool
+cc_compute_cu_digest(Dwarf_Debug dbg,Dwarf_Die cu_die,
+    Dwarf_Bool is_info,Dwarf_Unsigned abbrev_offset,
+    Dwarf_Unsigned *digest_out)
+{
+    Dwarf_Unsigned h = 0;
+    struct cc_cu_s cu;
+    Dwarf_Bool hdr_is_info = TRUE;
+    Dwarf_Bool is_dwo = FALSE;
+    Dwarf_Half address_size = 0;
+    Dwarf_Half extension_size = 0;
+    Dwarf_Sig8 *signature = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    if (cc_shared_dbg != dbg) {
+        cc_shared_dbg = dbg;
+        cc_shared_ok = cc_compute_shared_digest(dbg);
+    }
+    if (!cc_shared_ok) {
+        return FALSE;
+    }
+    memset(&cu,0,sizeof(cu));
+    h = cc_hash_number(cc_shared_digest,is_info);
+    res = dwarf_cu_header_basics(cu_die,&cu.cc_version,
+        &hdr_is_info,&is_dwo,&cu.cc_offset_size,&address_size,
+        &extension_size,&signature,&cu.cc_cuoff,&cu.cc_culen,
+        &err);
+    if (res != DW_DLV_OK) {
+        DROP_ERROR_INSTANCE(dbg,res,err);
+        return FALSE;
+    }
+    h = cc_hash_number(h,cu.cc_version);
+    h = cc_hash_number(h,is_dwo);
+    h = cc_hash_number(h,cu.cc_offset_size);
+    h = cc_hash_number(h,address_size);
+    h = cc_hash_number(h,extension_size);
+    h = cc_hash_number(h,cu.cc_culen);
+    if (signature) {
+        h = cc_hash_bytes(h,(const Dwarf_Small *)signature->signature,
+            sizeof(signature->signature));
+    }
+    if (!cc_hash_abbrevs(dbg,abbrev_offset,&h)) {
+        return FALSE;
+    }
+    if (!cc_hash_die_tree(dbg,cu_die,&cu,&h)) {
+        return FALSE;
+    }
+    /*  The DIE checks carry subprogram state from
+        one CU into the next; what a CU can read
+        before its first subprogram resets it. */
+    h = cc_hash_number(h,glflags.in_valid_code);
+    h = cc_hash_number(h,glflags.seen_PU);
+    h = cc_hash_string(h,glflags.PU_name);
+    if (!cu.cc_has_pu) {
+        h = cc_hash_number(h,glflags.seen_PU_base_address);
+        h = cc_hash_number(h,glflags.seen_PU_high_address);
+        h = cc_hash_number(h,glflags.PU_base_address);
+        h = cc_hash_number(h,glflags.PU_high_address);
+    }
+    *digest_out = h;
+    return TRUE;
+}
+
+static void
+cc_replay(struct cc_entry_s *e)
+{
+    Dwarf_Unsigned i = 0;
+
+    for (i = 0; i < LAST_CATEGORY; ++i) {
+        Dwarf_Check_Result *r = &e->ce_results[i];
+
+        if (i == total_check_result) {
+            continue;
+        }
+        if (r->checks) {
+            DWARF_CHECK_COUNT((Dwarf_Check_Categories)i,r->checks);
+        }
+        if (r->errors) {
+            DWARF_ERROR_COUNT((Dwarf_Check_Categories)i,r->errors);
+        }
+    }
+    glflags.gf_count_major_errors +=
+        (unsigned long)e->ce_major_errors;
+    glflags.gf_count_macronotes += (unsigned long)e->ce_macronotes;
+    glflags.check_error += (int)e->ce_check_error;
+    if (e->ce_addr_missing) {
+        glflags.gf_debug_addr_missing = 1;
+    }
+    if (e->ce_addr_errcode &&
+        !glflags.gf_error_code_search_by_address) {
+        glflags.gf_error_code_search_by_address =
+            (int)e->ce_addr_errcode;
+    }
+    for (i = 0; i < e->ce_usage_count; ++i) {
+        struct cc_usage_s *u = &e->ce_usage[i];
+
+        switch (u->cu_kind) {
+        case CHECKCACHE_ATTR_FORM_USAGE:
+            add_attr_form_use((Dwarf_Half)u->cu_k1,
+                (Dwarf_Half)u->cu_k2,(Dwarf_Half)u->cu_k3,
+                0,u->cu_count);
+            break;
+        case CHECKCACHE_ATTR_ENCODING:
+            add_attributes_encoding((Dwarf_Half)u->cu_k1,
+                u->cu_k2,u->cu_k3,u->cu_count);
+            break;
+        default:
+            add_usage_counts(u->cu_kind,u->cu_k1,u->cu_k2,
+                u->cu_count);
+            break;
+        }
+    }
+    /*  With -kG later CUs print only messages not
+        seen before, so the messages of this CU
+        go into the table as if just printed. */
+    if (glflags.gf_print_unique_errors) {
+        for (i = 0; i < e->ce_error_count; ++i) {
+            add_to_unique_errors_table(e->ce_errors[i]);
+        }
+    }
+    if (e->ce_check_error) {
+        ++cc_reused_with_errors;
+    }
+    glflags.in_valid_code =
+        (Dwarf_Bool)e->ce_walk[CC_WALK_IN_VALID_CODE];
+    glflags.need_PU_valid_code =
+        (Dwarf_Bool)e->ce_walk[CC_WALK_NEED_VALID_CODE];
+    glflags.seen_PU = (Dwarf_Bool)e->ce_walk[CC_WALK_SEEN_PU];
+    glflags.seen_PU_base_address =
+        (Dwarf_Bool)e->ce_walk[CC_WALK_SEEN_PU_BASE];
+    glflags.seen_PU_high_address =
+        (Dwarf_Bool)e->ce_walk[CC_WALK_SEEN_PU_HIGH];
+    glflags.PU_base_address = e->ce_walk[CC_WALK_PU_BASE];
+    glflags.PU_high_address = e->ce_walk[CC_WALK_PU_HIGH];
+    dd_safe_strcpy(glflags.PU_name,sizeof(glflags.PU_name),
+        e->ce_pu_name,strlen(e->ce_pu_name));
+    e->ce_used = TRUE;
+}
+
+/*  Returns TRUE if the results of this CU were
+    added from the cache, so the caller skips
+    reading the CU. Otherwise starts recording
+    what checking the CU produces. */
+Dwarf_Bool
+checkcache_cu_begin(Dwarf_Debug dbg,Dwarf_Die cu_die,
+    Dwarf_Bool is_info,Dwarf_Unsigned abbrev_offset,
+    Dwarf_Bool is_split)
+{
+    struct cc_entry_s key;
+    void *ret = 0;
+
+    cc_cu_storable = FALSE;
+    glflags.gf_check_cache_recording = FALSE;
+    cc_journal_destroy();
+    if (!cc_active) {
+        return FALSE;
+    }
+    ++cc_checked_count;
+    if (is_split) {
+        return FALSE;
+    }
+    if (!cc_compute_cu_digest(dbg,cu_die,is_info,abbrev_offset,
+        &cc_cu_digest)) {
+        return FALSE;
+    }
+    key.ce_digest = cc_cu_digest;
+    ret = dwarf_tfind(&key,&cc_entries,cc_compare_entry);
+    if (ret) {
+        struct cc_entry_s *e = *(struct cc_entry_s **)ret;
+
+        if (!e->ce_used) {
+            cc_replay(e);
+            --cc_checked_count;
+            ++cc_reused_count;
+            return TRUE;
+        }
+        /*  The same bytes twice in one object:
+            check again rather than guess. */
+        return FALSE;
+    }
+    get_check_results_total(cc_cu_results);
+    cc_cu_major_errors = glflags.gf_count_major_errors;
+    cc_cu_macronotes = glflags.gf_count_macronotes;
+    cc_cu_check_error = (Dwarf_Unsigned)glflags.check_error;
+    cc_cu_addr_missing = glflags.gf_debug_addr_missing;
+    cc_cu_addr_errcode = glflags.gf_error_code_search_by_address;
+    cc_cu_storable = TRUE;
+    glflags.gf_check_cache_recording = TRUE;
+    return FALSE;
+}
+
+void
+checkcache_note_usage(int kind,
+    unsigned k1, unsigned k2, unsigned k3)
+{
+    struct cc_usage_s *u = 0;
+    void *ret = 0;
+
+    if (!cc_cu_storable) {
+        return;
+    }
+    u = (struct cc_usage_s *)calloc(1,sizeof(struct cc_usage_s));
+    if (!u) {
+        cc_cu_storable = FALSE;
+        glflags.gf_check_cache_recording = FALSE;
+        return;
+    }
+    u->cu_kind = kind;
+    u->cu_k1 = k1;
+    u->cu_k2 = k2;
+    u->cu_k3 = k3;
+    ret = dwarf_tsearch(u,&cc_journal,cc_compare_usage);
+    if (!ret) {
+        free(u);
+        cc_cu_storable = FALSE;
+        glflags.gf_check_cache_recording = FALSE;
+        return;
+    }
+    if (*(struct cc_usage_s **)ret != u) {
+        free(u);
+    } else {
+        ++cc_journal_count;
+    }
+    ++(*(struct cc_usage_s **)ret)->cu_count;
+}
+
+/*  Records a DWARF CHECK message of the CU being
+    checked for the unique-errors table (-kG). */
+void
+checkcache_note_error(const char *text)
+{
+    if (!cc_cu_storable) {
+        return;
+    }
+    if (!cc_add_error(&cc_cu_errors,&cc_cu_error_count,
+        &cc_cu_error_space,text)) {
+        cc_cu_storable = FALSE;
+        glflags.gf_check_cache_recording = FALSE;
+    }
+}
+
+/*  Forms whose checks read data outside the CU
+    make the CU results not reusable. */
+void
+checkcache_note_form(Dwarf_Half form)
+{
+    switch (form) {
+    case DW_FORM_ref_addr:
+    case DW_FORM_ref_sig8:
+    case DW_FORM_GNU_ref_alt:
+    case DW_FORM_ref_sup4:
+    case DW_FORM_ref_sup8:
+    case DW_FORM_GNU_strp_alt:
+    case DW_FORM_strp_sup:
+        cc_cu_storable = FALSE;
+        glflags.gf_check_cache_recording = FALSE;
+        break;
+    default:
+        break;
+    }
+}
+
+static void
+cc_journal_to_entry(const void *nodep,const DW_VISIT which,
+    const int depth)
+{
+    struct cc_usage_s *u = *(struct cc_usage_s **)nodep;
+    struct cc_entry_s *e = cc_walk_entry;
+
+    (void)depth;
+    if (which != dwarf_postorder && which != dwarf_leaf) {
+        return;
+    }
+    if (e->ce_usage_count < cc_journal_count) {
+        e->ce_usage[e->ce_usage_count] = *u;
+        ++e->ce_usage_count;
+    }
+}
+
+/*  Ends the CU begun by checkcache_cu_begin().
+    If the CU was checked completely its results
+    are added to the cache. */
+void
+checkcache_cu_end(Dwarf_Bool completed)
+{
+    struct cc_entry_s *e = 0;
+    Dwarf_Check_Result now[LAST_CATEGORY];
+    void *ret = 0;
+    int i = 0;
+
+    glflags.gf_check_cache_recording = FALSE;
+    if (!cc_cu_storable || !completed) {
+        cc_cu_storable = FALSE;
+        cc_journal_destroy();
+        return;
+    }
+    cc_cu_storable = FALSE;
+    e = (struct cc_entry_s *)calloc(1,sizeof(struct cc_entry_s));
+    if (!e) {
+        cc_journal_destroy();
+        return;
+    }
+    e->ce_digest = cc_cu_digest;
+    e->ce_used = TRUE;
+    get_check_results_total(now);
+    for (i = 0; i < LAST_CATEGORY; ++i) {
+        if (i == total_check_result) {
+            continue;
+        }
+        e->ce_results[i].checks = now[i].checks -
+            cc_cu_results[i].checks;
+        e->ce_results[i].errors = now[i].errors -
+            cc_cu_results[i].errors;
+    }
+    e->ce_major_errors = glflags.gf_count_major_errors -
+        cc_cu_major_errors;
+    e->ce_macronotes = glflags.gf_count_macronotes -
+        cc_cu_macronotes;
+    e->ce_check_error = (Dwarf_Unsigned)glflags.check_error -
+        cc_cu_check_error;
+    /*  These two are set once, by whichever CU
+        first finds the problem. */
+    if (glflags.gf_debug_addr_missing && !cc_cu_addr_missing) {
+        e->ce_addr_missing = 1;
+    }
+    if (glflags.gf_error_code_search_by_address &&
+        !cc_cu_addr_errcode) {
+        e->ce_addr_errcode = (Dwarf_Unsigned)
+            glflags.gf_error_code_search_by_address;
+    }
+    if (cc_journal_count) {
+        e->ce_usage = (struct cc_usage_s *)calloc(cc_journal_count,
+            sizeof(struct cc_usage_s));
+        if (!e->ce_usage) {
+            free(e);
+            cc_journal_destroy();
+            return;
+        }
+        cc_walk_entry = e;
+        dwarf_twalk(cc_journal,cc_journal_to_entry);
+        cc_walk_entry = 0;
+    }
+    e->ce_walk[CC_WALK_IN_VALID_CODE] = glflags.in_valid_code;
+    e->ce_walk[CC_WALK_NEED_VALID_CODE] = glflags.need_PU_valid_code;
+    e->ce_walk[CC_WALK_SEEN_PU] = glflags.seen_PU;
+    e->ce_walk[CC_WALK_SEEN_PU_BASE] = glflags.seen_PU_base_address;
+    e->ce_walk[CC_WALK_SEEN_PU_HIGH] = glflags.seen_PU_high_address;
+    e->ce_walk[CC_WALK_PU_BASE] = glflags.PU_base_address;
+    e->ce_walk[CC_WALK_PU_HIGH] = glflags.PU_high_address;
+    {
+        size_t len = strlen(glflags.PU_name);
+
+        e->ce_pu_name = (char *)malloc(len+1);
+        if (!e->ce_pu_name) {
+            cc_free_entry(e);
+            cc_journal_destroy();
+            return;
+        }
+        memcpy(e->ce_pu_name,glflags.PU_name,len+1);
+    }
+    /*  The entry takes the messages over. */
+    e->ce_errors = cc_cu_errors;
+    e->ce_error_count = cc_cu_error_count;
+    cc_cu_errors = 0;
+    cc_cu_error_count = 0;
+    cc_cu_error_space = 0;
+    cc_journal_destroy();
+    ret = dwarf_tsearch(e,&cc_entries,cc_compare_entry);
+    if (!ret || *(struct cc_entry_s **)ret != e) {
+        cc_free_entry(e);
+    }
+}
@@ -0,0 +1,61 @@
+/*
+  Copyright 2026 David Anderson. All rights reserved.
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of version 2 of the GNU General
+  Public License as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU General Public
+  License along with this program; if not, write the Free
+  Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+  Boston MA 02110-1301, USA.
+
+*/
+
+#ifndef DD_CHECKCACHE_H
+#define DD_CHECKCACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*  Kinds of usage counts recorded per CU so the
+    end-of-run usage reports (-ku -kE) include
+    CUs whose checks were reused from the cache. */
+#define CHECKCACHE_TAG_USAGE       1 /* tag */
+#define CHECKCACHE_TAG_ATTR_USAGE  2 /* tag, attr */
+#define CHECKCACHE_TAG_TREE_USAGE  3 /* parent, child */
+#define CHECKCACHE_ATTR_FORM_USAGE 4 /* attr, formclass, form */
+#define CHECKCACHE_ATTR_ENCODING   5 /* attr, formsize, lebsize */
+
+void checkcache_note_options(int argc, char **argv);
+void checkcache_open(void);
+void checkcache_close(void);
+Dwarf_Bool checkcache_cu_begin(Dwarf_Debug dbg,
+    Dwarf_Die cu_die,
+    Dwarf_Bool is_info,
+    Dwarf_Unsigned abbrev_offset,
+    Dwarf_Bool is_split);
+void checkcache_cu_end(Dwarf_Bool completed);
+void checkcache_note_usage(int kind,
+    unsigned k1, unsigned k2, unsigned k3);
+void checkcache_note_form(Dwarf_Half form);
+void checkcache_note_error(const char *text);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* DD_CHECKCACHE_H */
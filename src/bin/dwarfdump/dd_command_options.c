@@ -49,6 +49,7 @@
 #include "dd_tag_common.h"
 #include "dd_command_options.h"
 #include "dd_compiler_info.h"
+#include "dd_checkcache.h"
 #include "dd_regex.h"
 #include "dd_safe_strcpy.h"
 #include "libdwarf_private.h" /* For malloc/calloc debug */
@@ -304,6 +305,7 @@ static void arg_check_aranges(void);
 static void arg_check_attr_dup(void);
 static void arg_check_attr_encodings(void);
 static void arg_check_attr_names(void);
+static void arg_check_cache(void);
 static void arg_check_constants(void);
 static void arg_check_files_lines(void);
 static void arg_check_forward_refs(void);
@@ -335,6 +337,7 @@ static void arg_file_abi(void);
 static void arg_file_line5(void);
 static void arg_file_name(void);
 static void arg_file_output(void);
+static void arg_file_sup(void);
 static void arg_file_tied(void);
 static void arg_file_use_no_libelf(void);
 
@@ -360,6 +363,7 @@ static void arg_format_gcc(void);
 static void arg_format_groupnumber(void);
 static void arg_format_universalnumber(void);
 static void arg_format_limit(void);
+static void arg_memory_limit(void);
 static void arg_format_producer(void);
 static void arg_format_snc(void);
 
@@ -516,6 +520,8 @@ static const char *usage_long_text[] = {
 "-kD  --check-attr-dup       Check duplicated attributes",
 "-kE  --check-attr-encodings Examine attributes encodings",
 "-kn  --check-attr-names     Examine names in attributes",
+"     --check-cache=<path>   Reuse -k results of CUs unchanged",
+"                            since the run that wrote <path>",
 "-kc  --check-constants      Examine DWARF constants",
 "-kF  --check-files-lines    Examine integrity of files-lines",
 "                            attributes",
@@ -607,6 +613,9 @@ static const char *usage_long_text[] = {
 "-H<num>  --format-limit=<num>  Limit output to the first <num>",
 "                               major units.",
 "                               Stop after <num> compilation units",
+"         --memory-limit=<num>  Release per-CU state after each",
+"                               CU and note if the peak resident",
+"                               size passes <num> megabytes",
 "-c<str>  --format-producer=<str> Check only specific compiler",
 "                               objects  <str> is described by",
 "                               'DW_AT_producer'  -c'350.1' ",
@@ -623,6 +632,9 @@ static const char *usage_long_text[] = {
 "-x line5=<val>   --file-line5=<val>    Table DWARF5 new interfaces",
 "                                       where <val> is: std or s2l",
 "-O file=<path>   --file-output=<path>  Name the output file",
+"                 --file-sup=<path>     Name the supplementary",
+"                                       (dwz alt or .debug_sup)",
+"                                       object file",
 "-x tied=<path>   --file-tied=<path>    Name the Split Dwarf",
 "                                       skeleton object file",
 "                 --file-use-no-libelf  Use non-libelf to",
@@ -695,6 +707,7 @@ OPT_CHECK_ARANGES,            /* -kM  --check-aranges  */
 OPT_CHECK_ATTR_DUP,           /* -kD  --check-attr-dup */
 OPT_CHECK_ATTR_ENCODINGS,     /* -kE  --check-attr-encodings*/
 OPT_CHECK_ATTR_NAMES,         /* -kn  --check-attr-names    */
+OPT_CHECK_CACHE,              /*      --check-cache=<path>  */
 OPT_CHECK_CONSTANTS,          /* -kc  --check-constants     */
 OPT_CHECK_FILES_LINES,        /* -kF  --check-files-lines   */
 OPT_CHECK_FORWARD_REFS,       /* -kR  --check-forward-refs  */
@@ -725,6 +738,7 @@ OPT_FILE_ABI,          /* -x abi=<abi>    --file-abi=<abi>     */
 OPT_FILE_LINE5,        /* -x line5=<val>  --file-line5=<val>   */
 OPT_FILE_NAME,         /* -x name=<path>  --file-name=<path>   */
 OPT_FILE_OUTPUT,       /* -O file=<path>  --file-output=<path> */
+OPT_FILE_SUP,          /*                 --file-sup=<path>    */
 OPT_FILE_TIED,         /* -x tied=<path>  --file-tied=<path>   */
 OPT_FILE_USE_NO_LIBELF,/* --file-use-no-libelf=<path>        */
 
@@ -758,6 +772,7 @@ OPT_FORMAT_GROUP_NUMBER,      /* -x<n>  --format-group-number=<n>*/
 OPT_FORMAT_GROUP_UNIVERSALNUMBER,
 
 OPT_FORMAT_LIMIT,             /* -H<num>  --format-limit=<num>   */
+OPT_MEMORY_LIMIT,             /*          --memory-limit=<num>   */
 OPT_FORMAT_PRODUCER,          /* -c<str>  --format-producer=<str> */
 OPT_FORMAT_SNC,               /* -cs      --format-snc           */
 
@@ -835,6 +850,7 @@ static struct dwoption longopts[] =  {
 {"check-attr-dup",       dwno_argument, 0, OPT_CHECK_ATTR_DUP      },
 {"check-attr-encodings", dwno_argument, 0, OPT_CHECK_ATTR_ENCODINGS},
 {"check-attr-names",     dwno_argument, 0, OPT_CHECK_ATTR_NAMES    },
+{"check-cache",          dwrequired_argument, 0, OPT_CHECK_CACHE  },
 {"check-constants",      dwno_argument, 0, OPT_CHECK_CONSTANTS     },
 {"check-files-lines",    dwno_argument, 0, OPT_CHECK_FILES_LINES   },
 {"check-forward-refs",   dwno_argument, 0, OPT_CHECK_FORWARD_REFS  },
@@ -865,6 +881,7 @@ static struct dwoption longopts[] =  {
 {"file-line5",  dwrequired_argument, 0, OPT_FILE_LINE5 },
 {"file-name",   dwrequired_argument, 0, OPT_FILE_NAME  },
 {"file-output", dwrequired_argument, 0, OPT_FILE_OUTPUT},
+{"file-sup",    dwrequired_argument, 0, OPT_FILE_SUP   },
 {"file-tied",   dwrequired_argument, 0, OPT_FILE_TIED  },
 {"file-use-no-libelf",   dwno_argument, 0, OPT_FILE_USE_NO_LIBELF  },
 
@@ -910,6 +927,7 @@ OPT_FORMAT_SUPPRESS_OFFSETS },
 {"format-universalnumber", dwrequired_argument, 0,
     OPT_FORMAT_UNIVERSALNUMBER},
 {"format-limit",        dwrequired_argument, 0, OPT_FORMAT_LIMIT },
+{"memory-limit",        dwrequired_argument, 0, OPT_MEMORY_LIMIT },
 {"format-producer",     dwrequired_argument, 0, OPT_FORMAT_PRODUCER},
 {"format-snc",          dwno_argument,       0, OPT_FORMAT_SNC },
 
@@ -1214,6 +1232,28 @@ void arg_format_limit(void)
     }
 }
 
+/*  Option '--memory-limit=' */
+void arg_memory_limit(void)
+{
+    long int mb = 0;
+    int res = 0;
+
+    if (!dwoptarg || !dwoptarg[0]) {
+        arg_usage_error = TRUE;
+        return;
+    }
+    res = get_number_value(dwoptarg,&mb);
+    if (res != DW_DLV_OK || mb < 1) {
+        printf("ERROR --memory-limit= requires a positive "
+            "number of megabytes, not %s\n",
+            sanitized(dwoptarg));
+        glflags.gf_count_major_errors++;
+        arg_usage_error = TRUE;
+        return;
+    }
+    glflags.memory_limit_mb = (Dwarf_Unsigned)mb;
+}
+
 /*  Option '-i' */
 void arg_print_info(void)
 {
@@ -1458,6 +1498,17 @@ void arg_check_attr_names(void)
     glflags.gf_types_flag = TRUE;
 }
 
+/*  Option '--check-cache=' */
+void arg_check_cache(void)
+{
+    if (!dwoptarg || !dwoptarg[0]) {
+        arg_usage_error = TRUE;
+        return;
+    }
+    glflags.check_cache_file = do_uri_translation(dwoptarg,
+        "--check-cache=");
+}
+
 /*  Option '-kr' */
 void arg_check_tag_attr(void)
 {
@@ -2326,6 +2377,19 @@ static void arg_format_suppress_sanitize(void)
     glflags.gf_no_sanitize_strings = TRUE;
 }
 
+/*  Option '--file-sup=' */
+static void arg_file_sup(void)
+{
+    if (!dwoptarg || !dwoptarg[0]) {
+        printf("ERROR --file-sup= does not allow an empty text\n");
+        glflags.gf_count_major_errors++;
+        arg_usage_error = TRUE;
+        return;
+    }
+    glflags.sup_file_name = do_uri_translation(dwoptarg,
+        "--file-sup=");
+}
+
 /*  Option '-x tied=' */
 static void arg_file_tied(void)
 {
@@ -2486,6 +2550,7 @@ set_command_options(int argc, char *argv[])
         case OPT_CHECK_ATTR_ENCODINGS: arg_check_attr_encodings();
             break;
         case OPT_CHECK_ATTR_NAMES:     arg_check_attr_names();break;
+        case OPT_CHECK_CACHE:          arg_check_cache();    break;
         case OPT_CHECK_CONSTANTS:      arg_check_constants(); break;
         case OPT_CHECK_FILES_LINES:    arg_check_files_lines();
             break;
@@ -2521,6 +2586,7 @@ set_command_options(int argc, char *argv[])
         case OPT_FILE_LINE5:  arg_file_line5();  break;
         case OPT_FILE_NAME:   arg_file_name();   break;
         case OPT_FILE_OUTPUT: arg_file_output(); break;
+        case OPT_FILE_SUP:    arg_file_sup();    break;
         case OPT_FILE_TIED:   arg_file_tied();   break;
         case OPT_FILE_USE_NO_LIBELF: arg_file_use_no_libelf(); break;
 
@@ -2565,6 +2631,7 @@ set_command_options(int argc, char *argv[])
         case OPT_FORMAT_UNIVERSALNUMBER: arg_format_universalnumber();
             break;
         case OPT_FORMAT_LIMIT:        arg_format_limit();      break;
+        case OPT_MEMORY_LIMIT:        arg_memory_limit();      break;
         case OPT_FORMAT_PRODUCER:     arg_format_producer();   break;
         case OPT_FORMAT_SNC:          arg_format_snc();        break;
 
@@ -2821,5 +2888,8 @@ process_args(int argc, char *argv[])
             (checking means checking-only). */
         glflags.verbose = 1;
     }
+    if (glflags.check_cache_file) {
+        checkcache_note_options(argc,argv);
+    }
     return do_uri_translation(argv[dwoptind],"file-to-process");
 }
@@ -29,7 +29,7 @@
 #include <stddef.h> /* NULL */
 #include <stdio.h>  /* stdout fprintf() printf() */
 #include <stdlib.h> /* exit() free() malloc() qsort() */
-#include <string.h> /* memset() strcmp() stricmp()
+#include <string.h> /* memcpy() memset() strcmp() stricmp()
     strlen() strncmp() */
 
 /* Windows specific header files */
@@ -505,6 +505,15 @@ void DWARF_CHECK_COUNT(Dwarf_Check_Categories category, int inc)
     }
 }
 
+/*  Copy out the check results so far, summed
+    over all compilers. */
+void
+get_check_results_total(Dwarf_Check_Result *results_out)
+{
+    memcpy(results_out,compilers_detected[0].results,
+        sizeof(compilers_detected[0].results));
+}
+
 void DWARF_ERROR_COUNT(Dwarf_Check_Categories category, int inc)
 {
     Compiler * c = 0;
@@ -59,6 +59,7 @@ typedef struct {
 extern void clean_up_compilers_detected(void);
 extern void reset_compiler_entry(Compiler *compiler);
 extern void print_checks_results(void);
+extern void get_check_results_total(Dwarf_Check_Result *results_out);
 extern Dwarf_Bool record_producer(char *name);
 
 #ifdef __cplusplus
@@ -317,6 +317,11 @@ init_global_flags(void)
 
     /*  Output filename */
     glflags.output_file = 0;
+    glflags.check_cache_file = 0;
+    glflags.gf_check_cache_recording = FALSE;
+    glflags.sup_file_name = 0;
+    glflags.memory_limit_mb = 0;
+    glflags.gf_memory_limit_exceeded = FALSE;
     glflags.group_number = 0;
     glflags.gf_universalnumber = 0;/* for Mach-O universal binaries */
 
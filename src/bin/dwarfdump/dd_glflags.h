@@ -379,6 +379,22 @@ struct glflags_s {
 
     /* Output filename */
     const char *output_file;
+
+    /*  --check-cache=<path>. Per-CU check results are
+        saved in, and reused from, this file. */
+    const char *check_cache_file;
+    /*  TRUE while the checks of one CU are being
+        recorded for the check cache. */
+    Dwarf_Bool gf_check_cache_recording;
+    /*  --file-sup=<path>. The supplementary (dwz alt
+        or DWARF5 .debug_sup) object. If not given
+        it is looked for by dwarf_get_sup_paths(). */
+    const char *sup_file_name;
+    /*  --memory-limit=<MB>. Non-zero means release
+        per-CU dwarfdump state after each CU and
+        report the peak resident size. */
+    Dwarf_Unsigned memory_limit_mb;
+    Dwarf_Bool gf_memory_limit_exceeded;
     int         group_number;
     unsigned gf_universalnumber; /* for Mach-O universal binaries*/
 
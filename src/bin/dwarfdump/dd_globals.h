@@ -117,10 +117,35 @@ extern void print_error_and_continue (const char * msg,
 extern void print_error (Dwarf_Debug dbg, const char * msg,
     int res, Dwarf_Error err);
 
+/*  The line table of one CU, read once by
+    load_cu_lines() and shared by the DIE printing
+    (DW_AT_decl_file names), the line printing and
+    the line checks of that CU. */
+struct dd_cu_lines_s {
+    /*  The dwarf_srclines_b() result and, on
+        DW_DLV_ERROR, its error, held until the
+        line printing reports it. */
+    int                cl_srclines_res;
+    Dwarf_Error        cl_srclines_err;
+    Dwarf_Unsigned     cl_version;
+    Dwarf_Small        cl_table_count;
+    /*  Zero once print_line_numbers_this_cu()
+        has taken ownership. */
+    Dwarf_Line_Context cl_line_context;
+};
+extern int load_cu_lines(Dwarf_Debug dbg,
+    Dwarf_Die cu_die,
+    struct dd_cu_lines_s *culines,
+    char ***srcfiles,
+    Dwarf_Signed *srcfiles_cnt,
+    Dwarf_Error *err);
+extern void release_cu_lines(Dwarf_Debug dbg,
+    struct dd_cu_lines_s *culines);
 extern int print_line_numbers_this_cu (Dwarf_Debug dbg,
     Dwarf_Die in_die,
     char **srcfiles,
     Dwarf_Signed cnt,
+    struct dd_cu_lines_s *culines,
     Dwarf_Error *err);
 
 extern int print_ranges(Dwarf_Debug dbg);
@@ -152,6 +177,7 @@ int print_all_abbrevs_for_cu(Dwarf_Debug dbg,
 /*  Space used to record range information */
 extern void allocate_range_array_info(void);
 extern void release_range_array_info(void);
+extern void trim_range_array_info(void);
 extern void record_range_array_info_entry(Dwarf_Off die_off,
     Dwarf_Off range_off);
 extern int check_range_array_info(Dwarf_Debug dbg,
@@ -204,13 +230,16 @@ extern void DWARF_CHECK_COUNT(Dwarf_Check_Categories category,
 extern void DWARF_ERROR_COUNT(Dwarf_Check_Categories category,
     int inc);
 extern void DWARF_CHECK_ERROR_PRINT_CU(void);
+extern Dwarf_Bool add_to_unique_errors_table(char * error_text);
 #define DWARF_CHECK_ERROR(c,d)    DWARF_CHECK_ERROR3(c,d,0,0)
 #define DWARF_CHECK_ERROR2(c,d,e) DWARF_CHECK_ERROR3(c,d,e,0)
 extern void DWARF_CHECK_ERROR3(Dwarf_Check_Categories category,
     const char *str1, const char *str2, const char *strexpl);
 
 extern int print_macinfo_by_offset(Dwarf_Debug dbg,
-    Dwarf_Die cudie,Dwarf_Unsigned offset,Dwarf_Error *);
+    Dwarf_Unsigned offset,
+    char **srcfiles,Dwarf_Signed srcf_count,
+    Dwarf_Error *);
 
 void ranges_esb_string_destructor(void);
 void global_destructors(void);
@@ -242,10 +271,15 @@ int print_macros_5style_this_cu(Dwarf_Debug dbg, Dwarf_Die cu_die,
 
 /* Detailed attributes encoding space */
 int print_attributes_encoding(Dwarf_Debug dbg,Dwarf_Error *);
+void add_attributes_encoding(Dwarf_Half attr,
+    unsigned formsize, unsigned lebsize,
+    Dwarf_Unsigned count);
 
 /* Detailed tag and attributes usage */
 int print_tag_attributes_usage(void);
 void record_tag_usage(int tag);
+void add_usage_counts(int kind, unsigned k1, unsigned k2,
+    Dwarf_Unsigned count);
 void reset_usage_rate_tag_trees(void);
 
 int  print_section_groups_data(Dwarf_Debug dbg,Dwarf_Error *);
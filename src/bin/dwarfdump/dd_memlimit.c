@@ -0,0 +1,124 @@
+/*
+  Copyright 2026 David Anderson. All rights reserved.
+
+  This program is free software; you can redistribute it and/or
+  modify it under the terms of version 2 of the GNU General
+  Public License as published by the Free Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU General Public
+  License along with this program; if not, write the Free
+  Software Foundation, Inc., 51 Franklin Street - Fifth Floor,
+  Boston MA 02110-1301, USA.
+
+*/
+
+/*  dd_memlimit.c, .h implement --memory-limit=<MB>.
+
+    dwarfdump reads one CU at a time but some of its
+    own tables (the type signedness memo and the
+    range-check array) would otherwise grow with the
+    largest CU seen and be kept to the end of the run.
+    With the option they are given back after each CU.
+    The peak resident size of the process is then
+    checked against the limit: a NOTE is printed the
+    first time it is passed and the peak is reported
+    at the end.  The section data libdwarf loads is
+    not per-CU and is not affected.  */
+
+#include <config.h>
+
+#include <stdio.h>  /* printf() */
+
+#ifdef HAVE_SYS_RESOURCE_H
+#include <sys/resource.h> /* getrusage() */
+#endif /* HAVE_SYS_RESOURCE_H */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "libdwarf_private.h"
+#include "dd_globals.h"
+#include "dd_helpertree.h"
+#include "dd_memlimit.h"
+
+/*  Returns the peak resident size in kilobytes,
+    0 if the platform does not tell us. */
+static Dwarf_Unsigned
+peak_rss_kb(void)
+{
+#ifdef HAVE_SYS_RESOURCE_H
+    struct rusage ru;
+    int res = 0;
+
+    res = getrusage(RUSAGE_SELF,&ru);
+    if (res || ru.ru_maxrss < 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    /* Reported in bytes on MacOS */
+    return (Dwarf_Unsigned)ru.ru_maxrss/1024;
+#else
+    return (Dwarf_Unsigned)ru.ru_maxrss;
+#endif /* __APPLE__ */
+#else
+    return 0;
+#endif /* HAVE_SYS_RESOURCE_H */
+}
+
+/*  Called at the end of each CU. */
+void
+memlimit_cu_done(Dwarf_Unsigned cu_number)
+{
+    Dwarf_Unsigned peak = 0;
+
+    if (!glflags.memory_limit_mb) {
+        return;
+    }
+    /*  The memo is keyed by section offset and is
+        rebuilt on demand, so dropping it only costs
+        recomputation for types used across CUs. */
+    helpertree_clear_statistics(&helpertree_offsets_base_info);
+    helpertree_clear_statistics(&helpertree_offsets_base_types);
+    trim_range_array_info();
+    if (glflags.gf_memory_limit_exceeded) {
+        return;
+    }
+    peak = peak_rss_kb();
+    if (peak/1024 >= glflags.memory_limit_mb) {
+        glflags.gf_memory_limit_exceeded = TRUE;
+        printf("\nNOTE: peak resident size %" DW_PR_DUu
+            " KB passed --memory-limit=%" DW_PR_DUu
+            " at CU %" DW_PR_DUu "\n",
+            peak,glflags.memory_limit_mb,cu_number);
+    }
+}
+
+void
+memlimit_report(void)
+{
+    Dwarf_Unsigned peak = 0;
+
+    if (!glflags.memory_limit_mb) {
+        return;
+    }
+    peak = peak_rss_kb();
+    if (!peak) {
+        printf("\nPeak resident size: not available\n");
+        return;
+    }
+    printf("\nPeak resident size: %" DW_PR_DUu " KB"
+        " (limit %" DW_PR_DUu " MB)\n",
+        peak,glflags.memory_limit_mb);
+}
@@ -121,10 +121,41 @@ No blank lines or commentary allowed, no symbols, just numbers.
 #define IS_EOF 1
 #define NOT_EOF 0
 
+/*  The extension tables (and the attr/formclass
+    extension table) are generated as perfect hashes:
+    every key has a slot of its own so a lookup is a
+    multiply, a shift and one compare.
+    Keys are (tag<<16)|attr, (parenttag<<16)|childtag,
+    or just the attribute number. No key is zero,
+    so zero marks an empty slot. */
+#define DD_PERFECT_HASH_KEY(hi,lo) \
+    ((unsigned int)((((Dwarf_Unsigned)(hi)) << 16) | \
+    ((Dwarf_Unsigned)(lo))))
+#define DD_PERFECT_HASH_SLOT(key,mult,shift) \
+    ((unsigned)(((((Dwarf_Unsigned)(key)) * (mult)) & \
+    0xffffffff) >> (shift)))
+
+/*  Used only when building the tables. */
+#define PERFECT_HASH_MAX_BITS  12
+#define PERFECT_HASH_MAX_SLOTS (1 << PERFECT_HASH_MAX_BITS)
+#define PERFECT_HASH_MAX_TRIES 1000000
+
 extern void bad_line_input(char *format,...);
 extern void trim_newline(char *line, int max);
 extern Dwarf_Bool is_blank_line(char *pLine);
 extern int read_value(unsigned int *outval,FILE *f);
+extern void build_perfect_hash(unsigned int *keys,
+    unsigned      count,
+    unsigned     *bits_out,
+    unsigned int *mult_out,
+    unsigned     *slot_to_key);
+extern void emit_perfect_hash(FILE *fileOut,
+    const char   *prefix,
+    const char   *tablename,
+    unsigned int *keys,
+    unsigned int *values,
+    unsigned      count,
+    void (*describe)(FILE *f,unsigned int key));
 
 /* Define to 1 to support the generation of tag-attr usage */
 #define HAVE_USAGE_TAG_ATTR 1
@@ -7,6 +7,41 @@
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
+#ifndef SKIP_AF_CHECK
+#define AF_STD_ATTR_COUNT 141
+
+static const unsigned int attr_formclass_std_mask[AF_STD_ATTR_COUNT] = {
+    0x00000000,0x00000400,0x00008090,0x00000800,0x00000000,
+    0x00000000,0x00000000,0x00000000,0x00000000,0x00000008,
+    0x00000000,0x00000418,0x0000040c,0x0000040c,0x00000000,
+    0x00000000,0x00000040,0x00000002,0x0000000a,0x00000008,
+    0x00000000,0x00000400,0x00000008,0x00000008,0x00000400,
+    0x00000084,0x00000400,0x00000800,0x0000080c,0x00000400,
+    0x00000000,0x00000000,0x00000008,0x00000020,0x00000418,
+    0x00000000,0x00000000,0x00000800,0x00000000,0x00000020,
+    0x00000000,0x00000000,0x00008010,0x00000000,0x00020008,
+    0x00000000,0x00000418,0x00000418,0x00000000,0x00000400,
+    0x00000008,0x00000008,0x00000020,0x00000400,0x00000008,
+    0x00000418,0x00008018,0x00000008,0x00000008,0x00000008,
+    0x00000020,0x00000004,0x00000008,0x00000020,0x00008010,
+    0x00000400,0x00000008,0x00000100,0x00000400,0x00000400,
+    0x00008010,0x00000400,0x00008010,0x00000400,0x00008010,
+    0x00000020,0x00000008,0x00008010,0x00000418,0x00000418,
+    0x00000010,0x00000418,0x0000000a,0x00000020,0x00000400,
+    0x00060200,0x00000c22,0x00000008,0x00000008,0x00000008,
+    0x00000800,0x00000008,0x00000008,0x00000400,0x00000008,
+    0x00000008,0x00000800,0x00000020,0x00000020,0x00000020,
+    0x00000400,0x00000008,0x00000020,0x00000020,0x00000020,
+    0x00000400,0x00000800,0x00000008,0x00000020,0x00000020,
+    0x00000800,0x00000008,0x00000008,0x00000018,0x00080000,
+    0x00004000,0x00040000,0x00000400,0x00000800,0x00000020,
+    0x00000020,0x00002000,0x00000020,0x00000020,0x00000020,
+    0x00000002,0x00000010,0x00000410,0x00000400,0x00000002,
+    0x00000020,0x00000010,0x00000010,0x00000010,0x00000010,
+    0x00000020,0x00000008,0x00000020,0x00000020,0x00000008,
+    0x00010000,
+};
+#endif /* SKIP_AF_CHECK */
 struct af_table_s {
     Dwarf_Half attr;
     Dwarf_Half formclass;
@@ -213,6 +248,63 @@ struct af_table_s {
 {0x2092, 3,2},/*DW_AT_ghs_subcpu DW_FORM_CLASS_CONSTANT Ext*/
 { 0,0,0 }
 }; /* end af_table extended */
+#ifndef SKIP_AF_CHECK
+#define AF_EXT_HASH_MULT 0x96705231u
+
+#define AF_EXT_HASH_SHIFT 26
+
+#define AF_EXT_HASH_SIZE 64
+
+static const unsigned int attr_formclass_ext_hash
+    [AF_EXT_HASH_SIZE][2] = {
+    {0,0},
+    {0x00002083,0x00000008}, /* DW_AT_ghs_rsm */
+    {0x00002134,0x00000428}, /* DW_AT_GNU_pubnames */
+    {0x00002112,0x00000010}, /* DW_AT_GNU_call_site_data_value */
+    {0,0},{0,0},{0,0},
+    {0x00002303,0x00000008}, /* DW_AT_GNU_numerator */
+    {0,0},
+    {0x00002007,0x00000800}, /* DW_AT_MIPS_linkage_name */
+    {0x00002119,0x00002000}, /* DW_AT_GNU_macros */
+    {0,0},
+    {0x00002085,0x00000008}, /* DW_AT_ghs_frsm */
+    {0x00002136,0x00000008}, /* DW_AT_GNU_discriminator */
+    {0,0},
+    {0x00002226,0x00000800}, /* DW_AT_SUN_link_name */
+    {0,0},
+    {0x00002131,0x00000408}, /* DW_AT_GNU_dwo_id */
+    {0x0000210f,0x00000408}, /* DW_AT_GNU_odr_signature */
+    {0,0},{0,0},
+    {0x00002009,0x00000800}, /* DW_AT_MIPS_abstract_name */
+    {0,0},
+    {0x00002087,0x00000008}, /* DW_AT_ghs_rso */
+    {0,0},{0,0},
+    {0x00002116,0x00000020}, /* DW_AT_GNU_all_tail_call_sites */
+    {0,0},
+    {0x00002133,0x00004000}, /* DW_AT_GNU_addr_base */
+    {0,0},
+    {0x00002111,0x00000010}, /* DW_AT_GNU_call_site_value */
+    {0,0},
+    {0x0000200b,0x00000020}, /* DW_AT_MIPS_has_inlines */
+    {0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+    {0x00002135,0x00000428}, /* DW_AT_GNU_pubtypes */
+    {0x00002001,0x00001000}, /* DW_AT_MIPS_fde */
+    {0x00002113,0x00000010}, /* DW_AT_GNU_call_site_target */
+    {0x00002225,0x00000800}, /* DW_AT_SUN_part_link_name */
+    {0x00002130,0x00000800}, /* DW_AT_GNU_dwo_name */
+    {0,0},
+    {0x00002304,0x00000008}, /* DW_AT_GNU_denominator */
+    {0,0},{0,0},{0,0},{0,0},
+    {0x00002086,0x00000008}, /* DW_AT_ghs_frames */
+    {0,0},
+    {0x00002115,0x00000020}, /* DW_AT_GNU_tail_call */
+    {0x00002092,0x00000008}, /* DW_AT_ghs_subcpu */
+    {0,0},
+    {0x00002132,0x00040000}, /* DW_AT_GNU_ranges_base */
+    {0,0},{0,0},{0,0},{0,0},{0,0},{0,0},{0,0},
+    {0x00002117,0x00000020}, /* DW_AT_GNU_all_call_sites */
+};
+#endif /* SKIP_AF_CHECK */
 #ifdef __cplusplus
 extern "C" {
 #endif /* __cplusplus */
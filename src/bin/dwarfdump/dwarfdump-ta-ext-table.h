@@ -4,88 +4,146 @@
 /* BEGIN FILE */
 
 /* Common extensions */
-#define ATTR_TREE_EXT_ROW_COUNT 19
+#define ATTR_TREE_EXT_HASH_MULT 0xc43eae61u
 
-#define ATTR_TREE_EXT_COLUMN_COUNT 15
+#define ATTR_TREE_EXT_HASH_SHIFT 24
 
-static unsigned int tag_attr_combination_ext_table
-    [ATTR_TREE_EXT_ROW_COUNT][ATTR_TREE_EXT_COLUMN_COUNT] = {
-/* 0x13 - DW_TAG_structure_type                */
-    { 0x00000013,0x0000001d,0x00002007,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,},
-/* 0x11 - DW_TAG_compile_unit                  */
-    { 0x00000011,0x00003fe1,0x00002131,0x00002134,0x00002135,
-        0x00002130,0x00002132,0x00002133,0x00002119,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,},
-/* 0x4a - DW_TAG_skeleton_unit                 */
-    { 0x0000004a,0x00002131,0x00002134,0x00002135,0x00002130,
-        0x00002132,0x00002133,0x00002119,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,},
-/* 0x3c - DW_TAG_partial_unit                  */
-    { 0x0000003c,0x00000075,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,},
-/* 0x0d - DW_TAG_member                        */
-    { 0x0000000d,0x00002108,0x00002109,0x0000210a,0x0000210b,
-        0x00002007,0x00000000,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,},
-/* 0x04 - DW_TAG_enumeration_type              */
-    { 0x00000004,0x0000003e,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,},
-/* 0x01 - DW_TAG_array_type                    */
-    { 0x00000001,0x00002107,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,},
-/* 0x2e - DW_TAG_subprogram                    */
-    { 0x0000002e,0x00002007,0x00002001,0x0000210c,0x0000210d,
-        0x0000210e,0x00003fe7,0x00003fe1,0x00002116,0x00002117,
-        0x00002083,0x00002085,0x00002087,0x00002086,0x00002092,},
-/* 0x41 - DW_TAG_type_unit                     */
-    { 0x00000041,0x00002133,0x00002130,0x0000210f,0x00002134,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,},
-/* 0x34 - DW_TAG_variable                      */
-    { 0x00000034,0x00002007,0x00002108,0x00002109,0x0000210a,
-        0x0000210b,0x00000000,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,},
-/* 0x4106 - DW_TAG_GNU_template_template_parameter*/
-    { 0x00004106,0x00000039,0x0000003a,0x0000003b,0x00000003,
-        0x00002110,0x00002108,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,},
-/* 0x4107 - DW_TAG_GNU_template_parameter_pack   */
-    { 0x00004107,0x00000039,0x0000003a,0x0000003b,0x00000003,
-        0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,},
-/* 0x4108 - DW_TAG_GNU_formal_parameter_pack     */
-    { 0x00004108,0x00000039,0x0000003a,0x0000003b,0x00000003,
-        0x00000001,0x00000000,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,},
-/* 0x4109 - DW_TAG_GNU_call_site                 */
-    { 0x00004109,0x00000031,0x00002113,0x00000011,0x00000001,
-        0x00002115,0x00000000,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,},
-/* 0x410a - DW_TAG_GNU_call_site_parameter       */
-    { 0x0000410a,0x00002111,0x00002112,0x00000031,0x00000002,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,},
-/* 0x27 - DW_TAG_constant                      */
-    { 0x00000027,0x00002303,0x00002304,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,},
-/* 0x21 - DW_TAG_subrange_type                 */
-    { 0x00000021,0x00002305,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,},
-/* 0x1d - DW_TAG_inlined_subroutine            */
-    { 0x0000001d,0x00002136,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,},
-/* 0x0b - DW_TAG_lexical_block                 */
-    { 0x0000000b,0x00000000,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,
-        0x00000000,0x00000000,0x00000000,0x00000000,0x00000000,},
+#define ATTR_TREE_EXT_HASH_SIZE 256
+
+static const unsigned int tag_attr_combination_ext_hash
+    [ATTR_TREE_EXT_HASH_SIZE] = {
+    0x410a0031, /* DW_TAG_GNU_call_site_parameter DW_AT_abstract_origin */
+    0,0,0,
+    0x41060003, /* DW_TAG_GNU_template_template_parameter DW_AT_name */
+    0,0,0,0,0,0,
+    0x002e2117, /* DW_TAG_subprogram DW_AT_GNU_all_call_sites */
+    0x004a2131, /* DW_TAG_skeleton_unit DW_AT_GNU_dwo_id */
+    0,
+    0x000d2007, /* DW_TAG_member DW_AT_MIPS_linkage_name */
+    0x41062110, /* DW_TAG_GNU_template_template_parameter DW_AT_GNU_template_name */
+    0,
+    0x000d2108, /* DW_TAG_member DW_AT_GNU_guarded_by */
+    0,0,0,0,
+    0x002e2092, /* DW_TAG_subprogram DW_AT_ghs_subcpu */
+    0x41070039, /* DW_TAG_GNU_template_parameter_pack DW_AT_decl_column */
+    0,0,0,0,0,
+    0x004a2135, /* DW_TAG_skeleton_unit DW_AT_GNU_pubtypes */
+    0,
+    0x002e2085, /* DW_TAG_subprogram DW_AT_ghs_frsm */
+    0x00012107, /* DW_TAG_array_type DW_AT_GNU_vector */
+    0,0,0,
+    0x00132007, /* DW_TAG_structure_type DW_AT_MIPS_linkage_name */
+    0x002e210e, /* DW_TAG_subprogram DW_AT_GNU_shared_locks_required */
+    0x00412130, /* DW_TAG_type_unit DW_AT_GNU_dwo_name */
+    0,0,
+    0x41070001, /* DW_TAG_GNU_template_parameter_pack DW_AT_sibling */
+    0x0034210a, /* DW_TAG_variable DW_AT_GNU_guarded */
+    0,
+    0x0013001d, /* DW_TAG_structure_type DW_AT_containing_type */
+    0x4106003a, /* DW_TAG_GNU_template_template_parameter DW_AT_decl_file */
+    0,0,0,0,0,
+    0x00272304, /* DW_TAG_constant DW_AT_GNU_denominator */
+    0,0,0,
+    0x00412134, /* DW_TAG_type_unit DW_AT_GNU_pubnames */
+    0x00112131, /* DW_TAG_compile_unit DW_AT_GNU_dwo_id */
+    0,
+    0x001d2136, /* DW_TAG_inlined_subroutine DW_AT_GNU_discriminator */
+    0,0,
+    0x002e3fe1, /* DW_TAG_subprogram DW_AT_APPLE_optimized */
+    0,0,
+    0x0004003e, /* DW_TAG_enumeration_type DW_AT_encoding */
+    0,0,0,0,0,0,
+    0x002e2116, /* DW_TAG_subprogram DW_AT_GNU_all_tail_call_sites */
+    0x004a2130, /* DW_TAG_skeleton_unit DW_AT_GNU_dwo_name */
+    0x00112135, /* DW_TAG_compile_unit DW_AT_GNU_pubtypes */
+    0,0,0,0,
+    0x4108003b, /* DW_TAG_GNU_formal_parameter_pack DW_AT_decl_line */
+    0,0,
+    0x410a2112, /* DW_TAG_GNU_call_site_parameter DW_AT_GNU_call_site_data_value */
+    0x41090031, /* DW_TAG_GNU_call_site DW_AT_abstract_origin */
+    0,0,0,0,0,0,
+    0x004a2134, /* DW_TAG_skeleton_unit DW_AT_GNU_pubnames */
+    0,0,0,0,
+    0x000d210b, /* DW_TAG_member DW_AT_GNU_pt_guarded */
+    0,
+    0x41080003, /* DW_TAG_GNU_formal_parameter_pack DW_AT_name */
+    0x002e210d, /* DW_TAG_subprogram DW_AT_GNU_exclusive_locks_required */
+    0,0,0,0,
+    0x00342109, /* DW_TAG_variable DW_AT_GNU_pt_guarded_by */
+    0x41092113, /* DW_TAG_GNU_call_site DW_AT_GNU_call_site_target */
+    0,
+    0x41060039, /* DW_TAG_GNU_template_template_parameter DW_AT_decl_column */
+    0,0,0,0,0,
+    0x00272303, /* DW_TAG_constant DW_AT_GNU_numerator */
+    0,0,0,
+    0x00412133, /* DW_TAG_type_unit DW_AT_GNU_addr_base */
+    0x00112130, /* DW_TAG_compile_unit DW_AT_GNU_dwo_name */
+    0,0,0,0,0,0,0,
+    0x00113fe1, /* DW_TAG_compile_unit DW_AT_APPLE_optimized */
+    0,0,0,0,0,0,0,0,
+    0x00112134, /* DW_TAG_compile_unit DW_AT_GNU_pubnames */
+    0x41090001, /* DW_TAG_GNU_call_site DW_AT_sibling */
+    0,
+    0x002e2007, /* DW_TAG_subprogram DW_AT_MIPS_linkage_name */
+    0,
+    0x4108003a, /* DW_TAG_GNU_formal_parameter_pack DW_AT_decl_file */
+    0,0,
+    0x410a2111, /* DW_TAG_GNU_call_site_parameter DW_AT_GNU_call_site_value */
+    0,
+    0x003c0075, /* DW_TAG_partial_unit DW_AT_dwo_id */
+    0,0,0,0,0,
+    0x004a2133, /* DW_TAG_skeleton_unit DW_AT_GNU_addr_base */
+    0,
+    0x002e2083, /* DW_TAG_subprogram DW_AT_ghs_rsm */
+    0,
+    0x000d210a, /* DW_TAG_member DW_AT_GNU_guarded */
+    0,0,
+    0x002e210c, /* DW_TAG_subprogram DW_AT_GNU_locks_excluded */
+    0,0,
+    0x00342007, /* DW_TAG_variable DW_AT_MIPS_linkage_name */
+    0x4107003b, /* DW_TAG_GNU_template_parameter_pack DW_AT_decl_line */
+    0,
+    0x00342108, /* DW_TAG_variable DW_AT_GNU_guarded_by */
+    0,0,0,
+    0x004a2119, /* DW_TAG_skeleton_unit DW_AT_GNU_macros */
+    0,
+    0x002e2087, /* DW_TAG_subprogram DW_AT_ghs_rso */
+    0,0,0,0,0,0,0,0,0,
+    0x41070003, /* DW_TAG_GNU_template_parameter_pack DW_AT_name */
+    0,0,0,0,0,0,0,0,0,0,
+    0,0,0,0,
+    0x00112133, /* DW_TAG_compile_unit DW_AT_GNU_addr_base */
+    0,0,0,
+    0x41080039, /* DW_TAG_GNU_formal_parameter_pack DW_AT_decl_column */
+    0,0,0,0,
+    0x41090011, /* DW_TAG_GNU_call_site DW_AT_low_pc */
+    0,0,0,0,0,
+    0x004a2132, /* DW_TAG_skeleton_unit DW_AT_GNU_ranges_base */
+    0,0,
+    0x00112119, /* DW_TAG_compile_unit DW_AT_GNU_macros */
+    0,
+    0x000d2109, /* DW_TAG_member DW_AT_GNU_pt_guarded_by */
+    0x002e3fe7, /* DW_TAG_subprogram DW_AT_APPLE_omit_frame_ptr */
+    0,
+    0x41080001, /* DW_TAG_GNU_formal_parameter_pack DW_AT_sibling */
+    0,
+    0x0041210f, /* DW_TAG_type_unit DW_AT_GNU_odr_signature */
+    0x4107003a, /* DW_TAG_GNU_template_parameter_pack DW_AT_decl_file */
+    0,0,0,0,0,
+    0x00212305, /* DW_TAG_subrange_type DW_AT_GNU_bias */
+    0,0,
+    0x002e2086, /* DW_TAG_subprogram DW_AT_ghs_frames */
+    0,0,0,0,0,0,0,0,
+    0x41062108, /* DW_TAG_GNU_template_template_parameter DW_AT_GNU_guarded_by */
+    0x0034210b, /* DW_TAG_variable DW_AT_GNU_pt_guarded */
+    0x002e2001, /* DW_TAG_subprogram DW_AT_MIPS_fde */
+    0x41092115, /* DW_TAG_GNU_call_site DW_AT_GNU_tail_call */
+    0x4106003b, /* DW_TAG_GNU_template_template_parameter DW_AT_decl_line */
+    0,0,0,0,0,0,0,
+    0x410a0002, /* DW_TAG_GNU_call_site_parameter DW_AT_location */
+    0,0,0,
+    0x00112132, /* DW_TAG_compile_unit DW_AT_GNU_ranges_base */
+    0,0,
 };
 
 /* END FILE */
@@ -12,1207 +12,1198 @@
 #include "libdwarf.h"
 
 typedef struct {
-    unsigned int count; /* Attribute count */
     Dwarf_Half attr;    /* Attribute value */
 } Usage_Tag_Attr;
 
 /* 0x23 - DW_TAG_access_declaration */
 static Usage_Tag_Attr tag_attr_23[9] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/*      */ 0}
 };
 
 /* 0x01 - DW_TAG_array_type */
 static Usage_Tag_Attr tag_attr_01[24] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x4e */  0, DW_AT_allocated},
-    {/* 0x4f */  0, DW_AT_associated},
-    {/* 0x0d */  0, DW_AT_bit_size},
-    {/* 0x2e */  0, DW_AT_bit_stride},
-    {/* 0x0b */  0, DW_AT_byte_size},
-    {/* 0x50 */  0, DW_AT_data_location},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x09 */  0, DW_AT_ordering},
-    {/* 0x71 */  0, DW_AT_rank},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x47 */  0, DW_AT_specification},
-    {/* 0x2c */  0, DW_AT_start_scope},
-    {/* 0x49 */  0, DW_AT_type},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x4e */ DW_AT_allocated},
+    {/* 0x4f */ DW_AT_associated},
+    {/* 0x0d */ DW_AT_bit_size},
+    {/* 0x2e */ DW_AT_bit_stride},
+    {/* 0x0b */ DW_AT_byte_size},
+    {/* 0x50 */ DW_AT_data_location},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x09 */ DW_AT_ordering},
+    {/* 0x71 */ DW_AT_rank},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x47 */ DW_AT_specification},
+    {/* 0x2c */ DW_AT_start_scope},
+    {/* 0x49 */ DW_AT_type},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 /* 0x47 - DW_TAG_atomic_type */
 static Usage_Tag_Attr tag_attr_47[8] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x49 */  0, DW_AT_type},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x49 */ DW_AT_type},
+    {/*      */ 0}
 };
 
 /* 0x24 - DW_TAG_base_type */
-static Usage_Tag_Attr tag_attr_24[25] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x4e */  0, DW_AT_allocated},
-    {/* 0x4f */  0, DW_AT_associated},
-    {/* 0x5b */  0, DW_AT_binary_scale},
-    {/* 0x0c */  0, DW_AT_bit_offset},
-    {/* 0x0d */  0, DW_AT_bit_size},
-    {/* 0x0b */  0, DW_AT_byte_size},
-    {/* 0x0d */  0, DW_AT_bit_size},
-    {/* 0x6b */  0, DW_AT_data_bit_offset},
-    {/* 0x50 */  0, DW_AT_data_location},
-    {/* 0x5c */  0, DW_AT_decimal_scale},
-    {/* 0x5e */  0, DW_AT_decimal_sign},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x5f */  0, DW_AT_digit_count},
-    {/* 0x3e */  0, DW_AT_encoding},
-    {/* 0x65 */  0, DW_AT_endianity},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x60 */  0, DW_AT_picture_string},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x5d */  0, DW_AT_small},
-    {/*      */  0, 0}
+static Usage_Tag_Attr tag_attr_24[24] = {
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x4e */ DW_AT_allocated},
+    {/* 0x4f */ DW_AT_associated},
+    {/* 0x5b */ DW_AT_binary_scale},
+    {/* 0x0c */ DW_AT_bit_offset},
+    {/* 0x0d */ DW_AT_bit_size},
+    {/* 0x0b */ DW_AT_byte_size},
+    {/* 0x6b */ DW_AT_data_bit_offset},
+    {/* 0x50 */ DW_AT_data_location},
+    {/* 0x5c */ DW_AT_decimal_scale},
+    {/* 0x5e */ DW_AT_decimal_sign},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x5f */ DW_AT_digit_count},
+    {/* 0x3e */ DW_AT_encoding},
+    {/* 0x65 */ DW_AT_endianity},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x60 */ DW_AT_picture_string},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x5d */ DW_AT_small},
+    {/*      */ 0}
 };
 
 /* 0x48 - DW_TAG_call_site */
 static Usage_Tag_Attr tag_attr_48[13] = {
-    {/* 0x57 */  0, DW_AT_call_column},
-    {/* 0x58 */  0, DW_AT_call_file},
-    {/* 0x59 */  0, DW_AT_call_line},
-    {/* 0x7f */  0, DW_AT_call_origin},
-    {/* 0x81 */  0, DW_AT_call_pc},
-    {/* 0x7d */  0, DW_AT_call_return_pc},
-    {/* 0x82 */  0, DW_AT_call_tail_call},
-    {/* 0x83 */  0, DW_AT_call_target},
-    {/* 0x84 */  0, DW_AT_call_target_clobbered},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x49 */  0, DW_AT_type},
-    {/*      */  0, 0}
+    {/* 0x57 */ DW_AT_call_column},
+    {/* 0x58 */ DW_AT_call_file},
+    {/* 0x59 */ DW_AT_call_line},
+    {/* 0x7f */ DW_AT_call_origin},
+    {/* 0x81 */ DW_AT_call_pc},
+    {/* 0x7d */ DW_AT_call_return_pc},
+    {/* 0x82 */ DW_AT_call_tail_call},
+    {/* 0x83 */ DW_AT_call_target},
+    {/* 0x84 */ DW_AT_call_target_clobbered},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x49 */ DW_AT_type},
+    {/*      */ 0}
 };
 
 /* 0x49 - DW_TAG_call_site_parameter */
 static Usage_Tag_Attr tag_attr_49[10] = {
-    {/* 0x85 */  0, DW_AT_call_data_location},
-    {/* 0x86 */  0, DW_AT_call_data_value},
-    {/* 0x80 */  0, DW_AT_call_parameter},
-    {/* 0x7e */  0, DW_AT_call_value},
-    {/* 0x02 */  0, DW_AT_location},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x49 */  0, DW_AT_type},
-    {/*      */  0, 0}
+    {/* 0x85 */ DW_AT_call_data_location},
+    {/* 0x86 */ DW_AT_call_data_value},
+    {/* 0x80 */ DW_AT_call_parameter},
+    {/* 0x7e */ DW_AT_call_value},
+    {/* 0x02 */ DW_AT_location},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x49 */ DW_AT_type},
+    {/*      */ 0}
 };
 
 /* 0x25 - DW_TAG_catch_block */
 static Usage_Tag_Attr tag_attr_25[12] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x52 */  0, DW_AT_entry_pc},
-    {/* 0x12 */  0, DW_AT_high_pc},
-    {/* 0x11 */  0, DW_AT_low_pc},
-    {/* 0x55 */  0, DW_AT_ranges},
-    {/* 0x46 */  0, DW_AT_segment},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x52 */ DW_AT_entry_pc},
+    {/* 0x12 */ DW_AT_high_pc},
+    {/* 0x11 */ DW_AT_low_pc},
+    {/* 0x55 */ DW_AT_ranges},
+    {/* 0x46 */ DW_AT_segment},
+    {/* 0x01 */ DW_AT_sibling},
+    {/*      */ 0}
 };
 
 /* 0x02 - DW_TAG_class_type */
 static Usage_Tag_Attr tag_attr_02[23] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x4e */  0, DW_AT_allocated},
-    {/* 0x4f */  0, DW_AT_associated},
-    {/* 0x0d */  0, DW_AT_bit_size},
-    {/* 0x0b */  0, DW_AT_byte_size},
-    {/* 0x36 */  0, DW_AT_calling_convention},
-    {/* 0x1d */  0, DW_AT_containing_type},
-    {/* 0x50 */  0, DW_AT_data_location},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x69 */  0, DW_AT_signature},
-    {/* 0x47 */  0, DW_AT_specification},
-    {/* 0x2c */  0, DW_AT_start_scope},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x4e */ DW_AT_allocated},
+    {/* 0x4f */ DW_AT_associated},
+    {/* 0x0d */ DW_AT_bit_size},
+    {/* 0x0b */ DW_AT_byte_size},
+    {/* 0x36 */ DW_AT_calling_convention},
+    {/* 0x1d */ DW_AT_containing_type},
+    {/* 0x50 */ DW_AT_data_location},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x69 */ DW_AT_signature},
+    {/* 0x47 */ DW_AT_specification},
+    {/* 0x2c */ DW_AT_start_scope},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 /* 0x44 - DW_TAG_coarray_type */
 static Usage_Tag_Attr tag_attr_44[10] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x0d */  0, DW_AT_bit_size},
-    {/* 0x0b */  0, DW_AT_byte_size},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x49 */  0, DW_AT_type},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x0d */ DW_AT_bit_size},
+    {/* 0x0b */ DW_AT_byte_size},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x49 */ DW_AT_type},
+    {/*      */ 0}
 };
 
 /* 0x1a - DW_TAG_common_block */
 static Usage_Tag_Attr tag_attr_1a[13] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x6e */  0, DW_AT_linkage_name},
-    {/* 0x02 */  0, DW_AT_location},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x46 */  0, DW_AT_segment},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x6e */ DW_AT_linkage_name},
+    {/* 0x02 */ DW_AT_location},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x46 */ DW_AT_segment},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 /* 0x1b - DW_TAG_common_inclusion */
 static Usage_Tag_Attr tag_attr_1b[9] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x1a */  0, DW_AT_common_reference},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x1a */ DW_AT_common_reference},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 /* 0x11 - DW_TAG_compile_unit */
 static Usage_Tag_Attr tag_attr_11[24] = {
-    {/* 0x73 */  0, DW_AT_addr_base},
-    {/* 0x35 */  0, DW_AT_base_types},
-    {/* 0x1b */  0, DW_AT_comp_dir},
-    {/* 0x75 */  0, DW_AT_dwo_id},
-    {/* 0x76 */  0, DW_AT_dwo_name},
-    {/* 0x52 */  0, DW_AT_entry_pc},
-    {/* 0x42 */  0, DW_AT_identifier_case},
-    {/* 0x12 */  0, DW_AT_high_pc},
-    {/* 0x13 */  0, DW_AT_language},
-    {/* 0x8c */  0, DW_AT_loclists_base},
-    {/* 0x11 */  0, DW_AT_low_pc},
-    {/* 0x43 */  0, DW_AT_macro_info},
-    {/* 0x79 */  0, DW_AT_macros},
-    {/* 0x6a */  0, DW_AT_main_subprogram},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x25 */  0, DW_AT_producer},
-    {/* 0x55 */  0, DW_AT_ranges},
-    {/* 0x74 */  0, DW_AT_rnglists_base},
-    {/* 0x46 */  0, DW_AT_segment},
-    {/* 0x10 */  0, DW_AT_stmt_list},
-    {/* 0x72 */  0, DW_AT_str_offsets_base},
-    {/* 0x53 */  0, DW_AT_use_UTF8},
-    {/*      */  0, 0}
+    {/* 0x73 */ DW_AT_addr_base},
+    {/* 0x35 */ DW_AT_base_types},
+    {/* 0x1b */ DW_AT_comp_dir},
+    {/* 0x75 */ DW_AT_dwo_id},
+    {/* 0x76 */ DW_AT_dwo_name},
+    {/* 0x52 */ DW_AT_entry_pc},
+    {/* 0x42 */ DW_AT_identifier_case},
+    {/* 0x12 */ DW_AT_high_pc},
+    {/* 0x13 */ DW_AT_language},
+    {/* 0x8c */ DW_AT_loclists_base},
+    {/* 0x11 */ DW_AT_low_pc},
+    {/* 0x43 */ DW_AT_macro_info},
+    {/* 0x79 */ DW_AT_macros},
+    {/* 0x6a */ DW_AT_main_subprogram},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x25 */ DW_AT_producer},
+    {/* 0x55 */ DW_AT_ranges},
+    {/* 0x74 */ DW_AT_rnglists_base},
+    {/* 0x46 */ DW_AT_segment},
+    {/* 0x10 */ DW_AT_stmt_list},
+    {/* 0x72 */ DW_AT_str_offsets_base},
+    {/* 0x53 */ DW_AT_use_UTF8},
+    {/*      */ 0}
 };
 
 /* 0x3f - DW_TAG_condition */
 static Usage_Tag_Attr tag_attr_3f[7] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/*      */ 0}
 };
 
 /* 0x26 - DW_TAG_const_type */
 static Usage_Tag_Attr tag_attr_26[9] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x49 */  0, DW_AT_type},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x49 */ DW_AT_type},
+    {/*      */ 0}
 };
 
 /* 0x27 - DW_TAG_constant */
 static Usage_Tag_Attr tag_attr_27[17] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x1c */  0, DW_AT_const_value},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x65 */  0, DW_AT_endianity},
-    {/* 0x3f */  0, DW_AT_external},
-    {/* 0x6e */  0, DW_AT_linkage_name},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x2c */  0, DW_AT_start_scope},
-    {/* 0x49 */  0, DW_AT_type},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x1c */ DW_AT_const_value},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x65 */ DW_AT_endianity},
+    {/* 0x3f */ DW_AT_external},
+    {/* 0x6e */ DW_AT_linkage_name},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x2c */ DW_AT_start_scope},
+    {/* 0x49 */ DW_AT_type},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 /* 0x36 - DW_TAG_dwarf_procedure */
 static Usage_Tag_Attr tag_attr_36[3] = {
-    {/* 0x02 */  0, DW_AT_location},
-    {/*      */  0, 0}
+    {/* 0x02 */ DW_AT_location},
+    {/*      */ 0}
 };
 
 /* 0x46 - DW_TAG_dynamic_type */
 static Usage_Tag_Attr tag_attr_46[14] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x4e */  0, DW_AT_allocated},
-    {/* 0x4f */  0, DW_AT_associated},
-    {/* 0x50 */  0, DW_AT_data_location},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x49 */  0, DW_AT_type},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x4e */ DW_AT_allocated},
+    {/* 0x4f */ DW_AT_associated},
+    {/* 0x50 */ DW_AT_data_location},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x49 */ DW_AT_type},
+    {/* 0x01 */ DW_AT_sibling},
+    {/*      */ 0}
 };
 
 /* 0x03 - DW_TAG_entry_point */
 static Usage_Tag_Attr tag_attr_03[16] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x33 */  0, DW_AT_address_class},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x40 */  0, DW_AT_frame_base},
-    {/* 0x6e */  0, DW_AT_linkage_name},
-    {/* 0x11 */  0, DW_AT_low_pc},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x2a */  0, DW_AT_return_addr},
-    {/* 0x46 */  0, DW_AT_segment},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x48 */  0, DW_AT_static_link},
-    {/* 0x49 */  0, DW_AT_type},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x33 */ DW_AT_address_class},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x40 */ DW_AT_frame_base},
+    {/* 0x6e */ DW_AT_linkage_name},
+    {/* 0x11 */ DW_AT_low_pc},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x2a */ DW_AT_return_addr},
+    {/* 0x46 */ DW_AT_segment},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x48 */ DW_AT_static_link},
+    {/* 0x49 */ DW_AT_type},
+    {/*      */ 0}
 };
 
 /* 0x04 - DW_TAG_enumeration_type */
 static Usage_Tag_Attr tag_attr_04[26] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x4e */  0, DW_AT_allocated},
-    {/* 0x4f */  0, DW_AT_associated},
-    {/* 0x0d */  0, DW_AT_bit_size},
-    {/* 0x2e */  0, DW_AT_bit_stride},
-    {/* 0x0b */  0, DW_AT_byte_size},
-    {/* 0x51 */  0, DW_AT_byte_stride},
-    {/* 0x50 */  0, DW_AT_data_location},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x6d */  0, DW_AT_enum_class},
-    {/* 0x6e */  0, DW_AT_linkage_name},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x69 */  0, DW_AT_signature},
-    {/* 0x47 */  0, DW_AT_specification},
-    {/* 0x2c */  0, DW_AT_start_scope},
-    {/* 0x49 */  0, DW_AT_type},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x4e */ DW_AT_allocated},
+    {/* 0x4f */ DW_AT_associated},
+    {/* 0x0d */ DW_AT_bit_size},
+    {/* 0x2e */ DW_AT_bit_stride},
+    {/* 0x0b */ DW_AT_byte_size},
+    {/* 0x51 */ DW_AT_byte_stride},
+    {/* 0x50 */ DW_AT_data_location},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x6d */ DW_AT_enum_class},
+    {/* 0x6e */ DW_AT_linkage_name},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x69 */ DW_AT_signature},
+    {/* 0x47 */ DW_AT_specification},
+    {/* 0x2c */ DW_AT_start_scope},
+    {/* 0x49 */ DW_AT_type},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 /* 0x28 - DW_TAG_enumerator */
 static Usage_Tag_Attr tag_attr_28[9] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x1c */  0, DW_AT_const_value},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x1c */ DW_AT_const_value},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/*      */ 0}
 };
 
 /* 0x29 - DW_TAG_file_type */
 static Usage_Tag_Attr tag_attr_29[18] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x4e */  0, DW_AT_allocated},
-    {/* 0x4f */  0, DW_AT_associated},
-    {/* 0x0d */  0, DW_AT_bit_size},
-    {/* 0x0b */  0, DW_AT_byte_size},
-    {/* 0x50 */  0, DW_AT_data_location},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x2c */  0, DW_AT_start_scope},
-    {/* 0x49 */  0, DW_AT_type},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x4e */ DW_AT_allocated},
+    {/* 0x4f */ DW_AT_associated},
+    {/* 0x0d */ DW_AT_bit_size},
+    {/* 0x0b */ DW_AT_byte_size},
+    {/* 0x50 */ DW_AT_data_location},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x2c */ DW_AT_start_scope},
+    {/* 0x49 */ DW_AT_type},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 /* 0x05 - DW_TAG_formal_parameter */
 static Usage_Tag_Attr tag_attr_05[18] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x34 */  0, DW_AT_artificial},
-    {/* 0x1c */  0, DW_AT_const_value},
-    {/* 0x1e */  0, DW_AT_default_value},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x65 */  0, DW_AT_endianity},
-    {/* 0x21 */  0, DW_AT_is_optional},
-    {/* 0x02 */  0, DW_AT_location},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x46 */  0, DW_AT_segment},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x49 */  0, DW_AT_type},
-    {/* 0x4b */  0, DW_AT_variable_parameter},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x34 */ DW_AT_artificial},
+    {/* 0x1c */ DW_AT_const_value},
+    {/* 0x1e */ DW_AT_default_value},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x65 */ DW_AT_endianity},
+    {/* 0x21 */ DW_AT_is_optional},
+    {/* 0x02 */ DW_AT_location},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x46 */ DW_AT_segment},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x49 */ DW_AT_type},
+    {/* 0x4b */ DW_AT_variable_parameter},
+    {/*      */ 0}
 };
 
 /* 0x2a - DW_TAG_friend */
 static Usage_Tag_Attr tag_attr_2a[8] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x41 */  0, DW_AT_friend},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x41 */ DW_AT_friend},
+    {/* 0x01 */ DW_AT_sibling},
+    {/*      */ 0}
 };
 
 /* 0x45 - DW_TAG_generic_subrange */
 static Usage_Tag_Attr tag_attr_45[23] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x4e */  0, DW_AT_allocated},
-    {/* 0x4f */  0, DW_AT_associated},
-    {/* 0x0d */  0, DW_AT_bit_size},
-    {/* 0x2e */  0, DW_AT_bit_stride},
-    {/* 0x0b */  0, DW_AT_byte_size},
-    {/* 0x51 */  0, DW_AT_byte_stride},
-    {/* 0x37 */  0, DW_AT_count},
-    {/* 0x50 */  0, DW_AT_data_location},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x22 */  0, DW_AT_lower_bound},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x62 */  0, DW_AT_threads_scaled},
-    {/* 0x49 */  0, DW_AT_type},
-    {/* 0x2f */  0, DW_AT_upper_bound},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x4e */ DW_AT_allocated},
+    {/* 0x4f */ DW_AT_associated},
+    {/* 0x0d */ DW_AT_bit_size},
+    {/* 0x2e */ DW_AT_bit_stride},
+    {/* 0x0b */ DW_AT_byte_size},
+    {/* 0x51 */ DW_AT_byte_stride},
+    {/* 0x37 */ DW_AT_count},
+    {/* 0x50 */ DW_AT_data_location},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x22 */ DW_AT_lower_bound},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x62 */ DW_AT_threads_scaled},
+    {/* 0x49 */ DW_AT_type},
+    {/* 0x2f */ DW_AT_upper_bound},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 /* 0x08 - DW_TAG_imported_declaration */
 static Usage_Tag_Attr tag_attr_08[11] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x18 */  0, DW_AT_import},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x2c */  0, DW_AT_start_scope},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x18 */ DW_AT_import},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x2c */ DW_AT_start_scope},
+    {/*      */ 0}
 };
 
 /* 0x4b - DW_TAG_immutable_type */
 static Usage_Tag_Attr tag_attr_4b[6] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x49 */  0, DW_AT_type},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x49 */ DW_AT_type},
+    {/*      */ 0}
 };
 
 /* 0x3a - DW_TAG_imported_module */
 static Usage_Tag_Attr tag_attr_3a[8] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x18 */  0, DW_AT_import},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x2c */  0, DW_AT_start_scope},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x18 */ DW_AT_import},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x2c */ DW_AT_start_scope},
+    {/*      */ 0}
 };
 
 /* 0x3d - DW_TAG_imported_unit */
 static Usage_Tag_Attr tag_attr_3d[3] = {
-    {/* 0x18 */  0, DW_AT_import},
-    {/*      */  0, 0}
+    {/* 0x18 */ DW_AT_import},
+    {/*      */ 0}
 };
 
 /* 0x1c - DW_TAG_inheritance */
 static Usage_Tag_Attr tag_attr_1c[10] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x38 */  0, DW_AT_data_member_location},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x49 */  0, DW_AT_type},
-    {/* 0x4c */  0, DW_AT_virtuality},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x38 */ DW_AT_data_member_location},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x49 */ DW_AT_type},
+    {/* 0x4c */ DW_AT_virtuality},
+    {/*      */ 0}
 };
 
 /* 0x1d - DW_TAG_inlined_subroutine */
 static Usage_Tag_Attr tag_attr_1d[16] = {
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x57 */  0, DW_AT_call_column},
-    {/* 0x58 */  0, DW_AT_call_file},
-    {/* 0x59 */  0, DW_AT_call_line},
-    {/* 0x6c */  0, DW_AT_const_expr},
-    {/* 0x52 */  0, DW_AT_entry_pc},
-    {/* 0x12 */  0, DW_AT_high_pc},
-    {/* 0x11 */  0, DW_AT_low_pc},
-    {/* 0x55 */  0, DW_AT_ranges},
-    {/* 0x2a */  0, DW_AT_return_addr},
-    {/* 0x46 */  0, DW_AT_segment},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x2c */  0, DW_AT_start_scope},
-    {/* 0x56 */  0, DW_AT_trampoline},
-    {/*      */  0, 0}
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x57 */ DW_AT_call_column},
+    {/* 0x58 */ DW_AT_call_file},
+    {/* 0x59 */ DW_AT_call_line},
+    {/* 0x6c */ DW_AT_const_expr},
+    {/* 0x52 */ DW_AT_entry_pc},
+    {/* 0x12 */ DW_AT_high_pc},
+    {/* 0x11 */ DW_AT_low_pc},
+    {/* 0x55 */ DW_AT_ranges},
+    {/* 0x2a */ DW_AT_return_addr},
+    {/* 0x46 */ DW_AT_segment},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x2c */ DW_AT_start_scope},
+    {/* 0x56 */ DW_AT_trampoline},
+    {/*      */ 0}
 };
 
 /* 0x38 - DW_TAG_interface_type */
 static Usage_Tag_Attr tag_attr_38[12] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x69 */  0, DW_AT_signature},
-    {/* 0x2c */  0, DW_AT_start_scope},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x69 */ DW_AT_signature},
+    {/* 0x2c */ DW_AT_start_scope},
+    {/*      */ 0}
 };
 
 /* 0x0a - DW_TAG_label */
 static Usage_Tag_Attr tag_attr_0a[12] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x11 */  0, DW_AT_low_pc},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x46 */  0, DW_AT_segment},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x2c */  0, DW_AT_start_scope},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x11 */ DW_AT_low_pc},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x46 */ DW_AT_segment},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x2c */ DW_AT_start_scope},
+    {/*      */ 0}
 };
 
 /* 0x0b - DW_TAG_lexical_block */
 static Usage_Tag_Attr tag_attr_0b[14] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x52 */  0, DW_AT_entry_pc},
-    {/* 0x12 */  0, DW_AT_high_pc},
-    {/* 0x11 */  0, DW_AT_low_pc},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x55 */  0, DW_AT_ranges},
-    {/* 0x46 */  0, DW_AT_segment},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x52 */ DW_AT_entry_pc},
+    {/* 0x12 */ DW_AT_high_pc},
+    {/* 0x11 */ DW_AT_low_pc},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x55 */ DW_AT_ranges},
+    {/* 0x46 */ DW_AT_segment},
+    {/* 0x01 */ DW_AT_sibling},
+    {/*      */ 0}
 };
 
 /* 0x0d - DW_TAG_member */
-static Usage_Tag_Attr tag_attr_0d[23] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x34 */  0, DW_AT_artificial},
-    {/* 0x0c */  0, DW_AT_bit_offset},
-    {/* 0x0d */  0, DW_AT_bit_size},
-    {/* 0x0b */  0, DW_AT_byte_size},
-    {/* 0x0d */  0, DW_AT_bit_size},
-    {/* 0x1c */  0, DW_AT_const_value},
-    {/* 0x6b */  0, DW_AT_data_bit_offset},
-    {/* 0x38 */  0, DW_AT_data_member_location},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x3f */  0, DW_AT_external},
-    {/* 0x61 */  0, DW_AT_mutable},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x49 */  0, DW_AT_type},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+static Usage_Tag_Attr tag_attr_0d[22] = {
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x34 */ DW_AT_artificial},
+    {/* 0x0c */ DW_AT_bit_offset},
+    {/* 0x0d */ DW_AT_bit_size},
+    {/* 0x0b */ DW_AT_byte_size},
+    {/* 0x1c */ DW_AT_const_value},
+    {/* 0x6b */ DW_AT_data_bit_offset},
+    {/* 0x38 */ DW_AT_data_member_location},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x3f */ DW_AT_external},
+    {/* 0x61 */ DW_AT_mutable},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x49 */ DW_AT_type},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 /* 0x1e - DW_TAG_module */
 static Usage_Tag_Attr tag_attr_1e[18] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x52 */  0, DW_AT_entry_pc},
-    {/* 0x12 */  0, DW_AT_high_pc},
-    {/* 0x11 */  0, DW_AT_low_pc},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x45 */  0, DW_AT_priority},
-    {/* 0x55 */  0, DW_AT_ranges},
-    {/* 0x46 */  0, DW_AT_segment},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x47 */  0, DW_AT_specification},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x52 */ DW_AT_entry_pc},
+    {/* 0x12 */ DW_AT_high_pc},
+    {/* 0x11 */ DW_AT_low_pc},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x45 */ DW_AT_priority},
+    {/* 0x55 */ DW_AT_ranges},
+    {/* 0x46 */ DW_AT_segment},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x47 */ DW_AT_specification},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 /* 0x2b - DW_TAG_namelist */
 static Usage_Tag_Attr tag_attr_2b[11] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 /* 0x2c - DW_TAG_namelist_item */
 static Usage_Tag_Attr tag_attr_2c[7] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x44 */  0, DW_AT_namelist_item},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x44 */ DW_AT_namelist_item},
+    {/* 0x01 */ DW_AT_sibling},
+    {/*      */ 0}
 };
 
 /* 0x39 - DW_TAG_namespace */
-static Usage_Tag_Attr tag_attr_39[13] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x89 */  0, DW_AT_export_symbols},
-    {/* 0x54 */  0, DW_AT_extension},
-    {/* 0x89 */  0, DW_AT_export_symbols},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x2c */  0, DW_AT_start_scope},
-    {/*      */  0, 0}
+static Usage_Tag_Attr tag_attr_39[12] = {
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x89 */ DW_AT_export_symbols},
+    {/* 0x54 */ DW_AT_extension},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x2c */ DW_AT_start_scope},
+    {/*      */ 0}
 };
 
 /* 0x2d - DW_TAG_packed_type */
 static Usage_Tag_Attr tag_attr_2d[9] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x49 */  0, DW_AT_type},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x49 */ DW_AT_type},
+    {/*      */ 0}
 };
 
 /* 0x3c - DW_TAG_partial_unit */
 static Usage_Tag_Attr tag_attr_3c[24] = {
-    {/* 0x73 */  0, DW_AT_addr_base},
-    {/* 0x35 */  0, DW_AT_base_types},
-    {/* 0x1b */  0, DW_AT_comp_dir},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x76 */  0, DW_AT_dwo_name},
-    {/* 0x52 */  0, DW_AT_entry_pc},
-    {/* 0x42 */  0, DW_AT_identifier_case},
-    {/* 0x12 */  0, DW_AT_high_pc},
-    {/* 0x13 */  0, DW_AT_language},
-    {/* 0x11 */  0, DW_AT_low_pc},
-    {/* 0x43 */  0, DW_AT_macro_info},
-    {/* 0x79 */  0, DW_AT_macros},
-    {/* 0x6a */  0, DW_AT_main_subprogram},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x87 */  0, DW_AT_noreturn},
-    {/* 0x25 */  0, DW_AT_producer},
-    {/* 0x55 */  0, DW_AT_ranges},
-    {/* 0x74 */  0, DW_AT_rnglists_base},
-    {/* 0x46 */  0, DW_AT_segment},
-    {/* 0x10 */  0, DW_AT_stmt_list},
-    {/* 0x72 */  0, DW_AT_str_offsets_base},
-    {/* 0x53 */  0, DW_AT_use_UTF8},
-    {/*      */  0, 0}
+    {/* 0x73 */ DW_AT_addr_base},
+    {/* 0x35 */ DW_AT_base_types},
+    {/* 0x1b */ DW_AT_comp_dir},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x76 */ DW_AT_dwo_name},
+    {/* 0x52 */ DW_AT_entry_pc},
+    {/* 0x42 */ DW_AT_identifier_case},
+    {/* 0x12 */ DW_AT_high_pc},
+    {/* 0x13 */ DW_AT_language},
+    {/* 0x11 */ DW_AT_low_pc},
+    {/* 0x43 */ DW_AT_macro_info},
+    {/* 0x79 */ DW_AT_macros},
+    {/* 0x6a */ DW_AT_main_subprogram},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x87 */ DW_AT_noreturn},
+    {/* 0x25 */ DW_AT_producer},
+    {/* 0x55 */ DW_AT_ranges},
+    {/* 0x74 */ DW_AT_rnglists_base},
+    {/* 0x46 */ DW_AT_segment},
+    {/* 0x10 */ DW_AT_stmt_list},
+    {/* 0x72 */ DW_AT_str_offsets_base},
+    {/* 0x53 */ DW_AT_use_UTF8},
+    {/*      */ 0}
 };
 
 /* 0x0f - DW_TAG_pointer_type */
-static Usage_Tag_Attr tag_attr_0f[13] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x33 */  0, DW_AT_address_class},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x0d */  0, DW_AT_bit_size},
-    {/* 0x0b */  0, DW_AT_byte_size},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x49 */  0, DW_AT_type},
-    {/*      */  0, 0}
+static Usage_Tag_Attr tag_attr_0f[12] = {
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x33 */ DW_AT_address_class},
+    {/* 0x0d */ DW_AT_bit_size},
+    {/* 0x0b */ DW_AT_byte_size},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x49 */ DW_AT_type},
+    {/*      */ 0}
 };
 
 /* 0x1f - DW_TAG_ptr_to_member_type */
-static Usage_Tag_Attr tag_attr_1f[20] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x33 */  0, DW_AT_address_class},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x4e */  0, DW_AT_allocated},
-    {/* 0x4f */  0, DW_AT_associated},
-    {/* 0x1d */  0, DW_AT_containing_type},
-    {/* 0x50 */  0, DW_AT_data_location},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x49 */  0, DW_AT_type},
-    {/* 0x4a */  0, DW_AT_use_location},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+static Usage_Tag_Attr tag_attr_1f[19] = {
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x33 */ DW_AT_address_class},
+    {/* 0x4e */ DW_AT_allocated},
+    {/* 0x4f */ DW_AT_associated},
+    {/* 0x1d */ DW_AT_containing_type},
+    {/* 0x50 */ DW_AT_data_location},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x49 */ DW_AT_type},
+    {/* 0x4a */ DW_AT_use_location},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 /* 0x10 - DW_TAG_reference_type */
-static Usage_Tag_Attr tag_attr_10[13] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x33 */  0, DW_AT_address_class},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x0d */  0, DW_AT_bit_size},
-    {/* 0x0b */  0, DW_AT_byte_size},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x49 */  0, DW_AT_type},
-    {/*      */  0, 0}
+static Usage_Tag_Attr tag_attr_10[12] = {
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x33 */ DW_AT_address_class},
+    {/* 0x0d */ DW_AT_bit_size},
+    {/* 0x0b */ DW_AT_byte_size},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x49 */ DW_AT_type},
+    {/*      */ 0}
 };
 
 /* 0x37 - DW_TAG_restrict_type */
 static Usage_Tag_Attr tag_attr_37[8] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x49 */  0, DW_AT_type},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x49 */ DW_AT_type},
+    {/*      */ 0}
 };
 
 /* 0x42 - DW_TAG_rvalue_reference_type */
 static Usage_Tag_Attr tag_attr_42[10] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x33 */  0, DW_AT_address_class},
-    {/* 0x0b */  0, DW_AT_byte_size},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x49 */  0, DW_AT_type},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x33 */ DW_AT_address_class},
+    {/* 0x0b */ DW_AT_byte_size},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x49 */ DW_AT_type},
+    {/*      */ 0}
 };
 
 /* 0x20 - DW_TAG_set_type */
 static Usage_Tag_Attr tag_attr_20[20] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x4e */  0, DW_AT_allocated},
-    {/* 0x4f */  0, DW_AT_associated},
-    {/* 0x0d */  0, DW_AT_bit_size},
-    {/* 0x0b */  0, DW_AT_byte_size},
-    {/* 0x50 */  0, DW_AT_data_location},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x2c */  0, DW_AT_start_scope},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x49 */  0, DW_AT_type},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x4e */ DW_AT_allocated},
+    {/* 0x4f */ DW_AT_associated},
+    {/* 0x0d */ DW_AT_bit_size},
+    {/* 0x0b */ DW_AT_byte_size},
+    {/* 0x50 */ DW_AT_data_location},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x2c */ DW_AT_start_scope},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x49 */ DW_AT_type},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 /* 0x40 - DW_TAG_shared_type */
-static Usage_Tag_Attr tag_attr_40[13] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x4e */  0, DW_AT_allocated},
-    {/* 0x4f */  0, DW_AT_associated},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x37 */  0, DW_AT_count},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x49 */  0, DW_AT_type},
-    {/*      */  0, 0}
+static Usage_Tag_Attr tag_attr_40[12] = {
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x4e */ DW_AT_allocated},
+    {/* 0x4f */ DW_AT_associated},
+    {/* 0x37 */ DW_AT_count},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x49 */ DW_AT_type},
+    {/*      */ 0}
 };
 
 /* 0x4a - DW_TAG_skeleton_unit */
-static Usage_Tag_Attr tag_attr_4a[13] = {
-    {/* 0x73 */  0, DW_AT_addr_base},
-    {/* 0x1b */  0, DW_AT_comp_dir},
-    {/* 0x76 */  0, DW_AT_dwo_name},
-    {/* 0x12 */  0, DW_AT_high_pc},
-    {/* 0x11 */  0, DW_AT_low_pc},
-    {/* 0x10 */  0, DW_AT_stmt_list},
-    {/* 0x55 */  0, DW_AT_ranges},
-    {/* 0x74 */  0, DW_AT_rnglists_base},
-    {/* 0x10 */  0, DW_AT_stmt_list},
-    {/* 0x72 */  0, DW_AT_str_offsets_base},
-    {/* 0x53 */  0, DW_AT_use_UTF8},
-    {/*      */  0, 0}
+static Usage_Tag_Attr tag_attr_4a[12] = {
+    {/* 0x73 */ DW_AT_addr_base},
+    {/* 0x1b */ DW_AT_comp_dir},
+    {/* 0x76 */ DW_AT_dwo_name},
+    {/* 0x12 */ DW_AT_high_pc},
+    {/* 0x11 */ DW_AT_low_pc},
+    {/* 0x10 */ DW_AT_stmt_list},
+    {/* 0x55 */ DW_AT_ranges},
+    {/* 0x74 */ DW_AT_rnglists_base},
+    {/* 0x72 */ DW_AT_str_offsets_base},
+    {/* 0x53 */ DW_AT_use_UTF8},
+    {/*      */ 0}
 };
 
 /* 0x12 - DW_TAG_string_type */
 static Usage_Tag_Attr tag_attr_12[22] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x4e */  0, DW_AT_allocated},
-    {/* 0x4f */  0, DW_AT_associated},
-    {/* 0x0d */  0, DW_AT_bit_size},
-    {/* 0x0b */  0, DW_AT_byte_size},
-    {/* 0x50 */  0, DW_AT_data_location},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x46 */  0, DW_AT_segment},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x2c */  0, DW_AT_start_scope},
-    {/* 0x19 */  0, DW_AT_string_length},
-    {/* 0x6f */  0, DW_AT_string_length_bit_size},
-    {/* 0x70 */  0, DW_AT_string_length_byte_size},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x4e */ DW_AT_allocated},
+    {/* 0x4f */ DW_AT_associated},
+    {/* 0x0d */ DW_AT_bit_size},
+    {/* 0x0b */ DW_AT_byte_size},
+    {/* 0x50 */ DW_AT_data_location},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x46 */ DW_AT_segment},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x2c */ DW_AT_start_scope},
+    {/* 0x19 */ DW_AT_string_length},
+    {/* 0x6f */ DW_AT_string_length_bit_size},
+    {/* 0x70 */ DW_AT_string_length_byte_size},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 /* 0x13 - DW_TAG_structure_type */
 static Usage_Tag_Attr tag_attr_13[24] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x4e */  0, DW_AT_allocated},
-    {/* 0x4f */  0, DW_AT_associated},
-    {/* 0x0d */  0, DW_AT_bit_size},
-    {/* 0x0b */  0, DW_AT_byte_size},
-    {/* 0x36 */  0, DW_AT_calling_convention},
-    {/* 0x50 */  0, DW_AT_data_location},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x89 */  0, DW_AT_export_symbols},
-    {/* 0x6e */  0, DW_AT_linkage_name},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x69 */  0, DW_AT_signature},
-    {/* 0x47 */  0, DW_AT_specification},
-    {/* 0x2c */  0, DW_AT_start_scope},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x4e */ DW_AT_allocated},
+    {/* 0x4f */ DW_AT_associated},
+    {/* 0x0d */ DW_AT_bit_size},
+    {/* 0x0b */ DW_AT_byte_size},
+    {/* 0x36 */ DW_AT_calling_convention},
+    {/* 0x50 */ DW_AT_data_location},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x89 */ DW_AT_export_symbols},
+    {/* 0x6e */ DW_AT_linkage_name},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x69 */ DW_AT_signature},
+    {/* 0x47 */ DW_AT_specification},
+    {/* 0x2c */ DW_AT_start_scope},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 /* 0x2e - DW_TAG_subprogram */
 static Usage_Tag_Attr tag_attr_2e[49] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x33 */  0, DW_AT_address_class},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x34 */  0, DW_AT_artificial},
-    {/* 0x7a */  0, DW_AT_call_all_calls},
-    {/* 0x7c */  0, DW_AT_call_all_tail_calls},
-    {/* 0x7b */  0, DW_AT_call_all_source_calls},
-    {/* 0x36 */  0, DW_AT_calling_convention},
-    {/* 0x1d */  0, DW_AT_containing_type},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x8b */  0, DW_AT_defaulted},
-    {/* 0x8a */  0, DW_AT_deleted},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x66 */  0, DW_AT_elemental},
-    {/* 0x52 */  0, DW_AT_entry_pc},
-    {/* 0x63 */  0, DW_AT_explicit},
-    {/* 0x3f */  0, DW_AT_external},
-    {/* 0x40 */  0, DW_AT_frame_base},
-    {/* 0x12 */  0, DW_AT_high_pc},
-    {/* 0x20 */  0, DW_AT_inline},
-    {/* 0x6e */  0, DW_AT_linkage_name},
-    {/* 0x11 */  0, DW_AT_low_pc},
-    {/* 0x6a */  0, DW_AT_main_subprogram},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x87 */  0, DW_AT_noreturn},
-    {/* 0x64 */  0, DW_AT_object_pointer},
-    {/* 0x27 */  0, DW_AT_prototyped},
-    {/* 0x67 */  0, DW_AT_pure},
-    {/* 0x55 */  0, DW_AT_ranges},
-    {/* 0x68 */  0, DW_AT_recursive},
-    {/* 0x77 */  0, DW_AT_reference},
-    {/* 0x2a */  0, DW_AT_return_addr},
-    {/* 0x78 */  0, DW_AT_rvalue_reference},
-    {/* 0x46 */  0, DW_AT_segment},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x47 */  0, DW_AT_specification},
-    {/* 0x2c */  0, DW_AT_start_scope},
-    {/* 0x48 */  0, DW_AT_static_link},
-    {/* 0x56 */  0, DW_AT_trampoline},
-    {/* 0x49 */  0, DW_AT_type},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/* 0x4c */  0, DW_AT_virtuality},
-    {/* 0x4d */  0, DW_AT_vtable_elem_location},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x33 */ DW_AT_address_class},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x34 */ DW_AT_artificial},
+    {/* 0x7a */ DW_AT_call_all_calls},
+    {/* 0x7c */ DW_AT_call_all_tail_calls},
+    {/* 0x7b */ DW_AT_call_all_source_calls},
+    {/* 0x36 */ DW_AT_calling_convention},
+    {/* 0x1d */ DW_AT_containing_type},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x8b */ DW_AT_defaulted},
+    {/* 0x8a */ DW_AT_deleted},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x66 */ DW_AT_elemental},
+    {/* 0x52 */ DW_AT_entry_pc},
+    {/* 0x63 */ DW_AT_explicit},
+    {/* 0x3f */ DW_AT_external},
+    {/* 0x40 */ DW_AT_frame_base},
+    {/* 0x12 */ DW_AT_high_pc},
+    {/* 0x20 */ DW_AT_inline},
+    {/* 0x6e */ DW_AT_linkage_name},
+    {/* 0x11 */ DW_AT_low_pc},
+    {/* 0x6a */ DW_AT_main_subprogram},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x87 */ DW_AT_noreturn},
+    {/* 0x64 */ DW_AT_object_pointer},
+    {/* 0x27 */ DW_AT_prototyped},
+    {/* 0x67 */ DW_AT_pure},
+    {/* 0x55 */ DW_AT_ranges},
+    {/* 0x68 */ DW_AT_recursive},
+    {/* 0x77 */ DW_AT_reference},
+    {/* 0x2a */ DW_AT_return_addr},
+    {/* 0x78 */ DW_AT_rvalue_reference},
+    {/* 0x46 */ DW_AT_segment},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x47 */ DW_AT_specification},
+    {/* 0x2c */ DW_AT_start_scope},
+    {/* 0x48 */ DW_AT_static_link},
+    {/* 0x56 */ DW_AT_trampoline},
+    {/* 0x49 */ DW_AT_type},
+    {/* 0x17 */ DW_AT_visibility},
+    {/* 0x4c */ DW_AT_virtuality},
+    {/* 0x4d */ DW_AT_vtable_elem_location},
+    {/*      */ 0}
 };
 
 /* 0x21 - DW_TAG_subrange_type */
 static Usage_Tag_Attr tag_attr_21[24] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x4e */  0, DW_AT_allocated},
-    {/* 0x4f */  0, DW_AT_associated},
-    {/* 0x2e */  0, DW_AT_bit_stride},
-    {/* 0x0b */  0, DW_AT_byte_size},
-    {/* 0x0d */  0, DW_AT_bit_size},
-    {/* 0x51 */  0, DW_AT_byte_stride},
-    {/* 0x37 */  0, DW_AT_count},
-    {/* 0x50 */  0, DW_AT_data_location},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x22 */  0, DW_AT_lower_bound},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x62 */  0, DW_AT_threads_scaled},
-    {/* 0x49 */  0, DW_AT_type},
-    {/* 0x2f */  0, DW_AT_upper_bound},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x4e */ DW_AT_allocated},
+    {/* 0x4f */ DW_AT_associated},
+    {/* 0x2e */ DW_AT_bit_stride},
+    {/* 0x0b */ DW_AT_byte_size},
+    {/* 0x0d */ DW_AT_bit_size},
+    {/* 0x51 */ DW_AT_byte_stride},
+    {/* 0x37 */ DW_AT_count},
+    {/* 0x50 */ DW_AT_data_location},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x22 */ DW_AT_lower_bound},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x62 */ DW_AT_threads_scaled},
+    {/* 0x49 */ DW_AT_type},
+    {/* 0x2f */ DW_AT_upper_bound},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 /* 0x15 - DW_TAG_subroutine_type */
 static Usage_Tag_Attr tag_attr_15[22] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x33 */  0, DW_AT_address_class},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x4e */  0, DW_AT_allocated},
-    {/* 0x4f */  0, DW_AT_associated},
-    {/* 0x50 */  0, DW_AT_data_location},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x64 */  0, DW_AT_object_pointer},
-    {/* 0x27 */  0, DW_AT_prototyped},
-    {/* 0x78 */  0, DW_AT_rvalue_reference},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x2c */  0, DW_AT_start_scope},
-    {/* 0x49 */  0, DW_AT_type},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x33 */ DW_AT_address_class},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x4e */ DW_AT_allocated},
+    {/* 0x4f */ DW_AT_associated},
+    {/* 0x50 */ DW_AT_data_location},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x64 */ DW_AT_object_pointer},
+    {/* 0x27 */ DW_AT_prototyped},
+    {/* 0x78 */ DW_AT_rvalue_reference},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x2c */ DW_AT_start_scope},
+    {/* 0x49 */ DW_AT_type},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 /* 0x43 - DW_TAG_template_alias */
 static Usage_Tag_Attr tag_attr_43[18] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x4e */  0, DW_AT_allocated},
-    {/* 0x4f */  0, DW_AT_associated},
-    {/* 0x50 */  0, DW_AT_data_location},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x69 */  0, DW_AT_signature},
-    {/* 0x2c */  0, DW_AT_start_scope},
-    {/* 0x49 */  0, DW_AT_type},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x4e */ DW_AT_allocated},
+    {/* 0x4f */ DW_AT_associated},
+    {/* 0x50 */ DW_AT_data_location},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x69 */ DW_AT_signature},
+    {/* 0x2c */ DW_AT_start_scope},
+    {/* 0x49 */ DW_AT_type},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 /* 0x2f - DW_TAG_template_type_parameter */
 static Usage_Tag_Attr tag_attr_2f[10] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x1e */  0, DW_AT_default_value},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x49 */  0, DW_AT_type},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x1e */ DW_AT_default_value},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x49 */ DW_AT_type},
+    {/*      */ 0}
 };
 
 /* 0x30 - DW_TAG_template_value_parameter */
 static Usage_Tag_Attr tag_attr_30[13] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x1c */  0, DW_AT_const_value},
-    {/* 0x1e */  0, DW_AT_default_value},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x02 */  0, DW_AT_location},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x49 */  0, DW_AT_type},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x1c */ DW_AT_const_value},
+    {/* 0x1e */ DW_AT_default_value},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x02 */ DW_AT_location},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x49 */ DW_AT_type},
+    {/*      */ 0}
 };
 
 /* 0x31 - DW_TAG_thrown_type */
 static Usage_Tag_Attr tag_attr_31[12] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x4e */  0, DW_AT_allocated},
-    {/* 0x4f */  0, DW_AT_associated},
-    {/* 0x50 */  0, DW_AT_data_location},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x49 */  0, DW_AT_type},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x4e */ DW_AT_allocated},
+    {/* 0x4f */ DW_AT_associated},
+    {/* 0x50 */ DW_AT_data_location},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x49 */ DW_AT_type},
+    {/*      */ 0}
 };
 
 /* 0x32 - DW_TAG_try_block */
 static Usage_Tag_Attr tag_attr_32[12] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x52 */  0, DW_AT_entry_pc},
-    {/* 0x12 */  0, DW_AT_high_pc},
-    {/* 0x11 */  0, DW_AT_low_pc},
-    {/* 0x55 */  0, DW_AT_ranges},
-    {/* 0x46 */  0, DW_AT_segment},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x52 */ DW_AT_entry_pc},
+    {/* 0x12 */ DW_AT_high_pc},
+    {/* 0x11 */ DW_AT_low_pc},
+    {/* 0x55 */ DW_AT_ranges},
+    {/* 0x46 */ DW_AT_segment},
+    {/* 0x01 */ DW_AT_sibling},
+    {/*      */ 0}
 };
 
 /* 0x16 - DW_TAG_typedef */
 static Usage_Tag_Attr tag_attr_16[18] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x4e */  0, DW_AT_allocated},
-    {/* 0x4f */  0, DW_AT_associated},
-    {/* 0x50 */  0, DW_AT_data_location},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x2c */  0, DW_AT_start_scope},
-    {/* 0x49 */  0, DW_AT_type},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x4e */ DW_AT_allocated},
+    {/* 0x4f */ DW_AT_associated},
+    {/* 0x50 */ DW_AT_data_location},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x2c */ DW_AT_start_scope},
+    {/* 0x49 */ DW_AT_type},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 /* 0x41 - DW_TAG_type_unit */
 static Usage_Tag_Attr tag_attr_41[7] = {
-    {/* 0x1b */  0, DW_AT_comp_dir},
-    {/* 0x13 */  0, DW_AT_language},
-    {/* 0x10 */  0, DW_AT_stmt_list},
-    {/* 0x72 */  0, DW_AT_str_offsets_base},
-    {/* 0x53 */  0, DW_AT_use_UTF8},
-    {/*      */  0, 0}
+    {/* 0x1b */ DW_AT_comp_dir},
+    {/* 0x13 */ DW_AT_language},
+    {/* 0x10 */ DW_AT_stmt_list},
+    {/* 0x72 */ DW_AT_str_offsets_base},
+    {/* 0x53 */ DW_AT_use_UTF8},
+    {/*      */ 0}
 };
 
 /* 0x17 - DW_TAG_union_type */
 static Usage_Tag_Attr tag_attr_17[24] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x4e */  0, DW_AT_allocated},
-    {/* 0x4f */  0, DW_AT_associated},
-    {/* 0x0d */  0, DW_AT_bit_size},
-    {/* 0x0b */  0, DW_AT_byte_size},
-    {/* 0x36 */  0, DW_AT_calling_convention},
-    {/* 0x50 */  0, DW_AT_data_location},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x89 */  0, DW_AT_export_symbols},
-    {/* 0x6e */  0, DW_AT_linkage_name},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x69 */  0, DW_AT_signature},
-    {/* 0x47 */  0, DW_AT_specification},
-    {/* 0x2c */  0, DW_AT_start_scope},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x4e */ DW_AT_allocated},
+    {/* 0x4f */ DW_AT_associated},
+    {/* 0x0d */ DW_AT_bit_size},
+    {/* 0x0b */ DW_AT_byte_size},
+    {/* 0x36 */ DW_AT_calling_convention},
+    {/* 0x50 */ DW_AT_data_location},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x89 */ DW_AT_export_symbols},
+    {/* 0x6e */ DW_AT_linkage_name},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x69 */ DW_AT_signature},
+    {/* 0x47 */ DW_AT_specification},
+    {/* 0x2c */ DW_AT_start_scope},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 /* 0x18 - DW_TAG_unspecified_parameters */
 static Usage_Tag_Attr tag_attr_18[8] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x34 */  0, DW_AT_artificial},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x34 */ DW_AT_artificial},
+    {/* 0x01 */ DW_AT_sibling},
+    {/*      */ 0}
 };
 
 /* 0x3b - DW_TAG_unspecified_type */
 static Usage_Tag_Attr tag_attr_3b[7] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x03 */  0, DW_AT_name},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x03 */ DW_AT_name},
+    {/*      */ 0}
 };
 
 /* 0x34 - DW_TAG_variable */
 static Usage_Tag_Attr tag_attr_34[26] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x88 */  0, DW_AT_alignment},
-    {/* 0x34 */  0, DW_AT_artificial},
-    {/* 0x0b */  0, DW_AT_byte_size},
-    {/* 0x0d */  0, DW_AT_bit_size},
-    {/* 0x6c */  0, DW_AT_const_expr},
-    {/* 0x1c */  0, DW_AT_const_value},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x5a */  0, DW_AT_description},
-    {/* 0x65 */  0, DW_AT_endianity},
-    {/* 0x3f */  0, DW_AT_external},
-    {/* 0x6e */  0, DW_AT_linkage_name},
-    {/* 0x02 */  0, DW_AT_location},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x46 */  0, DW_AT_segment},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x47 */  0, DW_AT_specification},
-    {/* 0x2c */  0, DW_AT_start_scope},
-    {/* 0x49 */  0, DW_AT_type},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x88 */ DW_AT_alignment},
+    {/* 0x34 */ DW_AT_artificial},
+    {/* 0x0b */ DW_AT_byte_size},
+    {/* 0x0d */ DW_AT_bit_size},
+    {/* 0x6c */ DW_AT_const_expr},
+    {/* 0x1c */ DW_AT_const_value},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x5a */ DW_AT_description},
+    {/* 0x65 */ DW_AT_endianity},
+    {/* 0x3f */ DW_AT_external},
+    {/* 0x6e */ DW_AT_linkage_name},
+    {/* 0x02 */ DW_AT_location},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x46 */ DW_AT_segment},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x47 */ DW_AT_specification},
+    {/* 0x2c */ DW_AT_start_scope},
+    {/* 0x49 */ DW_AT_type},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 /* 0x19 - DW_TAG_variant */
 static Usage_Tag_Attr tag_attr_19[11] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x3d */  0, DW_AT_discr_list},
-    {/* 0x16 */  0, DW_AT_discr_value},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x3d */ DW_AT_discr_list},
+    {/* 0x16 */ DW_AT_discr_value},
+    {/* 0x01 */ DW_AT_sibling},
+    {/*      */ 0}
 };
 
 /* 0x33 - DW_TAG_variant_part */
 static Usage_Tag_Attr tag_attr_33[11] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x31 */  0, DW_AT_abstract_origin},
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x15 */  0, DW_AT_discr},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x49 */  0, DW_AT_type},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x31 */ DW_AT_abstract_origin},
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x15 */ DW_AT_discr},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x49 */ DW_AT_type},
+    {/*      */ 0}
 };
 
 /* 0x35 - DW_TAG_volatile_type */
 static Usage_Tag_Attr tag_attr_35[8] = {
-    {/* 0x39 */  0, DW_AT_decl_column},
-    {/* 0x3a */  0, DW_AT_decl_file},
-    {/* 0x3b */  0, DW_AT_decl_line},
-    {/* 0x03 */  0, DW_AT_name},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x49 */  0, DW_AT_type},
-    {/*      */  0, 0}
+    {/* 0x39 */ DW_AT_decl_column},
+    {/* 0x3a */ DW_AT_decl_file},
+    {/* 0x3b */ DW_AT_decl_line},
+    {/* 0x03 */ DW_AT_name},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x49 */ DW_AT_type},
+    {/*      */ 0}
 };
 
 /* 0x22 - DW_TAG_with_stmt */
 static Usage_Tag_Attr tag_attr_22[14] = {
-    {/* 0x32 */  0, DW_AT_accessibility},
-    {/* 0x33 */  0, DW_AT_address_class},
-    {/* 0x3c */  0, DW_AT_declaration},
-    {/* 0x52 */  0, DW_AT_entry_pc},
-    {/* 0x12 */  0, DW_AT_high_pc},
-    {/* 0x02 */  0, DW_AT_location},
-    {/* 0x11 */  0, DW_AT_low_pc},
-    {/* 0x55 */  0, DW_AT_ranges},
-    {/* 0x46 */  0, DW_AT_segment},
-    {/* 0x01 */  0, DW_AT_sibling},
-    {/* 0x49 */  0, DW_AT_type},
-    {/* 0x17 */  0, DW_AT_visibility},
-    {/*      */  0, 0}
+    {/* 0x32 */ DW_AT_accessibility},
+    {/* 0x33 */ DW_AT_address_class},
+    {/* 0x3c */ DW_AT_declaration},
+    {/* 0x52 */ DW_AT_entry_pc},
+    {/* 0x12 */ DW_AT_high_pc},
+    {/* 0x02 */ DW_AT_location},
+    {/* 0x11 */ DW_AT_low_pc},
+    {/* 0x55 */ DW_AT_ranges},
+    {/* 0x46 */ DW_AT_segment},
+    {/* 0x01 */ DW_AT_sibling},
+    {/* 0x49 */ DW_AT_type},
+    {/* 0x17 */ DW_AT_visibility},
+    {/*      */ 0}
 };
 
 static Usage_Tag_Attr *usage_tag_attr[77] = {
@@ -1314,10 +1305,10 @@ static Rate_Tag_Attr rate_tag_attr[77] = {
     {10, 0, /* 0x0a - DW_TAG_label */},
     {12, 0, /* 0x0b - DW_TAG_lexical_block */},
     {0, 0},
-    {21, 0, /* 0x0d - DW_TAG_member */},
+    {20, 0, /* 0x0d - DW_TAG_member */},
     {0, 0},
-    {11, 0, /* 0x0f - DW_TAG_pointer_type */},
-    {11, 0, /* 0x10 - DW_TAG_reference_type */},
+    {10, 0, /* 0x0f - DW_TAG_pointer_type */},
+    {10, 0, /* 0x10 - DW_TAG_reference_type */},
     {22, 0, /* 0x11 - DW_TAG_compile_unit */},
     {20, 0, /* 0x12 - DW_TAG_string_type */},
     {22, 0, /* 0x13 - DW_TAG_structure_type */},
@@ -1332,12 +1323,12 @@ static Rate_Tag_Attr rate_tag_attr[77] = {
     { 8, 0, /* 0x1c - DW_TAG_inheritance */},
     {14, 0, /* 0x1d - DW_TAG_inlined_subroutine */},
     {16, 0, /* 0x1e - DW_TAG_module */},
-    {18, 0, /* 0x1f - DW_TAG_ptr_to_member_type */},
+    {17, 0, /* 0x1f - DW_TAG_ptr_to_member_type */},
     {18, 0, /* 0x20 - DW_TAG_set_type */},
     {22, 0, /* 0x21 - DW_TAG_subrange_type */},
     {12, 0, /* 0x22 - DW_TAG_with_stmt */},
     { 7, 0, /* 0x23 - DW_TAG_access_declaration */},
-    {23, 0, /* 0x24 - DW_TAG_base_type */},
+    {22, 0, /* 0x24 - DW_TAG_base_type */},
     {10, 0, /* 0x25 - DW_TAG_catch_block */},
     { 7, 0, /* 0x26 - DW_TAG_const_type */},
     {15, 0, /* 0x27 - DW_TAG_constant */},
@@ -1358,14 +1349,14 @@ static Rate_Tag_Attr rate_tag_attr[77] = {
     { 1, 0, /* 0x36 - DW_TAG_dwarf_procedure */},
     { 6, 0, /* 0x37 - DW_TAG_restrict_type */},
     {10, 0, /* 0x38 - DW_TAG_interface_type */},
-    {11, 0, /* 0x39 - DW_TAG_namespace */},
+    {10, 0, /* 0x39 - DW_TAG_namespace */},
     { 6, 0, /* 0x3a - DW_TAG_imported_module */},
     { 5, 0, /* 0x3b - DW_TAG_unspecified_type */},
     {22, 0, /* 0x3c - DW_TAG_partial_unit */},
     { 1, 0, /* 0x3d - DW_TAG_imported_unit */},
     {0, 0},
     { 5, 0, /* 0x3f - DW_TAG_condition */},
-    {11, 0, /* 0x40 - DW_TAG_shared_type */},
+    {10, 0, /* 0x40 - DW_TAG_shared_type */},
     { 5, 0, /* 0x41 - DW_TAG_type_unit */},
     { 8, 0, /* 0x42 - DW_TAG_rvalue_reference_type */},
     {16, 0, /* 0x43 - DW_TAG_template_alias */},
@@ -1375,7 +1366,7 @@ static Rate_Tag_Attr rate_tag_attr[77] = {
     { 6, 0, /* 0x47 - DW_TAG_atomic_type */},
     {11, 0, /* 0x48 - DW_TAG_call_site */},
     { 8, 0, /* 0x49 - DW_TAG_call_site_parameter */},
-    {11, 0, /* 0x4a - DW_TAG_skeleton_unit */},
+    {10, 0, /* 0x4a - DW_TAG_skeleton_unit */},
     { 4, 0, /* 0x4b - DW_TAG_immutable_type */},
     {0, 0}
 };
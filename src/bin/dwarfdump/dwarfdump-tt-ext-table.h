@@ -3,31 +3,51 @@
 
 /* BEGIN FILE */
 
-#define TAG_TREE_EXT_COLUMN_COUNT 5
+/* Common extensions */
+#define TAG_TREE_EXT_HASH_MULT 0x9e3779b1u
 
-#define TAG_TREE_EXT_ROW_COUNT 9
+#define TAG_TREE_EXT_HASH_SHIFT 26
 
-/* Common extensions */
-static unsigned int tag_tree_combination_ext_table
-    [TAG_TREE_EXT_ROW_COUNT][TAG_TREE_EXT_COLUMN_COUNT] = {
-/* 0x13 - DW_TAG_structure_type                */
-    { 0x00000013,0x00000034,0x00004106,0x00004107,0x00004108,},
-/* 0x02 - DW_TAG_class_type                    */
-    { 0x00000002,0x00000034,0x00004106,0x00004107,0x00004108,},
-/* 0x0b - DW_TAG_lexical_block                 */
-    { 0x0000000b,0x00004109,0x00000000,0x00000000,0x00000000,},
-/* 0x2e - DW_TAG_subprogram                    */
-    { 0x0000002e,0x00004109,0x00004106,0x00004107,0x00004108,},
-/* 0x17 - DW_TAG_union_type                    */
-    { 0x00000017,0x00004106,0x00004107,0x00004108,0x00000000,},
-/* 0x1d - DW_TAG_inlined_subroutine            */
-    { 0x0000001d,0x00004109,0x00000000,0x00000000,0x00000000,},
-/* 0x4109 - DW_TAG_GNU_call_site                 */
-    { 0x00004109,0x0000410a,0x00000000,0x00000000,0x00000000,},
-/* 0x4107 - DW_TAG_GNU_template_parameter_pack   */
-    { 0x00004107,0x0000002f,0x00000030,0x00004106,0x00000000,},
-/* 0x4108 - DW_TAG_GNU_formal_parameter_pack     */
-    { 0x00004108,0x00000005,0x00000000,0x00000000,0x00000000,},
+#define TAG_TREE_EXT_HASH_SIZE 64
+
+static const unsigned int tag_tree_combination_ext_hash
+    [TAG_TREE_EXT_HASH_SIZE] = {
+    0,0,0,
+    0x00134108, /* DW_TAG_structure_type DW_TAG_GNU_formal_parameter_pack */
+    0x41074106, /* DW_TAG_GNU_template_parameter_pack DW_TAG_GNU_template_template_parameter */
+    0x00020034, /* DW_TAG_class_type DW_TAG_variable */
+    0,0,0,0,
+    0x00130034, /* DW_TAG_structure_type DW_TAG_variable */
+    0,0,0,0,0,0,
+    0x002e4107, /* DW_TAG_subprogram DW_TAG_GNU_template_parameter_pack */
+    0,0,
+    0x4107002f, /* DW_TAG_GNU_template_parameter_pack DW_TAG_template_type_parameter */
+    0,
+    0x00174107, /* DW_TAG_union_type DW_TAG_GNU_template_parameter_pack */
+    0x00024107, /* DW_TAG_class_type DW_TAG_GNU_template_parameter_pack */
+    0,0,0,
+    0x001d4109, /* DW_TAG_inlined_subroutine DW_TAG_GNU_call_site */
+    0x00134107, /* DW_TAG_structure_type DW_TAG_GNU_template_parameter_pack */
+    0,0,
+    0x4109410a, /* DW_TAG_GNU_call_site DW_TAG_GNU_call_site_parameter */
+    0x002e4109, /* DW_TAG_subprogram DW_TAG_GNU_call_site */
+    0,0,0,0,0,0,0,0,0,
+    0x002e4106, /* DW_TAG_subprogram DW_TAG_GNU_template_template_parameter */
+    0,0,0,
+    0x00174106, /* DW_TAG_union_type DW_TAG_GNU_template_template_parameter */
+    0x00024106, /* DW_TAG_class_type DW_TAG_GNU_template_template_parameter */
+    0,0,0,0,
+    0x00134106, /* DW_TAG_structure_type DW_TAG_GNU_template_template_parameter */
+    0x41080005, /* DW_TAG_GNU_formal_parameter_pack DW_TAG_formal_parameter */
+    0,0,
+    0x000b4109, /* DW_TAG_lexical_block DW_TAG_GNU_call_site */
+    0x002e4108, /* DW_TAG_subprogram DW_TAG_GNU_formal_parameter_pack */
+    0,
+    0x41070030, /* DW_TAG_GNU_template_parameter_pack DW_TAG_template_value_parameter */
+    0,
+    0x00174108, /* DW_TAG_union_type DW_TAG_GNU_formal_parameter_pack */
+    0x00024108, /* DW_TAG_class_type DW_TAG_GNU_formal_parameter_pack */
+    0,
 };
 
 /* END FILE */
@@ -83,6 +83,8 @@ Portions Copyright 2012 SN Systems Ltd. All rights reserved.
 #include "dd_naming.h" /* for get_FORM_name() */
 #include "dd_command_options.h"
 #include "dd_compiler_info.h"
+#include "dd_checkcache.h"
+#include "dd_memlimit.h"
 #include "dd_safe_strcpy.h"
 #include "dd_minimal.h"
 #include "dd_mac_cputype.h"
@@ -118,7 +120,6 @@ static void release_unique_errors_table(void);
 #ifdef TESTING
 static void dump_unique_errors_table(void);
 #endif
-static Dwarf_Bool add_to_unique_errors_table(char * error_text);
 
 static struct esb_s esb_short_cu_name;
 static struct esb_s esb_long_cu_name;
@@ -925,6 +926,66 @@ homeify(char *s, struct esb_s* out)
     return;
 }
 
+/*  Opens the supplementary object dbg refers to
+    (dwz .gnu_debugaltlink or DWARF5 .debug_sup) so
+    DW_FORM_strp_sup and DW_FORM_GNU_strp_alt
+    strings can be shown.  --file-sup names it,
+    otherwise the paths libdwarf suggests are tried.
+    Returns NULL if there is none or it cannot
+    be opened. */
+static Dwarf_Debug
+open_sup_object(Dwarf_Debug dbg)
+{
+    Dwarf_Debug    dbgsup = 0;
+    Dwarf_Error    superr = 0;
+    char         **paths = 0;
+    unsigned       pathcount = 0;
+    unsigned       i = 0;
+    int            res = 0;
+
+    if (glflags.sup_file_name) {
+        res = dwarf_init_path_a(glflags.sup_file_name,
+            0,0,DW_GROUPNUMBER_BASE,
+            glflags.gf_universalnumber,
+            0,0,&dbgsup,&superr);
+        if (res == DW_DLV_ERROR) {
+            print_error_and_continue(
+                "dwarf_init_path on --file-sup file",
+                res,superr);
+            DROP_ERROR_INSTANCE(dbgsup,res,superr);
+        } else if (res == DW_DLV_NO_ENTRY) {
+            printf("No DWARF information present in "
+                "supplementary file: %s\n",
+                sanitized(glflags.sup_file_name));
+        }
+        return dbgsup;
+    }
+    if (glflags.gf_no_follow_debuglink) {
+        return 0;
+    }
+    res = dwarf_get_sup_paths(dbg,0,0,0,&paths,&pathcount,
+        &superr);
+    if (res != DW_DLV_OK) {
+        DROP_ERROR_INSTANCE(dbg,res,superr);
+        return 0;
+    }
+    for (i = 0; i < pathcount; ++i) {
+        res = dwarf_init_path_a(paths[i],
+            0,0,DW_GROUPNUMBER_BASE,0,
+            0,0,&dbgsup,&superr);
+        if (res == DW_DLV_OK) {
+            printf("Supplementary file is %s\n",
+                sanitized(paths[i]));
+            break;
+        }
+        /*  Not there or not an object. Try the next. */
+        DROP_ERROR_INSTANCE(dbgsup,res,superr);
+        dbgsup = 0;
+    }
+    free(paths);
+    return dbgsup;
+}
+
 /*  Given a file which is an object type
     we think we can read, process the dwarf data.  */
 static int
@@ -937,6 +998,7 @@ process_one_file(
 {
     Dwarf_Debug dbg = 0;
     Dwarf_Debug dbgtied = 0;
+    Dwarf_Debug dbgsup = 0;
     int dres = 0;
     struct Dwarf_Printf_Callback_Info_s printfcallbackdata;
     Dwarf_Half elf_address_size = 0;      /* Target pointer size */
@@ -1101,6 +1163,14 @@ process_one_file(
         print_error(dbg, "dwarf_set_tied_dbg() failed",
             dres, onef_err);
     }
+    dbgsup = open_sup_object(dbg);
+    if (dbgsup) {
+        dres = dwarf_set_sup_dbg(dbg,dbgsup,&onef_err);
+        if (dres != DW_DLV_OK) {
+            print_error(dbg, "dwarf_set_sup_dbg() failed",
+                dres, onef_err);
+        }
+    }
 
     /*  Get .text and .debug_ranges info if in check mode.
         Depending on the section count and layout
@@ -1169,6 +1239,7 @@ process_one_file(
         int res = 0;
 
         reset_overall_CU_error_data();
+        checkcache_open();
         res = print_infos(dbg,TRUE,&err);
         if (res == DW_DLV_ERROR) {
             print_error_and_continue(
@@ -1184,6 +1255,7 @@ process_one_file(
                 res,err);
             DROP_ERROR_INSTANCE(dbg,res,err);
         }
+        checkcache_close();
         {
             set_global_section_sizes(dbg);
             /*  The statistics are for ALL of the
@@ -1574,6 +1646,8 @@ process_one_file(
         glflags.gf_count_major_errors++;
     }
 
+    memlimit_report();
+
     /*  Could finish dbg first. Either order ok. */
     if (dbgtied) {
         dres = dwarf_finish(dbgtied);
@@ -1592,6 +1666,17 @@ process_one_file(
         DROP_ERROR_INSTANCE(dbg,dres,onef_err);
         dbg = 0;
     }
+    if (dbgsup) {
+        /*  After dbg, which refers to it. */
+        dres = dwarf_finish(dbgsup);
+        if (dres != DW_DLV_OK) {
+            print_error_and_continue(
+                "dwarf_finish failed on supplementary dbg",
+                dres, onef_err);
+            DROP_ERROR_INSTANCE(dbg,dres,onef_err);
+        }
+        dbgsup = 0;
+    }
     printf("\n");
     destroy_attr_form_trees();
     destruct_abbrev_array();
@@ -2536,6 +2621,10 @@ print_dwarf_check_error(const char *s1,
     esb_append(&dwarf_error_line,trailer);
 
     error_text = esb_get_string(&dwarf_error_line);
+    if (glflags.gf_check_cache_recording &&
+        glflags.gf_print_unique_errors) {
+        checkcache_note_error(error_text);
+    }
     if (glflags.gf_print_unique_errors) {
         found = add_to_unique_errors_table(error_text);
         if (!found) {
@@ -35,7 +35,7 @@ Portions Copyright 2007-2021 David Anderson. All rights reserved.
 #include <config.h>
 
 #include <stdlib.h> /* calloc() free() */
-#include <string.h> /* memcmp() memset() strchr() strcmp()
+#include <string.h> /* memcmp() memcpy() memset() strchr() strcmp()
     strlen() strncmp() */
 
 #ifdef HAVE_STDINT_H
@@ -56,6 +56,8 @@ Portions Copyright 2007-2021 David Anderson. All rights reserved.
 #include "dd_opscounttab.h"
 #include "dd_tag_common.h"
 #include "dd_attr_form.h"
+#include "dd_checkcache.h"
+#include "dd_memlimit.h"
 #include "dd_regex.h"
 #include "dd_safe_strcpy.h"
 
@@ -611,6 +613,8 @@ form_refers_local_info(Dwarf_Half form)
 {
     switch(form) {
     case DW_FORM_GNU_ref_alt:
+    case DW_FORM_ref_sup4:
+    case DW_FORM_ref_sup8:
     case DW_FORM_GNU_strp_alt:
     case DW_FORM_strp_sup:
     case DW_FORM_line_strp:
@@ -882,6 +886,8 @@ static int
 print_macinfo_for_cu(
     Dwarf_Debug dbg,
     Dwarf_Die cu_die2,
+    char **srcfiles,
+    Dwarf_Signed srcfiles_cnt,
     Dwarf_Error *err)
 {
 
@@ -901,8 +907,7 @@ print_macinfo_for_cu(
         return mres;
     } else {
         mres = print_macinfo_by_offset(dbg,
-            cu_die2,
-            offset,err);
+            offset,srcfiles,srcfiles_cnt,err);
         if (mres==DW_DLV_ERROR) {
             struct esb_s m;
 
@@ -1218,6 +1223,7 @@ print_one_die_section(Dwarf_Debug dbg,Dwarf_Bool is_info,
         Dwarf_Half cu_type = 0;
         Dwarf_Sig8 signature;
         int        offres = 0;
+        Dwarf_Bool cu_from_cache = FALSE;
 
         signature = zerosig;
         /*  glflags.DIE_section_offset: in case
@@ -1333,6 +1339,14 @@ print_one_die_section(Dwarf_Debug dbg,Dwarf_Bool is_info,
             suppress_irrelevant_checking();
         }
         reset_error_reporting_globals();
+        if (glflags.check_cache_file) {
+            /*  If TRUE the check results of this CU
+                were taken from the cache, and the CU
+                is not read. */
+            cu_from_cache = checkcache_cu_begin(dbg,cu_die,
+                is_info,abbrev_offset,
+                fission_data_result == DW_DLV_OK);
+        }
 
         if ((glflags.gf_info_flag || glflags.gf_types_flag) &&
             glflags.gf_do_print_dwarf) {
@@ -1341,10 +1355,10 @@ print_one_die_section(Dwarf_Debug dbg,Dwarf_Bool is_info,
                 length_size, fission_data_result,cu_type,
                 &fission_data, &signature,typeoffset);
         }
-        if (glflags.gf_check_abbreviations ||
+        if (!cu_from_cache && (glflags.gf_check_abbreviations ||
             (glflags.verbose > 3 &&
             (glflags.gf_info_flag || glflags.gf_types_flag) &&
-            glflags.gf_do_print_dwarf)) {
+            glflags.gf_do_print_dwarf))) {
             int hares = 0;
             hares = print_cu_hdr_abbrev_data(dbg,
                 abbrev_offset,
@@ -1358,7 +1372,9 @@ print_one_die_section(Dwarf_Debug dbg,Dwarf_Bool is_info,
 
         /*  Get abbreviation info for this CU, given
             the abbrev offset */
-        get_abbrev_array_info(dbg,abbrev_offset);
+        if (!cu_from_cache) {
+            get_abbrev_array_info(dbg,abbrev_offset);
+        }
 
         /*  Process a single compilation unit in .debug_info or
             .debug_types. */
@@ -1370,9 +1386,31 @@ print_one_die_section(Dwarf_Debug dbg,Dwarf_Bool is_info,
             char **srcfiles = 0;
             int srcf =  0;
             Dwarf_Error srcerr = 0;
-
-            srcf = dwarf_srcfiles(cu_die2,
-                &srcfiles, &srcfiles_cnt, &srcerr);
+            struct dd_cu_lines_s culines;
+
+            memset(&culines,0,sizeof(culines));
+            culines.cl_srclines_res = DW_DLV_NO_ENTRY;
+            if (cu_from_cache) {
+                /*  Only the macro checks use the
+                    srcfiles. Problems were reported
+                    (and counted) when the CU was
+                    cached. */
+                srcf = DW_DLV_NO_ENTRY;
+                if (glflags.gf_check_macros) {
+                    srcf = dwarf_srcfiles(cu_die2,
+                        &srcfiles, &srcfiles_cnt, &srcerr);
+                    DROP_ERROR_INSTANCE(dbg,srcf,srcerr);
+                }
+            } else if (glflags.gf_line_flag ||
+                glflags.gf_check_decl_file) {
+                /*  Read the line table once, the
+                    srcfiles come from it too. */
+                srcf = load_cu_lines(dbg,cu_die2,&culines,
+                    &srcfiles, &srcfiles_cnt, &srcerr);
+            } else {
+                srcf = dwarf_srcfiles(cu_die2,
+                    &srcfiles, &srcfiles_cnt, &srcerr);
+            }
             if (srcf == DW_DLV_ERROR) {
                 print_error_and_continue(
                     "ERROR: dwarf_srcfiles problem ",
@@ -1386,8 +1424,8 @@ print_one_die_section(Dwarf_Debug dbg,Dwarf_Bool is_info,
                     and we do not want to print anything
                     about statements in that case */
             }
-            if (print_as_info_or_by_cuname() ||
-                glflags.gf_search_is_on) {
+            if (!cu_from_cache && (print_as_info_or_by_cuname() ||
+                glflags.gf_search_is_on)) {
                     /*  Do regardless if dwarf_srcfiles
                         was successful to print die
                         and children as best we can
@@ -1414,17 +1452,19 @@ print_one_die_section(Dwarf_Debug dbg,Dwarf_Bool is_info,
                             srcfiles = 0;
                             srcfiles_cnt = 0;
                         }
+                        release_cu_lines(dbg,&culines);
+                        checkcache_cu_end(FALSE);
                         dwarf_dealloc_die(cu_die2);
                         return pres;
                     }
                 }
                 /* Dump Ranges Information */
-                if (dump_ranges_info) {
+                if (dump_ranges_info && !cu_from_cache) {
                     PrintBucketGroup(glflags.pRangesInfo);
                 }
 
                 /* Check the range array if in checl mode */
-                if ( glflags.gf_check_ranges) {
+                if (glflags.gf_check_ranges && !cu_from_cache) {
                     int rares = 0;
                     Dwarf_Error raerr = 0;
 
@@ -1441,14 +1481,14 @@ print_one_die_section(Dwarf_Debug dbg,Dwarf_Bool is_info,
 
                 /*  Traverse the line section if in check mode
                     or if line-printing requested */
-                if (glflags.gf_line_flag ||
-                    glflags.gf_check_decl_file) {
+                if (!cu_from_cache && (glflags.gf_line_flag ||
+                    glflags.gf_check_decl_file)) {
                     int plnres = 0;
 
                     int oldsection = glflags.current_section_id;
                     plnres = print_line_numbers_this_cu(dbg,
                         cu_die2,
-                        srcfiles,srcfiles_cnt,pod_err);
+                        srcfiles,srcfiles_cnt,&culines,pod_err);
                     if (plnres == DW_DLV_ERROR) {
                         print_error_and_continue(
                             "ERROR: Printing line numbers for "
@@ -1460,6 +1500,9 @@ print_one_die_section(Dwarf_Debug dbg,Dwarf_Bool is_info,
                     }
                     glflags.current_section_id = oldsection;
                 }
+                /*  The macro checks span CUs, so are
+                    not part of the cached CU results. */
+                checkcache_cu_end(TRUE);
                 /*  We are not currently checking the macro
                     import trees for (infinite) loops.
                     We do not follow the import tree directly
@@ -1544,7 +1587,7 @@ print_one_die_section(Dwarf_Debug dbg,Dwarf_Bool is_info,
                         DWARF 5. */
 
                     mres = print_macinfo_for_cu(dbg,cu_die2,
-                        pod_err);
+                        srcfiles,srcfiles_cnt,pod_err);
                     if (mres == DW_DLV_ERROR) {
                         if (srcfiles) {
                             dealloc_all_srcfiles(dbg,srcfiles,
@@ -1552,6 +1595,7 @@ print_one_die_section(Dwarf_Debug dbg,Dwarf_Bool is_info,
                             srcfiles = 0;
                             srcfiles_cnt = 0;
                         }
+                        release_cu_lines(dbg,&culines);
                         dwarf_dealloc_die(cu_die2);
                         return mres;
                     }
@@ -1561,11 +1605,13 @@ print_one_die_section(Dwarf_Debug dbg,Dwarf_Bool is_info,
                     srcfiles = 0;
                     srcfiles_cnt = 0;
                 }
+                release_cu_lines(dbg,&culines);
             }
             if (cu_die2) {
                 dwarf_dealloc_die(cu_die2);
                 cu_die2 = 0;
             }
+            memlimit_cu_done((Dwarf_Unsigned)cu_count);
             ++cu_count;
         } /*  End loop on loop_count (CUs) */
         return nres;
@@ -4540,6 +4586,9 @@ print_attribute(Dwarf_Debug dbg, Dwarf_Die die,
         esb_destructor(&esb_extra);
         return res;
     }
+    if (glflags.gf_check_cache_recording) {
+        checkcache_note_form(theform);
+    }
     res = dwarf_get_version_of_die(die,&version,&offset_size);
     if (res != DW_DLV_OK) {
         print_error_and_continue(
@@ -6131,6 +6180,154 @@ print_expression_inner_block(Dwarf_Debug dbg,
     return res;
 }
 
+/*  Operators whose text depends only on the operator
+    and its first two operands, never on the DIE
+    or on other operators. */
+static Dwarf_Bool
+expr_op_text_is_plain(Dwarf_Small op)
+{
+    if (op_has_no_operands(op)) {
+        return TRUE;
+    }
+    if (op >= DW_OP_breg0 && op <= DW_OP_breg31) {
+        return TRUE;
+    }
+    switch (op) {
+    case DW_OP_addr:
+    case DW_OP_const1s:
+    case DW_OP_const2s:
+    case DW_OP_const4s:
+    case DW_OP_const8s:
+    case DW_OP_consts:
+    case DW_OP_fbreg:
+    case DW_OP_GNU_addr_index:
+    case DW_OP_addrx:
+    case DW_OP_GNU_const_index:
+    case DW_OP_constx:
+    case DW_OP_const1u:
+    case DW_OP_const2u:
+    case DW_OP_const4u:
+    case DW_OP_const8u:
+    case DW_OP_constu:
+    case DW_OP_pick:
+    case DW_OP_plus_uconst:
+    case DW_OP_regx:
+    case DW_OP_piece:
+    case DW_OP_deref_size:
+    case DW_OP_xderef_size:
+    case DW_OP_bregx:
+    case DW_OP_bit_piece:
+        return TRUE;
+    default:
+        break;
+    }
+    return FALSE;
+}
+
+static void
+append_plain_expr_op(Dwarf_Small op,
+    const char *op_name,
+    Dwarf_Unsigned opd1,
+    Dwarf_Unsigned opd2,
+    struct esb_s *string_out)
+{
+    esb_append(string_out, op_name);
+    if (op_has_no_operands(op)) {
+        /* Nothing to add. */
+    } else if (op >= DW_OP_breg0 && op <= DW_OP_breg31) {
+        esb_append_printf_i(string_out,
+            "%+" DW_PR_DSd , opd1);
+    } else {
+        switch (op) {
+        case DW_OP_addr:
+            bracket_hex(" ",opd1,"",string_out);
+            break;
+        case DW_OP_const1s:
+        case DW_OP_const2s:
+        case DW_OP_const4s:
+        case DW_OP_const8s:
+        case DW_OP_consts:
+        case DW_OP_fbreg:
+            esb_append(string_out," ");
+            formx_signed(opd1,string_out);
+            break;
+        case DW_OP_bregx:
+            bracket_hex(" ",opd1,"",string_out);
+            esb_append(string_out,"+");
+            formx_signed(opd2,string_out);
+            break;
+        case DW_OP_bit_piece:
+            bracket_hex(" ",opd1,"",string_out);
+            bracket_hex(" offset ",opd2,"",string_out);
+            break;
+        default:
+            /*  The unsigned single operand ops,
+                see expr_op_text_is_plain(). */
+            esb_append_printf_u(string_out,
+                " %" DW_PR_DUu , opd1);
+            break;
+        }
+    }
+}
+
+/*  The same few operators (DW_OP_fbreg -24,
+    DW_OP_breg7+8 ...) appear over and over in
+    location expressions, so the text of the
+    plain ones is kept in a small direct-mapped
+    table and a repeat is a copy, not a printf.
+    Texts too long for a slot are not kept. */
+#define EXPR_OP_MEMO_SIZE 1024 /* a power of 2 */
+#define EXPR_OP_MEMO_TEXT 40
+struct expr_op_memo_s {
+    Dwarf_Unsigned om_opd1;
+    Dwarf_Unsigned om_opd2;
+    Dwarf_Small    om_op;
+    unsigned char  om_len; /* 0: empty slot */
+    char           om_text[EXPR_OP_MEMO_TEXT];
+};
+static struct expr_op_memo_s expr_op_memo[EXPR_OP_MEMO_SIZE];
+
+static void
+append_plain_expr_op_memo(Dwarf_Small op,
+    Dwarf_Unsigned opd1,
+    Dwarf_Unsigned opd2,
+    struct esb_s *string_out)
+{
+    struct expr_op_memo_s *slot = 0;
+    Dwarf_Unsigned h = 0;
+    struct esb_s m;
+    char buf[EXPR_OP_MEMO_TEXT];
+    size_t len = 0;
+
+    h = (opd1 * 31 + opd2) * 0x9e3779b1 + op;
+    h ^= h >> 17;
+    slot = &expr_op_memo[h & (EXPR_OP_MEMO_SIZE-1)];
+    if (slot->om_len && slot->om_op == op &&
+        slot->om_opd1 == opd1 && slot->om_opd2 == opd2) {
+        if (glflags.gf_check_dwarf_constants) {
+            /*  get_OP_name() counts each name lookup
+                as a check. */
+            (void)get_OP_name(op,pd_dwarf_names_print_on_error);
+        }
+        esb_appendn(string_out,slot->om_text,slot->om_len);
+        return;
+    }
+    esb_constructor_fixed(&m,buf,sizeof(buf));
+    append_plain_expr_op(op,
+        get_OP_name(op,pd_dwarf_names_print_on_error),
+        opd1,opd2,&m);
+    len = esb_string_len(&m);
+    if (len && len < EXPR_OP_MEMO_TEXT) {
+        memcpy(slot->om_text,esb_get_string(&m),len+1);
+        slot->om_len = (unsigned char)len;
+        slot->om_op = op;
+        slot->om_opd1 = opd1;
+        slot->om_opd2 = opd2;
+    }
+    esb_append(string_out,esb_get_string(&m));
+    esb_destructor(&m);
+}
+
 int
 _dwarf_print_one_expr_op(Dwarf_Debug dbg,
     Dwarf_Die   die,
@@ -6177,7 +6374,6 @@ _dwarf_print_one_expr_op(Dwarf_Debug dbg,
             return res;
         }
     }
-    op_name = get_OP_name(op,pd_dwarf_names_print_on_error);
     if (has_skip_or_branch &&
         glflags.verbose) {
         showblockoffsets = TRUE;
@@ -6198,35 +6394,18 @@ _dwarf_print_one_expr_op(Dwarf_Debug dbg,
         echecking->op = op;
         echecking->offset =  offsetforbranch;
     }
-    esb_append(string_out, op_name);
     *stackchange =  _dwarf_opscounttab[op].oc_stackchange;
-    if (op_has_no_operands(op)) {
-        /* Nothing to add. */
-    } else if (op >= DW_OP_breg0 && op <= DW_OP_breg31) {
-        esb_append_printf_i(string_out,
-            "%+" DW_PR_DSd , opd1);
-    } else {
+    if (expr_op_text_is_plain(op)) {
+        if (op == DW_OP_piece || op == DW_OP_bit_piece) {
+            *zerostackdepth = TRUE;
+        }
+        append_plain_expr_op_memo(op,opd1,opd2,string_out);
+        return DW_DLV_OK;
+    }
+    op_name = get_OP_name(op,pd_dwarf_names_print_on_error);
+    esb_append(string_out, op_name);
+    {
         switch (op) {
-        case DW_OP_addr:
-            bracket_hex(" ",opd1,"",string_out);
-            break;
-        case DW_OP_const1s:
-        case DW_OP_const2s:
-        case DW_OP_const4s:
-        case DW_OP_const8s:
-        case DW_OP_consts:
-        case DW_OP_fbreg:
-            esb_append(string_out," ");
-            formx_signed(opd1,string_out);
-#if 0 /* FIX */
-            Turn on later
-            if (opd1) {
-                esb_append_printf_u(string_out,
-                    " (0x%" DW_PR_XZEROS DW_PR_DUx ")",
-                    opd1);
-            }
-#endif
-            break;
         case DW_OP_skip:
         case DW_OP_bra: {
             Dwarf_Signed as_signed = (Dwarf_Signed)opd1;
@@ -6256,40 +6435,6 @@ _dwarf_print_one_expr_op(Dwarf_Debug dbg,
             }
             }
             break;
-        case DW_OP_GNU_addr_index: /* unsigned val */
-        case DW_OP_addrx:  /* DWARF5: unsigned val */
-        case DW_OP_GNU_const_index:
-        case DW_OP_constx: /* DWARF5: unsigned val */
-        case DW_OP_const1u:
-        case DW_OP_const2u:
-        case DW_OP_const4u:
-        case DW_OP_const8u:
-        case DW_OP_constu:
-        case DW_OP_pick:
-        case DW_OP_plus_uconst:
-        case DW_OP_regx:
-        case DW_OP_piece:
-        case DW_OP_deref_size:
-        case DW_OP_xderef_size:
-            if (op == DW_OP_piece) {
-                *zerostackdepth = TRUE;
-            }
-            esb_append_printf_u(string_out,
-                " %" DW_PR_DUu , opd1);
-#if 0 /* FIX */
-            Turn on later
-            if (opd1 > 9) {
-                esb_append_printf_u(string_out,
-                    " (0x%" DW_PR_XZEROS DW_PR_DUx ")",
-                    opd1);
-            }
-#endif
-            break;
-        case DW_OP_bregx:
-            bracket_hex(" ",opd1,"",string_out);
-            esb_append(string_out,"+");
-            formx_signed(opd2,string_out);
-            break;
         case DW_OP_call2: {
             bracket_hex(" ",opd1,"",string_out);
             check_die_expr_op_basic_data(dbg,die,op_name,
@@ -6314,11 +6459,6 @@ _dwarf_print_one_expr_op(Dwarf_Debug dbg,
                 WITHIN_CU,opd1,string_out);
             }
             break;
-        case DW_OP_bit_piece:
-            *zerostackdepth = TRUE;
-            bracket_hex(" ",opd1,"",string_out);
-            bracket_hex(" offset ",opd2,"",string_out);
-            break;
         case DW_OP_implicit_value:
             {
                 unsigned long print_len = (unsigned long)opd1;
@@ -7381,10 +7521,8 @@ static Dwarf_Bool attributes_encoding_do_init = TRUE;
     DW_FORM_data are checked
 */
 static void
-check_attributes_encoding(Dwarf_Half attr,Dwarf_Half theform,
-    Dwarf_Unsigned value)
+init_attributes_encoding(void)
 {
-
     if (attributes_encoding_do_init) {
         /* Create table on first call */
         attributes_encoding_table = (a_attr_encoding *)calloc(
@@ -7401,6 +7539,29 @@ check_attributes_encoding(Dwarf_Half attr,Dwarf_Half theform,
         attributes_encoding_factor[DW_FORM_data16] = 16;
         attributes_encoding_do_init = FALSE;
     }
+}
+
+/*  Adds the wasted-space counts one CU contributed
+    in an earlier run, see dd_checkcache.c */
+void
+add_attributes_encoding(Dwarf_Half attr,
+    unsigned formsize, unsigned lebsize,
+    Dwarf_Unsigned count)
+{
+    init_attributes_encoding();
+    if (!attributes_encoding_table || attr >= DW_AT_lo_user) {
+        return;
+    }
+    attributes_encoding_table[attr].entries += count;
+    attributes_encoding_table[attr].formx   += formsize*count;
+    attributes_encoding_table[attr].leb128  += lebsize*count;
+}
+
+static void
+check_attributes_encoding(Dwarf_Half attr,Dwarf_Half theform,
+    Dwarf_Unsigned value)
+{
+    init_attributes_encoding();
 
     /* Regardless of the encoding form, count the checks. */
     DWARF_CHECK_COUNT(attr_encoding_result,1);
@@ -7466,6 +7627,12 @@ check_attributes_encoding(Dwarf_Half attr,Dwarf_Half theform,
                         attributes_encoding_factor[theform];
                     attributes_encoding_table[attr].leb128  +=
                         leb128_size;
+                    if (glflags.gf_check_cache_recording) {
+                        checkcache_note_usage(
+                            CHECKCACHE_ATTR_ENCODING,attr,
+                            attributes_encoding_factor[theform],
+                            leb128_size);
+                    }
                 }
             }
         }
@@ -30,7 +30,7 @@ Portions Copyright 2015-2015 Google, Inc. All Rights Reserved
 
 #include <config.h>
 
-#include <string.h> /* strcmp() strlen() */
+#include <string.h> /* memset() strcmp() strlen() */
 #include <time.h>   /* ctime() */
 
 #include "dwarf.h"
@@ -885,13 +885,67 @@ print_line_context_record(Dwarf_Line_Context line_context,
     return DW_DLV_OK;
 }
 
+/*  Reads the line table of the CU once.
+    Returns, as dwarf_srcfiles() would, the
+    source file names of the CU. Those come from
+    the line context when dwarf_srclines_b() succeeds
+    so the line table header is not read twice.
+    Any dwarf_srclines_b() error is kept in culines
+    for print_line_numbers_this_cu() to report
+    where it always has. */
+int
+load_cu_lines(Dwarf_Debug dbg, Dwarf_Die cu_die,
+    struct dd_cu_lines_s *culines,
+    char ***srcfiles,
+    Dwarf_Signed *srcfiles_cnt,
+    Dwarf_Error *err)
+{
+    int res = 0;
+
+    memset(culines,0,sizeof(*culines));
+    res = dwarf_srclines_b(cu_die,&culines->cl_version,
+        &culines->cl_table_count,&culines->cl_line_context,
+        &culines->cl_srclines_err);
+    culines->cl_srclines_res = res;
+    if (res == DW_DLV_OK) {
+        Dwarf_Error ferr = 0;
+
+        res = dwarf_srcfiles_from_linecontext(
+            culines->cl_line_context,
+            srcfiles,srcfiles_cnt,&ferr);
+        if (res == DW_DLV_OK) {
+            return res;
+        }
+        DROP_ERROR_INSTANCE(dbg,res,ferr);
+    }
+    return dwarf_srcfiles(cu_die,srcfiles,srcfiles_cnt,err);
+}
+
+void
+release_cu_lines(Dwarf_Debug dbg,
+    struct dd_cu_lines_s *culines)
+{
+    if (culines->cl_line_context) {
+        dwarf_srclines_dealloc_b(culines->cl_line_context);
+        culines->cl_line_context = 0;
+    }
+    if (culines->cl_srclines_err) {
+        dwarf_dealloc_error(dbg,culines->cl_srclines_err);
+        culines->cl_srclines_err = 0;
+    }
+    culines->cl_srclines_res = DW_DLV_NO_ENTRY;
+}
+
+/*  The line table was read by load_cu_lines(),
+    here we take ownership of the line context
+    and free it when done. */
 int
 print_line_numbers_this_cu(Dwarf_Debug dbg, Dwarf_Die cu_die,
     char **srcfiles,
     Dwarf_Signed srcf_count,
+    struct dd_cu_lines_s *culines,
     Dwarf_Error *err)
 {
-    Dwarf_Unsigned lineversion = 0;
     Dwarf_Signed linecount = 0;
     Dwarf_Line *linebuf = NULL;
     Dwarf_Signed linecount_actuals = 0;
@@ -1017,18 +1071,20 @@ print_line_numbers_this_cu(Dwarf_Debug dbg, Dwarf_Die cu_die,
 
         Sorry about the length of the code that
         results from having so many interfaces.  */
+    lres = culines->cl_srclines_res;
+    table_count = culines->cl_table_count;
+    line_context = culines->cl_line_context;
+    culines->cl_line_context = 0;
+    if (lres == DW_DLV_ERROR) {
+        *err = culines->cl_srclines_err;
+        culines->cl_srclines_err = 0;
+    }
     if (glflags.gf_line_flag_selection ==  singledw5) {
-        lres = dwarf_srclines_b(cu_die,&lineversion,
-            &table_count,&line_context,
-            err);
         if (lres == DW_DLV_OK) {
             lres = dwarf_srclines_from_linecontext(line_context,
                 &linebuf, &linecount,err);
         }
     } else {
-        lres = dwarf_srclines_b(cu_die,&lineversion,
-            &table_count,&line_context,
-            err);
         if (lres == DW_DLV_OK) {
             lres = dwarf_srclines_two_level_from_linecontext(
                 line_context,
@@ -1051,6 +1107,9 @@ print_line_numbers_this_cu(Dwarf_Debug dbg, Dwarf_Die cu_die,
                 lres, *err);
         }
         DROP_ERROR_INSTANCE(dbg,lres,*err);
+        if (line_context) {
+            dwarf_srclines_dealloc_b(line_context);
+        }
         return DW_DLV_OK;
     } else if (lres == DW_DLV_NO_ENTRY) {
         /* no line information is included */
@@ -163,26 +163,12 @@ print_one_macro_entry(long i,
     return res;
 }
 
-static void
-mac_dealloc_srcfiles_data(Dwarf_Debug dbg,
-    char **srcfiles,
-    Dwarf_Signed srcf_count)
-{
-    Dwarf_Signed i = 0;
-    if (!srcfiles) {
-        return;
-    }
-    for ( ; i < srcf_count; ++i) {
-        dwarf_dealloc(dbg,srcfiles[i],DW_DLA_STRING);
-    }
-    dwarf_dealloc(dbg, srcfiles, DW_DLA_LIST);
-}
-
 /*  print data in .debug_macinfo */
 /*ARGSUSED*/ int
 print_macinfo_by_offset(Dwarf_Debug dbg,
-    Dwarf_Die cu_die,
     Dwarf_Unsigned offset,
+    char **srcfiles,
+    Dwarf_Signed srcf_count,
     Dwarf_Error *error)
 {
     Dwarf_Unsigned max = 0;
@@ -193,8 +179,6 @@ print_macinfo_by_offset(Dwarf_Debug dbg,
     struct macro_counts_s counts;
     Dwarf_Unsigned totallen = 0;
     Dwarf_Bool is_primary = TRUE;
-    char ** srcfiles = 0;
-    Dwarf_Signed srcf_count = 0;
 
     glflags.current_section_id = DEBUG_MACINFO;
 
@@ -220,14 +204,6 @@ print_macinfo_by_offset(Dwarf_Debug dbg,
     } else if (lres == DW_DLV_NO_ENTRY) {
         return lres;
     }
-    lres = dwarf_srcfiles(cu_die,&srcfiles,&srcf_count,error);
-    if (lres == DW_DLV_ERROR) {
-        /*  This error will get found other places. No need
-            to say anything here. */
-        dwarf_dealloc_error(dbg,*error);
-        *error = 0;
-    }
-
     memset(&counts, 0, sizeof(counts));
     if (glflags.gf_do_print_dwarf) {
         struct esb_s truename;
@@ -292,7 +268,6 @@ print_macinfo_by_offset(Dwarf_Debug dbg,
 
     /* int type= maclist[count - 1].dmd_type; */
     /* ASSERT: type is zero */
-    mac_dealloc_srcfiles_data(dbg,srcfiles,srcf_count);
     dwarf_dealloc(dbg, maclist, DW_DLA_STRING);
     return DW_DLV_OK;
 }
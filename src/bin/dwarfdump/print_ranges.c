@@ -308,6 +308,18 @@ release_range_array_info(void)
     }
 }
 
+/*  With --memory-limit give back the space one large CU
+    grew the array to, so it is not held for the
+    rest of the run. */
+void
+trim_range_array_info(void)
+{
+    if (range_array && range_array_size > RANGE_ARRAY_INITIAL_SIZE) {
+        release_range_array_info();
+        allocate_range_array_info();
+    }
+}
+
 /*  Clear out values from previous CU */
 static void
 reset_range_array_info(void)
@@ -47,6 +47,7 @@ Portions Copyright 2007-2021 David Anderson. All rights reserved.
 #include "dd_helpertree.h"
 #include "dd_tag_common.h"
 #include "dd_attr_form.h"
+#include "dd_checkcache.h"
 
 static int pd_dwarf_names_print_on_error = 1;
 
@@ -59,6 +60,10 @@ record_tag_usage(int tag)
 {
     if (tag < DW_TAG_last) {
         ++tag_usage[tag];
+        if (glflags.gf_check_cache_recording) {
+            checkcache_note_usage(CHECKCACHE_TAG_USAGE,
+                (unsigned)tag,0,0);
+        }
     }
 }
 #endif /* HAVE_USAGE_TAG_ATTR */
@@ -66,6 +71,16 @@ record_tag_usage(int tag)
 #include "dwarfdump-ta-table.h"
 #include "dwarfdump-ta-ext-table.h"
 
+#ifdef HAVE_USAGE_TAG_ATTR
+/*  Usage counts of legal standard (tag,attr) and
+    (parent,child) pairs, indexed directly so recording
+    a use is O(1).  The generated usage_tag_attr and
+    usage_tag_tree vectors give the legal pairs
+    (and their printing order). */
+static unsigned int tag_attr_usage[DW_TAG_last][DW_AT_last];
+static unsigned int tag_tree_usage[DW_TAG_last][DW_TAG_last];
+#endif /* HAVE_USAGE_TAG_ATTR */
+
 int
 legal_tag_attr_combination(Dwarf_Half tag, Dwarf_Half attr)
 {
@@ -82,14 +97,13 @@ legal_tag_attr_combination(Dwarf_Half tag, Dwarf_Half attr)
             if (known) {
 #ifdef HAVE_USAGE_TAG_ATTR
                 /* Record usage of pair (tag,attr) */
-                if ( glflags.gf_print_usage_tag_attr) {
-                    Usage_Tag_Attr *usage_ptr = usage_tag_attr[tag];
-                    while (usage_ptr->attr) {
-                        if (attr == usage_ptr->attr) {
-                            ++usage_ptr->count;
-                            break;
-                        }
-                        ++usage_ptr;
+                if ( glflags.gf_print_usage_tag_attr &&
+                    tag < DW_TAG_last && attr < DW_AT_last) {
+                    ++tag_attr_usage[tag][attr];
+                    if (glflags.gf_check_cache_recording) {
+                        checkcache_note_usage(
+                            CHECKCACHE_TAG_ATTR_USAGE,
+                            tag,attr,0);
                     }
                 }
 #endif /* HAVE_USAGE_TAG_ATTR */
@@ -100,17 +114,12 @@ legal_tag_attr_combination(Dwarf_Half tag, Dwarf_Half attr)
     /*  DW_AT_MIPS_fde  used to return TRUE as that was
         convenient for SGI/MIPS users. */
     if (!glflags.gf_suppress_check_extensions_tables) {
-        int r = 0;
-        for (; r < ATTR_TREE_EXT_ROW_COUNT; ++r ) {
-            int c = 1;
-            if (tag != tag_attr_combination_ext_table[r][0]) {
-                continue;
-            }
-            for (; c < ATTR_TREE_EXT_COLUMN_COUNT ; ++c) {
-                if (tag_attr_combination_ext_table[r][c] == attr) {
-                    return TRUE;
-                }
-            }
+        unsigned int key = DD_PERFECT_HASH_KEY(tag,attr);
+        unsigned slot = DD_PERFECT_HASH_SLOT(key,
+            ATTR_TREE_EXT_HASH_MULT,ATTR_TREE_EXT_HASH_SHIFT);
+
+        if (tag_attr_combination_ext_hash[slot] == key) {
+            return TRUE;
         }
     }
     return FALSE;
@@ -141,15 +150,14 @@ legal_tag_tree_combination(Dwarf_Half tag_parent,
             if (known) {
 #ifdef HAVE_USAGE_TAG_ATTR
                 /* Record usage of pair (tag_parent,tag_child) */
-                if ( glflags.gf_print_usage_tag_attr) {
-                    Usage_Tag_Tree *usage_ptr =
-                        usage_tag_tree[tag_parent];
-                    while (usage_ptr->tag) {
-                        if (tag_child == usage_ptr->tag) {
-                            ++usage_ptr->count;
-                            break;
-                        }
-                        ++usage_ptr;
+                if ( glflags.gf_print_usage_tag_attr &&
+                    tag_parent < DW_TAG_last &&
+                    tag_child < DW_TAG_last) {
+                    ++tag_tree_usage[tag_parent][tag_child];
+                    if (glflags.gf_check_cache_recording) {
+                        checkcache_note_usage(
+                            CHECKCACHE_TAG_TREE_USAGE,
+                            tag_parent,tag_child,0);
                     }
                 }
 #endif /* HAVE_USAGE_TAG_ATTR */
@@ -158,23 +166,52 @@ legal_tag_tree_combination(Dwarf_Half tag_parent,
         }
     }
     if (!glflags.gf_suppress_check_extensions_tables) {
-        int r = 0;
-        for (; r < TAG_TREE_EXT_ROW_COUNT; ++r ) {
-            int c = 1;
-            if (tag_parent != tag_tree_combination_ext_table[r][0]) {
-                continue;
-            }
-            for (; c < TAG_TREE_EXT_COLUMN_COUNT ; ++c) {
-                if (tag_tree_combination_ext_table[r][c] ==
-                    tag_child) {
-                    return TRUE;
-                }
-            }
+        unsigned int key = DD_PERFECT_HASH_KEY(tag_parent,
+            tag_child);
+        unsigned slot = DD_PERFECT_HASH_SLOT(key,
+            TAG_TREE_EXT_HASH_MULT,TAG_TREE_EXT_HASH_SHIFT);
+
+        if (tag_tree_combination_ext_hash[slot] == key) {
+            return TRUE;
         }
     }
     return (FALSE);
 }
 
+/*  Adds usage counts one CU contributed in an
+    earlier run, see dd_checkcache.c */
+void
+add_usage_counts(int kind, unsigned k1, unsigned k2,
+    Dwarf_Unsigned count)
+{
+#ifdef HAVE_USAGE_TAG_ATTR
+    switch (kind) {
+    case CHECKCACHE_TAG_USAGE:
+        if (k1 < DW_TAG_last) {
+            tag_usage[k1] += (unsigned int)count;
+        }
+        break;
+    case CHECKCACHE_TAG_ATTR_USAGE:
+        if (k1 < DW_TAG_last && k2 < DW_AT_last) {
+            tag_attr_usage[k1][k2] += (unsigned int)count;
+        }
+        break;
+    case CHECKCACHE_TAG_TREE_USAGE:
+        if (k1 < DW_TAG_last && k2 < DW_TAG_last) {
+            tag_tree_usage[k1][k2] += (unsigned int)count;
+        }
+        break;
+    default:
+        break;
+    }
+#else /* !HAVE_USAGE_TAG_ATTR */
+    (void)kind;
+    (void)k1;
+    (void)k2;
+    (void)count;
+#endif /* HAVE_USAGE_TAG_ATTR */
+}
+
 /* Print a detailed tag and attributes usage */
 int
 print_tag_attributes_usage(void)
@@ -211,16 +248,19 @@ print_tag_attributes_usage(void)
                 print_header = FALSE;
             }
             while (usage_tag_tree_ptr && usage_tag_tree_ptr->tag) {
+                unsigned int count =
+                    tag_tree_usage[tag][usage_tag_tree_ptr->tag];
+
                 if ( glflags.gf_print_usage_tag_attr_full ||
-                    usage_tag_tree_ptr->count) {
-                    total_tags += usage_tag_tree_ptr->count;
+                    count) {
+                    total_tags += count;
                     printf("%6s %6d %s\n",
                         " ",
-                        usage_tag_tree_ptr->count,
+                        count,
                         get_TAG_name(usage_tag_tree_ptr->tag,
                             pd_dwarf_names_print_on_error));
                     /* Record the tag as found */
-                    if (usage_tag_tree_ptr->count) {
+                    if (count) {
                         ++rate_tag_tree[tag].found;
                     }
                 }
@@ -237,16 +277,19 @@ print_tag_attributes_usage(void)
                     get_TAG_name(tag,pd_dwarf_names_print_on_error));
             }
             while (usage_tag_attr_ptr && usage_tag_attr_ptr->attr) {
+                unsigned int count =
+                    tag_attr_usage[tag][usage_tag_attr_ptr->attr];
+
                 if ( glflags.gf_print_usage_tag_attr_full ||
-                    usage_tag_attr_ptr->count) {
-                    total_atrs += usage_tag_attr_ptr->count;
+                    count) {
+                    total_atrs += count;
                     printf("%6s %6d %s\n",
                         " ",
-                        usage_tag_attr_ptr->count,
+                        count,
                         get_AT_name(usage_tag_attr_ptr->attr,
                             pd_dwarf_names_print_on_error));
                     /* Record the attribute as found */
-                    if (usage_tag_attr_ptr->count) {
+                    if (count) {
                         ++rate_tag_attr[tag].found;
                     }
                 }
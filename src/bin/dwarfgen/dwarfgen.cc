@@ -269,6 +269,7 @@ static void           create_text_section(void);
 static Dwarf_Unsigned create_namestr_section(void);
 static void           write_generated_dbg(Dwarf_P_Debug dbg,
     IRepresentation &irep);
+static void           compress_debug_sections(Dwarf_P_Debug dbg);
 
 static string outfile("testout.o");
 static string infile;
@@ -298,7 +299,8 @@ CmdOptions cmdoptions = {
     false, //addframeadvanceloc
     false, //addSUNfuncoffsets
     false, //add_debug_sup
-    false //addskipbranch
+    false, //addskipbranch
+    false //compressdebugsections
 };
 
 // loff_t is signed for some reason (strange)
@@ -693,6 +695,8 @@ main(int argc, char **argv)
             DW_DLC_ELF_OFFSET_SIZE_32;
         unsigned machine = EM_386; /* from elf.h */
         int output_v4_test = 0;
+        // Appended to dwarf_extras.
+        string option_extras;
 
         unsigned global_elfclass = 0;
 
@@ -712,6 +716,9 @@ main(int argc, char **argv)
             {"show-reloc-details",dwno_argument,0,'r'},
             {"high-pc-as-const",dwno_argument,0,'h'},
             {"add-skip-branch-ops",dwno_argument,0,1007},
+            {"compress-debug-sections",dwrequired_argument,0,1008},
+            {"compress-threads",dwrequired_argument,0,1009},
+            {"optimize-line-table",dwno_argument,0,1010},
             {0,0,0,0},
         };
         // -p is pointer size
@@ -770,6 +777,38 @@ main(int argc, char **argv)
                 //{"add-skip-branch-ops",dwno_argument,0,1007},
                 cmdoptions.addskipbranch = true;
                 break;
+            case 1008:
+                //{"compress-debug-sections",dwrequired_argument,
+                //    0,1008},
+                // Output SHF_COMPRESSED sections so
+                // libdwarf reading of those is testable.
+                if (dwoptarg && !strcmp(dwoptarg,"zlib")) {
+                    option_extras.append(",compress_type=1");
+                } else if (dwoptarg && !strcmp(dwoptarg,"zstd")) {
+                    option_extras.append(",compress_type=2");
+                } else {
+                    cout << "dwarfgen: Invalid "
+                        "--compress-debug-sections input, "
+                        "only zlib or zstd accepted" << endl;
+                    exit(1);
+                }
+                cmdoptions.compressdebugsections = true;
+                break;
+            case 1009:
+                //{"compress-threads",dwrequired_argument,0,1009},
+                if (!dwoptarg || atoi(dwoptarg) < 0) {
+                    cout << "dwarfgen: Invalid "
+                        "--compress-threads input" << endl;
+                    exit(1);
+                }
+                option_extras.append(",compress_threads=");
+                option_extras.append(dwoptarg);
+                break;
+            case 1010:
+                //{"optimize-line-table",dwno_argument,0,1010},
+                // Let libdwarfp pick line_base and line_range.
+                option_extras.append(",optimize_line_table=1");
+                break;
             case 'c':
                 // At present we can only create a single
                 // cu in the output of the libdwarf producer.
@@ -887,6 +926,9 @@ main(int argc, char **argv)
         // function implementation.
         void *user_data = &global_elfclass;
 
+        string all_extras(dwarf_extras);
+        all_extras.append(option_extras);
+
         Dwarf_P_Debug dbg = 0;
         unsigned long dwbitflags =
             endian |
@@ -906,7 +948,7 @@ main(int argc, char **argv)
             user_data,
             isa_name,
             dwarf_version,
-            dwarf_extras,
+            all_extras.c_str(),
             &dbg,
             &err);
         if (res == DW_DLV_NO_ENTRY) {
@@ -1097,6 +1139,9 @@ write_object_file(Dwarf_P_Debug dbg,
 
     // Write the DWARF to our section data in memory.
     write_generated_dbg(dbg,irep);
+    if (cmdoptions.compressdebugsections) {
+        compress_debug_sections(dbg);
+    }
     // Create the section name string section,
     // set e_shstrndx.
     create_namestr_section();
@@ -1405,6 +1450,61 @@ write_generated_dbg(Dwarf_P_Debug dbg,
     }
 }
 
+// Relocations have been applied by now, so each
+// .debug_ section is final and can be replaced by its
+// SHF_COMPRESSED form.  libdwarfp owns the compressed
+// bytes until dwarf_producer_finish_a().
+static void
+compress_debug_sections(Dwarf_P_Debug dbg)
+{
+    for (vector<SectionForDwarf>::iterator it = dwsectab.begin();
+        it != dwsectab.end();
+        it++) {
+        SectionForDwarf &sec = *it;
+
+        if (sec.name_.compare(0,7,".debug_") || !sec.sh_size_) {
+            continue;
+        }
+        // libdwarfp hands the section over in several blobs.
+        vector<unsigned char> whole;
+        whole.reserve(sec.sh_size_);
+        for (vector<ByteBlob>::iterator itb =
+            sec.sectioncontent_.begin();
+            itb != sec.sectioncontent_.end();
+            itb++) {
+            ByteBlob &bb = *itb;
+            whole.insert(whole.end(),bb.bytes_,
+                bb.bytes_+bb.len_);
+        }
+        Dwarf_Ptr cbytes = 0;
+        Dwarf_Unsigned clen = 0;
+        Dwarf_Error err = 0;
+        int res = dwarf_compress_section_bytes(dbg,
+            &whole[0],whole.size(),sec.sh_addralign_,
+            &cbytes,&clen,&err);
+        if (res == DW_DLV_ERROR) {
+            cout << "dwarfgen: compressing " << sec.name_ <<
+                " fails: " << dwarf_errmsg(err) << endl;
+            exit(1);
+        }
+        if (res == DW_DLV_NO_ENTRY) {
+            cout << "Left " << sec.name_ <<
+                " uncompressed, " << sec.sh_size_ <<
+                " bytes" << endl;
+            continue;
+        }
+        cout << "Compressed " << sec.name_ << " from " <<
+            sec.sh_size_ << " to " << clen << " bytes" << endl;
+        sec.sectioncontent_.clear();
+        sec.sh_size_ = 0;
+        sec.add_section_content((unsigned char *)cbytes,clen);
+        sec.sh_flags_ |= SHF_COMPRESSED;
+        // Alignment of the Chdr now, the section alignment
+        // is recorded inside it.
+        sec.sh_addralign_ = dwelfheader.elf_is_64bit()?8:4;
+    }
+}
+
 static void
 write_elf_header(void)
 {
@@ -68,11 +68,19 @@ for standard than for extended tags.
 For standard tags the generated table is indexed by
 tag number. All the columns are bit flags.
 
-For extended tags the generated table is indexed
+For extended tags the table built here is indexed
 (call it j) by 0 - N-1
 and  [j][0] is the tag number and the rest of
 the columns (1 - N-1) are
-allowed attribute numbers.
+allowed attribute numbers.  What is generated
+from that is a perfect hash of (tag<<16)|attr
+so dwarfdump finds an extension pair with
+a single probe.
+
+The per-tag usage vectors list the legal
+attributes (in the order printed);
+the usage counts themselves are kept by dwarfdump
+in a flat array indexed by tag and attribute.
 
 */
 
@@ -240,10 +248,101 @@ validate_row_col(const char *position,
     return;
 }
 
+static void
+emit_standard_table(FILE *fileOut,unsigned table_rows,
+    unsigned table_columns)
+{
+    unsigned u = 0;
+
+    fprintf(fileOut,"#define ATTR_TREE_ROW_COUNT %d\n\n",
+        table_rows);
+    fprintf(fileOut,"#define ATTR_TREE_COLUMN_COUNT %d\n\n",
+        table_columns);
+    fprintf(fileOut,
+        "static unsigned int tag_attr_combination_table\n");
+    fprintf(fileOut,
+        "[ATTR_TREE_ROW_COUNT][ATTR_TREE_COLUMN_COUNT] = {\n");
+    for (u = 0; u < table_rows; u++) {
+        unsigned j = 0;
+        const char *name = 0;
+
+        ta_get_TAG_name(u,&name);
+        fprintf(fileOut,"/* 0x%02x - %-37s*/\n",u,name);
+        fprintf(fileOut,"    { ");
+        for (j = 0; j < table_columns; ++j ) {
+            if (j && j%5 == 0) {
+                fprintf(fileOut,"\n        ");
+            }
+            fprintf(fileOut,"0x%08x,",
+                tag_attr_combination_table[u][j]);
+        }
+        fprintf(fileOut,"},\n");
+    }
+    fprintf(fileOut,"};\n");
+}
+
+static void
+describe_tag_attr_key(FILE *f,unsigned int key)
+{
+    const char *tname = 0;
+    const char *aname = 0;
+
+    ta_get_TAG_name(key >> 16,&tname);
+    ta_get_AT_name(key & 0xffff,&aname);
+    fprintf(f,"%s %s",tname,aname);
+}
+
+static unsigned int ext_keys[ATTR_TABLE_ROW_MAXIMUM*
+    ATTR_TABLE_COLUMN_MAXIMUM];
+
+/*  The extended rows become a perfect hash
+    of (tag<<16)|attr keys. */
+static void
+emit_extended_hash(FILE *fileOut,unsigned table_rows,
+    unsigned table_columns)
+{
+    unsigned u = 0;
+    unsigned keycount = 0;
+
+    for (u = 0; u < table_rows; u++) {
+        unsigned j = 0;
+        unsigned tag = tag_attr_combination_table[u][0];
+
+        for (j = 1; j < table_columns; ++j ) {
+            unsigned attr = tag_attr_combination_table[u][j];
+            unsigned int key = 0;
+            unsigned k = 0;
+
+            if (!attr) {
+                continue;
+            }
+            if (tag > 0xffff || attr > 0xffff) {
+                bad_line_input("tag 0x%x attr 0x%x too large"
+                    " for the extension hash",tag,attr);
+            }
+            key = DD_PERFECT_HASH_KEY(tag,attr);
+            for (k = 0; k < keycount; ++k) {
+                if (ext_keys[k] == key) {
+                    break;
+                }
+            }
+            if (k < keycount) {
+                /* Duplicate pair, harmless. */
+                continue;
+            }
+            ext_keys[keycount] = key;
+            ++keycount;
+        }
+    }
+    fprintf(fileOut,"/* Common extensions */\n");
+    emit_perfect_hash(fileOut,"ATTR_TREE_EXT",
+        "tag_attr_combination_ext_hash",
+        ext_keys,0,keycount,describe_tag_attr_key);
+}
+
 int
 main(int argc, char **argv)
 {
-    unsigned u = 0;
     unsigned int num = 0;
     int input_eof = 0;
     unsigned table_rows = 0;
@@ -326,8 +425,6 @@ main(int argc, char **argv)
         fprintf(fileOut,"#include \"dwarf.h\"\n");
         fprintf(fileOut,"#include \"libdwarf.h\"\n\n");
         fprintf(fileOut,"typedef struct {\n");
-        fprintf(fileOut,"    unsigned int count;"
-            " /* Attribute count */\n");
         fprintf(fileOut,"    Dwarf_Half attr;"
             "    /* Attribute value */\n");
         fprintf(fileOut,"} Usage_Tag_Attr;\n\n");
@@ -403,6 +500,11 @@ main(int argc, char **argv)
                 }
                 validate_row_col("Setting attr bit",tag,idx,
                     table_rows,table_columns);
+                if (tag_attr_combination_table[tag][idx] &
+                    (((unsigned)1) << bit)) {
+                    bad_line_input("attribute 0x%02x duplicated"
+                        " for tag 0x%02x",num,tag);
+                }
                 tag_attr_combination_table[tag][idx] |=
                     (((unsigned)1) << bit);
             } else {
@@ -436,6 +538,12 @@ main(int argc, char **argv)
                         "cols %d.",DW_AT_last);
                     bad_line_input(esb_get_string(&msg_buf));
                 }
+                /*  dwarfdump counts uses in an array
+                    indexed by attribute. */
+                if (num >= DW_AT_last) {
+                    bad_line_input("attribute 0x%02x exceeds"
+                        " standard table size",num);
+                }
                 /* Check for duplicated entries */
                 if (tag_attr_vector[cur_attr]) {
                     bad_line_input(
@@ -474,10 +582,10 @@ main(int argc, char **argv)
             for (index = 1; index < cur_attr; ++index) {
                 attr = tag_attr_vector[index];
                 ta_get_AT_name(attr,&aname);
-                fprintf(fileOut,"    {/* 0x%02x */  0, %s},\n",
+                fprintf(fileOut,"    {/* 0x%02x */ %s},\n",
                     attr,aname);
             }
-            fprintf(fileOut,"    {/* %4s */  0, 0}\n};\n\n"," ");
+            fprintf(fileOut,"    {/* %4s */ 0}\n};\n\n"," ");
             /* Record allowed number of attributes */
             tag_attr_legal[tag] = cur_attr - 1;
         }
@@ -538,51 +646,10 @@ main(int argc, char **argv)
 #endif /* HAVE_USAGE_TAG_ATTR */
 
     if (standard_flag) {
-        fprintf(fileOut,"#define ATTR_TREE_ROW_COUNT %d\n\n",
-            table_rows);
-        fprintf(fileOut,"#define ATTR_TREE_COLUMN_COUNT %d\n\n",
-            table_columns);
-        fprintf(fileOut,
-            "static unsigned int tag_attr_combination_table\n");
-        fprintf(fileOut,
-            "[ATTR_TREE_ROW_COUNT][ATTR_TREE_COLUMN_COUNT] = {\n");
-    }
-    else {
-        fprintf(fileOut,"/* Common extensions */\n");
-        fprintf(fileOut,"#define ATTR_TREE_EXT_ROW_COUNT %d\n\n",
-            table_rows);
-        fprintf(fileOut,"#define ATTR_TREE_EXT_COLUMN_COUNT %d\n\n",
-            table_columns);
-        fprintf(fileOut,
-            "static unsigned int tag_attr_combination_ext_table\n");
-        fprintf(fileOut,
-            "    [ATTR_TREE_EXT_ROW_COUNT]"
-            "[ATTR_TREE_EXT_COLUMN_COUNT]"
-            " = {\n");
-    }
-
-    for (u = 0; u < table_rows; u++) {
-        unsigned j = 0;
-        const char *name = 0;
-        if (standard_flag) {
-            ta_get_TAG_name(u,&name);
-            fprintf(fileOut,"/* 0x%02x - %-37s*/\n",u,name);
-        } else {
-            unsigned k = tag_attr_combination_table[u][0];
-            ta_get_TAG_name(k,&name);
-            fprintf(fileOut,"/* 0x%02x - %-37s*/\n",k,name);
-        }
-        fprintf(fileOut,"    { ");
-        for (j = 0; j < table_columns; ++j ) {
-            if (j && j%5 == 0) {
-                fprintf(fileOut,"\n        ");
-            }
-            fprintf(fileOut,"0x%08x,",
-                tag_attr_combination_table[u][j]);
-        }
-        fprintf(fileOut,"},\n");
+        emit_standard_table(fileOut,table_rows,table_columns);
+    } else {
+        emit_extended_hash(fileOut,table_rows,table_columns);
     }
-    fprintf(fileOut,"};\n");
     fprintf(fileOut,"\n/* END FILE */\n");
     fclose(fileInp);
     fclose(fileOut);
@@ -221,3 +221,128 @@ read_value(unsigned int *outval,FILE*file)
     *outval = (int) lval;
     return NOT_EOF;
 }
+
+/*  Searching for a collision-free multiplier is
+    deterministic so that rebuilding the tables
+    yields identical generated headers. */
+static unsigned int
+next_multiplier(unsigned int m)
+{
+    m = m * 1103515245u + 12345u;
+    return m | 1;
+}
+
+/*  Given count distinct nonzero keys, find the smallest
+    power-of-two table (at least twice count) and an odd
+    multiplier such that DD_PERFECT_HASH_SLOT() puts every
+    key in a slot of its own.
+    On return slot_to_key[s] is the index+1 into keys[]
+    of the key in slot s, or 0 for an empty slot.
+    slot_to_key must have PERFECT_HASH_MAX_SLOTS entries. */
+void
+build_perfect_hash(unsigned int *keys, unsigned count,
+    unsigned     *bits_out,
+    unsigned int *mult_out,
+    unsigned     *slot_to_key)
+{
+    unsigned bits = 1;
+    unsigned int mult = 0x9e3779b1u;
+
+    while ((1u << bits) < 2*count) {
+        ++bits;
+    }
+    for ( ; bits <= PERFECT_HASH_MAX_BITS; ++bits) {
+        unsigned shift = 32 - bits;
+        unsigned tries = 0;
+
+        for (tries = 0; tries < PERFECT_HASH_MAX_TRIES; ++tries) {
+            unsigned k = 0;
+
+            memset(slot_to_key,0,
+                PERFECT_HASH_MAX_SLOTS*sizeof(unsigned));
+            for (k = 0; k < count; ++k) {
+                unsigned slot = DD_PERFECT_HASH_SLOT(keys[k],
+                    mult,shift);
+
+                if (slot_to_key[slot]) {
+                    break;
+                }
+                slot_to_key[slot] = k+1;
+            }
+            if (k == count) {
+                *bits_out = bits;
+                *mult_out = mult;
+                return;
+            }
+            mult = next_multiplier(mult);
+        }
+    }
+    bad_line_input("Unable to build a perfect hash of %u keys"
+        " in %u slots",count,PERFECT_HASH_MAX_SLOTS);
+}
+
+/*  Writes the defines and the slot table for a perfect hash.
+    If values is non-null each slot is a {key,value} pair,
+    otherwise just the key. describe() writes a short
+    comment for a key. */
+void
+emit_perfect_hash(FILE *fileOut,
+    const char   *prefix,
+    const char   *tablename,
+    unsigned int *keys,
+    unsigned int *values,
+    unsigned      count,
+    void (*describe)(FILE *f,unsigned int key))
+{
+    static unsigned slot_to_key[PERFECT_HASH_MAX_SLOTS];
+    unsigned bits = 0;
+    unsigned int mult = 0;
+    unsigned size = 0;
+    unsigned s = 0;
+    unsigned emptyrun = 0;
+
+    build_perfect_hash(keys,count,&bits,&mult,slot_to_key);
+    size = 1u << bits;
+    fprintf(fileOut,"#define %s_HASH_MULT 0x%08xu\n\n",prefix,mult);
+    fprintf(fileOut,"#define %s_HASH_SHIFT %u\n\n",prefix,32-bits);
+    fprintf(fileOut,"#define %s_HASH_SIZE %u\n\n",prefix,size);
+    if (values) {
+        fprintf(fileOut,"static const unsigned int %s\n",tablename);
+        fprintf(fileOut,"    [%s_HASH_SIZE][2] = {\n",prefix);
+    } else {
+        fprintf(fileOut,"static const unsigned int %s\n",tablename);
+        fprintf(fileOut,"    [%s_HASH_SIZE] = {\n",prefix);
+    }
+    for (s = 0; s < size; ++s) {
+        unsigned k = slot_to_key[s];
+
+        if (!k) {
+            if (!emptyrun) {
+                fprintf(fileOut,"    ");
+            }
+            fprintf(fileOut,values?"{0,0},":"0,");
+            ++emptyrun;
+            if (emptyrun == 10) {
+                fprintf(fileOut,"\n");
+                emptyrun = 0;
+            }
+            continue;
+        }
+        if (emptyrun) {
+            fprintf(fileOut,"\n");
+            emptyrun = 0;
+        }
+        if (values) {
+            fprintf(fileOut,"    {0x%08x,0x%08x}, /* ",
+                keys[k-1],values[k-1]);
+        } else {
+            fprintf(fileOut,"    0x%08x, /* ",keys[k-1]);
+        }
+        describe(fileOut,keys[k-1]);
+        fprintf(fileOut," */\n");
+    }
+    if (emptyrun) {
+        fprintf(fileOut,"\n");
+    }
+    fprintf(fileOut,"};\n");
+}
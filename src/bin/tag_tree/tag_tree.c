@@ -77,6 +77,12 @@ value of a standard tag that may be a child ofthat tag
 No commentary allowed, no symbols, just numbers.
 Blank lines are allowed and are dropped.
 
+The standard table is generated as bit flags indexed
+by parent tag. The extended table is generated
+as a perfect hash of (parenttag<<16)|childtag
+so dwarfdump finds an extension pair with
+a single probe.
+
 */
 
 static const char *usage[] = {
@@ -217,10 +223,98 @@ validate_row_col(const char *position,
     return;
 }
 
+static void
+emit_standard_table(FILE *fileOut,unsigned table_rows,
+    unsigned table_columns)
+{
+    unsigned u = 0;
+
+    fprintf(fileOut,"#define TAG_TREE_COLUMN_COUNT %d\n\n",
+        table_columns);
+    fprintf(fileOut,"#define TAG_TREE_ROW_COUNT %d\n\n",
+        table_rows);
+    fprintf(fileOut,
+        "static unsigned int tag_tree_combination_table\n");
+    fprintf(fileOut,
+        "    [TAG_TREE_ROW_COUNT][TAG_TREE_COLUMN_COUNT] = {\n");
+    for (u = 0; u < table_rows; u++) {
+        unsigned j = 0;
+        const char *name = 0;
+
+        ta_get_TAG_name(u,&name);
+        fprintf(fileOut,"/* 0x%02x - %-37s*/\n",u, name);
+        fprintf(fileOut,"    { ");
+        for (j = 0; j < table_columns; ++j ) {
+            fprintf(fileOut,"0x%08x,",
+                tag_tree_combination_table[u][j]);
+        }
+        fprintf(fileOut,"},\n");
+    }
+    fprintf(fileOut,"};\n");
+}
+
+static void
+describe_tag_tree_key(FILE *f,unsigned int key)
+{
+    const char *pname = 0;
+    const char *cname = 0;
+
+    ta_get_TAG_name(key >> 16,&pname);
+    ta_get_TAG_name(key & 0xffff,&cname);
+    fprintf(f,"%s %s",pname,cname);
+}
+
+static unsigned int ext_keys[TAG_TABLE_ROW_MAXIMUM*
+    TAG_TABLE_COLUMN_MAXIMUM];
+
+/*  The extended rows become a perfect hash
+    of (parenttag<<16)|childtag keys. */
+static void
+emit_extended_hash(FILE *fileOut,unsigned table_rows,
+    unsigned table_columns)
+{
+    unsigned u = 0;
+    unsigned keycount = 0;
+
+    for (u = 0; u < table_rows; u++) {
+        unsigned j = 0;
+        unsigned tag = tag_tree_combination_table[u][0];
+
+        for (j = 1; j < table_columns; ++j ) {
+            unsigned child = tag_tree_combination_table[u][j];
+            unsigned int key = 0;
+            unsigned k = 0;
+
+            if (!child) {
+                continue;
+            }
+            if (tag > 0xffff || child > 0xffff) {
+                bad_line_input("tag 0x%x child 0x%x too large"
+                    " for the extension hash",tag,child);
+            }
+            key = DD_PERFECT_HASH_KEY(tag,child);
+            for (k = 0; k < keycount; ++k) {
+                if (ext_keys[k] == key) {
+                    break;
+                }
+            }
+            if (k < keycount) {
+                /* Duplicate pair, harmless. */
+                continue;
+            }
+            ext_keys[keycount] = key;
+            ++keycount;
+        }
+    }
+    fprintf(fileOut,"/* Common extensions */\n");
+    emit_perfect_hash(fileOut,"TAG_TREE_EXT",
+        "tag_tree_combination_ext_hash",
+        ext_keys,0,keycount,describe_tag_tree_key);
+}
+
 int
 main(int argc, char **argv)
 {
-    unsigned u = 0;
     unsigned int num = 0;
     int input_eof = 0;
     unsigned table_rows = 0;
@@ -302,7 +396,6 @@ main(int argc, char **argv)
         fprintf(fileOut,"#include \"dwarf.h\"\n");
         fprintf(fileOut,"#include \"libdwarf.h\"\n\n");
         fprintf(fileOut,"typedef struct {\n");
-        fprintf(fileOut,"    unsigned int count; /* Tag count */\n");
         fprintf(fileOut,"    Dwarf_Half tag;     /* Tag value */\n");
         fprintf(fileOut,"} Usage_Tag_Tree;\n\n");
     }
@@ -370,6 +463,11 @@ main(int argc, char **argv)
                 }
                 validate_row_col("Update columns bit",tag,idx,
                     table_rows,table_columns);
+                if (tag_tree_combination_table[tag][idx] &
+                    (((unsigned)1) << bit)) {
+                    bad_line_input("child tag 0x%02x duplicated"
+                        " for tag 0x%02x",num,tag);
+                }
                 tag_tree_combination_table[tag][idx] |=
                     (((unsigned)1) << bit);
             } else {
@@ -394,6 +492,12 @@ main(int argc, char **argv)
                     bad_line_input(
                         "too many TAGs: table incomplete.");
                 }
+                /*  dwarfdump counts uses in an array
+                    indexed by child tag. */
+                if (num >= DW_TAG_last) {
+                    bad_line_input("child tag 0x%02x exceeds"
+                        " standard table size",num);
+                }
                 /* Check for duplicated entries */
                 if (tag_tree_vector[cur_tag]) {
                     bad_line_input(
@@ -431,10 +535,10 @@ main(int argc, char **argv)
             for (index = 1; index < cur_tag; ++index) {
                 child_tag = tag_tree_vector[index];
                 ta_get_TAG_name(child_tag,&aname);
-                fprintf(fileOut,"    {/* 0x%02x */ 0, %s},\n",
+                fprintf(fileOut,"    {/* 0x%02x */ %s},\n",
                     child_tag,aname);
             }
-            fprintf(fileOut,"    {/* %4s */ 0, 0}\n};\n\n"," ");
+            fprintf(fileOut,"    {/* %4s */ 0}\n};\n\n"," ");
             /* Record allowed number of attributes */
             tag_tree_legal[tag] = cur_tag - 1;
         }
@@ -493,50 +597,10 @@ main(int argc, char **argv)
 
     check_unused_combo(table_rows, table_columns);
     if (standard_flag) {
-        fprintf(fileOut,"#define TAG_TREE_COLUMN_COUNT %d\n\n",
-            table_columns);
-        fprintf(fileOut,"#define TAG_TREE_ROW_COUNT %d\n\n",
-            table_rows);
-        fprintf(fileOut,
-            "static unsigned int tag_tree_combination_table\n");
-        fprintf(fileOut,
-            "    [TAG_TREE_ROW_COUNT][TAG_TREE_COLUMN_COUNT] = {\n");
+        emit_standard_table(fileOut,table_rows,table_columns);
     } else {
-        fprintf(fileOut,
-            "#define TAG_TREE_EXT_COLUMN_COUNT %d\n\n",
-            table_columns);
-        fprintf(fileOut,
-            "#define TAG_TREE_EXT_ROW_COUNT %d\n\n",
-            table_rows);
-        fprintf(fileOut,"/* Common extensions */\n");
-        fprintf(fileOut,
-            "static unsigned int tag_tree_combination_ext_table\n");
-        fprintf(fileOut,
-            "    [TAG_TREE_EXT_ROW_COUNT]"
-            "[TAG_TREE_EXT_COLUMN_COUNT]"
-            " = {\n");
+        emit_extended_hash(fileOut,table_rows,table_columns);
     }
-
-    for (u = 0; u < table_rows; u++) {
-        unsigned j = 0;
-        const char *name = 0;
-        if (standard_flag) {
-            ta_get_TAG_name(u,&name);
-            fprintf(fileOut,"/* 0x%02x - %-37s*/\n",u, name);
-        } else {
-            unsigned k = tag_tree_combination_table[u][0];
-            ta_get_TAG_name(k,&name);
-            fprintf(fileOut,"/* 0x%02x - %-37s*/\n", k, name);
-        }
-        fprintf(fileOut,"    { ");
-        for (j = 0; j < table_columns; ++j ) {
-            fprintf(fileOut,"0x%08x,",
-                tag_tree_combination_table[u][j]);
-        }
-        fprintf(fileOut,"},\n");
-
-    }
-    fprintf(fileOut,"};\n");
     fprintf(fileOut,"\n/* END FILE */\n");
     fclose(fileInp);
     fclose(fileOut);
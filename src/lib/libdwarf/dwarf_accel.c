@@ -0,0 +1,1075 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it
+  and/or modify it under the terms of version 2.1 of the
+  GNU Lesser General Public License as published by the Free
+  Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General
+  Public License along with this program; if not, write the
+  Free Software Foundation, Inc., 51 Franklin Street - Fifth
+  Floor, Boston MA 02110-1301, USA.
+
+*/
+
+
+/*  One place to ask "which DIEs have this name" and
+    "which unit holds this address" without knowing
+    which accelerator sections the object has.
+    Names come from .debug_names when its tables
+    list every unit of .debug_info, otherwise from
+    the name index built from the DIEs
+    (dwarf_name_index()). Addresses come from
+    .debug_aranges when it mentions every unit
+    with code, otherwise from the address ranges
+    of the unit DIEs. Either way an address lookup
+    is a binary search of a sorted table built
+    once per Dwarf_Debug.
+    .gdb_index, .debug_gnu_pubnames and .debug_pubnames
+    are not used: they name units, not DIEs, and
+    are often incomplete. */
+
+#include <config.h>
+
+#include <stdlib.h> /* calloc() free() qsort() realloc() */
+#include <string.h> /* strcmp() */
+
+#if defined(_WIN32) && defined(HAVE_STDAFX_H)
+#include "stdafx.h"
+#endif /* HAVE_STDAFX_H */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "libdwarf_private.h"
+#include "dwarf_base_types.h"
+#include "dwarf_opaque.h"
+#include "dwarf_alloc.h"
+#include "dwarf_error.h"
+#include "dwarf_util.h"
+#include "dwarf_name_index.h" /* _dwarf_name_hash() */
+#include "dwarf_accel.h"
+
+/*  More DW_IDX values than any producer puts
+    in one .debug_names abbreviation. */
+#define DW_ACCEL_IDX_MAX 16
+
+/*  Where dwarf_accel_lookup_name() puts what it finds. */
+struct accel_matches_s {
+    Dwarf_Unsigned am_array_size;
+    Dwarf_Off     *am_die_offsets;
+    Dwarf_Bool    *am_is_info;
+    Dwarf_Half    *am_tags;
+    Dwarf_Unsigned am_count;
+};
+
+static void
+free_dnames(struct Dwarf_Accel_s *ac)
+{
+    Dwarf_Unsigned i = 0;
+
+    for (i = 0; i < ac->ac_dnames_count; ++i) {
+        dwarf_dealloc_dnames(ac->ac_dnames[i]);
+    }
+    free(ac->ac_dnames);
+    ac->ac_dnames = 0;
+    ac->ac_dnames_count = 0;
+}
+
+void
+_dwarf_destroy_accel(Dwarf_Debug dbg)
+{
+    struct Dwarf_Accel_s *ac = dbg->de_accel;
+
+    if (!ac) {
+        return;
+    }
+    free_dnames(ac);
+    free(ac->ac_units);
+    free(ac->ac_ranges);
+    free(ac);
+    dbg->de_accel = 0;
+}
+
+static int
+get_accel(Dwarf_Debug dbg,
+    struct Dwarf_Accel_s **ac_out,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Accel_s *ac = dbg->de_accel;
+
+    if (!ac) {
+        ac = (struct Dwarf_Accel_s *)calloc(1,
+            sizeof(struct Dwarf_Accel_s));
+        if (!ac) {
+            _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+                "DW_DLE_ALLOC_FAIL: allocating the "
+                "accelerator state");
+            return DW_DLV_ERROR;
+        }
+        ac->ac_dbg = dbg;
+        dbg->de_accel = ac;
+    }
+    *ac_out = ac;
+    return DW_DLV_OK;
+}
+
+static int
+add_unit(Dwarf_Debug dbg,
+    struct Dwarf_Accel_s *ac,
+    Dwarf_Off header_offset,
+    Dwarf_Off die_offset,
+    Dwarf_Bool has_code,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Accel_Unit_s *u = 0;
+
+    if (ac->ac_unit_count == ac->ac_unit_alloc) {
+        Dwarf_Unsigned newcount = ac->ac_unit_alloc?
+            ac->ac_unit_alloc*2:32;
+        struct Dwarf_Accel_Unit_s *newu =
+            (struct Dwarf_Accel_Unit_s *)realloc(ac->ac_units,
+            (size_t)newcount*sizeof(struct Dwarf_Accel_Unit_s));
+
+        if (!newu) {
+            _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+                "DW_DLE_ALLOC_FAIL: growing the "
+                "accelerator unit table");
+            return DW_DLV_ERROR;
+        }
+        ac->ac_units = newu;
+        ac->ac_unit_alloc = newcount;
+    }
+    u = ac->ac_units + ac->ac_unit_count;
+    u->au_header_offset = header_offset;
+    u->au_die_offset = die_offset;
+    u->au_has_code = has_code;
+    ac->ac_unit_count++;
+    return DW_DLV_OK;
+}
+
+static int
+unit_has_code(Dwarf_Die cu_die,
+    Dwarf_Bool *has_code,
+    Dwarf_Error *error)
+{
+    Dwarf_Bool has = FALSE;
+    int res = 0;
+
+    res = dwarf_hasattr(cu_die,DW_AT_high_pc,&has,error);
+    if (res == DW_DLV_OK && !has) {
+        res = dwarf_hasattr(cu_die,DW_AT_ranges,&has,error);
+    }
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    *has_code = has;
+    return DW_DLV_OK;
+}
+
+/*  Records every unit of .debug_info, walking the
+    units by offset so the caller's
+    dwarf_next_cu_header_e() position is untouched.
+    ac_units is in section order, so sorted both by
+    header offset and by unit DIE offset. */
+static int
+load_units(Dwarf_Debug dbg,
+    struct Dwarf_Accel_s *ac,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned offset = 0;
+    Dwarf_Unsigned section_size = 0;
+    int res = 0;
+
+    if (ac->ac_units_done) {
+        return DW_DLV_OK;
+    }
+    res = _dwarf_load_debug_info(dbg,error);
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    section_size = dbg->de_debug_info.dss_size;
+    while (offset < section_size) {
+        Dwarf_Off cu_die_offset = 0;
+        Dwarf_Die cu_die = 0;
+        Dwarf_Unsigned next = 0;
+        Dwarf_Bool has_code = FALSE;
+
+        res = dwarf_get_cu_die_offset_given_cu_header_offset_b(
+            dbg,offset,TRUE,&cu_die_offset,error);
+        if (res == DW_DLV_OK) {
+            res = dwarf_offdie_b(dbg,cu_die_offset,TRUE,
+                &cu_die,error);
+        }
+        if (res == DW_DLV_NO_ENTRY) {
+            break;
+        }
+        if (res == DW_DLV_OK) {
+            next = _dwarf_calculate_next_cu_context_offset(
+                cu_die->di_cu_context);
+            if (cu_die->di_cu_context->cc_unit_type ==
+                DW_UT_skeleton) {
+                ac->ac_has_skeleton = TRUE;
+            }
+            res = unit_has_code(cu_die,&has_code,error);
+            dwarf_dealloc_die(cu_die);
+        }
+        if (res == DW_DLV_OK) {
+            res = add_unit(dbg,ac,offset,cu_die_offset,
+                has_code,error);
+        }
+        if (res == DW_DLV_ERROR) {
+            return res;
+        }
+        if (next <= offset) {
+            break;
+        }
+        offset = next;
+    }
+    ac->ac_units_done = TRUE;
+    return DW_DLV_OK;
+}
+
+/*  Returns the ac_units index of the unit with
+    the given header (or, if by_die, unit DIE)
+    offset, or ac_unit_count if there is none. */
+static Dwarf_Unsigned
+find_unit(struct Dwarf_Accel_s *ac,
+    Dwarf_Off offset,
+    Dwarf_Bool by_die)
+{
+    Dwarf_Unsigned low = 0;
+    Dwarf_Unsigned high = ac->ac_unit_count;
+
+    while (low < high) {
+        Dwarf_Unsigned middle = low + (high - low)/2;
+        struct Dwarf_Accel_Unit_s *u = ac->ac_units + middle;
+        Dwarf_Off uoff = by_die? u->au_die_offset:
+            u->au_header_offset;
+
+        if (uoff == offset) {
+            return middle;
+        }
+        if (uoff < offset) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return ac->ac_unit_count;
+}
+
+static int
+add_dnames(Dwarf_Debug dbg,
+    struct Dwarf_Accel_s *ac,
+    Dwarf_Dnames_Head dn,
+    Dwarf_Error *error)
+{
+    Dwarf_Dnames_Head *newd = (Dwarf_Dnames_Head *)realloc(
+        ac->ac_dnames,
+        (size_t)(ac->ac_dnames_count+1)*sizeof(Dwarf_Dnames_Head));
+
+    if (!newd) {
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: recording a .debug_names table");
+        return DW_DLV_ERROR;
+    }
+    ac->ac_dnames = newd;
+    ac->ac_dnames[ac->ac_dnames_count] = dn;
+    ac->ac_dnames_count++;
+    return DW_DLV_OK;
+}
+
+/*  Marks in covered[] the units listed in the
+    "cu" and local "tu" tables of dn. Returns
+    DW_DLV_NO_ENTRY if the table lists a unit
+    not in .debug_info. */
+static int
+mark_dnames_units(struct Dwarf_Accel_s *ac,
+    Dwarf_Dnames_Head dn,
+    unsigned char *covered,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned cu_count = 0;
+    Dwarf_Unsigned tu_count = 0;
+    Dwarf_Unsigned i = 0;
+    int res = 0;
+
+    res = dwarf_dnames_sizes(dn,&cu_count,&tu_count,
+        0,0,0,0,0,0,0,0,0,0,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    for (i = 0; i < cu_count + tu_count; ++i) {
+        Dwarf_Unsigned offset = 0;
+        Dwarf_Sig8 sig;
+        Dwarf_Unsigned u = 0;
+
+        res = dwarf_dnames_cu_table(dn,i < cu_count?"cu":"tu",
+            i < cu_count? i: i - cu_count,&offset,&sig,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        u = find_unit(ac,offset,FALSE);
+        if (u == ac->ac_unit_count) {
+            return DW_DLV_NO_ENTRY;
+        }
+        covered[u] = 1;
+    }
+    return DW_DLV_OK;
+}
+
+/*  Opens the .debug_names tables and keeps them
+    if together they list every unit of .debug_info.
+    A missing, incomplete or unreadable section
+    is not an error: *usable is just left FALSE. */
+static int
+try_debug_names(Dwarf_Debug dbg,
+    struct Dwarf_Accel_s *ac,
+    Dwarf_Bool *usable,
+    Dwarf_Error *error)
+{
+    unsigned char *covered = 0;
+    Dwarf_Off offset = 0;
+    Dwarf_Error lerr = 0;
+    Dwarf_Bool complete = TRUE;
+    Dwarf_Unsigned i = 0;
+    int res = DW_DLV_OK;
+
+    *usable = FALSE;
+    if (!ac->ac_unit_count) {
+        return DW_DLV_OK;
+    }
+    covered = (unsigned char *)calloc(1,
+        (size_t)ac->ac_unit_count);
+    if (!covered) {
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: checking .debug_names coverage");
+        return DW_DLV_ERROR;
+    }
+    for (;;) {
+        Dwarf_Dnames_Head dn = 0;
+        Dwarf_Off next = 0;
+
+        res = dwarf_dnames_header(dbg,offset,&dn,&next,&lerr);
+        if (res == DW_DLV_NO_ENTRY) {
+            /*  The end of the section. */
+            res = DW_DLV_OK;
+            break;
+        }
+        if (res == DW_DLV_ERROR) {
+            break;
+        }
+        res = add_dnames(dbg,ac,dn,error);
+        if (res != DW_DLV_OK) {
+            dwarf_dealloc_dnames(dn);
+            free(covered);
+            free_dnames(ac);
+            return res;
+        }
+        res = mark_dnames_units(ac,dn,covered,&lerr);
+        if (res != DW_DLV_OK || next <= offset) {
+            break;
+        }
+        offset = next;
+    }
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(dbg,lerr);
+        complete = FALSE;
+    } else if (res == DW_DLV_NO_ENTRY || !ac->ac_dnames_count) {
+        /*  No tables, or one listing an unknown unit. */
+        complete = FALSE;
+    }
+    for (i = 0; complete && i < ac->ac_unit_count; ++i) {
+        if (!covered[i]) {
+            complete = FALSE;
+        }
+    }
+    free(covered);
+    if (!complete) {
+        free_dnames(ac);
+        return DW_DLV_OK;
+    }
+    *usable = TRUE;
+    return DW_DLV_OK;
+}
+
+static int
+choose_name_source(Dwarf_Debug dbg,
+    struct Dwarf_Accel_s *ac,
+    Dwarf_Error *error)
+{
+    Dwarf_Bool usable = FALSE;
+    Dwarf_Name_Index ni = 0;
+    int res = 0;
+
+    if (ac->ac_name_source) {
+        return DW_DLV_OK;
+    }
+    res = load_units(dbg,ac,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    /*  .debug_names cannot describe .debug_types,
+        and with skeleton units its DIE offsets are
+        in the split (.dwo) units, not this object. */
+    if (!ac->ac_has_skeleton && !dbg->de_debug_types.dss_size) {
+        res = try_debug_names(dbg,ac,&usable,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+    }
+    if (usable) {
+        ac->ac_name_source = DW_ACCEL_DEBUG_NAMES;
+        return DW_DLV_OK;
+    }
+    res = dwarf_name_index(dbg,&ni,0,error);
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    ac->ac_name_source = DW_ACCEL_DIES;
+    return DW_DLV_OK;
+}
+
+static void
+add_match(struct accel_matches_s *m,
+    Dwarf_Off die_offset,
+    Dwarf_Bool is_info,
+    Dwarf_Half tag)
+{
+    if (m->am_count < m->am_array_size) {
+        m->am_die_offsets[m->am_count] = die_offset;
+        if (m->am_is_info) {
+            m->am_is_info[m->am_count] = is_info;
+        }
+        if (m->am_tags) {
+            m->am_tags[m->am_count] = tag;
+        }
+    }
+    m->am_count++;
+}
+
+/*  Adds the DIEs of one .debug_names entry list,
+    the entries for one name. */
+static int
+dnames_entries(Dwarf_Dnames_Head dn,
+    Dwarf_Unsigned pool_offset,
+    Dwarf_Unsigned pool_size,
+    Dwarf_Unsigned local_tu_count,
+    struct accel_matches_s *m,
+    Dwarf_Error *error)
+{
+    Dwarf_Half     idx[DW_ACCEL_IDX_MAX];
+    Dwarf_Half     form[DW_ACCEL_IDX_MAX];
+    Dwarf_Unsigned val[DW_ACCEL_IDX_MAX];
+    Dwarf_Sig8     sig[DW_ACCEL_IDX_MAX];
+    int res = 0;
+
+    while (pool_offset < pool_size) {
+        Dwarf_Unsigned abbrev_code = 0;
+        Dwarf_Half     tag = 0;
+        Dwarf_Unsigned value_count = 0;
+        Dwarf_Unsigned abbrev_index = 0;
+        Dwarf_Unsigned values_offset = 0;
+        Dwarf_Unsigned next = 0;
+        Dwarf_Bool     single_cu = FALSE;
+        Dwarf_Unsigned single_cu_offset = 0;
+        Dwarf_Unsigned unit_offset = 0;
+        Dwarf_Unsigned die_offset = 0;
+        Dwarf_Bool     has_die = FALSE;
+        Dwarf_Bool     has_cu = FALSE;
+        Dwarf_Bool     has_tu = FALSE;
+        Dwarf_Unsigned cu_index = 0;
+        Dwarf_Unsigned tu_index = 0;
+        Dwarf_Unsigned i = 0;
+
+        /*  Abbreviation code zero, which ends the
+            list, has no abbreviation: NO_ENTRY. */
+        res = dwarf_dnames_entrypool(dn,pool_offset,
+            &abbrev_code,&tag,&value_count,&abbrev_index,
+            &values_offset,error);
+        if (res == DW_DLV_NO_ENTRY) {
+            return DW_DLV_OK;
+        }
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        res = dwarf_dnames_entrypool_values(dn,abbrev_index,
+            values_offset,DW_ACCEL_IDX_MAX,idx,form,val,sig,
+            &single_cu,&single_cu_offset,&next,error);
+        if (res == DW_DLV_NO_ENTRY) {
+            return DW_DLV_OK;
+        }
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        if (value_count > DW_ACCEL_IDX_MAX) {
+            value_count = DW_ACCEL_IDX_MAX;
+        }
+        for (i = 0; i < value_count; ++i) {
+            switch (idx[i]) {
+            case DW_IDX_compile_unit:
+                has_cu = TRUE;
+                cu_index = val[i];
+                break;
+            case DW_IDX_type_unit:
+                has_tu = TRUE;
+                tu_index = val[i];
+                break;
+            case DW_IDX_die_offset:
+                has_die = TRUE;
+                die_offset = val[i];
+                break;
+            default:
+                break;
+            }
+        }
+        if (has_die) {
+            Dwarf_Sig8 unused;
+            Dwarf_Bool local = TRUE;
+
+            res = DW_DLV_OK;
+            if (has_cu) {
+                res = dwarf_dnames_cu_table(dn,"cu",cu_index,
+                    &unit_offset,&unused,error);
+            } else if (has_tu && tu_index < local_tu_count) {
+                res = dwarf_dnames_cu_table(dn,"tu",tu_index,
+                    &unit_offset,&unused,error);
+            } else if (!has_tu && single_cu) {
+                unit_offset = single_cu_offset;
+            } else {
+                /*  A foreign type unit, in a .dwo. */
+                local = FALSE;
+            }
+            if (res == DW_DLV_ERROR) {
+                return res;
+            }
+            if (res == DW_DLV_OK && local) {
+                add_match(m,unit_offset + die_offset,TRUE,tag);
+            }
+        }
+        if (next <= pool_offset) {
+            break;
+        }
+        pool_offset = next;
+    }
+    return DW_DLV_OK;
+}
+
+static int
+dnames_lookup(Dwarf_Dnames_Head dn,
+    const char *name,
+    Dwarf_Unsigned hash,
+    struct accel_matches_s *m,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned local_tu_count = 0;
+    Dwarf_Unsigned bucket_count = 0;
+    Dwarf_Unsigned name_count = 0;
+    Dwarf_Unsigned pool_size = 0;
+    Dwarf_Unsigned first = 1;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Unsigned i = 0;
+    int res = 0;
+
+    res = dwarf_dnames_sizes(dn,0,&local_tu_count,0,
+        &bucket_count,&name_count,0,&pool_size,0,0,0,0,0,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (bucket_count) {
+        res = dwarf_dnames_bucket(dn,hash % bucket_count,
+            &first,&count,error);
+        if (res == DW_DLV_ERROR) {
+            return res;
+        }
+        if (res == DW_DLV_NO_ENTRY || !first) {
+            return DW_DLV_OK;
+        }
+    } else {
+        /*  No hash table: every name is a candidate. */
+        count = name_count;
+    }
+    for (i = first; i < first + count; ++i) {
+        Dwarf_Unsigned bucket = 0;
+        Dwarf_Unsigned name_hash = 0;
+        Dwarf_Unsigned str_offset = 0;
+        char          *str = 0;
+        Dwarf_Unsigned pool_offset = 0;
+        Dwarf_Unsigned abbrev_code = 0;
+        Dwarf_Half     tag = 0;
+        Dwarf_Unsigned attr_count = 0;
+
+        res = dwarf_dnames_name(dn,i,&bucket,&name_hash,
+            &str_offset,&str,&pool_offset,&abbrev_code,&tag,
+            0,0,0,&attr_count,error);
+        if (res == DW_DLV_ERROR) {
+            return res;
+        }
+        if (res == DW_DLV_NO_ENTRY) {
+            continue;
+        }
+        if (bucket_count && name_hash != hash) {
+            continue;
+        }
+        if (!str || strcmp(str,name)) {
+            continue;
+        }
+        res = dnames_entries(dn,pool_offset,pool_size,
+            local_tu_count,m,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+    }
+    return DW_DLV_OK;
+}
+
+static int
+dies_lookup(Dwarf_Debug dbg,
+    const char *name,
+    struct accel_matches_s *m,
+    Dwarf_Error *error)
+{
+    Dwarf_Name_Index ni = 0;
+    Dwarf_Unsigned first = 0;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Unsigned i = 0;
+    int res = 0;
+
+    res = dwarf_name_index(dbg,&ni,0,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_name_index_lookup(ni,name,&first,&count,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    for (i = first; i < first + count; ++i) {
+        Dwarf_Half tag = 0;
+        Dwarf_Off  die_offset = 0;
+        Dwarf_Bool is_info = FALSE;
+
+        res = dwarf_name_index_entry(ni,i,0,0,&tag,&die_offset,
+            &is_info,0,0,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        add_match(m,die_offset,is_info,tag);
+    }
+    return DW_DLV_OK;
+}
+
+static int
+add_range(Dwarf_Debug dbg,
+    struct Dwarf_Accel_s *ac,
+    Dwarf_Addr low,
+    Dwarf_Addr high,
+    Dwarf_Off cu_die_offset,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Accel_Range_s *r = 0;
+
+    if (low >= high) {
+        return DW_DLV_OK;
+    }
+    if (ac->ac_range_count == ac->ac_range_alloc) {
+        Dwarf_Unsigned newcount = ac->ac_range_alloc?
+            ac->ac_range_alloc*2:32;
+        struct Dwarf_Accel_Range_s *newr =
+            (struct Dwarf_Accel_Range_s *)realloc(ac->ac_ranges,
+            (size_t)newcount*sizeof(struct Dwarf_Accel_Range_s));
+
+        if (!newr) {
+            _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+                "DW_DLE_ALLOC_FAIL: growing the "
+                "accelerator address table");
+            return DW_DLV_ERROR;
+        }
+        ac->ac_ranges = newr;
+        ac->ac_range_alloc = newcount;
+    }
+    r = ac->ac_ranges + ac->ac_range_count;
+    r->ar_low = low;
+    r->ar_high = high;
+    r->ar_max_high = 0;
+    r->ar_cu_die_offset = cu_die_offset;
+    ac->ac_range_count++;
+    return DW_DLV_OK;
+}
+
+static void
+free_aranges(Dwarf_Debug dbg,
+    Dwarf_Arange *aranges,
+    Dwarf_Signed count)
+{
+    Dwarf_Signed i = 0;
+
+    for (i = 0; i < count; ++i) {
+        dwarf_dealloc(dbg,aranges[i],DW_DLA_ARANGE);
+    }
+    dwarf_dealloc(dbg,aranges,DW_DLA_LIST);
+}
+
+/*  Loads .debug_aranges into ac_ranges if it
+    names only real units and every unit with
+    code. Otherwise, or if the section is missing
+    or unreadable, ac_ranges is left empty and
+    *usable FALSE. */
+static int
+try_aranges(Dwarf_Debug dbg,
+    struct Dwarf_Accel_s *ac,
+    Dwarf_Bool *usable,
+    Dwarf_Error *error)
+{
+    Dwarf_Arange *aranges = 0;
+    Dwarf_Signed count = 0;
+    Dwarf_Signed i = 0;
+    Dwarf_Error lerr = 0;
+    unsigned char *covered = 0;
+    Dwarf_Bool complete = TRUE;
+    Dwarf_Unsigned u = 0;
+    int res = 0;
+
+    *usable = FALSE;
+    res = dwarf_get_aranges(dbg,&aranges,&count,&lerr);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(dbg,lerr);
+        return DW_DLV_OK;
+    }
+    if (res == DW_DLV_NO_ENTRY) {
+        return DW_DLV_OK;
+    }
+    covered = (unsigned char *)calloc(1,
+        (size_t)ac->ac_unit_count+1);
+    if (!covered) {
+        free_aranges(dbg,aranges,count);
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: checking .debug_aranges coverage");
+        return DW_DLV_ERROR;
+    }
+    for (i = 0; i < count && complete; ++i) {
+        Dwarf_Unsigned segment = 0;
+        Dwarf_Unsigned segment_entry_size = 0;
+        Dwarf_Addr     start = 0;
+        Dwarf_Unsigned length = 0;
+        Dwarf_Off      cu_die_offset = 0;
+
+        res = dwarf_get_arange_info_b(aranges[i],&segment,
+            &segment_entry_size,&start,&length,
+            &cu_die_offset,&lerr);
+        if (res == DW_DLV_ERROR) {
+            dwarf_dealloc_error(dbg,lerr);
+            lerr = 0;
+        }
+        if (res != DW_DLV_OK || segment_entry_size) {
+            /*  Segmented addresses are not handled. */
+            complete = FALSE;
+            break;
+        }
+        u = find_unit(ac,cu_die_offset,TRUE);
+        if (u == ac->ac_unit_count) {
+            complete = FALSE;
+            break;
+        }
+        covered[u] = 1;
+        if (length && start + length > start) {
+            res = add_range(dbg,ac,start,start+length,
+                cu_die_offset,error);
+            if (res != DW_DLV_OK) {
+                free(covered);
+                free_aranges(dbg,aranges,count);
+                return res;
+            }
+        }
+    }
+    free_aranges(dbg,aranges,count);
+    for (u = 0; complete && u < ac->ac_unit_count; ++u) {
+        if (ac->ac_units[u].au_has_code && !covered[u]) {
+            complete = FALSE;
+        }
+    }
+    free(covered);
+    if (!complete) {
+        ac->ac_range_count = 0;
+        return DW_DLV_OK;
+    }
+    *usable = TRUE;
+    return DW_DLV_OK;
+}
+
+/*  Fills ac_ranges from the DW_AT_low_pc/high_pc
+    or DW_AT_ranges of each unit DIE. A split unit
+    whose ranges need a .debug_addr this object
+    lacks (no tied file) is left out. */
+static int
+build_die_ranges(Dwarf_Debug dbg,
+    struct Dwarf_Accel_s *ac,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned u = 0;
+    int res = 0;
+
+    for (u = 0; u < ac->ac_unit_count; ++u) {
+        struct Dwarf_Accel_Unit_s *unit = ac->ac_units + u;
+        Dwarf_Die cu_die = 0;
+        Dwarf_Range_Iter iter;
+        Dwarf_Addr low = 0;
+        Dwarf_Addr high = 0;
+
+        if (!unit->au_has_code) {
+            continue;
+        }
+        res = dwarf_offdie_b(dbg,unit->au_die_offset,TRUE,
+            &cu_die,error);
+        if (res == DW_DLV_ERROR) {
+            return res;
+        }
+        if (res == DW_DLV_NO_ENTRY) {
+            continue;
+        }
+        res = dwarf_die_ranges_start(cu_die,&iter,error);
+        while (res == DW_DLV_OK) {
+            res = dwarf_die_ranges_next(&iter,&low,&high,error);
+            if (res == DW_DLV_OK) {
+                res = add_range(dbg,ac,low,high,
+                    unit->au_die_offset,error);
+            }
+        }
+        dwarf_dealloc_die(cu_die);
+        if (res == DW_DLV_ERROR && error &&
+            dwarf_errno(*error) ==
+            DW_DLE_MISSING_NEEDED_DEBUG_ADDR_SECTION) {
+            dwarf_dealloc_error(dbg,*error);
+            *error = 0;
+            continue;
+        }
+        if (res == DW_DLV_ERROR) {
+            return res;
+        }
+    }
+    return DW_DLV_OK;
+}
+
+static int
+range_compare(const void *l, const void *r)
+{
+    const struct Dwarf_Accel_Range_s *lp = l;
+    const struct Dwarf_Accel_Range_s *rp = r;
+
+    if (lp->ar_low < rp->ar_low) {
+        return -1;
+    }
+    if (lp->ar_low > rp->ar_low) {
+        return 1;
+    }
+    if (lp->ar_high < rp->ar_high) {
+        return -1;
+    }
+    if (lp->ar_high > rp->ar_high) {
+        return 1;
+    }
+    return 0;
+}
+
+static int
+choose_addr_source(Dwarf_Debug dbg,
+    struct Dwarf_Accel_s *ac,
+    Dwarf_Error *error)
+{
+    Dwarf_Bool usable = FALSE;
+    Dwarf_Addr max_high = 0;
+    Dwarf_Unsigned i = 0;
+    int res = 0;
+
+    if (ac->ac_addr_source) {
+        return DW_DLV_OK;
+    }
+    res = load_units(dbg,ac,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = try_aranges(dbg,ac,&usable,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (!usable) {
+        res = build_die_ranges(dbg,ac,error);
+        if (res != DW_DLV_OK) {
+            ac->ac_range_count = 0;
+            return res;
+        }
+    }
+    if (ac->ac_range_count) {
+        qsort(ac->ac_ranges,(size_t)ac->ac_range_count,
+            sizeof(struct Dwarf_Accel_Range_s),range_compare);
+    }
+    for (i = 0; i < ac->ac_range_count; ++i) {
+        struct Dwarf_Accel_Range_s *r = ac->ac_ranges + i;
+
+        if (r->ar_high > max_high) {
+            max_high = r->ar_high;
+        }
+        r->ar_max_high = max_high;
+    }
+    ac->ac_addr_source = usable? DW_ACCEL_ARANGES:DW_ACCEL_DIES;
+    return DW_DLV_OK;
+}
+
+int
+dwarf_accel_sources(Dwarf_Debug dbg,
+    int *name_source,
+    int *addr_source,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Accel_s *ac = 0;
+    int res = 0;
+
+    CHECK_DBG(dbg,error,"dwarf_accel_sources()");
+    res = get_accel(dbg,&ac,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (name_source) {
+        res = choose_name_source(dbg,ac,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        *name_source = ac->ac_name_source;
+    }
+    if (addr_source) {
+        res = choose_addr_source(dbg,ac,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        *addr_source = ac->ac_addr_source;
+    }
+    return DW_DLV_OK;
+}
+
+int
+dwarf_accel_lookup_name(Dwarf_Debug dbg,
+    const char     *name,
+    Dwarf_Unsigned  array_size,
+    Dwarf_Off      *die_offsets,
+    Dwarf_Bool     *is_info,
+    Dwarf_Half     *tags,
+    Dwarf_Unsigned *match_count,
+    Dwarf_Error    *error)
+{
+    struct Dwarf_Accel_s *ac = 0;
+    struct accel_matches_s m;
+    int res = 0;
+
+    CHECK_DBG(dbg,error,"dwarf_accel_lookup_name()");
+    if (!name || !match_count || (array_size && !die_offsets)) {
+        _dwarf_error_string(dbg,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_accel_lookup_name() passed a NULL pointer");
+        return DW_DLV_ERROR;
+    }
+    res = get_accel(dbg,&ac,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = choose_name_source(dbg,ac,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    m.am_array_size = array_size;
+    m.am_die_offsets = die_offsets;
+    m.am_is_info = is_info;
+    m.am_tags = tags;
+    m.am_count = 0;
+    if (ac->ac_name_source == DW_ACCEL_DEBUG_NAMES) {
+        Dwarf_Unsigned hash = _dwarf_name_hash(name);
+        Dwarf_Unsigned i = 0;
+
+        for (i = 0; i < ac->ac_dnames_count; ++i) {
+            res = dnames_lookup(ac->ac_dnames[i],name,hash,
+                &m,error);
+            if (res != DW_DLV_OK) {
+                return res;
+            }
+        }
+    } else {
+        res = dies_lookup(dbg,name,&m,error);
+        if (res == DW_DLV_ERROR) {
+            return res;
+        }
+    }
+    if (!m.am_count) {
+        return DW_DLV_NO_ENTRY;
+    }
+    *match_count = m.am_count;
+    return DW_DLV_OK;
+}
+
+int
+dwarf_accel_lookup_addr(Dwarf_Debug dbg,
+    Dwarf_Addr  pc,
+    Dwarf_Off  *cu_die_offset,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Accel_s *ac = 0;
+    Dwarf_Unsigned low = 0;
+    Dwarf_Unsigned high = 0;
+    int res = 0;
+
+    CHECK_DBG(dbg,error,"dwarf_accel_lookup_addr()");
+    if (!cu_die_offset) {
+        _dwarf_error_string(dbg,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_accel_lookup_addr() passed a NULL "
+            "cu_die_offset");
+        return DW_DLV_ERROR;
+    }
+    res = get_accel(dbg,&ac,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = choose_addr_source(dbg,ac,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    /*  The first range starting above pc. */
+    high = ac->ac_range_count;
+    while (low < high) {
+        Dwarf_Unsigned middle = low + (high - low)/2;
+
+        if (ac->ac_ranges[middle].ar_low <= pc) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    /*  Look back through the ranges starting at or
+        below pc for one still open at pc. */
+    while (low > 0) {
+        struct Dwarf_Accel_Range_s *r = ac->ac_ranges + low - 1;
+
+        if (r->ar_max_high <= pc) {
+            break;
+        }
+        if (pc < r->ar_high) {
+            *cu_die_offset = r->ar_cu_die_offset;
+            return DW_DLV_OK;
+        }
+        --low;
+    }
+    return DW_DLV_NO_ENTRY;
+}
@@ -0,0 +1,87 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it
+  and/or modify it under the terms of version 2.1 of the
+  GNU Lesser General Public License as published by the Free
+  Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General
+  Public License along with this program; if not, write the
+  Free Software Foundation, Inc., 51 Franklin Street - Fifth
+  Floor, Boston MA 02110-1301, USA.
+
+*/
+
+
+#ifndef DWARF_ACCEL_H
+#define DWARF_ACCEL_H
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*  One unit of .debug_info. au_has_code is set
+    if the unit DIE has DW_AT_high_pc or DW_AT_ranges,
+    so an address accelerator must mention it. */
+struct Dwarf_Accel_Unit_s {
+    Dwarf_Off  au_header_offset;
+    Dwarf_Off  au_die_offset;
+    Dwarf_Bool au_has_code;
+};
+
+/*  One address range of a unit. Sorted by ar_low.
+    ar_max_high is the largest ar_high of this and
+    all earlier ranges, so a search need only look
+    back while it is above the address. */
+struct Dwarf_Accel_Range_s {
+    Dwarf_Addr ar_low;
+    Dwarf_Addr ar_high;
+    Dwarf_Addr ar_max_high;
+    Dwarf_Off  ar_cu_die_offset;
+};
+
+/*  The lookup state of a Dwarf_Debug. The two
+    sides are chosen independently, on first use.
+    ac_name_source and ac_addr_source are zero
+    (DW_ACCEL_NONE) until chosen. */
+struct Dwarf_Accel_s {
+    Dwarf_Debug    ac_dbg;
+
+    Dwarf_Bool     ac_units_done;
+    /*  Some unit is a DW_UT_skeleton. */
+    Dwarf_Bool     ac_has_skeleton;
+    struct Dwarf_Accel_Unit_s *ac_units;
+    Dwarf_Unsigned ac_unit_count;
+    Dwarf_Unsigned ac_unit_alloc;
+
+    int            ac_name_source;
+    /*  The .debug_names tables, when those are
+        the name source. */
+    Dwarf_Dnames_Head *ac_dnames;
+    Dwarf_Unsigned ac_dnames_count;
+
+    int            ac_addr_source;
+    struct Dwarf_Accel_Range_s *ac_ranges;
+    Dwarf_Unsigned ac_range_count;
+    Dwarf_Unsigned ac_range_alloc;
+};
+
+void _dwarf_destroy_accel(Dwarf_Debug dbg);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* DWARF_ACCEL_H */
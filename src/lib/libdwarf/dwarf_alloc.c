@@ -71,6 +71,15 @@
 #include "dwarf_xu_index.h"
 #include "dwarf_macro5.h"
 #include "dwarf_debugnames.h"
+#include "dwarf_die_names.h"
+#include "dwarf_type_layout.h"
+#include "dwarf_line_index.h"
+#include "dwarf_unwind.h"
+#include "dwarf_expr_eval.h"
+#include "dwarf_var_index.h"
+#include "dwarf_name_index.h"
+#include "dwarf_accel.h"
+#include "dwarf_macro_state.h"
 #include "dwarf_rnglists.h"
 #include "dwarf_dsc.h"
 #include "dwarf_string.h"
@@ -114,16 +123,17 @@ struct Dwarf_Error_s _dwarf_failsafe_error = {
     1
 };
 
-/*  If non-zero (the default) de_alloc_tree (see dwarf_alloc.c)
-    is used normally.  If zero then dwarf allocations
+/*  If non-zero (the default) de_alloc_list and
+    de_alloc_tree (see dwarf_alloc.c)
+    are used normally.  If zero then dwarf allocations
     are not tracked by libdwarf and dwarf_finish() cannot
     clean up any per-Dwarf_Debug allocations the
     caller forgot to dealloc. */
 static signed char global_de_alloc_tree_on = 1;
 
 /*  Defined March 7 2020. Allows a caller to
-    avoid most tracking by the de_alloc_tree hash
-    table if called with v of zero.
+    avoid most tracking by the de_alloc_list
+    and de_alloc_tree if called with v of zero.
     Returns the value the flag was before this call. */
 int dwarf_set_de_alloc_flag(int v)
 {
@@ -152,14 +162,25 @@ _dwarf_error_destructor(void *m)
 
 /*  To do destructors we need some extra data in every
     _dwarf_get_alloc situation. */
-/* Here is the extra we malloc for a prefix. */
+/*  Here is the extra we malloc for a prefix.
+    Four pointers keeps the caller data as aligned
+    as malloc returned it. */
 struct reserve_size_s {
     void *dummy_rsv1;
     void *dummy_rsv2;
+    void *dummy_rsv3;
+    void *dummy_rsv4;
 };
-/* Here is how we use the extra prefix area. */
+/*  Here is how we use the extra prefix area.
+    rd_next and rd_prev link every tracked allocation
+    other than DW_DLA_STRING into the de_alloc_list of
+    rd_dbg, so tracking costs no search at all.
+    DW_DLA_STRING allocations go in de_alloc_tree
+    instead, see string_is_in_debug_section(). */
 struct reserve_data_s {
     void *rd_dbg;
+    struct reserve_data_s *rd_next;
+    struct reserve_data_s *rd_prev;
     /*  rd_length can only record correctly for short
         allocations, but that's not a problem im practice
         as the value is only for debugging and to
@@ -489,6 +510,14 @@ struct ial_s alloc_instance_basics[ALLOC_AREA_INDEX_TABLE_MAX] = {
 
     /* 0x41 65 DW_DLA_DEBUG_ADDR */
     {sizeof(struct Dwarf_Debug_Addr_Table_s),MULTIPLY_NO, 0,0},
+
+    /* 0x42 66 DW_DLA_DIE_FILTER */
+    {sizeof(struct Dwarf_Die_Filter_s),MULTIPLY_NO, 0,
+        _dwarf_die_filter_destructor},
+
+    /* 0x43 67 DW_DLA_UNWINDER */
+    {sizeof(struct Dwarf_Unwinder_s),MULTIPLY_NO, 0,
+        _dwarf_unwinder_destructor},
 };
 
 /*  We are simply using the incoming pointer as the key-pointer.
@@ -542,6 +571,56 @@ tdestroy_free_node(void *nodep)
     free(malloc_addr);
 }
 
+/*  Insert and remove for de_alloc_list. */
+static void
+alloc_list_insert(Dwarf_Debug dbg,struct reserve_data_s *r)
+{
+    struct reserve_data_s *head =
+        (struct reserve_data_s *)dbg->de_alloc_list;
+
+    r->rd_prev = 0;
+    r->rd_next = head;
+    if (head) {
+        head->rd_prev = r;
+    }
+    dbg->de_alloc_list = r;
+}
+
+/*  Does nothing for an allocation made while tracking
+    was off. */
+static void
+alloc_list_remove(Dwarf_Debug dbg,struct reserve_data_s *r)
+{
+    if (r->rd_prev) {
+        r->rd_prev->rd_next = r->rd_next;
+    } else if (dbg->de_alloc_list == r) {
+        dbg->de_alloc_list = r->rd_next;
+    } else {
+        return;
+    }
+    if (r->rd_next) {
+        r->rd_next->rd_prev = r->rd_prev;
+    }
+    r->rd_next = 0;
+    r->rd_prev = 0;
+}
+
+/*  Frees everything on de_alloc_list. A special
+    destructor may dwarf_dealloc() other records,
+    which just unlinks them, so take one record off
+    the head at a time. */
+static void
+alloc_list_free_all(Dwarf_Debug dbg)
+{
+    while (dbg->de_alloc_list) {
+        struct reserve_data_s *r =
+            (struct reserve_data_s *)dbg->de_alloc_list;
+
+        alloc_list_remove(dbg,r);
+        tdestroy_free_node((char *)r + DW_RESERVE);
+    }
+}
+
 /*  The sort of hash table entries result in very simple
     helper functions. */
 static int
@@ -631,7 +710,8 @@ _dwarf_get_alloc(Dwarf_Debug dbg,
         void *result = 0;
 
         memset(alloc_mem, 0, size);
-        /* We are not actually using rd_dbg, we are using rd_type. */
+        /*  rd_dbg names the de_alloc_list the record
+            is on. */
         r->rd_dbg = dbg;
         r->rd_type = (unsigned short)alloc_type;
         /*  The following is wrong for large records, but
@@ -662,7 +742,11 @@ _dwarf_get_alloc(Dwarf_Debug dbg,
         /*  As of March 14, 2020 it's
             not necessary to test for alloc type, but instead
             only call tsearch if de_alloc_tree_on. */
-        if (global_de_alloc_tree_on) {
+        if (!global_de_alloc_tree_on) {
+            /* Not tracked. */
+        } else if (alloc_type != DW_DLA_STRING) {
+            alloc_list_insert(dbg,r);
+        } else {
             result = dwarf_tsearch((void *)key,
                 &dbg->de_alloc_tree,simple_compare_function);
             if (!result) {
@@ -958,7 +1042,14 @@ dwarf_dealloc(Dwarf_Debug dbg,
     if (alloc_instance_basics[type].specialdestructor) {
         alloc_instance_basics[type].specialdestructor(space);
     }
-    if (dbg && dbg->de_alloc_tree) {
+    if (type != DW_DLA_STRING) {
+        /*  r->rd_dbg, not dbg, owns the list
+            (see the mixed up case above).
+            It is zero for a no-dbg error. */
+        if (r->rd_dbg) {
+            alloc_list_remove((Dwarf_Debug)r->rd_dbg,r);
+        }
+    } else if (dbg && dbg->de_alloc_tree) {
         /*  The 'space' pointer we get points after the
             reserve space.  The key is 'space'
             and address to free
@@ -1003,8 +1094,10 @@ _dwarf_get_debug(Dwarf_Unsigned filesize)
 
     if (global_de_alloc_tree_on) {
         /*  The type of the dwarf_initialize_search_hash
-            initial-size argument */
-        unsigned long size_est = (unsigned long)(filesize/30);
+            initial-size argument.  Only DW_DLA_STRING
+            allocations go in the tree, a few per
+            unit at most. */
+        unsigned long size_est = (unsigned long)(filesize/3000);
 
 #ifdef TESTINGHASHTAB
         printf("debugging: src filesize %lu hashtab init %lu\n",
@@ -1090,6 +1183,15 @@ _dwarf_free_all_of_one_debug(Dwarf_Debug dbg)
         fclose(dbg->de_printf_callback_null_device_handle);
         dbg->de_printf_callback_null_device_handle = 0;
     }
+    _dwarf_destroy_die_names(dbg);
+    _dwarf_destroy_type_layouts(dbg);
+    _dwarf_destroy_line_index(dbg);
+    _dwarf_destroy_fde_index(dbg);
+    _dwarf_destroy_var_indexes(dbg);
+    _dwarf_destroy_expr_programs(dbg);
+    _dwarf_destroy_name_index(dbg);
+    _dwarf_destroy_accel(dbg);
+    _dwarf_destroy_macro_states(dbg);
     freecontextlist(dbg,&dbg->de_info_reading);
     freecontextlist(dbg,&dbg->de_types_reading);
     /* Housecleaning done. Now really free all the space. */
@@ -1123,6 +1225,7 @@ _dwarf_free_all_of_one_debug(Dwarf_Debug dbg)
     malloc_section_free(&dbg->de_debug_rnglists);
     malloc_section_free(&dbg->de_gnu_debuglink);
     malloc_section_free(&dbg->de_note_gnu_buildid);
+    malloc_section_free(&dbg->de_gnu_debugaltlink);
     _dwarf_harmless_cleanout(&dbg->de_harmless_errors);
 
     _dwarf_dealloc_rnglists_context(dbg);
@@ -1133,14 +1236,15 @@ _dwarf_free_all_of_one_debug(Dwarf_Debug dbg)
     }
 
     _dwarf_destroy_group_map(dbg);
+    dbg->de_in_tdestroy = TRUE;
+    alloc_list_free_all(dbg);
     /*  de_alloc_tree might be NULL if
         global_de_alloc_tree_on is zero. */
     if (dbg->de_alloc_tree) {
-        dbg->de_in_tdestroy = TRUE;
         dwarf_tdestroy(dbg->de_alloc_tree,tdestroy_free_node);
-        dbg->de_in_tdestroy = FALSE;
         dbg->de_alloc_tree = 0;
     }
+    dbg->de_in_tdestroy = FALSE;
     _dwarf_free_static_errlist();
     /*  first, walk the search and free()
         contents. */
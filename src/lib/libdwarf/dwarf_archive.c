@@ -0,0 +1,578 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it
+  and/or modify it under the terms of version 2.1 of the
+  GNU Lesser General Public License as published by the Free
+  Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General
+  Public License along with this program; if not, write the
+  Free Software Foundation, Inc., 51 Franklin Street - Fifth
+  Floor, Boston MA 02110-1301, USA.
+
+*/
+
+
+
+/*  Reading the objects in a static (ar) archive
+    without extracting them.
+    dwarf_archive_open() reads the member headers
+    once, resolving GNU (//) and BSD (#1/) long names
+    and skipping the symbol index members. Each
+    member can then be opened as a Dwarf_Debug that
+    reads the archive fd at the member offset, much
+    as a Mach-O universal binary is read at the offset
+    of one of its objects. Only Elf members can be
+    opened so far. */
+
+#include <config.h>
+
+#include <stdlib.h> /* calloc() free() malloc() realloc() */
+#include <string.h> /* memcmp() memcpy() strdup() strlen() */
+
+#ifdef _WIN32
+#ifdef HAVE_STDAFX_H
+#include "stdafx.h"
+#endif /* HAVE_STDAFX_H */
+#include <io.h> /* close() off_t open() */
+#elif defined HAVE_UNISTD_H
+#include <unistd.h> /* close() off_t */
+#endif /* _WIN32 */
+
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h> /* open() O_RDONLY */
+#endif /* HAVE_FCNTL_H */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "libdwarf_private.h"
+#include "dwarf_base_types.h"
+#include "dwarf_opaque.h"
+#include "dwarf_error.h"
+#include "dwarf_string.h"
+#include "dwarf_object_detector.h"
+#include "dwarf_object_read_common.h" /* _dwarf_object_read_random() */
+#include "dwarf_archive.h"
+
+#ifndef O_BINARY
+#define O_BINARY 0
+#endif /* O_BINARY */
+#ifndef O_RDONLY
+#define O_RDONLY 0
+#endif /* O_RDONLY */
+#ifndef O_CLOEXEC
+#define O_CLOEXEC 0
+#endif /* O_CLOEXEC */
+
+/*  The fixed layout of an ar member header. */
+#define AR_MAGIC_SIZE    8
+#define AR_HEADER_SIZE   60
+#define AR_NAME_SIZE     16
+#define AR_SIZE_OFFSET   48
+#define AR_SIZE_SIZE     10
+#define AR_FMAG_OFFSET   58
+
+/*  Smaller members cannot be an object file. */
+#define AR_MEMBER_MIN_SIZE 64
+
+static int
+archive_error(Dwarf_Error *error,
+    const char *msg,
+    Dwarf_Unsigned offset)
+{
+    dwarfstring m;
+
+    dwarfstring_constructor(&m);
+    dwarfstring_append_printf_s(&m,
+        "DW_DLE_ARCHIVE_ERROR: %s",(char *)msg);
+    dwarfstring_append_printf_u(&m,
+        " at archive offset 0x%" DW_PR_XZEROS DW_PR_DUx,
+        offset);
+    _dwarf_error_string(NULL,error,DW_DLE_ARCHIVE_ERROR,
+        dwarfstring_string(&m));
+    dwarfstring_destructor(&m);
+    return DW_DLV_ERROR;
+}
+
+static int
+parse_decimal(const char *field, unsigned len,
+    Dwarf_Unsigned *value)
+{
+    Dwarf_Unsigned v = 0;
+    unsigned i = 0;
+
+    for ( ; i < len && field[i] != ' '; ++i) {
+        unsigned char c = (unsigned char)field[i];
+
+        if (c < '0' || c > '9') {
+            return DW_DLV_ERROR;
+        }
+        if (v > (~(Dwarf_Unsigned)0)/10 - 10) {
+            return DW_DLV_ERROR;
+        }
+        v = v*10 + (c - '0');
+    }
+    if (!i) {
+        return DW_DLV_ERROR;
+    }
+    for ( ; i < len; ++i) {
+        if (field[i] != ' ') {
+            return DW_DLV_ERROR;
+        }
+    }
+    *value = v;
+    return DW_DLV_OK;
+}
+
+/*  The length of a space-padded ar name field. */
+static unsigned
+field_length(const char *field, unsigned len)
+{
+    while (len && field[len-1] == ' ') {
+        --len;
+    }
+    return len;
+}
+
+static void
+free_archive(struct Dwarf_Archive_s *ar)
+{
+    Dwarf_Unsigned i = 0;
+
+    for ( ; i < ar->ar_member_count; ++i) {
+        free(ar->ar_members[i].am_name);
+    }
+    free(ar->ar_members);
+    free(ar->ar_path);
+    if (ar->ar_fd >= 0) {
+        close(ar->ar_fd);
+    }
+    free(ar);
+}
+
+static int
+add_member(struct Dwarf_Archive_s *ar,
+    const char *name, Dwarf_Unsigned namelen,
+    Dwarf_Unsigned offset, Dwarf_Unsigned size)
+{
+    struct Dwarf_Archive_Member_s *m = 0;
+    char *copy = 0;
+
+    if (ar->ar_member_count == ar->ar_member_alloc) {
+        Dwarf_Unsigned n = ar->ar_member_alloc?
+            ar->ar_member_alloc*2:32;
+        struct Dwarf_Archive_Member_s *grown =
+            (struct Dwarf_Archive_Member_s *)realloc(
+            ar->ar_members,(size_t)n*sizeof(*grown));
+
+        if (!grown) {
+            return DW_DLV_ERROR;
+        }
+        ar->ar_members = grown;
+        ar->ar_member_alloc = n;
+    }
+    copy = (char *)malloc((size_t)namelen+1);
+    if (!copy) {
+        return DW_DLV_ERROR;
+    }
+    memcpy(copy,name,(size_t)namelen);
+    copy[namelen] = 0;
+    m = ar->ar_members + ar->ar_member_count;
+    m->am_name = copy;
+    m->am_offset = offset;
+    m->am_size = size;
+    m->am_ftype = DW_FTYPE_UNKNOWN;
+    m->am_endian = 0;
+    m->am_offsetsize = 0;
+    if (size >= AR_MEMBER_MIN_SIZE) {
+        unsigned ftype = 0;
+        unsigned endian = 0;
+        unsigned offsetsize = 0;
+        Dwarf_Unsigned ignored_size = 0;
+        int errcode = 0;
+        int res = 0;
+
+        /*  A member we cannot identify is listed
+            but cannot be opened. */
+        res = _dwarf_object_detector_fd_a(ar->ar_fd,
+            &ftype,&endian,&offsetsize,offset,
+            &ignored_size,&errcode);
+        if (res == DW_DLV_OK) {
+            m->am_ftype = ftype;
+            m->am_endian = endian;
+            m->am_offsetsize = offsetsize;
+        }
+    }
+    ++ar->ar_member_count;
+    return DW_DLV_OK;
+}
+
+/*  A GNU long name: "/123" is offset 123 in the //
+    member, where names end with "/\n". */
+static int
+long_name(const char *long_names,
+    Dwarf_Unsigned long_names_size,
+    const char *field, unsigned fieldlen,
+    const char **name, Dwarf_Unsigned *namelen)
+{
+    Dwarf_Unsigned start = 0;
+    Dwarf_Unsigned end = 0;
+
+    if (!long_names ||
+        parse_decimal(field,fieldlen,&start) != DW_DLV_OK ||
+        start >= long_names_size) {
+        return DW_DLV_ERROR;
+    }
+    for (end = start; end < long_names_size &&
+        long_names[end] != '\n'; ++end) {
+    }
+    if (end > start && long_names[end-1] == '/') {
+        --end;
+    }
+    *name = long_names + start;
+    *namelen = end - start;
+    return DW_DLV_OK;
+}
+
+static int
+read_members(struct Dwarf_Archive_s *ar,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned offset = AR_MAGIC_SIZE;
+    char *long_names = 0;
+    Dwarf_Unsigned long_names_size = 0;
+    int res = DW_DLV_OK;
+
+    while (res == DW_DLV_OK && offset < ar->ar_filesize) {
+        char hdr[AR_HEADER_SIZE];
+        Dwarf_Unsigned size = 0;
+        Dwarf_Unsigned data = offset + AR_HEADER_SIZE;
+        Dwarf_Unsigned next = 0;
+        const char *name = hdr;
+        Dwarf_Unsigned namelen = 0;
+        char *bsdname = 0;
+        Dwarf_Bool is_member = TRUE;
+        int errcode = 0;
+
+        if (ar->ar_filesize - offset < AR_HEADER_SIZE) {
+            res = archive_error(error,
+                "truncated member header",offset);
+            break;
+        }
+        res = _dwarf_object_read_random(ar->ar_fd,hdr,
+            (off_t)offset,AR_HEADER_SIZE,
+            (off_t)ar->ar_filesize,&errcode);
+        if (res != DW_DLV_OK) {
+            _dwarf_error(NULL,error,errcode);
+            break;
+        }
+        if (hdr[AR_FMAG_OFFSET] != '`' ||
+            hdr[AR_FMAG_OFFSET+1] != '\n' ||
+            parse_decimal(hdr+AR_SIZE_OFFSET,AR_SIZE_SIZE,
+                &size) != DW_DLV_OK) {
+            res = archive_error(error,
+                "bad member header",offset);
+            break;
+        }
+        if (size > ar->ar_filesize - data) {
+            res = archive_error(error,
+                "member size runs past the end",offset);
+            break;
+        }
+        next = data + size;
+        next += next&1;
+        namelen = field_length(hdr,AR_NAME_SIZE);
+        if (namelen > 3 && !memcmp(hdr,"#1/",3)) {
+            /*  BSD: the name follows the header
+                and is counted in the size. */
+            Dwarf_Unsigned bsdlen = 0;
+
+            if (parse_decimal(hdr+3,(unsigned)namelen-3,
+                &bsdlen) != DW_DLV_OK || bsdlen > size) {
+                res = archive_error(error,
+                    "bad BSD member name length",offset);
+                break;
+            }
+            bsdname = (char *)malloc((size_t)bsdlen+1);
+            if (!bsdname) {
+                _dwarf_error(NULL,error,DW_DLE_ALLOC_FAIL);
+                res = DW_DLV_ERROR;
+                break;
+            }
+            if (bsdlen) {
+                res = _dwarf_object_read_random(ar->ar_fd,
+                    bsdname,(off_t)data,(size_t)bsdlen,
+                    (off_t)ar->ar_filesize,&errcode);
+                if (res != DW_DLV_OK) {
+                    free(bsdname);
+                    _dwarf_error(NULL,error,errcode);
+                    break;
+                }
+            }
+            bsdname[bsdlen] = 0;
+            /*  The name may be padded with NULs. */
+            name = bsdname;
+            namelen = strlen(bsdname);
+            data += bsdlen;
+            size -= bsdlen;
+        } else if ((namelen == 1 && hdr[0] == '/') ||
+            (namelen == 7 && !memcmp(hdr,"/SYM64/",7))) {
+            /*  The GNU symbol index. */
+            is_member = FALSE;
+        } else if (namelen == 2 && !memcmp(hdr,"//",2)) {
+            free(long_names);
+            long_names = 0;
+            long_names_size = 0;
+            is_member = FALSE;
+            if (size) {
+                long_names = (char *)malloc((size_t)size);
+                if (!long_names) {
+                    _dwarf_error(NULL,error,DW_DLE_ALLOC_FAIL);
+                    res = DW_DLV_ERROR;
+                    break;
+                }
+                res = _dwarf_object_read_random(ar->ar_fd,
+                    long_names,(off_t)data,(size_t)size,
+                    (off_t)ar->ar_filesize,&errcode);
+                if (res != DW_DLV_OK) {
+                    _dwarf_error(NULL,error,errcode);
+                    break;
+                }
+                long_names_size = size;
+            }
+        } else if (namelen > 1 && hdr[0] == '/') {
+            if (long_name(long_names,long_names_size,
+                hdr+1,(unsigned)namelen-1,
+                &name,&namelen) != DW_DLV_OK) {
+                res = archive_error(error,
+                    "bad long member name",offset);
+                break;
+            }
+        } else if (namelen && hdr[namelen-1] == '/') {
+            /*  GNU ends short names with a slash. */
+            --namelen;
+        }
+        if (namelen >= 9 && !memcmp(name,"__.SYMDEF",9)) {
+            /*  The BSD symbol index. */
+            is_member = FALSE;
+        }
+        if (is_member) {
+            res = add_member(ar,name,namelen,data,size);
+            if (res != DW_DLV_OK) {
+                _dwarf_error(NULL,error,DW_DLE_ALLOC_FAIL);
+            }
+        }
+        free(bsdname);
+        offset = next;
+    }
+    free(long_names);
+    return res;
+}
+
+int
+dwarf_archive_open(const char *path,
+    Dwarf_Archive  *archive_out,
+    Dwarf_Unsigned *member_count,
+    Dwarf_Error    *error)
+{
+    struct Dwarf_Archive_s *ar = 0;
+    unsigned ftype = 0;
+    unsigned endian = 0;
+    unsigned offsetsize = 0;
+    Dwarf_Unsigned filesize = 0;
+    int errcode = 0;
+    int res = 0;
+
+    if (!path || !archive_out) {
+        _dwarf_error_string(NULL,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_archive_open() needs a path and "
+            "a place to return the archive");
+        return DW_DLV_ERROR;
+    }
+    ar = (struct Dwarf_Archive_s *)calloc(1,sizeof(*ar));
+    if (!ar) {
+        _dwarf_error(NULL,error,DW_DLE_ALLOC_FAIL);
+        return DW_DLV_ERROR;
+    }
+    ar->ar_fd = open(path,O_RDONLY|O_BINARY|O_CLOEXEC);
+    if (ar->ar_fd < 0) {
+        free(ar);
+        _dwarf_error(NULL,error,DW_DLE_FILE_UNAVAILABLE);
+        return DW_DLV_ERROR;
+    }
+    res = dwarf_object_detector_fd(ar->ar_fd,&ftype,&endian,
+        &offsetsize,&filesize,&errcode);
+    if (res != DW_DLV_OK || ftype != DW_FTYPE_ARCHIVE) {
+        free_archive(ar);
+        if (res == DW_DLV_ERROR) {
+            _dwarf_error(NULL,error,errcode);
+            return res;
+        }
+        return DW_DLV_NO_ENTRY;
+    }
+    ar->ar_filesize = filesize;
+    ar->ar_path = strdup(path);
+    if (!ar->ar_path) {
+        free_archive(ar);
+        _dwarf_error(NULL,error,DW_DLE_ALLOC_FAIL);
+        return DW_DLV_ERROR;
+    }
+    res = read_members(ar,error);
+    if (res != DW_DLV_OK) {
+        free_archive(ar);
+        return res;
+    }
+    *archive_out = ar;
+    if (member_count) {
+        *member_count = ar->ar_member_count;
+    }
+    return DW_DLV_OK;
+}
+
+static int
+check_member_index(Dwarf_Archive ar,
+    Dwarf_Unsigned index,
+    const char *function,
+    Dwarf_Error *error)
+{
+    dwarfstring m;
+
+    if (!ar) {
+        _dwarf_error_string(NULL,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "a NULL Dwarf_Archive");
+        return DW_DLV_ERROR;
+    }
+    if (index < ar->ar_member_count) {
+        return DW_DLV_OK;
+    }
+    dwarfstring_constructor(&m);
+    dwarfstring_append_printf_s(&m,
+        "DW_DLE_ARCHIVE_ERROR: %s ",(char *)function);
+    dwarfstring_append_printf_u(&m,
+        "passed member index %u, ",index);
+    dwarfstring_append_printf_u(&m,
+        "the archive has %u members",ar->ar_member_count);
+    _dwarf_error_string(NULL,error,DW_DLE_ARCHIVE_ERROR,
+        dwarfstring_string(&m));
+    dwarfstring_destructor(&m);
+    return DW_DLV_ERROR;
+}
+
+int
+dwarf_archive_member(Dwarf_Archive ar,
+    Dwarf_Unsigned  index,
+    const char    **name,
+    Dwarf_Unsigned *offset,
+    Dwarf_Unsigned *size,
+    unsigned int   *ftype,
+    Dwarf_Error    *error)
+{
+    struct Dwarf_Archive_Member_s *m = 0;
+    int res = 0;
+
+    res = check_member_index(ar,index,
+        "dwarf_archive_member()",error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    m = ar->ar_members + index;
+    if (name) {
+        *name = m->am_name;
+    }
+    if (offset) {
+        *offset = m->am_offset;
+    }
+    if (size) {
+        *size = m->am_size;
+    }
+    if (ftype) {
+        *ftype = m->am_ftype;
+    }
+    return DW_DLV_OK;
+}
+
+int
+dwarf_archive_init_member(Dwarf_Archive ar,
+    Dwarf_Unsigned  index,
+    unsigned int    groupnumber,
+    Dwarf_Handler   errhand,
+    Dwarf_Ptr       errarg,
+    Dwarf_Debug    *ret_dbg,
+    Dwarf_Error    *error)
+{
+    struct Dwarf_Archive_Member_s *m = 0;
+    Dwarf_Debug dbg = 0;
+    dwarfstring path;
+    int res = 0;
+
+    if (!ret_dbg) {
+        DWARF_DBG_ERROR(NULL,DW_DLE_DWARF_INIT_DBG_NULL,
+            DW_DLV_ERROR);
+    }
+    *ret_dbg = 0;
+    res = check_member_index(ar,index,
+        "dwarf_archive_init_member()",error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    m = ar->ar_members + index;
+    if (m->am_ftype == DW_FTYPE_UNKNOWN) {
+        return DW_DLV_NO_ENTRY;
+    }
+    if (m->am_ftype != DW_FTYPE_ELF) {
+        DWARF_DBG_ERROR(NULL,DW_DLE_FILE_WRONG_TYPE,
+            DW_DLV_ERROR);
+    }
+    /*  Named as ar(1) and the linkers name members. */
+    dwarfstring_constructor(&path);
+    dwarfstring_append(&path,ar->ar_path);
+    dwarfstring_append(&path,"(");
+    dwarfstring_append(&path,m->am_name);
+    dwarfstring_append(&path,")");
+    res = _dwarf_elf_nlsetup_a(ar->ar_fd,
+        dwarfstring_string(&path),
+        m->am_ftype,m->am_endian,m->am_offsetsize,
+        m->am_offset,(size_t)m->am_size,
+        groupnumber,0,0,errhand,errarg,&dbg,error);
+    if (res != DW_DLV_OK) {
+        dwarfstring_destructor(&path);
+        return res;
+    }
+    /*  The archive owns the fd: dwarf_finish()
+        must not close it. */
+    dbg->de_path = strdup(dwarfstring_string(&path));
+    dwarfstring_destructor(&path);
+    dbg->de_fd = ar->ar_fd;
+    dbg->de_owns_fd = FALSE;
+    dbg->de_ftype = (Dwarf_Small)m->am_ftype;
+    dbg->de_obj_ub_offset = m->am_offset;
+    *ret_dbg = dbg;
+    return DW_DLV_OK;
+}
+
+void
+dwarf_archive_close(Dwarf_Archive ar)
+{
+    if (!ar) {
+        return;
+    }
+    free_archive(ar);
+}
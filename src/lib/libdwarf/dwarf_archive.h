@@ -0,0 +1,65 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it
+  and/or modify it under the terms of version 2.1 of the
+  GNU Lesser General Public License as published by the Free
+  Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General
+  Public License along with this program; if not, write the
+  Free Software Foundation, Inc., 51 Franklin Street - Fifth
+  Floor, Boston MA 02110-1301, USA.
+
+*/
+
+
+#ifndef DWARF_ARCHIVE_H
+#define DWARF_ARCHIVE_H
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*  One object in a static archive. am_offset is the
+    file offset of the member data, past its ar header
+    (and past a BSD #1/ name). am_ftype is DW_FTYPE_ELF
+    etc, or DW_FTYPE_UNKNOWN. */
+struct Dwarf_Archive_Member_s {
+    char          *am_name;
+    Dwarf_Unsigned am_offset;
+    Dwarf_Unsigned am_size;
+    unsigned       am_ftype;
+    unsigned       am_endian;
+    unsigned       am_offsetsize;
+};
+
+/*  Built by dwarf_archive_open() and not changed
+    after, so any number of threads may open members
+    at once. Every member Dwarf_Debug reads through
+    ar_fd; only dwarf_archive_close() closes it. */
+struct Dwarf_Archive_s {
+    int            ar_fd;
+    char          *ar_path;
+    Dwarf_Unsigned ar_filesize;
+    struct Dwarf_Archive_Member_s *ar_members;
+    Dwarf_Unsigned ar_member_count;
+    Dwarf_Unsigned ar_member_alloc;
+};
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* DWARF_ARCHIVE_H */
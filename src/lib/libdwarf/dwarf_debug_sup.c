@@ -205,3 +205,42 @@ dwarf_get_debug_sup(Dwarf_Debug dbg,
     }
     return DW_DLV_OK;
 }
+
+/*  supdbg is the supplementary object file
+    (named by .debug_sup or .gnu_debugaltlink,
+    see dwarf_get_sup_paths()) that the
+    DW_FORM_strp_sup, DW_FORM_ref_sup4/8
+    and GNU _alt forms of dbg refer to.
+    supdbg is not owned by dbg: the caller
+    may set the same supdbg on several dbg
+    and must call dwarf_finish(supdbg) after
+    finishing all of them.
+    Allows setting to NULL (the default). */
+int
+dwarf_set_sup_dbg(Dwarf_Debug dbg,
+    Dwarf_Debug supdbg,
+    Dwarf_Error*error)
+{
+    CHECK_DBG(dbg,error,"dwarf_set_sup_dbg()");
+    if (supdbg) {
+        CHECK_DBG(supdbg,error,"dwarf_set_sup_dbg()");
+    }
+    if (supdbg == dbg) {
+        _dwarf_error_string(dbg,error,DW_DLE_DEBUG_SUP_ERROR,
+            "DW_DLE_DEBUG_SUP_ERROR: a Dwarf_Debug cannot be "
+            "its own supplementary object");
+        return DW_DLV_ERROR;
+    }
+    dbg->de_sup_object = supdbg;
+    return DW_DLV_OK;
+}
+
+int
+dwarf_get_sup_dbg(Dwarf_Debug dbg,
+    Dwarf_Debug *supdbg_out,
+    Dwarf_Error*error)
+{
+    CHECK_DBG(dbg,error,"dwarf_get_sup_dbg()");
+    *supdbg_out = dbg->de_sup_object;
+    return DW_DLV_OK;
+}
@@ -573,6 +573,62 @@ _dwarf_do_buildid_setup(unsigned buildid_length,
     return DW_DLV_OK;
 }
 
+/*  Now malloc space for the pointer array
+    and the strings they point at so a simple
+    free by our caller will clean up
+    everything.  Copy the data from
+    base_dwlist to the new area. */
+static int
+pack_path_list(struct dwarfstring_list_s *base_dwlist,
+    char        ***paths_out,
+    unsigned      *paths_out_length,
+    int           *errcode)
+{
+    struct dwarfstring_list_s *cur = 0;
+    char        **resultfullstring = 0;
+    unsigned long count = 0;
+    size_t        pointerarraysize = 0;
+    size_t        sumstringlengths = 0;
+    size_t        totalareasize = 0;
+    size_t        setptrindex = 0;
+    size_t        setstrindex = 0;
+
+    cur = base_dwlist;
+    for ( ; cur ; cur = cur->dl_next) {
+        ++count;
+        pointerarraysize += sizeof(void *);
+        sumstringlengths +=
+            dwarfstring_strlen(&cur->dl_string) +1;
+    }
+    /*  Make a final null pointer in the pointer array. */
+    pointerarraysize += sizeof(void *);
+    totalareasize = pointerarraysize + sumstringlengths +8;
+    resultfullstring = (char **)malloc(totalareasize);
+    setstrindex = pointerarraysize;
+    if (!resultfullstring) {
+        *errcode = DW_DLE_ALLOC_FAIL;
+        return DW_DLV_ERROR;
+    }
+    memset(resultfullstring,0,totalareasize);
+    cur = base_dwlist;
+
+    for ( ; cur ; cur = cur->dl_next,++setptrindex) {
+        char **iptr = (char **)((char *)resultfullstring +
+            setptrindex*sizeof(void *));
+        char *sptr = (char*)resultfullstring + setstrindex;
+        char *msg = dwarfstring_string(&cur->dl_string);
+        size_t slen = dwarfstring_strlen(&cur->dl_string);
+
+        _dwarf_safe_strcpy(sptr,totalareasize - setstrindex,
+            msg,slen);
+        setstrindex += slen +1;
+        *iptr = sptr;
+    }
+    *paths_out = resultfullstring;
+    *paths_out_length = count;
+    return DW_DLV_OK;
+}
+
 /*  New September 2019.  Access to the GNU section named
     .gnu_debuglink
     See
@@ -708,56 +764,12 @@ _dwarf_construct_linkedto_path(
         return res;
     }
 
-    /*  Now malloc space for the pointer array
-        and the strings they point at so a simple
-        free by our caller will clean up
-        everything.  Copy the data from
-        base_dwlist to the new area. */
-    {
-        struct dwarfstring_list_s *cur = 0;
-        char        **resultfullstring = 0;
-        unsigned long count = 0;
-        size_t        pointerarraysize = 0;
-        size_t        sumstringlengths = 0;
-        size_t        totalareasize = 0;
-        size_t        setptrindex = 0;
-        size_t        setstrindex = 0;
-
-        cur = &base_dwlist;
-        for ( ; cur ; cur = cur->dl_next) {
-            ++count;
-            pointerarraysize += sizeof(void *);
-            sumstringlengths +=
-                dwarfstring_strlen(&cur->dl_string) +1;
-        }
-        /*  Make a final null pointer in the pointer array. */
-        pointerarraysize += sizeof(void *);
-        totalareasize = pointerarraysize + sumstringlengths +8;
-        resultfullstring = (char **)malloc(totalareasize);
-        setstrindex = pointerarraysize;
-        if (!resultfullstring) {
-            dwarfstring_list_destructor(&base_dwlist);
-            destruct_js(&joind);
-            *errcode = DW_DLE_ALLOC_FAIL;
-            return DW_DLV_ERROR;
-        }
-        memset(resultfullstring,0,totalareasize);
-        cur = &base_dwlist;
-
-        for ( ; cur ; cur = cur->dl_next,++setptrindex) {
-            char **iptr = (char **)((char *)resultfullstring +
-                setptrindex*sizeof(void *));
-            char *sptr = (char*)resultfullstring + setstrindex;
-            char *msg = dwarfstring_string(&cur->dl_string);
-            size_t slen = dwarfstring_strlen(&cur->dl_string);
-
-            _dwarf_safe_strcpy(sptr,totalareasize - setstrindex,
-                msg,slen);
-            setstrindex += slen +1;
-            *iptr = sptr;
-        }
-        *paths_out = resultfullstring;
-        *paths_out_length = count;
+    res = pack_path_list(&base_dwlist,paths_out,
+        paths_out_length,errcode);
+    if (res == DW_DLV_ERROR) {
+        dwarfstring_list_destructor(&base_dwlist);
+        destruct_js(&joind);
+        return res;
     }
     dwarfstring_list_destructor(&base_dwlist);
     destruct_js(&joind);
@@ -1061,6 +1073,184 @@ dwarf_gnu_debuglink(Dwarf_Debug dbg,
     return DW_DLV_OK;
 }
 
+/*  The GNU dwz section .gnu_debugaltlink is
+    the NUL-terminated path of the supplementary
+    (alt) file followed by its build-id. */
+static int
+_dwarf_extract_debugaltlink(Dwarf_Debug dbg,
+    char          **name_returned,
+    Dwarf_Small   **id_returned,
+    Dwarf_Unsigned *id_length_returned,
+    Dwarf_Error    *error)
+{
+    struct Dwarf_Section_s *paltlink = &dbg->de_gnu_debugaltlink;
+    Dwarf_Small *ptr = 0;
+    Dwarf_Small *endptr = 0;
+    size_t       namelenszt = 0;
+    int          res = 0;
+
+    if (!paltlink->dss_size) {
+        return DW_DLV_NO_ENTRY;
+    }
+    res = _dwarf_load_section(dbg,paltlink,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    ptr = paltlink->dss_data;
+    endptr = ptr + paltlink->dss_size;
+    res = _dwarf_check_string_valid(dbg,ptr,
+        ptr, endptr,  DW_DLE_FORM_STRING_BAD_STRING,
+        error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    namelenszt = strlen((const char*)ptr);
+    *name_returned = (char *)ptr;
+    *id_returned = ptr + namelenszt + 1;
+    *id_length_returned = (Dwarf_Unsigned)(endptr -
+        (ptr + namelenszt + 1));
+    return DW_DLV_OK;
+}
+
+static int
+build_sup_path_list(Dwarf_Debug dbg,
+    char          *name,
+    Dwarf_Small   *id,
+    Dwarf_Unsigned idlen,
+    struct dwarfstring_list_s  *base_dwlist,
+    struct dwarfstring_list_s **last_entry,
+    int           *errcode)
+{
+    unsigned       global_prefix_number = 0;
+    int            res = DW_DLV_OK;
+    dwarfstring    tmp;
+    dwarfstring    linkname;
+    struct dwarfstring_list_s *now_last = 0;
+
+    dwarfstring_constructor(&tmp);
+    dwarfstring_constructor(&linkname);
+    if (name[0]) {
+        if (!is_full_path(name) && dbg->de_path) {
+            size_t dirlen = mydirlen((char *)dbg->de_path);
+
+            if (dirlen) {
+                dwarfstring_append_length(&tmp,
+                    (char *)dbg->de_path,dirlen);
+            }
+        }
+        dwarfstring_append(&linkname,name);
+        _dwarf_pathjoinl(&tmp,&linkname);
+        res = dwarfstring_list_add_new(base_dwlist,
+            *last_entry,&tmp,&now_last,errcode);
+        if (res == DW_DLV_OK) {
+            *last_entry = now_last;
+        }
+    }
+    if (idlen && res == DW_DLV_OK) {
+        dwarfstring_reset(&linkname);
+        build_buildid_filename(&linkname,
+            (unsigned)idlen,id);
+        for ( ; global_prefix_number <
+            dbg->de_gnu_global_path_count;
+            ++global_prefix_number) {
+            dwarfstring_reset(&tmp);
+            dwarfstring_append(&tmp,(char *)
+                dbg->de_gnu_global_paths[global_prefix_number]);
+            _dwarf_pathjoinl(&tmp,&linkname);
+            res = dwarfstring_list_add_new(base_dwlist,
+                *last_entry,&tmp,&now_last,errcode);
+            if (res != DW_DLV_OK) {
+                break;
+            }
+            *last_entry = now_last;
+        }
+    }
+    dwarfstring_destructor(&linkname);
+    dwarfstring_destructor(&tmp);
+    return res;
+}
+
+/*  Returns the name and build-id (or DWARF5 checksum)
+    of the supplementary object file and the
+    paths where it might be, in the order to try:
+    the name itself (relative names are taken
+    relative to the directory of dbg) and then
+    .build-id/nn/nnnnnnnn.debug under each of the
+    global debuglink paths.
+    .gnu_debugaltlink (GNU dwz) is preferred
+    over a .debug_sup that is not itself
+    a supplementary file.  */
+int
+dwarf_get_sup_paths(Dwarf_Debug dbg,
+    char          **link_name_returned,
+    Dwarf_Small   **id_returned,
+    Dwarf_Unsigned *id_length_returned,
+    char         ***paths_returned,
+    unsigned       *paths_count_returned,
+    Dwarf_Error    *error)
+{
+    char          *name = 0;
+    Dwarf_Small   *id = 0;
+    Dwarf_Unsigned idlen = 0;
+    int            res = 0;
+    int            errcode = 0;
+    unsigned       count = 0;
+    struct dwarfstring_list_s  base_dwlist;
+    struct dwarfstring_list_s *last_entry = 0;
+
+    CHECK_DBG(dbg,error,"dwarf_get_sup_paths()");
+    res = _dwarf_extract_debugaltlink(dbg,&name,&id,&idlen,error);
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    if (res == DW_DLV_NO_ENTRY) {
+        Dwarf_Half  version = 0;
+        Dwarf_Small is_supp = 0;
+
+        res = dwarf_get_debug_sup(dbg,&version,&is_supp,
+            &name,&idlen,&id,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        if (is_supp) {
+            /* This is the supplementary file. */
+            return DW_DLV_NO_ENTRY;
+        }
+    }
+    if (!name[0] && !idlen) {
+        return DW_DLV_NO_ENTRY;
+    }
+    if (link_name_returned) {
+        *link_name_returned = name;
+    }
+    if (id_returned) {
+        *id_returned = id;
+    }
+    if (id_length_returned) {
+        *id_length_returned = idlen;
+    }
+    if (!paths_returned) {
+        return DW_DLV_OK;
+    }
+    *paths_returned = 0;
+    dwarfstring_list_constructor(&base_dwlist);
+    res = build_sup_path_list(dbg,name,id,idlen,
+        &base_dwlist,&last_entry,&errcode);
+    if (res == DW_DLV_OK && last_entry) {
+        res = pack_path_list(&base_dwlist,paths_returned,
+            &count,&errcode);
+    }
+    dwarfstring_list_destructor(&base_dwlist);
+    if (res != DW_DLV_OK) {
+        _dwarf_error(dbg,error,errcode);
+        return DW_DLV_ERROR;
+    }
+    if (paths_count_returned) {
+        *paths_count_returned = count;
+    }
+    return DW_DLV_OK;
+}
+
 /*  This should be rarely called and most likely
     only once (at dbg init time from dwarf_generic_init.c,
     see set_global_paths_init()).
@@ -1862,8 +1862,7 @@ int dwarf_dnames_entrypool_values(Dwarf_Dnames_Head dn,
                 return res;
             }
             if (res == DW_DLV_OK) {
-                poolptr += bytesread;
-                if (poolptr > endpool) {
+                if (bytesread > (Dwarf_Unsigned)(endpool - poolptr)) {
                     _dwarf_error_string(dbg,error,
                         DW_DLE_DEBUG_NAMES_ENTRYPOOL_OFFSET,
                         "DW_DLE_DEBUG_NAMES_ENTRYPOOL_OFFSET:"
@@ -2173,7 +2173,7 @@ dwarf_validate_die_sibling(Dwarf_Die sibling,Dwarf_Off *offset)
     false to indicate that the children are being skipped.
 
     die_info_end  points to the last byte+1 of the cu.  */
-static int
+int
 _dwarf_next_die_info_ptr(Dwarf_Byte_Ptr die_info_ptr,
     Dwarf_CU_Context cu_context,
     Dwarf_Byte_Ptr die_info_end,
@@ -3320,3 +3320,316 @@ dwarf_get_die_section_name_b(Dwarf_Die die,
     is_info = context->cc_is_info;
     return dwarf_get_die_section_name(dbg,is_info,sec_name,error);
 }
+
+/*  Filtered DIE walk. The filter test is on the
+    abbreviation only, so its result is remembered in the
+    Dwarf_Abbrev_List and every later DIE using the
+    abbreviation costs just the skip over its attributes. */
+void
+_dwarf_die_filter_destructor(void *m)
+{
+    Dwarf_Die_Filter filter = (Dwarf_Die_Filter)m;
+
+    free(filter->df_tags);
+    filter->df_tags = 0;
+    free(filter->df_attrs);
+    filter->df_attrs = 0;
+}
+
+static Dwarf_Bool
+_dwarf_abbrev_passes_filter(Dwarf_Die_Filter filter,
+    Dwarf_Abbrev_List abbrev)
+{
+    Dwarf_Unsigned i = 0;
+    Dwarf_Bool     passes = TRUE;
+
+    if (abbrev->abl_filter_serial == filter->df_serial) {
+        return abbrev->abl_filter_match;
+    }
+    if (filter->df_tag_count) {
+        passes = FALSE;
+        for (i = 0; i < filter->df_tag_count; ++i) {
+            if (filter->df_tags[i] == abbrev->abl_tag) {
+                passes = TRUE;
+                break;
+            }
+        }
+    }
+    for (i = 0; passes && i < filter->df_attr_count; ++i) {
+        Dwarf_Unsigned k = 0;
+        Dwarf_Bool     found = FALSE;
+
+        for (k = 0; k < abbrev->abl_abbrev_count; ++k) {
+            if (abbrev->abl_attr[k] == filter->df_attrs[i]) {
+                found = TRUE;
+                break;
+            }
+        }
+        passes = found;
+    }
+    abbrev->abl_filter_serial = filter->df_serial;
+    abbrev->abl_filter_match = passes;
+    return passes;
+}
+
+static int
+_dwarf_check_die_filter(Dwarf_Die_Filter filter,
+    Dwarf_Error *error)
+{
+    if (!filter) {
+        _dwarf_error_string(NULL,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "NULL Dwarf_Die_Filter passed in.");
+        return DW_DLV_ERROR;
+    }
+    if (filter->df_magic != DW_DIE_FILTER_MAGIC) {
+        _dwarf_error_string(NULL,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "Dwarf_Die_Filter has a bad magic number.");
+        return DW_DLV_ERROR;
+    }
+    return DW_DLV_OK;
+}
+
+int
+dwarf_die_filter_create(Dwarf_Debug dbg,
+    const Dwarf_Half *tags,
+    Dwarf_Unsigned    tag_count,
+    const Dwarf_Half *attrs,
+    Dwarf_Unsigned    attr_count,
+    Dwarf_Die_Filter *filter_out,
+    Dwarf_Error      *error)
+{
+    Dwarf_Die_Filter filter = 0;
+
+    CHECK_DBG(dbg,error,"dwarf_die_filter_create()");
+    if (!filter_out || (tag_count && !tags) ||
+        (attr_count && !attrs)) {
+        _dwarf_error_string(dbg,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_die_filter_create() passed a NULL "
+            "pointer with a non-zero count or a NULL "
+            "filter_out.");
+        return DW_DLV_ERROR;
+    }
+    if (tag_count > 0xffff || attr_count > 0xffff) {
+        /*  There are not that many distinct tags or
+            attributes, this is a caller error. */
+        _dwarf_error_string(dbg,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_die_filter_create() count impossibly "
+            "large.");
+        return DW_DLV_ERROR;
+    }
+    filter = (Dwarf_Die_Filter)_dwarf_get_alloc(dbg,
+        DW_DLA_DIE_FILTER,1);
+    if (!filter) {
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: allocating a Dwarf_Die_Filter");
+        return DW_DLV_ERROR;
+    }
+    filter->df_dbg = dbg;
+    if (tag_count) {
+        filter->df_tags = (Dwarf_Half *)malloc(
+            tag_count * sizeof(Dwarf_Half));
+        if (!filter->df_tags) {
+            dwarf_dealloc(dbg,filter,DW_DLA_DIE_FILTER);
+            _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+                "DW_DLE_ALLOC_FAIL: allocating the tags "
+                "of a Dwarf_Die_Filter");
+            return DW_DLV_ERROR;
+        }
+        memcpy(filter->df_tags,tags,
+            tag_count * sizeof(Dwarf_Half));
+        filter->df_tag_count = tag_count;
+    }
+    if (attr_count) {
+        filter->df_attrs = (Dwarf_Half *)malloc(
+            attr_count * sizeof(Dwarf_Half));
+        if (!filter->df_attrs) {
+            dwarf_dealloc(dbg,filter,DW_DLA_DIE_FILTER);
+            _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+                "DW_DLE_ALLOC_FAIL: allocating the attributes "
+                "of a Dwarf_Die_Filter");
+            return DW_DLV_ERROR;
+        }
+        memcpy(filter->df_attrs,attrs,
+            attr_count * sizeof(Dwarf_Half));
+        filter->df_attr_count = attr_count;
+    }
+    dbg->de_die_filter_serial++;
+    filter->df_serial = dbg->de_die_filter_serial;
+    filter->df_done = TRUE;
+    filter->df_magic = DW_DIE_FILTER_MAGIC;
+    *filter_out = filter;
+    return DW_DLV_OK;
+}
+
+int
+dwarf_die_filter_start(Dwarf_Die_Filter filter,
+    Dwarf_Die die,
+    Dwarf_Error *error)
+{
+    int res = 0;
+    Dwarf_CU_Context context = 0;
+
+    res = _dwarf_check_die_filter(filter,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    CHECK_DIE(die, DW_DLV_ERROR);
+    context = die->di_cu_context;
+    if (context->cc_dbg != filter->df_dbg) {
+        _dwarf_error_string(context->cc_dbg,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_die_filter_start() passed a DIE "
+            "from a different Dwarf_Debug than the filter.");
+        return DW_DLV_ERROR;
+    }
+    filter->df_cu_context = context;
+    filter->df_is_info = die->di_is_info;
+    filter->df_next_ptr = die->di_debug_ptr;
+    filter->df_end_ptr =
+        _dwarf_calculate_info_section_end_ptr(context);
+    filter->df_level = 0;
+    filter->df_done = FALSE;
+    return DW_DLV_OK;
+}
+
+int
+dwarf_die_filter_next(Dwarf_Die_Filter filter,
+    Dwarf_Die   *die_out,
+    int         *level_out,
+    Dwarf_Error *error)
+{
+    int res = 0;
+    Dwarf_Debug dbg = 0;
+    Dwarf_CU_Context context = 0;
+    Dwarf_Byte_Ptr end = 0;
+
+    res = _dwarf_check_die_filter(filter,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    dbg = filter->df_dbg;
+    context = filter->df_cu_context;
+    end = filter->df_end_ptr;
+    while (!filter->df_done) {
+        Dwarf_Byte_Ptr die_ptr = filter->df_next_ptr;
+        Dwarf_Byte_Ptr ptr = die_ptr;
+        Dwarf_Byte_Ptr next_ptr = 0;
+        Dwarf_Unsigned abbrev_code = 0;
+        Dwarf_Abbrev_List abbrev = 0;
+        Dwarf_Unsigned highest_code = 0;
+        Dwarf_Bool has_child = FALSE;
+        Dwarf_Bool passes = FALSE;
+        int level = filter->df_level;
+
+        if (ptr >= end) {
+            filter->df_done = TRUE;
+            break;
+        }
+        res = _dwarf_leb128_uword_wrapper(dbg,&ptr,end,
+            &abbrev_code,error);
+        if (res != DW_DLV_OK) {
+            filter->df_done = TRUE;
+            return res;
+        }
+        if (!abbrev_code) {
+            /*  Null DIE, the end of a sibling list. */
+            filter->df_next_ptr = ptr;
+            filter->df_level--;
+            if (filter->df_level <= 0) {
+                filter->df_done = TRUE;
+            }
+            continue;
+        }
+        res = _dwarf_get_abbrev_for_code(context,abbrev_code,
+            &abbrev,&highest_code,error);
+        if (res == DW_DLV_NO_ENTRY) {
+            dwarfstring m;
+
+            dwarfstring_constructor(&m);
+            dwarfstring_append_printf_u(&m,
+                "DW_DLE_ABBREV_MISSING: the abbrev code not found "
+                " in dwarf_die_filter_next() is %u. ",
+                abbrev_code);
+            dwarfstring_append_printf_u(&m,
+                "The highest known code"
+                " in any compilation unit is %u.",
+                highest_code);
+            _dwarf_error_string(dbg, error, DW_DLE_ABBREV_MISSING,
+                dwarfstring_string(&m));
+            dwarfstring_destructor(&m);
+            res = DW_DLV_ERROR;
+        }
+        if (res != DW_DLV_OK) {
+            filter->df_done = TRUE;
+            return res;
+        }
+        if (!abbrev->abl_attr) {
+            res = _dwarf_fill_in_attr_form_abtable(context,
+                abbrev->abl_abbrev_ptr,
+                _dwarf_calculate_abbrev_section_end_ptr(context),
+                abbrev,error);
+            if (res != DW_DLV_OK) {
+                filter->df_done = TRUE;
+                return res;
+            }
+        }
+        passes = _dwarf_abbrev_passes_filter(filter,abbrev);
+        res = _dwarf_next_die_info_ptr(die_ptr,context,end,
+            NULL,FALSE,&has_child,&next_ptr,error);
+        if (res != DW_DLV_OK) {
+            filter->df_done = TRUE;
+            return res;
+        }
+        filter->df_next_ptr = next_ptr;
+        if (has_child) {
+            filter->df_level++;
+        } else if (!level) {
+            /*  The starting DIE had no children. */
+            filter->df_done = TRUE;
+        }
+        if (passes) {
+            Dwarf_Die ret_die = 0;
+
+            ret_die = (Dwarf_Die)_dwarf_get_alloc(dbg,
+                DW_DLA_DIE,1);
+            if (!ret_die) {
+                filter->df_done = TRUE;
+                _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+                return DW_DLV_ERROR;
+            }
+            ret_die->di_debug_ptr = die_ptr;
+            ret_die->di_cu_context = context;
+            ret_die->di_is_info = filter->df_is_info;
+            ret_die->di_abbrev_code = abbrev_code;
+            ret_die->di_abbrev_list = abbrev;
+            *die_out = ret_die;
+            if (level_out) {
+                *level_out = level;
+            }
+            return DW_DLV_OK;
+        }
+    }
+    return DW_DLV_NO_ENTRY;
+}
+
+void
+dwarf_dealloc_die_filter(Dwarf_Die_Filter filter)
+{
+    Dwarf_Debug dbg = 0;
+
+    if (!filter || filter->df_magic != DW_DIE_FILTER_MAGIC) {
+        return;
+    }
+    dbg = filter->df_dbg;
+    filter->df_magic = 0;
+    dwarf_dealloc(dbg,filter,DW_DLA_DIE_FILTER);
+}
@@ -75,4 +75,49 @@ struct Dwarf_Abbrev_List_s {
         for an implicit const value. */
     Dwarf_Signed  *abl_implicit_const;
 
+    /*  Memo of the last Dwarf_Die_Filter evaluated
+        against this abbrev: abl_filter_serial is that
+        filter's df_serial (zero means none yet) and
+        abl_filter_match is whether the abbrev passed. */
+    Dwarf_Unsigned abl_filter_serial;
+    Dwarf_Bool     abl_filter_match;
 };
+
+#define DW_DIE_FILTER_MAGIC 0xf17e
+
+/*  A Dwarf_Die_Filter walks the DIE tree under one DIE
+    returning only DIEs whose abbreviation has one of
+    df_tags (any tag if df_tag_count is zero) and every
+    attribute in df_attrs. The test depends only on the
+    abbreviation so it is done once per abbreviation
+    and other DIEs are skipped without creating a Dwarf_Die. */
+struct Dwarf_Die_Filter_s {
+    Dwarf_Unsigned   df_magic;
+    Dwarf_Debug      df_dbg;
+    /*  Unique (per dbg) so abbrev memos of
+        other filters are not trusted. */
+    Dwarf_Unsigned   df_serial;
+    Dwarf_Half      *df_tags;
+    Dwarf_Unsigned   df_tag_count;
+    Dwarf_Half      *df_attrs;
+    Dwarf_Unsigned   df_attr_count;
+
+    /*  The walk state set by dwarf_die_filter_start(). */
+    Dwarf_CU_Context df_cu_context;
+    Dwarf_Bool       df_is_info;
+    Dwarf_Byte_Ptr   df_next_ptr;
+    Dwarf_Byte_Ptr   df_end_ptr;
+    int              df_level;
+    Dwarf_Bool       df_done;
+};
+
+void _dwarf_die_filter_destructor(void *m);
+
+int _dwarf_next_die_info_ptr(Dwarf_Byte_Ptr die_info_ptr,
+    Dwarf_CU_Context cu_context,
+    Dwarf_Byte_Ptr die_info_end,
+    Dwarf_Byte_Ptr cu_info_start,
+    Dwarf_Bool want_AT_sibling,
+    Dwarf_Bool * has_die_child,
+    Dwarf_Byte_Ptr *next_die_ptr_out,
+    Dwarf_Error *error);
@@ -0,0 +1,880 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it
+  and/or modify it under the terms of version 2.1 of the
+  GNU Lesser General Public License as published by the Free
+  Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General
+  Public License along with this program; if not, write the
+  Free Software Foundation, Inc., 51 Franklin Street - Fifth
+  Floor, Boston MA 02110-1301, USA.
+
+*/
+
+
+/*  dwarf_die_resolved_names() follows DW_AT_abstract_origin
+    and DW_AT_specification and the enclosing namespaces
+    and classes of a DIE to find its name, linkage name,
+    declaration coordinates and qualified scope.
+    Every DIE visited is remembered by offset so each
+    chain and each scope name is built only once per
+    Dwarf_Debug, no matter how many DIEs share them. */
+
+#include <config.h>
+
+#include <stdlib.h> /* calloc() free() malloc() realloc() */
+#include <string.h> /* memcpy() strlen() */
+
+#if defined(_WIN32) && defined(HAVE_STDAFX_H)
+#include "stdafx.h"
+#endif /* HAVE_STDAFX_H */
+
+#ifdef HAVE_STDINT_H
+#include <stdint.h> /* uintptr_t */
+#endif /* HAVE_STDINT_H */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "libdwarf_private.h"
+#include "dwarf_base_types.h"
+#include "dwarf_opaque.h"
+#include "dwarf_alloc.h"
+#include "dwarf_error.h"
+#include "dwarf_util.h"
+#include "dwarf_string.h"
+#include "dwarf_die_deliv.h"
+#include "dwarf_tsearch.h"
+#include "dwarf_die_names.h"
+
+/*  Limits the recursion through origin, specification
+    and scope DIEs, which also stops reference loops
+    in corrupt DWARF. */
+#define DW_DIE_NAMES_DEPTH_MAX 64
+
+static DW_TSHASHTYPE
+names_hashfunc(const void *keyp)
+{
+    const struct Dwarf_Die_Names_s *enp = keyp;
+
+    return (DW_TSHASHTYPE)enp->dn_offset;
+}
+
+static int
+names_compare(const void *l, const void *r)
+{
+    const struct Dwarf_Die_Names_s *lp = l;
+    const struct Dwarf_Die_Names_s *rp = r;
+
+    if (lp->dn_offset < rp->dn_offset) {
+        return -1;
+    }
+    if (lp->dn_offset > rp->dn_offset) {
+        return 1;
+    }
+    if (lp->dn_is_info < rp->dn_is_info) {
+        return -1;
+    }
+    if (lp->dn_is_info > rp->dn_is_info) {
+        return 1;
+    }
+    return 0;
+}
+
+static void
+names_free_node(void *nodep)
+{
+    struct Dwarf_Die_Names_s *enp = nodep;
+
+    free(enp->dn_qualified);
+    free(enp);
+}
+
+static DW_TSHASHTYPE
+names_cu_hashfunc(const void *keyp)
+{
+    const struct Dwarf_Die_Names_CU_s *enp = keyp;
+
+    return (DW_TSHASHTYPE)enp->nc_cu_offset;
+}
+
+static int
+names_cu_compare(const void *l, const void *r)
+{
+    const struct Dwarf_Die_Names_CU_s *lp = l;
+    const struct Dwarf_Die_Names_CU_s *rp = r;
+
+    if (lp->nc_cu_offset < rp->nc_cu_offset) {
+        return -1;
+    }
+    if (lp->nc_cu_offset > rp->nc_cu_offset) {
+        return 1;
+    }
+    if (lp->nc_is_info < rp->nc_is_info) {
+        return -1;
+    }
+    if (lp->nc_is_info > rp->nc_is_info) {
+        return 1;
+    }
+    return 0;
+}
+
+static void
+names_cu_free_node(void *nodep)
+{
+    struct Dwarf_Die_Names_CU_s *enp = nodep;
+
+    if (enp->nc_srcfiles) {
+        Dwarf_Signed i = 0;
+
+        for (i = 0; i < enp->nc_srcfiles_count; ++i) {
+            dwarf_dealloc(enp->nc_dbg,enp->nc_srcfiles[i],
+                DW_DLA_STRING);
+        }
+        dwarf_dealloc(enp->nc_dbg,enp->nc_srcfiles,DW_DLA_LIST);
+        enp->nc_srcfiles = 0;
+    }
+    free(enp->nc_scopes);
+    free(enp);
+}
+
+/*  Called by dwarf_finish() while DW_DLA allocations
+    are still valid. */
+void
+_dwarf_destroy_die_names(Dwarf_Debug dbg)
+{
+    if (dbg->de_die_names_tree) {
+        dwarf_tdestroy(dbg->de_die_names_tree,names_free_node);
+        dbg->de_die_names_tree = 0;
+    }
+    if (dbg->de_die_names_cu_tree) {
+        dwarf_tdestroy(dbg->de_die_names_cu_tree,
+            names_cu_free_node);
+        dbg->de_die_names_cu_tree = 0;
+    }
+}
+
+static int
+get_cu_record(Dwarf_Debug dbg,
+    Dwarf_CU_Context context,
+    struct Dwarf_Die_Names_CU_s **out,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Die_Names_CU_s  key;
+    struct Dwarf_Die_Names_CU_s *rec = 0;
+    void *found = 0;
+
+    if (!dbg->de_die_names_cu_tree) {
+        dwarf_initialize_search_hash(&dbg->de_die_names_cu_tree,
+            names_cu_hashfunc,0);
+    }
+    memset(&key,0,sizeof(key));
+    key.nc_cu_offset = context->cc_debug_offset;
+    key.nc_is_info = context->cc_is_info;
+    found = dwarf_tfind(&key,&dbg->de_die_names_cu_tree,
+        names_cu_compare);
+    if (found) {
+        *out = *(struct Dwarf_Die_Names_CU_s **)found;
+        return DW_DLV_OK;
+    }
+    rec = (struct Dwarf_Die_Names_CU_s *)calloc(1,
+        sizeof(struct Dwarf_Die_Names_CU_s));
+    if (!rec) {
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: allocating the per-CU record "
+            "of dwarf_die_resolved_names()");
+        return DW_DLV_ERROR;
+    }
+    rec->nc_cu_offset = key.nc_cu_offset;
+    rec->nc_is_info = key.nc_is_info;
+    rec->nc_dbg = dbg;
+    found = dwarf_tsearch(rec,&dbg->de_die_names_cu_tree,
+        names_cu_compare);
+    if (!found) {
+        free(rec);
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: inserting the per-CU record "
+            "of dwarf_die_resolved_names()");
+        return DW_DLV_ERROR;
+    }
+    *out = rec;
+    return DW_DLV_OK;
+}
+
+static int
+get_filled_abbrev(Dwarf_CU_Context context,
+    Dwarf_Unsigned code,
+    Dwarf_Abbrev_List *abbrev_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug dbg = context->cc_dbg;
+    Dwarf_Abbrev_List abbrev = 0;
+    Dwarf_Unsigned highest_code = 0;
+    int res = 0;
+
+    res = _dwarf_get_abbrev_for_code(context,code,
+        &abbrev,&highest_code,error);
+    if (res == DW_DLV_NO_ENTRY) {
+        dwarfstring m;
+
+        dwarfstring_constructor(&m);
+        dwarfstring_append_printf_u(&m,
+            "DW_DLE_ABBREV_MISSING: the abbrev code not found "
+            " in dwarf_die_resolved_names() is %u. ",code);
+        dwarfstring_append_printf_u(&m,
+            "The highest known code"
+            " in any compilation unit is %u.",
+            highest_code);
+        _dwarf_error_string(dbg, error, DW_DLE_ABBREV_MISSING,
+            dwarfstring_string(&m));
+        dwarfstring_destructor(&m);
+        return DW_DLV_ERROR;
+    }
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (!abbrev->abl_attr) {
+        res = _dwarf_fill_in_attr_form_abtable(context,
+            abbrev->abl_abbrev_ptr,
+            _dwarf_calculate_abbrev_section_end_ptr(context),
+            abbrev,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+    }
+    *abbrev_out = abbrev;
+    return DW_DLV_OK;
+}
+
+/*  The DIEs whose names qualify the names of
+    their children. An enumeration is a scope only
+    when it is a C++ enum class. */
+static Dwarf_Bool
+abbrev_is_scope(Dwarf_Abbrev_List abbrev)
+{
+    Dwarf_Unsigned i = 0;
+
+    switch (abbrev->abl_tag) {
+    case DW_TAG_namespace:
+    case DW_TAG_class_type:
+    case DW_TAG_structure_type:
+    case DW_TAG_union_type:
+    case DW_TAG_interface_type:
+    case DW_TAG_module:
+        return TRUE;
+    case DW_TAG_enumeration_type:
+        for (i = 0; i < abbrev->abl_abbrev_count; ++i) {
+            if (abbrev->abl_attr[i] == DW_AT_enum_class) {
+                return TRUE;
+            }
+        }
+        return FALSE;
+    default:
+        break;
+    }
+    return FALSE;
+}
+
+/*  One pass over the CU, skipping DIEs by size,
+    recording where each scope DIE begins and ends
+    and which scope encloses it. */
+static int
+build_cu_scopes(Dwarf_Debug dbg,
+    Dwarf_CU_Context context,
+    Dwarf_Off cu_die_offset,
+    struct Dwarf_Die_Names_CU_s *rec,
+    Dwarf_Error *error)
+{
+    struct scope_stack_s {
+        Dwarf_Unsigned ss_close;
+        Dwarf_Unsigned ss_saved_cur;
+    } *stack = 0;
+    Dwarf_Unsigned stack_size = 0;
+    Dwarf_Unsigned depth = 0;
+    Dwarf_Unsigned scope_size = 0;
+    Dwarf_Unsigned cur = DW_DIE_SCOPE_NONE;
+    Dwarf_Byte_Ptr secstart = 0;
+    Dwarf_Unsigned seclen = 0;
+    Dwarf_Byte_Ptr ptr = 0;
+    Dwarf_Byte_Ptr end = 0;
+    int res = DW_DLV_OK;
+
+    secstart = _dwarf_calculate_info_section_start_ptr(context,
+        &seclen);
+    end = _dwarf_calculate_info_section_end_ptr(context);
+    if (cu_die_offset >= seclen) {
+        _dwarf_error_string(dbg,error,DW_DLE_OFFSET_BAD,
+            "DW_DLE_OFFSET_BAD: the CU DIE offset is "
+            "outside the section in dwarf_die_resolved_names()");
+        return DW_DLV_ERROR;
+    }
+    ptr = secstart + cu_die_offset;
+    rec->nc_scopes_done = TRUE;
+    while (ptr < end) {
+        Dwarf_Byte_Ptr die_ptr = ptr;
+        Dwarf_Byte_Ptr next_ptr = 0;
+        Dwarf_Unsigned code = 0;
+        Dwarf_Abbrev_List abbrev = 0;
+        Dwarf_Bool has_child = FALSE;
+        Dwarf_Unsigned idx = DW_DIE_SCOPE_NONE;
+
+        res = _dwarf_leb128_uword_wrapper(dbg,&ptr,end,
+            &code,error);
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        if (!code) {
+            if (!depth) {
+                break;
+            }
+            --depth;
+            if (stack[depth].ss_close != DW_DIE_SCOPE_NONE) {
+                rec->nc_scopes[stack[depth].ss_close].ns_end =
+                    (Dwarf_Off)(ptr - secstart);
+            }
+            cur = stack[depth].ss_saved_cur;
+            if (!depth) {
+                break;
+            }
+            continue;
+        }
+        res = get_filled_abbrev(context,code,&abbrev,error);
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        res = _dwarf_next_die_info_ptr(die_ptr,context,end,
+            NULL,FALSE,&has_child,&next_ptr,error);
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        if (abbrev_is_scope(abbrev)) {
+            struct Dwarf_Die_Scope_s *sp = 0;
+
+            if (rec->nc_scope_count >= scope_size) {
+                struct Dwarf_Die_Scope_s *newscopes = 0;
+                Dwarf_Unsigned newsize = scope_size?
+                    scope_size*2:16;
+
+                newscopes = (struct Dwarf_Die_Scope_s *)realloc(
+                    rec->nc_scopes,
+                    newsize*sizeof(struct Dwarf_Die_Scope_s));
+                if (!newscopes) {
+                    _dwarf_error_string(dbg,error,
+                        DW_DLE_ALLOC_FAIL,
+                        "DW_DLE_ALLOC_FAIL: growing the scope "
+                        "list in dwarf_die_resolved_names()");
+                    res = DW_DLV_ERROR;
+                    break;
+                }
+                rec->nc_scopes = newscopes;
+                scope_size = newsize;
+            }
+            idx = rec->nc_scope_count;
+            sp = rec->nc_scopes + idx;
+            sp->ns_offset = (Dwarf_Off)(die_ptr - secstart);
+            sp->ns_end = (Dwarf_Off)(next_ptr - secstart);
+            sp->ns_parent = cur;
+            rec->nc_scope_count++;
+        }
+        if (has_child) {
+            if (depth >= stack_size) {
+                struct scope_stack_s *newstack = 0;
+                Dwarf_Unsigned newsize = stack_size?
+                    stack_size*2:32;
+
+                newstack = (struct scope_stack_s *)realloc(
+                    stack,newsize*sizeof(struct scope_stack_s));
+                if (!newstack) {
+                    _dwarf_error_string(dbg,error,
+                        DW_DLE_ALLOC_FAIL,
+                        "DW_DLE_ALLOC_FAIL: growing the DIE "
+                        "nesting stack in "
+                        "dwarf_die_resolved_names()");
+                    res = DW_DLV_ERROR;
+                    break;
+                }
+                stack = newstack;
+                stack_size = newsize;
+            }
+            stack[depth].ss_close = idx;
+            stack[depth].ss_saved_cur = cur;
+            ++depth;
+            if (idx != DW_DIE_SCOPE_NONE) {
+                cur = idx;
+            }
+        } else if (!depth) {
+            /* A CU DIE without children. */
+            break;
+        }
+        ptr = next_ptr;
+    }
+    free(stack);
+    return res;
+}
+
+/*  Returns the index of the innermost scope DIE
+    enclosing (and not equal to) the DIE at offset. */
+static Dwarf_Unsigned
+find_enclosing_scope(struct Dwarf_Die_Names_CU_s *rec,
+    Dwarf_Off offset)
+{
+    Dwarf_Unsigned lo = 0;
+    Dwarf_Unsigned hi = rec->nc_scope_count;
+    Dwarf_Unsigned idx = 0;
+
+    /* Find the last scope starting before offset. */
+    while (lo < hi) {
+        Dwarf_Unsigned mid = lo + (hi - lo)/2;
+
+        if (rec->nc_scopes[mid].ns_offset < offset) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (!lo) {
+        return DW_DIE_SCOPE_NONE;
+    }
+    idx = lo - 1;
+    while (idx != DW_DIE_SCOPE_NONE &&
+        rec->nc_scopes[idx].ns_end <= offset) {
+        idx = rec->nc_scopes[idx].ns_parent;
+    }
+    return idx;
+}
+
+static int
+get_string_attr(Dwarf_Die die,
+    Dwarf_Half attrnum,
+    const char **str_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Attribute attr = 0;
+    char *str = 0;
+    int res = 0;
+
+    res = dwarf_attr(die,attrnum,&attr,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_formstring(attr,&str,error);
+    dwarf_dealloc_attribute(attr);
+    if (res == DW_DLV_OK) {
+        *str_out = str;
+    }
+    return res;
+}
+
+static int
+get_udata_attr(Dwarf_Die die,
+    Dwarf_Half attrnum,
+    Dwarf_Unsigned *val_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Attribute attr = 0;
+    int res = 0;
+
+    res = dwarf_attr(die,attrnum,&attr,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_formudata(attr,val_out,error);
+    dwarf_dealloc_attribute(attr);
+    return res;
+}
+
+/*  Returns DW_DLV_NO_ENTRY if the DIE has neither
+    DW_AT_specification nor DW_AT_abstract_origin
+    or it refers to a supplementary object. */
+static int
+get_origin_ref(Dwarf_Die die,
+    Dwarf_Off  *offset_out,
+    Dwarf_Bool *is_info_out,
+    Dwarf_Error *error)
+{
+    static const Dwarf_Half refattrs[2] = {
+        DW_AT_specification, DW_AT_abstract_origin };
+    unsigned i = 0;
+
+    for (i = 0; i < 2; ++i) {
+        Dwarf_Attribute attr = 0;
+        Dwarf_Half form = 0;
+        int res = 0;
+
+        res = dwarf_attr(die,refattrs[i],&attr,error);
+        if (res == DW_DLV_ERROR) {
+            return res;
+        }
+        if (res == DW_DLV_NO_ENTRY) {
+            continue;
+        }
+        res = dwarf_whatform(attr,&form,error);
+        if (res == DW_DLV_OK) {
+            if (form == DW_FORM_ref_sup4 ||
+                form == DW_FORM_ref_sup8 ||
+                form == DW_FORM_GNU_ref_alt) {
+                res = DW_DLV_NO_ENTRY;
+            } else {
+                res = dwarf_global_formref_b(attr,offset_out,
+                    is_info_out,error);
+            }
+        }
+        dwarf_dealloc_attribute(attr);
+        return res;
+    }
+    return DW_DLV_NO_ENTRY;
+}
+
+/*  Maps a DW_AT_decl_file number to a name using the
+    line table of the DIE's CU, read once per CU.
+    A missing or unreadable line table just means no
+    file name, it is not an error for this interface. */
+static int
+get_decl_file_name(Dwarf_Die die,
+    Dwarf_Unsigned filenum,
+    const char **name_out,
+    Dwarf_Error *error)
+{
+    Dwarf_CU_Context context = die->di_cu_context;
+    Dwarf_Debug dbg = context->cc_dbg;
+    struct Dwarf_Die_Names_CU_s *rec = 0;
+    int res = 0;
+
+    res = get_cu_record(dbg,context,&rec,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (!rec->nc_srcfiles_done) {
+        Dwarf_Off cu_die_offset = 0;
+        Dwarf_Die cu_die = 0;
+        Dwarf_Half offset_size = 0;
+        Dwarf_Error lerr = 0;
+
+        rec->nc_srcfiles_done = TRUE;
+        res = dwarf_get_version_of_die(die,&rec->nc_version,
+            &offset_size);
+        if (res == DW_DLV_OK) {
+            res = dwarf_CU_dieoffset_given_die(die,
+                &cu_die_offset,&lerr);
+        }
+        if (res == DW_DLV_OK) {
+            res = dwarf_offdie_b(dbg,cu_die_offset,
+                context->cc_is_info,&cu_die,&lerr);
+        }
+        if (res == DW_DLV_OK) {
+            res = dwarf_srcfiles(cu_die,&rec->nc_srcfiles,
+                &rec->nc_srcfiles_count,&lerr);
+            dwarf_dealloc_die(cu_die);
+        }
+        if (res == DW_DLV_ERROR) {
+            dwarf_dealloc_error(dbg,lerr);
+        }
+        if (res != DW_DLV_OK) {
+            rec->nc_srcfiles = 0;
+            rec->nc_srcfiles_count = 0;
+        }
+    }
+    if (rec->nc_version >= DW_CU_VERSION5) {
+        if (filenum < (Dwarf_Unsigned)rec->nc_srcfiles_count) {
+            *name_out = rec->nc_srcfiles[filenum];
+        }
+    } else if (filenum &&
+        filenum <= (Dwarf_Unsigned)rec->nc_srcfiles_count) {
+        *name_out = rec->nc_srcfiles[filenum-1];
+    }
+    return DW_DLV_OK;
+}
+
+static int resolve_die_names(Dwarf_Debug dbg,
+    Dwarf_Die die,
+    Dwarf_Off offset,
+    Dwarf_Bool is_info,
+    int depth,
+    struct Dwarf_Die_Names_s **out,
+    Dwarf_Error *error);
+
+/*  Sets dn_scope, the qualified name of the innermost
+    namespace, class etc around the DIE. */
+static int
+resolve_enclosing_scope(Dwarf_Debug dbg,
+    Dwarf_Die die,
+    struct Dwarf_Die_Names_s *entry,
+    int depth,
+    Dwarf_Error *error)
+{
+    Dwarf_CU_Context context = die->di_cu_context;
+    struct Dwarf_Die_Names_CU_s *rec = 0;
+    struct Dwarf_Die_Names_s *scope = 0;
+    Dwarf_Unsigned idx = 0;
+    int res = 0;
+
+    res = get_cu_record(dbg,context,&rec,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (!rec->nc_scopes_done) {
+        Dwarf_Off cu_die_offset = 0;
+
+        res = dwarf_CU_dieoffset_given_die(die,
+            &cu_die_offset,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        res = build_cu_scopes(dbg,context,cu_die_offset,
+            rec,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+    }
+    idx = find_enclosing_scope(rec,entry->dn_offset);
+    if (idx == DW_DIE_SCOPE_NONE) {
+        return DW_DLV_OK;
+    }
+    res = resolve_die_names(dbg,NULL,
+        rec->nc_scopes[idx].ns_offset,entry->dn_is_info,
+        depth+1,&scope,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (!scope->dn_qualified) {
+        const char *name = scope->dn_name;
+        size_t scopelen = strlen(scope->dn_scope);
+        size_t namelen = 0;
+        char *q = 0;
+
+        if (!name) {
+            name = (scope->dn_tag == DW_TAG_namespace)?
+                "(anonymous namespace)":"(anonymous)";
+        }
+        namelen = strlen(name);
+        q = (char *)malloc(scopelen + 2 + namelen + 1);
+        if (!q) {
+            _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+                "DW_DLE_ALLOC_FAIL: allocating a qualified "
+                "name in dwarf_die_resolved_names()");
+            return DW_DLV_ERROR;
+        }
+        if (scopelen) {
+            memcpy(q,scope->dn_scope,scopelen);
+            memcpy(q+scopelen,"::",2);
+            scopelen += 2;
+        }
+        memcpy(q+scopelen,name,namelen+1);
+        scope->dn_qualified = q;
+    }
+    entry->dn_scope = scope->dn_qualified;
+    return DW_DLV_OK;
+}
+
+static int
+fill_die_names(Dwarf_Debug dbg,
+    Dwarf_Die die,
+    struct Dwarf_Die_Names_s *entry,
+    int depth,
+    Dwarf_Error *error)
+{
+    Dwarf_Off  target = 0;
+    Dwarf_Bool target_is_info = FALSE;
+    Dwarf_Unsigned filenum = 0;
+    char *name = 0;
+    int res = 0;
+
+    res = dwarf_tag(die,&entry->dn_tag,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_diename(die,&name,error);
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    entry->dn_name = name;
+    res = get_string_attr(die,DW_AT_linkage_name,
+        &entry->dn_linkage_name,error);
+    if (res == DW_DLV_NO_ENTRY) {
+        res = get_string_attr(die,DW_AT_MIPS_linkage_name,
+            &entry->dn_linkage_name,error);
+    }
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    res = get_udata_attr(die,DW_AT_decl_file,&filenum,error);
+    if (res == DW_DLV_OK) {
+        res = get_decl_file_name(die,filenum,
+            &entry->dn_decl_file,error);
+    }
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    res = get_udata_attr(die,DW_AT_decl_line,
+        &entry->dn_decl_line,error);
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    res = get_origin_ref(die,&target,&target_is_info,error);
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    if (res == DW_DLV_OK && depth < DW_DIE_NAMES_DEPTH_MAX) {
+        struct Dwarf_Die_Names_s *t = 0;
+
+        /*  The target supplies what this DIE lacks, and
+            its scope is the right one: an out-of-line
+            member function definition is at file
+            scope but its declaration is in the class. */
+        res = resolve_die_names(dbg,NULL,target,target_is_info,
+            depth+1,&t,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        if (!entry->dn_name) {
+            entry->dn_name = t->dn_name;
+        }
+        if (!entry->dn_linkage_name) {
+            entry->dn_linkage_name = t->dn_linkage_name;
+        }
+        /*  A definition often repeats only the
+            DW_AT_decl_line that differs. */
+        if (!entry->dn_decl_file) {
+            entry->dn_decl_file = t->dn_decl_file;
+        }
+        if (!entry->dn_decl_line) {
+            entry->dn_decl_line = t->dn_decl_line;
+        }
+        entry->dn_scope = t->dn_scope;
+        return DW_DLV_OK;
+    }
+    if (depth >= DW_DIE_NAMES_DEPTH_MAX) {
+        return DW_DLV_OK;
+    }
+    return resolve_enclosing_scope(dbg,die,entry,depth,error);
+}
+
+static int
+resolve_die_names(Dwarf_Debug dbg,
+    Dwarf_Die die,
+    Dwarf_Off offset,
+    Dwarf_Bool is_info,
+    int depth,
+    struct Dwarf_Die_Names_s **out,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Die_Names_s  key;
+    struct Dwarf_Die_Names_s *entry = 0;
+    struct Dwarf_Die_Names_s *re = 0;
+    Dwarf_Die localdie = 0;
+    void *found = 0;
+    int res = 0;
+
+    if (!dbg->de_die_names_tree) {
+        dwarf_initialize_search_hash(&dbg->de_die_names_tree,
+            names_hashfunc,0);
+    }
+    memset(&key,0,sizeof(key));
+    key.dn_offset = offset;
+    key.dn_is_info = is_info;
+    found = dwarf_tfind(&key,&dbg->de_die_names_tree,
+        names_compare);
+    if (found) {
+        *out = *(struct Dwarf_Die_Names_s **)found;
+        return DW_DLV_OK;
+    }
+    if (!die) {
+        res = dwarf_offdie_b(dbg,offset,is_info,&localdie,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        die = localdie;
+    }
+    entry = (struct Dwarf_Die_Names_s *)calloc(1,
+        sizeof(struct Dwarf_Die_Names_s));
+    if (!entry) {
+        dwarf_dealloc_die(localdie);
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: allocating a "
+            "dwarf_die_resolved_names() record");
+        return DW_DLV_ERROR;
+    }
+    entry->dn_offset = offset;
+    entry->dn_is_info = is_info;
+    entry->dn_scope = "";
+    res = fill_die_names(dbg,die,entry,depth,error);
+    dwarf_dealloc_die(localdie);
+    if (res != DW_DLV_OK) {
+        names_free_node(entry);
+        return res;
+    }
+    found = dwarf_tsearch(entry,&dbg->de_die_names_tree,
+        names_compare);
+    if (!found) {
+        names_free_node(entry);
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: inserting a "
+            "dwarf_die_resolved_names() record");
+        return DW_DLV_ERROR;
+    }
+    re = *(struct Dwarf_Die_Names_s **)found;
+    if (re != entry) {
+        /*  A reference loop got here first, keep
+            the record already in the tree. */
+        names_free_node(entry);
+    }
+    *out = re;
+    return DW_DLV_OK;
+}
+
+int
+dwarf_die_resolved_names(Dwarf_Die die,
+    const char    **name,
+    const char    **linkage_name,
+    const char    **qualified_scope,
+    const char    **decl_file,
+    Dwarf_Unsigned *decl_line,
+    Dwarf_Error    *error)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Off   offset = 0;
+    struct Dwarf_Die_Names_s *entry = 0;
+    int res = 0;
+
+    CHECK_DIE(die, DW_DLV_ERROR);
+    dbg = die->di_cu_context->cc_dbg;
+    res = dwarf_dieoffset(die,&offset,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = resolve_die_names(dbg,die,offset,die->di_is_info,
+        0,&entry,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (name) {
+        *name = entry->dn_name;
+    }
+    if (linkage_name) {
+        *linkage_name = entry->dn_linkage_name;
+    }
+    if (qualified_scope) {
+        *qualified_scope = entry->dn_scope;
+    }
+    if (decl_file) {
+        *decl_file = entry->dn_decl_file;
+    }
+    if (decl_line) {
+        *decl_line = entry->dn_decl_line;
+    }
+    return DW_DLV_OK;
+}
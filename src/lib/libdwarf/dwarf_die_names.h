@@ -0,0 +1,88 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it
+  and/or modify it under the terms of version 2.1 of the
+  GNU Lesser General Public License as published by the Free
+  Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General
+  Public License along with this program; if not, write the
+  Free Software Foundation, Inc., 51 Franklin Street - Fifth
+  Floor, Boston MA 02110-1301, USA.
+
+*/
+
+#ifndef DWARF_DIE_NAMES_H
+#define DWARF_DIE_NAMES_H
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*  The memo of dwarf_die_resolved_names(),
+    one per DIE asked about (or passed through while
+    following DW_AT_abstract_origin, DW_AT_specification
+    or the enclosing scopes), in dbg->de_die_names_tree.
+    The key is dn_offset and dn_is_info. */
+struct Dwarf_Die_Names_s {
+    Dwarf_Off      dn_offset;
+    Dwarf_Bool     dn_is_info;
+    Dwarf_Half     dn_tag;
+    const char    *dn_name;
+    const char    *dn_linkage_name;
+    /*  Points at dn_qualified of the enclosing scope
+        DIE or at "". */
+    const char    *dn_scope;
+    const char    *dn_decl_file;
+    Dwarf_Unsigned dn_decl_line;
+    /*  Only built when this DIE is itself a scope:
+        dn_scope::dn_name. malloc space. */
+    char          *dn_qualified;
+};
+
+/*  One scope-forming DIE (namespace, class etc)
+    of a CU. ns_end is the offset one past the
+    DIE and all its children. */
+struct Dwarf_Die_Scope_s {
+    Dwarf_Off      ns_offset;
+    Dwarf_Off      ns_end;
+    Dwarf_Unsigned ns_parent;
+};
+#define DW_DIE_SCOPE_NONE ((Dwarf_Unsigned)-1)
+
+/*  Per CU data for dwarf_die_resolved_names(),
+    in dbg->de_die_names_cu_tree. Key is nc_cu_offset
+    (of the CU header) and nc_is_info. */
+struct Dwarf_Die_Names_CU_s {
+    Dwarf_Off      nc_cu_offset;
+    Dwarf_Bool     nc_is_info;
+    Dwarf_Debug    nc_dbg;
+    /*  In DIE offset order. */
+    Dwarf_Bool     nc_scopes_done;
+    struct Dwarf_Die_Scope_s *nc_scopes;
+    Dwarf_Unsigned nc_scope_count;
+    Dwarf_Bool     nc_srcfiles_done;
+    char         **nc_srcfiles;
+    Dwarf_Signed   nc_srcfiles_count;
+    Dwarf_Half     nc_version;
+};
+
+void _dwarf_destroy_die_names(Dwarf_Debug dbg);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* DWARF_DIE_NAMES_H */
@@ -340,8 +340,9 @@ generic_phdr_from_phdr32(dwarf_elf_object_access_internals_t* ep,
 
     orig_pph = pph;
     orig_gphdr = gphdr;
-    res = RRMOA(ep->f_fd,pph,offset,count*entsize,
-        ep->f_filesize,errcode);
+    res = RRMOA(ep->f_fd,pph,(off_t)(ep->f_inner_offset+offset),
+        count*entsize,(off_t)(ep->f_inner_offset+ep->f_filesize),
+        errcode);
     if (res != DW_DLV_OK) {
         free(pph);
         free(gphdr);
@@ -401,8 +402,9 @@ generic_phdr_from_phdr64(dwarf_elf_object_access_internals_t* ep,
 
     orig_pph = pph;
     orig_gphdr = gphdr;
-    res = RRMOA(ep->f_fd,pph,offset,count*entsize,
-        ep->f_filesize,errcode);
+    res = RRMOA(ep->f_fd,pph,(off_t)(ep->f_inner_offset+offset),
+        count*entsize,(off_t)(ep->f_inner_offset+ep->f_filesize),
+        errcode);
     if (res != DW_DLV_OK) {
         free(pph);
         free(gphdr);
@@ -481,8 +483,9 @@ generic_shdr_from_shdr32(dwarf_elf_object_access_internals_t *ep,
 
     orig_psh = psh;
     orig_gshdr = gshdr;
-    res = RRMOA(ep->f_fd,psh,offset,count*entsize,
-        ep->f_filesize,errcode);
+    res = RRMOA(ep->f_fd,psh,(off_t)(ep->f_inner_offset+offset),
+        count*entsize,(off_t)(ep->f_inner_offset+ep->f_filesize),
+        errcode);
     if (res != DW_DLV_OK) {
         free(orig_psh);
         free(orig_gshdr);
@@ -602,8 +605,9 @@ generic_shdr_from_shdr64(dwarf_elf_object_access_internals_t *ep,
     }
     orig_psh = psh;
     orig_gshdr = gshdr;
-    res = RRMOA(ep->f_fd,psh,offset,count*entsize,
-        ep->f_filesize,errcode);
+    res = RRMOA(ep->f_fd,psh,(off_t)(ep->f_inner_offset+offset),
+        count*entsize,(off_t)(ep->f_inner_offset+ep->f_filesize),
+        errcode);
     if (res != DW_DLV_OK) {
         free(orig_psh);
         free(orig_gshdr);
@@ -710,8 +714,8 @@ _dwarf_generic_elf_load_symbols32(
         *errcode = DW_DLE_ALLOC_FAIL;
         return DW_DLV_ERROR;
     }
-    res = RRMOA(ep->f_fd,psym,offset,size,
-        ep->f_filesize,errcode);
+    res = RRMOA(ep->f_fd,psym,(off_t)(ep->f_inner_offset+offset),size,
+        (off_t)(ep->f_inner_offset+ep->f_filesize),errcode);
     if (res!= DW_DLV_OK) {
         free(psym);
         free(gsym);
@@ -777,8 +781,8 @@ _dwarf_generic_elf_load_symbols64(
         *errcode = DW_DLE_ALLOC_FAIL;
         return DW_DLV_ERROR;
     }
-    res = RRMOA(ep->f_fd,psym,offset,size,
-        ep->f_filesize,errcode);
+    res = RRMOA(ep->f_fd,psym,(off_t)(ep->f_inner_offset+offset),size,
+        (off_t)(ep->f_inner_offset+ep->f_filesize),errcode);
     if (res!= DW_DLV_OK) {
         free(psym);
         free(gsym);
@@ -1110,9 +1114,9 @@ dwarf_load_elf_dynstr(
             return DW_DLV_ERROR;
         }
         res = RRMOA(ep->f_fd,ep->f_dynsym_sect_strings,
-            strpsh->gh_offset,
-            strsectlength,
-            ep->f_filesize,errcode);
+            (off_t)(ep->f_inner_offset+strpsh->gh_offset),
+            strsectlength,(off_t)(ep->f_inner_offset+ep->f_filesize),
+            errcode);
         if (res != DW_DLV_OK) {
             ep->f_dynsym_sect_strings = 0;
             ep->f_dynsym_sect_strings_max = 0;
@@ -1157,9 +1161,8 @@ _dwarf_load_elf_symstr(
         return DW_DLV_ERROR;
     }
     res = RRMOA(ep->f_fd,ep->f_symtab_sect_strings,
-        strpsh->gh_offset,
-        strsectlength,
-        ep->f_filesize,errcode);
+        (off_t)(ep->f_inner_offset+strpsh->gh_offset),strsectlength,
+        (off_t)(ep->f_inner_offset+ep->f_filesize),errcode);
     if (res != DW_DLV_OK) {
         free(ep->f_symtab_sect_strings);
         ep->f_symtab_sect_strings = 0;
@@ -1209,9 +1212,9 @@ _dwarf_elf_load_sectstrings(
         }
     }
     ep->f_elf_shstrings_length = psh->gh_size;
-    res = RRMOA(ep->f_fd,ep->f_elf_shstrings_data,secoffset,
-        psh->gh_size,
-        ep->f_filesize,errcode);
+    res = RRMOA(ep->f_fd,ep->f_elf_shstrings_data,
+        (off_t)(ep->f_inner_offset+secoffset),psh->gh_size,
+        (off_t)(ep->f_inner_offset+ep->f_filesize),errcode);
     return res;
 }
 
@@ -1238,8 +1241,8 @@ get_counts_from_sec32_zero(
 
     shd32 =  shd32zero;
     shdg  = shdgzero;
-    res = RRMOA(ep->f_fd,&shd32,offset,size,
-        ep->f_filesize,errcode);
+    res = RRMOA(ep->f_fd,&shd32,(off_t)(ep->f_inner_offset+offset),
+        size,(off_t)(ep->f_inner_offset+ep->f_filesize),errcode);
     if (res != DW_DLV_OK) {
         return res;
     }
@@ -1344,8 +1347,8 @@ get_counts_from_sec64_zero(
 
     shd64 =  shd64zero;
     shdg  = shdgzero;
-    res = RRMOA(ep->f_fd,&shd64,offset,size,
-        ep->f_filesize,errcode);
+    res = RRMOA(ep->f_fd,&shd64,(off_t)(ep->f_inner_offset+offset),
+        size,(off_t)(ep->f_inner_offset+ep->f_filesize),errcode);
     if (res != DW_DLV_OK) {
         return res;
     }
@@ -1517,8 +1520,9 @@ _dwarf_elf_load_a_relx_batch(
                 *errcode = DW_DLE_ALLOC_FAIL;
                 return DW_DLV_ERROR;
             }
-            res = RRMOA(ep->f_fd,relp,offset,size,
-                ep->f_filesize,errcode);
+            res = RRMOA(ep->f_fd,relp,
+                (off_t)(ep->f_inner_offset+offset),size,
+                (off_t)(ep->f_inner_offset+ep->f_filesize),errcode);
             if (res != DW_DLV_OK) {
                 free(relp);
                 free(grel);
@@ -1534,8 +1538,9 @@ _dwarf_elf_load_a_relx_batch(
                 *errcode = DW_DLE_ALLOC_FAIL;
                 return DW_DLV_ERROR;
             }
-            res = RRMOA(ep->f_fd,relp,offset,size,
-                ep->f_filesize,errcode);
+            res = RRMOA(ep->f_fd,relp,
+                (off_t)(ep->f_inner_offset+offset),size,
+                (off_t)(ep->f_inner_offset+ep->f_filesize),errcode);
             if (res != DW_DLV_OK) {
                 free(relp);
                 free(grel);
@@ -1553,8 +1558,9 @@ _dwarf_elf_load_a_relx_batch(
                 *errcode = DW_DLE_ALLOC_FAIL;
                 return DW_DLV_ERROR;
             }
-            res = RRMOA(ep->f_fd,relp,offset,size,
-                ep->f_filesize,errcode);
+            res = RRMOA(ep->f_fd,relp,
+                (off_t)(ep->f_inner_offset+offset),size,
+                (off_t)(ep->f_inner_offset+ep->f_filesize),errcode);
             if (res != DW_DLV_OK) {
                 free(relp);
                 free(grel);
@@ -1570,8 +1576,9 @@ _dwarf_elf_load_a_relx_batch(
                 *errcode = DW_DLE_ALLOC_FAIL;
                 return DW_DLV_ERROR;
             }
-            res = RRMOA(ep->f_fd,relp,offset,size,
-                ep->f_filesize,errcode);
+            res = RRMOA(ep->f_fd,relp,
+                (off_t)(ep->f_inner_offset+offset),size,
+                (off_t)(ep->f_inner_offset+ep->f_filesize),errcode);
             if (res != DW_DLV_OK) {
                 free(relp);
                 free(grel);
@@ -1775,8 +1782,9 @@ elf_load_elf_header32(
     struct generic_ehdr *ehdr = 0;
 
     ehdr32 = eh32_zero;
-    res = RRMOA(ep->f_fd,&ehdr32,0,sizeof(ehdr32),
-        ep->f_filesize,errcode);
+    res = RRMOA(ep->f_fd,&ehdr32,(off_t)ep->f_inner_offset,
+        sizeof(ehdr32),(off_t)(ep->f_inner_offset+ep->f_filesize),
+        errcode);
     if (res != DW_DLV_OK) {
         return res;
     }
@@ -1804,8 +1812,9 @@ elf_load_elf_header64(
     struct generic_ehdr *ehdr = 0;
 
     ehdr64 = eh64_zero;
-    res = RRMOA(ep->f_fd,&ehdr64,0,sizeof(ehdr64),
-        ep->f_filesize,errcode);
+    res = RRMOA(ep->f_fd,&ehdr64,(off_t)ep->f_inner_offset,
+        sizeof(ehdr64),(off_t)(ep->f_inner_offset+ep->f_filesize),
+        errcode);
     if (res != DW_DLV_OK) {
         return res;
     }
@@ -1967,8 +1976,9 @@ read_gs_section_group(
             *errcode = DW_DLE_ELF_SECTION_GROUP_ERROR;
             return DW_DLV_ERROR;
         }
-        res = RRMOA(ep->f_fd,data,psh->gh_offset,seclen,
-            ep->f_filesize,errcode);
+        res = RRMOA(ep->f_fd,data,
+            (off_t)(ep->f_inner_offset+psh->gh_offset),seclen,
+            (off_t)(ep->f_inner_offset+ep->f_filesize),errcode);
         if (res != DW_DLV_OK) {
             free(data);
             return res;
@@ -2086,9 +2096,26 @@ _dwarf_elf_setup_all_section_groups(
     Dwarf_Unsigned i = 0;
     Dwarf_Unsigned count = 0;
     int res = 0;
+    int read_groups = TRUE;
 
     count = ep->f_loc_shdr.g_count;
     psh = ep->f_shdr;
+    if (ep->f_wanted_sections) {
+        /*  A section subset needs the SHT_GROUP
+            contents only if a wanted section is
+            in a group. */
+        read_groups = FALSE;
+        for (i = 0; i < count; ++psh,++i) {
+            if (elf_flagmatches(psh->gh_flags,SHF_GROUP) &&
+                _dwarf_section_is_wanted(ep->f_wanted_sections,
+                ep->f_wanted_section_count,
+                psh->gh_namestring)) {
+                read_groups = TRUE;
+                break;
+            }
+        }
+        psh = ep->f_shdr;
+    }
 
     /* Does step A and step B */
     for (i = 0; i < count; ++psh,++i) {
@@ -2105,6 +2132,9 @@ _dwarf_elf_setup_all_section_groups(
             }
             continue;
         }
+        if (!read_groups) {
+            continue;
+        }
         /* Looks like a section group. Do Step A. */
         res  =read_gs_section_group(ep,psh,errcode);
         if (res != DW_DLV_OK) {
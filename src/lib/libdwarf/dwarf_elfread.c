@@ -89,6 +89,7 @@ EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "dwarf_elf_defines.h"
 #include "dwarf_elf_rel_detector.h"
 #include "dwarf_elfread.h"
+#include "dwarf_secname_ck.h" /* _dwarf_section_is_wanted() */
 
 #ifndef TYP
 #define TYP(n,l) char (n)[(l)]
@@ -132,7 +133,10 @@ _dwarf_elf_object_access_init(
     unsigned ftype,
     unsigned endian,
     unsigned offsetsize,
+    Dwarf_Unsigned fileoffsetbase,
     size_t filesize,
+    const char **wanted_sections,
+    unsigned wanted_section_count,
     Dwarf_Obj_Access_Interface_a **binary_interface,
     int *localerrnum);
 
@@ -251,10 +255,10 @@ elf_load_nolibelf_section (void *obj, Dwarf_Unsigned section_index,
             if (read_size > read_size_limit) {
                 read_size = read_size_limit;
             }
-            res = RRMOA(elf->f_fd,
-                (void *)read_target, (off_t)read_offset,
+            res = RRMOA(elf->f_fd,(void *)read_target,
+                (off_t)(elf->f_inner_offset+read_offset),
                 (size_t)read_size,
-                (off_t)elf->f_filesize, error);
+                (off_t)(elf->f_inner_offset+elf->f_filesize),error);
             if (res != DW_DLV_OK) {
                 free(sp->gh_content);
                 sp->gh_content = 0;
@@ -590,6 +594,30 @@ _dwarf_elf_nlsetup(int fd,
     Dwarf_Handler errhand,
     Dwarf_Ptr errarg,
     Dwarf_Debug *dbg,Dwarf_Error *error)
+{
+    return _dwarf_elf_nlsetup_a(fd,true_path,
+        ftype,endian,offsetsize,0,filesize,
+        groupnumber,0,0,errhand,errarg,dbg,error);
+}
+
+/*  As _dwarf_elf_nlsetup() but the object starts
+    fileoffsetbase bytes into fd (an archive member)
+    and is filesize bytes long, and if wanted_sections
+    is non-null only those sections are set up. */
+int
+_dwarf_elf_nlsetup_a(int fd,
+    char *true_path,
+    unsigned ftype,
+    unsigned endian,
+    unsigned offsetsize,
+    Dwarf_Unsigned fileoffsetbase,
+    size_t filesize,
+    unsigned groupnumber,
+    const char **wanted_sections,
+    unsigned wanted_section_count,
+    Dwarf_Handler errhand,
+    Dwarf_Ptr errarg,
+    Dwarf_Debug *dbg,Dwarf_Error *error)
 {
     Dwarf_Obj_Access_Interface_a *binary_interface = 0;
     dwarf_elf_object_access_internals_t *intfc = 0;
@@ -598,7 +626,8 @@ _dwarf_elf_nlsetup(int fd,
 
     res = _dwarf_elf_object_access_init(
         fd,
-        ftype,endian,offsetsize,filesize,
+        ftype,endian,offsetsize,fileoffsetbase,filesize,
+        wanted_sections,wanted_section_count,
         &binary_interface,
         &localerrnum);
     if (res != DW_DLV_OK) {
@@ -610,8 +639,9 @@ _dwarf_elf_nlsetup(int fd,
     }
     /*  allocates and initializes Dwarf_Debug,
         generic code */
-    res = dwarf_object_init_b(binary_interface, errhand, errarg,
-        groupnumber, dbg, error);
+    res = _dwarf_object_init_c(binary_interface, errhand, errarg,
+        groupnumber, wanted_sections,wanted_section_count,
+        dbg, error);
     if (res != DW_DLV_OK){
         _dwarf_destruct_elf_nlaccess(binary_interface);
         return res;
@@ -620,6 +650,9 @@ _dwarf_elf_nlsetup(int fd,
     intfc->f_path = strdup(true_path);
     (*dbg)->de_obj_machine = intfc->f_machine;
     (*dbg)->de_obj_flags = intfc->f_flags;
+    (*dbg)->de_obj_read_fd = intfc->f_fd;
+    (*dbg)->de_obj_read_fd_valid = TRUE;
+    (*dbg)->de_obj_read_offset = intfc->f_inner_offset;
     return res;
 }
 
@@ -637,6 +670,52 @@ static Dwarf_Obj_Access_Methods_a const elf_nlmethods = {
     elf_relocations_nolibelf
 };
 
+/*  For a section subset: are the relocations in
+    rel/rela section shp for a wanted section? */
+static int
+reloc_target_wanted(dwarf_elf_object_access_internals_t *ep,
+    struct generic_shdr *shp)
+{
+    struct generic_shdr *target = 0;
+
+    if (!ep->f_wanted_sections) {
+        return TRUE;
+    }
+    if (!shp->gh_reloc_target_secnum) {
+        /*  Dynamic relocations, as in .rela.dyn. */
+        return FALSE;
+    }
+    if (shp->gh_reloc_target_secnum >= ep->f_loc_shdr.g_count) {
+        /*  Let _dwarf_load_elf_relx() report it. */
+        return TRUE;
+    }
+    target = ep->f_shdr + shp->gh_reloc_target_secnum;
+    return _dwarf_section_is_wanted(ep->f_wanted_sections,
+        ep->f_wanted_section_count,target->gh_namestring);
+}
+
+/*  Executables and shared objects have no relocations
+    for DWARF sections, so a section subset usually
+    lets us skip reading .symtab and .strtab. */
+static int
+wanted_sections_have_relocations(
+    dwarf_elf_object_access_internals_t *ep)
+{
+    Dwarf_Unsigned i = 0;
+
+    for (i = 1; i < ep->f_loc_shdr.g_count; ++i) {
+        struct generic_shdr *shp = ep->f_shdr + i;
+
+        if (shp->gh_type != SHT_REL && shp->gh_type != SHT_RELA) {
+            continue;
+        }
+        if (reloc_target_wanted(ep,shp)) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
 /*  On any error this frees internals argument. */
 static int
 _dwarf_elf_object_access_internals_init(
@@ -645,7 +724,10 @@ _dwarf_elf_object_access_internals_init(
     unsigned ftype,
     unsigned endian,
     unsigned offsetsize,
+    Dwarf_Unsigned fileoffsetbase,
     size_t filesize,
+    const char **wanted_sections,
+    unsigned wanted_section_count,
     int *errcode)
 {
     dwarf_elf_object_access_internals_t * intfc = internals;
@@ -670,9 +752,12 @@ _dwarf_elf_object_access_internals_init(
     intfc->f_is_64bit    = ((offsetsize==64)?TRUE:FALSE);
     intfc->f_offsetsize  = (Dwarf_Small)offsetsize;
     intfc->f_pointersize = (Dwarf_Small)offsetsize;
+    intfc->f_inner_offset = fileoffsetbase;
     intfc->f_filesize    = filesize;
     intfc->f_ftype       = ftype;
     intfc->f_destruct_close_fd = FALSE;
+    intfc->f_wanted_sections = wanted_sections;
+    intfc->f_wanted_section_count = wanted_section_count;
 
 #ifdef WORDS_BIGENDIAN
     if (endian == DW_END_little ) {
@@ -709,22 +794,26 @@ _dwarf_elf_object_access_internals_init(
         localdoas = 0;
         return res;
     }
-    /* We are not looking at symbol strings for now. */
-    res = _dwarf_load_elf_symstr(intfc,errcode);
-    if (res == DW_DLV_ERROR) {
-        localdoas->ai_object = intfc;
-        localdoas->ai_methods = 0;
-        _dwarf_destruct_elf_nlaccess(localdoas);
-        localdoas = 0;
-        return res;
-    }
-    res  = _dwarf_load_elf_symtab_symbols(intfc,errcode);
-    if (res == DW_DLV_ERROR) {
-        localdoas->ai_object = intfc;
-        localdoas->ai_methods = 0;
-        _dwarf_destruct_elf_nlaccess(localdoas);
-        localdoas = 0;
-        return res;
+    if (!intfc->f_wanted_sections ||
+        wanted_sections_have_relocations(intfc)) {
+        /*  The symbols are only used to apply
+            relocations to DWARF sections. */
+        res = _dwarf_load_elf_symstr(intfc,errcode);
+        if (res == DW_DLV_ERROR) {
+            localdoas->ai_object = intfc;
+            localdoas->ai_methods = 0;
+            _dwarf_destruct_elf_nlaccess(localdoas);
+            localdoas = 0;
+            return res;
+        }
+        res  = _dwarf_load_elf_symtab_symbols(intfc,errcode);
+        if (res == DW_DLV_ERROR) {
+            localdoas->ai_object = intfc;
+            localdoas->ai_methods = 0;
+            _dwarf_destruct_elf_nlaccess(localdoas);
+            localdoas = 0;
+            return res;
+        }
     }
     for ( i = 1; i < intfc->f_loc_shdr.g_count; ++i) {
         struct generic_shdr *shp = 0;
@@ -747,6 +836,9 @@ _dwarf_elf_object_access_internals_init(
         } else {
             continue;
         }
+        if (!reloc_target_wanted(intfc,shp)) {
+            continue;
+        }
         /*  ASSERT: local rel is either RelocIsRel or
             RelocIsRela. Never any other value. */
         /*  Possibly we should check if the target section
@@ -761,6 +853,9 @@ _dwarf_elf_object_access_internals_init(
             return res;
         }
     }
+    /*  The names belong to the caller. */
+    intfc->f_wanted_sections = 0;
+    intfc->f_wanted_section_count = 0;
     free(localdoas);
     localdoas = 0;
     return DW_DLV_OK;
@@ -772,7 +867,10 @@ _dwarf_elf_object_access_init(
     unsigned ftype,
     unsigned endian,
     unsigned offsetsize,
+    Dwarf_Unsigned fileoffsetbase,
     size_t filesize,
+    const char **wanted_sections,
+    unsigned wanted_section_count,
     Dwarf_Obj_Access_Interface_a **binary_interface,
     int *localerrnum)
 {
@@ -790,7 +888,8 @@ _dwarf_elf_object_access_init(
     memset(internals,0,sizeof(*internals));
     res = _dwarf_elf_object_access_internals_init(internals,
         fd,
-        ftype, endian, offsetsize, filesize,
+        ftype, endian, offsetsize, fileoffsetbase, filesize,
+        wanted_sections,wanted_section_count,
         localerrnum);
     if (res != DW_DLV_OK){
         return res;
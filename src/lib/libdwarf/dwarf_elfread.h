@@ -185,6 +185,9 @@ typedef struct elf_filedata_s {
     int            f_destruct_close_fd;
     int            f_is_64bit;
     unsigned       f_endian;
+    /*  Non-zero when the object is a member of an
+        archive: every file offset is relative to it. */
+    Dwarf_Unsigned f_inner_offset;
     Dwarf_Unsigned f_filesize;
     Dwarf_Unsigned f_flags;
     /* Elf size, not DWARF. 32 or 64 */
@@ -241,6 +244,12 @@ typedef struct elf_filedata_s {
     Dwarf_Unsigned f_sht_group_type_section_count;
     Dwarf_Unsigned f_shf_group_flag_section_count;
     Dwarf_Unsigned f_dwo_group_section_count;
+
+    /*  Set only during setup for
+        dwarf_init_path_sections(): the standard names
+        of the wanted sections. NULL means all. */
+    const char   **f_wanted_sections;
+    unsigned       f_wanted_section_count;
 } dwarf_elf_object_access_internals_t;
 
 int dwarf_construct_elf_access(int fd,
@@ -686,6 +686,8 @@ static const char _dwarf_errmsgs[DW_DLE_LAST+1][DW_MAX_MSG_LEN] = {
 {"DW_DLE_UNIVERSAL_BINARY_ERROR(502) Error reading Mach-O "
     "uninversal binary head. Corrupt Mach-O object." },
 {"DW_DLE_UNIV_BIN_OFFSET_SIZE_ERROR(503) Offset/size from "
-    "a Mach-O universal binary has an impossible value"}
+    "a Mach-O universal binary has an impossible value"},
+{"DW_DLE_ARCHIVE_ERROR(504) A member header or offset in "
+    "a static (ar) archive is corrupt or unsupported"}
 };
 #endif /* DWARF_ERRMSG_LIST_H */
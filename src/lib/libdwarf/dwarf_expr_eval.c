@@ -0,0 +1,1121 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it
+  and/or modify it under the terms of version 2.1 of the
+  GNU Lesser General Public License as published by the Free
+  Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General
+  Public License along with this program; if not, write the
+  Free Software Foundation, Inc., 51 Franklin Street - Fifth
+  Floor, Boston MA 02110-1301, USA.
+
+*/
+
+/*  Evaluation of DWARF expressions.
+    An expression is compiled once: the DW_OP aliases
+    are folded, constants (including .debug_addr
+    indexes) resolved and branch offsets turned into
+    instruction indexes. A piece (or a whole expression)
+    that is a single DW_OP_fbreg, DW_OP_breg*, DW_OP_reg*
+    or constant address is marked so evaluating it
+    does not run the stack machine. */
+
+#include <config.h>
+
+#include <stdlib.h> /* calloc() free() malloc() realloc() */
+#include <string.h> /* memcmp() memcpy() memset() */
+
+#if defined(_WIN32) && defined(HAVE_STDAFX_H)
+#include "stdafx.h"
+#endif /* HAVE_STDAFX_H */
+
+#ifdef HAVE_STDINT_H
+#include <stdint.h> /* uintptr_t */
+#endif /* HAVE_STDINT_H */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "libdwarf_private.h"
+#include "dwarf_base_types.h"
+#include "dwarf_opaque.h"
+#include "dwarf_alloc.h"
+#include "dwarf_error.h"
+#include "dwarf_util.h"
+#include "dwarf_loc.h"
+#include "dwarf_tsearch.h"
+#include "dwarf_expr_eval.h"
+
+/*  Limits on evaluation, so a corrupt
+    expression cannot loop forever. */
+#define EXPR_STACK_MAX 64
+#define EXPR_OP_LIMIT  10000
+
+static int
+expr_error(Dwarf_Debug dbg, Dwarf_Error *error, const char *msg)
+{
+    _dwarf_error_string(dbg,error,DW_DLE_LOC_EXPR_BAD,(char *)msg);
+    return DW_DLV_ERROR;
+}
+
+static Dwarf_Unsigned
+address_mask(Dwarf_Half size)
+{
+    if (!size || size >= sizeof(Dwarf_Unsigned)) {
+        return ~(Dwarf_Unsigned)0;
+    }
+    return ((Dwarf_Unsigned)1 << (size*8)) - 1;
+}
+
+/*  Values on the stack are of the generic type, an
+    address-sized integer, signed for the signed
+    operations. */
+static Dwarf_Signed
+to_signed(Dwarf_Unsigned v, Dwarf_Unsigned mask)
+{
+    if (mask != ~(Dwarf_Unsigned)0 && (v & (mask ^ (mask >> 1)))) {
+        v |= ~mask;
+    }
+    return (Dwarf_Signed)v;
+}
+
+static DW_TSHASHTYPE
+program_hashfunc(const void *keyp)
+{
+    const struct Dwarf_Expr_Program_s *p = keyp;
+
+    return (DW_TSHASHTYPE)(uintptr_t)p->xp_key;
+}
+
+static int
+program_compare(const void *l, const void *r)
+{
+    const struct Dwarf_Expr_Program_s *lp = l;
+    const struct Dwarf_Expr_Program_s *rp = r;
+    uintptr_t lk = (uintptr_t)lp->xp_key;
+    uintptr_t rk = (uintptr_t)rp->xp_key;
+
+    if (lk != rk) {
+        return lk < rk ? -1 : 1;
+    }
+    lk = (uintptr_t)lp->xp_context;
+    rk = (uintptr_t)rp->xp_context;
+    if (lk != rk) {
+        return lk < rk ? -1 : 1;
+    }
+    return 0;
+}
+
+static void
+free_program(struct Dwarf_Expr_Program_s *p)
+{
+    free(p->xp_bytes);
+    free(p->xp_insns);
+    free(p->xp_segments);
+    free(p);
+}
+
+static void
+free_program_chain(void *node)
+{
+    struct Dwarf_Expr_Program_s *p = node;
+
+    while (p) {
+        struct Dwarf_Expr_Program_s *next = p->xp_next;
+
+        free_program(p);
+        p = next;
+    }
+}
+
+void
+_dwarf_destroy_expr_programs(Dwarf_Debug dbg)
+{
+    if (dbg->de_expr_tree) {
+        dwarf_tdestroy(dbg->de_expr_tree,free_program_chain);
+        dbg->de_expr_tree = 0;
+    }
+}
+
+static struct Dwarf_Expr_Program_s *
+find_program(Dwarf_Debug dbg,
+    Dwarf_Small *bytes,
+    Dwarf_Unsigned len,
+    Dwarf_Half address_size,
+    Dwarf_CU_Context context)
+{
+    struct Dwarf_Expr_Program_s key;
+    struct Dwarf_Expr_Program_s *p = 0;
+    void *found = 0;
+
+    if (!dbg->de_expr_tree) {
+        dwarf_initialize_search_hash(&dbg->de_expr_tree,
+            program_hashfunc,0);
+    }
+    memset(&key,0,sizeof(key));
+    key.xp_key = bytes;
+    key.xp_context = context;
+    found = dwarf_tfind(&key,&dbg->de_expr_tree,program_compare);
+    if (!found) {
+        return 0;
+    }
+    for (p = *(struct Dwarf_Expr_Program_s **)found; p;
+        p = p->xp_next) {
+        if (p->xp_bytes_len == len &&
+            p->xp_address_size == address_size &&
+            (!len || !memcmp(p->xp_bytes,bytes,len))) {
+            return p;
+        }
+    }
+    return 0;
+}
+
+static int
+insert_program(Dwarf_Debug dbg,
+    struct Dwarf_Expr_Program_s *prog,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Expr_Program_s *head = 0;
+    void *found = 0;
+
+    found = dwarf_tsearch(prog,&dbg->de_expr_tree,program_compare);
+    if (!found) {
+        free_program(prog);
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: adding a compiled "
+            "expression to the cache");
+        return DW_DLV_ERROR;
+    }
+    head = *(struct Dwarf_Expr_Program_s **)found;
+    if (head != prog) {
+        /*  Same address, different bytes: the earlier
+            block was freed. Earlier programs stay valid. */
+        prog->xp_next = head->xp_next;
+        head->xp_next = prog;
+    }
+    return DW_DLV_OK;
+}
+
+/*  The index of the operator starting at byte offset
+    'target', op_count if target is the end of the
+    expression, or -1 for no operator. */
+static Dwarf_Signed
+op_at_offset(Dwarf_Loc_Expr_Op ops, Dwarf_Unsigned op_count,
+    Dwarf_Unsigned len, Dwarf_Unsigned target)
+{
+    Dwarf_Unsigned low = 0;
+    Dwarf_Unsigned high = op_count;
+
+    if (target == len) {
+        return (Dwarf_Signed)op_count;
+    }
+    while (low < high) {
+        Dwarf_Unsigned middle = low + (high - low)/2;
+
+        if (ops[middle].lr_offset < target) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    if (low < op_count && ops[low].lr_offset == target) {
+        return (Dwarf_Signed)low;
+    }
+    return -1;
+}
+
+static int
+is_piece_op(Dwarf_Small atom)
+{
+    return atom == DW_OP_piece || atom == DW_OP_bit_piece;
+}
+
+/*  Folds one operator into insn. */
+static int
+compile_op(Dwarf_Debug dbg,
+    Dwarf_Loc_Expr_Op op,
+    Dwarf_Small *bytes,
+    Dwarf_Unsigned len,
+    Dwarf_CU_Context context,
+    struct Dwarf_Expr_Insn_s *insn,
+    Dwarf_Error *error)
+{
+    Dwarf_Small atom = op->lr_atom;
+    int res = 0;
+
+    insn->xi_op = atom;
+    insn->xi_number = op->lr_number;
+    insn->xi_number2 = op->lr_number2;
+    if (atom >= DW_OP_lit0 && atom <= DW_OP_lit31) {
+        insn->xi_op = DW_OP_constu;
+        insn->xi_number = atom - DW_OP_lit0;
+        return DW_DLV_OK;
+    }
+    if (atom >= DW_OP_reg0 && atom <= DW_OP_reg31) {
+        insn->xi_op = DW_OP_regx;
+        insn->xi_number = atom - DW_OP_reg0;
+        return DW_DLV_OK;
+    }
+    if (atom >= DW_OP_breg0 && atom <= DW_OP_breg31) {
+        insn->xi_op = DW_OP_bregx;
+        insn->xi_number = atom - DW_OP_breg0;
+        insn->xi_number2 = op->lr_number;
+        return DW_DLV_OK;
+    }
+    switch (atom) {
+    case DW_OP_addr:
+    case DW_OP_const1u:
+    case DW_OP_const1s:
+    case DW_OP_const2u:
+    case DW_OP_const2s:
+    case DW_OP_const4u:
+    case DW_OP_const4s:
+    case DW_OP_const8u:
+    case DW_OP_const8s:
+    case DW_OP_constu:
+    case DW_OP_consts:
+        insn->xi_op = DW_OP_constu;
+        break;
+    case DW_OP_addrx:
+    case DW_OP_GNU_addr_index:
+    case DW_OP_constx:
+    case DW_OP_GNU_const_index: {
+        Dwarf_Addr value = 0;
+
+        if (!context) {
+            /*  From dwarf_loclist_from_expr_c(),
+                there is no CU to find .debug_addr with. */
+            insn->xi_op = DW_EXPR_OP_UNAVAILABLE;
+            break;
+        }
+        res = _dwarf_look_in_local_and_tied_by_index(dbg,
+            context,op->lr_number,&value,error);
+        if (res == DW_DLV_ERROR && error &&
+            dwarf_errno(*error) ==
+            DW_DLE_MISSING_NEEDED_DEBUG_ADDR_SECTION) {
+            /*  A .dwo without its executable: the
+                value is just not known here. */
+            dwarf_dealloc(dbg,*error,DW_DLA_ERROR);
+            *error = 0;
+            insn->xi_op = DW_EXPR_OP_UNAVAILABLE;
+            break;
+        }
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        insn->xi_op = DW_OP_constu;
+        insn->xi_number = value;
+        }
+        break;
+    case DW_OP_regx:
+    case DW_OP_bregx:
+    case DW_OP_fbreg:
+    case DW_OP_dup:
+    case DW_OP_drop:
+    case DW_OP_over:
+    case DW_OP_pick:
+    case DW_OP_swap:
+    case DW_OP_rot:
+    case DW_OP_deref:
+    case DW_OP_abs:
+    case DW_OP_and:
+    case DW_OP_div:
+    case DW_OP_minus:
+    case DW_OP_mod:
+    case DW_OP_mul:
+    case DW_OP_neg:
+    case DW_OP_not:
+    case DW_OP_or:
+    case DW_OP_plus:
+    case DW_OP_plus_uconst:
+    case DW_OP_shl:
+    case DW_OP_shr:
+    case DW_OP_shra:
+    case DW_OP_xor:
+    case DW_OP_eq:
+    case DW_OP_ge:
+    case DW_OP_gt:
+    case DW_OP_le:
+    case DW_OP_lt:
+    case DW_OP_ne:
+    case DW_OP_skip:
+    case DW_OP_bra:
+    case DW_OP_nop:
+    case DW_OP_push_object_address:
+    case DW_OP_form_tls_address:
+    case DW_OP_call_frame_cfa:
+    case DW_OP_stack_value:
+        break;
+    case DW_OP_GNU_push_tls_address:
+        insn->xi_op = DW_OP_form_tls_address;
+        break;
+    case DW_OP_GNU_implicit_pointer:
+    case DW_OP_implicit_pointer:
+        insn->xi_op = DW_OP_implicit_pointer;
+        break;
+    case DW_OP_deref_size:
+        if (!op->lr_number || op->lr_number > sizeof(Dwarf_Unsigned)) {
+            return expr_error(dbg,error,
+                "DW_DLE_LOC_EXPR_BAD: DW_OP_deref_size "
+                "size is zero or larger than 8");
+        }
+        break;
+    case DW_OP_implicit_value: {
+        /*  lr_number2 points at the value bytes in the
+            expression, make it an offset into xp_bytes. */
+        Dwarf_Small *data =
+            (Dwarf_Small *)(uintptr_t)op->lr_number2;
+
+        if (data < bytes || op->lr_number > len ||
+            (Dwarf_Unsigned)(data - bytes) > len - op->lr_number) {
+            return expr_error(dbg,error,
+                "DW_DLE_LOC_EXPR_BAD: DW_OP_implicit_value "
+                "data is not inside the expression");
+        }
+        insn->xi_number2 = (Dwarf_Unsigned)(data - bytes);
+        }
+        break;
+    default:
+        insn->xi_op = DW_EXPR_OP_UNAVAILABLE;
+        break;
+    }
+    return DW_DLV_OK;
+}
+
+static void
+set_segment_shape(struct Dwarf_Expr_Program_s *prog,
+    struct Dwarf_Expr_Segment_s *seg)
+{
+    struct Dwarf_Expr_Insn_s *insn = prog->xp_insns + seg->xs_first;
+
+    seg->xs_shape = DW_EXPR_SHAPE_GENERAL;
+    if (!seg->xs_count) {
+        seg->xs_shape = DW_EXPR_SHAPE_EMPTY;
+        return;
+    }
+    if (seg->xs_count != 1) {
+        return;
+    }
+    switch (insn->xi_op) {
+    case DW_OP_regx:
+        seg->xs_shape = DW_EXPR_SHAPE_REG;
+        break;
+    case DW_OP_fbreg:
+        seg->xs_shape = DW_EXPR_SHAPE_FBREG;
+        break;
+    case DW_OP_bregx:
+        seg->xs_shape = DW_EXPR_SHAPE_BREG;
+        break;
+    case DW_OP_constu:
+        seg->xs_shape = DW_EXPR_SHAPE_ADDR;
+        break;
+    default:
+        break;
+    }
+}
+
+/*  Builds the program from decoded operators.
+    Pieces end segments and are not instructions.
+    Nor is DW_OP_GNU_uninit, which only says the
+    value may not be initialized yet. */
+static int
+compile_ops(Dwarf_Debug dbg,
+    Dwarf_Loc_Expr_Op ops,
+    Dwarf_Unsigned op_count,
+    Dwarf_Small *bytes,
+    Dwarf_Unsigned len,
+    Dwarf_Half address_size,
+    Dwarf_CU_Context context,
+    struct Dwarf_Expr_Program_s **prog_out,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Expr_Program_s *prog = 0;
+    /*  For operator i, the instruction it became (or,
+        for a piece, the next one) and its segment.
+        Entry op_count is the end of the expression. */
+    Dwarf_Unsigned *insn_of_op = 0;
+    Dwarf_Unsigned *seg_of_op = 0;
+    Dwarf_Unsigned insn_count = 0;
+    Dwarf_Unsigned seg_count = 0;
+    Dwarf_Unsigned seg_first = 0;
+    Dwarf_Unsigned i = 0;
+    int res = DW_DLV_OK;
+
+    prog = (struct Dwarf_Expr_Program_s *)calloc(1,
+        sizeof(struct Dwarf_Expr_Program_s));
+    insn_of_op = (Dwarf_Unsigned *)malloc((op_count+1)*
+        sizeof(Dwarf_Unsigned));
+    seg_of_op = (Dwarf_Unsigned *)malloc((op_count+1)*
+        sizeof(Dwarf_Unsigned));
+    if (prog) {
+        prog->xp_bytes = (Dwarf_Small *)malloc(len?len:1);
+        prog->xp_insns = (struct Dwarf_Expr_Insn_s *)calloc(
+            op_count?op_count:1,sizeof(struct Dwarf_Expr_Insn_s));
+        prog->xp_segments = (struct Dwarf_Expr_Segment_s *)calloc(
+            op_count+1,sizeof(struct Dwarf_Expr_Segment_s));
+    }
+    if (!prog || !insn_of_op || !seg_of_op || !prog->xp_bytes ||
+        !prog->xp_insns || !prog->xp_segments) {
+        if (prog) {
+            free_program(prog);
+        }
+        free(insn_of_op);
+        free(seg_of_op);
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: compiling a DWARF expression");
+        return DW_DLV_ERROR;
+    }
+    prog->xp_dbg = dbg;
+    prog->xp_key = bytes;
+    prog->xp_context = context;
+    prog->xp_address_size = address_size;
+    prog->xp_bytes_len = len;
+    if (len) {
+        memcpy(prog->xp_bytes,bytes,len);
+    }
+
+    for (i = 0; i < op_count; ++i) {
+        insn_of_op[i] = insn_count;
+        seg_of_op[i] = seg_count;
+        if (is_piece_op(ops[i].lr_atom)) {
+            ++seg_count;
+        } else if (ops[i].lr_atom != DW_OP_GNU_uninit) {
+            ++insn_count;
+        }
+    }
+    insn_of_op[op_count] = insn_count;
+    seg_of_op[op_count] = seg_count;
+
+    insn_count = 0;
+    seg_count = 0;
+    for (i = 0; i < op_count && res == DW_DLV_OK; ++i) {
+        Dwarf_Loc_Expr_Op op = ops + i;
+
+        if (is_piece_op(op->lr_atom)) {
+            struct Dwarf_Expr_Segment_s *seg =
+                prog->xp_segments + seg_count++;
+
+            seg->xs_first = seg_first;
+            seg->xs_count = insn_count - seg_first;
+            if (op->lr_atom == DW_OP_piece) {
+                seg->xs_size_bits = op->lr_number*8;
+            } else {
+                seg->xs_size_bits = op->lr_number;
+                seg->xs_bit_offset = op->lr_number2;
+            }
+            if (!seg->xs_size_bits) {
+                res = expr_error(dbg,error,
+                    "DW_DLE_LOC_EXPR_BAD: DW_OP_piece or "
+                    "DW_OP_bit_piece of size zero");
+            }
+            seg_first = insn_count;
+            continue;
+        }
+        if (op->lr_atom == DW_OP_GNU_uninit) {
+            continue;
+        }
+        res = compile_op(dbg,op,bytes,len,context,
+            prog->xp_insns + insn_count,error);
+        if (res == DW_DLV_OK && (op->lr_atom == DW_OP_skip ||
+            op->lr_atom == DW_OP_bra)) {
+            Dwarf_Unsigned next_off = (i+1 < op_count)?
+                ops[i+1].lr_offset:len;
+            Dwarf_Unsigned target = next_off + op->lr_number;
+            Dwarf_Signed j = op_at_offset(ops,op_count,len,target);
+
+            if (j < 0) {
+                res = expr_error(dbg,error,
+                    "DW_DLE_LOC_EXPR_BAD: DW_OP_skip or DW_OP_bra "
+                    "target is not the start of an operator");
+            } else if (seg_of_op[j] != seg_of_op[i]) {
+                res = expr_error(dbg,error,
+                    "DW_DLE_LOC_EXPR_BAD: DW_OP_skip or DW_OP_bra "
+                    "branches into another DW_OP_piece");
+            } else {
+                prog->xp_insns[insn_count].xi_number = insn_of_op[j];
+            }
+        }
+        ++insn_count;
+    }
+    if (res == DW_DLV_OK) {
+        if (!seg_count || insn_count > seg_first) {
+            if (seg_count) {
+                res = expr_error(dbg,error,
+                    "DW_DLE_LOC_EXPR_BAD: operations follow "
+                    "the last DW_OP_piece");
+            } else {
+                prog->xp_segments[0].xs_first = 0;
+                prog->xp_segments[0].xs_count = insn_count;
+                seg_count = 1;
+            }
+        }
+    }
+    free(insn_of_op);
+    free(seg_of_op);
+    if (res != DW_DLV_OK) {
+        free_program(prog);
+        return res;
+    }
+    prog->xp_insn_count = insn_count;
+    prog->xp_segment_count = seg_count;
+    for (i = 0; i < seg_count; ++i) {
+        set_segment_shape(prog,prog->xp_segments + i);
+    }
+    *prog_out = prog;
+    return DW_DLV_OK;
+}
+
+int
+dwarf_expr_compile(Dwarf_Locdesc_c locdesc,
+    Dwarf_Expr_Program *program_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Loc_Head_c head = 0;
+    Dwarf_Debug dbg = 0;
+    struct Dwarf_Expr_Program_s *prog = 0;
+    Dwarf_Small *bytes = 0;
+    Dwarf_Unsigned len = 0;
+    int res = 0;
+
+    if (!locdesc || locdesc->ld_magic != LOCLISTS_MAGIC ||
+        !locdesc->ld_loclist_head) {
+        _dwarf_error_string(0,error,DW_DLE_LOCLIST_INTERFACE_ERROR,
+            "DW_DLE_LOCLIST_INTERFACE_ERROR: "
+            "dwarf_expr_compile() passed a NULL or stale "
+            "Dwarf_Locdesc_c");
+        return DW_DLV_ERROR;
+    }
+    head = locdesc->ld_loclist_head;
+    dbg = head->ll_dbg;
+    CHECK_DBG(dbg,error,"dwarf_expr_compile()");
+    if (!program_out) {
+        _dwarf_error_string(dbg,error,DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_expr_compile() passed a NULL program_out");
+        return DW_DLV_ERROR;
+    }
+    bytes = locdesc->ld_opsblock.bl_data;
+    len = locdesc->ld_opsblock.bl_len;
+    if (!bytes) {
+        len = 0;
+    }
+    prog = find_program(dbg,bytes,len,
+        (Dwarf_Half)head->ll_address_size,head->ll_context);
+    if (prog) {
+        *program_out = prog;
+        return DW_DLV_OK;
+    }
+    res = compile_ops(dbg,locdesc->ld_s,locdesc->ld_cents,
+        bytes,len,(Dwarf_Half)head->ll_address_size,
+        head->ll_context,&prog,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = insert_program(dbg,prog,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    *program_out = prog;
+    return DW_DLV_OK;
+}
+
+/*  For expressions that are not in a Dwarf_Locdesc_c,
+    such as those of the frame tables. */
+int
+_dwarf_expr_compile_bytes(Dwarf_Debug dbg,
+    Dwarf_Small   *bytes,
+    Dwarf_Unsigned len,
+    Dwarf_Half     address_size,
+    Dwarf_Half     offset_size,
+    Dwarf_Half     version,
+    Dwarf_Expr_Program *program_out,
+    Dwarf_Error   *error)
+{
+    struct Dwarf_Expr_Program_s *prog = 0;
+    struct Dwarf_Loc_Expr_Op_s *ops = 0;
+    Dwarf_Unsigned op_count = 0;
+    Dwarf_Unsigned op_alloc = 0;
+    Dwarf_Unsigned offset = 0;
+    Dwarf_Block_c block;
+    int res = 0;
+
+    prog = find_program(dbg,bytes,len,address_size,0);
+    if (prog) {
+        *program_out = prog;
+        return DW_DLV_OK;
+    }
+    memset(&block,0,sizeof(block));
+    block.bl_data = bytes;
+    block.bl_len = len;
+    for (;;) {
+        Dwarf_Unsigned nextoffset = 0;
+
+        if (op_count >= op_alloc) {
+            Dwarf_Unsigned newalloc = op_alloc? op_alloc*2:16;
+            struct Dwarf_Loc_Expr_Op_s *newops =
+                (struct Dwarf_Loc_Expr_Op_s *)realloc(ops,
+                newalloc*sizeof(struct Dwarf_Loc_Expr_Op_s));
+
+            if (!newops) {
+                free(ops);
+                _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+                    "DW_DLE_ALLOC_FAIL: decoding a DWARF "
+                    "expression");
+                return DW_DLV_ERROR;
+            }
+            ops = newops;
+            op_alloc = newalloc;
+        }
+        res = _dwarf_read_loc_expr_op(dbg,&block,
+            (Dwarf_Signed)op_count,version,offset_size,
+            address_size,(Dwarf_Signed)offset,bytes+len,
+            &nextoffset,ops+op_count,error);
+        if (res == DW_DLV_ERROR) {
+            free(ops);
+            return res;
+        }
+        if (res == DW_DLV_NO_ENTRY) {
+            break;
+        }
+        ++op_count;
+        offset = nextoffset;
+    }
+    res = compile_ops(dbg,ops,op_count,bytes,len,address_size,
+        0,&prog,error);
+    free(ops);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = insert_program(dbg,prog,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    *program_out = prog;
+    return DW_DLV_OK;
+}
+
+#define EXPR_NEED(n)                                            \
+    do {                                                        \
+        if (depth < (n)) {                                      \
+            return expr_error(dbg,error,                        \
+                "DW_DLE_LOC_EXPR_BAD: DWARF expression "        \
+                "stack underflow");                             \
+        }                                                       \
+    } while (0)
+
+#define EXPR_PUSH(v)                                            \
+    do {                                                        \
+        Dwarf_Unsigned pushval = (v);                           \
+        if (depth >= EXPR_STACK_MAX) {                          \
+            return expr_error(dbg,error,                        \
+                "DW_DLE_LOC_EXPR_BAD: DWARF expression "        \
+                "stack overflow");                              \
+        }                                                       \
+        stack[depth++] = pushval & mask;                        \
+    } while (0)
+
+/*  Operations that produce a location other than
+    a memory address must end their piece. */
+#define EXPR_MUST_BE_LAST                                       \
+    do {                                                        \
+        if (pc != end) {                                        \
+            return expr_error(dbg,error,                        \
+                "DW_DLE_LOC_EXPR_BAD: a register, implicit "    \
+                "or stack value location operation is not "     \
+                "the last operation of its piece");             \
+        }                                                       \
+    } while (0)
+
+static int
+get_value(dwarf_expr_get_value_type func,
+    Dwarf_Expr_Context *ctx, Dwarf_Unsigned *value)
+{
+    if (!func) {
+        return DW_DLV_NO_ENTRY;
+    }
+    return func(ctx->ec_user_data,value) == DW_DLV_OK?
+        DW_DLV_OK:DW_DLV_NO_ENTRY;
+}
+
+static int
+get_register(Dwarf_Expr_Context *ctx, Dwarf_Unsigned regnum,
+    Dwarf_Unsigned *value)
+{
+    if (!ctx->ec_read_register) {
+        return DW_DLV_NO_ENTRY;
+    }
+    return ctx->ec_read_register(ctx->ec_user_data,regnum,
+        value) == DW_DLV_OK? DW_DLV_OK:DW_DLV_NO_ENTRY;
+}
+
+/*  Runs the stack machine over one piece. */
+static int
+run_segment(struct Dwarf_Expr_Program_s *prog,
+    struct Dwarf_Expr_Segment_s *seg,
+    Dwarf_Expr_Context *ctx,
+    Dwarf_Expr_Piece *piece,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug dbg = prog->xp_dbg;
+    Dwarf_Unsigned mask = address_mask(prog->xp_address_size);
+    Dwarf_Unsigned stack[EXPR_STACK_MAX];
+    unsigned depth = 0;
+    Dwarf_Unsigned pc = seg->xs_first;
+    Dwarf_Unsigned end = seg->xs_first + seg->xs_count;
+    Dwarf_Unsigned steps = 0;
+
+    if (ctx->ec_push_initial) {
+        EXPR_PUSH(ctx->ec_initial_value);
+    }
+    while (pc < end) {
+        struct Dwarf_Expr_Insn_s *insn = prog->xp_insns + pc++;
+        Dwarf_Unsigned u = 0;
+        int res = 0;
+
+        if (++steps > EXPR_OP_LIMIT) {
+            return expr_error(dbg,error,
+                "DW_DLE_LOC_EXPR_BAD: DWARF expression "
+                "runs too long, it may loop forever");
+        }
+        switch (insn->xi_op) {
+        case DW_OP_constu:
+            EXPR_PUSH(insn->xi_number);
+            break;
+        case DW_OP_fbreg:
+            res = get_value(ctx->ec_frame_base,ctx,&u);
+            if (res != DW_DLV_OK) {
+                return res;
+            }
+            EXPR_PUSH(u + insn->xi_number);
+            break;
+        case DW_OP_bregx:
+            res = get_register(ctx,insn->xi_number,&u);
+            if (res != DW_DLV_OK) {
+                return res;
+            }
+            EXPR_PUSH(u + insn->xi_number2);
+            break;
+        case DW_OP_call_frame_cfa:
+            res = get_value(ctx->ec_call_frame_cfa,ctx,&u);
+            if (res != DW_DLV_OK) {
+                return res;
+            }
+            EXPR_PUSH(u);
+            break;
+        case DW_OP_push_object_address:
+            res = get_value(ctx->ec_object_address,ctx,&u);
+            if (res != DW_DLV_OK) {
+                return res;
+            }
+            EXPR_PUSH(u);
+            break;
+        case DW_OP_form_tls_address:
+            EXPR_NEED(1);
+            if (!ctx->ec_tls_address ||
+                ctx->ec_tls_address(ctx->ec_user_data,
+                stack[depth-1],&u) != DW_DLV_OK) {
+                return DW_DLV_NO_ENTRY;
+            }
+            stack[depth-1] = u & mask;
+            break;
+        case DW_OP_dup:
+            EXPR_NEED(1);
+            EXPR_PUSH(stack[depth-1]);
+            break;
+        case DW_OP_drop:
+            EXPR_NEED(1);
+            --depth;
+            break;
+        case DW_OP_over:
+            EXPR_NEED(2);
+            EXPR_PUSH(stack[depth-2]);
+            break;
+        case DW_OP_pick:
+            EXPR_NEED(insn->xi_number+1);
+            EXPR_PUSH(stack[depth-1-insn->xi_number]);
+            break;
+        case DW_OP_swap:
+            EXPR_NEED(2);
+            u = stack[depth-1];
+            stack[depth-1] = stack[depth-2];
+            stack[depth-2] = u;
+            break;
+        case DW_OP_rot:
+            EXPR_NEED(3);
+            u = stack[depth-1];
+            stack[depth-1] = stack[depth-2];
+            stack[depth-2] = stack[depth-3];
+            stack[depth-3] = u;
+            break;
+        case DW_OP_deref:
+        case DW_OP_deref_size: {
+            Dwarf_Unsigned size = insn->xi_op == DW_OP_deref?
+                prog->xp_address_size:insn->xi_number;
+
+            EXPR_NEED(1);
+            if (!ctx->ec_read_memory ||
+                ctx->ec_read_memory(ctx->ec_user_data,
+                stack[depth-1],size,&u) != DW_DLV_OK) {
+                return DW_DLV_NO_ENTRY;
+            }
+            stack[depth-1] = u & address_mask((Dwarf_Half)size) &
+                mask;
+            }
+            break;
+        case DW_OP_abs:
+            EXPR_NEED(1);
+            if (to_signed(stack[depth-1],mask) < 0) {
+                stack[depth-1] = ((Dwarf_Unsigned)0 -
+                    stack[depth-1]) & mask;
+            }
+            break;
+        case DW_OP_neg:
+            EXPR_NEED(1);
+            stack[depth-1] = ((Dwarf_Unsigned)0 - stack[depth-1]) &
+                mask;
+            break;
+        case DW_OP_not:
+            EXPR_NEED(1);
+            stack[depth-1] = ~stack[depth-1] & mask;
+            break;
+        case DW_OP_plus_uconst:
+            EXPR_NEED(1);
+            stack[depth-1] = (stack[depth-1] + insn->xi_number) &
+                mask;
+            break;
+        case DW_OP_and:
+        case DW_OP_div:
+        case DW_OP_minus:
+        case DW_OP_mod:
+        case DW_OP_mul:
+        case DW_OP_or:
+        case DW_OP_plus:
+        case DW_OP_shl:
+        case DW_OP_shr:
+        case DW_OP_shra:
+        case DW_OP_xor:
+        case DW_OP_eq:
+        case DW_OP_ge:
+        case DW_OP_gt:
+        case DW_OP_le:
+        case DW_OP_lt:
+        case DW_OP_ne: {
+            /*  'second' was pushed first. */
+            Dwarf_Unsigned top = 0;
+            Dwarf_Unsigned second = 0;
+            Dwarf_Signed stop = 0;
+            Dwarf_Signed ssecond = 0;
+
+            EXPR_NEED(2);
+            top = stack[--depth];
+            second = stack[depth-1];
+            stop = to_signed(top,mask);
+            ssecond = to_signed(second,mask);
+            switch (insn->xi_op) {
+            case DW_OP_and:   u = second & top; break;
+            case DW_OP_minus: u = second - top; break;
+            case DW_OP_mul:   u = second * top; break;
+            case DW_OP_or:    u = second | top; break;
+            case DW_OP_plus:  u = second + top; break;
+            case DW_OP_xor:   u = second ^ top; break;
+            case DW_OP_eq:    u = ssecond == stop; break;
+            case DW_OP_ge:    u = ssecond >= stop; break;
+            case DW_OP_gt:    u = ssecond >  stop; break;
+            case DW_OP_le:    u = ssecond <= stop; break;
+            case DW_OP_lt:    u = ssecond <  stop; break;
+            case DW_OP_ne:    u = ssecond != stop; break;
+            case DW_OP_shl:
+                u = top >= 64? 0:second << top;
+                break;
+            case DW_OP_shr:
+                u = top >= 64? 0:second >> top;
+                break;
+            case DW_OP_shra:
+                if (top >= 64) {
+                    u = ssecond < 0? ~(Dwarf_Unsigned)0:0;
+                } else if (ssecond < 0) {
+                    /*  Right shift of a negative value is
+                        implementation defined in C. */
+                    u = ~((~(Dwarf_Unsigned)ssecond) >> top);
+                } else {
+                    u = second >> top;
+                }
+                break;
+            case DW_OP_div:
+                if (!stop) {
+                    return expr_error(dbg,error,
+                        "DW_DLE_LOC_EXPR_BAD: DW_OP_div "
+                        "by zero");
+                }
+                if (stop == -1) {
+                    /*  Avoids the overflow of the most
+                        negative value divided by -1. */
+                    u = (Dwarf_Unsigned)0 - second;
+                } else {
+                    u = (Dwarf_Unsigned)(ssecond / stop);
+                }
+                break;
+            case DW_OP_mod:
+                if (!top) {
+                    return expr_error(dbg,error,
+                        "DW_DLE_LOC_EXPR_BAD: DW_OP_mod "
+                        "by zero");
+                }
+                u = second % top;
+                break;
+            default:
+                break;
+            }
+            stack[depth-1] = u & mask;
+            }
+            break;
+        case DW_OP_skip:
+            pc = insn->xi_number;
+            break;
+        case DW_OP_bra:
+            EXPR_NEED(1);
+            if (stack[--depth]) {
+                pc = insn->xi_number;
+            }
+            break;
+        case DW_OP_nop:
+            break;
+        case DW_OP_regx:
+            EXPR_MUST_BE_LAST;
+            piece->ep_kind = DW_EXPR_LOC_REGISTER;
+            piece->ep_value = insn->xi_number;
+            return DW_DLV_OK;
+        case DW_OP_implicit_value:
+            EXPR_MUST_BE_LAST;
+            piece->ep_kind = DW_EXPR_LOC_IMPLICIT;
+            piece->ep_data = prog->xp_bytes + insn->xi_number2;
+            piece->ep_data_len = insn->xi_number;
+            return DW_DLV_OK;
+        case DW_OP_implicit_pointer:
+            EXPR_MUST_BE_LAST;
+            piece->ep_kind = DW_EXPR_LOC_IMPLICIT_POINTER;
+            piece->ep_value = insn->xi_number;
+            piece->ep_offset = (Dwarf_Signed)insn->xi_number2;
+            return DW_DLV_OK;
+        case DW_OP_stack_value:
+            EXPR_MUST_BE_LAST;
+            EXPR_NEED(1);
+            piece->ep_kind = DW_EXPR_LOC_VALUE;
+            piece->ep_value = stack[depth-1];
+            return DW_DLV_OK;
+        default:
+            /*  DW_EXPR_OP_UNAVAILABLE */
+            return DW_DLV_NO_ENTRY;
+        }
+    }
+    EXPR_NEED(1);
+    piece->ep_kind = DW_EXPR_LOC_MEMORY;
+    piece->ep_value = stack[depth-1];
+    return DW_DLV_OK;
+}
+
+static int
+eval_segment(struct Dwarf_Expr_Program_s *prog,
+    struct Dwarf_Expr_Segment_s *seg,
+    Dwarf_Expr_Context *ctx,
+    Dwarf_Expr_Piece *piece,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Expr_Insn_s *insn = prog->xp_insns + seg->xs_first;
+    Dwarf_Unsigned mask = address_mask(prog->xp_address_size);
+    Dwarf_Unsigned u = 0;
+    int res = 0;
+
+    memset(piece,0,sizeof(*piece));
+    piece->ep_size_bits = seg->xs_size_bits;
+    piece->ep_bit_offset = seg->xs_bit_offset;
+    switch (seg->xs_shape) {
+    case DW_EXPR_SHAPE_EMPTY:
+        piece->ep_kind = DW_EXPR_LOC_EMPTY;
+        return DW_DLV_OK;
+    case DW_EXPR_SHAPE_REG:
+        piece->ep_kind = DW_EXPR_LOC_REGISTER;
+        piece->ep_value = insn->xi_number;
+        return DW_DLV_OK;
+    case DW_EXPR_SHAPE_FBREG:
+        res = get_value(ctx->ec_frame_base,ctx,&u);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        piece->ep_kind = DW_EXPR_LOC_MEMORY;
+        piece->ep_value = (u + insn->xi_number) & mask;
+        return DW_DLV_OK;
+    case DW_EXPR_SHAPE_BREG:
+        res = get_register(ctx,insn->xi_number,&u);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        piece->ep_kind = DW_EXPR_LOC_MEMORY;
+        piece->ep_value = (u + insn->xi_number2) & mask;
+        return DW_DLV_OK;
+    case DW_EXPR_SHAPE_ADDR:
+        piece->ep_kind = DW_EXPR_LOC_MEMORY;
+        piece->ep_value = insn->xi_number & mask;
+        return DW_DLV_OK;
+    default:
+        break;
+    }
+    return run_segment(prog,seg,ctx,piece,error);
+}
+
+int
+dwarf_expr_evaluate(Dwarf_Expr_Program prog,
+    Dwarf_Expr_Context *ctx,
+    Dwarf_Expr_Piece *pieces,
+    Dwarf_Unsigned max_pieces,
+    Dwarf_Unsigned *piece_count_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Unsigned i = 0;
+
+    if (!prog) {
+        _dwarf_error_string(0,error,DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_expr_evaluate() passed a NULL program");
+        return DW_DLV_ERROR;
+    }
+    dbg = prog->xp_dbg;
+    CHECK_DBG(dbg,error,"dwarf_expr_evaluate()");
+    if (!ctx || !piece_count_out || (max_pieces && !pieces)) {
+        _dwarf_error_string(dbg,error,DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_expr_evaluate() passed a NULL context, "
+            "pieces or piece count");
+        return DW_DLV_ERROR;
+    }
+    for (i = 0; i < prog->xp_segment_count; ++i) {
+        Dwarf_Expr_Piece piece;
+        int res = 0;
+
+        res = eval_segment(prog,prog->xp_segments + i,ctx,
+            &piece,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        if (i < max_pieces) {
+            pieces[i] = piece;
+        }
+    }
+    *piece_count_out = prog->xp_segment_count;
+    return DW_DLV_OK;
+}
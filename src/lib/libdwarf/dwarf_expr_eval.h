@@ -0,0 +1,107 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it
+  and/or modify it under the terms of version 2.1 of the
+  GNU Lesser General Public License as published by the Free
+  Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General
+  Public License along with this program; if not, write the
+  Free Software Foundation, Inc., 51 Franklin Street - Fifth
+  Floor, Boston MA 02110-1301, USA.
+
+*/
+
+#ifndef DWARF_EXPR_EVAL_H
+#define DWARF_EXPR_EVAL_H
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*  Marks an instruction whose operation the evaluator
+    cannot perform (typed stack entries, DW_OP_entry_value,
+    DW_OP_call*, ...). Zero is not a DW_OP value. */
+#define DW_EXPR_OP_UNAVAILABLE 0
+
+/*  One compiled operation. The DW_OP aliases are
+    folded: every constant push (lit, const, addr, addrx,
+    constx) is DW_OP_constu, regN is DW_OP_regx,
+    bregN is DW_OP_bregx and the GNU spellings become
+    the DWARF5 ones. For DW_OP_skip and DW_OP_bra
+    xi_number is the index of the target instruction. */
+struct Dwarf_Expr_Insn_s {
+    Dwarf_Small    xi_op;
+    Dwarf_Unsigned xi_number;
+    Dwarf_Unsigned xi_number2;
+};
+
+/*  Shapes of a piece (or of a whole expression
+    without pieces) evaluated without the stack machine. */
+#define DW_EXPR_SHAPE_GENERAL  0
+#define DW_EXPR_SHAPE_EMPTY    1 /* no operations */
+#define DW_EXPR_SHAPE_REG      2 /* DW_OP_regx */
+#define DW_EXPR_SHAPE_FBREG    3 /* DW_OP_fbreg */
+#define DW_EXPR_SHAPE_BREG     4 /* DW_OP_bregx */
+#define DW_EXPR_SHAPE_ADDR     5 /* a constant address */
+
+/*  The operations of one piece: instructions
+    [xs_first, xs_first + xs_count). */
+struct Dwarf_Expr_Segment_s {
+    Dwarf_Small    xs_shape;
+    Dwarf_Unsigned xs_first;
+    Dwarf_Unsigned xs_count;
+    /*  Zero when the expression has no pieces. */
+    Dwarf_Unsigned xs_size_bits;
+    Dwarf_Unsigned xs_bit_offset;
+};
+
+/*  A compiled expression. Programs live in
+    dbg->de_expr_tree until dwarf_finish(), keyed
+    by the address of the expression bytes and the
+    CU context. xp_bytes is a copy of the expression,
+    checked on lookup as a caller-supplied block
+    (dwarf_loclist_from_expr_c()) may be freed and
+    its address reused. Programs with the same
+    key are chained on xp_next.  */
+struct Dwarf_Expr_Program_s {
+    Dwarf_Debug      xp_dbg;
+    Dwarf_Small     *xp_key;
+    Dwarf_CU_Context xp_context;
+    Dwarf_Half       xp_address_size;
+    Dwarf_Unsigned   xp_bytes_len;
+    Dwarf_Small     *xp_bytes;
+    Dwarf_Unsigned   xp_insn_count;
+    struct Dwarf_Expr_Insn_s    *xp_insns;
+    Dwarf_Unsigned   xp_segment_count;
+    struct Dwarf_Expr_Segment_s *xp_segments;
+    struct Dwarf_Expr_Program_s *xp_next;
+};
+
+int _dwarf_expr_compile_bytes(Dwarf_Debug dbg,
+    Dwarf_Small   *bytes,
+    Dwarf_Unsigned len,
+    Dwarf_Half     address_size,
+    Dwarf_Half     offset_size,
+    Dwarf_Half     version,
+    Dwarf_Expr_Program *program_out,
+    Dwarf_Error   *error);
+void _dwarf_destroy_expr_programs(Dwarf_Debug dbg);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* DWARF_EXPR_EVAL_H */
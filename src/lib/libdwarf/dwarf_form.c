@@ -726,6 +726,66 @@ dwarf_global_formref_b(Dwarf_Attribute attr,
         error);
     return res;
 }
+/*  Follows DW_FORM_ref_sup4, DW_FORM_ref_sup8 and
+    DW_FORM_GNU_ref_alt into the supplementary object
+    set by dwarf_set_sup_dbg().  The returned die
+    belongs to the supplementary dbg.
+    Returns DW_DLV_NO_ENTRY if no supplementary
+    object was set. */
+int
+dwarf_formref_sup_die(Dwarf_Attribute attr,
+    Dwarf_Die *die_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Debug supdbg = 0;
+    Dwarf_CU_Context cu_context = 0;
+    Dwarf_Off  offset = 0;
+    Dwarf_Bool is_info = TRUE;
+    Dwarf_Die  die = 0;
+    Dwarf_Error superr = 0;
+    int res = 0;
+
+    res = get_attr_dbg(&dbg,&cu_context,attr,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    switch (attr->ar_attribute_form) {
+    case DW_FORM_ref_sup4:
+    case DW_FORM_ref_sup8:
+    case DW_FORM_GNU_ref_alt:
+        break;
+    default:
+        _dwarf_error_string(dbg, error, DW_DLE_BAD_REF_FORM,
+            "DW_DLE_BAD_REF_FORM: dwarf_formref_sup_die() "
+            "requires DW_FORM_ref_sup4, DW_FORM_ref_sup8 "
+            "or DW_FORM_GNU_ref_alt");
+        return DW_DLV_ERROR;
+    }
+    supdbg = dbg->de_sup_object;
+    if (!supdbg) {
+        return DW_DLV_NO_ENTRY;
+    }
+    res = dwarf_global_formref_b(attr,&offset,&is_info,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_offdie_b(supdbg,offset,TRUE,&die,&superr);
+    if (res == DW_DLV_ERROR) {
+        /* Attach errors to dbg, not supdbg. */
+        Dwarf_Unsigned lerrno = dwarf_errno(superr);
+
+        dwarf_dealloc_error(supdbg,superr);
+        _dwarf_error(dbg,error,lerrno);
+        return res;
+    }
+    if (res == DW_DLV_NO_ENTRY) {
+        return res;
+    }
+    *die_out = die;
+    return DW_DLV_OK;
+}
+
 int
 _dwarf_internal_global_formref_b(Dwarf_Attribute attr,
     int context_level,
@@ -858,6 +918,18 @@ _dwarf_internal_global_formref_b(Dwarf_Attribute attr,
             error,section_end);
         }
         break;
+    /*  Offsets in the .debug_info of the supplementary
+        object. See dwarf_formref_sup_die(). */
+    case DW_FORM_ref_sup4:
+        READ_UNALIGNED_CK(dbg, offset, Dwarf_Unsigned,
+            attr->ar_debug_ptr, DWARF_32BIT_SIZE,
+            error,section_end);
+        break;
+    case DW_FORM_ref_sup8:
+        READ_UNALIGNED_CK(dbg, offset, Dwarf_Unsigned,
+            attr->ar_debug_ptr, DWARF_64BIT_SIZE,
+            error,section_end);
+        break;
     case DW_FORM_sec_offset:
     case DW_FORM_GNU_ref_alt:  /* 2013 GNU extension */
     case DW_FORM_GNU_strp_alt: /* 2013 GNU extension */
@@ -2025,7 +2097,7 @@ dwarf_formstring(Dwarf_Attribute attr,
         if (res != DW_DLV_OK) {
             return res;
         }
-        res = _dwarf_get_string_from_tied(dbg, soffset,
+        res = _dwarf_get_string_from_sup(dbg, soffset,
             return_str, &alterr);
         if (res == DW_DLV_ERROR) {
             if (dwarf_errno(alterr) ==
@@ -2102,25 +2174,22 @@ dwarf_formstring(Dwarf_Attribute attr,
     return res;
 }
 
-int
-_dwarf_get_string_from_tied(Dwarf_Debug dbg,
+/*  Returns the string at offset in the .debug_str
+    of tieddbg (a tied or supplementary object).
+    Errors are attached to dbg, not tieddbg. */
+static int
+_dwarf_get_string_from_other(Dwarf_Debug dbg,
+    Dwarf_Debug tieddbg,
     Dwarf_Unsigned offset,
     char **return_str,
     Dwarf_Error*error)
 {
-    Dwarf_Debug tieddbg = 0;
     Dwarf_Small *secend = 0;
     Dwarf_Small *secbegin = 0;
     Dwarf_Small *strbegin = 0;
     int res = DW_DLV_ERROR;
     Dwarf_Error localerror = 0;
 
-    /* Attach errors to dbg, not tieddbg. */
-    tieddbg = dbg->de_tied_data.td_tied_object;
-    if (!tieddbg) {
-        _dwarf_error(dbg, error, DW_DLE_NO_TIED_FILE_AVAILABLE);
-        return  DW_DLV_ERROR;
-    }
     /* The 'offset' into .debug_str is set. */
     res = _dwarf_load_section(tieddbg, &tieddbg->de_debug_str,
         &localerror);
@@ -2164,6 +2233,42 @@ _dwarf_get_string_from_tied(Dwarf_Debug dbg,
     return DW_DLV_OK;
 }
 
+int
+_dwarf_get_string_from_tied(Dwarf_Debug dbg,
+    Dwarf_Unsigned offset,
+    char **return_str,
+    Dwarf_Error*error)
+{
+    Dwarf_Debug tieddbg = 0;
+
+    tieddbg = dbg->de_tied_data.td_tied_object;
+    if (!tieddbg) {
+        _dwarf_error(dbg, error, DW_DLE_NO_TIED_FILE_AVAILABLE);
+        return  DW_DLV_ERROR;
+    }
+    return _dwarf_get_string_from_other(dbg,tieddbg,offset,
+        return_str,error);
+}
+
+/*  For DW_FORM_strp_sup and DW_FORM_GNU_strp_alt.
+    Uses the supplementary object if one was set
+    with dwarf_set_sup_dbg(), otherwise (as before
+    there was a way to set one) the tied object. */
+int
+_dwarf_get_string_from_sup(Dwarf_Debug dbg,
+    Dwarf_Unsigned offset,
+    char **return_str,
+    Dwarf_Error*error)
+{
+    if (dbg->de_sup_object) {
+        return _dwarf_get_string_from_other(dbg,
+            dbg->de_sup_object,offset,
+            return_str,error);
+    }
+    return _dwarf_get_string_from_tied(dbg,offset,
+        return_str,error);
+}
+
 int
 dwarf_formexprloc(Dwarf_Attribute attr,
     Dwarf_Unsigned * return_exprlen,
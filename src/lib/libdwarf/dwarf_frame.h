@@ -503,6 +503,36 @@ int _dwarf_create_cie_from_after_start(Dwarf_Debug dbg,
     Dwarf_Cie *cie_ptr_out,
         Dwarf_Error *error);
 
+/*  The FDE index built by the first dwarf_find_fde_at_pc()
+    on a frame section. The scan reads only the FDE headers
+    (the pc range and the CIE), CIEs are few and are fully
+    created as they are needed to decode .eh_frame pointers.
+    The Dwarf_Fde itself is created when a lookup
+    first lands on the entry. */
+struct Dwarf_Fde_Index_Entry_s {
+    Dwarf_Addr     fe_low_pc;
+    Dwarf_Unsigned fe_range;
+    /*  fe_offset is the section offset of the FDE. */
+    Dwarf_Unsigned fe_offset;
+    Dwarf_Cie      fe_cie;
+    Dwarf_Fde      fe_fde;
+};
+struct Dwarf_Fde_Index_s {
+    Dwarf_Bool     fx_is_eh;
+    /*  The CIEs, chained on ci_next. */
+    Dwarf_Cie      fx_cie_head;
+    Dwarf_Unsigned fx_cie_count;
+    /*  Sorted by fe_low_pc. */
+    struct Dwarf_Fde_Index_Entry_s *fx_entries;
+    Dwarf_Unsigned fx_count;
+};
+
+int _dwarf_load_fde_index(Dwarf_Debug dbg,
+    Dwarf_Bool is_eh,
+    struct Dwarf_Fde_Index_s **index_out,
+    Dwarf_Error *error);
+void _dwarf_destroy_fde_index(Dwarf_Debug dbg);
+
 int _dwarf_frame_constructor(Dwarf_Debug dbg,void * );
 void _dwarf_frame_destructor (void *);
 void _dwarf_fde_destructor (void *);
@@ -33,7 +33,7 @@
 
 #include <config.h>
 
-#include <stdlib.h> /* qsort() */
+#include <stdlib.h> /* calloc() free() malloc() qsort() realloc() */
 #include <stdio.h> /* printf() */
 #include <string.h> /* memcpy() memset() strcmp()
     strncmp() strlen() */
@@ -153,6 +153,75 @@ qsort_compare(const void *elem1, const void *elem2)
     return 0;
 }
 
+/*  An FDE address with the FDE position in the list
+    as tie-breaker, so sorting keys gives the
+    same order as a stable sort of the FDEs. */
+struct fde_sort_key_s {
+    Dwarf_Addr     sk_low_pc;
+    Dwarf_Unsigned sk_index;
+    Dwarf_Fde      sk_fde;
+};
+
+static int
+fde_key_compare(const void *elem1, const void *elem2)
+{
+    const struct fde_sort_key_s *k1 = elem1;
+    const struct fde_sort_key_s *k2 = elem2;
+
+    if (k1->sk_low_pc < k2->sk_low_pc) {
+        return -1;
+    }
+    if (k1->sk_low_pc > k2->sk_low_pc) {
+        return 1;
+    }
+    if (k1->sk_index < k2->sk_index) {
+        return -1;
+    }
+    if (k1->sk_index > k2->sk_index) {
+        return 1;
+    }
+    return 0;
+}
+
+/*  Linkers nearly always emit FDEs in address order,
+    so check for that before sorting. When a sort
+    is needed it sorts the addresses copied out of the FDEs
+    rather than comparing through each FDE pointer. */
+static void
+sort_fde_list(Dwarf_Fde *fde_list, Dwarf_Unsigned fde_count)
+{
+    struct fde_sort_key_s *keys = 0;
+    Dwarf_Unsigned i = 0;
+
+    for (i = 1; i < fde_count; ++i) {
+        if (fde_list[i]->fd_initial_location <
+            fde_list[i-1]->fd_initial_location) {
+            break;
+        }
+    }
+    if (i >= fde_count) {
+        return;
+    }
+    keys = (struct fde_sort_key_s *)malloc(
+        fde_count * sizeof(struct fde_sort_key_s));
+    if (!keys) {
+        qsort((void *) fde_list, fde_count, sizeof(Dwarf_Ptr),
+            qsort_compare);
+        return;
+    }
+    for (i = 0; i < fde_count; ++i) {
+        keys[i].sk_low_pc = fde_list[i]->fd_initial_location;
+        keys[i].sk_index = i;
+        keys[i].sk_fde = fde_list[i];
+    }
+    qsort((void *) keys, fde_count, sizeof(struct fde_sort_key_s),
+        fde_key_compare);
+    for (i = 0; i < fde_count; ++i) {
+        fde_list[i] = keys[i].sk_fde;
+    }
+    free(keys);
+}
+
 /*  Adds 'newone' to the end of the list starting at 'head'
     and makes the new one current. */
 static void
@@ -658,8 +727,7 @@ _dwarf_get_fde_list_internal(Dwarf_Debug dbg, Dwarf_Cie ** cie_data,
         dwarf_get_fde_at_pc() can
         binary search this list.  */
     if (fde_count > 0) {
-        qsort((void *) fde_list_ptr, fde_count, sizeof(Dwarf_Ptr),
-            qsort_compare);
+        sort_fde_list(fde_list_ptr, fde_count);
     }
 
     return DW_DLV_OK;
@@ -1073,47 +1141,23 @@ _dwarf_create_cie_from_after_start(Dwarf_Debug dbg,
     return DW_DLV_OK;
 }
 
-/*  Internal function, not called by consumer code.
-    'prefix' has accumulated the info up thru the cie-id
-    and now we consume the rest and build a Dwarf_Fde_s structure.
-    Can be called with cie_ptr_in NULL from dwarf_frame.c  */
-
-int
-_dwarf_create_fde_from_after_start(Dwarf_Debug dbg,
-    struct cie_fde_prefix_s *prefix,
+/*  Reads the initial_location and address_range
+    of an FDE, the FDE fields that follow the CIE pointer.
+    In .eh_frame with z augmentation they are
+    encoded as the CIE augmentation says. */
+static int
+read_fde_pc_range(Dwarf_Debug dbg,
+    Dwarf_Cie cieptr,
+    enum Dwarf_augmentation_type augt,
     Dwarf_Small *section_pointer,
-    Dwarf_Unsigned section_length,
     Dwarf_Small *frame_ptr,
     Dwarf_Small *section_ptr_end,
-    int          use_gnu_cie_calc,
-    Dwarf_Cie    cie_ptr_in,
     Dwarf_Half   address_size,
-    Dwarf_Fde   *fde_ptr_out,
+    Dwarf_Addr  *initial_location,
+    Dwarf_Addr  *address_range,
+    Dwarf_Small **frame_ptr_out,
     Dwarf_Error *error)
 {
-    Dwarf_Fde new_fde = 0;
-    Dwarf_Cie cieptr = 0;
-    Dwarf_Small *saved_frame_ptr = 0;
-
-    Dwarf_Small *initloc = frame_ptr;
-    Dwarf_Signed offset_into_exception_tables
-        = (Dwarf_Signed) DW_DLX_NO_EH_OFFSET;
-    Dwarf_Small *fde_aug_data = 0;
-    Dwarf_Unsigned fde_aug_data_len = 0;
-    Dwarf_Addr cie_base_offset = prefix->cf_cie_id;
-    Dwarf_Addr initial_location = 0;    /* must be min de_pointer_size
-        bytes in size */
-    Dwarf_Addr address_range = 0;       /* must be min de_pointer_size
-        bytes in size */
-    Dwarf_Unsigned eh_table_value = 0;
-    Dwarf_Bool eh_table_value_set = FALSE;
-    /* Temporary assumption.  */
-    enum Dwarf_augmentation_type augt = aug_empty_string;
-
-    if (cie_ptr_in) {
-        cieptr = cie_ptr_in;
-        augt = cieptr->ci_augmentation_type;
-    }
     if (augt == aug_gcc_eh_z) {
         /*  If z augmentation this is eh_frame,
             and initial_location and
@@ -1128,7 +1172,7 @@ _dwarf_create_fde_from_after_start(Dwarf_Debug dbg,
                 cieptr-> ci_gnu_fde_begin_encoding,
                 section_ptr_end,
                 address_size,
-                &initial_location,
+                initial_location,
                 &fp_updated,error);
             if (res != DW_DLV_OK) {
                 return res;
@@ -1146,42 +1190,128 @@ _dwarf_create_fde_from_after_start(Dwarf_Debug dbg,
                 cieptr->ci_gnu_fde_begin_encoding,
                 section_ptr_end,
                 address_size,
-                &address_range, &fp_updated,error);
+                address_range, &fp_updated,error);
             if (res != DW_DLV_OK) {
                 return res;
             }
             frame_ptr = fp_updated;
         } /*  We know cieptr was set as was augt, no else needed
             converity scan CID 323429 */
-        {
-            Dwarf_Unsigned adlen = 0;
-
-            DECODE_LEB128_UWORD_CK(frame_ptr, adlen,
-                dbg,error,section_ptr_end);
-            fde_aug_data_len = adlen;
-            fde_aug_data = frame_ptr;
-            if (frame_ptr < section_ptr_end) {
-                Dwarf_Unsigned remaininglen = 0;
-                remaininglen = (Dwarf_Unsigned)
-                    (section_ptr_end - frame_ptr);
-                if (remaininglen <= adlen) {
-                    _dwarf_error_string(dbg, error,
-                        DW_DLE_AUG_DATA_LENGTH_BAD,
-                        "DW_DLE_AUG_DATA_LENGTH_BAD: The "
-                        "augmentation length is too large for "
-                        "the frame section, corrupt DWARF");
-                    return DW_DLV_ERROR;
-                }
-            } else {
+    } else {
+        if ((frame_ptr + 2*address_size) > section_ptr_end) {
+            _dwarf_error(dbg,error,DW_DLE_DEBUG_FRAME_LENGTH_BAD);
+            return DW_DLV_ERROR;
+        }
+        READ_UNALIGNED_CK(dbg, *initial_location, Dwarf_Addr,
+            frame_ptr, address_size,
+            error,section_ptr_end);
+        frame_ptr += address_size;
+        READ_UNALIGNED_CK(dbg, *address_range, Dwarf_Addr,
+            frame_ptr, address_size,
+            error,section_ptr_end);
+        frame_ptr += address_size;
+    }
+    *frame_ptr_out = frame_ptr;
+    return DW_DLV_OK;
+}
+
+/*  Internal function, not called by consumer code.
+    'prefix' has accumulated the info up thru the cie-id
+    and now we consume the rest and build a Dwarf_Fde_s structure.
+    Can be called with cie_ptr_in NULL from dwarf_frame.c  */
+
+int
+_dwarf_create_fde_from_after_start(Dwarf_Debug dbg,
+    struct cie_fde_prefix_s *prefix,
+    Dwarf_Small *section_pointer,
+    Dwarf_Unsigned section_length,
+    Dwarf_Small *frame_ptr,
+    Dwarf_Small *section_ptr_end,
+    int          use_gnu_cie_calc,
+    Dwarf_Cie    cie_ptr_in,
+    Dwarf_Half   address_size,
+    Dwarf_Fde   *fde_ptr_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Fde new_fde = 0;
+    Dwarf_Cie cieptr = 0;
+    Dwarf_Small *saved_frame_ptr = 0;
+
+    Dwarf_Small *initloc = frame_ptr;
+    Dwarf_Signed offset_into_exception_tables
+        = (Dwarf_Signed) DW_DLX_NO_EH_OFFSET;
+    Dwarf_Small *fde_aug_data = 0;
+    Dwarf_Unsigned fde_aug_data_len = 0;
+    Dwarf_Addr cie_base_offset = prefix->cf_cie_id;
+    Dwarf_Addr initial_location = 0;    /* must be min de_pointer_size
+        bytes in size */
+    Dwarf_Addr address_range = 0;       /* must be min de_pointer_size
+        bytes in size */
+    Dwarf_Unsigned eh_table_value = 0;
+    Dwarf_Bool eh_table_value_set = FALSE;
+    /* Temporary assumption.  */
+    enum Dwarf_augmentation_type augt = aug_empty_string;
+
+    if (cie_ptr_in) {
+        cieptr = cie_ptr_in;
+        augt = cieptr->ci_augmentation_type;
+    }
+    {
+        int res = read_fde_pc_range(dbg,cieptr,augt,
+            section_pointer,frame_ptr,section_ptr_end,
+            address_size,&initial_location,&address_range,
+            &frame_ptr,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+    }
+    if (augt == aug_gcc_eh_z) {
+        Dwarf_Unsigned adlen = 0;
+
+        DECODE_LEB128_UWORD_CK(frame_ptr, adlen,
+            dbg,error,section_ptr_end);
+        fde_aug_data_len = adlen;
+        fde_aug_data = frame_ptr;
+        if (frame_ptr < section_ptr_end) {
+            Dwarf_Unsigned remaininglen = 0;
+            remaininglen = (Dwarf_Unsigned)
+                (section_ptr_end - frame_ptr);
+            if (remaininglen <= adlen) {
                 _dwarf_error_string(dbg, error,
                     DW_DLE_AUG_DATA_LENGTH_BAD,
                     "DW_DLE_AUG_DATA_LENGTH_BAD: The "
-                    "frame pointer has stepped off the end "
-                    "of the frame section on reading augmentation "
-                    "length. Corrupt DWARF");
+                    "augmentation length is too large for "
+                    "the frame section, corrupt DWARF");
                 return DW_DLV_ERROR;
             }
-            if ( adlen >= section_length) {
+        } else {
+            _dwarf_error_string(dbg, error,
+                DW_DLE_AUG_DATA_LENGTH_BAD,
+                "DW_DLE_AUG_DATA_LENGTH_BAD: The "
+                "frame pointer has stepped off the end "
+                "of the frame section on reading augmentation "
+                "length. Corrupt DWARF");
+            return DW_DLV_ERROR;
+        }
+        if ( adlen >= section_length) {
+            dwarfstring m;
+
+            dwarfstring_constructor(&m);
+            dwarfstring_append_printf_u(&m,
+                "DW_DLE_AUG_DATA_LENGTH_BAD: The "
+                "gcc .eh_frame augmentation data "
+                "length of %" DW_PR_DUu " is too long to"
+                " fit in the section.",adlen);
+            _dwarf_error_string(dbg, error,
+                DW_DLE_AUG_DATA_LENGTH_BAD,
+                dwarfstring_string(&m));
+            dwarfstring_destructor(&m);
+            return DW_DLV_ERROR;
+        }
+        frame_ptr += adlen;
+        if (adlen) {
+            if (frame_ptr < fde_aug_data ||
+                frame_ptr >= section_ptr_end ) {
                 dwarfstring m;
 
                 dwarfstring_constructor(&m);
@@ -1196,39 +1326,7 @@ _dwarf_create_fde_from_after_start(Dwarf_Debug dbg,
                 dwarfstring_destructor(&m);
                 return DW_DLV_ERROR;
             }
-            frame_ptr += adlen;
-            if (adlen) {
-                if (frame_ptr < fde_aug_data ||
-                    frame_ptr >= section_ptr_end ) {
-                    dwarfstring m;
-
-                    dwarfstring_constructor(&m);
-                    dwarfstring_append_printf_u(&m,
-                        "DW_DLE_AUG_DATA_LENGTH_BAD: The "
-                        "gcc .eh_frame augmentation data "
-                        "length of %" DW_PR_DUu " is too long to"
-                        " fit in the section.",adlen);
-                    _dwarf_error_string(dbg, error,
-                        DW_DLE_AUG_DATA_LENGTH_BAD,
-                        dwarfstring_string(&m));
-                    dwarfstring_destructor(&m);
-                    return DW_DLV_ERROR;
-                }
-            }
         }
-    } else {
-        if ((frame_ptr + 2*address_size) > section_ptr_end) {
-            _dwarf_error(dbg,error,DW_DLE_DEBUG_FRAME_LENGTH_BAD);
-            return DW_DLV_ERROR;
-        }
-        READ_UNALIGNED_CK(dbg, initial_location, Dwarf_Addr,
-            frame_ptr, address_size,
-            error,section_ptr_end);
-        frame_ptr += address_size;
-        READ_UNALIGNED_CK(dbg, address_range, Dwarf_Addr,
-            frame_ptr, address_size,
-            error,section_ptr_end);
-        frame_ptr += address_size;
     }
     switch (augt) {
     case aug_irix_mti_v1:
@@ -1954,6 +2052,11 @@ _dwarf_get_augmentation_type(Dwarf_Debug dbg,
         t = aug_armcc;
     } else if (!strcmp(ag_string, "HC")) {
         t = aug_metaware;
+    } else if (!strcmp(ag_string, "S")) {
+        /*  GNU as, .cfi_signal_frame in .debug_frame.
+            It marks a signal frame and adds no fields,
+            so the CIE reads like an empty string one. */
+        t = aug_empty_string;
     } else {
     }
     return t;
@@ -2045,3 +2148,382 @@ dwarf_dealloc_fde_cie_list(Dwarf_Debug dbg,
         dwarf_dealloc(dbg, fde_data, DW_DLA_LIST);
     }
 }
+
+static int
+fde_index_compare(const void *elem1, const void *elem2)
+{
+    const struct Dwarf_Fde_Index_Entry_s *e1 = elem1;
+    const struct Dwarf_Fde_Index_Entry_s *e2 = elem2;
+
+    if (e1->fe_low_pc < e2->fe_low_pc) {
+        return -1;
+    }
+    if (e1->fe_low_pc > e2->fe_low_pc) {
+        return 1;
+    }
+    if (e1->fe_offset < e2->fe_offset) {
+        return -1;
+    }
+    if (e1->fe_offset > e2->fe_offset) {
+        return 1;
+    }
+    return 0;
+}
+
+static void
+free_fde_index(struct Dwarf_Fde_Index_s *index)
+{
+    Dwarf_Unsigned i = 0;
+
+    if (!index) {
+        return;
+    }
+    for (i = 0; i < index->fx_count; ++i) {
+        Dwarf_Fde fde = index->fx_entries[i].fe_fde;
+
+        if (fde) {
+            dwarf_dealloc(fde->fd_dbg, fde, DW_DLA_FDE);
+        }
+    }
+    _dwarf_dealloc_fde_cie_list_internal(0,index->fx_cie_head);
+    free(index->fx_entries);
+    free(index);
+}
+
+static int
+fde_index_error(Dwarf_Debug dbg, Dwarf_Error *error,
+    int errnum, const char *msg,
+    struct Dwarf_Fde_Index_s *index)
+{
+    free_fde_index(index);
+    _dwarf_error_string(dbg, error, errnum, (char *)msg);
+    return DW_DLV_ERROR;
+}
+
+/*  One pass over the section reading the prefix and
+    pc range of each FDE. Unlike _dwarf_get_fde_list_internal()
+    no FDE is created and the FDE instructions
+    are not looked at. */
+static int
+build_fde_index(Dwarf_Debug dbg,
+    Dwarf_Bool is_eh,
+    struct Dwarf_Fde_Index_s **index_out,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Section_s *section = is_eh?
+        &dbg->de_debug_frame_eh_gnu:&dbg->de_debug_frame;
+    Dwarf_Unsigned cie_id_value = is_eh?
+        0:(Dwarf_Unsigned)DW_CIE_ID;
+    int use_gnu_cie_calc = is_eh?1:0;
+    Dwarf_Small *section_ptr = 0;
+    Dwarf_Small *section_ptr_end = 0;
+    Dwarf_Small *frame_ptr = 0;
+    Dwarf_Unsigned section_length = 0;
+    Dwarf_Unsigned entries_alloc = 0;
+    Dwarf_Cie cur_cie_ptr = 0;
+    Dwarf_Cie tail_cie_ptr = 0;
+    struct Dwarf_Fde_Index_s *index = 0;
+    Dwarf_Unsigned i = 0;
+    int res = 0;
+
+    res = _dwarf_load_section(dbg, section,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    section_ptr = section->dss_data;
+    section_length = section->dss_size;
+    if (!section_ptr) {
+        return DW_DLV_NO_ENTRY;
+    }
+    res = _dwarf_validate_register_numbers(dbg,error);
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    index = (struct Dwarf_Fde_Index_s *)
+        calloc(1,sizeof(struct Dwarf_Fde_Index_s));
+    if (!index) {
+        return fde_index_error(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: allocating the FDE index",0);
+    }
+    index->fx_is_eh = is_eh;
+    section_ptr_end = section_ptr + section_length;
+    frame_ptr = section_ptr;
+    while (frame_ptr < section_ptr_end) {
+        struct cie_fde_prefix_s prefix;
+        Dwarf_Cie cie_ptr_to_use = 0;
+        Dwarf_Small *next_ptr = 0;
+
+        memset(&prefix, 0, sizeof(prefix));
+        res = _dwarf_read_cie_fde_prefix(dbg,
+            frame_ptr, section_ptr,
+            section->dss_index,
+            section_length, &prefix, error);
+        if (res == DW_DLV_ERROR) {
+            free_fde_index(index);
+            return res;
+        }
+        if (res == DW_DLV_NO_ENTRY) {
+            break;
+        }
+        next_ptr = prefix.cf_start_addr + prefix.cf_length +
+            prefix.cf_local_length_size +
+            prefix.cf_local_extension_size;
+        frame_ptr = prefix.cf_addr_after_prefix;
+        if (frame_ptr >= section_ptr_end ||
+            next_ptr <= frame_ptr || next_ptr > section_ptr_end) {
+            return fde_index_error(dbg,error,
+                DW_DLE_DEBUG_FRAME_LENGTH_BAD,
+                "DW_DLE_DEBUG_FRAME_LENGTH_BAD: a cie/fde "
+                "length runs off the end of the section. "
+                "Corrupt Dwarf",index);
+        }
+        if (prefix.cf_cie_id == cie_id_value) {
+            res = _dwarf_find_existing_cie_ptr(prefix.cf_start_addr,
+                cur_cie_ptr, &cie_ptr_to_use,index->fx_cie_head);
+            if (res == DW_DLV_NO_ENTRY) {
+                res = _dwarf_create_cie_from_after_start(dbg,
+                    &prefix, section_ptr, frame_ptr,
+                    section_ptr_end, index->fx_cie_count,
+                    use_gnu_cie_calc, &cie_ptr_to_use, error);
+                if (res != DW_DLV_OK) {
+                    free_fde_index(index);
+                    return res;
+                }
+                index->fx_cie_count++;
+                chain_up_cie(cie_ptr_to_use, &index->fx_cie_head,
+                    &tail_cie_ptr);
+            }
+            cur_cie_ptr = cie_ptr_to_use;
+        } else {
+            Dwarf_Small *cieptr_val = 0;
+            Dwarf_Small *after_range = 0;
+            struct Dwarf_Fde_Index_Entry_s *entry = 0;
+
+            res = get_cieptr_given_offset(dbg,
+                prefix.cf_cie_id, use_gnu_cie_calc,
+                section_ptr, section_length,
+                prefix.cf_cie_id_addr,&cieptr_val,error);
+            if (res != DW_DLV_OK) {
+                free_fde_index(index);
+                return res;
+            }
+            res = _dwarf_find_existing_cie_ptr(cieptr_val,
+                cur_cie_ptr, &cie_ptr_to_use,index->fx_cie_head);
+            if (res == DW_DLV_NO_ENTRY) {
+                res = _dwarf_create_cie_from_start(dbg,
+                    cieptr_val, section_ptr,
+                    section->dss_index, section_length,
+                    section_ptr_end, cie_id_value,
+                    index->fx_cie_count, use_gnu_cie_calc,
+                    &cie_ptr_to_use, error);
+                if (res != DW_DLV_OK) {
+                    free_fde_index(index);
+                    return res;
+                }
+                index->fx_cie_count++;
+                chain_up_cie(cie_ptr_to_use, &index->fx_cie_head,
+                    &tail_cie_ptr);
+            }
+            cur_cie_ptr = cie_ptr_to_use;
+            if (index->fx_count >= entries_alloc) {
+                Dwarf_Unsigned newalloc = entries_alloc?
+                    entries_alloc*2:64;
+                struct Dwarf_Fde_Index_Entry_s *newentries =
+                    (struct Dwarf_Fde_Index_Entry_s *)
+                    realloc(index->fx_entries,newalloc*
+                    sizeof(struct Dwarf_Fde_Index_Entry_s));
+
+                if (!newentries) {
+                    return fde_index_error(dbg,error,
+                        DW_DLE_ALLOC_FAIL,
+                        "DW_DLE_ALLOC_FAIL: growing the FDE index",
+                        index);
+                }
+                index->fx_entries = newentries;
+                entries_alloc = newalloc;
+            }
+            entry = index->fx_entries + index->fx_count;
+            memset(entry,0,sizeof(*entry));
+            res = read_fde_pc_range(dbg,cie_ptr_to_use,
+                cie_ptr_to_use->ci_augmentation_type,
+                section_ptr,frame_ptr,next_ptr,
+                cie_ptr_to_use->ci_address_size,
+                &entry->fe_low_pc,&entry->fe_range,
+                &after_range,error);
+            if (res != DW_DLV_OK) {
+                free_fde_index(index);
+                return res;
+            }
+            entry->fe_offset = (Dwarf_Unsigned)
+                (prefix.cf_start_addr - section_ptr);
+            entry->fe_cie = cie_ptr_to_use;
+            index->fx_count++;
+        }
+        frame_ptr = next_ptr;
+    }
+    /*  Usually already in address order. */
+    for (i = 1; i < index->fx_count; ++i) {
+        if (index->fx_entries[i].fe_low_pc <
+            index->fx_entries[i-1].fe_low_pc) {
+            qsort((void *)index->fx_entries, index->fx_count,
+                sizeof(struct Dwarf_Fde_Index_Entry_s),
+                fde_index_compare);
+            break;
+        }
+    }
+    *index_out = index;
+    return DW_DLV_OK;
+}
+
+int
+_dwarf_load_fde_index(Dwarf_Debug dbg,
+    Dwarf_Bool is_eh,
+    struct Dwarf_Fde_Index_s **index_out,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Fde_Index_s **indexp = is_eh?
+        &dbg->de_fde_index_eh:&dbg->de_fde_index;
+    int res = 0;
+
+    if (!*indexp) {
+        res = build_fde_index(dbg,is_eh,indexp,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+    }
+    if (!(*indexp)->fx_count) {
+        return DW_DLV_NO_ENTRY;
+    }
+    *index_out = *indexp;
+    return DW_DLV_OK;
+}
+
+/*  Creates the Dwarf_Fde of an index entry
+    the same way _dwarf_get_fde_list_internal() does. */
+static int
+create_indexed_fde(Dwarf_Debug dbg,
+    struct Dwarf_Fde_Index_s *index,
+    struct Dwarf_Fde_Index_Entry_s *entry,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Section_s *section = index->fx_is_eh?
+        &dbg->de_debug_frame_eh_gnu:&dbg->de_debug_frame;
+    Dwarf_Small *section_ptr = section->dss_data;
+    Dwarf_Small *section_ptr_end = section_ptr + section->dss_size;
+    struct cie_fde_prefix_s prefix;
+    Dwarf_Fde fde = 0;
+    Dwarf_Small *fde_end = 0;
+    int res = 0;
+
+    memset(&prefix, 0, sizeof(prefix));
+    res = _dwarf_read_cie_fde_prefix(dbg,
+        section_ptr + entry->fe_offset, section_ptr,
+        section->dss_index, section->dss_size,
+        &prefix, error);
+    if (res != DW_DLV_OK) {
+        if (res == DW_DLV_NO_ENTRY) {
+            _dwarf_error_string(dbg, error,
+                DW_DLE_DEBUG_FRAME_LENGTH_BAD,
+                "DW_DLE_DEBUG_FRAME_LENGTH_BAD: an indexed "
+                "FDE is no longer readable");
+            return DW_DLV_ERROR;
+        }
+        return res;
+    }
+    res = _dwarf_create_fde_from_after_start(dbg,
+        &prefix, section_ptr, section->dss_size,
+        prefix.cf_addr_after_prefix, section_ptr_end,
+        index->fx_is_eh?1:0, entry->fe_cie,
+        entry->fe_cie->ci_address_size, &fde, error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    fde_end = fde->fd_fde_start + fde->fd_length +
+        fde->fd_length_size + fde->fd_extension_size;
+    if (fde_end < fde->fd_fde_instr_start) {
+        /*  Same sanity check as in
+            _dwarf_get_fde_list_internal(). */
+        dwarf_dealloc(dbg, fde, DW_DLA_FDE);
+        _dwarf_error(dbg,error,
+            DW_DLE_DEBUG_FRAME_POSSIBLE_ADDRESS_BOTCH);
+        return DW_DLV_ERROR;
+    }
+    entry->fe_fde = fde;
+    return DW_DLV_OK;
+}
+
+int
+dwarf_find_fde_at_pc(Dwarf_Debug dbg,
+    Dwarf_Bool is_eh,
+    Dwarf_Addr pc_of_interest,
+    Dwarf_Fde * returned_fde,
+    Dwarf_Addr * lopc,
+    Dwarf_Addr * hipc,
+    Dwarf_Error * error)
+{
+    struct Dwarf_Fde_Index_s *index = 0;
+    struct Dwarf_Fde_Index_Entry_s *entry = 0;
+    Dwarf_Unsigned low = 0;
+    Dwarf_Unsigned high = 0;
+    int res = 0;
+
+    CHECK_DBG(dbg,error,"dwarf_find_fde_at_pc()");
+    if (!returned_fde) {
+        _dwarf_error_string(dbg, error, DW_DLE_FDE_PTR_NULL,
+            "DW_DLE_FDE_PTR_NULL: dwarf_find_fde_at_pc() "
+            "requires a non-NULL Dwarf_Fde pointer");
+        return DW_DLV_ERROR;
+    }
+    res = _dwarf_load_fde_index(dbg,is_eh,&index,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    /*  Binary search for the last entry starting at or
+        before the pc. */
+    high = index->fx_count;
+    while (low < high) {
+        Dwarf_Unsigned middle = low + (high - low)/2;
+
+        if (index->fx_entries[middle].fe_low_pc <= pc_of_interest) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    if (!low) {
+        return DW_DLV_NO_ENTRY;
+    }
+    entry = index->fx_entries + low - 1;
+    /*  Skip back over empty or shorter FDEs sharing
+        the start address of the one that covers the pc. */
+    while (pc_of_interest - entry->fe_low_pc >= entry->fe_range) {
+        if (entry == index->fx_entries ||
+            entry[-1].fe_low_pc != entry->fe_low_pc) {
+            return DW_DLV_NO_ENTRY;
+        }
+        --entry;
+    }
+    if (!entry->fe_fde) {
+        res = create_indexed_fde(dbg,index,entry,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+    }
+    if (lopc) {
+        *lopc = entry->fe_low_pc;
+    }
+    if (hipc) {
+        *hipc = entry->fe_low_pc + entry->fe_range - 1;
+    }
+    *returned_fde = entry->fe_fde;
+    return DW_DLV_OK;
+}
+
+void
+_dwarf_destroy_fde_index(Dwarf_Debug dbg)
+{
+    free_fde_index(dbg->de_fde_index);
+    dbg->de_fde_index = 0;
+    free_fde_index(dbg->de_fde_index_eh);
+    dbg->de_fde_index_eh = 0;
+}
@@ -106,7 +106,7 @@ dwarf_init_path_dl(path true_path and globals, dbg1
     Created September 2018
 
     The init functions here cannot process archives.
-    Archives cannot be read by libdwarf.
+    See dwarf_archive_open() in dwarf_archive.c.
 */
 static int
 open_a_file(const char * name)
@@ -248,12 +248,14 @@ dump_header_fields(const char *w,Dwarf_Debug dbg)
 }
 #endif
 
-int
-dwarf_init_path_dl_a(const char *path,
+static int
+init_path_common(const char *path,
     char            * true_path_out_buffer,
     unsigned        true_path_bufferlen,
     unsigned        groupnumber,
     unsigned        universalnumber,
+    const char      ** wanted_sections,
+    unsigned        wanted_section_count,
     Dwarf_Handler   errhand,
     Dwarf_Ptr       errarg,
     Dwarf_Debug     * ret_dbg,
@@ -358,10 +360,11 @@ dwarf_init_path_dl_a(const char *path,
     }
     switch(ftype) {
     case DW_FTYPE_ELF: {
-        res = _dwarf_elf_nlsetup(fd,
+        res = _dwarf_elf_nlsetup_a(fd,
             file_path,
-            ftype,endian,offsetsize,filesize,
-            groupnumber,errhand,errarg,&dbg,error);
+            ftype,endian,offsetsize,0,(size_t)filesize,
+            groupnumber,wanted_sections,wanted_section_count,
+            errhand,errarg,&dbg,error);
         if (res != DW_DLV_OK) {
             close(fd);
             return res;
@@ -378,7 +381,8 @@ dwarf_init_path_dl_a(const char *path,
             file_path,
             universalnumber,
             ftype,endian,offsetsize,filesize,
-            groupnumber,errhand,errarg,&dbg,error);
+            groupnumber,wanted_sections,wanted_section_count,
+            errhand,errarg,&dbg,error);
         if (res != DW_DLV_OK) {
             close(fd);
             return res;
@@ -393,7 +397,8 @@ dwarf_init_path_dl_a(const char *path,
         res = _dwarf_pe_setup(fd,
             file_path,
             ftype,endian,offsetsize,filesize,
-            groupnumber,errhand,errarg,&dbg,error);
+            groupnumber,wanted_sections,wanted_section_count,
+            errhand,errarg,&dbg,error);
         if (res != DW_DLV_OK) {
             close(fd);
             return res;
@@ -413,6 +418,62 @@ dwarf_init_path_dl_a(const char *path,
     /* Cannot reach this line */
 }
 
+int
+dwarf_init_path_dl_a(const char *path,
+    char            * true_path_out_buffer,
+    unsigned        true_path_bufferlen,
+    unsigned        groupnumber,
+    unsigned        universalnumber,
+    Dwarf_Handler   errhand,
+    Dwarf_Ptr       errarg,
+    Dwarf_Debug     * ret_dbg,
+    char            ** dl_path_array,
+    unsigned int    dl_path_count,
+    unsigned char   * path_source,
+    Dwarf_Error     * error)
+{
+    return init_path_common(path,
+        true_path_out_buffer,true_path_bufferlen,
+        groupnumber,universalnumber,
+        0,0,
+        errhand,errarg,ret_dbg,
+        dl_path_array,dl_path_count,path_source,
+        error);
+}
+
+/*  New October 2026. As dwarf_init_path_a() but
+    only the named sections are set up, so an
+    unwinder or line-table reader does not pay for
+    symbols, groups and relocations it never uses. */
+int
+dwarf_init_path_sections(const char *path,
+    char            * true_path_out_buffer,
+    unsigned        true_path_bufferlen,
+    unsigned        groupnumber,
+    unsigned        universalnumber,
+    const char      ** std_section_names,
+    unsigned        name_count,
+    Dwarf_Handler   errhand,
+    Dwarf_Ptr       errarg,
+    Dwarf_Debug     * ret_dbg,
+    Dwarf_Error     * error)
+{
+    if (!std_section_names || !name_count) {
+        _dwarf_error_string(NULL,
+            error,DW_DLE_STRING_PTR_NULL,
+            "DW_DLE_STRING_PTR_NULL: dwarf_init_path_sections"
+            " needs at least one section name");
+        return DW_DLV_ERROR;
+    }
+    return init_path_common(path,
+        true_path_out_buffer,true_path_bufferlen,
+        groupnumber,universalnumber,
+        std_section_names,name_count,
+        errhand,errarg,ret_dbg,
+        0,0,0,
+        error);
+}
+
 /*  New March 2017, this provides for reading
     object files with multiple elf section groups.
     If you are unsure about group_number, use
@@ -469,7 +530,7 @@ dwarf_init_b(int fd,
         resm = _dwarf_macho_setup(fd,"",
             universalnumber,
             ftype,endian,offsetsize,filesize,
-            group_number,errhand,errarg,ret_dbg,error);
+            group_number,0,0,errhand,errarg,ret_dbg,error);
         if (resm != DW_DLV_OK) {
             return resm;
         }
@@ -483,7 +544,7 @@ dwarf_init_b(int fd,
         resp = _dwarf_pe_setup(fd,
             "",
             ftype,endian,offsetsize,filesize,
-            group_number,errhand,errarg,ret_dbg,error);
+            group_number,0,0,errhand,errarg,ret_dbg,error);
         if (resp != DW_DLV_OK) {
             return resp;
         }
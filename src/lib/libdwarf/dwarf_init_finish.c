@@ -39,6 +39,10 @@
 #include "stdafx.h"
 #endif /* HAVE_STDAFX_H */
 
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h> /* posix_fadvise() */
+#endif /* HAVE_FCNTL_H */
+
 #include "dwarf.h"
 #include "libdwarf.h"
 #include "libdwarf_private.h"
@@ -83,6 +87,10 @@
 #define SHT_GROUP 17
 #endif
 
+#ifndef SHF_GROUP
+#define SHF_GROUP (1 << 9)
+#endif
+
 #ifndef SHF_COMPRESSED
 /*  This from ubuntu xenial. Is in top of trunk binutils
     as of February 2016. Elf Section Flag */
@@ -327,6 +335,10 @@ this_section_dwarf_relevant(const char *scn_name,
             it is useful for split dwarf. */
         return TRUE;
     }
+    if (!strcmp(scn_name, ".gnu_debugaltlink")) {
+        /*  Not DWARF, names the dwz supplementary file. */
+        return TRUE;
+    }
     if (!strcmp(scn_name, ".gdb_index")) {
         return TRUE;
     }
@@ -525,6 +537,62 @@ insert_sht_list_in_group_map(Dwarf_Debug dbg,
     return DW_DLV_OK;
 }
 
+/*  With a section subset (dwarf_init_path_sections())
+    only the wanted DWARF sections are set up.
+    Relocation sections and .symtab/.strtab are kept:
+    a relocation section only attaches to a section
+    that was set up. */
+static int
+section_wanted_in_setup(Dwarf_Debug dbg,
+    const char *scn_name,
+    int type)
+{
+    int is_rela = FALSE;
+
+    if (!dbg->de_wanted_sections) {
+        return TRUE;
+    }
+    if (is_a_relx_section(scn_name,type,&is_rela) ||
+        is_a_special_section_semi_dwarf(scn_name)) {
+        return TRUE;
+    }
+    return _dwarf_section_is_wanted(dbg->de_wanted_sections,
+        dbg->de_wanted_section_count,scn_name);
+}
+
+/*  COMDAT group sections only matter to a section
+    subset if one of the wanted sections is in a group. */
+static int
+wanted_sections_need_groups(Dwarf_Debug dbg,
+    Dwarf_Unsigned section_count,
+    struct Dwarf_Obj_Access_Interface_a_s * obj)
+{
+    Dwarf_Unsigned i = 0;
+
+    if (!dbg->de_wanted_sections) {
+        return TRUE;
+    }
+    for (i = 0; i < section_count; ++i) {
+        struct Dwarf_Obj_Access_Section_a_s doas;
+        int err = 0;
+        int res = 0;
+
+        memset(&doas,0,sizeof(doas));
+        res = obj->ai_methods->om_get_section_info(obj->ai_object,
+            i, &doas, &err);
+        if (res != DW_DLV_OK) {
+            /*  Let determine_target_group() report it. */
+            return TRUE;
+        }
+        if ((doas.as_flags & SHF_GROUP) &&
+            _dwarf_section_is_wanted(dbg->de_wanted_sections,
+            dbg->de_wanted_section_count,doas.as_name)) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
+
 /*  Split dwarf CUs can be in an object with non-split
     or split may be in a separate object.
     If all in one object the default is to deal with group_number
@@ -561,6 +629,7 @@ determine_target_group(Dwarf_Unsigned section_count,
     struct Dwarf_Group_Data_s *grp = 0;
     unsigned comdat_group_next = 3;
     unsigned lowest_comdat_groupnum = 0;
+    int need_groups = TRUE;
 
     grp = &dbg->de_groupnumbers;
     grp->gd_number_of_groups = 0;
@@ -569,6 +638,8 @@ determine_target_group(Dwarf_Unsigned section_count,
         _dwarf_error(dbg,error,DW_DLE_GROUP_INTERNAL_ERROR);
         return DW_DLV_OK;
     }
+    need_groups = wanted_sections_need_groups(dbg,section_count,
+        obj);
     for (obj_section_index = 0; obj_section_index < section_count;
         ++obj_section_index) {
 
@@ -595,6 +666,10 @@ determine_target_group(Dwarf_Unsigned section_count,
         if (doas.as_type == SHT_GROUP) {
             /*  See assumptions in function comment above. */
             unsigned did_add_map = 0;
+
+            if (!need_groups) {
+                continue;
+            }
             /*  Add to our map. Here we
                 are assuming SHT_GROUP records come first.
                 Till proven wrong. */
@@ -619,7 +694,9 @@ determine_target_group(Dwarf_Unsigned section_count,
         scn_name = doas.as_name;
         if (!this_section_dwarf_relevant(scn_name,
             (int)doas.as_type,
-            &is_rela) ) {
+            &is_rela) ||
+            !section_wanted_in_setup(dbg,scn_name,
+            (int)doas.as_type)) {
             continue;
         }
 
@@ -823,7 +900,9 @@ _dwarf_setup(Dwarf_Debug dbg, Dwarf_Error * error)
         }
         if (!this_section_dwarf_relevant(scn_name,
             (int)doas.as_type,
-            &is_rela) ) {
+            &is_rela) ||
+            !section_wanted_in_setup(dbg,scn_name,
+            (int)doas.as_type)) {
             continue;
         }
         if (!is_a_relx_section(scn_name,(int)doas.as_type,
@@ -1012,6 +1091,20 @@ dwarf_object_init_b(Dwarf_Obj_Access_Interface_a* obj,
     unsigned groupnumber,
     Dwarf_Debug* ret_dbg,
     Dwarf_Error* error)
+{
+    return _dwarf_object_init_c(obj,errhand,errarg,
+        groupnumber,0,0,ret_dbg,error);
+}
+
+int
+_dwarf_object_init_c(Dwarf_Obj_Access_Interface_a* obj,
+    Dwarf_Handler errhand,
+    Dwarf_Ptr errarg,
+    unsigned groupnumber,
+    const char **wanted_sections,
+    unsigned wanted_section_count,
+    Dwarf_Debug* ret_dbg,
+    Dwarf_Error* error)
 {
     Dwarf_Debug dbg = 0;
     int setup_result = DW_DLV_OK;
@@ -1044,7 +1137,11 @@ dwarf_object_init_b(Dwarf_Obj_Access_Interface_a* obj,
     dbg->de_obj_file = obj;
     dbg->de_filesize = filesize;
     dbg->de_groupnumber = groupnumber;
+    dbg->de_wanted_sections = wanted_sections;
+    dbg->de_wanted_section_count = wanted_section_count;
     setup_result = _dwarf_setup(dbg, error);
+    dbg->de_wanted_sections = 0;
+    dbg->de_wanted_section_count = 0;
     if (setup_result == DW_DLV_OK) {
         int fission_result = load_debugfission_tables(dbg,error);
         /*  In most cases we get
@@ -1778,6 +1875,162 @@ dwarf_get_section_info_by_index_a(Dwarf_Debug dbg,
     return DW_DLV_NO_ENTRY;
 }
 
+/*  In a .dwo the standard names end in .dwo */
+static int
+std_name_matches(const char *std,const char *name,
+    size_t namelen)
+{
+    if (strncmp(std,name,namelen) ||
+        (std[namelen] && strcmp(std+namelen,".dwo"))) {
+        return FALSE;
+    }
+    return TRUE;
+}
+
+/*  Given a standard DWARF section name get the
+    section bytes as libdwarf sees them:
+    loaded, decompressed and relocated. */
+int
+dwarf_get_section_bytes(Dwarf_Debug dbg,
+    const char *std_section_name,
+    const Dwarf_Small **section_data,
+    Dwarf_Unsigned *section_size,
+    Dwarf_Error *error)
+{
+    unsigned i = 0;
+    size_t namelen = 0;
+
+    CHECK_DBG(dbg,error,"dwarf_get_section_bytes()");
+    if (!std_section_name || !section_data || !section_size) {
+        _dwarf_error_string(dbg,error,DW_DLE_DBG_NULL,
+            "DW_DLE_DBG_NULL: null argument pointer "
+            "passed to dwarf_get_section_bytes");
+        return DW_DLV_ERROR;
+    }
+    namelen = strlen(std_section_name);
+    for (i = 0; i < dbg->de_debug_sections_total_entries; ++i) {
+        struct Dwarf_Section_s *section =
+            dbg->de_debug_sections[i].ds_secdata;
+        int res = 0;
+
+        if (!std_name_matches(section->dss_standard_name,
+            std_section_name,namelen)) {
+            continue;
+        }
+        if (!section->dss_size) {
+            return DW_DLV_NO_ENTRY;
+        }
+        res = _dwarf_load_section(dbg,section,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        *section_data = section->dss_data;
+        *section_size = section->dss_size;
+        return DW_DLV_OK;
+    }
+    return DW_DLV_NO_ENTRY;
+}
+
+#if defined(POSIX_FADV_WILLNEED) && !defined(_WIN32)
+/*  Ask the kernel to start reading the file bytes of
+    object section sec_index. The call returns at once;
+    a later read() of the section waits only for
+    whatever has not arrived yet. */
+static int
+hint_section_willneed(Dwarf_Debug dbg,
+    Dwarf_Unsigned sec_index)
+{
+    struct Dwarf_Obj_Access_Interface_a_s *obj =
+        dbg->de_obj_file;
+    struct Dwarf_Obj_Access_Section_a_s doas;
+    int errnum = 0;
+    int res = 0;
+
+    if (!sec_index) {
+        return DW_DLV_NO_ENTRY;
+    }
+    doas = zerodoas;
+    res = obj->ai_methods->om_get_section_info(obj->ai_object,
+        sec_index, &doas, &errnum);
+    if (res != DW_DLV_OK || !doas.as_size) {
+        return DW_DLV_NO_ENTRY;
+    }
+    /*  A failure is not an error: the section is
+        simply read when needed, as without the hint. */
+    (void)posix_fadvise(dbg->de_obj_read_fd,
+        (off_t)(dbg->de_obj_read_offset + doas.as_offset),
+        (off_t)doas.as_size, POSIX_FADV_WILLNEED);
+    return DW_DLV_OK;
+}
+#endif /* POSIX_FADV_WILLNEED && !_WIN32 */
+
+/*  Start background reads of the sections a caller
+    is about to use, so the first access to, for example,
+    .debug_line does not stall on I/O one section at
+    a time. NULL names means every DWARF section
+    present. */
+int
+dwarf_prefetch_sections(Dwarf_Debug dbg,
+    const char   ** std_section_names,
+    unsigned        name_count,
+    Dwarf_Error   * error)
+{
+#if defined(POSIX_FADV_WILLNEED) && !defined(_WIN32)
+    unsigned i = 0;
+    int hinted = FALSE;
+#endif /* POSIX_FADV_WILLNEED && !_WIN32 */
+
+    CHECK_DBG(dbg,error,"dwarf_prefetch_sections()");
+    if (name_count && !std_section_names) {
+        _dwarf_error_string(dbg,error,DW_DLE_DBG_NULL,
+            "DW_DLE_DBG_NULL: null section name array "
+            "passed to dwarf_prefetch_sections");
+        return DW_DLV_ERROR;
+    }
+    if (!dbg->de_obj_file || !dbg->de_obj_read_fd_valid) {
+        return DW_DLV_NO_ENTRY;
+    }
+#if defined(POSIX_FADV_WILLNEED) && !defined(_WIN32)
+    for (i = 0; i < dbg->de_debug_sections_total_entries; ++i) {
+        struct Dwarf_Section_s *section =
+            dbg->de_debug_sections[i].ds_secdata;
+
+        if (!section->dss_size || section->dss_data) {
+            /*  Absent or already loaded. */
+            continue;
+        }
+        if (std_section_names) {
+            unsigned k = 0;
+
+            for (k = 0; k < name_count; ++k) {
+                const char *n = std_section_names[k];
+
+                if (n && std_name_matches(
+                    section->dss_standard_name,n,strlen(n))) {
+                    break;
+                }
+            }
+            if (k == name_count) {
+                continue;
+            }
+        }
+        if (hint_section_willneed(dbg,section->dss_index) ==
+            DW_DLV_OK) {
+            hinted = TRUE;
+        }
+        /*  A relocatable object also reads the
+            relocations when the section is loaded. */
+        if (section->dss_reloc_index) {
+            (void)hint_section_willneed(dbg,
+                section->dss_reloc_index);
+        }
+    }
+    return hinted? DW_DLV_OK : DW_DLV_NO_ENTRY;
+#else /* !POSIX_FADV_WILLNEED || _WIN32 */
+    return DW_DLV_NO_ENTRY;
+#endif /* POSIX_FADV_WILLNEED && !_WIN32 */
+}
+
 /*  Get section count */
 Dwarf_Unsigned
 dwarf_get_section_count(Dwarf_Debug dbg)
@@ -430,6 +430,149 @@ report_bogus_stmt_list_form(Dwarf_Debug dbg,
     dwarfstring_destructor(&f);
 }
 
+static void
+free_srcfiles_chain(Dwarf_Debug dbg, Dwarf_Chain head)
+{
+    while (head) {
+        Dwarf_Chain next = head->ch_next;
+
+        if (head->ch_item) {
+            dwarf_dealloc(dbg,head->ch_item,DW_DLA_STRING);
+        }
+        dwarf_dealloc(dbg,head,DW_DLA_CHAIN);
+        head = next;
+    }
+}
+
+/*  Builds the dwarf_srcfiles() array of full path names
+    from the first filecount file entries of line_context.
+    The line_context is not freed here, the caller
+    owns it.  */
+static int
+build_srcfiles_list(Dwarf_Debug dbg,
+    Dwarf_Line_Context line_context,
+    Dwarf_Unsigned filecount,
+    char ***srcfiles,
+    Dwarf_Signed * srcfilecount,
+    Dwarf_Error * error)
+{
+    /*  This points to a block of char *'s, each of which points to a
+        file name. */
+    char **ret_files = 0;
+    /*  Used to chain the file names. */
+    Dwarf_Chain curr_chain = NULL;
+    Dwarf_Chain head_chain = NULL;
+    Dwarf_Chain * plast = &head_chain;
+    Dwarf_Unsigned i = 0;
+    int res = DW_DLV_ERROR;
+
+    {
+        Dwarf_File_Entry fe = 0;
+        Dwarf_File_Entry fe2 =line_context->lc_file_entries;
+        Dwarf_Signed baseindex = 0;
+        Dwarf_Signed file_count = 0;
+        Dwarf_Signed endindex = 0;
+        Dwarf_Signed ifp = 0;
+
+        res =  dwarf_srclines_files_indexes(line_context, &baseindex,
+            &file_count, &endindex, error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        if (filecount > (Dwarf_Unsigned)file_count) {
+            filecount = (Dwarf_Unsigned)file_count;
+        }
+        endindex = baseindex + (Dwarf_Signed)filecount;
+        for (ifp = baseindex; ifp < endindex && fe2;
+            ++ifp,fe2 = fe->fi_next ) {
+            int sres = 0;
+            char *name_out = 0;
+
+            fe = fe2;
+            sres = create_fullest_file_path(dbg,fe,line_context,
+                &name_out,error);
+            if (sres != DW_DLV_OK) {
+                free_srcfiles_chain(dbg,head_chain);
+                return sres;
+            }
+            curr_chain =
+                (Dwarf_Chain) _dwarf_get_alloc(dbg, DW_DLA_CHAIN, 1);
+            if (curr_chain == NULL) {
+                dwarf_dealloc(dbg,name_out,DW_DLA_STRING);
+                free_srcfiles_chain(dbg,head_chain);
+                _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+                return DW_DLV_ERROR;
+            }
+            curr_chain->ch_item = name_out;
+            (*plast) = curr_chain;
+            plast = &(curr_chain->ch_next);
+        }
+    }
+    if (!head_chain || filecount == 0) {
+        free_srcfiles_chain(dbg,head_chain);
+        *srcfiles = NULL;
+        *srcfilecount = 0;
+        return DW_DLV_NO_ENTRY;
+    }
+    if ((Dwarf_Signed)filecount < 0) {
+        /*  Impossible corruption! */
+        free_srcfiles_chain(dbg,head_chain);
+        _dwarf_error_string(dbg,error,DW_DLE_LINE_COUNT_WRONG,
+            "DW_DLE_LINE_COUNT_WRONG "
+            "Call to dwarf_srcfiles finds an impossible "
+            "source files count");
+        return DW_DLV_ERROR;
+    }
+    ret_files = (char **)
+        _dwarf_get_alloc(dbg, DW_DLA_LIST, filecount);
+    if (ret_files == NULL) {
+        free_srcfiles_chain(dbg,head_chain);
+        _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
+        return DW_DLV_ERROR;
+    }
+
+    curr_chain = head_chain;
+    for (i = 0; i < filecount; i++) {
+        Dwarf_Chain prev = 0;
+        *(ret_files + i) = curr_chain->ch_item;
+        curr_chain->ch_item = 0;
+        prev = curr_chain;
+        curr_chain = curr_chain->ch_next;
+        dwarf_dealloc(dbg, prev, DW_DLA_CHAIN);
+    }
+    /*  Our chain is not recorded in the line_context so
+        the line_context destructor will not destroy our
+        list of strings or our strings.
+        Our caller has to do the deallocations.  */
+    *srcfiles = ret_files;
+    *srcfilecount = (Dwarf_Signed)filecount;
+    return DW_DLV_OK;
+}
+
+/*  Returns the same array dwarf_srcfiles() would
+    for the CU, but from a line context already
+    set up by dwarf_srclines_b(), so the
+    line table header is not read a second time.
+    DW_LNE_define_file entries added while reading
+    the line program are not included, just as
+    dwarf_srcfiles() does not include them. */
+int
+dwarf_srcfiles_from_linecontext(Dwarf_Line_Context line_context,
+    char ***srcfiles,
+    Dwarf_Signed * srcfilecount,
+    Dwarf_Error * error)
+{
+    if (!line_context ||
+        line_context->lc_magic != DW_CONTEXT_MAGIC) {
+        _dwarf_error(NULL, error, DW_DLE_LINE_CONTEXT_BOTCH);
+        return DW_DLV_ERROR;
+    }
+    return build_srcfiles_list(line_context->lc_dbg,
+        line_context,
+        line_context->lc_file_entry_header_count,
+        srcfiles,srcfilecount,error);
+}
+
 /*  Although source files is supposed to return the
     source files in the compilation-unit, it does
     not look for any in the statement program.  In
@@ -475,24 +618,13 @@ dwarf_srcfiles(Dwarf_Die die,
         attribute. */
     Dwarf_Unsigned line_offset = 0;
 
-    /*  This points to a block of char *'s, each of which points to a
-        file name. */
-    char **ret_files = 0;
-
     /*  The Dwarf_Debug this die belongs to. */
     Dwarf_Debug dbg = 0;
     Dwarf_CU_Context context = 0;
     Dwarf_Line_Context  line_context = 0;
-
-    /*  Used to chain the file names. */
-    Dwarf_Chain curr_chain = NULL;
-    Dwarf_Chain head_chain = NULL;
-    Dwarf_Chain * plast = &head_chain;
-
     Dwarf_Half attrform = 0;
     int resattr = DW_DLV_ERROR;
     int lres = DW_DLV_ERROR;
-    unsigned i = 0;
     int res = DW_DLV_ERROR;
     Dwarf_Small *section_start = 0;
 
@@ -639,98 +771,11 @@ dwarf_srcfiles(Dwarf_Die die,
         start with comp_dir and name. */
     line_context->lc_compilation_directory = comp_dir;
     /* We are in dwarf_srcfiles() */
-    {
-        Dwarf_File_Entry fe = 0;
-        Dwarf_File_Entry fe2 =line_context->lc_file_entries;
-        Dwarf_Signed baseindex = 0;
-        Dwarf_Signed file_count = 0;
-        Dwarf_Signed endindex = 0;
-        Dwarf_Signed ifp = 0;
-
-        res =  dwarf_srclines_files_indexes(line_context, &baseindex,
-            &file_count, &endindex, error);
-        if (res != DW_DLV_OK) {
-            return res;
-        }
-        for (ifp = baseindex; ifp < endindex; 
-            ++ifp,fe2 = fe->fi_next ) {
-            int sres = 0;
-            char *name_out = 0;
-
-            fe = fe2;
-            sres = create_fullest_file_path(dbg,fe,line_context,
-                &name_out,error);
-            if (sres != DW_DLV_OK) {
-                dwarf_dealloc(dbg, line_context, DW_DLA_LINE_CONTEXT);
-                /* This can leak some strings */
-                return sres;
-            }
-            curr_chain =
-                (Dwarf_Chain) _dwarf_get_alloc(dbg, DW_DLA_CHAIN, 1);
-            if (curr_chain == NULL) {
-                dwarf_dealloc(dbg,name_out,DW_DLA_STRING);
-                dwarf_dealloc(dbg, line_context, DW_DLA_LINE_CONTEXT);
-                _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
-                return DW_DLV_ERROR;
-            }
-            curr_chain->ch_item = name_out;
-            (*plast) = curr_chain;
-            plast = &(curr_chain->ch_next);
-        }
-    }
-    if (!head_chain) {
-        dwarf_dealloc(dbg, line_context, DW_DLA_LINE_CONTEXT);
-        *srcfiles = NULL;
-        *srcfilecount = 0;
-        return DW_DLV_NO_ENTRY;
-    }
-
-    /* We are in dwarf_srcfiles() */
-    if (line_context->lc_file_entry_count == 0) {
-        dwarf_dealloc(dbg, line_context, DW_DLA_LINE_CONTEXT);
-        *srcfiles = NULL;
-        *srcfilecount = 0;
-        return DW_DLV_NO_ENTRY;
-    }
-
-    ret_files = (char **)
-        _dwarf_get_alloc(dbg, DW_DLA_LIST,
-        line_context->lc_file_entry_count);
-    if (ret_files == NULL) {
-        dwarf_dealloc(dbg, line_context, DW_DLA_LINE_CONTEXT);
-        _dwarf_error(dbg, error, DW_DLE_ALLOC_FAIL);
-        return DW_DLV_ERROR;
-    }
-
-    curr_chain = head_chain;
-    for (i = 0; i < line_context->lc_file_entry_count; i++) {
-        Dwarf_Chain prev = 0;
-        *(ret_files + i) = curr_chain->ch_item;
-        curr_chain->ch_item = 0;
-        prev = curr_chain;
-        curr_chain = curr_chain->ch_next;
-        dwarf_dealloc(dbg, prev, DW_DLA_CHAIN);
-    }
-    /*  Our chain is not recorded in the line_context so
-        the line_context destructor will not destroy our
-        list of strings or our strings.
-        Our caller has to do the deallocations.  */
-    {
-        Dwarf_Signed srccount =
-            (Dwarf_Signed)line_context->lc_file_entry_count;
-        if (srccount < 0) {
-            /*  Impossible corruption! */
-            _dwarf_error_string(dbg,error,DW_DLE_LINE_COUNT_WRONG,
-                "DW_DLE_LINE_COUNT_WRONG "
-                "Call to dwarf_srcfiles finds an impossible "
-                "source files count");
-            return DW_DLV_ERROR;
-        }
-        *srcfiles = ret_files;
-        *srcfilecount = srccount;
-    }
+    res = build_srcfiles_list(dbg,line_context,
+        line_context->lc_file_entry_count,
+        srcfiles,srcfilecount,error);
     dwarf_dealloc(dbg, line_context, DW_DLA_LINE_CONTEXT);
-    return DW_DLV_OK;
+    return res;
 }
 
 /*  Return DW_DLV_OK if ok. else DW_DLV_NO_ENTRY or DW_DLV_ERROR
@@ -226,6 +226,10 @@ struct Dwarf_Line_Context_s {
     /*  Count of number of source files for this set of Dwarf_Line
         structures. */
     Dwarf_Unsigned lc_file_entry_count; /* all versions */
+    /*  The count as of the end of the line table header,
+        so not counting DW_LNE_define_file entries.
+        The count dwarf_srcfiles() reports. */
+    Dwarf_Unsigned lc_file_entry_header_count;
     /*  Values Easing the process of indexing
         through lc_file_entries. */
     Dwarf_Unsigned lc_file_entry_baseindex;
@@ -0,0 +1,688 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it
+  and/or modify it under the terms of version 2.1 of the
+  GNU Lesser General Public License as published by the Free
+  Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General
+  Public License along with this program; if not, write the
+  Free Software Foundation, Inc., 51 Franklin Street - Fifth
+  Floor, Boston MA 02110-1301, USA.
+
+*/
+
+
+/*  The reverse of the line table: from a source file and
+    line to the address ranges generated for it.
+    Built once per Dwarf_Debug, on first use, from the
+    line tables of all CUs in .debug_info. File names are
+    canonicalized so one file named differently in different
+    CUs (via comp_dir, include directories, "." or "..")
+    is one file here. Lookups are a binary search. */
+
+#include <config.h>
+
+#include <stdlib.h> /* calloc() free() malloc() qsort() realloc() */
+#include <string.h> /* memcpy() strcmp() strlen() */
+
+#if defined(_WIN32) && defined(HAVE_STDAFX_H)
+#include "stdafx.h"
+#endif /* HAVE_STDAFX_H */
+
+#ifdef HAVE_STDINT_H
+#include <stdint.h> /* uintptr_t */
+#endif /* HAVE_STDINT_H */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "libdwarf_private.h"
+#include "dwarf_base_types.h"
+#include "dwarf_opaque.h"
+#include "dwarf_alloc.h"
+#include "dwarf_error.h"
+#include "dwarf_util.h"
+#include "dwarf_tsearch.h"
+#include "dwarf_line_index.h"
+
+static DW_TSHASHTYPE
+file_hashfunc(const void *keyp)
+{
+    const struct Dwarf_Line_Index_File_s *f = keyp;
+    const unsigned char *cp = (const unsigned char *)f->lf_path;
+    DW_TSHASHTYPE h = 5381;
+
+    for ( ; *cp; ++cp) {
+        h = h * 33 + *cp;
+    }
+    return h;
+}
+
+static int
+file_compare(const void *l, const void *r)
+{
+    const struct Dwarf_Line_Index_File_s *lp = l;
+    const struct Dwarf_Line_Index_File_s *rp = r;
+
+    return strcmp(lp->lf_path,rp->lf_path);
+}
+
+static void
+file_free_node(void *nodep)
+{
+    struct Dwarf_Line_Index_File_s *f = nodep;
+
+    free(f->lf_path);
+    free(f);
+}
+
+static void
+free_line_index(struct Dwarf_Line_Index_s *li)
+{
+    if (li->li_file_tree) {
+        dwarf_tdestroy(li->li_file_tree,file_free_node);
+        li->li_file_tree = 0;
+    }
+    free(li->li_files);
+    free(li->li_entries);
+    free(li);
+}
+
+void
+_dwarf_destroy_line_index(Dwarf_Debug dbg)
+{
+    if (dbg->de_line_index) {
+        free_line_index(dbg->de_line_index);
+        dbg->de_line_index = 0;
+    }
+}
+
+/*  Lexically normalizes a path: backslashes become
+    slashes, and empty and "." components and
+    "dir/.." pairs are removed and a drive letter
+    is made lower case. Symbolic links are
+    not (and cannot here be) resolved.
+    Returns malloc space or NULL. */
+static char *
+canonical_path(const char *in)
+{
+    size_t len = strlen(in);
+    /* Room for "." if in is empty. */
+    char *out = (char *)malloc(len+2);
+    const char *cp = in;
+    size_t o = 0;
+    size_t root = 0;
+
+    if (!out) {
+        return NULL;
+    }
+    if (in[0] == '/' || in[0] == '\\') {
+        out[o++] = '/';
+        root = 1;
+    } else if (len >= 2 && in[1] == ':') {
+        /* Windows drive letter, either case */
+        out[o++] = (in[0] >= 'A' && in[0] <= 'Z')?
+            (char)(in[0] - 'A' + 'a'):in[0];
+        out[o++] = ':';
+        cp += 2;
+        if (*cp == '/' || *cp == '\\') {
+            out[o++] = '/';
+        }
+        root = o;
+    }
+    while (*cp) {
+        const char *start = 0;
+        size_t clen = 0;
+
+        while (*cp == '/' || *cp == '\\') {
+            ++cp;
+        }
+        start = cp;
+        while (*cp && *cp != '/' && *cp != '\\') {
+            ++cp;
+        }
+        clen = (size_t)(cp - start);
+        if (!clen || (clen == 1 && start[0] == '.')) {
+            continue;
+        }
+        if (clen == 2 && start[0] == '.' && start[1] == '.') {
+            /*  Remove the previous component unless
+                there is none or it is itself "..". */
+            size_t prev = o;
+
+            while (prev > root && out[prev-1] != '/') {
+                --prev;
+            }
+            if (o > root && !(o - prev == 2 &&
+                out[prev] == '.' && out[prev+1] == '.')) {
+                o = prev;
+                if (o > root) {
+                    --o; /* the separating slash */
+                }
+                continue;
+            }
+            if (root && o == root) {
+                /* "/.." is "/" */
+                continue;
+            }
+        }
+        if (o > root) {
+            out[o++] = '/';
+        }
+        memcpy(out+o,start,clen);
+        o += clen;
+    }
+    if (!o) {
+        out[o++] = '.';
+    }
+    out[o] = 0;
+    return out;
+}
+
+static int
+intern_file(Dwarf_Debug dbg,
+    struct Dwarf_Line_Index_s *li,
+    const char *name,
+    Dwarf_Unsigned *id_out,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Line_Index_File_s  key;
+    struct Dwarf_Line_Index_File_s *f = 0;
+    void *found = 0;
+    char *path = canonical_path(name);
+
+    if (!path) {
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: allocating a line index "
+            "file name");
+        return DW_DLV_ERROR;
+    }
+    key.lf_path = path;
+    key.lf_id = 0;
+    found = dwarf_tfind(&key,&li->li_file_tree,file_compare);
+    if (found) {
+        free(path);
+        *id_out = (*(struct Dwarf_Line_Index_File_s **)found)->lf_id;
+        return DW_DLV_OK;
+    }
+    if (li->li_file_count >= li->li_file_alloc) {
+        struct Dwarf_Line_Index_File_s **newf = 0;
+        Dwarf_Unsigned newalloc = li->li_file_alloc?
+            li->li_file_alloc*2:64;
+
+        newf = (struct Dwarf_Line_Index_File_s **)realloc(
+            li->li_files,
+            newalloc*sizeof(struct Dwarf_Line_Index_File_s *));
+        if (!newf) {
+            free(path);
+            _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+                "DW_DLE_ALLOC_FAIL: growing the line index "
+                "file list");
+            return DW_DLV_ERROR;
+        }
+        li->li_files = newf;
+        li->li_file_alloc = newalloc;
+    }
+    f = (struct Dwarf_Line_Index_File_s *)calloc(1,
+        sizeof(struct Dwarf_Line_Index_File_s));
+    if (!f) {
+        free(path);
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: allocating a line index "
+            "file record");
+        return DW_DLV_ERROR;
+    }
+    f->lf_path = path;
+    f->lf_id = li->li_file_count;
+    found = dwarf_tsearch(f,&li->li_file_tree,file_compare);
+    if (!found) {
+        file_free_node(f);
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: inserting a line index "
+            "file record");
+        return DW_DLV_ERROR;
+    }
+    li->li_files[li->li_file_count++] = f;
+    *id_out = f->lf_id;
+    return DW_DLV_OK;
+}
+
+static int
+add_entry(Dwarf_Debug dbg,
+    struct Dwarf_Line_Index_s *li,
+    struct Dwarf_Line_Index_Entry_s *e,
+    Dwarf_Error *error)
+{
+    if (li->li_entry_count >= li->li_entry_alloc) {
+        struct Dwarf_Line_Index_Entry_s *newe = 0;
+        Dwarf_Unsigned newalloc = li->li_entry_alloc?
+            li->li_entry_alloc*2:1024;
+
+        newe = (struct Dwarf_Line_Index_Entry_s *)realloc(
+            li->li_entries,
+            newalloc*sizeof(struct Dwarf_Line_Index_Entry_s));
+        if (!newe) {
+            _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+                "DW_DLE_ALLOC_FAIL: growing the line index");
+            return DW_DLV_ERROR;
+        }
+        li->li_entries = newe;
+        li->li_entry_alloc = newalloc;
+    }
+    li->li_entries[li->li_entry_count++] = *e;
+    return DW_DLV_OK;
+}
+
+/*  Every row but an end_sequence row covers the
+    addresses up to the next row of its sequence.
+    Compilers emit several rows at one address (one
+    per column, often only the first with is_stmt):
+    the statement flag of such an empty row carries
+    to the next row when that is the same line. */
+static int
+index_cu_lines(Dwarf_Debug dbg,
+    struct Dwarf_Line_Index_s *li,
+    Dwarf_Die cu_die,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned version = 0;
+    Dwarf_Small table_count = 0;
+    Dwarf_Line_Context context = 0;
+    Dwarf_Line *lines = 0;
+    Dwarf_Signed line_count = 0;
+    char **srcfiles = 0;
+    Dwarf_Signed srcfiles_count = 0;
+    Dwarf_Unsigned *file_ids = 0;
+    Dwarf_Signed i = 0;
+    Dwarf_Bool carry_stmt = FALSE;
+    Dwarf_Unsigned carry_fileno = 0;
+    Dwarf_Unsigned carry_line = 0;
+    Dwarf_Addr carry_addr = 0;
+    int res = 0;
+
+    res = dwarf_srclines_b(cu_die,&version,&table_count,
+        &context,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_srclines_from_linecontext(context,&lines,
+        &line_count,error);
+    if (res == DW_DLV_OK) {
+        res = dwarf_srcfiles_from_linecontext(context,&srcfiles,
+            &srcfiles_count,error);
+    }
+    if (res == DW_DLV_OK && srcfiles_count > 0) {
+        file_ids = (Dwarf_Unsigned *)malloc(
+            srcfiles_count*sizeof(Dwarf_Unsigned));
+        if (!file_ids) {
+            _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+                "DW_DLE_ALLOC_FAIL: allocating the line index "
+                "file map of a CU");
+            res = DW_DLV_ERROR;
+        }
+        for (i = 0; res == DW_DLV_OK && i < srcfiles_count; ++i) {
+            res = intern_file(dbg,li,srcfiles[i],
+                &file_ids[i],error);
+        }
+    }
+    for (i = 0; res == DW_DLV_OK && i+1 < line_count; ++i) {
+        struct Dwarf_Line_Index_Entry_s e;
+        Dwarf_Bool end_seq = FALSE;
+        Dwarf_Unsigned fileno = 0;
+        Dwarf_Unsigned index = 0;
+        Dwarf_Addr next_addr = 0;
+
+        memset(&e,0,sizeof(e));
+        res = dwarf_lineendsequence(lines[i],&end_seq,error);
+        if (res != DW_DLV_OK || end_seq) {
+            carry_stmt = FALSE;
+            continue;
+        }
+        res = dwarf_lineaddr(lines[i],&e.le_low,error);
+        if (res == DW_DLV_OK) {
+            res = dwarf_lineaddr(lines[i+1],&next_addr,error);
+        }
+        if (res == DW_DLV_OK) {
+            res = dwarf_lineno(lines[i],&e.le_line,error);
+        }
+        if (res == DW_DLV_OK) {
+            res = dwarf_line_srcfileno(lines[i],&fileno,error);
+        }
+        if (res == DW_DLV_OK) {
+            res = dwarf_linebeginstatement(lines[i],
+                &e.le_is_stmt,error);
+        }
+        if (res != DW_DLV_OK || !e.le_line) {
+            continue;
+        }
+        if (carry_stmt && carry_addr == e.le_low &&
+            carry_fileno == fileno && carry_line == e.le_line) {
+            e.le_is_stmt = TRUE;
+        }
+        carry_stmt = FALSE;
+        if (next_addr <= e.le_low) {
+            if (next_addr == e.le_low && e.le_is_stmt) {
+                carry_stmt = TRUE;
+                carry_addr = e.le_low;
+                carry_fileno = fileno;
+                carry_line = e.le_line;
+            }
+            continue;
+        }
+        /*  As for DW_AT_decl_file, file numbers
+            are zero-based from DWARF5 on. */
+        if (version >= DW_LINE_VERSION5) {
+            index = fileno;
+        } else if (fileno) {
+            index = fileno - 1;
+        } else {
+            continue;
+        }
+        if (index >= (Dwarf_Unsigned)srcfiles_count) {
+            continue;
+        }
+        e.le_file = file_ids[index];
+        e.le_high = next_addr;
+        res = add_entry(dbg,li,&e,error);
+    }
+    free(file_ids);
+    if (srcfiles) {
+        for (i = 0; i < srcfiles_count; ++i) {
+            dwarf_dealloc(dbg,srcfiles[i],DW_DLA_STRING);
+        }
+        dwarf_dealloc(dbg,srcfiles,DW_DLA_LIST);
+    }
+    dwarf_srclines_dealloc_b(context);
+    if (res == DW_DLV_NO_ENTRY) {
+        res = DW_DLV_OK;
+    }
+    return res;
+}
+
+static int
+entry_compare(const void *l, const void *r)
+{
+    const struct Dwarf_Line_Index_Entry_s *lp = l;
+    const struct Dwarf_Line_Index_Entry_s *rp = r;
+
+    if (lp->le_file != rp->le_file) {
+        return lp->le_file < rp->le_file? -1:1;
+    }
+    if (lp->le_line != rp->le_line) {
+        return lp->le_line < rp->le_line? -1:1;
+    }
+    if (lp->le_low != rp->le_low) {
+        return lp->le_low < rp->le_low? -1:1;
+    }
+    return 0;
+}
+
+/*  Sorts the entries and joins touching or overlapping
+    ranges of the same file, line and is_stmt. */
+static void
+sort_and_merge(struct Dwarf_Line_Index_s *li)
+{
+    Dwarf_Unsigned i = 0;
+    Dwarf_Unsigned o = 0;
+
+    if (!li->li_entry_count) {
+        return;
+    }
+    qsort(li->li_entries,(size_t)li->li_entry_count,
+        sizeof(struct Dwarf_Line_Index_Entry_s),entry_compare);
+    for (i = 1; i < li->li_entry_count; ++i) {
+        struct Dwarf_Line_Index_Entry_s *prev =
+            li->li_entries + o;
+        struct Dwarf_Line_Index_Entry_s *cur =
+            li->li_entries + i;
+
+        if (cur->le_file == prev->le_file &&
+            cur->le_line == prev->le_line &&
+            cur->le_is_stmt == prev->le_is_stmt &&
+            cur->le_low <= prev->le_high) {
+            if (cur->le_high > prev->le_high) {
+                prev->le_high = cur->le_high;
+            }
+            continue;
+        }
+        ++o;
+        li->li_entries[o] = *cur;
+    }
+    li->li_entry_count = o+1;
+}
+
+static int
+build_line_index(Dwarf_Debug dbg,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Line_Index_s *li = 0;
+    Dwarf_Unsigned offset = 0;
+    Dwarf_Unsigned section_size = 0;
+    int res = 0;
+
+    res = _dwarf_load_debug_info(dbg,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    li = (struct Dwarf_Line_Index_s *)calloc(1,
+        sizeof(struct Dwarf_Line_Index_s));
+    if (!li) {
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: allocating the line index");
+        return DW_DLV_ERROR;
+    }
+    dwarf_initialize_search_hash(&li->li_file_tree,
+        file_hashfunc,0);
+    section_size = dbg->de_debug_info.dss_size;
+    /*  Walk the CUs by offset so the caller's
+        dwarf_next_cu_header_e() position is untouched. */
+    while (offset < section_size) {
+        Dwarf_Off cu_die_offset = 0;
+        Dwarf_Die cu_die = 0;
+        Dwarf_Unsigned next = 0;
+
+        res = dwarf_get_cu_die_offset_given_cu_header_offset_b(
+            dbg,offset,TRUE,&cu_die_offset,error);
+        if (res == DW_DLV_OK) {
+            res = dwarf_offdie_b(dbg,cu_die_offset,TRUE,
+                &cu_die,error);
+        }
+        if (res == DW_DLV_NO_ENTRY) {
+            break;
+        }
+        if (res == DW_DLV_OK) {
+            next = _dwarf_calculate_next_cu_context_offset(
+                cu_die->di_cu_context);
+            res = index_cu_lines(dbg,li,cu_die,error);
+            dwarf_dealloc_die(cu_die);
+        }
+        if (res == DW_DLV_ERROR) {
+            free_line_index(li);
+            return res;
+        }
+        if (next <= offset) {
+            break;
+        }
+        offset = next;
+    }
+    sort_and_merge(li);
+    dbg->de_line_index = li;
+    return DW_DLV_OK;
+}
+
+/*  TRUE if path is name or ends with "/name". */
+static Dwarf_Bool
+path_matches(const char *path, const char *name,
+    size_t namelen, Dwarf_Bool exact)
+{
+    size_t plen = strlen(path);
+
+    if (plen < namelen) {
+        return FALSE;
+    }
+    if (plen == namelen) {
+        return !strcmp(path,name);
+    }
+    if (exact) {
+        return FALSE;
+    }
+    return path[plen-namelen-1] == '/' &&
+        !strcmp(path+plen-namelen,name);
+}
+
+static int
+range_compare(const void *l, const void *r)
+{
+    const Dwarf_Ranges *lp = l;
+    const Dwarf_Ranges *rp = r;
+
+    if (lp->dwr_addr1 != rp->dwr_addr1) {
+        return lp->dwr_addr1 < rp->dwr_addr1? -1:1;
+    }
+    return 0;
+}
+
+int
+dwarf_addr_ranges_for_source_line(Dwarf_Debug dbg,
+    const char     *file,
+    Dwarf_Unsigned  line,
+    Dwarf_Bool      stmt_only,
+    Dwarf_Ranges  **ranges_out,
+    Dwarf_Signed   *range_count_out,
+    Dwarf_Error    *error)
+{
+    struct Dwarf_Line_Index_s *li = 0;
+    Dwarf_Ranges *ranges = 0;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Unsigned pass = 0;
+    Dwarf_Bool exact = FALSE;
+    char *name = 0;
+    size_t namelen = 0;
+    int res = 0;
+
+    CHECK_DBG(dbg,error,"dwarf_addr_ranges_for_source_line()");
+    if (!file || !ranges_out || !range_count_out) {
+        _dwarf_error_string(dbg,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_addr_ranges_for_source_line() passed "
+            "a NULL pointer");
+        return DW_DLV_ERROR;
+    }
+    if (!dbg->de_line_index) {
+        res = build_line_index(dbg,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+    }
+    li = dbg->de_line_index;
+    name = canonical_path(file);
+    if (!name) {
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: allocating a file name "
+            "in dwarf_addr_ranges_for_source_line()");
+        return DW_DLV_ERROR;
+    }
+    namelen = strlen(name);
+    exact = name[0] == '/' || (namelen >= 2 && name[1] == ':');
+
+    /*  Pass 0 counts the ranges, pass 1 fills them in. */
+    for (pass = 0; pass < 2; ++pass) {
+        Dwarf_Unsigned f = 0;
+        Dwarf_Unsigned n = 0;
+
+        for (f = 0; f < li->li_file_count; ++f) {
+            Dwarf_Unsigned lo = 0;
+            Dwarf_Unsigned hi = li->li_entry_count;
+
+            if (!path_matches(li->li_files[f]->lf_path,name,
+                namelen,exact)) {
+                continue;
+            }
+            while (lo < hi) {
+                Dwarf_Unsigned mid = lo + (hi - lo)/2;
+                struct Dwarf_Line_Index_Entry_s *e =
+                    li->li_entries + mid;
+
+                if (e->le_file < f ||
+                    (e->le_file == f && e->le_line < line)) {
+                    lo = mid + 1;
+                } else {
+                    hi = mid;
+                }
+            }
+            for ( ; lo < li->li_entry_count; ++lo) {
+                struct Dwarf_Line_Index_Entry_s *e =
+                    li->li_entries + lo;
+
+                if (e->le_file != f || e->le_line != line) {
+                    break;
+                }
+                if (stmt_only && !e->le_is_stmt) {
+                    continue;
+                }
+                if (pass) {
+                    ranges[n].dwr_addr1 = e->le_low;
+                    ranges[n].dwr_addr2 = e->le_high;
+                    ranges[n].dwr_type = DW_RANGES_ENTRY;
+                }
+                ++n;
+            }
+        }
+        if (!pass) {
+            if (!n) {
+                free(name);
+                return DW_DLV_NO_ENTRY;
+            }
+            ranges = (Dwarf_Ranges *)_dwarf_get_alloc(dbg,
+                DW_DLA_RANGES,n);
+            if (!ranges) {
+                free(name);
+                _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+                    "DW_DLE_ALLOC_FAIL: allocating the ranges "
+                    "of dwarf_addr_ranges_for_source_line()");
+                return DW_DLV_ERROR;
+            }
+        }
+        count = n;
+    }
+    free(name);
+    qsort(ranges,(size_t)count,sizeof(Dwarf_Ranges),
+        range_compare);
+    {
+        /*  Join ranges that touch, from rows
+            differing only in is_stmt or from
+            several matching files. */
+        Dwarf_Unsigned i = 0;
+        Dwarf_Unsigned o = 0;
+
+        for (i = 1; i < count; ++i) {
+            if (ranges[i].dwr_addr1 <= ranges[o].dwr_addr2) {
+                if (ranges[i].dwr_addr2 > ranges[o].dwr_addr2) {
+                    ranges[o].dwr_addr2 = ranges[i].dwr_addr2;
+                }
+                continue;
+            }
+            ++o;
+            ranges[o] = ranges[i];
+        }
+        count = o+1;
+    }
+    *ranges_out = ranges;
+    *range_count_out = (Dwarf_Signed)count;
+    return DW_DLV_OK;
+}
@@ -0,0 +1,73 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it
+  and/or modify it under the terms of version 2.1 of the
+  GNU Lesser General Public License as published by the Free
+  Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General
+  Public License along with this program; if not, write the
+  Free Software Foundation, Inc., 51 Franklin Street - Fifth
+  Floor, Boston MA 02110-1301, USA.
+
+*/
+
+
+#ifndef DWARF_LINE_INDEX_H
+#define DWARF_LINE_INDEX_H
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*  A source file, by canonical path, shared by all
+    CUs naming it. In li_file_tree keyed by lf_path. */
+struct Dwarf_Line_Index_File_s {
+    char          *lf_path;
+    Dwarf_Unsigned lf_id;
+};
+
+/*  The addresses [le_low,le_high) come from line table
+    rows for le_file (an lf_id) and le_line. */
+struct Dwarf_Line_Index_Entry_s {
+    Dwarf_Unsigned le_file;
+    Dwarf_Unsigned le_line;
+    Dwarf_Addr     le_low;
+    Dwarf_Addr     le_high;
+    Dwarf_Bool     le_is_stmt;
+};
+
+/*  The reverse line index of a Dwarf_Debug, built
+    from every CU line table on the first
+    dwarf_addr_ranges_for_source_line() call. */
+struct Dwarf_Line_Index_s {
+    void          *li_file_tree;
+    /*  Indexed by lf_id. */
+    struct Dwarf_Line_Index_File_s **li_files;
+    Dwarf_Unsigned li_file_count;
+    Dwarf_Unsigned li_file_alloc;
+    /*  Sorted by file, line and address. */
+    struct Dwarf_Line_Index_Entry_s *li_entries;
+    Dwarf_Unsigned li_entry_count;
+    Dwarf_Unsigned li_entry_alloc;
+};
+
+void _dwarf_destroy_line_index(Dwarf_Debug dbg);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* DWARF_LINE_INDEX_H */
@@ -1288,6 +1288,8 @@ _dwarf_read_line_table_header(Dwarf_Debug dbg,
         lp_begin = line_ptr;
     }
     line_context->lc_line_ptr_start = lp_begin;
+    line_context->lc_file_entry_header_count =
+        line_context->lc_file_entry_count;
     if (line_context->lc_actuals_table_offset) {
         /* This means two tables. */
         line_context->lc_table_count = 2;
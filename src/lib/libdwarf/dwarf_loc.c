@@ -757,6 +757,13 @@ _dwarf_fill_in_locdesc_op_c(Dwarf_Debug dbg,
     }
     locdesc->ld_cents = (Dwarf_Half)op_count;
     locdesc->ld_s = block_loc;
+    if (&locdesc->ld_opsblock != loc_block) {
+        /*  Keeps the expression bytes for
+            dwarf_expr_compile(). */
+        locdesc->ld_opsblock = *loc_block;
+    }
+    locdesc->ld_magic = LOCLISTS_MAGIC;
+    locdesc->ld_loclist_head = loc_head;
 
     locdesc->ld_kind = lkind;
     locdesc->ld_section_offset = loc_block->bl_section_offset;
@@ -1780,6 +1787,9 @@ dwarf_loclist_from_expr_c(Dwarf_Debug dbg,
     llhead->ll_context = 0; /* Not available! */
     llhead->ll_dbg = dbg;
     llhead->ll_kind = DW_LKIND_expression;
+    llhead->ll_address_size = address_size;
+    llhead->ll_offset_size = offset_size;
+    llhead->ll_cuversion = dwarf_version;
 
     /*  An empty location description (block length 0)
         means the code generator emitted no variable,
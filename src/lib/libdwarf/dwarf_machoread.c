@@ -851,6 +851,8 @@ _dwarf_macho_setup(int fd,
     unsigned offsetsize,
     Dwarf_Unsigned filesize,
     unsigned groupnumber,
+    const char **wanted_sections,
+    unsigned wanted_section_count,
     Dwarf_Handler errhand,
     Dwarf_Ptr errarg,
     Dwarf_Debug *dbg,Dwarf_Error *error)
@@ -878,8 +880,9 @@ _dwarf_macho_setup(int fd,
     }
     /*  allocates and initializes Dwarf_Debug,
         generic code */
-    res = dwarf_object_init_b(binary_interface, errhand, errarg,
-        groupnumber, dbg, error);
+    res = _dwarf_object_init_c(binary_interface, errhand, errarg,
+        groupnumber, wanted_sections,wanted_section_count,
+        dbg, error);
     if (res != DW_DLV_OK){
         _dwarf_destruct_macho_access(binary_interface);
         return res;
@@ -888,6 +891,9 @@ _dwarf_macho_setup(int fd,
     intfc->mo_path = strdup(true_path);
     (*dbg)->de_obj_flags = intfc->mo_flags;
     (*dbg)->de_obj_machine = intfc->mo_machine;
+    (*dbg)->de_obj_read_fd = intfc->mo_fd;
+    (*dbg)->de_obj_read_fd_valid = TRUE;
+    (*dbg)->de_obj_read_offset = intfc->mo_inner_offset;
     (*dbg)->de_universalbinary_index = universalnumber;
     (*dbg)->de_universalbinary_count = universalbinary_count;
     return res;
@@ -639,7 +639,7 @@ dwarf_get_macro_defundef(Dwarf_Macro_Context macro_context,
         *index = 0;
         *offset = supoffset;
         *forms_count = lformscount;
-        resup = _dwarf_get_string_from_tied(dbg, supoffset,
+        resup = _dwarf_get_string_from_sup(dbg, supoffset,
             &localstring, &lerr);
         if (resup != DW_DLV_OK) {
             if (resup == DW_DLV_ERROR) {
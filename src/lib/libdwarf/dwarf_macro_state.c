@@ -0,0 +1,1023 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it
+  and/or modify it under the terms of version 2.1 of the
+  GNU Lesser General Public License as published by the Free
+  Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General
+  Public License along with this program; if not, write the
+  Free Software Foundation, Inc., 51 Franklin Street - Fifth
+  Floor, Boston MA 02110-1301, USA.
+
+*/
+
+
+/*  The macros in effect at a point of a unit: what
+    FOO is defined to at bar.c line 200.
+    The macro program of a unit (.debug_macro, with
+    DW_MACRO_import followed, or .debug_macinfo) is
+    flattened into one op array and replayed once.
+    The replay keeps the current defines in a hash
+    table and every DW_MACRO_STATE_INTERVAL ops saves
+    them, sorted by name, as a checkpoint. A query
+    starts at the nearest checkpoint at or before
+    its position and replays at most
+    DW_MACRO_STATE_INTERVAL-1 ops from there. */
+
+#include <config.h>
+
+#include <stdlib.h> /* calloc() free() malloc() qsort() realloc() */
+#include <string.h> /* memcmp() memcpy() memmove() memset()
+    strlen() */
+
+#if defined(_WIN32) && defined(HAVE_STDAFX_H)
+#include "stdafx.h"
+#endif /* HAVE_STDAFX_H */
+
+#ifdef HAVE_STDINT_H
+#include <stdint.h> /* uintptr_t */
+#endif /* HAVE_STDINT_H */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "libdwarf_private.h"
+#include "dwarf_base_types.h"
+#include "dwarf_opaque.h"
+#include "dwarf_alloc.h"
+#include "dwarf_error.h"
+#include "dwarf_util.h"
+#include "dwarf_string.h"
+#include "dwarf_tsearch.h"
+#include "dwarf_macro_state.h"
+
+/*  Ops between checkpoints. */
+#define DW_MACRO_STATE_INTERVAL 512
+
+/*  Limits the nesting of DW_MACRO_import followed. */
+#define DW_MACRO_STATE_IMPORT_DEPTH_MAX 16
+
+static DW_TSHASHTYPE
+macro_state_hashfunc(const void *keyp)
+{
+    const struct Dwarf_Macro_State_s *ms = keyp;
+
+    return (DW_TSHASHTYPE)ms->ms_offset;
+}
+
+static int
+macro_state_compare(const void *l, const void *r)
+{
+    const struct Dwarf_Macro_State_s *lp = l;
+    const struct Dwarf_Macro_State_s *rp = r;
+
+    if (lp->ms_offset < rp->ms_offset) {
+        return -1;
+    }
+    if (lp->ms_offset > rp->ms_offset) {
+        return 1;
+    }
+    if (lp->ms_is_info < rp->ms_is_info) {
+        return -1;
+    }
+    if (lp->ms_is_info > rp->ms_is_info) {
+        return 1;
+    }
+    return 0;
+}
+
+static void
+macro_state_free_node(void *nodep)
+{
+    struct Dwarf_Macro_State_s *ms = nodep;
+    Dwarf_Unsigned i = 0;
+
+    for (i = 0; i < ms->ms_op_count; ++i) {
+        if (ms->ms_ops[i].so_kind == DW_MS_START) {
+            free((void *)ms->ms_ops[i].so_string);
+        }
+    }
+    if (ms->ms_details) {
+        dwarf_dealloc(ms->ms_dbg,ms->ms_details,DW_DLA_STRING);
+    }
+    free(ms->ms_ops);
+    free(ms->ms_checkpoints);
+    free(ms->ms_live);
+    free(ms);
+}
+
+void
+_dwarf_destroy_macro_states(Dwarf_Debug dbg)
+{
+    if (dbg->de_macro_state_tree) {
+        dwarf_tdestroy(dbg->de_macro_state_tree,
+            macro_state_free_node);
+        dbg->de_macro_state_tree = 0;
+    }
+}
+
+static int
+macro_state_alloc_error(Dwarf_Debug dbg, Dwarf_Error *error)
+{
+    _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+        "DW_DLE_ALLOC_FAIL: building a macro state");
+    return DW_DLV_ERROR;
+}
+
+/*  The name is what precedes the parameter list
+    or the space before the value. */
+static Dwarf_Unsigned
+macro_name_len(const char *s)
+{
+    const char *cp = s;
+
+    while (*cp && *cp != ' ' && *cp != '(') {
+        ++cp;
+    }
+    return (Dwarf_Unsigned)(cp - s);
+}
+
+static int
+name_compare(const char *l, Dwarf_Unsigned llen,
+    const char *r, Dwarf_Unsigned rlen)
+{
+    int c = memcmp(l,r,(size_t)(llen < rlen? llen:rlen));
+
+    if (c) {
+        return c;
+    }
+    if (llen < rlen) {
+        return -1;
+    }
+    if (llen > rlen) {
+        return 1;
+    }
+    return 0;
+}
+
+static int
+live_compare(const void *l, const void *r)
+{
+    const struct Dwarf_Macro_State_Op_s *lp =
+        *(struct Dwarf_Macro_State_Op_s * const *)l;
+    const struct Dwarf_Macro_State_Op_s *rp =
+        *(struct Dwarf_Macro_State_Op_s * const *)r;
+
+    return name_compare(lp->so_string,lp->so_name_len,
+        rp->so_string,rp->so_name_len);
+}
+
+static int
+add_op(Dwarf_Debug dbg,
+    struct Dwarf_Macro_State_s *ms,
+    Dwarf_Small kind,
+    Dwarf_Unsigned line,
+    const char *string,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Macro_State_Op_s *op = 0;
+
+    if (ms->ms_op_count == ms->ms_op_alloc) {
+        Dwarf_Unsigned newcount = ms->ms_op_alloc?
+            ms->ms_op_alloc*2:64;
+        struct Dwarf_Macro_State_Op_s *newops =
+            (struct Dwarf_Macro_State_Op_s *)realloc(ms->ms_ops,
+            (size_t)newcount*
+            sizeof(struct Dwarf_Macro_State_Op_s));
+
+        if (!newops) {
+            return macro_state_alloc_error(dbg,error);
+        }
+        ms->ms_ops = newops;
+        ms->ms_op_alloc = newcount;
+    }
+    op = ms->ms_ops + ms->ms_op_count;
+    memset(op,0,sizeof(*op));
+    op->so_kind = kind;
+    op->so_line = line;
+    op->so_string = string;
+    if (kind == DW_MS_DEFINE || kind == DW_MS_UNDEF) {
+        op->so_name_len = macro_name_len(string);
+    }
+    ms->ms_op_count++;
+    return DW_DLV_OK;
+}
+
+/*  Adds a start op with a copy of the file name,
+    the name strings of libdwarf going away with
+    their macro context or srcfiles list. */
+static int
+add_start_op(Dwarf_Debug dbg,
+    struct Dwarf_Macro_State_s *ms,
+    Dwarf_Unsigned line,
+    const char *name,
+    Dwarf_Error *error)
+{
+    char *copy = 0;
+    int res = 0;
+
+    if (name) {
+        size_t len = strlen(name);
+
+        copy = (char *)malloc(len+1);
+        if (!copy) {
+            return macro_state_alloc_error(dbg,error);
+        }
+        memcpy(copy,name,len+1);
+    }
+    res = add_op(dbg,ms,DW_MS_START,line,copy,error);
+    if (res != DW_DLV_OK) {
+        free(copy);
+    }
+    return res;
+}
+
+static int
+flatten_macro5(Dwarf_Debug dbg,
+    struct Dwarf_Macro_State_s *ms,
+    Dwarf_Die cu_die,
+    Dwarf_Macro_Context mc,
+    Dwarf_Unsigned op_count,
+    Dwarf_Unsigned *chain,
+    int depth,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned i = 0;
+    int res = DW_DLV_OK;
+
+    for (i = 0; i < op_count && res == DW_DLV_OK; ++i) {
+        Dwarf_Unsigned section_offset = 0;
+        Dwarf_Half     macro_operator = 0;
+        Dwarf_Half     forms_count = 0;
+        const Dwarf_Small *formcodes = 0;
+        Dwarf_Unsigned line = 0;
+        Dwarf_Unsigned index = 0;
+        Dwarf_Unsigned offset = 0;
+        const char    *string = 0;
+
+        res = dwarf_get_macro_op(mc,i,&section_offset,
+            &macro_operator,&forms_count,&formcodes,error);
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        switch (macro_operator) {
+        case DW_MACRO_define:
+        case DW_MACRO_define_strp:
+        case DW_MACRO_define_sup:
+        case DW_MACRO_define_strx:
+        case DW_MACRO_undef:
+        case DW_MACRO_undef_strp:
+        case DW_MACRO_undef_sup:
+        case DW_MACRO_undef_strx:
+            res = dwarf_get_macro_defundef(mc,i,&line,&index,
+                &offset,&forms_count,&string,error);
+            if (res == DW_DLV_OK) {
+                Dwarf_Bool define =
+                    macro_operator == DW_MACRO_define ||
+                    macro_operator == DW_MACRO_define_strp ||
+                    macro_operator == DW_MACRO_define_sup ||
+                    macro_operator == DW_MACRO_define_strx;
+
+                res = add_op(dbg,ms,
+                    define? DW_MS_DEFINE:DW_MS_UNDEF,
+                    line,string,error);
+            }
+            break;
+        case DW_MACRO_start_file:
+            res = dwarf_get_macro_startend_file(mc,i,&line,
+                &index,&string,error);
+            if (res == DW_DLV_OK) {
+                res = add_start_op(dbg,ms,line,string,error);
+            }
+            break;
+        case DW_MACRO_end_file:
+            res = add_op(dbg,ms,DW_MS_END,0,0,error);
+            break;
+        case DW_MACRO_import: {
+            Dwarf_Macro_Context imc = 0;
+            Dwarf_Unsigned version = 0;
+            Dwarf_Unsigned imp_count = 0;
+            Dwarf_Unsigned imp_len = 0;
+            int k = 0;
+
+            if (depth+1 >= DW_MACRO_STATE_IMPORT_DEPTH_MAX) {
+                break;
+            }
+            res = dwarf_get_macro_import(mc,i,&offset,error);
+            if (res != DW_DLV_OK) {
+                break;
+            }
+            /*  An import of a unit already being flattened
+                (as in an unrelocated object, where import
+                offsets are all zero) would never end. */
+            for (k = 0; k <= depth; ++k) {
+                if (chain[k] == offset) {
+                    break;
+                }
+            }
+            if (k <= depth) {
+                break;
+            }
+            chain[depth+1] = offset;
+            res = dwarf_get_macro_context_by_offset(cu_die,
+                offset,&version,&imc,&imp_count,&imp_len,error);
+            if (res == DW_DLV_OK) {
+                res = flatten_macro5(dbg,ms,cu_die,imc,imp_count,
+                    chain,depth+1,error);
+                dwarf_dealloc_macro_context(imc);
+            }
+            }
+            break;
+        default:
+            /*  DW_MACRO_import_sup, vendor ops and the
+                terminating zero change nothing here. */
+            break;
+        }
+    }
+    if (res == DW_DLV_NO_ENTRY) {
+        res = DW_DLV_OK;
+    }
+    return res;
+}
+
+static int
+macinfo_file_names(Dwarf_Debug dbg,
+    Dwarf_Die cu_die,
+    char ***names,
+    Dwarf_Signed *count)
+{
+    Dwarf_Error lerr = 0;
+    int res = 0;
+
+    res = dwarf_srcfiles(cu_die,names,count,&lerr);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(dbg,lerr);
+    }
+    if (res != DW_DLV_OK) {
+        *names = 0;
+        *count = 0;
+    }
+    return DW_DLV_OK;
+}
+
+static void
+free_file_names(Dwarf_Debug dbg,
+    char **names,
+    Dwarf_Signed count)
+{
+    Dwarf_Signed i = 0;
+
+    if (!names) {
+        return;
+    }
+    for (i = 0; i < count; ++i) {
+        dwarf_dealloc(dbg,names[i],DW_DLA_STRING);
+    }
+    dwarf_dealloc(dbg,names,DW_DLA_LIST);
+}
+
+static int
+flatten_macinfo(Dwarf_Debug dbg,
+    struct Dwarf_Macro_State_s *ms,
+    Dwarf_Die cu_die,
+    Dwarf_Error *error)
+{
+    Dwarf_Attribute attr = 0;
+    Dwarf_Off offset = 0;
+    Dwarf_Signed count = 0;
+    Dwarf_Signed i = 0;
+    char **names = 0;
+    Dwarf_Signed name_count = 0;
+    int res = 0;
+
+    res = dwarf_attr(cu_die,DW_AT_macro_info,&attr,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_global_formref(attr,&offset,error);
+    dwarf_dealloc_attribute(attr);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_get_macro_details(dbg,offset,0,&count,
+        &ms->ms_details,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    macinfo_file_names(dbg,cu_die,&names,&name_count);
+    for (i = 0; i < count && res == DW_DLV_OK; ++i) {
+        Dwarf_Macro_Details *d = ms->ms_details + i;
+
+        switch (d->dmd_type) {
+        case DW_MACINFO_define:
+        case DW_MACINFO_undef:
+            res = add_op(dbg,ms,
+                d->dmd_type == DW_MACINFO_define?
+                DW_MS_DEFINE:DW_MS_UNDEF,
+                (Dwarf_Unsigned)d->dmd_lineno,d->dmd_macro,error);
+            break;
+        case DW_MACINFO_start_file:
+            /*  DWARF2-4 file numbers start at one. */
+            res = add_start_op(dbg,ms,
+                (Dwarf_Unsigned)d->dmd_lineno,
+                (d->dmd_fileindex > 0 &&
+                d->dmd_fileindex <= name_count)?
+                names[d->dmd_fileindex-1]:0,error);
+            break;
+        case DW_MACINFO_end_file:
+            res = add_op(dbg,ms,DW_MS_END,0,0,error);
+            break;
+        default:
+            break;
+        }
+    }
+    free_file_names(dbg,names,name_count);
+    return res;
+}
+
+/*  Sets so_end of each start to the index of its
+    end, using so_end meanwhile as the link to the
+    enclosing open start. */
+static void
+match_files(struct Dwarf_Macro_State_s *ms)
+{
+    Dwarf_Unsigned count = ms->ms_op_count;
+    Dwarf_Unsigned open = count;
+    Dwarf_Unsigned i = 0;
+
+    for (i = 0; i < count; ++i) {
+        struct Dwarf_Macro_State_Op_s *op = ms->ms_ops + i;
+
+        if (op->so_kind == DW_MS_START) {
+            op->so_end = open;
+            open = i;
+        } else if (op->so_kind == DW_MS_END && open < count) {
+            Dwarf_Unsigned parent = ms->ms_ops[open].so_end;
+
+            ms->ms_ops[open].so_end = i;
+            open = parent;
+        }
+    }
+    while (open < count) {
+        Dwarf_Unsigned parent = ms->ms_ops[open].so_end;
+
+        ms->ms_ops[open].so_end = count;
+        open = parent;
+    }
+}
+
+/*  The current defines during the replay: open
+    addressing by name hash, at most half full. */
+struct live_table_s {
+    struct Dwarf_Macro_State_Op_s **lt_slots;
+    Dwarf_Unsigned lt_mask;
+    Dwarf_Unsigned lt_count;
+};
+
+static Dwarf_Unsigned
+name_hash(const char *s, Dwarf_Unsigned len)
+{
+    Dwarf_Unsigned h = 5381;
+    Dwarf_Unsigned i = 0;
+
+    for (i = 0; i < len; ++i) {
+        h = h*33 + (unsigned char)s[i];
+    }
+    return h;
+}
+
+/*  Returns the slot holding the name, or the
+    empty slot where it would go. */
+static Dwarf_Unsigned
+live_slot(struct live_table_s *lt,
+    struct Dwarf_Macro_State_Op_s *op)
+{
+    Dwarf_Unsigned s = name_hash(op->so_string,op->so_name_len) &
+        lt->lt_mask;
+
+    for (;;) {
+        struct Dwarf_Macro_State_Op_s *cur = lt->lt_slots[s];
+
+        if (!cur || !name_compare(cur->so_string,cur->so_name_len,
+            op->so_string,op->so_name_len)) {
+            return s;
+        }
+        s = (s + 1) & lt->lt_mask;
+    }
+}
+
+static void
+live_apply(struct live_table_s *lt,
+    struct Dwarf_Macro_State_Op_s *op)
+{
+    Dwarf_Unsigned s = live_slot(lt,op);
+    Dwarf_Unsigned j = 0;
+
+    if (op->so_kind == DW_MS_DEFINE) {
+        if (!lt->lt_slots[s]) {
+            lt->lt_count++;
+        }
+        lt->lt_slots[s] = op;
+        return;
+    }
+    if (!lt->lt_slots[s]) {
+        return;
+    }
+    /*  Undefine: remove, moving back any later entry
+        of the probe run that could no longer be
+        found past the hole. */
+    lt->lt_slots[s] = 0;
+    lt->lt_count--;
+    j = s;
+    for (;;) {
+        Dwarf_Unsigned home = 0;
+        struct Dwarf_Macro_State_Op_s *cur = 0;
+
+        j = (j + 1) & lt->lt_mask;
+        cur = lt->lt_slots[j];
+        if (!cur) {
+            return;
+        }
+        home = name_hash(cur->so_string,cur->so_name_len) &
+            lt->lt_mask;
+        /*  cur may stay at j unless its home lies
+            cyclically in (s,j]. */
+        if ((s < j)? (home <= s || home > j):
+            (home <= s && home > j)) {
+            lt->lt_slots[s] = cur;
+            lt->lt_slots[j] = 0;
+            s = j;
+        }
+    }
+}
+
+static int
+save_checkpoint(Dwarf_Debug dbg,
+    struct Dwarf_Macro_State_s *ms,
+    struct live_table_s *lt,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned first = ms->ms_live_count;
+    Dwarf_Unsigned i = 0;
+
+    if (ms->ms_live_count + lt->lt_count > ms->ms_live_alloc) {
+        Dwarf_Unsigned newcount = ms->ms_live_alloc*2;
+        struct Dwarf_Macro_State_Op_s **newlive = 0;
+
+        if (newcount < ms->ms_live_count + lt->lt_count) {
+            newcount = ms->ms_live_count + lt->lt_count;
+        }
+        newlive = (struct Dwarf_Macro_State_Op_s **)realloc(
+            ms->ms_live,(size_t)(newcount? newcount:1)*
+            sizeof(struct Dwarf_Macro_State_Op_s *));
+        if (!newlive) {
+            return macro_state_alloc_error(dbg,error);
+        }
+        ms->ms_live = newlive;
+        ms->ms_live_alloc = newcount;
+    }
+    for (i = 0; i <= lt->lt_mask; ++i) {
+        if (lt->lt_slots[i]) {
+            ms->ms_live[ms->ms_live_count++] = lt->lt_slots[i];
+        }
+    }
+    if (ms->ms_live_count - first > 1) {
+        qsort(ms->ms_live + first,
+            (size_t)(ms->ms_live_count - first),
+            sizeof(struct Dwarf_Macro_State_Op_s *),live_compare);
+    }
+    ms->ms_checkpoints[ms->ms_checkpoint_count++] = first;
+    return DW_DLV_OK;
+}
+
+static int
+build_checkpoints(Dwarf_Debug dbg,
+    struct Dwarf_Macro_State_s *ms,
+    Dwarf_Error *error)
+{
+    struct live_table_s lt;
+    Dwarf_Unsigned defines = 0;
+    Dwarf_Unsigned size = 16;
+    Dwarf_Unsigned i = 0;
+    int res = DW_DLV_OK;
+
+    for (i = 0; i < ms->ms_op_count; ++i) {
+        if (ms->ms_ops[i].so_kind == DW_MS_DEFINE) {
+            ++defines;
+        }
+    }
+    while (size < 2*defines) {
+        size *= 2;
+    }
+    memset(&lt,0,sizeof(lt));
+    lt.lt_slots = (struct Dwarf_Macro_State_Op_s **)calloc(
+        (size_t)size,sizeof(struct Dwarf_Macro_State_Op_s *));
+    /*  One more entry than checkpoints, for the end
+        of the last one. */
+    ms->ms_checkpoints = (Dwarf_Unsigned *)malloc(
+        (size_t)(ms->ms_op_count/DW_MACRO_STATE_INTERVAL + 2)*
+        sizeof(Dwarf_Unsigned));
+    if (!lt.lt_slots || !ms->ms_checkpoints) {
+        free(lt.lt_slots);
+        return macro_state_alloc_error(dbg,error);
+    }
+    lt.lt_mask = size - 1;
+    for (i = 0; i <= ms->ms_op_count; ++i) {
+        struct Dwarf_Macro_State_Op_s *op = ms->ms_ops + i;
+
+        if (!(i % DW_MACRO_STATE_INTERVAL)) {
+            res = save_checkpoint(dbg,ms,&lt,error);
+            if (res != DW_DLV_OK) {
+                break;
+            }
+        }
+        if (i < ms->ms_op_count && (op->so_kind == DW_MS_DEFINE ||
+            op->so_kind == DW_MS_UNDEF)) {
+            live_apply(&lt,op);
+        }
+    }
+    free(lt.lt_slots);
+    if (res == DW_DLV_OK) {
+        ms->ms_checkpoints[ms->ms_checkpoint_count] =
+            ms->ms_live_count;
+    }
+    return res;
+}
+
+static int
+build_macro_state(Dwarf_Debug dbg,
+    Dwarf_Die cu_die,
+    struct Dwarf_Macro_State_s *ms,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned version = 0;
+    Dwarf_Macro_Context mc = 0;
+    Dwarf_Unsigned unit_offset = 0;
+    Dwarf_Unsigned op_count = 0;
+    Dwarf_Unsigned length = 0;
+    Dwarf_Unsigned chain[DW_MACRO_STATE_IMPORT_DEPTH_MAX];
+    int res = 0;
+
+    res = dwarf_get_macro_context(cu_die,&version,&mc,
+        &unit_offset,&op_count,&length,error);
+    if (res == DW_DLV_OK) {
+        chain[0] = unit_offset;
+        res = flatten_macro5(dbg,ms,cu_die,mc,op_count,
+            chain,0,error);
+        dwarf_dealloc_macro_context(mc);
+    } else if (res == DW_DLV_NO_ENTRY) {
+        res = flatten_macinfo(dbg,ms,cu_die,error);
+    }
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    match_files(ms);
+    return build_checkpoints(dbg,ms,error);
+}
+
+int
+dwarf_macro_state(Dwarf_Die die,
+    Dwarf_Macro_State *state_out,
+    Dwarf_Unsigned    *op_count,
+    Dwarf_Error       *error)
+{
+    Dwarf_Debug dbg = 0;
+    struct Dwarf_Macro_State_s key;
+    struct Dwarf_Macro_State_s *ms = 0;
+    Dwarf_Die cu_die = 0;
+    void *found = 0;
+    int res = 0;
+
+    CHECK_DIE(die, DW_DLV_ERROR);
+    dbg = die->di_cu_context->cc_dbg;
+    if (!state_out) {
+        _dwarf_error_string(dbg,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_macro_state() passed a NULL state_out");
+        return DW_DLV_ERROR;
+    }
+    memset(&key,0,sizeof(key));
+    res = dwarf_CU_dieoffset_given_die(die,&key.ms_offset,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    key.ms_is_info = die->di_is_info;
+    if (!dbg->de_macro_state_tree) {
+        dwarf_initialize_search_hash(&dbg->de_macro_state_tree,
+            macro_state_hashfunc,0);
+    }
+    found = dwarf_tfind(&key,&dbg->de_macro_state_tree,
+        macro_state_compare);
+    if (found) {
+        ms = *(struct Dwarf_Macro_State_s **)found;
+    } else {
+        ms = (struct Dwarf_Macro_State_s *)calloc(1,
+            sizeof(struct Dwarf_Macro_State_s));
+        if (!ms) {
+            return macro_state_alloc_error(dbg,error);
+        }
+        ms->ms_offset = key.ms_offset;
+        ms->ms_is_info = key.ms_is_info;
+        ms->ms_dbg = dbg;
+        res = dwarf_offdie_b(dbg,ms->ms_offset,ms->ms_is_info,
+            &cu_die,error);
+        if (res == DW_DLV_OK) {
+            res = build_macro_state(dbg,cu_die,ms,error);
+            dwarf_dealloc_die(cu_die);
+        }
+        if (res != DW_DLV_OK) {
+            macro_state_free_node(ms);
+            return res;
+        }
+        found = dwarf_tsearch(ms,&dbg->de_macro_state_tree,
+            macro_state_compare);
+        if (!found) {
+            macro_state_free_node(ms);
+            return macro_state_alloc_error(dbg,error);
+        }
+    }
+    if (!ms->ms_op_count) {
+        return DW_DLV_NO_ENTRY;
+    }
+    *state_out = ms;
+    if (op_count) {
+        *op_count = ms->ms_op_count;
+    }
+    return DW_DLV_OK;
+}
+
+static Dwarf_Bool
+file_matches(const char *have, const char *want)
+{
+    size_t hlen = 0;
+    size_t wlen = 0;
+
+    if (!have) {
+        return FALSE;
+    }
+    hlen = strlen(have);
+    wlen = strlen(want);
+    if (hlen == wlen) {
+        return !strcmp(have,want);
+    }
+    return hlen > wlen && have[hlen-wlen-1] == '/' &&
+        !strcmp(have+hlen-wlen,want);
+}
+
+int
+dwarf_macro_state_position(Dwarf_Macro_State ms,
+    const char     *file,
+    Dwarf_Unsigned  line,
+    Dwarf_Unsigned *position,
+    Dwarf_Error    *error)
+{
+    Dwarf_Unsigned start = 0;
+    Dwarf_Unsigned end = 0;
+    Dwarf_Unsigned i = 0;
+
+    if (!ms || !position) {
+        _dwarf_error_string(ms?ms->ms_dbg:0,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_macro_state_position() passed a NULL pointer");
+        return DW_DLV_ERROR;
+    }
+    if (!file) {
+        *position = ms->ms_op_count;
+        return DW_DLV_OK;
+    }
+    for (start = 0; start < ms->ms_op_count; ++start) {
+        struct Dwarf_Macro_State_Op_s *op = ms->ms_ops + start;
+
+        if (op->so_kind == DW_MS_START &&
+            file_matches(op->so_string,file)) {
+            break;
+        }
+    }
+    if (start == ms->ms_op_count) {
+        return DW_DLV_NO_ENTRY;
+    }
+    /*  Walk the ops of the file itself, stepping over
+        the files it includes, to the first one at or
+        after the line. */
+    end = ms->ms_ops[start].so_end;
+    i = start + 1;
+    while (i < end) {
+        struct Dwarf_Macro_State_Op_s *op = ms->ms_ops + i;
+
+        if (op->so_line >= line && op->so_kind != DW_MS_END) {
+            break;
+        }
+        if (op->so_kind == DW_MS_START) {
+            if (op->so_end >= end) {
+                i = end;
+                break;
+            }
+            i = op->so_end;
+        }
+        ++i;
+    }
+    *position = i;
+    return DW_DLV_OK;
+}
+
+static int
+check_position(struct Dwarf_Macro_State_s *ms,
+    Dwarf_Unsigned position,
+    const char *function,
+    Dwarf_Error *error)
+{
+    if (position > ms->ms_op_count) {
+        dwarfstring m;
+
+        dwarfstring_constructor(&m);
+        dwarfstring_append_printf_s(&m,
+            "DW_DLE_BAD_MACRO_INDEX: %s ",(char *)function);
+        dwarfstring_append_printf_u(&m,
+            "passed position %u, ",position);
+        dwarfstring_append_printf_u(&m,
+            "past the last op %u",ms->ms_op_count);
+        _dwarf_error_string(ms->ms_dbg,error,
+            DW_DLE_BAD_MACRO_INDEX,dwarfstring_string(&m));
+        dwarfstring_destructor(&m);
+        return DW_DLV_ERROR;
+    }
+    return DW_DLV_OK;
+}
+
+/*  Binary search of a sorted run of defines.
+    Returns the index of the name or, if not
+    present, where it would be inserted, setting
+    *found accordingly. */
+static Dwarf_Unsigned
+live_find(struct Dwarf_Macro_State_Op_s **live,
+    Dwarf_Unsigned count,
+    const char *name,
+    Dwarf_Unsigned name_len,
+    Dwarf_Bool *found)
+{
+    Dwarf_Unsigned low = 0;
+    Dwarf_Unsigned high = count;
+
+    while (low < high) {
+        Dwarf_Unsigned middle = low + (high - low)/2;
+        struct Dwarf_Macro_State_Op_s *op = live[middle];
+        int c = name_compare(op->so_string,op->so_name_len,
+            name,name_len);
+
+        if (!c) {
+            *found = TRUE;
+            return middle;
+        }
+        if (c < 0) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    *found = FALSE;
+    return low;
+}
+
+int
+dwarf_macro_state_lookup(Dwarf_Macro_State ms,
+    Dwarf_Unsigned  position,
+    const char     *name,
+    const char    **definition,
+    Dwarf_Unsigned *line,
+    Dwarf_Error    *error)
+{
+    Dwarf_Unsigned k = 0;
+    Dwarf_Unsigned first = 0;
+    Dwarf_Unsigned name_len = 0;
+    Dwarf_Unsigned i = 0;
+    Dwarf_Bool found = FALSE;
+    struct Dwarf_Macro_State_Op_s *cur = 0;
+    int res = 0;
+
+    if (!ms || !name || !definition) {
+        _dwarf_error_string(ms?ms->ms_dbg:0,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_macro_state_lookup() passed a NULL pointer");
+        return DW_DLV_ERROR;
+    }
+    res = check_position(ms,position,
+        "dwarf_macro_state_lookup()",error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    name_len = macro_name_len(name);
+    k = position / DW_MACRO_STATE_INTERVAL;
+    first = ms->ms_checkpoints[k];
+    i = live_find(ms->ms_live + first,
+        ms->ms_checkpoints[k+1] - first,name,name_len,&found);
+    if (found) {
+        cur = ms->ms_live[first + i];
+    }
+    for (i = k*DW_MACRO_STATE_INTERVAL; i < position; ++i) {
+        struct Dwarf_Macro_State_Op_s *op = ms->ms_ops + i;
+
+        if ((op->so_kind == DW_MS_DEFINE ||
+            op->so_kind == DW_MS_UNDEF) &&
+            !name_compare(op->so_string,op->so_name_len,
+            name,name_len)) {
+            cur = (op->so_kind == DW_MS_DEFINE)? op:0;
+        }
+    }
+    if (!cur) {
+        return DW_DLV_NO_ENTRY;
+    }
+    *definition = cur->so_string;
+    if (line) {
+        *line = cur->so_line;
+    }
+    return DW_DLV_OK;
+}
+
+int
+dwarf_macro_state_defines(Dwarf_Macro_State ms,
+    Dwarf_Unsigned  position,
+    Dwarf_Unsigned  array_size,
+    const char    **definitions,
+    Dwarf_Unsigned *define_count,
+    Dwarf_Error    *error)
+{
+    struct Dwarf_Macro_State_Op_s **live = 0;
+    Dwarf_Unsigned k = 0;
+    Dwarf_Unsigned first = 0;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Unsigned i = 0;
+    int res = 0;
+
+    if (!ms || !define_count || (array_size && !definitions)) {
+        _dwarf_error_string(ms?ms->ms_dbg:0,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_macro_state_defines() passed a NULL pointer");
+        return DW_DLV_ERROR;
+    }
+    res = check_position(ms,position,
+        "dwarf_macro_state_defines()",error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    k = position / DW_MACRO_STATE_INTERVAL;
+    first = ms->ms_checkpoints[k];
+    count = ms->ms_checkpoints[k+1] - first;
+    live = (struct Dwarf_Macro_State_Op_s **)malloc(
+        (size_t)(count + DW_MACRO_STATE_INTERVAL)*
+        sizeof(struct Dwarf_Macro_State_Op_s *));
+    if (!live) {
+        return macro_state_alloc_error(ms->ms_dbg,error);
+    }
+    if (count) {
+        memcpy(live,ms->ms_live + first,
+            (size_t)count*sizeof(struct Dwarf_Macro_State_Op_s *));
+    }
+    for (i = k*DW_MACRO_STATE_INTERVAL; i < position; ++i) {
+        struct Dwarf_Macro_State_Op_s *op = ms->ms_ops + i;
+        Dwarf_Bool found = FALSE;
+        Dwarf_Unsigned at = 0;
+
+        if (op->so_kind != DW_MS_DEFINE &&
+            op->so_kind != DW_MS_UNDEF) {
+            continue;
+        }
+        at = live_find(live,count,op->so_string,
+            op->so_name_len,&found);
+        if (op->so_kind == DW_MS_DEFINE) {
+            if (!found) {
+                memmove(live+at+1,live+at,(size_t)(count-at)*
+                    sizeof(struct Dwarf_Macro_State_Op_s *));
+                ++count;
+            }
+            live[at] = op;
+        } else if (found) {
+            memmove(live+at,live+at+1,(size_t)(count-at-1)*
+                sizeof(struct Dwarf_Macro_State_Op_s *));
+            --count;
+        }
+    }
+    for (i = 0; i < count && i < array_size; ++i) {
+        definitions[i] = live[i]->so_string;
+    }
+    free(live);
+    *define_count = count;
+    return count? DW_DLV_OK:DW_DLV_NO_ENTRY;
+}
@@ -0,0 +1,88 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it
+  and/or modify it under the terms of version 2.1 of the
+  GNU Lesser General Public License as published by the Free
+  Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General
+  Public License along with this program; if not, write the
+  Free Software Foundation, Inc., 51 Franklin Street - Fifth
+  Floor, Boston MA 02110-1301, USA.
+
+*/
+
+
+#ifndef DWARF_MACRO_STATE_H
+#define DWARF_MACRO_STATE_H
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*  The so_kind values. */
+#define DW_MS_DEFINE 1
+#define DW_MS_UNDEF  2
+#define DW_MS_START  3
+#define DW_MS_END    4
+
+/*  One operation of the macro program of a unit,
+    with DW_MACRO_import flattened in place.
+    so_string is the "NAME value" of a define or undef
+    (in section data) or the file name of a start
+    (malloc()ed here, NULL if not known). */
+struct Dwarf_Macro_State_Op_s {
+    const char    *so_string;
+    Dwarf_Unsigned so_line;
+    /*  For a start: the index of the matching end,
+        or the op count if there is none. */
+    Dwarf_Unsigned so_end;
+    /*  The length of the macro name in so_string. */
+    Dwarf_Unsigned so_name_len;
+    Dwarf_Small    so_kind;
+};
+
+/*  The memo of dwarf_macro_state(), one per unit,
+    in dbg->de_macro_state_tree.
+    The key is ms_offset (of the unit DIE)
+    and ms_is_info. */
+struct Dwarf_Macro_State_s {
+    Dwarf_Off      ms_offset;
+    Dwarf_Bool     ms_is_info;
+    Dwarf_Debug    ms_dbg;
+    struct Dwarf_Macro_State_Op_s *ms_ops;
+    Dwarf_Unsigned ms_op_count;
+    Dwarf_Unsigned ms_op_alloc;
+    /*  Checkpoint k is the defines in effect before
+        op k*DW_MACRO_STATE_INTERVAL, sorted by name:
+        ms_live[ms_checkpoints[k]] up to
+        ms_live[ms_checkpoints[k+1]]. */
+    Dwarf_Unsigned *ms_checkpoints;
+    Dwarf_Unsigned ms_checkpoint_count;
+    struct Dwarf_Macro_State_Op_s **ms_live;
+    Dwarf_Unsigned ms_live_count;
+    Dwarf_Unsigned ms_live_alloc;
+    /*  For .debug_macinfo, the details holding
+        the define strings. */
+    Dwarf_Macro_Details *ms_details;
+};
+
+void _dwarf_destroy_macro_states(Dwarf_Debug dbg);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* DWARF_MACRO_STATE_H */
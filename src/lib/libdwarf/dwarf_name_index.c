@@ -0,0 +1,559 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it
+  and/or modify it under the terms of version 2.1 of the
+  GNU Lesser General Public License as published by the Free
+  Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General
+  Public License along with this program; if not, write the
+  Free Software Foundation, Inc., 51 Franklin Street - Fifth
+  Floor, Boston MA 02110-1301, USA.
+
+*/
+
+/*  A name lookup built from the DIEs themselves, for
+    objects without .debug_names or .gdb_index: the
+    functions, variables, types and namespaces of every
+    unit with their DIE offset, tag and enclosing scope.
+    Built once per Dwarf_Debug, on first use. Function
+    bodies are not entered, so local variables and
+    types are not indexed. */
+
+#include <config.h>
+
+#include <stdlib.h> /* calloc() free() qsort() realloc() */
+#include <string.h> /* strcmp() */
+
+#if defined(_WIN32) && defined(HAVE_STDAFX_H)
+#include "stdafx.h"
+#endif /* HAVE_STDAFX_H */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "libdwarf_private.h"
+#include "dwarf_base_types.h"
+#include "dwarf_opaque.h"
+#include "dwarf_alloc.h"
+#include "dwarf_error.h"
+#include "dwarf_util.h"
+#include "dwarf_name_index.h"
+
+/*  Limits the nesting of namespaces and classes
+    followed. */
+#define DW_NAME_INDEX_DEPTH_MAX 64
+
+static void
+free_name_index(struct Dwarf_Name_Index_s *ni)
+{
+    free(ni->ni_entries);
+    free(ni);
+}
+
+void
+_dwarf_destroy_name_index(Dwarf_Debug dbg)
+{
+    if (dbg->de_name_index) {
+        free_name_index(dbg->de_name_index);
+        dbg->de_name_index = 0;
+    }
+}
+
+/*  The .debug_names hash (DWARF5 section 7.33), the
+    Bernstein hash of the name with ASCII letters
+    folded to lower case. */
+Dwarf_Unsigned
+_dwarf_name_hash(const char *name)
+{
+    const unsigned char *cp = (const unsigned char *)name;
+    Dwarf_Unsigned h = 5381;
+
+    for ( ; *cp; ++cp) {
+        unsigned c = *cp;
+
+        if (c >= 'A' && c <= 'Z') {
+            c = c - 'A' + 'a';
+        }
+        h = (h * 33 + c) & 0xffffffff;
+    }
+    return h;
+}
+
+static int
+entry_compare(const void *l, const void *r)
+{
+    const struct Dwarf_Name_Entry_s *lp = l;
+    const struct Dwarf_Name_Entry_s *rp = r;
+    int c = 0;
+
+    if (lp->ne_hash < rp->ne_hash) {
+        return -1;
+    }
+    if (lp->ne_hash > rp->ne_hash) {
+        return 1;
+    }
+    c = strcmp(lp->ne_name,rp->ne_name);
+    if (c) {
+        return c;
+    }
+    if (lp->ne_is_info != rp->ne_is_info) {
+        return lp->ne_is_info? -1:1;
+    }
+    if (lp->ne_die_offset < rp->ne_die_offset) {
+        return -1;
+    }
+    if (lp->ne_die_offset > rp->ne_die_offset) {
+        return 1;
+    }
+    return 0;
+}
+
+static int
+add_name(Dwarf_Debug dbg,
+    struct Dwarf_Name_Index_s *ni,
+    const char *name,
+    Dwarf_Half tag,
+    Dwarf_Off die_offset,
+    Dwarf_Off parent_offset,
+    Dwarf_Off cu_die_offset,
+    Dwarf_Bool is_info,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Name_Entry_s *e = 0;
+
+    if (!name || !name[0]) {
+        return DW_DLV_OK;
+    }
+    if (ni->ni_entry_count >= ni->ni_entry_alloc) {
+        Dwarf_Unsigned newalloc = ni->ni_entry_alloc?
+            ni->ni_entry_alloc*2:256;
+        struct Dwarf_Name_Entry_s *newe =
+            (struct Dwarf_Name_Entry_s *)realloc(ni->ni_entries,
+            newalloc*sizeof(struct Dwarf_Name_Entry_s));
+
+        if (!newe) {
+            _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+                "DW_DLE_ALLOC_FAIL: building the name index");
+            return DW_DLV_ERROR;
+        }
+        ni->ni_entries = newe;
+        ni->ni_entry_alloc = newalloc;
+    }
+    e = ni->ni_entries + ni->ni_entry_count;
+    e->ne_name = name;
+    e->ne_hash = _dwarf_name_hash(name);
+    e->ne_die_offset = die_offset;
+    e->ne_parent_offset = parent_offset;
+    e->ne_cu_die_offset = cu_die_offset;
+    e->ne_tag = tag;
+    e->ne_is_info = is_info;
+    ++ni->ni_entry_count;
+    return DW_DLV_OK;
+}
+
+static Dwarf_Bool
+is_indexed_tag(Dwarf_Half tag)
+{
+    switch (tag) {
+    case DW_TAG_subprogram:
+    case DW_TAG_variable:
+    case DW_TAG_constant:
+    case DW_TAG_namespace:
+    case DW_TAG_module:
+    case DW_TAG_base_type:
+    case DW_TAG_class_type:
+    case DW_TAG_structure_type:
+    case DW_TAG_union_type:
+    case DW_TAG_interface_type:
+    case DW_TAG_enumeration_type:
+    case DW_TAG_typedef:
+    case DW_TAG_unspecified_type:
+        return TRUE;
+    default:
+        break;
+    }
+    return FALSE;
+}
+
+/*  DIEs whose children may be indexed names. */
+static Dwarf_Bool
+is_scope_tag(Dwarf_Half tag)
+{
+    switch (tag) {
+    case DW_TAG_namespace:
+    case DW_TAG_module:
+    case DW_TAG_class_type:
+    case DW_TAG_structure_type:
+    case DW_TAG_union_type:
+    case DW_TAG_interface_type:
+        return TRUE;
+    default:
+        break;
+    }
+    return FALSE;
+}
+
+static int
+is_declaration(Dwarf_Die die,
+    Dwarf_Bool *decl_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Attribute attr = 0;
+    Dwarf_Bool flag = FALSE;
+    int res = 0;
+
+    *decl_out = FALSE;
+    res = dwarf_attr(die,DW_AT_declaration,&attr,error);
+    if (res == DW_DLV_NO_ENTRY) {
+        return DW_DLV_OK;
+    }
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_formflag(attr,&flag,error);
+    dwarf_dealloc_attribute(attr);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    *decl_out = flag;
+    return DW_DLV_OK;
+}
+
+/*  Indexes DW_AT_name and, for functions and
+    variables, a different linkage name. An
+    out-of-line definition usually has neither
+    and gets them from its declaration
+    (or abstract instance). */
+static int
+index_die(Dwarf_Debug dbg,
+    struct Dwarf_Name_Index_s *ni,
+    Dwarf_Die die,
+    Dwarf_Half tag,
+    Dwarf_Off die_offset,
+    Dwarf_Off parent_offset,
+    Dwarf_Off cu_die_offset,
+    Dwarf_Error *error)
+{
+    const char *name = 0;
+    const char *linkage_name = 0;
+    char *str = 0;
+    Dwarf_Bool has_linkage = tag == DW_TAG_subprogram ||
+        tag == DW_TAG_variable || tag == DW_TAG_constant;
+    int res = 0;
+
+    res = dwarf_diename(die,&str,error);
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    if (res == DW_DLV_OK) {
+        name = str;
+        if (has_linkage) {
+            res = dwarf_die_text(die,DW_AT_linkage_name,
+                &str,error);
+            if (res == DW_DLV_NO_ENTRY) {
+                res = dwarf_die_text(die,DW_AT_MIPS_linkage_name,
+                    &str,error);
+            }
+            if (res == DW_DLV_ERROR) {
+                return res;
+            }
+            if (res == DW_DLV_OK) {
+                linkage_name = str;
+            }
+        }
+    } else if (has_linkage) {
+        res = dwarf_die_resolved_names(die,&name,
+            &linkage_name,0,0,0,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+    }
+    res = add_name(dbg,ni,name,tag,die_offset,parent_offset,
+        cu_die_offset,die->di_is_info,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (linkage_name && (!name || strcmp(name,linkage_name))) {
+        res = add_name(dbg,ni,linkage_name,tag,die_offset,
+            parent_offset,cu_die_offset,die->di_is_info,error);
+    }
+    return res;
+}
+
+static int
+index_children(Dwarf_Debug dbg,
+    struct Dwarf_Name_Index_s *ni,
+    Dwarf_Die parent,
+    Dwarf_Off parent_offset,
+    Dwarf_Off cu_die_offset,
+    int depth,
+    Dwarf_Error *error)
+{
+    Dwarf_Die child = 0;
+    int res = 0;
+
+    res = dwarf_child(parent,&child,error);
+    while (res == DW_DLV_OK) {
+        Dwarf_Die sibling = 0;
+        Dwarf_Half tag = 0;
+        Dwarf_Off offset = 0;
+        Dwarf_Bool declaration = FALSE;
+
+        res = dwarf_tag(child,&tag,error);
+        if (res == DW_DLV_OK && is_indexed_tag(tag)) {
+            res = dwarf_dieoffset(child,&offset,error);
+            if (res == DW_DLV_OK) {
+                res = is_declaration(child,&declaration,error);
+            }
+            if (res == DW_DLV_OK && !declaration) {
+                res = index_die(dbg,ni,child,tag,offset,
+                    parent_offset,cu_die_offset,error);
+            }
+            if (res == DW_DLV_OK && !declaration &&
+                is_scope_tag(tag) &&
+                depth < DW_NAME_INDEX_DEPTH_MAX) {
+                res = index_children(dbg,ni,child,offset,
+                    cu_die_offset,depth+1,error);
+            }
+        }
+        if (res != DW_DLV_OK) {
+            dwarf_dealloc_die(child);
+            return res;
+        }
+        res = dwarf_siblingof_c(child,&sibling,error);
+        dwarf_dealloc_die(child);
+        child = sibling;
+    }
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    return DW_DLV_OK;
+}
+
+/*  Indexes every unit of .debug_info or .debug_types,
+    walking the units by offset so the caller's
+    dwarf_next_cu_header_e() position is untouched. */
+static int
+index_section(Dwarf_Debug dbg,
+    struct Dwarf_Name_Index_s *ni,
+    Dwarf_Bool is_info,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned offset = 0;
+    Dwarf_Unsigned section_size = 0;
+    int res = 0;
+
+    if (is_info) {
+        res = _dwarf_load_debug_info(dbg,error);
+        section_size = dbg->de_debug_info.dss_size;
+    } else {
+        res = _dwarf_load_debug_types(dbg,error);
+        section_size = dbg->de_debug_types.dss_size;
+    }
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    while (offset < section_size) {
+        Dwarf_Off cu_die_offset = 0;
+        Dwarf_Die cu_die = 0;
+        Dwarf_Unsigned next = 0;
+
+        res = dwarf_get_cu_die_offset_given_cu_header_offset_b(
+            dbg,offset,is_info,&cu_die_offset,error);
+        if (res == DW_DLV_OK) {
+            res = dwarf_offdie_b(dbg,cu_die_offset,is_info,
+                &cu_die,error);
+        }
+        if (res == DW_DLV_NO_ENTRY) {
+            break;
+        }
+        if (res == DW_DLV_OK) {
+            next = _dwarf_calculate_next_cu_context_offset(
+                cu_die->di_cu_context);
+            res = index_children(dbg,ni,cu_die,0,
+                cu_die_offset,0,error);
+            dwarf_dealloc_die(cu_die);
+        }
+        if (res == DW_DLV_ERROR) {
+            return res;
+        }
+        if (next <= offset) {
+            break;
+        }
+        offset = next;
+    }
+    return DW_DLV_OK;
+}
+
+static int
+build_name_index(Dwarf_Debug dbg,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Name_Index_s *ni = 0;
+    int res = 0;
+
+    ni = (struct Dwarf_Name_Index_s *)calloc(1,
+        sizeof(struct Dwarf_Name_Index_s));
+    if (!ni) {
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: allocating the name index");
+        return DW_DLV_ERROR;
+    }
+    ni->ni_dbg = dbg;
+    res = index_section(dbg,ni,TRUE,error);
+    if (res == DW_DLV_OK && dbg->de_debug_types.dss_size) {
+        res = index_section(dbg,ni,FALSE,error);
+    }
+    if (res == DW_DLV_ERROR) {
+        free_name_index(ni);
+        return res;
+    }
+    if (ni->ni_entry_count) {
+        qsort(ni->ni_entries,(size_t)ni->ni_entry_count,
+            sizeof(struct Dwarf_Name_Entry_s),entry_compare);
+    }
+    dbg->de_name_index = ni;
+    return DW_DLV_OK;
+}
+
+int
+dwarf_name_index(Dwarf_Debug dbg,
+    Dwarf_Name_Index *index_out,
+    Dwarf_Unsigned   *entry_count_out,
+    Dwarf_Error      *error)
+{
+    int res = 0;
+
+    CHECK_DBG(dbg,error,"dwarf_name_index()");
+    if (!index_out) {
+        _dwarf_error_string(dbg,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_name_index() passed a NULL index_out");
+        return DW_DLV_ERROR;
+    }
+    if (!dbg->de_name_index) {
+        res = build_name_index(dbg,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+    }
+    if (!dbg->de_name_index->ni_entry_count) {
+        return DW_DLV_NO_ENTRY;
+    }
+    *index_out = dbg->de_name_index;
+    if (entry_count_out) {
+        *entry_count_out = dbg->de_name_index->ni_entry_count;
+    }
+    return DW_DLV_OK;
+}
+
+int
+dwarf_name_index_lookup(Dwarf_Name_Index ni,
+    const char     *name,
+    Dwarf_Unsigned *first_entry,
+    Dwarf_Unsigned *entry_count,
+    Dwarf_Error    *error)
+{
+    Dwarf_Unsigned hash = 0;
+    Dwarf_Unsigned low = 0;
+    Dwarf_Unsigned high = 0;
+    Dwarf_Unsigned first = 0;
+
+    if (!ni || !name || !first_entry || !entry_count) {
+        _dwarf_error_string(ni?ni->ni_dbg:0,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_name_index_lookup() passed a NULL pointer");
+        return DW_DLV_ERROR;
+    }
+    hash = _dwarf_name_hash(name);
+    high = ni->ni_entry_count;
+    /*  The first entry not ordered before (hash,name). */
+    while (low < high) {
+        Dwarf_Unsigned middle = low + (high - low)/2;
+        struct Dwarf_Name_Entry_s *e = ni->ni_entries + middle;
+
+        if (e->ne_hash < hash ||
+            (e->ne_hash == hash && strcmp(e->ne_name,name) < 0)) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    first = low;
+    while (low < ni->ni_entry_count &&
+        ni->ni_entries[low].ne_hash == hash &&
+        !strcmp(ni->ni_entries[low].ne_name,name)) {
+        ++low;
+    }
+    if (low == first) {
+        return DW_DLV_NO_ENTRY;
+    }
+    *first_entry = first;
+    *entry_count = low - first;
+    return DW_DLV_OK;
+}
+
+int
+dwarf_name_index_entry(Dwarf_Name_Index ni,
+    Dwarf_Unsigned  index,
+    const char    **name,
+    Dwarf_Unsigned *hash,
+    Dwarf_Half     *tag,
+    Dwarf_Off      *die_offset,
+    Dwarf_Bool     *is_info,
+    Dwarf_Off      *parent_offset,
+    Dwarf_Off      *cu_die_offset,
+    Dwarf_Error    *error)
+{
+    struct Dwarf_Name_Entry_s *e = 0;
+
+    if (!ni) {
+        _dwarf_error_string(NULL,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "NULL Dwarf_Name_Index passed in.");
+        return DW_DLV_ERROR;
+    }
+    if (index >= ni->ni_entry_count) {
+        return DW_DLV_NO_ENTRY;
+    }
+    e = ni->ni_entries + index;
+    if (name) {
+        *name = e->ne_name;
+    }
+    if (hash) {
+        *hash = e->ne_hash;
+    }
+    if (tag) {
+        *tag = e->ne_tag;
+    }
+    if (die_offset) {
+        *die_offset = e->ne_die_offset;
+    }
+    if (is_info) {
+        *is_info = e->ne_is_info;
+    }
+    if (parent_offset) {
+        *parent_offset = e->ne_parent_offset;
+    }
+    if (cu_die_offset) {
+        *cu_die_offset = e->ne_cu_die_offset;
+    }
+    return DW_DLV_OK;
+}
@@ -0,0 +1,68 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it
+  and/or modify it under the terms of version 2.1 of the
+  GNU Lesser General Public License as published by the Free
+  Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General
+  Public License along with this program; if not, write the
+  Free Software Foundation, Inc., 51 Franklin Street - Fifth
+  Floor, Boston MA 02110-1301, USA.
+
+*/
+
+#ifndef DWARF_NAME_INDEX_H
+#define DWARF_NAME_INDEX_H
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*  One name of one DIE. A DIE with both a
+    DW_AT_name and a different linkage name has
+    two entries. ne_name points to string data
+    libdwarf keeps until dwarf_finish(). */
+struct Dwarf_Name_Entry_s {
+    const char    *ne_name;
+    Dwarf_Unsigned ne_hash;
+    Dwarf_Off      ne_die_offset;
+    /*  The enclosing namespace, class etc,
+        zero at the outermost level of the unit. */
+    Dwarf_Off      ne_parent_offset;
+    Dwarf_Off      ne_cu_die_offset;
+    Dwarf_Half     ne_tag;
+    Dwarf_Bool     ne_is_info;
+};
+
+/*  The name index of a Dwarf_Debug, built from
+    the DIEs of every unit on the first
+    dwarf_name_index() call. Sorted by hash,
+    then name, so one name is a contiguous run. */
+struct Dwarf_Name_Index_s {
+    Dwarf_Debug    ni_dbg;
+    struct Dwarf_Name_Entry_s *ni_entries;
+    Dwarf_Unsigned ni_entry_count;
+    Dwarf_Unsigned ni_entry_alloc;
+};
+
+Dwarf_Unsigned _dwarf_name_hash(const char *name);
+void _dwarf_destroy_name_index(Dwarf_Debug dbg);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* DWARF_NAME_INDEX_H */
@@ -40,7 +40,7 @@ EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #endif /* HAVE_STDAFX_H */
 #include <io.h> /* off_t */
 #elif defined HAVE_UNISTD_H
-#include <unistd.h> /* off_t */
+#include <unistd.h> /* off_t pread() */
 #endif /* _WIN32*/
 
 #include "dwarf.h"
@@ -59,7 +59,9 @@ int
 _dwarf_object_read_random(int fd, char *buf, off_t loc,
     size_t size, off_t filesize, int *errc)
 {
+#ifdef _WIN32
     off_t scode = 0;
+#endif /* _WIN32 */
     ssize_t rcode = 0;
     off_t endpoint = 0;
 
@@ -76,12 +78,19 @@ _dwarf_object_read_random(int fd, char *buf, off_t loc,
         *errc = DW_DLE_READ_OFF_END;
         return DW_DLV_ERROR;
     }
+#ifdef _WIN32
     scode = lseek(fd,loc,SEEK_SET);
     if (scode == (off_t)-1) {
         *errc = DW_DLE_SEEK_ERROR;
         return DW_DLV_ERROR;
     }
     rcode = read(fd,buf,size);
+#else /* !_WIN32 */
+    /*  pread() leaves the file position alone, so
+        several Dwarf_Debug (archive members, for
+        example) can share one fd, even across threads. */
+    rcode = pread(fd,buf,size,loc);
+#endif /* _WIN32 */
     if (rcode == (ssize_t)-1 ||
         (size_t)rcode != size) {
         *errc = DW_DLE_READ_ERROR;
@@ -598,7 +598,7 @@ struct Dwarf_Debug_s {
     int  de_fd;
     char de_owns_fd;
     Dwarf_Small de_ftype; /* DW_FTYPE_PE, ... */
-    char de_in_tdestroy; /* for de_alloc_tree  DW202309-001 */
+    char de_in_tdestroy; /* for de_alloc_list  DW202309-001 */
     /* DW_PATHSOURCE_BASIC or MACOS or DEBUGLINK */
     Dwarf_Small de_path_source;
     /*  de_path is only set automatically if dwarf_init_path()
@@ -621,6 +621,13 @@ struct Dwarf_Debug_s {
     /* Supporting data for groupnumbers. */
     struct Dwarf_Group_Data_s de_groupnumbers;
 
+    /*  Set only while dwarf_init_path_sections() runs
+        _dwarf_setup(): the standard names of the only
+        sections to set up. The strings belong to the
+        caller, so these are zeroed before init returns. */
+    const char **de_wanted_sections;
+    unsigned     de_wanted_section_count;
+
     /*  Number of bytes in the length, and offset field in various
         .debu* sections.  It's not very meaningful, and is
         only used in one 'approximate' calculation.
@@ -641,12 +648,24 @@ struct Dwarf_Debug_s {
     Dwarf_Unsigned de_obj_machine;
     /*  For DW_FTYPE_APPLEUNIVERSAL this is the
         offset of an executable object in the multi-executable
-        file.  For all other de_ftype values this has
+        file, and for a member opened by
+        dwarf_archive_init_member() the offset of the
+        member in the archive.  Otherwise this has
         value zero. */
     Dwarf_Unsigned de_obj_ub_offset;
     /*  The flags field from an Elf or Macos header
         or the Charactersics field from a PE header. */
     Dwarf_Unsigned de_obj_flags;
+    /*  The fd the Elf, Mach-O or PE reader reads
+        sections from and the file offset its section
+        offsets are relative to (a universal binary
+        inner object or an archive member).
+        Only meaningful if de_obj_read_fd_valid is set,
+        which it is not for caller-provided
+        object interfaces. Used for read-ahead hints. */
+    int            de_obj_read_fd;
+    char           de_obj_read_fd_valid;
+    Dwarf_Unsigned de_obj_read_offset;
 
     /*  number of bytes in a pointer of the target in various .debug_
         sections. 4 in 32bit, 8 in MIPS 64, ia64. 
@@ -660,7 +679,12 @@ struct Dwarf_Debug_s {
     Dwarf_Small de_assume_string_in_bounds;
 
     /*  Keep track of allocations so a dwarf_finish call can clean up.
+        de_alloc_list is the head of a doubly-linked list
+        through the prefix of each allocation (see
+        dwarf_alloc.c), de_alloc_tree holds the
+        DW_DLA_STRING allocations only.
         Null till a tree is created */
+    void * de_alloc_list;
     void * de_alloc_tree;
 
     /*  These fields are used to process debug_frame section.
@@ -701,6 +725,7 @@ struct Dwarf_Debug_s {
     struct Dwarf_Section_s de_debug_frame;
     struct Dwarf_Section_s de_gnu_debuglink;  /* New Sept. 2019 */
     struct Dwarf_Section_s de_note_gnu_buildid; /* New Sept. 2019 */
+    struct Dwarf_Section_s de_gnu_debugaltlink;
 
     /* gnu: the g++ eh_frame section */
     struct Dwarf_Section_s de_debug_frame_eh_gnu;
@@ -821,6 +846,54 @@ struct Dwarf_Debug_s {
         file is sometimes needed
         and referenced.*/
     struct Dwarf_Tied_Data_s de_tied_data;
+
+    /*  The supplementary object (DWARF5 .debug_sup or
+        GNU dwz .gnu_debugaltlink) DW_FORM_strp_sup,
+        DW_FORM_ref_sup4/8 and the GNU _alt forms refer to.
+        Set by dwarf_set_sup_dbg(). Not owned by this dbg,
+        several dbg may share one supplementary dbg. */
+    Dwarf_Debug de_sup_object;
+
+    /*  Last serial number given a Dwarf_Die_Filter. */
+    Dwarf_Unsigned de_die_filter_serial;
+
+    /*  Memo of dwarf_die_resolved_names(), see
+        dwarf_die_names.h. Search trees keyed by DIE
+        offset and by CU offset. */
+    void *de_die_names_tree;
+    void *de_die_names_cu_tree;
+
+    /*  Memo of dwarf_type_size() and dwarf_type_layout()
+        keyed by type DIE offset, see dwarf_type_layout.h. */
+    void *de_type_layout_tree;
+
+    /*  Built by the first dwarf_addr_ranges_for_source_line()
+        call, see dwarf_line_index.h. */
+    struct Dwarf_Line_Index_s *de_line_index;
+
+    /*  Built by the first dwarf_find_fde_at_pc() on
+        .debug_frame and .eh_frame respectively,
+        see dwarf_frame.h. */
+    struct Dwarf_Fde_Index_s *de_fde_index;
+    struct Dwarf_Fde_Index_s *de_fde_index_eh;
+
+    /*  Compiled DWARF expressions, see dwarf_expr_eval.h. */
+    void *de_expr_tree;
+
+    /*  The dwarf_var_index() memo, see dwarf_var_index.h. */
+    void *de_var_index_tree;
+
+    /*  Built by the first dwarf_name_index() call,
+        see dwarf_name_index.h. */
+    struct Dwarf_Name_Index_s *de_name_index;
+
+    /*  The name and address lookup sources chosen
+        by the dwarf_accel_*() calls, see dwarf_accel.h. */
+    struct Dwarf_Accel_s *de_accel;
+
+    /*  The memos of dwarf_macro_state(), one per unit,
+        see dwarf_macro_state.h. */
+    void *de_macro_state_tree;
 };
 
 /* New style. takes advantage of dwarfstrings capability.
@@ -868,6 +941,13 @@ int _dwarf_get_string_base_attr_value(Dwarf_Debug dbg,
     Dwarf_Unsigned *sbase_out,
     Dwarf_Error *error);
 
+int _dwarf_get_value_ptr(Dwarf_Die die,
+    Dwarf_Half      attrnum_in,
+    Dwarf_Half     *attr_form,
+    Dwarf_Byte_Ptr *ptr_to_value,
+    Dwarf_Signed   *implicit_const_out,
+    Dwarf_Error    *error);
+
 int _dwarf_look_in_local_and_tied_by_index(
     Dwarf_Debug dbg,
     Dwarf_CU_Context context,
@@ -1002,6 +1082,9 @@ int _dwarf_get_ranges_base_attr_from_tied(Dwarf_Debug dbg,
 int _dwarf_get_string_from_tied(Dwarf_Debug dbg,
     Dwarf_Unsigned offset,
     char **return_str, Dwarf_Error*error);
+int _dwarf_get_string_from_sup(Dwarf_Debug dbg,
+    Dwarf_Unsigned offset,
+    char **return_str, Dwarf_Error*error);
 
 int _dwarf_valid_form_we_know(Dwarf_Unsigned at_form,
     Dwarf_Unsigned at_name);
@@ -1026,6 +1109,18 @@ extern int _dwarf_elf_setup(int fd,
     Dwarf_Ptr errarg,
     Dwarf_Debug *dbg,Dwarf_Error *error);
 
+/*  dwarf_object_init_b() limited to the named
+    sections (all if wanted_sections is NULL). */
+extern int _dwarf_object_init_c(
+    Dwarf_Obj_Access_Interface_a* obj,
+    Dwarf_Handler errhand,
+    Dwarf_Ptr errarg,
+    unsigned groupnumber,
+    const char **wanted_sections,
+    unsigned wanted_section_count,
+    Dwarf_Debug* ret_dbg,
+    Dwarf_Error* error);
+
 /*  This is non-libelf Elf access */
 extern int
 _dwarf_elf_nlsetup(int fd,
@@ -1038,6 +1133,20 @@ _dwarf_elf_nlsetup(int fd,
     Dwarf_Handler errhand,
     Dwarf_Ptr errarg,
     Dwarf_Debug *dbg,Dwarf_Error *error);
+extern int
+_dwarf_elf_nlsetup_a(int fd,
+    char *true_path,
+    unsigned ftype,
+    unsigned endian,
+    unsigned offsetsize,
+    Dwarf_Unsigned fileoffsetbase,
+    size_t filesize,
+    unsigned groupnumber,
+    const char **wanted_sections,
+    unsigned wanted_section_count,
+    Dwarf_Handler errhand,
+    Dwarf_Ptr errarg,
+    Dwarf_Debug *dbg,Dwarf_Error *error);
 void _dwarf_destruct_elf_nlaccess(
     struct Dwarf_Obj_Access_Interface_a_s *aip);
 
@@ -1049,6 +1158,8 @@ extern int _dwarf_macho_setup(int fd,
     unsigned offsetsize,
     Dwarf_Unsigned filesize,
     unsigned groupnumber,
+    const char **wanted_sections,
+    unsigned wanted_section_count,
     Dwarf_Handler errhand,
     Dwarf_Ptr errarg,
     Dwarf_Debug *dbg,Dwarf_Error *error);
@@ -1062,6 +1173,8 @@ extern int _dwarf_pe_setup(int fd,
     unsigned offsetsize,
     size_t filesize,
     unsigned groupnumber,
+    const char **wanted_sections,
+    unsigned wanted_section_count,
     Dwarf_Handler errhand,
     Dwarf_Ptr errarg,
     Dwarf_Debug *dbg,Dwarf_Error *error);
@@ -849,6 +849,8 @@ _dwarf_pe_setup(int fd,
     unsigned offsetsize,
     size_t filesize,
     unsigned groupnumber,
+    const char **wanted_sections,
+    unsigned wanted_section_count,
     Dwarf_Handler errhand,
     Dwarf_Ptr errarg,
     Dwarf_Debug *dbg,Dwarf_Error *error)
@@ -872,8 +874,9 @@ _dwarf_pe_setup(int fd,
     }
     /*  allocates and initializes Dwarf_Debug,
         generic code */
-    res = dwarf_object_init_b(binary_interface, errhand, errarg,
-        groupnumber, dbg, error);
+    res = _dwarf_object_init_c(binary_interface, errhand, errarg,
+        groupnumber, wanted_sections,wanted_section_count,
+        dbg, error);
     if (res != DW_DLV_OK){
         _dwarf_destruct_pe_access(binary_interface);
         return res;
@@ -881,6 +884,8 @@ _dwarf_pe_setup(int fd,
     pep = binary_interface->ai_object;
     (*dbg)->de_obj_flags = pep->pe_flags;
     (*dbg)->de_obj_machine = pep->pe_machine;
+    (*dbg)->de_obj_read_fd = pep->pe_fd;
+    (*dbg)->de_obj_read_fd_valid = TRUE;
     pep->pe_path = strdup(true_path);
     return res;
 }
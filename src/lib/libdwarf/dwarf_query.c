@@ -629,7 +629,7 @@ dwarf_attrlist(Dwarf_Die die,
     However, *attr_form is 0 on error, and positive
     otherwise.
 */
-static int
+int
 _dwarf_get_value_ptr(Dwarf_Die die,
     Dwarf_Half      attrnum_in,
     Dwarf_Half     *attr_form,
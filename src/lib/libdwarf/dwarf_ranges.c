@@ -30,6 +30,7 @@
 #include <config.h>
 
 #include <stdlib.h> /* calloc() free() */
+#include <string.h> /* memset() */
 
 #if defined(_WIN32) && defined(HAVE_STDAFX_H)
 #include "stdafx.h"
@@ -44,6 +45,7 @@
 #include "dwarf_error.h"
 #include "dwarf_util.h"
 #include "dwarf_string.h"
+#include "dwarf_rnglists.h"
 
 struct ranges_entry {
     struct ranges_entry *next;
@@ -351,3 +353,412 @@ dwarf_dealloc_ranges(Dwarf_Debug dbg, Dwarf_Ranges * rangesbuf,
     (void)rangecount;
     dwarf_dealloc(dbg,rangesbuf, DW_DLA_RANGES);
 }
+
+/*  What a Dwarf_Range_Iter is walking. */
+#define RANGE_ITER_DONE     0
+#define RANGE_ITER_PC_PAIR  1 /* DW_AT_low_pc DW_AT_high_pc */
+#define RANGE_ITER_RANGES   2 /* .debug_ranges */
+#define RANGE_ITER_RNGLISTS 3 /* .debug_rnglists */
+
+/*  Reads DW_AT_ranges straight from the DIE so no
+    Dwarf_Attribute is allocated. */
+static int
+get_ranges_attr_value(Dwarf_Debug dbg,
+    Dwarf_Die die,
+    Dwarf_Half *form_out,
+    Dwarf_Unsigned *value_out,
+    Dwarf_Error *error)
+{
+    Dwarf_CU_Context context = die->di_cu_context;
+    Dwarf_Byte_Ptr info_ptr = 0;
+    Dwarf_Byte_Ptr die_info_end = 0;
+    Dwarf_Half form = 0;
+    Dwarf_Signed implicit_const = 0;
+    Dwarf_Unsigned value = 0;
+    Dwarf_Unsigned bytes_read = 0;
+    int res = 0;
+
+    res = _dwarf_get_value_ptr(die,DW_AT_ranges,&form,
+        &info_ptr,&implicit_const,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    die_info_end = _dwarf_calculate_info_section_end_ptr(context);
+    switch (form) {
+    case DW_FORM_sec_offset:
+        if (context->cc_length_size != DWARF_32BIT_SIZE &&
+            context->cc_length_size != DWARF_64BIT_SIZE) {
+            _dwarf_error(dbg, error,
+                DW_DLE_FORM_SEC_OFFSET_LENGTH_BAD);
+            return DW_DLV_ERROR;
+        }
+        READ_UNALIGNED_CK(dbg, value, Dwarf_Unsigned,
+            info_ptr, context->cc_length_size,
+            error,die_info_end);
+        break;
+    case DW_FORM_implicit_const:
+        value = (Dwarf_Unsigned)implicit_const;
+        break;
+    default:
+        /*  DW_FORM_rnglistx, and the DWARF2,3
+            constant forms. */
+        res = _dwarf_formudata_internal(dbg,0,form,info_ptr,
+            die_info_end,&value,&bytes_read,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        break;
+    }
+    *form_out = form;
+    *value_out = value;
+    return DW_DLV_OK;
+}
+
+/*  Same section choice and offset checks
+    as dwarf_get_ranges_b(). */
+static int
+start_debug_ranges(Dwarf_Debug dbg,
+    Dwarf_CU_Context context,
+    Dwarf_Unsigned rangesoffset,
+    Dwarf_Range_Iter *iter,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug localdbg = dbg;
+    Dwarf_Error localerror = 0;
+    Dwarf_Unsigned ranges_base = context->cc_ranges_base;
+    Dwarf_Unsigned size = 0;
+    int res = 0;
+
+    res = _dwarf_load_section(localdbg,
+        &localdbg->de_debug_ranges,error);
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    if (res == DW_DLV_NO_ENTRY) {
+        /* data is in a.out, not dwp */
+        localdbg = dbg->de_tied_data.td_tied_object;
+        if (!localdbg) {
+            return DW_DLV_NO_ENTRY;
+        }
+        res = _dwarf_load_section(localdbg,
+            &localdbg->de_debug_ranges, &localerror);
+        if (res == DW_DLV_ERROR) {
+            _dwarf_error_mv_s_to_t(localdbg,&localerror,dbg,error);
+            return res;
+        }
+        if (res == DW_DLV_NO_ENTRY) {
+            return res;
+        }
+    } else {
+        ranges_base = 0;
+    }
+    size = localdbg->de_debug_ranges.dss_size;
+    if (rangesoffset >= size) {
+        return DW_DLV_NO_ENTRY;
+    }
+    if (ranges_base >= size ||
+        (rangesoffset + ranges_base) >= size) {
+        dwarfstring m;
+
+        dwarfstring_constructor(&m);
+        dwarfstring_append_printf_u(&m,
+            "DW_DLE_DEBUG_RANGES_OFFSET_BAD: "
+            " ranges base+offset  is 0x%lx ",
+            ranges_base+rangesoffset);
+        dwarfstring_append_printf_u(&m,
+            " and section size is 0x%lx.",size);
+        _dwarf_error_string(dbg, error,
+            DW_DLE_DEBUG_RANGES_OFFSET_BAD,
+            dwarfstring_string(&m));
+        dwarfstring_destructor(&m);
+        return DW_DLV_ERROR;
+    }
+    rangesoffset += ranges_base;
+    iter->ri_kind = RANGE_ITER_RANGES;
+    iter->ri_offset = rangesoffset;
+    iter->ri_ptr = localdbg->de_debug_ranges.dss_data + rangesoffset;
+    iter->ri_end = localdbg->de_debug_ranges.dss_data + size;
+    return DW_DLV_OK;
+}
+
+static int
+start_rnglists(Dwarf_Debug dbg,
+    Dwarf_CU_Context context,
+    Dwarf_Half form,
+    Dwarf_Unsigned value,
+    Dwarf_Range_Iter *iter,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned contextnum = 0;
+    Dwarf_Unsigned rle_offset = 0;
+    Dwarf_Rnglists_Context rctx = 0;
+    int res = 0;
+
+    res = _dwarf_rnglists_locate_rle_set(dbg,context,form,value,
+        &contextnum,&rle_offset,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    rctx = dbg->de_rnglists_context[contextnum];
+    if (rle_offset >= dbg->de_debug_rnglists.dss_size ||
+        (dbg->de_debug_rnglists.dss_data + rle_offset) >=
+        rctx->rc_endaddr) {
+        dwarfstring m;
+
+        dwarfstring_constructor(&m);
+        dwarfstring_append_printf_u(&m,
+            "DW_DLE_RNGLISTS_ERROR: rangelist offset "
+            " 0x%" DW_PR_XZEROS DW_PR_DUx ,rle_offset);
+        dwarfstring_append(&m,
+            " is outside its .debug_rnglists table");
+        _dwarf_error_string(dbg,error,DW_DLE_RNGLISTS_ERROR,
+            dwarfstring_string(&m));
+        dwarfstring_destructor(&m);
+        return DW_DLV_ERROR;
+    }
+    iter->ri_kind = RANGE_ITER_RNGLISTS;
+    iter->ri_address_size = (Dwarf_Half)rctx->rc_address_size;
+    iter->ri_offset = rle_offset;
+    iter->ri_ptr = dbg->de_debug_rnglists.dss_data + rle_offset;
+    iter->ri_end = rctx->rc_endaddr;
+    return DW_DLV_OK;
+}
+
+int
+dwarf_die_ranges_start(Dwarf_Die die,
+    Dwarf_Range_Iter *iter,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_CU_Context context = 0;
+    Dwarf_Addr low = 0;
+    Dwarf_Addr high = 0;
+    Dwarf_Half form = 0;
+    enum Dwarf_Form_Class formclass = DW_FORM_CLASS_UNKNOWN;
+    Dwarf_Unsigned value = 0;
+    int res = 0;
+
+    CHECK_DIE(die, DW_DLV_ERROR);
+    context = die->di_cu_context;
+    dbg = context->cc_dbg;
+    if (!iter) {
+        _dwarf_error_string(dbg,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_die_ranges_start() passed a NULL iter");
+        return DW_DLV_ERROR;
+    }
+    memset(iter,0,sizeof(*iter));
+    iter->ri_dbg = dbg;
+    iter->ri_context = context;
+    iter->ri_address_size = context->cc_address_size;
+    if (context->cc_low_pc_present) {
+        iter->ri_base = context->cc_low_pc;
+    }
+
+    res = dwarf_lowpc(die,&low,error);
+    if (res == DW_DLV_OK) {
+        res = dwarf_highpc_b(die,&high,&form,&formclass,error);
+        if (res == DW_DLV_OK) {
+            if (formclass == DW_FORM_CLASS_CONSTANT) {
+                high += low;
+            }
+            iter->ri_kind = RANGE_ITER_PC_PAIR;
+            iter->ri_low = low;
+            iter->ri_high = high;
+            return DW_DLV_OK;
+        }
+    }
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    /*  A DW_AT_low_pc without DW_AT_high_pc is just the
+        base address of DW_AT_ranges on a CU DIE. */
+    res = get_ranges_attr_value(dbg,die,&form,&value,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (form == DW_FORM_rnglistx ||
+        context->cc_version_stamp >= DW_CU_VERSION5) {
+        return start_rnglists(dbg,context,form,value,iter,error);
+    }
+    return start_debug_ranges(dbg,context,value,iter,error);
+}
+
+static int
+next_debug_ranges(Dwarf_Range_Iter *iter,
+    Dwarf_Addr *low_out,
+    Dwarf_Addr *high_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug dbg = iter->ri_dbg;
+    unsigned address_size = iter->ri_address_size;
+
+    for (;;) {
+        Dwarf_Addr addr1 = 0;
+        Dwarf_Addr addr2 = 0;
+        Dwarf_Small *rangeptr = iter->ri_ptr;
+        Dwarf_Small *section_end = iter->ri_end;
+
+        if (rangeptr == section_end) {
+            iter->ri_kind = RANGE_ITER_DONE;
+            return DW_DLV_NO_ENTRY;
+        }
+        if ((rangeptr + (2*address_size)) > section_end) {
+            iter->ri_kind = RANGE_ITER_DONE;
+            _dwarf_error_string(dbg, error,
+                DW_DLE_DEBUG_RANGES_OFFSET_BAD,
+                "DW_DLE_DEBUG_RANGES_OFFSET_BAD: "
+                " Not at the end of the ranges section "
+                " but there is not enough room in the section "
+                " for the next ranges entry");
+            return DW_DLV_ERROR;
+        }
+        READ_UNALIGNED_CK(dbg,addr1,Dwarf_Addr,rangeptr,
+            address_size,error,section_end);
+        rangeptr += address_size;
+        READ_UNALIGNED_CK(dbg,addr2,Dwarf_Addr,rangeptr,
+            address_size,error,section_end);
+        rangeptr += address_size;
+        iter->ri_ptr = rangeptr;
+        iter->ri_offset += 2*address_size;
+        if (addr1 == 0 && addr2 == 0) {
+            iter->ri_kind = RANGE_ITER_DONE;
+            return DW_DLV_NO_ENTRY;
+        }
+        if (addr1 == MAX_ADDR) {
+            iter->ri_base = addr2;
+            continue;
+        }
+        *low_out = addr1 + iter->ri_base;
+        *high_out = addr2 + iter->ri_base;
+        return DW_DLV_OK;
+    }
+}
+
+static int
+next_rnglists(Dwarf_Range_Iter *iter,
+    Dwarf_Addr *low_out,
+    Dwarf_Addr *high_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug dbg = iter->ri_dbg;
+    Dwarf_CU_Context context =
+        (Dwarf_CU_Context)iter->ri_context;
+
+    for (;;) {
+        unsigned entrylen = 0;
+        unsigned code = 0;
+        Dwarf_Unsigned val1 = 0;
+        Dwarf_Unsigned val2 = 0;
+        Dwarf_Addr addr1 = 0;
+        Dwarf_Addr addr2 = 0;
+        int res = 0;
+
+        if (iter->ri_ptr >= iter->ri_end) {
+            iter->ri_kind = RANGE_ITER_DONE;
+            _dwarf_error_string(dbg,error,DW_DLE_RNGLISTS_ERROR,
+                "DW_DLE_RNGLISTS_ERROR: a rangelist runs "
+                "off the end of its .debug_rnglists table");
+            return DW_DLV_ERROR;
+        }
+        res = _dwarf_read_single_rle_entry(dbg,
+            iter->ri_ptr,iter->ri_offset,iter->ri_end,
+            iter->ri_address_size,&entrylen,
+            &code,&val1,&val2,error);
+        if (res != DW_DLV_OK) {
+            iter->ri_kind = RANGE_ITER_DONE;
+            return res;
+        }
+        iter->ri_ptr += entrylen;
+        iter->ri_offset += entrylen;
+        switch (code) {
+        case DW_RLE_end_of_list:
+            iter->ri_kind = RANGE_ITER_DONE;
+            return DW_DLV_NO_ENTRY;
+        case DW_RLE_base_addressx:
+            res = _dwarf_look_in_local_and_tied_by_index(dbg,
+                context,val1,&addr1,error);
+            if (res != DW_DLV_OK) {
+                iter->ri_kind = RANGE_ITER_DONE;
+                return res;
+            }
+            iter->ri_base = addr1;
+            continue;
+        case DW_RLE_base_address:
+            iter->ri_base = val1;
+            continue;
+        case DW_RLE_startx_endx:
+            res = _dwarf_look_in_local_and_tied_by_index(dbg,
+                context,val1,&addr1,error);
+            if (res == DW_DLV_OK) {
+                res = _dwarf_look_in_local_and_tied_by_index(dbg,
+                    context,val2,&addr2,error);
+            }
+            if (res != DW_DLV_OK) {
+                iter->ri_kind = RANGE_ITER_DONE;
+                return res;
+            }
+            break;
+        case DW_RLE_startx_length:
+            res = _dwarf_look_in_local_and_tied_by_index(dbg,
+                context,val1,&addr1,error);
+            if (res != DW_DLV_OK) {
+                iter->ri_kind = RANGE_ITER_DONE;
+                return res;
+            }
+            addr2 = addr1 + val2;
+            break;
+        case DW_RLE_offset_pair:
+            addr1 = val1 + iter->ri_base;
+            addr2 = val2 + iter->ri_base;
+            break;
+        case DW_RLE_start_end:
+            addr1 = val1;
+            addr2 = val2;
+            break;
+        case DW_RLE_start_length:
+            addr1 = val1;
+            addr2 = val1 + val2;
+            break;
+        default:
+            /*  _dwarf_read_single_rle_entry() has
+                rejected any other code. */
+            iter->ri_kind = RANGE_ITER_DONE;
+            _dwarf_error(dbg,error,DW_DLE_RNGLISTS_ERROR);
+            return DW_DLV_ERROR;
+        }
+        *low_out = addr1;
+        *high_out = addr2;
+        return DW_DLV_OK;
+    }
+}
+
+int
+dwarf_die_ranges_next(Dwarf_Range_Iter *iter,
+    Dwarf_Addr *low_out,
+    Dwarf_Addr *high_out,
+    Dwarf_Error *error)
+{
+    if (!iter || !low_out || !high_out) {
+        _dwarf_error_string(iter?iter->ri_dbg:0,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_die_ranges_next() passed a NULL pointer");
+        return DW_DLV_ERROR;
+    }
+    switch (iter->ri_kind) {
+    case RANGE_ITER_PC_PAIR:
+        iter->ri_kind = RANGE_ITER_DONE;
+        *low_out = iter->ri_low;
+        *high_out = iter->ri_high;
+        return DW_DLV_OK;
+    case RANGE_ITER_RANGES:
+        return next_debug_ranges(iter,low_out,high_out,error);
+    case RANGE_ITER_RNGLISTS:
+        return next_rnglists(iter,low_out,high_out,error);
+    default:
+        break;
+    }
+    return DW_DLV_NO_ENTRY;
+}
@@ -117,8 +117,8 @@ free_rnglists_chain(Dwarf_Debug dbg, Dwarf_Chain head)
     }
 }
 
-static int
-read_single_rle_entry(Dwarf_Debug dbg,
+int
+_dwarf_read_single_rle_entry(Dwarf_Debug dbg,
     Dwarf_Small   *data,
     Dwarf_Unsigned dataoffset,
     Dwarf_Small   *enddata,
@@ -865,7 +865,7 @@ int dwarf_get_rnglist_rle(
         return DW_DLV_ERROR;
     }
     if ((entry_offset +1) > endoffset) {
-        /*  The read_single_rle_entry call will need
+        /*  The _dwarf_read_single_rle_entry call will need
             at least 1 byte as it reads at least one
             ULEB */
         dwarfstring m;
@@ -890,7 +890,7 @@ int dwarf_get_rnglist_rle(
 
     con = dbg->de_rnglists_context[contextnumber];
     address_size = con->rc_address_size;
-    res = read_single_rle_entry(dbg,
+    res = _dwarf_read_single_rle_entry(dbg,
         data,entry_offset,enddata,
         address_size,entrylen,
         entry_kind, entry_operand1, entry_operand2,
@@ -1079,7 +1079,7 @@ build_array_of_rle(Dwarf_Debug dbg,
         Dwarf_Addr addr2 = 0;
         Dwarf_Rnglists_Entry e = 0;
 
-        res = read_single_rle_entry(dbg,
+        res = _dwarf_read_single_rle_entry(dbg,
             data,dataoffset, enddata,
             address_size,&entrylen,
             &code,&val1, &val2,error);
@@ -1241,21 +1241,20 @@ build_array_of_rle(Dwarf_Debug dbg,
     return DW_DLV_OK;
 }
 
-/*  Build a head with all the relevent Entries
-    attached.
-*/
+/*  Finds the context and the section offset of the
+    rangelist a DW_AT_ranges value refers to.
+    attr_val is either an offset
+    (theform == DW_FORM_sec_offset)
+    or an index (theform == DW_FORM_rnglistx).
+    Does no memory allocations. */
 int
-dwarf_rnglists_get_rle_head(
-    Dwarf_Attribute attr,
-    Dwarf_Half     theform,
-    /*  attr_val is either an offset
-        (theform == DW_FORM_sec_offset)
-        or an index DW_FORM_rnglistx. */
+_dwarf_rnglists_locate_rle_set(Dwarf_Debug dbg,
+    Dwarf_CU_Context ctx,
+    Dwarf_Half theform,
     Dwarf_Unsigned attr_val,
-    Dwarf_Rnglists_Head *head_out,
-    Dwarf_Unsigned      *entries_count_out,
-    Dwarf_Unsigned      *global_offset_of_rle_set,
-    Dwarf_Error         *error)
+    Dwarf_Unsigned *contextnum_out,
+    Dwarf_Unsigned *rle_global_offset_out,
+    Dwarf_Error *error)
 {
     int res = 0;
     Dwarf_Unsigned rnglists_contextnum = 0;
@@ -1266,27 +1265,9 @@ dwarf_rnglists_get_rle_head(
     Dwarf_Rnglists_Context rctx = 0;
     Dwarf_Unsigned entrycount = 0;
     unsigned offsetsize = 0;
-    Dwarf_Unsigned rle_global_offset = 0;
-    Dwarf_Rnglists_Head lhead = 0;
-    Dwarf_CU_Context ctx = 0;
-    struct Dwarf_Rnglists_Head_s shead;
     Dwarf_Unsigned offset_in_rnglists = 0;
-    Dwarf_Debug dbg = 0;
     Dwarf_Bool is_rnglistx = FALSE;
 
-    if (!attr) {
-        _dwarf_error_string(NULL, error,DW_DLE_DBG_NULL,
-            "DW_DLE_DBG_NULL "
-            "NULL attribute "
-            "argument passed to "
-            "dwarf_rnglists_get_rle_head()");
-        return DW_DLV_ERROR;
-    }
-    memset(&shead,0,sizeof(shead));
-    ctx = attr->ar_cu_context;
-    dbg = ctx->cc_dbg;
-    CHECK_DBG(dbg,error,
-        "dwarf_rnglists_get_rle_head() via attribute");
     array = dbg->de_rnglists_context;
     if (theform == DW_FORM_rnglistx) {
         is_rnglistx = TRUE;
@@ -1294,11 +1275,14 @@ dwarf_rnglists_get_rle_head(
     /*  ASSERT:  the 3 pointers just set are non-null */
     /*  the context cc_rnglists_base gives the offset
         of the array. of offsets (if cc_rnglists_base_present) */
-            offset_in_rnglists = attr_val;
     if (is_rnglistx) {
         if (ctx->cc_rnglists_base_present) {
             offset_in_rnglists = ctx->cc_rnglists_base;
-
+        } else if (dbg->de_rnglists_context_count == 1) {
+            /*  A DWARF5 .dwo has no DW_AT_rnglists_base,
+                its one table is the one meant. As for
+                DW_FORM_loclistx. */
+            offset_in_rnglists = 0;
         } else {
             /* FIXME: check in tied file for a cc_rnglists_base */
             dwarfstring m;
@@ -1346,6 +1330,71 @@ dwarf_rnglists_get_rle_head(
         dwarfstring_destructor(&m);
         return DW_DLV_ERROR;
     }
+    if (is_rnglistx) {
+        Dwarf_Unsigned table_entryval = 0;
+
+        table_entry = attr_val*offsetsize + table_base;
+        READ_UNALIGNED_CK(dbg,table_entryval, Dwarf_Unsigned,
+            table_entry,offsetsize,error,enddata);
+        *rle_global_offset_out = rctx->rc_offsets_off_in_sect +
+            table_entryval;
+    } else {
+        *rle_global_offset_out = attr_val;
+    }
+    *contextnum_out = rnglists_contextnum;
+    return DW_DLV_OK;
+}
+
+/*  Build a head with all the relevent Entries
+    attached.
+*/
+int
+dwarf_rnglists_get_rle_head(
+    Dwarf_Attribute attr,
+    Dwarf_Half     theform,
+    /*  attr_val is either an offset
+        (theform == DW_FORM_sec_offset)
+        or an index DW_FORM_rnglistx. */
+    Dwarf_Unsigned attr_val,
+    Dwarf_Rnglists_Head *head_out,
+    Dwarf_Unsigned      *entries_count_out,
+    Dwarf_Unsigned      *global_offset_of_rle_set,
+    Dwarf_Error         *error)
+{
+    int res = 0;
+    Dwarf_Unsigned rnglists_contextnum = 0;
+    Dwarf_Small *enddata = 0;
+    Dwarf_Rnglists_Context *array = 0;
+    Dwarf_Rnglists_Context rctx = 0;
+    unsigned offsetsize = 0;
+    Dwarf_Unsigned rle_global_offset = 0;
+    Dwarf_Rnglists_Head lhead = 0;
+    Dwarf_CU_Context ctx = 0;
+    struct Dwarf_Rnglists_Head_s shead;
+    Dwarf_Debug dbg = 0;
+
+    if (!attr) {
+        _dwarf_error_string(NULL, error,DW_DLE_DBG_NULL,
+            "DW_DLE_DBG_NULL "
+            "NULL attribute "
+            "argument passed to "
+            "dwarf_rnglists_get_rle_head()");
+        return DW_DLV_ERROR;
+    }
+    memset(&shead,0,sizeof(shead));
+    ctx = attr->ar_cu_context;
+    dbg = ctx->cc_dbg;
+    CHECK_DBG(dbg,error,
+        "dwarf_rnglists_get_rle_head() via attribute");
+    res = _dwarf_rnglists_locate_rle_set(dbg,ctx,theform,
+        attr_val,&rnglists_contextnum,&rle_global_offset,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    array = dbg->de_rnglists_context;
+    rctx = array[rnglists_contextnum];
+    offsetsize = rctx->rc_offset_size;
+    enddata = rctx->rc_endaddr;
     shead.rh_context = ctx;
     shead.rh_magic = RNGLISTS_MAGIC;
     shead.rh_localcontext = rctx;
@@ -1369,20 +1418,6 @@ dwarf_rnglists_get_rle_head(
         .debug_addr, from CU */
     shead.rh_cu_addr_base = ctx->cc_addr_base;
     shead.rh_cu_addr_base_present = ctx->cc_addr_base_present;
-    if (is_rnglistx) {
-        Dwarf_Unsigned table_entryval = 0;
-
-        table_entry = attr_val*offsetsize + table_base;
-        /*  No malloc here yet so no leak if the macro returns
-            DW_DLV_ERROR */
-        READ_UNALIGNED_CK(dbg,table_entryval, Dwarf_Unsigned,
-            table_entry,offsetsize,error,enddata);
-        rle_global_offset = rctx->rc_offsets_off_in_sect +
-            table_entryval;
-    } else {
-        rle_global_offset = attr_val;
-    }
-
     shead.rh_end_data_area = enddata;
     shead.rh_rlearea_offset = rle_global_offset;
     shead.rh_rlepointer = rle_global_offset +
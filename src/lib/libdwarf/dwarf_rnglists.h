@@ -151,6 +151,25 @@ int _dwarf_internal_read_rnglists_header(Dwarf_Debug dbg,
 
 void _dwarf_rnglists_head_destructor(void *m);
 
+int _dwarf_read_single_rle_entry(Dwarf_Debug dbg,
+    Dwarf_Small   *data,
+    Dwarf_Unsigned dataoffset,
+    Dwarf_Small   *enddata,
+    unsigned       address_size,
+    unsigned       *bytes_count_out,
+    unsigned       *entry_kind,
+    Dwarf_Unsigned *entry_operand1,
+    Dwarf_Unsigned *entry_operand2,
+    Dwarf_Error* error);
+
+int _dwarf_rnglists_locate_rle_set(Dwarf_Debug dbg,
+    Dwarf_CU_Context ctx,
+    Dwarf_Half theform,
+    Dwarf_Unsigned attr_val,
+    Dwarf_Unsigned *contextnum_out,
+    Dwarf_Unsigned *rle_global_offset_out,
+    Dwarf_Error *error);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
@@ -116,3 +116,52 @@ _dwarf_ignorethissection(const char *scn_name)
     }
     return FALSE;
 }
+
+/*  For dwarf_init_path_sections(): is object section
+    scn_name one of the standard names the caller asked
+    for?  A name such as ".debug_line" also matches
+    ".zdebug_line" and ".debug_line.dwo".
+    With no list every section is wanted. */
+int
+_dwarf_section_is_wanted(const char **wanted,
+    unsigned wanted_count,
+    const char *scn_name)
+{
+    unsigned i = 0;
+    const char *tail = scn_name;
+    int zdebug = FALSE;
+
+    if (!wanted) {
+        return TRUE;
+    }
+    if (!scn_name) {
+        return FALSE;
+    }
+    if (_dwarf_startswith(scn_name,".zdebug_")) {
+        /*  Compare from the "debug_". */
+        tail = scn_name+2;
+        zdebug = TRUE;
+    }
+    for (i = 0; i < wanted_count; ++i) {
+        const char *w = wanted[i];
+        size_t wlen = 0;
+
+        if (!w || !w[0]) {
+            continue;
+        }
+        if (zdebug) {
+            if (!_dwarf_startswith(w,".debug_")) {
+                continue;
+            }
+            ++w;
+        }
+        wlen = strlen(w);
+        if (strncmp(tail,w,wlen)) {
+            continue;
+        }
+        if (!tail[wlen] || !strcmp(tail+wlen,".dwo")) {
+            return TRUE;
+        }
+    }
+    return FALSE;
+}
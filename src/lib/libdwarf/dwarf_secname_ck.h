@@ -34,3 +34,6 @@ EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 int _dwarf_startswith(const char * input,const char* ckfor);
 int _dwarf_ignorethissection(const char *scn_name);
+int _dwarf_section_is_wanted(const char **wanted,
+    unsigned wanted_count,
+    const char *scn_name);
@@ -496,6 +496,12 @@ _dwarf_enter_section_in_de_debug_sections_array(Dwarf_Debug dbg,
         &dbg->de_note_gnu_buildid,
         DW_DLE_DUPLICATE_GNU_DEBUGLINK,0,
         FALSE,err);
+    /* GNU dwz added this. It is not part of DWARF */
+    SET_UP_SECTION(dbg,scn_name,".gnu_debugaltlink",
+        DW_GROUPNUMBER_DWO,
+        &dbg->de_gnu_debugaltlink,
+        DW_DLE_DUPLICATE_GNU_DEBUGLINK,0,
+        FALSE,err);
     /* GNU added this. It is not part of DWARF */
     SET_UP_SECTION(dbg,scn_name,".debug_gnu_pubtypes.dwo",
         DW_GROUPNUMBER_DWO,
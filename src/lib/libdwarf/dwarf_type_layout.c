@@ -0,0 +1,1452 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it
+  and/or modify it under the terms of version 2.1 of the
+  GNU Lesser General Public License as published by the Free
+  Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General
+  Public License along with this program; if not, write the
+  Free Software Foundation, Inc., 51 Franklin Street - Fifth
+  Floor, Boston MA 02110-1301, USA.
+
+*/
+
+
+/*  Byte size, alignment and flattened member layout
+    of types. Each type DIE is evaluated once per
+    Dwarf_Debug and remembered by offset, so the
+    typedef, qualifier and array chains shared by many
+    types and variables are followed only once. */
+
+#include <config.h>
+
+#include <stdlib.h> /* calloc() free() malloc() realloc() */
+#include <string.h> /* memcpy() memset() strlen() */
+
+#if defined(_WIN32) && defined(HAVE_STDAFX_H)
+#include "stdafx.h"
+#endif /* HAVE_STDAFX_H */
+
+#ifdef HAVE_STDINT_H
+#include <stdint.h> /* uintptr_t */
+#endif /* HAVE_STDINT_H */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "libdwarf_private.h"
+#include "dwarf_base_types.h"
+#include "dwarf_opaque.h"
+#include "dwarf_alloc.h"
+#include "dwarf_error.h"
+#include "dwarf_util.h"
+#include "dwarf_tsearch.h"
+#include "dwarf_type_layout.h"
+
+/*  Limits recursion through DW_AT_type and nested
+    aggregates, which also stops reference loops
+    in corrupt DWARF. */
+#define DW_TYPE_LAYOUT_DEPTH_MAX 64
+
+static DW_TSHASHTYPE
+layout_hashfunc(const void *keyp)
+{
+    const struct Dwarf_Type_Layout_s *enp = keyp;
+
+    return (DW_TSHASHTYPE)enp->tl_offset;
+}
+
+static int
+layout_compare(const void *l, const void *r)
+{
+    const struct Dwarf_Type_Layout_s *lp = l;
+    const struct Dwarf_Type_Layout_s *rp = r;
+
+    if (lp->tl_offset < rp->tl_offset) {
+        return -1;
+    }
+    if (lp->tl_offset > rp->tl_offset) {
+        return 1;
+    }
+    if (lp->tl_is_info < rp->tl_is_info) {
+        return -1;
+    }
+    if (lp->tl_is_info > rp->tl_is_info) {
+        return 1;
+    }
+    return 0;
+}
+
+static void
+free_layout_members(struct Dwarf_Type_Layout_s *tl)
+{
+    Dwarf_Unsigned i = 0;
+
+    for (i = 0; i < tl->tl_member_count; ++i) {
+        free(tl->tl_members[i].tm_name);
+    }
+    free(tl->tl_members);
+    tl->tl_members = 0;
+    tl->tl_member_count = 0;
+    tl->tl_member_alloc = 0;
+}
+
+static void
+layout_free_node(void *nodep)
+{
+    struct Dwarf_Type_Layout_s *tl = nodep;
+
+    free_layout_members(tl);
+    free(tl);
+}
+
+void
+_dwarf_destroy_type_layouts(Dwarf_Debug dbg)
+{
+    if (dbg->de_type_layout_tree) {
+        dwarf_tdestroy(dbg->de_type_layout_tree,
+            layout_free_node);
+        dbg->de_type_layout_tree = 0;
+    }
+}
+
+static Dwarf_Bool
+is_aggregate_tag(Dwarf_Half tag)
+{
+    return tag == DW_TAG_structure_type ||
+        tag == DW_TAG_class_type ||
+        tag == DW_TAG_union_type;
+}
+
+/*  Types that are just another type
+    by a different name or with qualifiers. */
+static Dwarf_Bool
+is_alias_tag(Dwarf_Half tag)
+{
+    switch (tag) {
+    case DW_TAG_typedef:
+    case DW_TAG_const_type:
+    case DW_TAG_volatile_type:
+    case DW_TAG_restrict_type:
+    case DW_TAG_atomic_type:
+    case DW_TAG_immutable_type:
+    case DW_TAG_packed_type:
+    case DW_TAG_shared_type:
+        return TRUE;
+    default:
+        break;
+    }
+    return FALSE;
+}
+
+/*  The largest power of two dividing size, the
+    natural alignment of a scalar of that size. */
+static Dwarf_Unsigned
+natural_alignment(Dwarf_Unsigned size)
+{
+    if (!size) {
+        return 1;
+    }
+    return size & (~size + 1);
+}
+
+static int
+get_type_ref(Dwarf_Die die,
+    Dwarf_Off  *offset_out,
+    Dwarf_Bool *is_info_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Attribute attr = 0;
+    int res = 0;
+
+    res = dwarf_attr(die,DW_AT_type,&attr,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_global_formref_b(attr,offset_out,
+        is_info_out,error);
+    dwarf_dealloc_attribute(attr);
+    return res;
+}
+
+/*  Returns DW_DLV_NO_ENTRY if the attribute is absent.
+    *is_const_out is FALSE if present but not a
+    constant (an expression or reference to a variable,
+    for example the bound of a variable length array). */
+static int
+get_const_attr(Dwarf_Die die,
+    Dwarf_Half attrnum,
+    Dwarf_Signed *val_out,
+    Dwarf_Bool   *is_const_out,
+    Dwarf_Error  *error)
+{
+    Dwarf_Attribute attr = 0;
+    Dwarf_Half form = 0;
+    int res = 0;
+
+    *is_const_out = FALSE;
+    res = dwarf_attr(die,attrnum,&attr,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_whatform(attr,&form,error);
+    if (res == DW_DLV_OK) {
+        switch (form) {
+        case DW_FORM_sdata:
+        case DW_FORM_implicit_const:
+            res = dwarf_formsdata(attr,val_out,error);
+            *is_const_out = (res == DW_DLV_OK);
+            break;
+        case DW_FORM_data1:
+        case DW_FORM_data2:
+        case DW_FORM_data4:
+        case DW_FORM_data8:
+        case DW_FORM_udata: {
+            Dwarf_Unsigned uval = 0;
+
+            res = dwarf_formudata(attr,&uval,error);
+            *val_out = (Dwarf_Signed)uval;
+            *is_const_out = (res == DW_DLV_OK);
+            }
+            break;
+        default:
+            break;
+        }
+    }
+    dwarf_dealloc_attribute(attr);
+    return res;
+}
+
+/*  The DW_AT_lower_bound to assume when absent,
+    from DWARF5 Table 7.17. */
+static int
+default_lower_bound(Dwarf_Debug dbg,
+    Dwarf_Die die,
+    Dwarf_Signed *lower_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Off cu_die_offset = 0;
+    Dwarf_Die cu_die = 0;
+    Dwarf_Unsigned lang = 0;
+    int res = 0;
+
+    *lower_out = 0;
+    res = dwarf_CU_dieoffset_given_die(die,&cu_die_offset,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_offdie_b(dbg,cu_die_offset,
+        die->di_cu_context->cc_is_info,&cu_die,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_srclang(cu_die,&lang,error);
+    dwarf_dealloc_die(cu_die);
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    switch (lang) {
+    case DW_LANG_Ada83:
+    case DW_LANG_Ada95:
+    case DW_LANG_Ada2005:
+    case DW_LANG_Ada2012:
+    case DW_LANG_Cobol74:
+    case DW_LANG_Cobol85:
+    case DW_LANG_Fortran77:
+    case DW_LANG_Fortran90:
+    case DW_LANG_Fortran95:
+    case DW_LANG_Fortran03:
+    case DW_LANG_Fortran08:
+    case DW_LANG_Fortran18:
+    case DW_LANG_Modula2:
+    case DW_LANG_Pascal83:
+    case DW_LANG_PLI:
+    case DW_LANG_Julia:
+        *lower_out = 1;
+        break;
+    default:
+        break;
+    }
+    return DW_DLV_OK;
+}
+
+/*  The number of elements of an array type, the
+    product over its subranges. *known_out is FALSE
+    when a bound is not a constant. */
+static int
+array_element_count(Dwarf_Debug dbg,
+    Dwarf_Die array_die,
+    Dwarf_Unsigned *count_out,
+    Dwarf_Bool     *known_out,
+    Dwarf_Error    *error)
+{
+    Dwarf_Die child = 0;
+    Dwarf_Unsigned total = 1;
+    int res = 0;
+
+    *known_out = FALSE;
+    res = dwarf_child(array_die,&child,error);
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    while (res == DW_DLV_OK) {
+        Dwarf_Die sib = 0;
+        Dwarf_Half tag = 0;
+
+        res = dwarf_tag(child,&tag,error);
+        if (res == DW_DLV_OK && tag == DW_TAG_subrange_type) {
+            Dwarf_Signed count = 0;
+            Dwarf_Signed upper = 0;
+            Dwarf_Signed lower = 0;
+            Dwarf_Bool is_const = FALSE;
+
+            res = get_const_attr(child,DW_AT_count,&count,
+                &is_const,error);
+            if (res == DW_DLV_NO_ENTRY) {
+                res = get_const_attr(child,DW_AT_upper_bound,
+                    &upper,&is_const,error);
+                if (res == DW_DLV_NO_ENTRY) {
+                    /*  A flexible array member
+                        occupies no space. */
+                    count = 0;
+                    is_const = TRUE;
+                    res = DW_DLV_OK;
+                } else if (res == DW_DLV_OK && is_const) {
+                    res = get_const_attr(child,
+                        DW_AT_lower_bound,&lower,
+                        &is_const,error);
+                    if (res == DW_DLV_NO_ENTRY) {
+                        res = default_lower_bound(dbg,child,
+                            &lower,error);
+                        is_const = TRUE;
+                    }
+                    count = (upper < lower)? 0:
+                        upper - lower + 1;
+                }
+            }
+            if (res == DW_DLV_OK && !is_const) {
+                dwarf_dealloc_die(child);
+                return DW_DLV_OK;
+            }
+            if (res == DW_DLV_OK) {
+                if (count < 0) {
+                    count = 0;
+                }
+                total *= (Dwarf_Unsigned)count;
+            }
+        }
+        if (res == DW_DLV_ERROR) {
+            dwarf_dealloc_die(child);
+            return res;
+        }
+        res = dwarf_siblingof_c(child,&sib,error);
+        dwarf_dealloc_die(child);
+        if (res == DW_DLV_ERROR) {
+            return res;
+        }
+        child = sib;
+    }
+    *count_out = total;
+    *known_out = TRUE;
+    return DW_DLV_OK;
+}
+
+static int get_type_rec(Dwarf_Debug dbg,
+    Dwarf_Die die,
+    Dwarf_Off offset,
+    Dwarf_Bool is_info,
+    int depth,
+    struct Dwarf_Type_Layout_s **out,
+    Dwarf_Error *error);
+
+/*  A type evaluated from target is only as
+    complete as target is. */
+static void
+note_target(struct Dwarf_Type_Layout_s *tl,
+    struct Dwarf_Type_Layout_s *target)
+{
+    if (target->tl_depth_limited || target->tl_busy) {
+        tl->tl_depth_limited = TRUE;
+    }
+}
+
+/*  Static data members and declarations take
+    no space in the containing type. */
+static int
+is_data_member(Dwarf_Die die,
+    Dwarf_Half *tag_out,
+    Dwarf_Bool *is_member_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Bool has = FALSE;
+    int res = 0;
+
+    *is_member_out = FALSE;
+    res = dwarf_tag(die,tag_out,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (*tag_out != DW_TAG_member &&
+        *tag_out != DW_TAG_inheritance) {
+        return DW_DLV_OK;
+    }
+    res = dwarf_hasattr(die,DW_AT_external,&has,error);
+    if (res != DW_DLV_OK || has) {
+        return res;
+    }
+    res = dwarf_hasattr(die,DW_AT_declaration,&has,error);
+    if (res != DW_DLV_OK || has) {
+        return res;
+    }
+    *is_member_out = TRUE;
+    return DW_DLV_OK;
+}
+
+/*  The alignment of a struct, class or union is
+    that of its most aligned member. */
+static int
+aggregate_alignment(Dwarf_Debug dbg,
+    Dwarf_Die die,
+    struct Dwarf_Type_Layout_s *tl,
+    int depth,
+    Dwarf_Unsigned *align_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Die child = 0;
+    Dwarf_Unsigned align = 1;
+    int res = 0;
+
+    res = dwarf_child(die,&child,error);
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    while (res == DW_DLV_OK) {
+        Dwarf_Die sib = 0;
+        Dwarf_Half tag = 0;
+        Dwarf_Bool is_member = FALSE;
+        Dwarf_Off  toff = 0;
+        Dwarf_Bool tis_info = FALSE;
+
+        res = is_data_member(child,&tag,&is_member,error);
+        if (res == DW_DLV_OK && is_member) {
+            res = get_type_ref(child,&toff,&tis_info,error);
+            if (res == DW_DLV_OK) {
+                struct Dwarf_Type_Layout_s *mt = 0;
+
+                res = get_type_rec(dbg,NULL,toff,tis_info,
+                    depth+1,&mt,error);
+                if (res == DW_DLV_OK) {
+                    note_target(tl,mt);
+                    if (mt->tl_size_known &&
+                        mt->tl_alignment > align) {
+                        align = mt->tl_alignment;
+                    }
+                }
+            }
+            if (res != DW_DLV_ERROR) {
+                /*  _Alignas or alignas on the member. */
+                Dwarf_Signed malign = 0;
+                Dwarf_Bool is_const = FALSE;
+
+                res = get_const_attr(child,DW_AT_alignment,
+                    &malign,&is_const,error);
+                if (res == DW_DLV_OK && is_const &&
+                    malign > 0 &&
+                    (Dwarf_Unsigned)malign > align) {
+                    align = (Dwarf_Unsigned)malign;
+                }
+            }
+            if (res == DW_DLV_NO_ENTRY) {
+                res = DW_DLV_OK;
+            }
+        }
+        if (res == DW_DLV_ERROR) {
+            dwarf_dealloc_die(child);
+            return res;
+        }
+        res = dwarf_siblingof_c(child,&sib,error);
+        dwarf_dealloc_die(child);
+        if (res == DW_DLV_ERROR) {
+            return res;
+        }
+        child = sib;
+    }
+    *align_out = align;
+    return DW_DLV_OK;
+}
+
+static int
+compute_type(Dwarf_Debug dbg,
+    Dwarf_Die die,
+    struct Dwarf_Type_Layout_s *tl,
+    int depth,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Type_Layout_s *target = 0;
+    Dwarf_Unsigned size = 0;
+    Dwarf_Signed  align = 0;
+    Dwarf_Bool    is_const = FALSE;
+    int res = 0;
+
+    res = dwarf_tag(die,&tl->tl_tag,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_bytesize(die,&size,error);
+    if (res == DW_DLV_NO_ENTRY) {
+        res = dwarf_bitsize(die,&size,error);
+        if (res == DW_DLV_OK) {
+            size = (size+7)/8;
+        }
+    }
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    if (res == DW_DLV_OK) {
+        tl->tl_size_known = TRUE;
+        tl->tl_byte_size = size;
+    }
+    res = get_type_ref(die,&tl->tl_target_offset,
+        &tl->tl_target_is_info,error);
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    tl->tl_has_target = (res == DW_DLV_OK);
+    if (depth >= DW_TYPE_LAYOUT_DEPTH_MAX) {
+        tl->tl_size_known = FALSE;
+        tl->tl_depth_limited = TRUE;
+        return DW_DLV_OK;
+    }
+
+    switch (tl->tl_tag) {
+    case DW_TAG_pointer_type:
+    case DW_TAG_reference_type:
+    case DW_TAG_rvalue_reference_type:
+        if (!tl->tl_size_known) {
+            tl->tl_byte_size =
+                die->di_cu_context->cc_address_size;
+            tl->tl_size_known = TRUE;
+        }
+        tl->tl_alignment = natural_alignment(tl->tl_byte_size);
+        break;
+    case DW_TAG_ptr_to_member_type:
+        /*  DW_AT_type is the member type, not this
+            pointer. The size depends on the ABI
+            (a pointer to member function is two
+            words with the Itanium C++ ABI), so
+            without DW_AT_byte_size it is unknown. */
+        if (tl->tl_size_known) {
+            tl->tl_alignment =
+                natural_alignment(tl->tl_byte_size);
+        }
+        break;
+    case DW_TAG_array_type:
+        if (tl->tl_has_target) {
+            res = get_type_rec(dbg,NULL,tl->tl_target_offset,
+                tl->tl_target_is_info,depth+1,&target,error);
+            if (res == DW_DLV_ERROR) {
+                return res;
+            }
+            if (target) {
+                note_target(tl,target);
+            }
+        }
+        if (!tl->tl_size_known && target &&
+            target->tl_size_known) {
+            Dwarf_Unsigned count = 0;
+            Dwarf_Bool known = FALSE;
+            Dwarf_Unsigned stride = 0;
+            Dwarf_Signed sstride = 0;
+
+            res = array_element_count(dbg,die,&count,
+                &known,error);
+            if (res != DW_DLV_OK) {
+                return res;
+            }
+            stride = target->tl_byte_size;
+            res = get_const_attr(die,DW_AT_byte_stride,&sstride,
+                &is_const,error);
+            if (res == DW_DLV_ERROR) {
+                return res;
+            }
+            if (res == DW_DLV_OK && is_const && sstride > 0) {
+                stride = (Dwarf_Unsigned)sstride;
+            }
+            if (known) {
+                tl->tl_byte_size = count * stride;
+                tl->tl_size_known = TRUE;
+            }
+        }
+        tl->tl_alignment = (target && target->tl_size_known)?
+            target->tl_alignment:1;
+        break;
+    case DW_TAG_structure_type:
+    case DW_TAG_class_type:
+    case DW_TAG_union_type:
+        if (tl->tl_size_known) {
+            res = aggregate_alignment(dbg,die,tl,depth,
+                &tl->tl_alignment,error);
+            if (res != DW_DLV_OK) {
+                return res;
+            }
+        }
+        break;
+    default:
+        if ((is_alias_tag(tl->tl_tag) ||
+            !tl->tl_size_known) && tl->tl_has_target) {
+            /*  typedef and qualifiers, an enumeration
+                without DW_AT_byte_size, or a member,
+                variable or parameter: the size is
+                that of DW_AT_type. */
+            res = get_type_rec(dbg,NULL,tl->tl_target_offset,
+                tl->tl_target_is_info,depth+1,&target,error);
+            if (res != DW_DLV_OK) {
+                return res;
+            }
+            note_target(tl,target);
+            if (!tl->tl_size_known) {
+                tl->tl_size_known = target->tl_size_known;
+                tl->tl_byte_size = target->tl_byte_size;
+            }
+            tl->tl_alignment = target->tl_alignment;
+        } else {
+            tl->tl_alignment =
+                natural_alignment(tl->tl_byte_size);
+        }
+        break;
+    }
+    res = get_const_attr(die,DW_AT_alignment,&align,
+        &is_const,error);
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    if (res == DW_DLV_OK && is_const && align > 0) {
+        tl->tl_alignment = (Dwarf_Unsigned)align;
+    }
+    return DW_DLV_OK;
+}
+
+/*  Copies the evaluated fields, not the key
+    or the member list. */
+static void
+copy_type_fields(struct Dwarf_Type_Layout_s *to,
+    struct Dwarf_Type_Layout_s *from)
+{
+    to->tl_tag = from->tl_tag;
+    to->tl_has_target = from->tl_has_target;
+    to->tl_target_offset = from->tl_target_offset;
+    to->tl_target_is_info = from->tl_target_is_info;
+    to->tl_size_known = from->tl_size_known;
+    to->tl_byte_size = from->tl_byte_size;
+    to->tl_alignment = from->tl_alignment;
+    to->tl_depth_limited = from->tl_depth_limited;
+    to->tl_depth = from->tl_depth;
+}
+
+static int
+get_type_rec(Dwarf_Debug dbg,
+    Dwarf_Die die,
+    Dwarf_Off offset,
+    Dwarf_Bool is_info,
+    int depth,
+    struct Dwarf_Type_Layout_s **out,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Type_Layout_s  key;
+    struct Dwarf_Type_Layout_s *tl = 0;
+    struct Dwarf_Type_Layout_s *re = 0;
+    Dwarf_Die localdie = 0;
+    void *found = 0;
+    int res = 0;
+
+    if (!dbg->de_type_layout_tree) {
+        dwarf_initialize_search_hash(&dbg->de_type_layout_tree,
+            layout_hashfunc,0);
+    }
+    memset(&key,0,sizeof(key));
+    key.tl_offset = offset;
+    key.tl_is_info = is_info;
+    found = dwarf_tfind(&key,&dbg->de_type_layout_tree,
+        layout_compare);
+    if (found) {
+        re = *(struct Dwarf_Type_Layout_s **)found;
+        if (!re->tl_depth_limited || re->tl_busy ||
+            depth >= re->tl_depth) {
+            *out = re;
+            return DW_DLV_OK;
+        }
+        /*  Cut off by the depth limit last time, and
+            we now start nearer the top: evaluate
+            again in place so pointers to the record
+            stay valid. */
+    }
+    if (!die) {
+        res = dwarf_offdie_b(dbg,offset,is_info,&localdie,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        die = localdie;
+    }
+    tl = (struct Dwarf_Type_Layout_s *)calloc(1,
+        sizeof(struct Dwarf_Type_Layout_s));
+    if (!tl) {
+        dwarf_dealloc_die(localdie);
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: allocating a type "
+            "layout record");
+        return DW_DLV_ERROR;
+    }
+    tl->tl_offset = offset;
+    tl->tl_is_info = is_info;
+    tl->tl_alignment = 1;
+    tl->tl_depth = depth;
+    if (re) {
+        re->tl_busy = TRUE;
+    }
+    res = compute_type(dbg,die,tl,depth,error);
+    dwarf_dealloc_die(localdie);
+    if (re) {
+        re->tl_busy = FALSE;
+    }
+    if (res != DW_DLV_OK) {
+        layout_free_node(tl);
+        return res;
+    }
+    if (!re) {
+        found = dwarf_tsearch(tl,&dbg->de_type_layout_tree,
+            layout_compare);
+        if (!found) {
+            layout_free_node(tl);
+            _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+                "DW_DLE_ALLOC_FAIL: inserting a type "
+                "layout record");
+            return DW_DLV_ERROR;
+        }
+        re = *(struct Dwarf_Type_Layout_s **)found;
+        if (re == tl) {
+            *out = tl;
+            return DW_DLV_OK;
+        }
+        /*  A reference loop got here first, keep
+            the record already in the tree. */
+    }
+    if (re->tl_depth_limited && (!tl->tl_depth_limited ||
+        tl->tl_depth < re->tl_depth)) {
+        copy_type_fields(re,tl);
+    }
+    layout_free_node(tl);
+    *out = re;
+    return DW_DLV_OK;
+}
+
+/*  Follows typedefs and qualifiers to the
+    underlying type. */
+static int
+strip_aliases(Dwarf_Debug dbg,
+    struct Dwarf_Type_Layout_s *tl,
+    int depth,
+    struct Dwarf_Type_Layout_s **out,
+    Dwarf_Error *error)
+{
+    int res = 0;
+
+    while (is_alias_tag(tl->tl_tag) && tl->tl_has_target) {
+        if (depth >= DW_TYPE_LAYOUT_DEPTH_MAX) {
+            return DW_DLV_NO_ENTRY;
+        }
+        res = get_type_rec(dbg,NULL,tl->tl_target_offset,
+            tl->tl_target_is_info,depth+1,&tl,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        ++depth;
+    }
+    *out = tl;
+    return DW_DLV_OK;
+}
+
+/*  DW_AT_data_member_location as a constant or as the
+    DWARF2 style DW_OP_plus_uconst or DW_OP_constu
+    expression. Anything else (virtual bases, or a
+    DWARF2/3 DW_FORM_data4/data8 which is a location
+    list offset) leaves *known_out FALSE. */
+static int
+get_member_location(Dwarf_Debug dbg,
+    Dwarf_Die die,
+    Dwarf_Unsigned *loc_out,
+    Dwarf_Bool *known_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Attribute attr = 0;
+    Dwarf_Half form = 0;
+    enum Dwarf_Form_Class fc = DW_FORM_CLASS_UNKNOWN;
+    Dwarf_Block *block = 0;
+    Dwarf_Small *expr = 0;
+    Dwarf_Unsigned exprlen = 0;
+    int res = 0;
+
+    *known_out = FALSE;
+    res = dwarf_attr(die,DW_AT_data_member_location,&attr,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_whatform(attr,&form,error);
+    if (res != DW_DLV_OK) {
+        dwarf_dealloc_attribute(attr);
+        return res;
+    }
+    switch (form) {
+    case DW_FORM_data4:
+    case DW_FORM_data8:
+        fc = dwarf_get_form_class(
+            die->di_cu_context->cc_version_stamp,
+            DW_AT_data_member_location,
+            die->di_cu_context->cc_length_size,form);
+        if (fc == DW_FORM_CLASS_LOCLIST ||
+            fc == DW_FORM_CLASS_LOCLISTPTR) {
+            break;
+        }
+        res = dwarf_formudata(attr,loc_out,error);
+        *known_out = (res == DW_DLV_OK);
+        break;
+    case DW_FORM_data1:
+    case DW_FORM_data2:
+    case DW_FORM_udata:
+    case DW_FORM_sdata:
+    case DW_FORM_implicit_const:
+        res = dwarf_formudata(attr,loc_out,error);
+        *known_out = (res == DW_DLV_OK);
+        break;
+    case DW_FORM_exprloc: {
+        Dwarf_Ptr ptr = 0;
+
+        res = dwarf_formexprloc(attr,&exprlen,&ptr,error);
+        expr = (Dwarf_Small *)ptr;
+        }
+        break;
+    case DW_FORM_block1:
+    case DW_FORM_block2:
+    case DW_FORM_block4:
+    case DW_FORM_block:
+        res = dwarf_formblock(attr,&block,error);
+        if (res == DW_DLV_OK) {
+            expr = (Dwarf_Small *)block->bl_data;
+            exprlen = block->bl_len;
+        }
+        break;
+    default:
+        break;
+    }
+    if (res == DW_DLV_OK && expr && exprlen > 1 &&
+        (expr[0] == DW_OP_plus_uconst ||
+        expr[0] == DW_OP_constu)) {
+        Dwarf_Unsigned leblen = 0;
+        Dwarf_Unsigned val = 0;
+
+        if (dwarf_decode_leb128((char *)expr+1,&leblen,&val,
+            (char *)expr+exprlen) == DW_DLV_OK &&
+            leblen + 1 == exprlen) {
+            *loc_out = val;
+            *known_out = TRUE;
+        }
+    }
+    if (block) {
+        dwarf_dealloc(dbg,block,DW_DLA_BLOCK);
+    }
+    dwarf_dealloc_attribute(attr);
+    return res;
+}
+
+static int
+add_member(Dwarf_Debug dbg,
+    struct Dwarf_Type_Layout_s *tl,
+    struct Dwarf_Type_Member_s *m,
+    const char *prefix,
+    const char *name,
+    Dwarf_Error *error)
+{
+    size_t prefixlen = prefix? strlen(prefix):0;
+    size_t namelen = name? strlen(name):0;
+    char *path = 0;
+
+    if (tl->tl_member_count >= tl->tl_member_alloc) {
+        struct Dwarf_Type_Member_s *newm = 0;
+        Dwarf_Unsigned newsize = tl->tl_member_alloc?
+            tl->tl_member_alloc*2:8;
+
+        newm = (struct Dwarf_Type_Member_s *)realloc(
+            tl->tl_members,
+            newsize*sizeof(struct Dwarf_Type_Member_s));
+        if (!newm) {
+            _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+                "DW_DLE_ALLOC_FAIL: growing a type "
+                "member layout");
+            return DW_DLV_ERROR;
+        }
+        tl->tl_members = newm;
+        tl->tl_member_alloc = newsize;
+    }
+    path = (char *)malloc(prefixlen + 1 + namelen + 1);
+    if (!path) {
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: allocating a type "
+            "member name");
+        return DW_DLV_ERROR;
+    }
+    path[0] = 0;
+    if (prefixlen) {
+        memcpy(path,prefix,prefixlen);
+        path[prefixlen] = 0;
+        if (namelen) {
+            path[prefixlen++] = '.';
+        }
+    }
+    memcpy(path+prefixlen,name? name:"",namelen+1);
+    m->tm_name = path;
+    tl->tl_members[tl->tl_member_count] = *m;
+    tl->tl_member_count++;
+    return DW_DLV_OK;
+}
+
+static int build_members(Dwarf_Debug dbg,
+    struct Dwarf_Type_Layout_s *tl,
+    int depth,
+    Dwarf_Error *error);
+
+/*  Fills tm_bit_offset and tm_bit_size from the DWARF4
+    DW_AT_data_bit_offset or the older DW_AT_bit_offset
+    form (counted from the most significant bit of the
+    storage unit). */
+static int
+member_bit_position(Dwarf_Debug dbg,
+    Dwarf_Die die,
+    struct Dwarf_Type_Member_s *m,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned loc = 0;
+    Dwarf_Bool known = FALSE;
+    Dwarf_Half bitattr = 0;
+    Dwarf_Unsigned bitoff = 0;
+    int res = 0;
+
+    res = dwarf_bitsize(die,&m->tm_bit_size,error);
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    res = dwarf_bitoffset(die,&bitattr,&bitoff,error);
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    if (res == DW_DLV_OK && bitattr == DW_AT_data_bit_offset) {
+        m->tm_bit_offset = bitoff;
+        m->tm_offset_known = TRUE;
+        return DW_DLV_OK;
+    }
+    res = get_member_location(dbg,die,&loc,&known,error);
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    if (res == DW_DLV_NO_ENTRY) {
+        /*  Union members, and the first member
+            with some producers, have no location. */
+        known = TRUE;
+        loc = 0;
+    }
+    if (!known) {
+        return DW_DLV_OK;
+    }
+    m->tm_offset_known = TRUE;
+    m->tm_bit_offset = loc * 8;
+    if (bitattr == DW_AT_bit_offset && m->tm_bit_size) {
+        Dwarf_Unsigned storage = m->tm_byte_size;
+
+        res = dwarf_bytesize(die,&storage,error);
+        if (res == DW_DLV_ERROR) {
+            return res;
+        }
+        if (dbg->de_big_endian_object) {
+            m->tm_bit_offset += bitoff;
+        } else if (storage*8 >= bitoff + m->tm_bit_size) {
+            m->tm_bit_offset += storage*8 - bitoff -
+                m->tm_bit_size;
+        }
+    }
+    return DW_DLV_OK;
+}
+
+/*  Appends the flattened layout of aggregate sub at
+    bit position base, below the member named prefix. */
+static int
+add_nested_members(Dwarf_Debug dbg,
+    struct Dwarf_Type_Layout_s *tl,
+    struct Dwarf_Type_Layout_s *sub,
+    Dwarf_Unsigned base,
+    const char *prefix,
+    Dwarf_Half depth,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned i = 0;
+    int res = 0;
+
+    for (i = 0; i < sub->tl_member_count; ++i) {
+        struct Dwarf_Type_Member_s m = sub->tl_members[i];
+
+        m.tm_depth = m.tm_depth + depth;
+        m.tm_bit_offset += base;
+        res = add_member(dbg,tl,&m,prefix,
+            sub->tl_members[i].tm_name,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+    }
+    return DW_DLV_OK;
+}
+
+static int
+add_one_member(Dwarf_Debug dbg,
+    struct Dwarf_Type_Layout_s *tl,
+    Dwarf_Die die,
+    Dwarf_Half tag,
+    int depth,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Type_Member_s m;
+    struct Dwarf_Type_Layout_s *mt = 0;
+    struct Dwarf_Type_Layout_s *sub = 0;
+    Dwarf_Bool tis_info = FALSE;
+    char *name = 0;
+    int res = 0;
+
+    memset(&m,0,sizeof(m));
+    m.tm_tag = tag;
+    res = dwarf_dieoffset(die,&m.tm_die_offset,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = get_type_ref(die,&m.tm_type_offset,&tis_info,error);
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    if (res == DW_DLV_OK) {
+        res = get_type_rec(dbg,NULL,m.tm_type_offset,tis_info,
+            depth+1,&mt,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        if (mt->tl_size_known) {
+            m.tm_byte_size = mt->tl_byte_size;
+        }
+        res = strip_aliases(dbg,mt,depth+1,&sub,error);
+        if (res == DW_DLV_ERROR) {
+            return res;
+        }
+        if (res == DW_DLV_NO_ENTRY ||
+            !is_aggregate_tag(sub->tl_tag) ||
+            !sub->tl_size_known) {
+            sub = 0;
+        }
+    }
+    res = member_bit_position(dbg,die,&m,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (tag == DW_TAG_inheritance) {
+        /*  Name a base class by its type name. */
+        Dwarf_Die tdie = 0;
+
+        if (mt && dwarf_offdie_b(dbg,mt->tl_offset,
+            mt->tl_is_info,&tdie,error) == DW_DLV_OK) {
+            res = dwarf_diename(tdie,&name,error);
+            dwarf_dealloc_die(tdie);
+        }
+    } else {
+        res = dwarf_diename(die,&name,error);
+    }
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    {
+        Dwarf_Unsigned base = m.tm_bit_offset;
+        Dwarf_Bool expand = sub && m.tm_offset_known &&
+            !m.tm_bit_size;
+        char *path = 0;
+        size_t namelen = 0;
+
+        res = add_member(dbg,tl,&m,NULL,name,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        if (!expand) {
+            return DW_DLV_OK;
+        }
+        res = build_members(dbg,sub,depth+1,error);
+        if (res == DW_DLV_NO_ENTRY) {
+            /*  sub contains itself, corrupt DWARF. */
+            return DW_DLV_OK;
+        }
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        /*  add_member() may move tl_members,
+            copy the path before appending more. */
+        namelen = strlen(
+            tl->tl_members[tl->tl_member_count-1].tm_name);
+        path = (char *)malloc(namelen+1);
+        if (!path) {
+            _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+                "DW_DLE_ALLOC_FAIL: copying a type "
+                "member name");
+            return DW_DLV_ERROR;
+        }
+        memcpy(path,tl->tl_members[tl->tl_member_count-1].tm_name,
+            namelen+1);
+        res = add_nested_members(dbg,tl,sub,base,
+            path,1,error);
+        free(path);
+        return res;
+    }
+}
+
+static int
+build_members(Dwarf_Debug dbg,
+    struct Dwarf_Type_Layout_s *tl,
+    int depth,
+    Dwarf_Error *error)
+{
+    Dwarf_Die die = 0;
+    Dwarf_Die child = 0;
+    int res = 0;
+
+    if (tl->tl_members_done) {
+        return DW_DLV_OK;
+    }
+    if (tl->tl_members_busy ||
+        depth >= DW_TYPE_LAYOUT_DEPTH_MAX) {
+        return DW_DLV_NO_ENTRY;
+    }
+    res = dwarf_offdie_b(dbg,tl->tl_offset,tl->tl_is_info,
+        &die,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_child(die,&child,error);
+    dwarf_dealloc_die(die);
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    tl->tl_members_busy = TRUE;
+    while (res == DW_DLV_OK) {
+        Dwarf_Die sib = 0;
+        Dwarf_Half tag = 0;
+        Dwarf_Bool is_member = FALSE;
+
+        res = is_data_member(child,&tag,&is_member,error);
+        if (res == DW_DLV_OK && is_member) {
+            res = add_one_member(dbg,tl,child,tag,depth,error);
+        }
+        if (res == DW_DLV_ERROR) {
+            dwarf_dealloc_die(child);
+            free_layout_members(tl);
+            tl->tl_members_busy = FALSE;
+            return res;
+        }
+        res = dwarf_siblingof_c(child,&sib,error);
+        dwarf_dealloc_die(child);
+        if (res == DW_DLV_ERROR) {
+            free_layout_members(tl);
+            tl->tl_members_busy = FALSE;
+            return res;
+        }
+        child = sib;
+    }
+    tl->tl_members_busy = FALSE;
+    tl->tl_members_done = TRUE;
+    return DW_DLV_OK;
+}
+
+int
+dwarf_type_size(Dwarf_Die die,
+    Dwarf_Unsigned *byte_size,
+    Dwarf_Unsigned *alignment,
+    Dwarf_Error    *error)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Off   offset = 0;
+    struct Dwarf_Type_Layout_s *tl = 0;
+    int res = 0;
+
+    CHECK_DIE(die, DW_DLV_ERROR);
+    dbg = die->di_cu_context->cc_dbg;
+    res = dwarf_dieoffset(die,&offset,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = get_type_rec(dbg,die,offset,die->di_is_info,
+        0,&tl,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (!tl->tl_size_known) {
+        return DW_DLV_NO_ENTRY;
+    }
+    if (byte_size) {
+        *byte_size = tl->tl_byte_size;
+    }
+    if (alignment) {
+        *alignment = tl->tl_alignment;
+    }
+    return DW_DLV_OK;
+}
+
+static int
+layout_of(Dwarf_Debug dbg,
+    Dwarf_Die die,
+    Dwarf_Off offset,
+    Dwarf_Bool is_info,
+    Dwarf_Type_Layout *layout_out,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Type_Layout_s *tl = 0;
+    int res = 0;
+
+    res = get_type_rec(dbg,die,offset,is_info,0,&tl,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = strip_aliases(dbg,tl,0,&tl,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (!is_aggregate_tag(tl->tl_tag) || !tl->tl_size_known) {
+        return DW_DLV_NO_ENTRY;
+    }
+    res = build_members(dbg,tl,0,error);
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    *layout_out = tl;
+    return DW_DLV_OK;
+}
+
+int
+dwarf_type_layout(Dwarf_Die die,
+    Dwarf_Type_Layout *layout_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Off offset = 0;
+    int res = 0;
+
+    CHECK_DIE(die, DW_DLV_ERROR);
+    if (!layout_out) {
+        _dwarf_error_string(die->di_cu_context->cc_dbg,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_type_layout() passed a NULL layout_out");
+        return DW_DLV_ERROR;
+    }
+    res = dwarf_dieoffset(die,&offset,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    return layout_of(die->di_cu_context->cc_dbg,die,offset,
+        die->di_is_info,layout_out,error);
+}
+
+int
+dwarf_type_layout_info(Dwarf_Type_Layout layout,
+    Dwarf_Off      *die_offset,
+    Dwarf_Bool     *is_info,
+    Dwarf_Unsigned *byte_size,
+    Dwarf_Unsigned *alignment,
+    Dwarf_Unsigned *member_count,
+    Dwarf_Error    *error)
+{
+    if (!layout) {
+        _dwarf_error_string(NULL,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "NULL Dwarf_Type_Layout passed in.");
+        return DW_DLV_ERROR;
+    }
+    if (die_offset) {
+        *die_offset = layout->tl_offset;
+    }
+    if (is_info) {
+        *is_info = layout->tl_is_info;
+    }
+    if (byte_size) {
+        *byte_size = layout->tl_byte_size;
+    }
+    if (alignment) {
+        *alignment = layout->tl_alignment;
+    }
+    if (member_count) {
+        *member_count = layout->tl_member_count;
+    }
+    return DW_DLV_OK;
+}
+
+int
+dwarf_type_layout_member(Dwarf_Type_Layout layout,
+    Dwarf_Unsigned  index,
+    const char    **name,
+    Dwarf_Half     *depth,
+    Dwarf_Off      *member_die_offset,
+    Dwarf_Off      *type_die_offset,
+    Dwarf_Bool     *offset_known,
+    Dwarf_Unsigned *bit_offset,
+    Dwarf_Unsigned *bit_size,
+    Dwarf_Unsigned *byte_size,
+    Dwarf_Error    *error)
+{
+    struct Dwarf_Type_Member_s *m = 0;
+
+    if (!layout) {
+        _dwarf_error_string(NULL,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "NULL Dwarf_Type_Layout passed in.");
+        return DW_DLV_ERROR;
+    }
+    if (index >= layout->tl_member_count) {
+        return DW_DLV_NO_ENTRY;
+    }
+    m = layout->tl_members + index;
+    if (name) {
+        *name = m->tm_name;
+    }
+    if (depth) {
+        *depth = m->tm_depth;
+    }
+    if (member_die_offset) {
+        *member_die_offset = m->tm_die_offset;
+    }
+    if (type_die_offset) {
+        *type_die_offset = m->tm_type_offset;
+    }
+    if (offset_known) {
+        *offset_known = m->tm_offset_known;
+    }
+    if (bit_offset) {
+        *bit_offset = m->tm_bit_offset;
+    }
+    if (bit_size) {
+        *bit_size = m->tm_bit_size;
+    }
+    if (byte_size) {
+        *byte_size = m->tm_byte_size;
+    }
+    return DW_DLV_OK;
+}
+
+int
+dwarf_cu_type_layouts(Dwarf_Die cu_die,
+    Dwarf_Type_Layout **layouts_out,
+    Dwarf_Unsigned *count_out,
+    Dwarf_Error *error)
+{
+    static const Dwarf_Half tags[3] = {
+        DW_TAG_structure_type,
+        DW_TAG_class_type,
+        DW_TAG_union_type };
+    static const Dwarf_Half attrs[1] = { DW_AT_byte_size };
+    Dwarf_Debug dbg = 0;
+    Dwarf_Die_Filter filter = 0;
+    Dwarf_Type_Layout *list = 0;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Unsigned alloc = 0;
+    Dwarf_Die die = 0;
+    int res = 0;
+
+    CHECK_DIE(cu_die, DW_DLV_ERROR);
+    dbg = cu_die->di_cu_context->cc_dbg;
+    if (!layouts_out || !count_out) {
+        _dwarf_error_string(dbg,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_cu_type_layouts() passed a NULL pointer");
+        return DW_DLV_ERROR;
+    }
+    /*  Only complete types have DW_AT_byte_size. */
+    res = dwarf_die_filter_create(dbg,tags,3,attrs,1,
+        &filter,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_die_filter_start(filter,cu_die,error);
+    while (res == DW_DLV_OK) {
+        Dwarf_Type_Layout tl = 0;
+        Dwarf_Off offset = 0;
+
+        res = dwarf_die_filter_next(filter,&die,NULL,error);
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        res = dwarf_dieoffset(die,&offset,error);
+        if (res == DW_DLV_OK) {
+            res = layout_of(dbg,die,offset,die->di_is_info,
+                &tl,error);
+        }
+        dwarf_dealloc_die(die);
+        if (res == DW_DLV_NO_ENTRY) {
+            res = DW_DLV_OK;
+            continue;
+        }
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        if (count >= alloc) {
+            Dwarf_Type_Layout *newlist = 0;
+            Dwarf_Unsigned newalloc = alloc? alloc*2:16;
+
+            newlist = (Dwarf_Type_Layout *)realloc(list,
+                newalloc*sizeof(Dwarf_Type_Layout));
+            if (!newlist) {
+                _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+                    "DW_DLE_ALLOC_FAIL: growing the "
+                    "dwarf_cu_type_layouts() list");
+                res = DW_DLV_ERROR;
+                break;
+            }
+            list = newlist;
+            alloc = newalloc;
+        }
+        list[count++] = tl;
+    }
+    dwarf_dealloc_die_filter(filter);
+    if (res == DW_DLV_ERROR) {
+        free(list);
+        return res;
+    }
+    if (!count) {
+        free(list);
+        return DW_DLV_NO_ENTRY;
+    }
+    *layouts_out = (Dwarf_Type_Layout *)_dwarf_get_alloc(dbg,
+        DW_DLA_LIST,count);
+    if (!*layouts_out) {
+        free(list);
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: allocating the "
+            "dwarf_cu_type_layouts() list");
+        return DW_DLV_ERROR;
+    }
+    memcpy(*layouts_out,list,count*sizeof(Dwarf_Type_Layout));
+    free(list);
+    *count_out = count;
+    return DW_DLV_OK;
+}
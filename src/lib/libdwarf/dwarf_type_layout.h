@@ -0,0 +1,100 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it
+  and/or modify it under the terms of version 2.1 of the
+  GNU Lesser General Public License as published by the Free
+  Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General
+  Public License along with this program; if not, write the
+  Free Software Foundation, Inc., 51 Franklin Street - Fifth
+  Floor, Boston MA 02110-1301, USA.
+
+*/
+
+
+#ifndef DWARF_TYPE_LAYOUT_H
+#define DWARF_TYPE_LAYOUT_H
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*  One entry of the flattened member list of a
+    struct, class or union. Members of members
+    that are themselves aggregates follow the
+    containing member with tm_depth one greater. */
+struct Dwarf_Type_Member_s {
+    /*  Dotted path from the outermost type, malloc space. */
+    char          *tm_name;
+    Dwarf_Half     tm_tag;   /* DW_TAG_member or DW_TAG_inheritance */
+    Dwarf_Half     tm_depth;
+    Dwarf_Off      tm_die_offset;
+    Dwarf_Off      tm_type_offset;
+    /*  Bits from the start of the outermost type.
+        Meaningless unless tm_offset_known, which
+        is FALSE for a virtual base class. */
+    Dwarf_Unsigned tm_bit_offset;
+    Dwarf_Bool     tm_offset_known;
+    /*  Non-zero only for a bit field. */
+    Dwarf_Unsigned tm_bit_size;
+    /*  Of the member type, zero if not known. */
+    Dwarf_Unsigned tm_byte_size;
+};
+
+/*  The memo of dwarf_type_size() and dwarf_type_layout(),
+    one per type DIE, in dbg->de_type_layout_tree.
+    The key is tl_offset and tl_is_info. */
+struct Dwarf_Type_Layout_s {
+    Dwarf_Off      tl_offset;
+    Dwarf_Bool     tl_is_info;
+    Dwarf_Half     tl_tag;
+
+    /*  Typedef, cv-qualifiers, arrays and pointers
+        refer to another type through DW_AT_type. */
+    Dwarf_Bool     tl_has_target;
+    Dwarf_Off      tl_target_offset;
+    Dwarf_Bool     tl_target_is_info;
+
+    Dwarf_Bool     tl_size_known;
+    Dwarf_Unsigned tl_byte_size;
+    Dwarf_Unsigned tl_alignment;
+
+    /*  TRUE if the depth limit cut off evaluation
+        of this type or a type it depends on, when
+        started at tl_depth. Such a record is
+        evaluated again by a lookup starting at a
+        lesser depth. tl_busy is set while the
+        record is being evaluated. */
+    Dwarf_Bool     tl_depth_limited;
+    int            tl_depth;
+    Dwarf_Bool     tl_busy;
+
+    /*  For struct, class and union, built on first
+        use by dwarf_type_layout(). */
+    Dwarf_Bool     tl_members_done;
+    Dwarf_Bool     tl_members_busy;
+    struct Dwarf_Type_Member_s *tl_members;
+    Dwarf_Unsigned tl_member_count;
+    Dwarf_Unsigned tl_member_alloc;
+};
+
+void _dwarf_destroy_type_layouts(Dwarf_Debug dbg);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* DWARF_TYPE_LAYOUT_H */
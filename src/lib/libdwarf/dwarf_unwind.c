@@ -0,0 +1,794 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it
+  and/or modify it under the terms of version 2.1 of the
+  GNU Lesser General Public License as published by the Free
+  Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General
+  Public License along with this program; if not, write the
+  Free Software Foundation, Inc., 51 Franklin Street - Fifth
+  Floor, Boston MA 02110-1301, USA.
+
+*/
+
+
+/*  Stack unwinding from the frame tables.
+    A Dwarf_Unwinder keeps each frame table row it has
+    used, reduced to the rules that differ from the
+    initial rule, in an array sorted by address so a
+    later frame at any pc in the row's range finds it
+    with a binary search instead of re-running the
+    CIE and FDE instructions. */
+
+#include <config.h>
+
+#include <stdlib.h> /* free() malloc() realloc() */
+#include <string.h> /* memcpy() memmove() memset() strchr() */
+
+#if defined(_WIN32) && defined(HAVE_STDAFX_H)
+#include "stdafx.h"
+#endif /* HAVE_STDAFX_H */
+
+#ifdef HAVE_STDINT_H
+#include <stdint.h> /* uintptr_t */
+#endif /* HAVE_STDINT_H */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "libdwarf_private.h"
+#include "dwarf_base_types.h"
+#include "dwarf_opaque.h"
+#include "dwarf_alloc.h"
+#include "dwarf_error.h"
+#include "dwarf_util.h"
+#include "dwarf_string.h"
+#include "dwarf_frame.h"
+#include "dwarf_expr_eval.h"
+#include "dwarf_unwind.h"
+
+void
+_dwarf_unwinder_destructor(void *m)
+{
+    Dwarf_Unwinder uw = (Dwarf_Unwinder)m;
+    Dwarf_Unsigned i = 0;
+
+    for (i = 0; i < uw->uw_row_count; ++i) {
+        free(uw->uw_rows[i]);
+    }
+    free(uw->uw_rows);
+    uw->uw_rows = 0;
+    uw->uw_row_count = 0;
+    uw->uw_last_row = 0;
+    free(uw->uw_regtable.rt3_rules);
+    uw->uw_regtable.rt3_rules = 0;
+    free(uw->uw_scratch_values);
+    uw->uw_scratch_values = 0;
+    free(uw->uw_scratch_valid);
+    uw->uw_scratch_valid = 0;
+}
+
+static Dwarf_Unsigned
+address_mask(Dwarf_Half address_size)
+{
+    if (address_size >= sizeof(Dwarf_Unsigned) ||
+        !address_size) {
+        return ~(Dwarf_Unsigned)0;
+    }
+    return ((Dwarf_Unsigned)1 << (address_size*8)) - 1;
+}
+
+static Dwarf_Bool
+register_value(Dwarf_Unwind_Regs *regs,
+    Dwarf_Unsigned reg,
+    Dwarf_Unsigned *value)
+{
+    if (reg >= regs->ur_reg_count || !regs->ur_valid[reg]) {
+        return FALSE;
+    }
+    *value = regs->ur_values[reg];
+    return TRUE;
+}
+
+/*  What the callbacks of a CFI expression
+    evaluation (dwarf_expr_evaluate()) see. */
+struct cfi_expr_data_s {
+    Dwarf_Unwinder     cx_uw;
+    void              *cx_user_data;
+    Dwarf_Unwind_Regs *cx_regs;
+};
+
+static int
+cfi_read_register(void *data, Dwarf_Unsigned reg,
+    Dwarf_Unsigned *value)
+{
+    struct cfi_expr_data_s *cx = (struct cfi_expr_data_s *)data;
+
+    return register_value(cx->cx_regs,reg,value)?
+        DW_DLV_OK:DW_DLV_NO_ENTRY;
+}
+
+static int
+cfi_read_memory(void *data, Dwarf_Addr addr,
+    Dwarf_Unsigned size, Dwarf_Unsigned *value)
+{
+    struct cfi_expr_data_s *cx = (struct cfi_expr_data_s *)data;
+
+    return cx->cx_uw->uw_read_memory(cx->cx_user_data,addr,
+        size,value);
+}
+
+/*  Evaluates a DW_CFA_def_cfa_expression,
+    DW_CFA_expression or DW_CFA_val_expression
+    block, the latter two with the CFA pushed first.
+    The compiled expression is kept in the rule
+    (and so in the row cache).
+    Returns DW_DLV_NO_ENTRY if a register or memory
+    the expression uses is not available. */
+static int
+eval_cfi_expression(Dwarf_Unwinder uw,
+    void *user_data,
+    struct Dwarf_Unwind_Rule_s *rule,
+    Dwarf_Half address_size,
+    Dwarf_Unwind_Regs *regs,
+    Dwarf_Bool push_cfa,
+    Dwarf_Addr cfa,
+    Dwarf_Unsigned *result,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug dbg = uw->uw_dbg;
+    struct cfi_expr_data_s cx;
+    Dwarf_Expr_Context ctx;
+    Dwarf_Expr_Piece piece;
+    Dwarf_Unsigned piece_count = 0;
+    int res = 0;
+
+    if (!rule->rl_program) {
+        res = _dwarf_expr_compile_bytes(dbg,rule->rl_expr,
+            rule->rl_expr_len,address_size,
+            dbg->de_length_size? dbg->de_length_size:4,
+            DW_CU_VERSION4,&rule->rl_program,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+    }
+    cx.cx_uw = uw;
+    cx.cx_user_data = user_data;
+    cx.cx_regs = regs;
+    memset(&ctx,0,sizeof(ctx));
+    ctx.ec_read_register = cfi_read_register;
+    ctx.ec_read_memory = cfi_read_memory;
+    ctx.ec_user_data = &cx;
+    ctx.ec_push_initial = push_cfa;
+    ctx.ec_initial_value = cfa;
+    res = dwarf_expr_evaluate(rule->rl_program,&ctx,&piece,1,
+        &piece_count,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (piece_count != 1 || piece.ep_kind != DW_EXPR_LOC_MEMORY) {
+        _dwarf_error_string(dbg,error,DW_DLE_LOC_EXPR_BAD,
+            "DW_DLE_LOC_EXPR_BAD: CFI expression "
+            "does not compute a single value");
+        return DW_DLV_ERROR;
+    }
+    *result = piece.ep_value;
+    return DW_DLV_OK;
+}
+
+static void
+copy_rule(struct Dwarf_Unwind_Rule_s *out,
+    Dwarf_Half column,
+    Dwarf_Regtable_Entry3 *in)
+{
+    out->rl_column = column;
+    out->rl_value_type = in->dw_value_type;
+    out->rl_offset_relevant = in->dw_offset_relevant;
+    out->rl_register = in->dw_regnum;
+    out->rl_offset = (Dwarf_Signed)in->dw_offset;
+    out->rl_expr = (Dwarf_Small *)in->dw_block.bl_data;
+    out->rl_expr_len = in->dw_block.bl_len;
+    out->rl_program = 0;
+}
+
+/*  The cached row covering pc, or NULL. */
+static struct Dwarf_Unwind_Row_s *
+find_cached_row(Dwarf_Unwinder uw, Dwarf_Addr pc)
+{
+    struct Dwarf_Unwind_Row_s *row = uw->uw_last_row;
+    Dwarf_Unsigned lo = 0;
+    Dwarf_Unsigned hi = uw->uw_row_count;
+
+    if (row && pc >= row->ro_low && pc < row->ro_high) {
+        return row;
+    }
+    /*  Find the first row with ro_low > pc. */
+    while (lo < hi) {
+        Dwarf_Unsigned mid = lo + (hi - lo)/2;
+
+        if (uw->uw_rows[mid]->ro_low <= pc) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (!lo) {
+        return NULL;
+    }
+    row = uw->uw_rows[lo-1];
+    if (pc >= row->ro_high) {
+        return NULL;
+    }
+    uw->uw_last_row = row;
+    return row;
+}
+
+static int
+insert_row(Dwarf_Unwinder uw,
+    struct Dwarf_Unwind_Row_s *row,
+    Dwarf_Error *error)
+{
+    Dwarf_Unsigned lo = 0;
+    Dwarf_Unsigned hi = uw->uw_row_count;
+
+    if (uw->uw_row_count >= uw->uw_row_alloc) {
+        struct Dwarf_Unwind_Row_s **newrows = 0;
+        Dwarf_Unsigned newalloc = uw->uw_row_alloc?
+            uw->uw_row_alloc*2:256;
+
+        newrows = (struct Dwarf_Unwind_Row_s **)realloc(
+            uw->uw_rows,
+            newalloc*sizeof(struct Dwarf_Unwind_Row_s *));
+        if (!newrows) {
+            _dwarf_error_string(uw->uw_dbg,error,DW_DLE_ALLOC_FAIL,
+                "DW_DLE_ALLOC_FAIL: growing the unwind "
+                "row cache");
+            return DW_DLV_ERROR;
+        }
+        uw->uw_rows = newrows;
+        uw->uw_row_alloc = newalloc;
+    }
+    while (lo < hi) {
+        Dwarf_Unsigned mid = lo + (hi - lo)/2;
+
+        if (uw->uw_rows[mid]->ro_low <= row->ro_low) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    memmove(uw->uw_rows+lo+1,uw->uw_rows+lo,
+        (size_t)(uw->uw_row_count-lo)*
+        sizeof(struct Dwarf_Unwind_Row_s *));
+    uw->uw_rows[lo] = row;
+    ++uw->uw_row_count;
+    uw->uw_last_row = row;
+    return DW_DLV_OK;
+}
+
+/*  Reads the frame table row for pc into the cache. */
+static int
+load_row(Dwarf_Unwinder uw, Dwarf_Addr pc,
+    struct Dwarf_Unwind_Row_s **row_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug dbg = uw->uw_dbg;
+    Dwarf_Fde fde = 0;
+    Dwarf_Cie cie = 0;
+    Dwarf_Addr lopc = 0;
+    Dwarf_Addr hipc = 0;
+    Dwarf_Addr row_pc = 0;
+    Dwarf_Bool has_more_rows = FALSE;
+    Dwarf_Addr subsequent_pc = 0;
+    Dwarf_Addr fde_end = 0;
+    struct Dwarf_Unwind_Row_s *row = 0;
+    Dwarf_Regtable_Entry3 *rules = uw->uw_regtable.rt3_rules;
+    Dwarf_Unsigned rule_count = 0;
+    Dwarf_Unsigned initial = dbg->de_frame_rule_initial_value;
+    Dwarf_Half i = 0;
+    int res = DW_DLV_NO_ENTRY;
+    int s = 0;
+
+    for (s = 0; s < 2 && res == DW_DLV_NO_ENTRY; ++s) {
+        if (!uw->uw_have_fdes[s]) {
+            continue;
+        }
+        res = dwarf_find_fde_at_pc(dbg,s == 1,pc,&fde,
+            &lopc,&hipc,error);
+    }
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_get_fde_info_for_all_regs3_b(fde,pc,
+        &uw->uw_regtable,&row_pc,&has_more_rows,
+        &subsequent_pc,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    for (i = 0; i < uw->uw_regtable.rt3_reg_table_size; ++i) {
+        if (rules[i].dw_value_type == DW_EXPR_OFFSET &&
+            !rules[i].dw_offset_relevant &&
+            rules[i].dw_regnum == initial) {
+            continue;
+        }
+        ++rule_count;
+    }
+    row = (struct Dwarf_Unwind_Row_s *)malloc(
+        sizeof(struct Dwarf_Unwind_Row_s) +
+        rule_count*sizeof(struct Dwarf_Unwind_Rule_s));
+    if (!row) {
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: allocating an unwind row");
+        return DW_DLV_ERROR;
+    }
+    memset(row,0,sizeof(*row));
+    row->ro_rules = (struct Dwarf_Unwind_Rule_s *)(row+1);
+    for (i = 0; i < uw->uw_regtable.rt3_reg_table_size; ++i) {
+        if (rules[i].dw_value_type == DW_EXPR_OFFSET &&
+            !rules[i].dw_offset_relevant &&
+            rules[i].dw_regnum == initial) {
+            continue;
+        }
+        copy_rule(row->ro_rules + row->ro_rule_count,i,
+            &rules[i]);
+        ++row->ro_rule_count;
+    }
+    copy_rule(&row->ro_cfa,0,&uw->uw_regtable.rt3_cfa_rule);
+
+    /*  hipc is the last byte of the FDE. */
+    fde_end = hipc + 1;
+    row->ro_low = row_pc <= pc? row_pc:pc;
+    row->ro_high = (has_more_rows && subsequent_pc > pc &&
+        subsequent_pc < fde_end)? subsequent_pc:fde_end;
+    if (row->ro_low < lopc) {
+        row->ro_low = lopc;
+    }
+    cie = fde->fd_cie;
+    row->ro_return_register = cie->ci_return_address_register;
+    row->ro_address_size = cie->ci_address_size?
+        cie->ci_address_size:dbg->de_pointer_size;
+    if (!row->ro_address_size) {
+        row->ro_address_size = sizeof(Dwarf_Addr);
+    }
+    /*  'S' follows 'z' in .eh_frame. GNU as writes
+        just "S" in .debug_frame. */
+    row->ro_signal_frame = cie->ci_augmentation &&
+        (cie->ci_augmentation[0] == 'z' ||
+        cie->ci_augmentation[0] == 'S') &&
+        strchr(cie->ci_augmentation,'S') != 0;
+    res = insert_row(uw,row,error);
+    if (res != DW_DLV_OK) {
+        free(row);
+        return res;
+    }
+    *row_out = row;
+    return DW_DLV_OK;
+}
+
+/*  Applies one register rule. Leaves the caller's
+    register unknown if a value it needs is. */
+static int
+apply_rule(Dwarf_Unwinder uw,
+    void *user_data,
+    struct Dwarf_Unwind_Row_s *row,
+    struct Dwarf_Unwind_Rule_s *rule,
+    Dwarf_Addr cfa,
+    Dwarf_Unwind_Regs *callee,
+    Dwarf_Unwind_Regs *caller,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug dbg = uw->uw_dbg;
+    Dwarf_Unsigned column = rule->rl_column;
+    Dwarf_Unsigned mask = address_mask(row->ro_address_size);
+    Dwarf_Unsigned value = 0;
+    Dwarf_Bool known = FALSE;
+    int res = DW_DLV_OK;
+
+    if (column >= caller->ur_reg_count) {
+        return DW_DLV_OK;
+    }
+    switch (rule->rl_value_type) {
+    case DW_EXPR_OFFSET:
+        if (rule->rl_offset_relevant) {
+            /* offset(N): saved at CFA+N */
+            res = uw->uw_read_memory(user_data,
+                (cfa + (Dwarf_Unsigned)rule->rl_offset) & mask,
+                row->ro_address_size,&value);
+            known = res == DW_DLV_OK;
+        } else if (rule->rl_register ==
+            dbg->de_frame_same_value_number) {
+            known = register_value(callee,column,&value);
+        } else if (rule->rl_register ==
+            dbg->de_frame_undefined_value_number) {
+            known = FALSE;
+        } else {
+            /* register(R) */
+            known = register_value(callee,rule->rl_register,
+                &value);
+        }
+        break;
+    case DW_EXPR_VAL_OFFSET:
+        value = (cfa + (Dwarf_Unsigned)rule->rl_offset) & mask;
+        known = TRUE;
+        break;
+    case DW_EXPR_EXPRESSION:
+    case DW_EXPR_VAL_EXPRESSION:
+        res = eval_cfi_expression(uw,user_data,rule,
+            row->ro_address_size,callee,
+            TRUE,cfa,&value,error);
+        if (res == DW_DLV_ERROR) {
+            return res;
+        }
+        known = res == DW_DLV_OK;
+        if (known && rule->rl_value_type == DW_EXPR_EXPRESSION) {
+            res = uw->uw_read_memory(user_data,value,
+                row->ro_address_size,&value);
+            known = res == DW_DLV_OK;
+        }
+        break;
+    default:
+        known = FALSE;
+        break;
+    }
+    caller->ur_valid[column] = known? 1:0;
+    caller->ur_values[column] = known? value:0;
+    return DW_DLV_OK;
+}
+
+static int
+unwind_step(Dwarf_Unwinder uw,
+    void *user_data,
+    Dwarf_Unwind_Regs *callee,
+    Dwarf_Unwind_Regs *caller,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug dbg = uw->uw_dbg;
+    struct Dwarf_Unwind_Row_s *row = 0;
+    struct Dwarf_Unwind_Rule_s *cfa_rule = 0;
+    Dwarf_Addr pc = callee->ur_pc;
+    Dwarf_Addr cfa = 0;
+    Dwarf_Unsigned ra = 0;
+    Dwarf_Unsigned i = 0;
+    Dwarf_Bool sp_has_rule = FALSE;
+    Dwarf_Bool copy_callee = FALSE;
+    int res = 0;
+
+    if (callee->ur_pc_is_return_address && pc) {
+        /*  The call may be the last instruction of
+            its function, so look up the call itself. */
+        --pc;
+    }
+    row = find_cached_row(uw,pc);
+    if (!row) {
+        res = load_row(uw,pc,&row,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+    }
+
+    cfa_rule = &row->ro_cfa;
+    if (cfa_rule->rl_value_type == DW_EXPR_EXPRESSION) {
+        res = eval_cfi_expression(uw,user_data,cfa_rule,
+            row->ro_address_size,callee,
+            FALSE,0,&cfa,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+    } else if (cfa_rule->rl_value_type == DW_EXPR_OFFSET) {
+        if (!register_value(callee,cfa_rule->rl_register,&cfa)) {
+            return DW_DLV_NO_ENTRY;
+        }
+        if (cfa_rule->rl_offset_relevant) {
+            cfa = (cfa + (Dwarf_Unsigned)cfa_rule->rl_offset) &
+                address_mask(row->ro_address_size);
+        }
+    } else {
+        _dwarf_error_string(dbg,error,DW_DLE_DF_FRAME_DECODING_ERROR,
+            "DW_DLE_DF_FRAME_DECODING_ERROR: the CFA rule "
+            "is neither register+offset nor an expression");
+        return DW_DLV_ERROR;
+    }
+
+    /*  Registers without a rule of their own follow
+        the initial rule. */
+    copy_callee = dbg->de_frame_rule_initial_value ==
+        dbg->de_frame_same_value_number;
+    for (i = 0; i < caller->ur_reg_count; ++i) {
+        if (copy_callee && i < callee->ur_reg_count) {
+            caller->ur_valid[i] = callee->ur_valid[i];
+            caller->ur_values[i] = callee->ur_values[i];
+        } else {
+            caller->ur_valid[i] = 0;
+            caller->ur_values[i] = 0;
+        }
+    }
+    for (i = 0; i < row->ro_rule_count; ++i) {
+        struct Dwarf_Unwind_Rule_s *rule = row->ro_rules + i;
+
+        if (rule->rl_column == uw->uw_sp_register &&
+            !(rule->rl_value_type == DW_EXPR_OFFSET &&
+            !rule->rl_offset_relevant &&
+            (rule->rl_register == dbg->de_frame_same_value_number ||
+            rule->rl_register ==
+                dbg->de_frame_undefined_value_number))) {
+            sp_has_rule = TRUE;
+        }
+        res = apply_rule(uw,user_data,row,rule,cfa,
+            callee,caller,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+    }
+    if (!sp_has_rule && uw->uw_sp_register < caller->ur_reg_count) {
+        caller->ur_valid[uw->uw_sp_register] = 1;
+        caller->ur_values[uw->uw_sp_register] = cfa;
+    }
+    if (!register_value(caller,row->ro_return_register,&ra) ||
+        !ra) {
+        /*  The return address is undefined (or not
+            available): there is no caller to unwind to. */
+        return DW_DLV_NO_ENTRY;
+    }
+    caller->ur_pc = ra;
+    caller->ur_pc_is_return_address = !row->ro_signal_frame;
+    caller->ur_cfa = cfa;
+    return DW_DLV_OK;
+}
+
+static int
+check_regs(Dwarf_Debug dbg, Dwarf_Unwind_Regs *regs,
+    const char *fname, Dwarf_Error *error)
+{
+    if (!regs || (regs->ur_reg_count &&
+        (!regs->ur_values || !regs->ur_valid))) {
+        dwarfstring m;
+
+        dwarfstring_constructor(&m);
+        dwarfstring_append_printf_s(&m,
+            "DW_DLE_INVALID_NULL_ARGUMENT: %s passed "
+            "a NULL Dwarf_Unwind_Regs or register array",
+            (char *)fname);
+        _dwarf_error_string(dbg,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            dwarfstring_string(&m));
+        dwarfstring_destructor(&m);
+        return DW_DLV_ERROR;
+    }
+    return DW_DLV_OK;
+}
+
+int
+dwarf_unwinder_create(Dwarf_Debug dbg,
+    dwarf_unwind_read_memory_type read_memory,
+    Dwarf_Unsigned  sp_register,
+    Dwarf_Unwinder *unwinder_out,
+    Dwarf_Error    *error)
+{
+    Dwarf_Unwinder uw = 0;
+    Dwarf_Unsigned reg_count = 0;
+    int res = 0;
+    int s = 0;
+
+    CHECK_DBG(dbg,error,"dwarf_unwinder_create()");
+    if (!read_memory || !unwinder_out) {
+        _dwarf_error_string(dbg,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_unwinder_create() passed a NULL "
+            "read_memory function or unwinder_out");
+        return DW_DLV_ERROR;
+    }
+    uw = (Dwarf_Unwinder)_dwarf_get_alloc(dbg,
+        DW_DLA_UNWINDER,1);
+    if (!uw) {
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: allocating a Dwarf_Unwinder");
+        return DW_DLV_ERROR;
+    }
+    uw->uw_dbg = dbg;
+    uw->uw_read_memory = read_memory;
+    uw->uw_sp_register = sp_register;
+    uw->uw_magic = DW_UNWINDER_MAGIC;
+
+    for (s = 0; s < 2; ++s) {
+        struct Dwarf_Fde_Index_s *index = 0;
+
+        res = _dwarf_load_fde_index(dbg,s == 1,&index,error);
+        if (res == DW_DLV_ERROR) {
+            break;
+        }
+        uw->uw_have_fdes[s] = (res == DW_DLV_OK);
+    }
+    if (res != DW_DLV_ERROR) {
+        /*  One of the two sections is enough. */
+        res = (uw->uw_have_fdes[0] || uw->uw_have_fdes[1])?
+            DW_DLV_OK:DW_DLV_NO_ENTRY;
+    }
+    if (res != DW_DLV_OK) {
+        dwarf_dealloc_unwinder(uw);
+        return res;
+    }
+
+    reg_count = dbg->de_frame_reg_rules_entry_count;
+    if (reg_count > 0xffff) {
+        /*  Dwarf_Regtable3 cannot hold more. */
+        reg_count = 0xffff;
+    }
+    uw->uw_regtable.rt3_reg_table_size = (Dwarf_Half)reg_count;
+    uw->uw_regtable.rt3_rules = (Dwarf_Regtable_Entry3 *)calloc(
+        reg_count ? reg_count:1,sizeof(Dwarf_Regtable_Entry3));
+    if (!uw->uw_regtable.rt3_rules) {
+        dwarf_dealloc_unwinder(uw);
+        _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+            "DW_DLE_ALLOC_FAIL: allocating the register "
+            "table of a Dwarf_Unwinder");
+        return DW_DLV_ERROR;
+    }
+    *unwinder_out = uw;
+    return DW_DLV_OK;
+}
+
+int
+dwarf_unwind_step(Dwarf_Unwinder uw,
+    void              *user_data,
+    Dwarf_Unwind_Regs *callee,
+    Dwarf_Unwind_Regs *caller,
+    Dwarf_Error       *error)
+{
+    Dwarf_Debug dbg = 0;
+    int res = 0;
+
+    if (!uw || uw->uw_magic != DW_UNWINDER_MAGIC) {
+        _dwarf_error_string(NULL,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_unwind_step() passed a NULL or "
+            "stale Dwarf_Unwinder");
+        return DW_DLV_ERROR;
+    }
+    dbg = uw->uw_dbg;
+    CHECK_DBG(dbg,error,"dwarf_unwind_step()");
+    res = check_regs(dbg,callee,"dwarf_unwind_step()",error);
+    if (res == DW_DLV_OK) {
+        res = check_regs(dbg,caller,"dwarf_unwind_step()",error);
+    }
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (callee == caller || (callee->ur_reg_count &&
+        (callee->ur_values == caller->ur_values ||
+        callee->ur_valid == caller->ur_valid))) {
+        _dwarf_error_string(dbg,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_unwind_step() callee and caller "
+            "registers must not be the same");
+        return DW_DLV_ERROR;
+    }
+    return unwind_step(uw,user_data,callee,caller,error);
+}
+
+int
+dwarf_unwind_stack(Dwarf_Unwinder uw,
+    void              *user_data,
+    Dwarf_Unwind_Regs *regs,
+    Dwarf_Addr        *pcs,
+    Dwarf_Unsigned     max_frames,
+    Dwarf_Unsigned    *frame_count_out,
+    Dwarf_Error       *error)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Unwind_Regs caller;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Addr prev_cfa = 0;
+    Dwarf_Bool have_prev_cfa = FALSE;
+    int res = 0;
+
+    if (!uw || uw->uw_magic != DW_UNWINDER_MAGIC) {
+        _dwarf_error_string(NULL,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_unwind_stack() passed a NULL or "
+            "stale Dwarf_Unwinder");
+        return DW_DLV_ERROR;
+    }
+    dbg = uw->uw_dbg;
+    CHECK_DBG(dbg,error,"dwarf_unwind_stack()");
+    res = check_regs(dbg,regs,"dwarf_unwind_stack()",error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (!frame_count_out || (max_frames && !pcs)) {
+        _dwarf_error_string(dbg,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_unwind_stack() passed a NULL pcs "
+            "array or frame_count_out");
+        return DW_DLV_ERROR;
+    }
+    if (uw->uw_scratch_count < regs->ur_reg_count) {
+        Dwarf_Unsigned *values = 0;
+        Dwarf_Small *valid = 0;
+
+        values = (Dwarf_Unsigned *)malloc(
+            regs->ur_reg_count*sizeof(Dwarf_Unsigned));
+        valid = (Dwarf_Small *)malloc(regs->ur_reg_count);
+        if (!values || !valid) {
+            free(values);
+            free(valid);
+            _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+                "DW_DLE_ALLOC_FAIL: allocating unwind "
+                "scratch registers");
+            return DW_DLV_ERROR;
+        }
+        free(uw->uw_scratch_values);
+        free(uw->uw_scratch_valid);
+        uw->uw_scratch_values = values;
+        uw->uw_scratch_valid = valid;
+        uw->uw_scratch_count = regs->ur_reg_count;
+    }
+    memset(&caller,0,sizeof(caller));
+    caller.ur_reg_count = regs->ur_reg_count;
+    caller.ur_values = uw->uw_scratch_values;
+    caller.ur_valid = uw->uw_scratch_valid;
+    while (count < max_frames) {
+        pcs[count++] = regs->ur_pc;
+        if (count == max_frames) {
+            break;
+        }
+        res = unwind_step(uw,user_data,regs,&caller,error);
+        if (res == DW_DLV_ERROR) {
+            return res;
+        }
+        if (res == DW_DLV_NO_ENTRY) {
+            break;
+        }
+        if (have_prev_cfa && caller.ur_pc == regs->ur_pc &&
+            caller.ur_cfa == prev_cfa) {
+            /*  No progress: a loop in the frame tables
+                or in the captured stack. */
+            break;
+        }
+        prev_cfa = caller.ur_cfa;
+        have_prev_cfa = TRUE;
+        regs->ur_pc = caller.ur_pc;
+        regs->ur_pc_is_return_address =
+            caller.ur_pc_is_return_address;
+        regs->ur_cfa = caller.ur_cfa;
+        if (regs->ur_reg_count) {
+            memcpy(regs->ur_values,caller.ur_values,
+                regs->ur_reg_count*sizeof(Dwarf_Unsigned));
+            memcpy(regs->ur_valid,caller.ur_valid,
+                regs->ur_reg_count);
+        }
+    }
+    *frame_count_out = count;
+    return DW_DLV_OK;
+}
+
+void
+dwarf_dealloc_unwinder(Dwarf_Unwinder uw)
+{
+    Dwarf_Debug dbg = 0;
+
+    if (!uw || uw->uw_magic != DW_UNWINDER_MAGIC) {
+        return;
+    }
+    dbg = uw->uw_dbg;
+    uw->uw_magic = 0;
+    dwarf_dealloc(dbg,uw,DW_DLA_UNWINDER);
+}
@@ -0,0 +1,97 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it
+  and/or modify it under the terms of version 2.1 of the
+  GNU Lesser General Public License as published by the Free
+  Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General
+  Public License along with this program; if not, write the
+  Free Software Foundation, Inc., 51 Franklin Street - Fifth
+  Floor, Boston MA 02110-1301, USA.
+
+*/
+
+#ifndef DWARF_UNWIND_H
+#define DWARF_UNWIND_H
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+#define DW_UNWINDER_MAGIC 0xcf1a
+
+/*  One register rule of a cached row. Only rules
+    that differ from the initial rule
+    (de_frame_rule_initial_value) are kept. */
+struct Dwarf_Unwind_Rule_s {
+    Dwarf_Half     rl_column;
+    Dwarf_Small    rl_value_type;
+    Dwarf_Small    rl_offset_relevant;
+    Dwarf_Unsigned rl_register;
+    Dwarf_Signed   rl_offset;
+    Dwarf_Small   *rl_expr;
+    Dwarf_Unsigned rl_expr_len;
+    /*  rl_expr compiled, on first use. */
+    Dwarf_Expr_Program rl_program;
+};
+
+/*  A frame table row valid for the pc range
+    [ro_low,ro_high). The rules follow the row
+    in the same malloc. */
+struct Dwarf_Unwind_Row_s {
+    Dwarf_Addr     ro_low;
+    Dwarf_Addr     ro_high;
+    struct Dwarf_Unwind_Rule_s ro_cfa;
+    Dwarf_Unsigned ro_return_register;
+    Dwarf_Half     ro_address_size;
+    /*  The CIE has the 'S' augmentation. */
+    Dwarf_Bool     ro_signal_frame;
+    Dwarf_Unsigned ro_rule_count;
+    struct Dwarf_Unwind_Rule_s *ro_rules;
+};
+
+struct Dwarf_Unwinder_s {
+    Dwarf_Half     uw_magic;
+    Dwarf_Debug    uw_dbg;
+    dwarf_unwind_read_memory_type uw_read_memory;
+    Dwarf_Unsigned uw_sp_register;
+
+    /*  Which of .debug_frame and .eh_frame have FDEs.
+        FDEs are found with dwarf_find_fde_at_pc(). */
+    Dwarf_Bool     uw_have_fdes[2];
+
+    /*  Used to read a row on a cache miss. */
+    Dwarf_Regtable3 uw_regtable;
+
+    /*  The row cache, sorted by ro_low. */
+    struct Dwarf_Unwind_Row_s **uw_rows;
+    Dwarf_Unsigned uw_row_count;
+    Dwarf_Unsigned uw_row_alloc;
+    struct Dwarf_Unwind_Row_s *uw_last_row;
+
+    /*  dwarf_unwind_stack() works in these. */
+    Dwarf_Unsigned *uw_scratch_values;
+    Dwarf_Small    *uw_scratch_valid;
+    Dwarf_Half      uw_scratch_count;
+};
+
+void _dwarf_unwinder_destructor(void *m);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* DWARF_UNWIND_H */
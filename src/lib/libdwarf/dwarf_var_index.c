@@ -0,0 +1,721 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it
+  and/or modify it under the terms of version 2.1 of the
+  GNU Lesser General Public License as published by the Free
+  Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General
+  Public License along with this program; if not, write the
+  Free Software Foundation, Inc., 51 Franklin Street - Fifth
+  Floor, Boston MA 02110-1301, USA.
+
+*/
+
+/*  Which variables and parameters of a function are
+    live at a pc, and where. The DIE tree of the
+    subprogram and its location lists are read once
+    into an array of pc intervals, so a lookup is a
+    binary search. */
+
+#include <config.h>
+
+#include <stdlib.h> /* free() qsort() realloc() */
+#include <string.h> /* memset() */
+
+#if defined(_WIN32) && defined(HAVE_STDAFX_H)
+#include "stdafx.h"
+#endif /* HAVE_STDAFX_H */
+
+#ifdef HAVE_STDINT_H
+#include <stdint.h> /* uintptr_t */
+#endif /* HAVE_STDINT_H */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "libdwarf_private.h"
+#include "dwarf_base_types.h"
+#include "dwarf_opaque.h"
+#include "dwarf_alloc.h"
+#include "dwarf_error.h"
+#include "dwarf_util.h"
+#include "dwarf_loc.h"
+#include "dwarf_tsearch.h"
+#include "dwarf_var_index.h"
+
+/*  Limits the nesting of lexical blocks and
+    inlined subroutines followed. */
+#define DW_VAR_INDEX_DEPTH_MAX 64
+
+/*  The pc ranges of a scope, [sr_low,sr_high). */
+struct scope_range_s {
+    Dwarf_Addr sr_low;
+    Dwarf_Addr sr_high;
+};
+
+struct scope_ranges_s {
+    struct scope_range_s *sc_ranges;
+    Dwarf_Unsigned sc_count;
+    Dwarf_Unsigned sc_alloc;
+};
+
+static DW_TSHASHTYPE
+var_index_hashfunc(const void *keyp)
+{
+    const struct Dwarf_Var_Index_s *vx = keyp;
+
+    return (DW_TSHASHTYPE)vx->vx_offset;
+}
+
+static int
+var_index_compare(const void *l, const void *r)
+{
+    const struct Dwarf_Var_Index_s *lp = l;
+    const struct Dwarf_Var_Index_s *rp = r;
+
+    if (lp->vx_offset < rp->vx_offset) {
+        return -1;
+    }
+    if (lp->vx_offset > rp->vx_offset) {
+        return 1;
+    }
+    if (lp->vx_is_info < rp->vx_is_info) {
+        return -1;
+    }
+    if (lp->vx_is_info > rp->vx_is_info) {
+        return 1;
+    }
+    return 0;
+}
+
+static void
+var_index_free_node(void *nodep)
+{
+    struct Dwarf_Var_Index_s *vx = nodep;
+
+    free(vx->vx_entries);
+    free(vx);
+}
+
+void
+_dwarf_destroy_var_indexes(Dwarf_Debug dbg)
+{
+    if (dbg->de_var_index_tree) {
+        dwarf_tdestroy(dbg->de_var_index_tree,
+            var_index_free_node);
+        dbg->de_var_index_tree = 0;
+    }
+}
+
+static int
+var_index_alloc_error(Dwarf_Debug dbg, Dwarf_Error *error)
+{
+    _dwarf_error_string(dbg,error,DW_DLE_ALLOC_FAIL,
+        "DW_DLE_ALLOC_FAIL: building a variable index");
+    return DW_DLV_ERROR;
+}
+
+static int
+add_scope_range(Dwarf_Debug dbg,
+    struct scope_ranges_s *sc,
+    Dwarf_Addr low,
+    Dwarf_Addr high,
+    Dwarf_Error *error)
+{
+    if (low >= high) {
+        return DW_DLV_OK;
+    }
+    if (sc->sc_count >= sc->sc_alloc) {
+        Dwarf_Unsigned newalloc = sc->sc_alloc? sc->sc_alloc*2:4;
+        struct scope_range_s *newr = (struct scope_range_s *)
+            realloc(sc->sc_ranges,
+            newalloc*sizeof(struct scope_range_s));
+
+        if (!newr) {
+            return var_index_alloc_error(dbg,error);
+        }
+        sc->sc_ranges = newr;
+        sc->sc_alloc = newalloc;
+    }
+    sc->sc_ranges[sc->sc_count].sr_low = low;
+    sc->sc_ranges[sc->sc_count].sr_high = high;
+    ++sc->sc_count;
+    return DW_DLV_OK;
+}
+
+/*  The pc ranges of a subprogram, lexical block or
+    inlined subroutine. DW_DLV_NO_ENTRY if it has none,
+    as for a declaration or an abstract instance. */
+static int
+get_scope_ranges(Dwarf_Debug dbg,
+    Dwarf_Die die,
+    struct scope_ranges_s *sc,
+    Dwarf_Error *error)
+{
+    Dwarf_Range_Iter iter;
+    Dwarf_Addr low = 0;
+    Dwarf_Addr high = 0;
+    int res = 0;
+
+    sc->sc_count = 0;
+    res = dwarf_die_ranges_start(die,&iter,error);
+    while (res == DW_DLV_OK) {
+        res = dwarf_die_ranges_next(&iter,&low,&high,error);
+        if (res == DW_DLV_OK) {
+            res = add_scope_range(dbg,sc,low,high,error);
+        }
+    }
+    if (res == DW_DLV_ERROR && error &&
+        dwarf_errno(*error) ==
+        DW_DLE_MISSING_NEEDED_DEBUG_ADDR_SECTION) {
+        /*  A .dwo without its executable: the
+            addresses are not known. */
+        dwarf_dealloc_error(dbg,*error);
+        *error = 0;
+        return DW_DLV_NO_ENTRY;
+    }
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    return sc->sc_count? DW_DLV_OK:DW_DLV_NO_ENTRY;
+}
+
+static int
+add_entry(Dwarf_Debug dbg,
+    struct Dwarf_Var_Index_s *vx,
+    Dwarf_Addr low,
+    Dwarf_Addr high,
+    Dwarf_Off die_offset,
+    Dwarf_Half tag,
+    Dwarf_Locdesc_c locdesc,
+    Dwarf_Expr_Program program,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Var_Entry_s *e = 0;
+
+    if (low >= high) {
+        return DW_DLV_OK;
+    }
+    if (vx->vx_entry_count >= vx->vx_entry_alloc) {
+        Dwarf_Unsigned newalloc = vx->vx_entry_alloc?
+            vx->vx_entry_alloc*2:16;
+        struct Dwarf_Var_Entry_s *newe =
+            (struct Dwarf_Var_Entry_s *)realloc(vx->vx_entries,
+            newalloc*sizeof(struct Dwarf_Var_Entry_s));
+
+        if (!newe) {
+            return var_index_alloc_error(dbg,error);
+        }
+        vx->vx_entries = newe;
+        vx->vx_entry_alloc = newalloc;
+    }
+    e = vx->vx_entries + vx->vx_entry_count++;
+    memset(e,0,sizeof(*e));
+    e->ve_low = low;
+    e->ve_high = high;
+    e->ve_die_offset = die_offset;
+    e->ve_tag = tag;
+    e->ve_expr = locdesc->ld_opsblock.bl_data;
+    e->ve_expr_len = e->ve_expr? locdesc->ld_opsblock.bl_len:0;
+    e->ve_program = program;
+    return DW_DLV_OK;
+}
+
+/*  Entries that carry no location: the list end
+    and base address selections. DW_LLE_default_location
+    applies wherever no other entry does and is left
+    out as well. */
+static Dwarf_Bool
+is_location_entry(unsigned lkind, Dwarf_Small lle)
+{
+    if (lkind == DW_LKIND_GNU_exp_list) {
+        return lle != DW_LLEX_end_of_list_entry &&
+            lle != DW_LLEX_base_address_selection_entry;
+    }
+    return lle != DW_LLE_end_of_list &&
+        lle != DW_LLE_base_address &&
+        lle != DW_LLE_base_addressx &&
+        lle != DW_LLE_default_location;
+}
+
+static int
+add_variable(Dwarf_Debug dbg,
+    struct Dwarf_Var_Index_s *vx,
+    Dwarf_Die die,
+    Dwarf_Half tag,
+    struct scope_ranges_s *scope,
+    Dwarf_Error *error)
+{
+    Dwarf_Attribute attr = 0;
+    Dwarf_Loc_Head_c head = 0;
+    Dwarf_Unsigned count = 0;
+    unsigned lkind = 0;
+    Dwarf_Off die_offset = 0;
+    Dwarf_Unsigned i = 0;
+    int res = 0;
+
+    res = dwarf_attr(die,DW_AT_location,&attr,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_get_loclist_c(attr,&head,&count,error);
+    dwarf_dealloc_attribute(attr);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_get_loclist_head_kind(head,&lkind,error);
+    if (res == DW_DLV_OK) {
+        res = dwarf_dieoffset(die,&die_offset,error);
+    }
+    for (i = 0; i < count && res == DW_DLV_OK; ++i) {
+        Dwarf_Small lle = 0;
+        Dwarf_Unsigned rawlow = 0;
+        Dwarf_Unsigned rawhigh = 0;
+        Dwarf_Bool unavailable = FALSE;
+        Dwarf_Addr low = 0;
+        Dwarf_Addr high = 0;
+        Dwarf_Unsigned opcount = 0;
+        Dwarf_Locdesc_c locdesc = 0;
+        Dwarf_Small source = 0;
+        Dwarf_Unsigned expr_offset = 0;
+        Dwarf_Unsigned locdesc_offset = 0;
+        Dwarf_Expr_Program program = 0;
+        Dwarf_Error compile_error = 0;
+
+        res = dwarf_get_locdesc_entry_d(head,i,&lle,
+            &rawlow,&rawhigh,&unavailable,&low,&high,
+            &opcount,&locdesc,&source,&expr_offset,
+            &locdesc_offset,error);
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        if (lkind != DW_LKIND_expression &&
+            (unavailable || !is_location_entry(lkind,lle))) {
+            continue;
+        }
+        res = dwarf_expr_compile(locdesc,&program,&compile_error);
+        if (res == DW_DLV_ERROR) {
+            /*  The location is still reported, with
+                no program: the caller sees it is in
+                scope even if it cannot be evaluated. */
+            dwarf_dealloc_error(dbg,compile_error);
+            program = 0;
+        }
+        res = DW_DLV_OK;
+        if (lkind == DW_LKIND_expression) {
+            Dwarf_Unsigned r = 0;
+
+            for (r = 0; r < scope->sc_count && res == DW_DLV_OK;
+                ++r) {
+                res = add_entry(dbg,vx,scope->sc_ranges[r].sr_low,
+                    scope->sc_ranges[r].sr_high,die_offset,tag,
+                    locdesc,program,error);
+            }
+        } else {
+            res = add_entry(dbg,vx,low,high,die_offset,tag,
+                locdesc,program,error);
+        }
+    }
+    dwarf_dealloc_loc_head_c(head);
+    return res;
+}
+
+/*  Adds the variables and parameters that are children
+    of die, whose pc ranges are scope, and descends
+    into its lexical blocks and inlined subroutines. */
+static int
+add_scope(Dwarf_Debug dbg,
+    struct Dwarf_Var_Index_s *vx,
+    Dwarf_Die die,
+    struct scope_ranges_s *scope,
+    int depth,
+    Dwarf_Error *error)
+{
+    Dwarf_Die child = 0;
+    int res = 0;
+
+    if (depth >= DW_VAR_INDEX_DEPTH_MAX) {
+        return DW_DLV_OK;
+    }
+    res = dwarf_child(die,&child,error);
+    if (res == DW_DLV_NO_ENTRY) {
+        return DW_DLV_OK;
+    }
+    while (res == DW_DLV_OK) {
+        Dwarf_Die sib = 0;
+        Dwarf_Half tag = 0;
+
+        res = dwarf_tag(child,&tag,error);
+        if (res == DW_DLV_OK) {
+            switch (tag) {
+            case DW_TAG_variable:
+            case DW_TAG_formal_parameter:
+                res = add_variable(dbg,vx,child,tag,scope,error);
+                break;
+            case DW_TAG_lexical_block:
+            case DW_TAG_inlined_subroutine: {
+                struct scope_ranges_s inner;
+
+                memset(&inner,0,sizeof(inner));
+                res = get_scope_ranges(dbg,child,&inner,error);
+                if (res == DW_DLV_OK) {
+                    res = add_scope(dbg,vx,child,&inner,
+                        depth+1,error);
+                } else if (res == DW_DLV_NO_ENTRY) {
+                    /*  A block with no pc range of its own
+                        is part of the enclosing one. */
+                    res = add_scope(dbg,vx,child,scope,
+                        depth+1,error);
+                }
+                free(inner.sc_ranges);
+                }
+                break;
+            default:
+                /*  Not nested subprograms: they are
+                    functions of their own. */
+                break;
+            }
+        }
+        if (res == DW_DLV_NO_ENTRY) {
+            res = DW_DLV_OK;
+        }
+        if (res != DW_DLV_OK) {
+            dwarf_dealloc_die(child);
+            return res;
+        }
+        res = dwarf_siblingof_c(child,&sib,error);
+        dwarf_dealloc_die(child);
+        child = sib;
+    }
+    if (res == DW_DLV_ERROR) {
+        return res;
+    }
+    return DW_DLV_OK;
+}
+
+static int
+var_entry_compare(const void *l, const void *r)
+{
+    const struct Dwarf_Var_Entry_s *lp = l;
+    const struct Dwarf_Var_Entry_s *rp = r;
+
+    if (lp->ve_low != rp->ve_low) {
+        return lp->ve_low < rp->ve_low? -1:1;
+    }
+    if (lp->ve_high != rp->ve_high) {
+        return lp->ve_high < rp->ve_high? -1:1;
+    }
+    if (lp->ve_die_offset != rp->ve_die_offset) {
+        return lp->ve_die_offset < rp->ve_die_offset? -1:1;
+    }
+    return 0;
+}
+
+static int
+build_var_index(Dwarf_Debug dbg,
+    Dwarf_Die die,
+    struct Dwarf_Var_Index_s *vx,
+    Dwarf_Error *error)
+{
+    struct scope_ranges_s scope;
+    Dwarf_Addr max_high = 0;
+    Dwarf_Unsigned i = 0;
+    int res = 0;
+
+    memset(&scope,0,sizeof(scope));
+    res = get_scope_ranges(dbg,die,&scope,error);
+    if (res == DW_DLV_OK) {
+        res = add_scope(dbg,vx,die,&scope,0,error);
+    }
+    free(scope.sc_ranges);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (vx->vx_entry_count > 1) {
+        qsort(vx->vx_entries,vx->vx_entry_count,
+            sizeof(struct Dwarf_Var_Entry_s),var_entry_compare);
+    }
+    for (i = 0; i < vx->vx_entry_count; ++i) {
+        struct Dwarf_Var_Entry_s *e = vx->vx_entries + i;
+
+        if (e->ve_high > max_high) {
+            max_high = e->ve_high;
+        }
+        e->ve_max_high = max_high;
+    }
+    return DW_DLV_OK;
+}
+
+int
+dwarf_var_index(Dwarf_Die die,
+    Dwarf_Var_Index *index_out,
+    Dwarf_Error *error)
+{
+    Dwarf_Debug dbg = 0;
+    struct Dwarf_Var_Index_s key;
+    struct Dwarf_Var_Index_s *vx = 0;
+    Dwarf_Half tag = 0;
+    void *found = 0;
+    int res = 0;
+
+    CHECK_DIE(die, DW_DLV_ERROR);
+    dbg = die->di_cu_context->cc_dbg;
+    if (!index_out) {
+        _dwarf_error_string(dbg,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_var_index() passed a NULL index_out");
+        return DW_DLV_ERROR;
+    }
+    res = dwarf_tag(die,&tag,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    if (tag != DW_TAG_subprogram) {
+        return DW_DLV_NO_ENTRY;
+    }
+    memset(&key,0,sizeof(key));
+    res = dwarf_dieoffset(die,&key.vx_offset,error);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    key.vx_is_info = die->di_is_info;
+    if (!dbg->de_var_index_tree) {
+        dwarf_initialize_search_hash(&dbg->de_var_index_tree,
+            var_index_hashfunc,0);
+    }
+    found = dwarf_tfind(&key,&dbg->de_var_index_tree,
+        var_index_compare);
+    if (found) {
+        *index_out = *(struct Dwarf_Var_Index_s **)found;
+        return DW_DLV_OK;
+    }
+    vx = (struct Dwarf_Var_Index_s *)calloc(1,
+        sizeof(struct Dwarf_Var_Index_s));
+    if (!vx) {
+        return var_index_alloc_error(dbg,error);
+    }
+    vx->vx_offset = key.vx_offset;
+    vx->vx_is_info = key.vx_is_info;
+    res = build_var_index(dbg,die,vx,error);
+    if (res != DW_DLV_OK) {
+        var_index_free_node(vx);
+        return res;
+    }
+    found = dwarf_tsearch(vx,&dbg->de_var_index_tree,
+        var_index_compare);
+    if (!found) {
+        var_index_free_node(vx);
+        return var_index_alloc_error(dbg,error);
+    }
+    *index_out = vx;
+    return DW_DLV_OK;
+}
+
+int
+dwarf_var_index_info(Dwarf_Var_Index vx,
+    Dwarf_Off      *die_offset,
+    Dwarf_Bool     *is_info,
+    Dwarf_Unsigned *entry_count,
+    Dwarf_Error    *error)
+{
+    if (!vx) {
+        _dwarf_error_string(NULL,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "NULL Dwarf_Var_Index passed in.");
+        return DW_DLV_ERROR;
+    }
+    if (die_offset) {
+        *die_offset = vx->vx_offset;
+    }
+    if (is_info) {
+        *is_info = vx->vx_is_info;
+    }
+    if (entry_count) {
+        *entry_count = vx->vx_entry_count;
+    }
+    return DW_DLV_OK;
+}
+
+int
+dwarf_var_index_entry(Dwarf_Var_Index vx,
+    Dwarf_Unsigned      index,
+    Dwarf_Off          *die_offset,
+    Dwarf_Half         *tag,
+    Dwarf_Addr         *lowpc,
+    Dwarf_Addr         *highpc,
+    Dwarf_Small       **expr,
+    Dwarf_Unsigned     *expr_len,
+    Dwarf_Expr_Program *program,
+    Dwarf_Error        *error)
+{
+    struct Dwarf_Var_Entry_s *e = 0;
+
+    if (!vx) {
+        _dwarf_error_string(NULL,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "NULL Dwarf_Var_Index passed in.");
+        return DW_DLV_ERROR;
+    }
+    if (index >= vx->vx_entry_count) {
+        return DW_DLV_NO_ENTRY;
+    }
+    e = vx->vx_entries + index;
+    if (die_offset) {
+        *die_offset = e->ve_die_offset;
+    }
+    if (tag) {
+        *tag = e->ve_tag;
+    }
+    if (lowpc) {
+        *lowpc = e->ve_low;
+    }
+    if (highpc) {
+        *highpc = e->ve_high;
+    }
+    if (expr) {
+        *expr = e->ve_expr;
+    }
+    if (expr_len) {
+        *expr_len = e->ve_expr_len;
+    }
+    if (program) {
+        *program = e->ve_program;
+    }
+    return DW_DLV_OK;
+}
+
+/*  The number of entries with ve_low <= pc,
+    searching from 'from' (all entries before it
+    are known to qualify). */
+static Dwarf_Unsigned
+entries_starting_by(struct Dwarf_Var_Index_s *vx,
+    Dwarf_Addr pc, Dwarf_Unsigned from)
+{
+    Dwarf_Unsigned low = from;
+    Dwarf_Unsigned high = vx->vx_entry_count;
+
+    while (low < high) {
+        Dwarf_Unsigned middle = low + (high - low)/2;
+
+        if (vx->vx_entries[middle].ve_low <= pc) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+/*  Stores the indexes of the entries live at pc,
+    ascending, starting at entries[first] (as far as
+    max allows), and returns how many there are.
+    end is the number of entries with ve_low <= pc. */
+static Dwarf_Unsigned
+entries_at_pc(struct Dwarf_Var_Index_s *vx,
+    Dwarf_Addr pc,
+    Dwarf_Unsigned end,
+    Dwarf_Unsigned *entries,
+    Dwarf_Unsigned first,
+    Dwarf_Unsigned max)
+{
+    Dwarf_Unsigned start = end;
+    Dwarf_Unsigned n = 0;
+    Dwarf_Unsigned i = 0;
+
+    /*  No entry before start reaches pc. */
+    while (start > 0 && vx->vx_entries[start-1].ve_max_high > pc) {
+        --start;
+    }
+    for (i = start; i < end; ++i) {
+        if (vx->vx_entries[i].ve_high > pc) {
+            if (first + n < max) {
+                entries[first + n] = i;
+            }
+            ++n;
+        }
+    }
+    return n;
+}
+
+int
+dwarf_var_index_at_pc(Dwarf_Var_Index vx,
+    Dwarf_Addr      pc,
+    Dwarf_Unsigned *entries,
+    Dwarf_Unsigned  max_entries,
+    Dwarf_Unsigned *entry_count,
+    Dwarf_Error    *error)
+{
+    Dwarf_Unsigned end = 0;
+    Dwarf_Unsigned n = 0;
+
+    if (!vx || !entry_count || (max_entries && !entries)) {
+        _dwarf_error_string(NULL,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_var_index_at_pc() passed a NULL index, "
+            "entries or entry count");
+        return DW_DLV_ERROR;
+    }
+    end = entries_starting_by(vx,pc,0);
+    n = entries_at_pc(vx,pc,end,entries,0,max_entries);
+    if (!n) {
+        return DW_DLV_NO_ENTRY;
+    }
+    *entry_count = n;
+    return DW_DLV_OK;
+}
+
+int
+dwarf_var_index_at_pcs(Dwarf_Var_Index vx,
+    const Dwarf_Addr *pcs,
+    Dwarf_Unsigned    pc_count,
+    Dwarf_Unsigned   *entries,
+    Dwarf_Unsigned    max_entries,
+    Dwarf_Unsigned   *first_entry,
+    Dwarf_Error      *error)
+{
+    Dwarf_Unsigned total = 0;
+    Dwarf_Unsigned end = 0;
+    Dwarf_Unsigned p = 0;
+
+    if (!vx || !first_entry || (pc_count && !pcs) ||
+        (max_entries && !entries)) {
+        _dwarf_error_string(NULL,error,
+            DW_DLE_INVALID_NULL_ARGUMENT,
+            "DW_DLE_INVALID_NULL_ARGUMENT: "
+            "dwarf_var_index_at_pcs() passed a NULL index, "
+            "pcs, entries or first_entry");
+        return DW_DLV_ERROR;
+    }
+    for (p = 0; p < pc_count; ++p) {
+        /*  For ascending pcs the search resumes where
+            the previous one ended. */
+        if (p && pcs[p] >= pcs[p-1]) {
+            end = entries_starting_by(vx,pcs[p],end);
+        } else {
+            end = entries_starting_by(vx,pcs[p],0);
+        }
+        first_entry[p] = total;
+        total += entries_at_pc(vx,pcs[p],end,entries,total,
+            max_entries);
+    }
+    first_entry[pc_count] = total;
+    return DW_DLV_OK;
+}
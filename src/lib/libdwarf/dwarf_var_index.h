@@ -0,0 +1,72 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it
+  and/or modify it under the terms of version 2.1 of the
+  GNU Lesser General Public License as published by the Free
+  Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General
+  Public License along with this program; if not, write the
+  Free Software Foundation, Inc., 51 Franklin Street - Fifth
+  Floor, Boston MA 02110-1301, USA.
+
+*/
+
+#ifndef DWARF_VAR_INDEX_H
+#define DWARF_VAR_INDEX_H
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/*  A variable or parameter with one location
+    over the pc range [ve_low,ve_high). A location
+    list contributes one entry per list entry, a single
+    location one per pc range of its enclosing scope. */
+struct Dwarf_Var_Entry_s {
+    Dwarf_Addr     ve_low;
+    Dwarf_Addr     ve_high;
+    /*  The largest ve_high of this and all earlier
+        entries, so a pc lookup knows when to stop
+        scanning back. */
+    Dwarf_Addr     ve_max_high;
+    Dwarf_Off      ve_die_offset;
+    Dwarf_Half     ve_tag;
+    /*  The expression bytes, in section data. */
+    Dwarf_Small   *ve_expr;
+    Dwarf_Unsigned ve_expr_len;
+    /*  NULL if the expression did not compile. */
+    Dwarf_Expr_Program ve_program;
+};
+
+/*  The memo of dwarf_var_index(), one per subprogram
+    DIE, in dbg->de_var_index_tree.
+    The key is vx_offset and vx_is_info. */
+struct Dwarf_Var_Index_s {
+    Dwarf_Off      vx_offset;
+    Dwarf_Bool     vx_is_info;
+    /*  Sorted by ve_low then ve_high. */
+    struct Dwarf_Var_Entry_s *vx_entries;
+    Dwarf_Unsigned vx_entry_count;
+    Dwarf_Unsigned vx_entry_alloc;
+};
+
+void _dwarf_destroy_var_indexes(Dwarf_Debug dbg);
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* DWARF_VAR_INDEX_H */
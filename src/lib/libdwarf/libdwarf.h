@@ -533,6 +533,138 @@ typedef struct Dwarf_Regtable3_s {
     struct Dwarf_Regtable_Entry3_s * rt3_rules;
 } Dwarf_Regtable3;
 
+/*! @typedef Dwarf_Unwind_Regs
+    The register values of one stack frame, for
+    dwarf_unwind_step() and dwarf_unwind_stack().
+    The application allocates ur_values and ur_valid,
+    each of ur_reg_count entries indexed by DWARF
+    register (frame table column) number.
+    A register whose ur_valid entry is zero has
+    an unknown value.
+
+    ur_pc_is_return_address is zero for the frame
+    a sample starts in and non-zero when ur_pc is a
+    return address (the address after a call) so that
+    the frame table row for the call is used.
+    ur_cfa is set by dwarf_unwind_step() in the
+    caller's registers to the CFA of the frame
+    that was unwound.
+*/
+typedef struct Dwarf_Unwind_Regs_s {
+    Dwarf_Addr      ur_pc;
+    Dwarf_Bool      ur_pc_is_return_address;
+    Dwarf_Addr      ur_cfa;
+    Dwarf_Half      ur_reg_count;
+    Dwarf_Unsigned *ur_values;
+    Dwarf_Small    *ur_valid;
+} Dwarf_Unwind_Regs;
+
+/*! @typedef dwarf_unwind_read_memory_type
+    A user-written function reading dw_size
+    (1 to 8) bytes of target memory at dw_addr
+    for dwarf_unwind_step(), returning the value,
+    in host byte order, through dw_value.
+    dw_user_data is as passed to dwarf_unwind_step().
+    It returns DW_DLV_OK or, if the memory is not
+    available (for example not captured with the
+    sample), DW_DLV_NO_ENTRY.
+*/
+typedef int (*dwarf_unwind_read_memory_type)(void *dw_user_data,
+    Dwarf_Addr      dw_addr,
+    Dwarf_Unsigned  dw_size,
+    Dwarf_Unsigned *dw_value);
+
+/*  The ep_kind of a Dwarf_Expr_Piece
+    set by dwarf_expr_evaluate(). */
+/*  ep_value is the address of the object. */
+#define DW_EXPR_LOC_MEMORY           1
+/*  ep_value is the DWARF register number holding the object. */
+#define DW_EXPR_LOC_REGISTER         2
+/*  ep_value is the value of the object (DW_OP_stack_value). */
+#define DW_EXPR_LOC_VALUE            3
+/*  ep_data and ep_data_len are the bytes of the
+    object (DW_OP_implicit_value). */
+#define DW_EXPR_LOC_IMPLICIT         4
+/*  ep_value is the .debug_info offset of the DIE
+    the object points to and ep_offset the byte offset
+    within it (DW_OP_implicit_pointer). */
+#define DW_EXPR_LOC_IMPLICIT_POINTER 5
+/*  The object (or this piece of it) was optimized out. */
+#define DW_EXPR_LOC_EMPTY            6
+
+/*! @typedef Dwarf_Expr_Piece
+    The location (or value) of an object, or of one piece
+    of it, as computed by dwarf_expr_evaluate().
+    ep_size_bits is zero unless the expression
+    uses DW_OP_piece or DW_OP_bit_piece.
+    ep_data points into the compiled expression and
+    is valid until dwarf_finish().
+*/
+typedef struct Dwarf_Expr_Piece_s {
+    Dwarf_Small     ep_kind;
+    Dwarf_Unsigned  ep_value;
+    Dwarf_Signed    ep_offset;
+    Dwarf_Small    *ep_data;
+    Dwarf_Unsigned  ep_data_len;
+    Dwarf_Unsigned  ep_size_bits;
+    Dwarf_Unsigned  ep_bit_offset;
+} Dwarf_Expr_Piece;
+
+/*! @typedef dwarf_expr_read_register_type
+    A user-written function returning the value of
+    DWARF register dw_regnum through dw_value
+    for dwarf_expr_evaluate().
+    It returns DW_DLV_OK or, if the register
+    is not available, DW_DLV_NO_ENTRY.
+*/
+typedef int (*dwarf_expr_read_register_type)(void *dw_user_data,
+    Dwarf_Unsigned  dw_regnum,
+    Dwarf_Unsigned *dw_value);
+
+/*! @typedef dwarf_expr_get_value_type
+    A user-written function returning the frame base,
+    the CFA or the object address (as the
+    Dwarf_Expr_Context field says) through dw_value
+    for dwarf_expr_evaluate().
+    It returns DW_DLV_OK or DW_DLV_NO_ENTRY.
+*/
+typedef int (*dwarf_expr_get_value_type)(void *dw_user_data,
+    Dwarf_Unsigned *dw_value);
+
+/*! @typedef dwarf_expr_tls_address_type
+    A user-written function returning, through
+    dw_address, the address in the current thread of
+    the thread-local storage offset dw_offset
+    (DW_OP_form_tls_address).
+    It returns DW_DLV_OK or DW_DLV_NO_ENTRY.
+*/
+typedef int (*dwarf_expr_tls_address_type)(void *dw_user_data,
+    Dwarf_Unsigned  dw_offset,
+    Dwarf_Unsigned *dw_address);
+
+/*! @typedef Dwarf_Expr_Context
+    How dwarf_expr_evaluate() gets at the target.
+    Any function pointer may be NULL, an operation
+    needing it then makes the value unavailable.
+    ec_read_memory is the same kind of function
+    dwarf_unwinder_create() takes.
+    dw_user_data of each function is ec_user_data.
+    If ec_push_initial is non-zero ec_initial_value
+    is pushed before evaluation, as
+    DW_AT_data_member_location needs.
+*/
+typedef struct Dwarf_Expr_Context_s {
+    dwarf_expr_read_register_type ec_read_register;
+    dwarf_unwind_read_memory_type ec_read_memory;
+    dwarf_expr_get_value_type     ec_frame_base;
+    dwarf_expr_get_value_type     ec_call_frame_cfa;
+    dwarf_expr_get_value_type     ec_object_address;
+    dwarf_expr_tls_address_type   ec_tls_address;
+    void          *ec_user_data;
+    Dwarf_Bool     ec_push_initial;
+    Dwarf_Unsigned ec_initial_value;
+} Dwarf_Expr_Context;
+
 /* Opaque types for Consumer Library. */
 /*! @typedef Dwarf_Error
     &error is used in most calls to return error details
@@ -556,6 +688,82 @@ typedef struct Dwarf_Die_s*        Dwarf_Die;
 */
 typedef struct Dwarf_Debug_Addr_Table_s* Dwarf_Debug_Addr_Table;
 
+/*! @typedef Dwarf_Die_Filter
+    Used to walk the DIEs of a CU returning only
+    DIEs with selected tags and attributes.
+    See dwarf_die_filter_create().
+*/
+typedef struct Dwarf_Die_Filter_s* Dwarf_Die_Filter;
+
+/*! @typedef Dwarf_Type_Layout
+    Used to reference the size, alignment and
+    flattened member layout of a struct, class or union.
+    See dwarf_type_layout().
+*/
+typedef struct Dwarf_Type_Layout_s* Dwarf_Type_Layout;
+
+/*! @typedef Dwarf_Unwinder
+    Used to unwind stack frames using the frame
+    tables of .debug_frame and .eh_frame.
+    See dwarf_unwinder_create().
+*/
+typedef struct Dwarf_Unwinder_s* Dwarf_Unwinder;
+
+/*! @typedef Dwarf_Expr_Program
+    A DWARF expression compiled for evaluation.
+    See dwarf_expr_compile().
+*/
+typedef struct Dwarf_Expr_Program_s* Dwarf_Expr_Program;
+
+/*! @typedef Dwarf_Var_Index
+    Used to find the variables and parameters of a
+    function that have a location at a pc.
+    See dwarf_var_index().
+*/
+typedef struct Dwarf_Var_Index_s* Dwarf_Var_Index;
+
+/*! @typedef Dwarf_Name_Index
+    Used to look up functions, variables, types and
+    namespaces by name, built from the DIEs.
+    See dwarf_name_index().
+*/
+typedef struct Dwarf_Name_Index_s* Dwarf_Name_Index;
+
+/*! @typedef Dwarf_Macro_State
+    Used to find the macros in effect at a
+    source file and line of a unit.
+    See dwarf_macro_state().
+*/
+typedef struct Dwarf_Macro_State_s* Dwarf_Macro_State;
+
+/*! @typedef Dwarf_Archive
+    The member table of a static (ar) archive.
+    See dwarf_archive_open().
+*/
+typedef struct Dwarf_Archive_s* Dwarf_Archive;
+
+/*! @typedef Dwarf_Range_Iter
+    Walks the code address ranges of a DIE,
+    whatever the DWARF version, without allocating
+    memory. The application provides the struct
+    (normally a local variable) and
+    dwarf_die_ranges_start() fills it in.
+    The fields are private to libdwarf.
+    See dwarf_die_ranges_next().
+*/
+typedef struct Dwarf_Range_Iter_s {
+    Dwarf_Debug     ri_dbg;
+    void           *ri_context;
+    Dwarf_Small    *ri_ptr;
+    Dwarf_Small    *ri_end;
+    Dwarf_Unsigned  ri_offset;
+    Dwarf_Addr      ri_base;
+    Dwarf_Addr      ri_low;
+    Dwarf_Addr      ri_high;
+    Dwarf_Half      ri_kind;
+    Dwarf_Half      ri_address_size;
+} Dwarf_Range_Iter;
+
 /*! @typedef Dwarf_Line
     Used to reference a line reference from the .debug_line
     section.
@@ -869,6 +1077,10 @@ typedef struct Dwarf_Rnglists_Head_s * Dwarf_Rnglists_Head;
 #define DW_DLA_STR_OFFSETS     0x40
 /* struct Dwarf_Debug_Addr_Table_s */
 #define DW_DLA_DEBUG_ADDR      0x41
+/* struct Dwarf_Die_Filter_s */
+#define DW_DLA_DIE_FILTER      0x42
+/* struct Dwarf_Unwinder_s */
+#define DW_DLA_UNWINDER        0x43
 /*! @} */
 
 /*! @defgroup dwdle DW_DLE Dwarf_Error numbers
@@ -1388,9 +1600,10 @@ typedef struct Dwarf_Rnglists_Head_s * Dwarf_Rnglists_Head;
 #define DW_DLE_ARITHMETIC_OVERFLOW             501
 #define DW_DLE_UNIVERSAL_BINARY_ERROR          502
 #define DW_DLE_UNIV_BIN_OFFSET_SIZE_ERROR      503
+#define DW_DLE_ARCHIVE_ERROR                   504
 
 /*! @note DW_DLE_LAST MUST EQUAL LAST ERROR NUMBER */
-#define DW_DLE_LAST        503
+#define DW_DLE_LAST        504
 #define DW_DLE_LO_USER     0x10000
 /*! @} */
 
@@ -1487,6 +1700,49 @@ DW_API int dwarf_init_path_a(const char * dw_path,
     Dwarf_Debug*      dw_dbg,
     Dwarf_Error*      dw_error);
 
+/*! @brief Initialization of a subset of the sections
+
+    This is identical to dwarf_init_path_a() except that
+    only the named sections are set up: every other
+    section is treated as absent.
+    A tool that needs, for example, only .eh_frame
+    or only the line tables then does less work
+    per open: in an Elf executable the symbol table
+    is not read at all, and in a relocatable object
+    only the relocations (and symbols) for the named
+    sections are read and section groups are read
+    only if a named section is in one.
+
+    The caller must name every section the calls it
+    makes depend on. Reading line tables, for example,
+    needs .debug_info and .debug_abbrev (for the CU DIE)
+    and .debug_str, .debug_line_str and
+    .debug_str_offsets as well as .debug_line.
+
+    @param dw_std_section_names
+    An array of standard section names such as
+    ".debug_line". A name also matches the
+    compressed (.zdebug_) and split dwarf (.dwo) forms
+    of the section. Must not be NULL.
+    @param dw_name_count
+    The number of names in dw_std_section_names.
+    Must not be zero.
+    @return
+    As dwarf_init_path_a(). DW_DLV_NO_ENTRY if none
+    of the named sections is present.
+*/
+DW_API int dwarf_init_path_sections(const char * dw_path,
+    char *            dw_true_path_out_buffer,
+    unsigned int      dw_true_path_bufferlen,
+    unsigned int      dw_groupnumber,
+    unsigned int      dw_universalnumber,
+    const char **     dw_std_section_names,
+    unsigned int      dw_name_count,
+    Dwarf_Handler     dw_errhand,
+    Dwarf_Ptr         dw_errarg,
+    Dwarf_Debug*      dw_dbg,
+    Dwarf_Error*      dw_error);
+
 /*! @brief Initialization following GNU debuglink section data.
 
     Sets the true-path with DWARF if there is
@@ -1727,6 +1983,123 @@ DW_API int dwarf_set_tied_dbg(Dwarf_Debug dw_basedbg,
 DW_API int dwarf_get_tied_dbg(Dwarf_Debug dw_dbg,
     Dwarf_Debug * dw_tieddbg_out,
     Dwarf_Error * dw_error);
+
+/*! @brief Open a static (ar) archive to read its members
+
+    Reads the archive member headers once (resolving
+    GNU and BSD long member names and skipping the
+    archive symbol index) so each member object can
+    be opened with dwarf_archive_init_member()
+    without extracting it.
+
+    Thin archives are not supported.
+
+    In case DW_DLV_ERROR returned be sure to
+    call dwarf_dealloc_error(NULL,*dw_error).
+
+    @param dw_path
+    The path of the archive.
+    @param dw_archive
+    On success returns the archive, to be
+    passed to dwarf_archive_close() when done.
+    @param dw_member_count
+    On success returns the number of members
+    (not counting the symbol index).
+    Pass NULL if not of interest.
+    @param dw_error
+    The usual error pointer.
+    @return
+    DW_DLV_OK, or DW_DLV_NO_ENTRY if the file
+    is not an archive, or DW_DLV_ERROR.
+*/
+DW_API int dwarf_archive_open(const char *dw_path,
+    Dwarf_Archive  *dw_archive,
+    Dwarf_Unsigned *dw_member_count,
+    Dwarf_Error    *dw_error);
+
+/*! @brief Return the details of one archive member
+
+    @param dw_archive
+    Pass in an open archive.
+    @param dw_index
+    Pass in a member number, zero through
+    the member count less one.
+    @param dw_name
+    On success returns the member name.
+    It is owned by the archive: do not free it.
+    @param dw_offset
+    On success returns the offset of the
+    member data in the archive file.
+    @param dw_size
+    On success returns the size of the member data.
+    @param dw_ftype
+    On success returns the DW_FTYPE of the member,
+    DW_FTYPE_UNKNOWN if it is not an object file.
+    @param dw_error
+    The usual error pointer.
+    @return
+    DW_DLV_OK or DW_DLV_ERROR (a bad dw_index).
+    Pass NULL for any value not of interest.
+*/
+DW_API int dwarf_archive_member(Dwarf_Archive dw_archive,
+    Dwarf_Unsigned  dw_index,
+    const char    **dw_name,
+    Dwarf_Unsigned *dw_offset,
+    Dwarf_Unsigned *dw_size,
+    unsigned int   *dw_ftype,
+    Dwarf_Error    *dw_error);
+
+/*! @brief Initialization of one archive member
+
+    Like dwarf_init_b() on the member, but reading the
+    archive file in place. Only Elf members can be
+    opened. The path recorded for the member
+    is the archive path followed by the member
+    name in parentheses.
+
+    The Dwarf_Archive is not changed by this, and
+    on POSIX systems reads do not move the shared
+    file position, so several threads may each open
+    and read their own members of one archive at
+    once.  Every member Dwarf_Debug must be closed
+    with dwarf_finish() before dwarf_archive_close().
+
+    @param dw_archive
+    Pass in an open archive.
+    @param dw_index
+    Pass in a member number.
+    @param dw_groupnumber
+    As for dwarf_init_b().
+    @param dw_errhand
+    As for dwarf_init_b().
+    @param dw_errarg
+    As for dwarf_init_b().
+    @param dw_dbg
+    On success returns a new Dwarf_Debug.
+    @param dw_error
+    The usual error pointer.
+    @return
+    DW_DLV_OK. DW_DLV_NO_ENTRY if the member is not
+    an object file or has no DWARF. DW_DLV_ERROR
+    with DW_DLE_FILE_WRONG_TYPE for a member that is
+    an object file other than Elf.
+*/
+DW_API int dwarf_archive_init_member(Dwarf_Archive dw_archive,
+    Dwarf_Unsigned  dw_index,
+    unsigned int    dw_groupnumber,
+    Dwarf_Handler   dw_errhand,
+    Dwarf_Ptr       dw_errarg,
+    Dwarf_Debug    *dw_dbg,
+    Dwarf_Error    *dw_error);
+
+/*! @brief Close an archive
+
+    Closes the archive file and frees the member table.
+    @param dw_archive
+    The archive from dwarf_archive_open(). NULL is
+    harmless.
+*/
+DW_API void dwarf_archive_close(Dwarf_Archive dw_archive);
 /*! @}
 */
 /*! @defgroup compilationunit Compilation Unit (CU) Access
@@ -1984,6 +2357,98 @@ DW_API int dwarf_child(Dwarf_Die dw_die,
 */
 DW_API void dwarf_dealloc_die( Dwarf_Die dw_die);
 
+/*! @brief Create a DIE filter for a filtered tree walk.
+
+    A filtered walk returns, in the order dwarf_child()
+    and dwarf_siblingof_c() would visit them, only the DIEs
+    whose tag is in dw_tags and which have every attribute
+    in dw_attrs. Because the test looks only at the
+    abbreviation of a DIE it is done once per abbreviation
+    and DIEs that do not match are skipped without
+    any Dwarf_Die being created for them.
+    Attributes reached through DW_AT_abstract_origin
+    or DW_AT_specification are not considered.
+
+    @param dw_dbg
+    The applicable Dwarf_Debug.
+    @param dw_tags
+    An array of DW_TAG values.
+    @param dw_tag_count
+    The number of entries in dw_tags. If zero
+    any tag matches.
+    @param dw_attrs
+    An array of DW_AT values that must all be present.
+    @param dw_attr_count
+    The number of entries in dw_attrs. May be zero.
+    @param dw_filter_out
+    On success returns the new filter.
+    The arrays are copied, the caller's arrays
+    need not persist.
+    @param dw_error
+    The usual Dwarf_Error*.
+    @return
+    Returns DW_DLV_OK or DW_DLV_ERROR.
+*/
+DW_API int dwarf_die_filter_create(Dwarf_Debug dw_dbg,
+    const Dwarf_Half *dw_tags,
+    Dwarf_Unsigned    dw_tag_count,
+    const Dwarf_Half *dw_attrs,
+    Dwarf_Unsigned    dw_attr_count,
+    Dwarf_Die_Filter *dw_filter_out,
+    Dwarf_Error      *dw_error);
+
+/*! @brief Start a filtered walk under a DIE.
+
+    The walk covers dw_die and all its descendants,
+    so passing a CU DIE walks the whole CU.
+    A filter may be restarted any number of times
+    and on DIEs of any CU.
+
+    @param dw_filter
+    A filter from dwarf_die_filter_create().
+    @param dw_die
+    The DIE whose subtree is to be walked.
+    The filter does not retain dw_die.
+    @param dw_error
+    The usual Dwarf_Error*.
+    @return
+    Returns DW_DLV_OK or DW_DLV_ERROR.
+*/
+DW_API int dwarf_die_filter_start(Dwarf_Die_Filter dw_filter,
+    Dwarf_Die    dw_die,
+    Dwarf_Error *dw_error);
+
+/*! @brief Return the next DIE passing the filter.
+
+    @param dw_filter
+    A filter started with dwarf_die_filter_start().
+    @param dw_die_out
+    On success returns a matching DIE. Call
+    dwarf_dealloc_die() on it when no longer needed.
+    @param dw_level_out
+    If non-null, returns the depth of the DIE
+    relative to the DIE the walk started at,
+    which is level zero.
+    @param dw_error
+    The usual Dwarf_Error*.
+    @return
+    Returns DW_DLV_OK if a DIE is returned,
+    DW_DLV_NO_ENTRY when the walk is complete,
+    or DW_DLV_ERROR.
+*/
+DW_API int dwarf_die_filter_next(Dwarf_Die_Filter dw_filter,
+    Dwarf_Die   *dw_die_out,
+    int         *dw_level_out,
+    Dwarf_Error *dw_error);
+
+/*! @brief Deallocate a DIE filter.
+
+    DIEs returned by the filter are not affected.
+    @param dw_filter
+    The filter to free.
+*/
+DW_API void dwarf_dealloc_die_filter(Dwarf_Die_Filter dw_filter);
+
 /*! @brief Return a CU DIE given a has signature
 
     @param dw_dbg
@@ -2333,6 +2798,226 @@ DW_API int dwarf_diename(Dwarf_Die dw_die,
     char   **        dw_diename,
     Dwarf_Error*     dw_error);
 
+/*! @brief Return the resolved and qualified names of a DIE
+
+    Follows DW_AT_specification and DW_AT_abstract_origin
+    so that, for example, a concrete inlined instance or an
+    out-of-line member function definition reports the
+    name, linkage name and declaration coordinates
+    recorded on the DIE it refers to. Attributes present
+    on dw_die itself take precedence.
+    The qualified scope is built from the enclosing
+    namespace, class, structure, union, interface,
+    module and enum class DIEs
+    (of the declaration, when the chain leads to one),
+    joined with "::", for example "ns::Class".
+    Unnamed namespaces appear as "(anonymous namespace)"
+    and other unnamed scopes as "(anonymous)".
+
+    Results are remembered per Dwarf_Debug by DIE offset,
+    as are the scope names and the file names
+    of each CU, so repeated calls and DIEs sharing
+    chains or scopes are cheap.
+    References into a supplementary object
+    are not followed.
+
+    @param dw_die
+    The DIE of interest.
+    @param dw_name
+    If non-null, returns the DW_AT_name or NULL if none.
+    @param dw_linkage_name
+    If non-null, returns the DW_AT_linkage_name
+    (or DW_AT_MIPS_linkage_name) or NULL if none.
+    @param dw_qualified_scope
+    If non-null, returns the qualified scope, or ""
+    at file scope.
+    @param dw_decl_file
+    If non-null, returns the DW_AT_decl_file name or NULL
+    if none or the line table cannot be read.
+    @param dw_decl_line
+    If non-null, returns the DW_AT_decl_line or zero.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK or DW_DLV_ERROR.
+    All returned strings belong to libdwarf and
+    remain valid until dwarf_finish().
+*/
+DW_API int dwarf_die_resolved_names(Dwarf_Die dw_die,
+    const char    **dw_name,
+    const char    **dw_linkage_name,
+    const char    **dw_qualified_scope,
+    const char    **dw_decl_file,
+    Dwarf_Unsigned *dw_decl_line,
+    Dwarf_Error    *dw_error);
+
+/*! @brief Return the byte size and alignment of a type
+
+    Follows typedefs, qualifiers and DW_AT_type as needed,
+    computes array sizes from the subrange bounds or counts
+    and pointer sizes from the CU address size.
+    Alignment is DW_AT_alignment if present, otherwise
+    that of the most aligned member of a struct, class
+    or union, the element alignment of an array, or the
+    largest power of two dividing the size of a scalar.
+    If dw_die is not a type but has DW_AT_type
+    (a member or variable, for example)
+    the size of that type is returned.
+    Results are remembered per Dwarf_Debug
+    by DIE offset.
+
+    @param dw_die
+    The type DIE of interest.
+    @param dw_byte_size
+    If non-null, returns the size in bytes.
+    @param dw_alignment
+    If non-null, returns the alignment in bytes.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK, or DW_DLV_NO_ENTRY if the size is
+    not known (an incomplete type, or an array with
+    non-constant bounds), or DW_DLV_ERROR.
+*/
+DW_API int dwarf_type_size(Dwarf_Die dw_die,
+    Dwarf_Unsigned *dw_byte_size,
+    Dwarf_Unsigned *dw_alignment,
+    Dwarf_Error    *dw_error);
+
+/*! @brief Return the flattened layout of an aggregate type
+
+    For a struct, class or union (possibly through
+    typedefs and qualifiers) returns a Dwarf_Type_Layout
+    listing the data members and base classes in
+    declaration order. A member whose type is itself
+    a struct, class or union is followed by that type's
+    members, with offsets relative to the outermost type,
+    a depth one greater, and a dotted name such as "a.b".
+    Static data members are not included.
+    The layout is computed once per type and
+    belongs to the Dwarf_Debug: do not free it.
+
+    @param dw_die
+    The type DIE of interest.
+    @param dw_layout
+    On success returns the layout.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK, or DW_DLV_NO_ENTRY if dw_die is not
+    a complete struct, class or union, or DW_DLV_ERROR.
+*/
+DW_API int dwarf_type_layout(Dwarf_Die dw_die,
+    Dwarf_Type_Layout *dw_layout,
+    Dwarf_Error       *dw_error);
+
+/*! @brief Return the overall values of a type layout
+
+    @param dw_layout
+    A layout from dwarf_type_layout() or
+    dwarf_cu_type_layouts().
+    @param dw_die_offset
+    If non-null, returns the section global offset of the
+    struct, class or union DIE.
+    @param dw_is_info
+    If non-null, returns TRUE if the DIE is in .debug_info,
+    FALSE if in .debug_types.
+    @param dw_byte_size
+    If non-null, returns the size in bytes.
+    @param dw_alignment
+    If non-null, returns the alignment in bytes.
+    @param dw_member_count
+    If non-null, returns the number of entries
+    for dwarf_type_layout_member().
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK or DW_DLV_ERROR.
+*/
+DW_API int dwarf_type_layout_info(Dwarf_Type_Layout dw_layout,
+    Dwarf_Off      *dw_die_offset,
+    Dwarf_Bool     *dw_is_info,
+    Dwarf_Unsigned *dw_byte_size,
+    Dwarf_Unsigned *dw_alignment,
+    Dwarf_Unsigned *dw_member_count,
+    Dwarf_Error    *dw_error);
+
+/*! @brief Return one entry of a type layout
+
+    Any of the return pointers may be null.
+    @param dw_layout
+    A layout from dwarf_type_layout() or
+    dwarf_cu_type_layouts().
+    @param dw_index
+    Pass in an index, zero through the member count less one.
+    @param dw_name
+    Returns the dotted member name. A base class
+    is named by its type name. An anonymous member
+    contributes nothing to the names of its members.
+    @param dw_depth
+    Returns zero for direct members, one for
+    members of those and so on.
+    @param dw_member_die_offset
+    Returns the offset of the DW_TAG_member or
+    DW_TAG_inheritance DIE.
+    @param dw_type_die_offset
+    Returns the offset of the member type DIE.
+    @param dw_offset_known
+    Returns FALSE if the position of the member is not
+    a constant, as for a virtual base class, in which
+    case dw_bit_offset is meaningless.
+    @param dw_bit_offset
+    Returns the offset in bits from the start of
+    the outermost type.
+    @param dw_bit_size
+    Returns the size in bits of a bit field, otherwise zero.
+    @param dw_byte_size
+    Returns the size in bytes of the member type,
+    zero if not known.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK, DW_DLV_NO_ENTRY if dw_index is
+    too large, or DW_DLV_ERROR.
+*/
+DW_API int dwarf_type_layout_member(Dwarf_Type_Layout dw_layout,
+    Dwarf_Unsigned  dw_index,
+    const char    **dw_name,
+    Dwarf_Half     *dw_depth,
+    Dwarf_Off      *dw_member_die_offset,
+    Dwarf_Off      *dw_type_die_offset,
+    Dwarf_Bool     *dw_offset_known,
+    Dwarf_Unsigned *dw_bit_offset,
+    Dwarf_Unsigned *dw_bit_size,
+    Dwarf_Unsigned *dw_byte_size,
+    Dwarf_Error    *dw_error);
+
+/*! @brief Return the layouts of all aggregates of a CU
+
+    Finds every complete struct, class and union in the
+    CU, including nested ones, with a filtered walk
+    (see dwarf_die_filter_create()) and returns
+    their layouts as from dwarf_type_layout().
+
+    @param dw_cu_die
+    The CU DIE.
+    @param dw_layouts
+    On success returns an array of layouts.
+    Free the array (not the layouts) with
+    dwarf_dealloc(dbg,*dw_layouts,DW_DLA_LIST).
+    @param dw_count
+    On success returns the number of layouts.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK, DW_DLV_NO_ENTRY if the CU has
+    no complete aggregate types, or DW_DLV_ERROR.
+*/
+DW_API int dwarf_cu_type_layouts(Dwarf_Die dw_cu_die,
+    Dwarf_Type_Layout **dw_layouts,
+    Dwarf_Unsigned     *dw_count,
+    Dwarf_Error        *dw_error);
+
 /*! @brief Return the DIE abbrev code
 
     The Abbrev code for a DIE is a non-negative
@@ -3418,6 +4103,42 @@ DW_API int dwarf_srclines_b(Dwarf_Die dw_cudie,
     Dwarf_Line_Context * dw_linecontext,
     Dwarf_Error        * dw_error);
 
+/*! @brief Return source file names from a line context
+
+    Returns exactly what dwarf_srcfiles() returns
+    for the CU the line context was created from,
+    but without reading the line table header again.
+    Useful when an application needs both the
+    line table and the file names of a CU.
+    Names added by DW_LNE_define_file in the line program
+    are not included (dwarf_srcfiles() does not include
+    them either).
+
+    Each string and the array itself must be freed
+    exactly as for dwarf_srcfiles(). The strings
+    do not point into the line context,
+    so the line context may be freed first.
+
+    @param dw_context
+    The line context returned by dwarf_srclines_b().
+    @param dw_srcfiles
+    On success returns an array of pointers to strings.
+    @param dw_filecount
+    On success returns the number of entries
+    in the array of pointers to strings.
+    @param dw_error
+    The usual error pointer.
+    @return
+    DW_DLV_OK if it succeeds.
+    DW_DLV_NO_ENTRY if the line table header
+    names no files.
+*/
+DW_API int dwarf_srcfiles_from_linecontext(
+    Dwarf_Line_Context dw_context,
+    char       *** dw_srcfiles,
+    Dwarf_Signed * dw_filecount,
+    Dwarf_Error  * dw_error);
+
 /*! @brief Access source lines from line context
 
     Provides access to Dwarf_Line data from
@@ -4051,6 +4772,57 @@ DW_API struct  Dwarf_Printf_Callback_Info_s
     dwarf_register_printf_callback(Dwarf_Debug dw_dbg,
     struct Dwarf_Printf_Callback_Info_s * dw_callbackinfo);
 
+/*! @brief Return the code addresses of a source line
+
+    The reverse of the line table: finds every
+    address range generated for line dw_line of
+    source file dw_file, across all CUs in .debug_info.
+
+    The first call reads the line tables of all CUs
+    and builds an index kept with dw_dbg, so later
+    calls are a binary search.
+    File names are compared after removing "." and
+    "dir/.." components and duplicate slashes
+    (no symbolic links are resolved), so a file
+    named differently in different CUs matches once.
+    A dw_file that is not an absolute path
+    matches any indexed file ending in "/dw_file"
+    (or equal to dw_file) so "foo.c" or "src/foo.c"
+    find ".../src/foo.c".
+
+    @param dw_dbg
+    The Dwarf_Debug of interest.
+    @param dw_file
+    The source file name.
+    @param dw_line
+    The line number.
+    @param dw_stmt_only
+    If non-zero only rows with is_stmt set are
+    reported, that is, the places a debugger would
+    put a breakpoint for the line.
+    @param dw_ranges
+    On success returns an array of Dwarf_Ranges, sorted
+    by address, each DW_RANGES_ENTRY with dwr_addr1 the
+    low address and dwr_addr2 one past the high address.
+    Adjacent ranges are merged.
+    Free it with dwarf_dealloc_ranges().
+    @param dw_range_count
+    On success returns the number of entries in dw_ranges.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK etc.
+    Returns DW_DLV_NO_ENTRY if no code was generated
+    for the line.
+*/
+DW_API int dwarf_addr_ranges_for_source_line(Dwarf_Debug dw_dbg,
+    const char     *dw_file,
+    Dwarf_Unsigned  dw_line,
+    Dwarf_Bool      dw_stmt_only,
+    Dwarf_Ranges  **dw_ranges,
+    Dwarf_Signed   *dw_range_count,
+    Dwarf_Error    *dw_error);
+
 /*! @} */
 /*! @defgroup ranges Ranges: code addresses in DWARF3-4
 
@@ -4128,6 +4900,60 @@ DW_API int dwarf_get_ranges_b(Dwarf_Debug dw_dbg,
 DW_API void dwarf_dealloc_ranges(Dwarf_Debug dw_dbg,
     Dwarf_Ranges * dw_rangesbuf,
     Dwarf_Signed   dw_rangecount);
+
+/*! @brief Start walking the code address ranges of a DIE
+
+    Works for DW_AT_low_pc with DW_AT_high_pc and
+    for DW_AT_ranges in .debug_ranges (DWARF2-4, including
+    GNU split dwarf) or .debug_rnglists (DWARF5, including
+    DW_FORM_rnglistx). Nothing is allocated, so
+    there is nothing to free. Base address entries
+    and DW_FORM_addrx style indexes are resolved as
+    dwarf_die_ranges_next() reaches them.
+
+    @param dw_die
+    Typically a CU, subprogram, lexical block or
+    inlined subroutine DIE.
+    @param dw_iter
+    Points to application storage that
+    dwarf_die_ranges_start() initializes.
+    The iterator remains valid while the
+    Dwarf_Debug is open.
+    @param dw_error
+    The usual error detail return pointer.
+    As with dwarf_lowpc(), in a split dwarf object
+    without access to its .debug_addr the error number
+    is DW_DLE_MISSING_NEEDED_DEBUG_ADDR_SECTION.
+    @return
+    Returns DW_DLV_OK etc.
+    Returns DW_DLV_NO_ENTRY if the DIE has neither
+    DW_AT_high_pc nor DW_AT_ranges.
+*/
+DW_API int dwarf_die_ranges_start(Dwarf_Die dw_die,
+    Dwarf_Range_Iter *dw_iter,
+    Dwarf_Error      *dw_error);
+
+/*! @brief Return the next code address range of a DIE
+
+    @param dw_iter
+    An iterator set up by dwarf_die_ranges_start().
+    @param dw_low
+    On success returns the lowest address of the range.
+    @param dw_high
+    On success returns the address one past the range.
+    A range may be empty, with dw_low equal to dw_high.
+    @param dw_error
+    The usual error detail return pointer.
+    The same DW_DLE_MISSING_NEEDED_DEBUG_ADDR_SECTION
+    can arise here.
+    @return
+    Returns DW_DLV_OK etc.
+    Returns DW_DLV_NO_ENTRY once there are no more ranges.
+*/
+DW_API int dwarf_die_ranges_next(Dwarf_Range_Iter *dw_iter,
+    Dwarf_Addr  *dw_low,
+    Dwarf_Addr  *dw_high,
+    Dwarf_Error *dw_error);
 /*! @} */
 
 /*! @defgroup rnglists Rnglists: code addresses in DWARF5
@@ -4589,6 +5415,494 @@ DW_API int dwarf_loclist_from_expr_c(Dwarf_Debug dw_dbg,
 */
 DW_API void dwarf_dealloc_loc_head_c(Dwarf_Loc_Head_c dw_head);
 
+/*! @brief Compile a location expression for evaluation
+
+    Turns the operators of dw_locdesc into a compact
+    internal form for dwarf_expr_evaluate().
+    Each expression is compiled once: the result
+    is cached with the Dwarf_Debug, keyed by
+    the address of the expression bytes, so compiling
+    the same location again (even from a new
+    Dwarf_Loc_Head_c) is a lookup.
+    Expressions consisting of a single
+    DW_OP_fbreg, DW_OP_breg*, DW_OP_reg*, DW_OP_addr
+    or DW_OP_addrx, alone or in each DW_OP_piece of a
+    piece list, are evaluated without running
+    the stack machine.
+
+    DW_OP_addrx and DW_OP_constx are resolved
+    through .debug_addr when compiling. In a .dwo
+    opened without its executable their value
+    is unavailable.
+
+    @param dw_locdesc
+    A location description from dwarf_get_locdesc_entry_d().
+    @param dw_program
+    On success returns the compiled expression.
+    It belongs to the Dwarf_Debug, do not free it.
+    It remains valid until dwarf_finish(),
+    after the Dwarf_Loc_Head_c is freed.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK or DW_DLV_ERROR, for example
+    for a branch to the middle of an operator.
+*/
+DW_API int dwarf_expr_compile(Dwarf_Locdesc_c dw_locdesc,
+    Dwarf_Expr_Program *dw_program,
+    Dwarf_Error        *dw_error);
+
+/*! @brief Evaluate a compiled expression
+
+    Evaluates dw_program against the registers, memory
+    etc the dw_context functions provide and returns
+    the location of the object (or its value,
+    for DW_OP_stack_value and DW_OP_implicit_value),
+    one Dwarf_Expr_Piece per DW_OP_piece or one
+    if the expression has no pieces.
+    No memory is allocated.
+
+    The typed operations of DWARF5
+    (DW_OP_const_type, DW_OP_convert etc),
+    DW_OP_entry_value, DW_OP_call* and DW_OP_xderef*
+    are not evaluated: the value is unavailable.
+
+    @param dw_program
+    A compiled expression from dwarf_expr_compile().
+    @param dw_context
+    The target access functions.
+    @param dw_pieces
+    The application array receiving the pieces.
+    @param dw_max_pieces
+    The number of entries of dw_pieces.
+    @param dw_piece_count
+    On success returns the number of pieces of the
+    expression. Only the first dw_max_pieces are set
+    if there are more.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK on success.
+    Returns DW_DLV_NO_ENTRY if the result depends on
+    something unavailable: a NULL or DW_DLV_NO_ENTRY
+    returning dw_context function or
+    an operation that is not evaluated.
+    Returns DW_DLV_ERROR for an invalid
+    expression, such as one popping an empty stack.
+*/
+DW_API int dwarf_expr_evaluate(Dwarf_Expr_Program dw_program,
+    Dwarf_Expr_Context *dw_context,
+    Dwarf_Expr_Piece   *dw_pieces,
+    Dwarf_Unsigned      dw_max_pieces,
+    Dwarf_Unsigned     *dw_piece_count,
+    Dwarf_Error        *dw_error);
+
+/*! @brief Return the variable location index of a function
+
+    Reads the DW_TAG_variable and DW_TAG_formal_parameter
+    DIEs of the subprogram, including those in its
+    lexical blocks and inlined subroutines (but not
+    in nested subprograms), and their DW_AT_location
+    into a list of entries, each a variable with one
+    location expression over one pc range.
+    A location list gives one entry per list entry;
+    a single location expression one entry per pc range
+    of the enclosing scope (the innermost lexical block,
+    inlined subroutine or the subprogram).
+    DW_LLE_default_location entries are not included,
+    nor are variables without DW_AT_location, such as
+    those with DW_AT_const_value.
+
+    The index is built once per subprogram and
+    belongs to the Dwarf_Debug: do not free it.
+    Query it with dwarf_var_index_at_pc()
+    or dwarf_var_index_at_pcs().
+
+    @param dw_die
+    A DW_TAG_subprogram DIE.
+    @param dw_index
+    On success returns the index.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK, or DW_DLV_NO_ENTRY if dw_die is
+    not a subprogram with code (for example a declaration
+    or an abstract instance), or DW_DLV_ERROR.
+*/
+DW_API int dwarf_var_index(Dwarf_Die dw_die,
+    Dwarf_Var_Index *dw_index,
+    Dwarf_Error     *dw_error);
+
+/*! @brief Return the overall values of a variable index
+
+    @param dw_index
+    An index from dwarf_var_index().
+    @param dw_die_offset
+    If non-null, returns the section global offset
+    of the subprogram DIE.
+    @param dw_is_info
+    If non-null, returns TRUE if the DIE is in .debug_info,
+    FALSE if in .debug_types.
+    @param dw_entry_count
+    If non-null, returns the number of entries
+    for dwarf_var_index_entry().
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK or DW_DLV_ERROR.
+*/
+DW_API int dwarf_var_index_info(Dwarf_Var_Index dw_index,
+    Dwarf_Off      *dw_die_offset,
+    Dwarf_Bool     *dw_is_info,
+    Dwarf_Unsigned *dw_entry_count,
+    Dwarf_Error    *dw_error);
+
+/*! @brief Return one entry of a variable index
+
+    Entries are sorted by low pc.
+    Any of the return pointers may be null.
+    @param dw_index
+    An index from dwarf_var_index().
+    @param dw_entry
+    Pass in an entry number, zero through the entry
+    count less one.
+    @param dw_die_offset
+    Returns the section global offset of the
+    variable or parameter DIE.
+    @param dw_tag
+    Returns DW_TAG_variable or DW_TAG_formal_parameter.
+    @param dw_lowpc
+    Returns the first pc of the range.
+    @param dw_highpc
+    Returns one past the last pc of the range.
+    @param dw_expr
+    Returns the location expression bytes, NULL
+    for an empty expression. They are section data
+    and remain valid until dwarf_finish().
+    @param dw_expr_len
+    Returns the length of the expression.
+    @param dw_program
+    Returns the expression compiled as by
+    dwarf_expr_compile(), ready for dwarf_expr_evaluate(),
+    or NULL if it could not be compiled.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK, DW_DLV_NO_ENTRY if dw_entry is
+    too large, or DW_DLV_ERROR.
+*/
+DW_API int dwarf_var_index_entry(Dwarf_Var_Index dw_index,
+    Dwarf_Unsigned      dw_entry,
+    Dwarf_Off          *dw_die_offset,
+    Dwarf_Half         *dw_tag,
+    Dwarf_Addr         *dw_lowpc,
+    Dwarf_Addr         *dw_highpc,
+    Dwarf_Small       **dw_expr,
+    Dwarf_Unsigned     *dw_expr_len,
+    Dwarf_Expr_Program *dw_program,
+    Dwarf_Error        *dw_error);
+
+/*! @brief Return the index entries live at a pc
+
+    Finds the entries whose range contains dw_pc
+    with a binary search. No memory is allocated.
+
+    @param dw_index
+    An index from dwarf_var_index().
+    @param dw_pc
+    The pc of interest.
+    @param dw_entries
+    The application array receiving the entry numbers,
+    in ascending order, for dwarf_var_index_entry().
+    @param dw_max_entries
+    The number of elements of dw_entries.
+    @param dw_entry_count
+    On success returns the number of entries live
+    at dw_pc. Only the first dw_max_entries are
+    stored if there are more.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK, DW_DLV_NO_ENTRY if no entry
+    contains dw_pc, or DW_DLV_ERROR.
+*/
+DW_API int dwarf_var_index_at_pc(Dwarf_Var_Index dw_index,
+    Dwarf_Addr      dw_pc,
+    Dwarf_Unsigned *dw_entries,
+    Dwarf_Unsigned  dw_max_entries,
+    Dwarf_Unsigned *dw_entry_count,
+    Dwarf_Error    *dw_error);
+
+/*! @brief Return the index entries live at each of many pcs
+
+    As dwarf_var_index_at_pc() for each element of dw_pcs,
+    with the results stored one after another in
+    dw_entries. The searches are fastest when dw_pcs is
+    sorted in ascending order, as for samples of one
+    function. No memory is allocated.
+
+    @param dw_index
+    An index from dwarf_var_index().
+    @param dw_pcs
+    The pcs of interest.
+    @param dw_pc_count
+    The number of elements of dw_pcs.
+    @param dw_entries
+    The application array receiving the entry numbers.
+    @param dw_max_entries
+    The number of elements of dw_entries.
+    @param dw_first_entry
+    An application array of dw_pc_count+1 elements.
+    On success the entries for dw_pcs[i] are
+    dw_entries[dw_first_entry[i]] up to (not including)
+    dw_entries[dw_first_entry[i+1]] and
+    dw_first_entry[dw_pc_count] is the total.
+    If the total exceeds dw_max_entries only the
+    first dw_max_entries are stored.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK or DW_DLV_ERROR.
+*/
+DW_API int dwarf_var_index_at_pcs(Dwarf_Var_Index dw_index,
+    const Dwarf_Addr *dw_pcs,
+    Dwarf_Unsigned    dw_pc_count,
+    Dwarf_Unsigned   *dw_entries,
+    Dwarf_Unsigned    dw_max_entries,
+    Dwarf_Unsigned   *dw_first_entry,
+    Dwarf_Error      *dw_error);
+
+/*! @brief Return the name index of an object
+
+    For objects without .debug_names (or .gdb_index)
+    this gives the lookup those sections would:
+    the first call walks the DIEs of every unit
+    in .debug_info and .debug_types and indexes each
+    DW_AT_name (and, for functions and variables,
+    a different DW_AT_linkage_name) of
+    non-declaration subprograms, variables, constants,
+    named types and namespaces (and modules).
+    Namespaces, classes, structures, unions and
+    modules are searched for nested names,
+    function bodies are not.
+    A definition without a name of its own
+    is indexed by the names of its declaration
+    or abstract instance, see dwarf_die_resolved_names().
+
+    Units are indexed one after another: a
+    Dwarf_Debug must not be used from several
+    threads at once.
+
+    @param dw_dbg
+    The Dwarf_Debug of interest.
+    @param dw_index
+    On success returns the index. It belongs to
+    the Dwarf_Debug and is freed by dwarf_finish().
+    @param dw_entry_count
+    If non-null, on success returns the number of
+    entries, which are ordered by the hash of
+    the name (as in .debug_names) and then by name.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK etc.
+    Returns DW_DLV_NO_ENTRY if there are no names
+    to index.
+*/
+DW_API int dwarf_name_index(Dwarf_Debug dw_dbg,
+    Dwarf_Name_Index *dw_index,
+    Dwarf_Unsigned   *dw_entry_count,
+    Dwarf_Error      *dw_error);
+
+/*! @brief Find the entries for a name
+
+    The comparison is exact (case sensitive).
+
+    @param dw_index
+    The index from dwarf_name_index().
+    @param dw_name
+    The name to find.
+    @param dw_first_entry
+    On success returns the index of the first entry
+    with that name; the others follow it.
+    @param dw_entry_count
+    On success returns the number of entries with
+    that name.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK etc.
+    Returns DW_DLV_NO_ENTRY if the name is not indexed.
+*/
+DW_API int dwarf_name_index_lookup(Dwarf_Name_Index dw_index,
+    const char     *dw_name,
+    Dwarf_Unsigned *dw_first_entry,
+    Dwarf_Unsigned *dw_entry_count,
+    Dwarf_Error    *dw_error);
+
+/*! @brief Return the details of one name index entry
+
+    Any of the returning pointers may be NULL.
+
+    @param dw_index
+    The index from dwarf_name_index().
+    @param dw_entry
+    The entry of interest, starting at zero.
+    @param dw_name
+    Returns the name. The string belongs to
+    libdwarf and remains valid until dwarf_finish().
+    @param dw_hash
+    Returns the .debug_names style hash of the name.
+    @param dw_tag
+    Returns the tag of the DIE.
+    @param dw_die_offset
+    Returns the section global offset of the DIE.
+    @param dw_is_info
+    Returns non-zero if the DIE is in .debug_info,
+    zero if it is in .debug_types.
+    @param dw_parent_offset
+    Returns the offset of the enclosing namespace,
+    class, structure, union or module DIE, or
+    zero if the DIE is a child of the unit DIE.
+    @param dw_cu_die_offset
+    Returns the offset of the unit DIE.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK etc.
+    Returns DW_DLV_NO_ENTRY if dw_entry is too large.
+*/
+DW_API int dwarf_name_index_entry(Dwarf_Name_Index dw_index,
+    Dwarf_Unsigned  dw_entry,
+    const char    **dw_name,
+    Dwarf_Unsigned *dw_hash,
+    Dwarf_Half     *dw_tag,
+    Dwarf_Off      *dw_die_offset,
+    Dwarf_Bool     *dw_is_info,
+    Dwarf_Off      *dw_parent_offset,
+    Dwarf_Off      *dw_cu_die_offset,
+    Dwarf_Error    *dw_error);
+
+/*  The lookup sources returned by dwarf_accel_sources(). */
+/*  Not yet chosen. */
+#define DW_ACCEL_NONE        0
+/*  Names from the .debug_names section. */
+#define DW_ACCEL_DEBUG_NAMES 1
+/*  Addresses from the .debug_aranges section. */
+#define DW_ACCEL_ARANGES     2
+/*  Built from the DIEs: names by dwarf_name_index(),
+    addresses from the ranges of each unit DIE. */
+#define DW_ACCEL_DIES        3
+
+/*! @brief Report which sources answer name and address lookups
+
+    dwarf_accel_lookup_name() and dwarf_accel_lookup_addr()
+    choose, on first use, the fastest source that
+    describes the whole object.
+    Names come from .debug_names if its tables list
+    every unit of .debug_info (and the object has
+    neither .debug_types nor skeleton units),
+    otherwise from dwarf_name_index().
+    Addresses come from .debug_aranges if it names
+    every unit whose unit DIE has DW_AT_high_pc or
+    DW_AT_ranges, otherwise from the ranges of the
+    unit DIEs.
+    An accelerator section that is damaged is
+    not used, it is not reported as an error.
+
+    Calling this forces the choice for each
+    non-null argument.
+
+    @param dw_dbg
+    The Dwarf_Debug of interest.
+    @param dw_name_source
+    If non-null, on success returns DW_ACCEL_DEBUG_NAMES
+    or DW_ACCEL_DIES.
+    @param dw_addr_source
+    If non-null, on success returns DW_ACCEL_ARANGES
+    or DW_ACCEL_DIES.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK or DW_DLV_ERROR.
+*/
+DW_API int dwarf_accel_sources(Dwarf_Debug dw_dbg,
+    int         *dw_name_source,
+    int         *dw_addr_source,
+    Dwarf_Error *dw_error);
+
+/*! @brief Find the DIEs with a given name
+
+    The comparison is exact (case sensitive).
+    Which DIEs are named depends on the source
+    (see dwarf_accel_sources()): .debug_names
+    as written by the compiler, or those described
+    at dwarf_name_index().
+    With .debug_names, DIEs in type units that
+    are only in a .dwo are not returned.
+
+    @param dw_dbg
+    The Dwarf_Debug of interest.
+    @param dw_name
+    The name to find.
+    @param dw_array_size
+    The number of entries in each of the arrays
+    passed in. May be zero.
+    @param dw_die_offsets
+    An array the function fills in with the section
+    global offsets of the DIEs found.
+    May be NULL only if dw_array_size is zero.
+    @param dw_is_info
+    If non-null, an array the function fills in with
+    non-zero for a DIE in .debug_info, zero for
+    one in .debug_types.
+    @param dw_tags
+    If non-null, an array the function fills in
+    with the tag of each DIE.
+    @param dw_match_count
+    On success returns the number of DIEs found,
+    which may be larger than dw_array_size,
+    meaning not all could be returned.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK etc.
+    Returns DW_DLV_NO_ENTRY if there is no such name.
+*/
+DW_API int dwarf_accel_lookup_name(Dwarf_Debug dw_dbg,
+    const char     *dw_name,
+    Dwarf_Unsigned  dw_array_size,
+    Dwarf_Off      *dw_die_offsets,
+    Dwarf_Bool     *dw_is_info,
+    Dwarf_Half     *dw_tags,
+    Dwarf_Unsigned *dw_match_count,
+    Dwarf_Error    *dw_error);
+
+/*! @brief Find the unit holding a code address
+
+    The first call builds a table of the unit address
+    ranges, sorted, so each lookup is a binary search.
+    See dwarf_accel_sources().
+
+    @param dw_dbg
+    The Dwarf_Debug of interest.
+    @param dw_pc
+    The code address.
+    @param dw_cu_die_offset
+    On success returns the .debug_info offset
+    of the unit DIE.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK etc.
+    Returns DW_DLV_NO_ENTRY if no unit
+    covers dw_pc.
+*/
+DW_API int dwarf_accel_lookup_addr(Dwarf_Debug dw_dbg,
+    Dwarf_Addr   dw_pc,
+    Dwarf_Off   *dw_cu_die_offset,
+    Dwarf_Error *dw_error);
+
 /*  These interfaces allow reading the .debug_loclists
     section. Independently of DIEs.
     Normal use of .debug_loclists uses
@@ -5165,6 +6479,135 @@ DW_API int dwarf_get_macro_import(
     Dwarf_Unsigned   dw_op_number,
     Dwarf_Unsigned * dw_target_offset,
     Dwarf_Error    * dw_error);
+
+/*! @brief Return the macro state of a unit
+
+    Answers "what is FOO defined to at bar.c line 200"
+    without the caller replaying the macro operations.
+    The first call for a unit reads its .debug_macro
+    operations (following DW_MACRO_import) or, lacking
+    those, its .debug_macinfo, and replays them once,
+    saving the defines in effect every few hundred
+    operations. A lookup then replays only from the
+    nearest saved point.
+
+    Works for DWARF2 through DWARF5.
+
+    @param dw_die
+    Any DIE of the unit of interest.
+    @param dw_state
+    On success returns the macro state. It belongs
+    to the Dwarf_Debug and is freed by dwarf_finish().
+    @param dw_op_count
+    If non-null, on success returns the number of
+    define, undef, start_file and end_file operations,
+    imports included. Positions run from zero
+    (before any operation) to this count.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK etc.
+    Returns DW_DLV_NO_ENTRY if the unit has
+    no macro information.
+*/
+DW_API int dwarf_macro_state(Dwarf_Die dw_die,
+    Dwarf_Macro_State *dw_state,
+    Dwarf_Unsigned    *dw_op_count,
+    Dwarf_Error       *dw_error);
+
+/*! @brief Turn a source file and line into a macro position
+
+    The position is just before the first operation,
+    of the first inclusion of the file, at or after
+    dw_line: a define on dw_line itself is not
+    in effect yet, the files the file included
+    before dw_line are.
+
+    @param dw_state
+    The macro state from dwarf_macro_state().
+    @param dw_file
+    The file name, as a full path or as trailing
+    components ("bar.c", "sys/types.h").
+    Pass NULL for the end of the unit.
+    @param dw_line
+    The line in that file.
+    @param dw_position
+    On success returns the position.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK etc.
+    Returns DW_DLV_NO_ENTRY if the macro operations
+    never start dw_file.
+*/
+DW_API int dwarf_macro_state_position(Dwarf_Macro_State dw_state,
+    const char     *dw_file,
+    Dwarf_Unsigned  dw_line,
+    Dwarf_Unsigned *dw_position,
+    Dwarf_Error    *dw_error);
+
+/*! @brief Return the definition of one macro at a position
+
+    @param dw_state
+    The macro state from dwarf_macro_state().
+    @param dw_position
+    A position from dwarf_macro_state_position().
+    @param dw_name
+    The macro name. Anything from a space or
+    an open parenthesis on is ignored.
+    @param dw_definition
+    On success returns the define string as recorded:
+    the name, any parameter list, a space and the value.
+    See dwarf_find_macro_value_start().
+    The string belongs to libdwarf.
+    @param dw_line
+    If non-null, on success returns the line
+    of the define.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK etc.
+    Returns DW_DLV_NO_ENTRY if the macro is not
+    defined at dw_position.
+*/
+DW_API int dwarf_macro_state_lookup(Dwarf_Macro_State dw_state,
+    Dwarf_Unsigned  dw_position,
+    const char     *dw_name,
+    const char    **dw_definition,
+    Dwarf_Unsigned *dw_line,
+    Dwarf_Error    *dw_error);
+
+/*! @brief Return every macro defined at a position
+
+    @param dw_state
+    The macro state from dwarf_macro_state().
+    @param dw_position
+    A position from dwarf_macro_state_position().
+    @param dw_array_size
+    The number of entries in dw_definitions.
+    May be zero.
+    @param dw_definitions
+    An array the function fills in with the define
+    strings (as for dwarf_macro_state_lookup()),
+    ordered by macro name.
+    May be NULL only if dw_array_size is zero.
+    @param dw_define_count
+    On success returns the number of macros defined,
+    which may be larger than dw_array_size,
+    meaning not all could be returned.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK etc.
+    Returns DW_DLV_NO_ENTRY if no macro is
+    defined at dw_position.
+*/
+DW_API int dwarf_macro_state_defines(Dwarf_Macro_State dw_state,
+    Dwarf_Unsigned  dw_position,
+    Dwarf_Unsigned  dw_array_size,
+    const char    **dw_definitions,
+    Dwarf_Unsigned *dw_define_count,
+    Dwarf_Error    *dw_error);
 /*! @} */
 
 /*! @defgroup macinfo Macro Access: DWARF2-4
@@ -5728,6 +7171,53 @@ DW_API int dwarf_get_fde_at_pc(Dwarf_Fde* dw_fde_data,
     Dwarf_Addr * dw_hipc,
     Dwarf_Error* dw_error);
 
+/*! @brief Find the FDE for a pc without building the FDE list
+
+    Does what dwarf_get_fde_list() (or dwarf_get_fde_list_eh())
+    followed by dwarf_get_fde_at_pc() does, but the first call
+    on a section only reads the FDE headers into a compact
+    index kept with the Dwarf_Debug. An FDE is
+    created the first time a lookup lands on it.
+    For a few lookups in a large .eh_frame this is
+    much cheaper than creating every FDE.
+
+    The returned FDE belongs to the Dwarf_Debug.
+    Do not call dwarf_dealloc() on it, it is freed
+    by dwarf_finish(). It is not in, and must not be mixed
+    with, the arrays returned by dwarf_get_fde_list()
+    (so do not pass it to dwarf_get_fde_n()).
+
+    @param dw_dbg
+    The Dwarf_Debug of interest.
+    @param dw_is_eh
+    Pass in non-zero to search .eh_frame,
+    zero to search .debug_frame.
+    @param dw_pc_of_interest
+    The pc value of interest.
+    @param dw_returned_fde
+    On success the FDE containing dw_pc_of_interest
+    is set through the pointer.
+    @param dw_lopc
+    If non-NULL, on success the low pc of the FDE
+    is set through the pointer.
+    @param dw_hipc
+    If non-NULL, on success the last byte address
+    covered by the FDE is set through the pointer.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK if an FDE covers dw_pc_of_interest.
+    Returns DW_DLV_NO_ENTRY if none does or the section
+    is absent or has no FDEs.
+*/
+DW_API int dwarf_find_fde_at_pc(Dwarf_Debug dw_dbg,
+    Dwarf_Bool   dw_is_eh,
+    Dwarf_Addr   dw_pc_of_interest,
+    Dwarf_Fde  * dw_returned_fde,
+    Dwarf_Addr * dw_lopc,
+    Dwarf_Addr * dw_hipc,
+    Dwarf_Error* dw_error);
+
 /*! @brief Return .eh_frame CIE augmentation data.
 
     GNU .eh_frame CIE augmentation information.
@@ -6055,6 +7545,137 @@ DW_API Dwarf_Half dwarf_set_frame_same_value(
 DW_API Dwarf_Half dwarf_set_frame_undefined_value(
     Dwarf_Debug dw_dbg,
     Dwarf_Half  dw_value);
+
+/*! @brief Create a stack unwinder
+
+    The unwinder applies the frame table (CFA and
+    register rules, including DW_CFA_expression and
+    DW_CFA_val_expression DWARF expressions) so the
+    application does not have to interpret
+    Dwarf_Regtable3 rows itself.
+    FDEs are looked up in .debug_frame and then in .eh_frame
+    with dwarf_find_fde_at_pc(), so only the FDEs
+    the unwind passes through are created.
+
+    Each frame table row used is decoded once
+    and kept, with the pc range it applies to,
+    in the unwinder, so unwinding many
+    stack samples through the same code
+    costs a binary search per frame.
+    Set any frame register values
+    (dwarf_set_frame_rule_initial_value() etc)
+    before creating the unwinder.
+
+    @param dw_dbg
+    The Dwarf_Debug of interest.
+    @param dw_read_memory
+    The function called to read target memory.
+    @param dw_sp_register
+    The DWARF number of the stack pointer register.
+    Where a row has no rule for it the
+    caller's stack pointer is set to the CFA,
+    as most ABIs define the CFA that way.
+    Pass DW_FRAME_UNDEFINED_VAL if there is no such register.
+    @param dw_unwinder
+    On success returns the unwinder.
+    Free it with dwarf_dealloc_unwinder().
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK etc.
+    Returns DW_DLV_NO_ENTRY if the object has
+    no .debug_frame or .eh_frame FDEs.
+*/
+DW_API int dwarf_unwinder_create(Dwarf_Debug dw_dbg,
+    dwarf_unwind_read_memory_type dw_read_memory,
+    Dwarf_Unsigned  dw_sp_register,
+    Dwarf_Unwinder *dw_unwinder,
+    Dwarf_Error    *dw_error);
+
+/*! @brief Unwind one stack frame
+
+    Finds the frame table row for dw_callee->ur_pc
+    (less one if it is a return address), computes
+    the CFA and then the caller's registers.
+    The caller's ur_pc is the value of the CIE
+    return address register.
+
+    @param dw_unwinder
+    The unwinder.
+    @param dw_user_data
+    Passed to the memory read function,
+    for example identifying the stack sample.
+    @param dw_callee
+    The registers of the frame to unwind.
+    @param dw_caller
+    On success the registers of its caller.
+    ur_values and ur_valid must have
+    ur_reg_count entries, set by the application,
+    and ur_reg_count must include the
+    return address register.
+    dw_caller must not be dw_callee.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK etc.
+    Returns DW_DLV_NO_ENTRY if no FDE covers the pc
+    or if the CFA or the return address is not
+    known: the register or memory needed
+    is not available or the return address
+    is undefined, as it is in the outermost frame.
+    DW_DLV_ERROR is for frame tables or expressions
+    that cannot be evaluated.
+*/
+DW_API int dwarf_unwind_step(Dwarf_Unwinder dw_unwinder,
+    void              *dw_user_data,
+    Dwarf_Unwind_Regs *dw_callee,
+    Dwarf_Unwind_Regs *dw_caller,
+    Dwarf_Error       *dw_error);
+
+/*! @brief Unwind a whole stack sample
+
+    Repeats dwarf_unwind_step() from dw_regs
+    recording the pc of each frame,
+    stopping when a step returns DW_DLV_NO_ENTRY,
+    when a step does not change the pc and CFA,
+    or when dw_max_frames pcs are recorded.
+    For a batch of samples call this once per sample
+    with the same unwinder: the row cache is shared.
+
+    @param dw_unwinder
+    The unwinder.
+    @param dw_user_data
+    Passed to the memory read function.
+    @param dw_regs
+    Pass in the registers of the innermost frame.
+    On return they are the registers of the
+    outermost frame reached.
+    @param dw_pcs
+    An array of dw_max_frames entries. On success
+    the pc of each frame, innermost first.
+    @param dw_max_frames
+    The size of dw_pcs.
+    @param dw_frame_count
+    On success returns the number of pcs set.
+    @param dw_error
+    The usual error detail return pointer.
+    @return
+    Returns DW_DLV_OK or DW_DLV_ERROR.
+*/
+DW_API int dwarf_unwind_stack(Dwarf_Unwinder dw_unwinder,
+    void              *dw_user_data,
+    Dwarf_Unwind_Regs *dw_regs,
+    Dwarf_Addr        *dw_pcs,
+    Dwarf_Unsigned     dw_max_frames,
+    Dwarf_Unsigned    *dw_frame_count,
+    Dwarf_Error       *dw_error);
+
+/*! @brief Free an unwinder
+
+    @param dw_unwinder
+    The unwinder to free. If NULL nothing is done.
+*/
+DW_API void dwarf_dealloc_unwinder(Dwarf_Unwinder dw_unwinder);
 /*! @} */
 
 /*! @defgroup abbrev Abbreviations Section Details
@@ -6522,6 +8143,125 @@ DW_API int dwarf_get_debug_sup(Dwarf_Debug dw_dbg,
     Dwarf_Unsigned * dw_checksum_len,
     Dwarf_Small   ** dw_checksum,
     Dwarf_Error    * dw_error);
+
+/*! @brief Find the supplementary object file
+
+    A DWARF5 object with a .debug_sup section
+    (that is not itself the supplementary file)
+    or a GNU dwz-processed object with
+    a .gnu_debugaltlink section refers to strings
+    and DIEs in a separate supplementary object file.
+    This returns the name recorded for that file
+    and the paths at which it might be found,
+    in the order to try them:
+    the name itself (a relative name is
+    taken relative to the directory of dw_dbg
+    if dw_dbg was opened by path) and then
+    .build-id/nn/nnnnnnnn.debug under each of the
+    global paths (see dwarf_add_debuglink_global_path()).
+
+    Open the first path that opens and attach it
+    with dwarf_set_sup_dbg().
+
+    @param dw_dbg
+    The Dwarf_Debug of interest.
+    @param dw_link_name
+    On success returns a pointer to the name
+    recorded in the object. Do not free.
+    Pass in NULL if not of interest.
+    @param dw_id
+    On success returns a pointer to the build-id
+    (.gnu_debugaltlink) or checksum (.debug_sup)
+    of the supplementary file. Do not free.
+    Pass in NULL if not of interest.
+    @param dw_id_length
+    On success returns the length of dw_id,
+    which may be zero.
+    @param dw_paths_returned
+    On success sets a pointer to an array of pointers
+    to path strings (or to NULL if there are none).
+    The caller must free(dw_paths_returned),
+    dwarf_finish() will not free it.
+    Pass in NULL if not of interest.
+    @param dw_paths_count
+    On success returns the number of paths.
+    @param dw_error
+    The usual pointer to return error details.
+    @return
+    Returns DW_DLV_OK etc. Returns DW_DLV_NO_ENTRY
+    if dw_dbg names no supplementary file.
+*/
+DW_API int dwarf_get_sup_paths(Dwarf_Debug dw_dbg,
+    char          ** dw_link_name,
+    Dwarf_Small   ** dw_id,
+    Dwarf_Unsigned * dw_id_length,
+    char         *** dw_paths_returned,
+    unsigned int   * dw_paths_count,
+    Dwarf_Error    * dw_error);
+
+/*! @brief Attach the supplementary object file
+
+    Once attached, dwarf_formstring() returns the
+    strings of DW_FORM_strp_sup and DW_FORM_GNU_strp_alt
+    from the .debug_str of dw_sup_dbg, and
+    dwarf_formref_sup_die() returns the DIE
+    a DW_FORM_ref_sup4, DW_FORM_ref_sup8 or
+    DW_FORM_GNU_ref_alt refers to.
+    Without a supplementary object such strings
+    are looked for in the tied object, as before.
+
+    dw_sup_dbg is not owned by dw_dbg.
+    One supplementary Dwarf_Debug may be attached
+    to several Dwarf_Debug (the usual case
+    with dwz, which shares one supplementary file
+    among many objects), so it is opened and
+    its sections read just once.
+    Call dwarf_finish(dw_sup_dbg) after
+    dwarf_finish() of every dw_dbg using it.
+
+    @param dw_dbg
+    Pass in an open dbg.
+    @param dw_sup_dbg
+    Pass in the open supplementary object dbg,
+    or NULL to detach it.
+    @param dw_error
+    The usual pointer to return error details.
+    @return
+    Returns DW_DLV_OK etc.
+*/
+DW_API int dwarf_set_sup_dbg(Dwarf_Debug dw_dbg,
+    Dwarf_Debug  dw_sup_dbg,
+    Dwarf_Error* dw_error);
+
+/*! @brief Return the attached supplementary object
+
+    Returns the Dwarf_Debug passed to
+    dwarf_set_sup_dbg(), or NULL through
+    dw_sup_dbg_out.
+*/
+DW_API int dwarf_get_sup_dbg(Dwarf_Debug dw_dbg,
+    Dwarf_Debug * dw_sup_dbg_out,
+    Dwarf_Error * dw_error);
+
+/*! @brief Follow a reference into the supplementary object
+
+    @param dw_attr
+    An attribute with form DW_FORM_ref_sup4,
+    DW_FORM_ref_sup8 or DW_FORM_GNU_ref_alt.
+    @param dw_die_out
+    On success returns the DIE referred to.
+    It belongs to the supplementary Dwarf_Debug,
+    free it with dwarf_dealloc_die() as usual.
+    @param dw_error
+    The usual pointer to return error details.
+    @return
+    Returns DW_DLV_OK etc.
+    Returns DW_DLV_NO_ENTRY if no supplementary
+    object was attached with dwarf_set_sup_dbg().
+*/
+DW_API int dwarf_formref_sup_die(Dwarf_Attribute dw_attr,
+    Dwarf_Die   * dw_die_out,
+    Dwarf_Error * dw_error);
 /*! @} */
 
 /*! @defgroup debugnames Fast Access to .debug_names DWARF5
@@ -8874,7 +10614,9 @@ DW_API int dwarf_get_section_info_by_index(Dwarf_Debug dw_dbg,
     with DWARF.
 
     dwarf_ub_offset, dw_ub_count, dw_ub_index only
-    apply to DW_FTYPE_APPLEUNIVERSAL.
+    apply to DW_FTYPE_APPLEUNIVERSAL, except that
+    dw_ub_offset is also set for an archive member
+    opened by dwarf_archive_init_member().
 
     dw_comdat_groupnumber only applies to DW_FTYPE_ELF.
    
@@ -8969,6 +10711,81 @@ DW_API int dwarf_machine_architecture(Dwarf_Debug dw_dbg,
 */
 DW_API Dwarf_Unsigned dwarf_get_section_count(Dwarf_Debug dw_dbg);
 
+/*! @brief Get the bytes of a DWARF section
+
+    Loads the section (if not already loaded) and
+    returns a pointer to its bytes as libdwarf
+    reads them: decompressed and, for relocatable
+    objects, relocated.
+    The bytes belong to libdwarf and remain valid
+    until dwarf_finish().
+    Intended for applications that need to compare
+    or hash section content, such as tools
+    caching results per compilation unit.
+
+    @param dw_dbg
+    The Dwarf_Debug of interest.
+    @param dw_std_section_name
+    The standard section name, for example ".debug_str".
+    In a split dwarf object the same name finds
+    the corresponding .dwo section.
+    @param dw_section_data
+    On success returns a pointer to the section bytes.
+    @param dw_section_size
+    On success returns the size of the section in bytes.
+    @param dw_error
+    On error returns the usual error pointer.
+    @return
+    Returns DW_DLV_OK etc.
+    Returns DW_DLV_NO_ENTRY if the section is not
+    present or is empty.
+*/
+DW_API int dwarf_get_section_bytes(Dwarf_Debug dw_dbg,
+    const char         *  dw_std_section_name,
+    const Dwarf_Small  ** dw_section_data,
+    Dwarf_Unsigned     *  dw_section_size,
+    Dwarf_Error        *  dw_error);
+
+/*! @brief Start reading sections in the background
+
+    Sections are otherwise read from the object file
+    one at a time when first used, so on a cold page
+    cache or a network file system the first line
+    table or frame access waits for its I/O.
+    Calling this right after dwarf_init_path() or
+    dwarf_init_b() tells the operating system
+    (posix_fadvise() POSIX_FADV_WILLNEED) which
+    sections will be needed; it starts reading them
+    all and returns at once. A later access to one
+    of them waits only if its data has not
+    arrived yet.
+    Nothing is loaded into libdwarf by this call and
+    nothing changes if the hint is ignored.
+
+    @param dw_dbg
+    The Dwarf_Debug of interest.
+    @param dw_std_section_names
+    An array of standard section names, for example
+    ".debug_line" and ".eh_frame". In a split dwarf
+    object a name also matches the .dwo section.
+    Pass NULL to prefetch every DWARF section present.
+    @param dw_name_count
+    The number of entries in dw_std_section_names.
+    @param dw_error
+    On error returns the usual error pointer.
+    @return
+    Returns DW_DLV_OK if reading was started
+    for at least one section.
+    Returns DW_DLV_NO_ENTRY if no named section is present
+    and not yet loaded, if the object was not opened
+    from a file by libdwarf (dwarf_object_init_b()),
+    or if the platform has no such hint.
+*/
+DW_API int dwarf_prefetch_sections(Dwarf_Debug dw_dbg,
+    const char   ** dw_std_section_names,
+    unsigned        dw_name_count,
+    Dwarf_Error   * dw_error);
+
 /*! @brief Get section sizes for many sections.
 
     The list of sections is incomplete and the argument list
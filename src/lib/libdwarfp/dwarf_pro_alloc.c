@@ -30,7 +30,7 @@
 
 #include <config.h>
 
-#include <stdlib.h> /* free() malloc() */
+#include <stdlib.h> /* calloc() free() malloc() */
 #include <string.h> /* memset() */
 
 #ifdef HAVE_STDINT_H
@@ -47,8 +47,23 @@
 #include "dwarf_pro_alloc.h"
 #include "dwarf_tsearch.h"
 
-/*  When each block is allocated, there is a two-word structure
-    allocated at the beginning so the block can go on a list.
+/*  Nearly everything the producer allocates (DIEs,
+    attributes and their data, strings, line, frame
+    and arange records) lives until dwarf_producer_finish_a(),
+    so _dwarf_p_get_alloc() hands out space from
+    large chunks with no per-object header. Allocation
+    is a pointer bump and the chunks are freed wholesale
+    by _dwarf_p_dealloc_all(). There is no way to free
+    one such object early.
+
+    The few things the library does free early
+    (relocation and macinfo blocks, compressed
+    section buffers) and the dbg itself come from
+    _dwarf_p_get_alloc_freeable() instead.
+
+    When each freeable block is allocated, there is a
+    two-word structure allocated at the beginning so the
+    block can go on a list.
     The address returned is the address *after* the two pointers
     at the start.  But this allows us to be given a pointer to
     a generic block, and go backwards to find the list-node.  Then
@@ -60,7 +75,7 @@
     linked list to add the block to.
 
     Only the allocation of the dbg structure itself cannot use
-    _dwarf_p_get_alloc.
+    _dwarf_p_get_alloc_freeable() with a non-null dbg.
     That structure should be set up by hand, and the two list
     pointers should be initialized to point at the node itself.
     That initializes
@@ -71,13 +86,30 @@
 #define BLOCK_TO_LIST(blk) \
     ((memory_list_t*) (((char*)blk) - sizeof(memory_list_t)))
 
+/*  Every arena object starts on this alignment,
+    enough for any type libdwarfp stores. */
+union arena_align_u {
+    Dwarf_Unsigned au_u;
+    void          *au_p;
+    double         au_d;
+};
+#define ARENA_ALIGN  ((Dwarf_Unsigned)sizeof(union arena_align_u))
+#define ARENA_ROUND(n) \
+    (((n) + ARENA_ALIGN - 1) & ~(ARENA_ALIGN - 1))
+#define ARENA_HDR_SIZE \
+    ARENA_ROUND(sizeof(struct Dwarf_P_Arena_Chunk_s))
+#define ARENA_CHUNK_SIZE  (64*1024)
+/*  Larger requests get a block of their own so they
+    do not strand the tail of a chunk. */
+#define ARENA_MAX_OBJECT  (ARENA_CHUNK_SIZE/8)
+
 /*
   dbg should be NULL only when allocating dbg itself.  In that
   case we initialize it to an empty circular doubly-linked list.
 */
 
 Dwarf_Ptr
-_dwarf_p_get_alloc(Dwarf_P_Debug dbg, Dwarf_Unsigned size)
+_dwarf_p_get_alloc_freeable(Dwarf_P_Debug dbg, Dwarf_Unsigned size)
 {
     void *sp;
     memory_list_t *lp = NULL;
@@ -111,7 +143,42 @@ _dwarf_p_get_alloc(Dwarf_P_Debug dbg, Dwarf_Unsigned size)
     return sp;
 }
 
+/*  Returns zeroed space that stays valid until
+    dwarf_producer_finish_a(). Never pass the result
+    to _dwarf_p_dealloc(). */
+Dwarf_Ptr
+_dwarf_p_get_alloc(Dwarf_P_Debug dbg, Dwarf_Unsigned size)
+{
+    Dwarf_Small *sp = 0;
+    Dwarf_Unsigned rsize = 0;
+
+    if (!dbg || size > ARENA_MAX_OBJECT) {
+        return _dwarf_p_get_alloc_freeable(dbg,size);
+    }
+    rsize = size? ARENA_ROUND(size) : ARENA_ALIGN;
+    if (!dbg->de_arena_next || rsize >
+        (Dwarf_Unsigned)(dbg->de_arena_end - dbg->de_arena_next)) {
+        struct Dwarf_P_Arena_Chunk_s *chunk = 0;
+
+        /*  calloc, so every object carved from the
+            chunk is already zero. */
+        chunk = (struct Dwarf_P_Arena_Chunk_s *)
+            calloc(1,ARENA_HDR_SIZE + ARENA_CHUNK_SIZE);
+        if (!chunk) {
+            return NULL;
+        }
+        chunk->ac_next = dbg->de_arena_chunks;
+        dbg->de_arena_chunks = chunk;
+        dbg->de_arena_next = (Dwarf_Small *)chunk + ARENA_HDR_SIZE;
+        dbg->de_arena_end = dbg->de_arena_next + ARENA_CHUNK_SIZE;
+    }
+    sp = dbg->de_arena_next;
+    dbg->de_arena_next += rsize;
+    return sp;
+}
+
 /*
+  For blocks from _dwarf_p_get_alloc_freeable() only.
   The dbg structure is not needed here anymore.
 */
 void
@@ -182,5 +249,12 @@ _dwarf_p_dealloc_all(Dwarf_P_Debug dbg)
         _dwarf_str_hashtab_freenode);
     dwarf_tdestroy(dbg->de_debug_line_str_hashtab,
         _dwarf_str_hashtab_freenode);
+    while (dbg->de_arena_chunks) {
+        struct Dwarf_P_Arena_Chunk_s *next =
+            dbg->de_arena_chunks->ac_next;
+
+        free(dbg->de_arena_chunks);
+        dbg->de_arena_chunks = next;
+    }
     free((void *)base_dbglp);
 }
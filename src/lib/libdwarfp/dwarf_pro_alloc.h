@@ -33,7 +33,12 @@
 extern "C" {
 #endif /* __cplusplus */
 
+/*  Zeroed space that lives until producer finish. */
 Dwarf_Ptr _dwarf_p_get_alloc(Dwarf_P_Debug, Dwarf_Unsigned);
+/*  Zeroed space that may be given back early
+    with _dwarf_p_dealloc(). */
+Dwarf_Ptr _dwarf_p_get_alloc_freeable(Dwarf_P_Debug,
+    Dwarf_Unsigned);
 void _dwarf_p_dealloc(Dwarf_Small * ptr);
 void _dwarf_p_dealloc_all(Dwarf_P_Debug dbg);
 
@@ -0,0 +1,232 @@
+/*
+  Copyright (C) 2026 David Anderson. All Rights Reserved.
+
+  This program is free software; you can redistribute it
+  and/or modify it under the terms of version 2.1 of the
+  GNU Lesser General Public License as published by the Free
+  Software Foundation.
+
+  This program is distributed in the hope that it would be
+  useful, but WITHOUT ANY WARRANTY; without even the implied
+  warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+  PURPOSE.
+
+  Further, this software is distributed without any warranty
+  that it is free of the rightful claim of any third person
+  regarding infringement or the like.  Any license provided
+  herein, whether implied or otherwise, applies only to this
+  software file.  Patent licenses, if any, provided herein
+  do not apply to combinations of this program with other
+  software, or any other product whatsoever.
+
+  You should have received a copy of the GNU Lesser General
+  Public License along with this program; if not, write the
+  Free Software Foundation, Inc., 51 Franklin Street - Fifth
+  Floor, Boston MA 02110-1301, USA.
+
+*/
+
+/*  Turns the final bytes of one section into the
+    SHF_COMPRESSED form: an Elf32_Chdr or Elf64_Chdr
+    followed by a zlib or zstd stream.
+
+    Compression has to happen after the caller has
+    finished with the section bytes (dwarfgen, for example,
+    applies the symbolic relocations itself), so this is
+    a separate call made on the complete section rather
+    than something dwarf_get_section_bytes_a() does to
+    each buffer.  */
+
+#include <config.h>
+
+#include <stddef.h> /* size_t */
+
+#if defined(HAVE_ZLIB_H) && defined(HAVE_ZSTD_H)
+#include "zlib.h" /* compress2() compressBound() */
+#include "zstd.h" /* ZSTD_compress2() ZSTD_compressBound() */
+#endif /* HAVE_ZLIB_H && HAVE_ZSTD_H */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "dwarf_base_types.h"
+#include "libdwarfp.h"
+#include "dwarf_pro_incl.h"
+#include "dwarf_pro_opaque.h"
+#include "dwarf_pro_error.h"
+#include "dwarf_pro_alloc.h"
+
+#ifndef ELFCOMPRESS_ZLIB
+#define ELFCOMPRESS_ZLIB 1
+#endif
+#ifndef ELFCOMPRESS_ZSTD
+#define ELFCOMPRESS_ZSTD 2
+#endif
+
+#if defined(HAVE_ZLIB) && defined(HAVE_ZSTD)
+/*  The libdwarf reader (do_decompress() in
+    dwarf_init_finish.c) treats a section that inflates
+    more than this as corrupt, so such a section
+    is left uncompressed. */
+#define ALLOWED_INFLATION 16
+
+/*  The reader picks the Chdr layout from the address
+    size, so we do the same. */
+static unsigned
+chdr_size(Dwarf_P_Debug dbg)
+{
+    return (dbg->de_pointer_size == 8)? 24 : 12;
+}
+
+static void
+write_chdr(Dwarf_P_Debug dbg,
+    Dwarf_Small   *dest,
+    Dwarf_Unsigned length,
+    Dwarf_Unsigned alignment)
+{
+    Dwarf_Unsigned type = dbg->de_compress_type;
+
+    if (dbg->de_pointer_size == 8) {
+        Dwarf_Unsigned reserved = 0;
+
+        WRITE_UNALIGNED(dbg,dest,&type,sizeof(type),4);
+        WRITE_UNALIGNED(dbg,dest+4,&reserved,
+            sizeof(reserved),4);
+        WRITE_UNALIGNED(dbg,dest+8,&length,sizeof(length),8);
+        WRITE_UNALIGNED(dbg,dest+16,&alignment,
+            sizeof(alignment),8);
+        return;
+    }
+    WRITE_UNALIGNED(dbg,dest,&type,sizeof(type),4);
+    WRITE_UNALIGNED(dbg,dest+4,&length,sizeof(length),4);
+    WRITE_UNALIGNED(dbg,dest+8,&alignment,sizeof(alignment),4);
+}
+
+static int
+compress_zlib(Dwarf_Small *dest, size_t destlen,
+    Dwarf_Small *src, size_t srclen,
+    size_t *outlen)
+{
+    uLongf zdestlen = (uLongf)destlen;
+    int zres = 0;
+
+    zres = compress2(dest,&zdestlen,src,(uLong)srclen,
+        Z_DEFAULT_COMPRESSION);
+    if (zres != Z_OK) {
+        return DW_DLV_ERROR;
+    }
+    *outlen = (size_t)zdestlen;
+    return DW_DLV_OK;
+}
+
+/*  With threads > 1 zstd splits the input into jobs
+    compressed by that many worker threads. A libzstd
+    built without multithread support rejects the
+    setting and we compress inline instead. */
+static int
+compress_zstd(Dwarf_Small *dest, size_t destlen,
+    Dwarf_Small *src, size_t srclen,
+    unsigned threads,
+    size_t *outlen)
+{
+    ZSTD_CCtx *cctx = 0;
+    size_t zres = 0;
+
+    cctx = ZSTD_createCCtx();
+    if (!cctx) {
+        return DW_DLV_ERROR;
+    }
+    if (threads > 1) {
+        (void)ZSTD_CCtx_setParameter(cctx,ZSTD_c_nbWorkers,
+            (int)threads);
+    }
+    zres = ZSTD_compress2(cctx,dest,destlen,src,srclen);
+    ZSTD_freeCCtx(cctx);
+    if (ZSTD_isError(zres)) {
+        return DW_DLV_ERROR;
+    }
+    *outlen = zres;
+    return DW_DLV_OK;
+}
+#endif /* HAVE_ZLIB && HAVE_ZSTD */
+
+int
+dwarf_compress_section_bytes(Dwarf_P_Debug dbg,
+    Dwarf_Ptr        section_bytes,
+    Dwarf_Unsigned   length,
+    Dwarf_Unsigned   alignment,
+    Dwarf_Ptr      * compressed_bytes,
+    Dwarf_Unsigned * compressed_length,
+    Dwarf_Error    * error)
+{
+#if defined(HAVE_ZLIB) && defined(HAVE_ZSTD)
+    Dwarf_Small *buf = 0;
+    Dwarf_Small *src = (Dwarf_Small *)section_bytes;
+    unsigned     hdrlen = 0;
+    size_t       bound = 0;
+    size_t       outlen = 0;
+    int          res = 0;
+#endif /* HAVE_ZLIB && HAVE_ZSTD */
+
+    if (dbg->de_version_magic_number != PRO_VERSION_MAGIC) {
+        DWARF_P_DBG_ERROR(dbg, DW_DLE_IA, DW_DLV_ERROR);
+    }
+    if (!dbg->de_compress_type || !length) {
+        return DW_DLV_NO_ENTRY;
+    }
+    if (!section_bytes || !compressed_bytes ||
+        !compressed_length) {
+        DWARF_P_DBG_ERROR(dbg, DW_DLE_IA, DW_DLV_ERROR);
+    }
+#if defined(HAVE_ZLIB) && defined(HAVE_ZSTD)
+    if ((Dwarf_Unsigned)(uLong)length != length ||
+        (Dwarf_Unsigned)(size_t)length != length) {
+        DWARF_P_DBG_ERROR(dbg, DW_DLE_ZLIB_BUF_ERROR,
+            DW_DLV_ERROR);
+    }
+    if (dbg->de_pointer_size != 8 &&
+        (length > 0xffffffff || alignment > 0xffffffff)) {
+        /*  Does not fit in an Elf32_Chdr. */
+        return DW_DLV_NO_ENTRY;
+    }
+    hdrlen = chdr_size(dbg);
+    if (dbg->de_compress_type == ELFCOMPRESS_ZLIB) {
+        bound = (size_t)compressBound((uLong)length);
+    } else {
+        bound = ZSTD_compressBound((size_t)length);
+    }
+    buf = (Dwarf_Small *)_dwarf_p_get_alloc_freeable(dbg,
+        hdrlen+bound);
+    if (!buf) {
+        DWARF_P_DBG_ERROR(dbg, DW_DLE_ALLOC_FAIL, DW_DLV_ERROR);
+    }
+    if (dbg->de_compress_type == ELFCOMPRESS_ZLIB) {
+        res = compress_zlib(buf+hdrlen,bound,src,
+            (size_t)length,&outlen);
+    } else {
+        res = compress_zstd(buf+hdrlen,bound,src,
+            (size_t)length,dbg->de_compress_threads,&outlen);
+    }
+    if (res != DW_DLV_OK) {
+        _dwarf_p_dealloc(buf);
+        DWARF_P_DBG_ERROR(dbg, DW_DLE_ZLIB_BUF_ERROR,
+            DW_DLV_ERROR);
+    }
+    if ((hdrlen + outlen) >= length ||
+        length > (Dwarf_Unsigned)outlen*ALLOWED_INFLATION) {
+        /*  Not worth it, or not readable by libdwarf.
+            The caller writes the section as it was. */
+        _dwarf_p_dealloc(buf);
+        return DW_DLV_NO_ENTRY;
+    }
+    write_chdr(dbg,buf,length,alignment);
+    *compressed_bytes = buf;
+    *compressed_length = hdrlen + outlen;
+    return DW_DLV_OK;
+#else /* !HAVE_ZLIB || !HAVE_ZSTD */
+    (void)alignment;
+    /*  Not reachable: compress_type cannot be set
+        without zlib and zstd. */
+    DWARF_P_DBG_ERROR(dbg, DW_DLE_ZDEBUG_REQUIRES_ZLIB,
+        DW_DLV_ERROR);
+#endif /* HAVE_ZLIB && HAVE_ZSTD */
+}
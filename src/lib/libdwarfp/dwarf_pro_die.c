@@ -89,7 +89,8 @@ dwarf_new_die_a(Dwarf_P_Debug dbg,
     res = dwarf_die_link_a(ret_die, parent, child, left, right,
         error);
     if (res != DW_DLV_OK) {
-        _dwarf_p_dealloc((Dwarf_Small *)ret_die);
+        /*  ret_die is arena space, returned at
+            dwarf_producer_finish_a(). */
         ret_die = 0;
     } else {
         *die_out = ret_die;
@@ -105,7 +106,9 @@ dwarf_new_die_a(Dwarf_P_Debug dbg,
 
     New September 2016.
     Error return easier to deal with
-    old version. */
+    old version.
+    An error is allocated on the dbg of new_die,
+    so dwarf_producer_finish_a() frees it. */
 int
 dwarf_die_link_a(Dwarf_P_Die new_die,
     Dwarf_P_Die parent,
@@ -118,7 +121,7 @@ dwarf_die_link_a(Dwarf_P_Die new_die,
     if (parent != NULL) {
         n_nulls++;
         if (new_die->di_parent != NULL) {
-            DWARF_P_DBG_ERROR(NULL, DW_DLE_LINK_LOOP,
+            DWARF_P_DBG_ERROR(new_die->di_dbg, DW_DLE_LINK_LOOP,
                 DW_DLV_ERROR);
         }
         new_die->di_parent = parent;
@@ -142,7 +145,7 @@ dwarf_die_link_a(Dwarf_P_Die new_die,
         new_die->di_child = child;
         new_die->di_last_child = child;
         if (child->di_parent) {
-            DWARF_P_DBG_ERROR(NULL, DW_DLE_PARENT_EXISTS,
+            DWARF_P_DBG_ERROR(new_die->di_dbg, DW_DLE_PARENT_EXISTS,
                 DW_DLV_ERROR);
         } else {
             child->di_parent = new_die;
@@ -159,7 +162,7 @@ dwarf_die_link_a(Dwarf_P_Die new_die,
         }
         left->di_right = new_die;
         if (new_die->di_parent) {
-            DWARF_P_DBG_ERROR(NULL, DW_DLE_PARENT_EXISTS,
+            DWARF_P_DBG_ERROR(new_die->di_dbg, DW_DLE_PARENT_EXISTS,
                 DW_DLV_ERROR);
         } else {
             new_die->di_parent = left->di_parent;
@@ -176,7 +179,7 @@ dwarf_die_link_a(Dwarf_P_Die new_die,
         }
         right->di_left = new_die;
         if (new_die->di_parent) {
-            DWARF_P_DBG_ERROR(NULL, DW_DLE_PARENT_EXISTS,
+            DWARF_P_DBG_ERROR(new_die->di_dbg, DW_DLE_PARENT_EXISTS,
                 DW_DLV_ERROR);
         } else {
             new_die->di_parent = right->di_parent;
@@ -184,7 +187,7 @@ dwarf_die_link_a(Dwarf_P_Die new_die,
     }
     if (n_nulls > 1) {
         /* Multiple neighbors! error! */
-        DWARF_P_DBG_ERROR(NULL, DW_DLE_EXTRA_NEIGHBORS,
+        DWARF_P_DBG_ERROR(new_die->di_dbg, DW_DLE_EXTRA_NEIGHBORS,
             DW_DLV_ERROR);
     }
     return DW_DLV_OK;
@@ -539,6 +542,16 @@ int _dwarf_pro_set_string_attr(Dwarf_P_Attribute new_attr,
     int form = dbg->de_debug_default_str_form;
     unsigned slen = strlen(name)+1;
 
+    if (new_attr->ar_attribute == DW_AT_comp_dir &&
+        !dbg->de_comp_dir) {
+        /*  Directory entry 0 of a DWARF5 line table. */
+        dbg->de_comp_dir = (char *)_dwarf_p_get_alloc(dbg, slen);
+        if (!dbg->de_comp_dir) {
+            _dwarf_p_error(dbg, error, DW_DLE_ALLOC_FAIL);
+            return DW_DLV_ERROR;
+        }
+        strcpy(dbg->de_comp_dir, name);
+    }
     if (form == DW_FORM_string ||
         slen <= dbg->de_dwarf_offset_size) {
         new_attr->ar_nbytes = slen;
@@ -402,8 +402,8 @@ dwarf_add_AT_block_a(
     new_attr->ar_data = attrdata = (char *)
         _dwarf_p_get_alloc(dbg, len_size + block_size);
     if (new_attr->ar_data == NULL) {
-        /* free the block we got earlier */
-        _dwarf_p_dealloc((unsigned char *) new_attr);
+        /*  new_attr is arena space, returned at
+            dwarf_producer_finish_a(). */
         _dwarf_p_error(dbg, error, DW_DLE_ALLOC_FAIL);
         return DW_DLV_ERROR;
     }
@@ -175,7 +175,7 @@ dwarf_producer_init(Dwarf_Unsigned flags,
     Dwarf_P_Debug dbg = 0;
     int res = 0;
     int err_ret = 0;
-    dbg = (Dwarf_P_Debug) _dwarf_p_get_alloc(NULL,
+    dbg = (Dwarf_P_Debug) _dwarf_p_get_alloc_freeable(NULL,
         sizeof(struct Dwarf_P_Debug_s));
     if (dbg == NULL) {
         DWARF_P_DBG_ERROR(dbg, DW_DLE_DBG_ALLOC,
@@ -282,6 +282,23 @@ dwarf_add_file_decl_a(Dwarf_P_Debug dbg,
     Dwarf_Unsigned length,
     Dwarf_Unsigned *file_entry_count_out,
     Dwarf_Error * error)
+{
+    return dwarf_add_file_decl_b(dbg,name,dir_idx,time_mod,
+        length,0,file_entry_count_out,error);
+}
+
+/*  As dwarf_add_file_decl_a() but with the MD5 of the
+    file content (may be NULL). A DWARF5 line table
+    carries DW_LNCT_MD5 when every file has one. */
+int
+dwarf_add_file_decl_b(Dwarf_P_Debug dbg,
+    char *name,
+    Dwarf_Unsigned dir_idx,
+    Dwarf_Unsigned time_mod,
+    Dwarf_Unsigned length,
+    Dwarf_Form_Data16 *md5,
+    Dwarf_Unsigned *file_entry_count_out,
+    Dwarf_Error * error)
 {
     Dwarf_P_F_Entry cur;
     char *ptr = 0;
@@ -350,6 +367,14 @@ dwarf_add_file_decl_a(Dwarf_P_Debug dbg,
     ptr += nbytes_time;
     memcpy((void *) ptr, bufflen, nbytes_len);
     cur->dfe_nbytes = nbytes_idx + nbytes_time + nbytes_len;
+    /*  The DWARF5 header writes these as separate fields. */
+    cur->dfe_index = (unsigned)dir_idx;
+    cur->dfe_timestamp = time_mod;
+    cur->dfe_size = length;
+    if (md5) {
+        memcpy(cur->dfe_md5,md5->fd_data,sizeof(cur->dfe_md5));
+        cur->dfe_md5_present = TRUE;
+    }
     cur->dfe_next = NULL;
     *file_entry_count_out = dbg->de_n_file_entries;
     return DW_DLV_OK;
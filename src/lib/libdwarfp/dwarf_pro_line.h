@@ -49,8 +49,10 @@
 #define MIN_INST_LENGTH 4
 #endif
 #define DEFAULT_IS_STMT false
-/*  line base and range are temporarily defines.
-    They need to be calculated later. */
+/*  line base and range defaults. With the extras
+    string optimize_line_table=1 they are instead
+    calculated from the rows when the line table
+    is generated. */
 #define LINE_BASE   -1
 #define LINE_RANGE   4
 
@@ -73,8 +75,9 @@ struct Dwarf_P_F_Entry_s {
         actually used.  */
     unsigned dfe_index;
     Dwarf_Unsigned dfe_timestamp;
-    unsigned dfe_size;
+    Dwarf_Unsigned dfe_size;
     unsigned char dfe_md5[16];
+    Dwarf_Bool dfe_md5_present;
 };
 
 /*
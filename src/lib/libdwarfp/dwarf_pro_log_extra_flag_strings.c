@@ -192,6 +192,31 @@ update_named_field(Dwarf_P_Debug dbg,
     } else if (!strcmp(name,"address_size")) {
         dbg->de_line_inits.pi_address_size = (unsigned)v;
         dbg->de_pointer_size = (unsigned)v;
+    } else if (!strcmp(name,"compress_type")) {
+        /*  1 is ELFCOMPRESS_ZLIB, 2 is ELFCOMPRESS_ZSTD */
+        if (v < 0 || v > 2) {
+            *err = DW_DLE_PRO_INIT_EXTRAS_ERR;
+            return DW_DLV_ERROR;
+        }
+#if !defined(HAVE_ZLIB) || !defined(HAVE_ZSTD)
+        if (v) {
+            *err = DW_DLE_ZDEBUG_REQUIRES_ZLIB;
+            return DW_DLV_ERROR;
+        }
+#endif /* !HAVE_ZLIB || !HAVE_ZSTD */
+        dbg->de_compress_type = (unsigned char)v;
+    } else if (!strcmp(name,"compress_threads")) {
+        if (v < 0) {
+            *err = DW_DLE_PRO_INIT_EXTRAS_ERR;
+            return DW_DLV_ERROR;
+        }
+        dbg->de_compress_threads = (unsigned)v;
+    } else if (!strcmp(name,"optimize_line_table")) {
+        if (v < 0 || v > 1) {
+            *err = DW_DLE_PRO_INIT_EXTRAS_ERR;
+            return DW_DLV_ERROR;
+        }
+        dbg->de_optimize_line_table = (unsigned char)v;
     } else {
 #ifdef TESTING
         printf("ERROR  due to unknown string \"%s\", line %d %s\n",
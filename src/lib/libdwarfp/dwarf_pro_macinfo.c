@@ -80,7 +80,7 @@ libdwarf_compose_begin(Dwarf_P_Debug dbg, int code,
         }
         len = sizeof(struct dw_macinfo_block_s) + blen;
         newb = (struct dw_macinfo_block_s *)
-            _dwarf_p_get_alloc(dbg, len);
+            _dwarf_p_get_alloc_freeable(dbg, len);
         if (!newb) {
             *compose_error_type = DW_DLE_MACINFO_MALLOC_FAIL;
             return DW_DLV_ERROR;
@@ -105,7 +105,7 @@ libdwarf_compose_begin(Dwarf_P_Debug dbg, int code,
         }
         len = sizeof(struct dw_macinfo_block_s) + blen;
         newb = (struct dw_macinfo_block_s *)
-            _dwarf_p_get_alloc(dbg, len);
+            _dwarf_p_get_alloc_freeable(dbg, len);
         if (!newb) {
             *compose_error_type = DW_DLE_MACINFO_MALLOC_FAIL;
             return DW_DLV_ERROR;
@@ -359,6 +359,12 @@ typedef struct memory_list_s {
     struct memory_list_s *next;
 } memory_list_t;
 
+/*  One chunk of the _dwarf_p_get_alloc() arena.
+    The chunk data follows this header. */
+struct Dwarf_P_Arena_Chunk_s {
+    struct Dwarf_P_Arena_Chunk_s *ac_next;
+};
+
 struct Dwarf_P_Per_Sect_String_Attrs_s {
     int sect_sa_section_number;
     unsigned sect_sa_n_alloc;
@@ -588,6 +594,31 @@ struct Dwarf_P_Debug_s {
     struct Dwarf_P_Line_Inits_s de_line_inits;
 
     struct Dwarf_P_Stats_s de_stats;
+
+    /*  From the extras string: ELFCOMPRESS_ZLIB (1) or
+        ELFCOMPRESS_ZSTD (2) if the caller wants
+        dwarf_compress_section_bytes() to produce
+        SHF_COMPRESSED section content, else 0.
+        de_compress_threads is the number of zstd
+        worker threads (0 or 1 means compress inline). */
+    unsigned char de_compress_type;
+    unsigned      de_compress_threads;
+
+    /*  The _dwarf_p_get_alloc() arena. de_arena_chunks
+        is the most recent chunk, and [de_arena_next,
+        de_arena_end) the unused part of it. */
+    struct Dwarf_P_Arena_Chunk_s *de_arena_chunks;
+    Dwarf_Small  *de_arena_next;
+    Dwarf_Small  *de_arena_end;
+
+    /*  From the extras string optimize_line_table=1:
+        pick line_base and line_range from the line
+        table rows rather than use de_line_inits. */
+    unsigned char de_optimize_line_table;
+
+    /*  Copy of the DW_AT_comp_dir string, which is
+        directory entry 0 of a DWARF5 line table. */
+    char         *de_comp_dir;
 };
 
 #define VERSION_STAMP2   2
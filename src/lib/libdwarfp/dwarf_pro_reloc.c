@@ -72,7 +72,7 @@ _dwarf_pro_pre_alloc_specific_reloc_slots(Dwarf_P_Debug dbg,
     len = sizeof(struct Dwarf_P_Relocation_Block_s) +
         slots_in_blk * rel_rec_size;
     data = (struct Dwarf_P_Relocation_Block_s *)
-        _dwarf_p_get_alloc(dbg, len);
+        _dwarf_p_get_alloc_freeable(dbg, len);
     if (!data) {
         return DW_DLV_ERROR;
     }
@@ -112,7 +112,7 @@ _dwarf_pro_alloc_reloc_slots(Dwarf_P_Debug dbg, int rel_sec_index)
         slots_in_blk * rel_rec_size;
 
     data = (struct Dwarf_P_Relocation_Block_s *)
-        _dwarf_p_get_alloc(dbg, len);
+        _dwarf_p_get_alloc_freeable(dbg, len);
     if (!data) {
         return DW_DLV_ERROR;
     }
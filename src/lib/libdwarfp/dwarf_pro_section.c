@@ -33,7 +33,7 @@
 
 #include <stddef.h> /* NULL */
 #include <stdlib.h> /* free() malloc() qsort() */
-#include <string.h> /* memcpy() strcmp() strcpy() strlen() */
+#include <string.h> /* memcpy() memset() strcmp() strcpy() strlen() */
 
 #include "dwarf.h"
 #include "libdwarf.h"
@@ -282,9 +282,6 @@ _dwarf_pro_get_opc(
 static int
 dwarf_need_debug_line_section(Dwarf_P_Debug dbg)
 {
-    if (dbg->de_output_version > 4) {
-        return FALSE;
-    }
     if (dbg->de_lines == NULL && dbg->de_file_entries == NULL
         && dbg->de_inc_dirs == NULL) {
         return FALSE;
@@ -805,8 +802,12 @@ determine_form_size(Dwarf_P_Debug dbg,
     unsigned n = 0;
     int res = 0;
 
-    /*  entry format itself */
+    /*  entry format count itself */
     calculated_size += sizeof_ubyte(dbg);
+    if (write_out) {
+        *data = (unsigned char)format_count;
+        data += 1;
+    }
 
     /*  Space for the format details. */
     for (n = 0; n < format_count; ++n) {
@@ -844,8 +845,11 @@ determine_form_size(Dwarf_P_Debug dbg,
     return DW_DLV_OK;
 }
 
+/*  zeroth, if non-null, is written as entry 0
+    ahead of entry_list. */
 static int
 determine_file_content_size(Dwarf_P_Debug dbg,
+    Dwarf_P_F_Entry zeroth,
     Dwarf_P_F_Entry entry_list,
     Dwarf_Unsigned format_count,
     struct Dwarf_P_Line_format_s *format,
@@ -860,19 +864,37 @@ determine_file_content_size(Dwarf_P_Debug dbg,
     Dwarf_P_F_Entry  nxt = 0;
     int res              = 0;
     Dwarf_Unsigned offset_size = 0;
+    Dwarf_Unsigned entry_count = 0;
+    Dwarf_Bool in_zeroth = FALSE;
 
     offset_size = dbg->de_dwarf_offset_size;
-    res = pretend_write_uval(format_count,dbg,
-        &count_len,error);
+    entry_count = zeroth? 1 : 0;
+    for (cur = entry_list; cur; cur = cur->dfe_next) {
+        ++entry_count;
+    }
+    if (write_out) {
+        res = append_uval(entry_count,dbg,data,&count_len,error);
+        data += count_len;
+    } else {
+        res = pretend_write_uval(entry_count,dbg,
+            &count_len,error);
+    }
     if (res != DW_DLV_OK) {
         return res;
     }
     calculated_size += count_len;
 
-    cur =  entry_list;
+    in_zeroth = zeroth? TRUE : FALSE;
+    cur = in_zeroth? zeroth : entry_list;
     for ( ; cur; cur = nxt) {
         unsigned f = 0;
-        nxt = cur->dfe_next;
+
+        if (in_zeroth) {
+            nxt = entry_list;
+            in_zeroth = FALSE;
+        } else {
+            nxt = cur->dfe_next;
+        }
 
         for ( ; f < format_count; f++) {
             struct Dwarf_P_Line_format_s *lf = format+f;
@@ -1026,7 +1048,7 @@ determine_file_content_size(Dwarf_P_Debug dbg,
                         before 2038. */
                     calculated_size += DWARF_64BIT_SIZE;
                     if (write_out) {
-                        Dwarf_Unsigned u8 = cur->dfe_index;
+                        Dwarf_Unsigned u8 = cur->dfe_timestamp;
                         WRITE_UNALIGNED(dbg, (void *) data,
                             (const void *) &u8,
                             sizeof(u8), DWARF_64BIT_SIZE);
@@ -1047,7 +1069,7 @@ determine_file_content_size(Dwarf_P_Debug dbg,
                 case DW_FORM_data1:
                     calculated_size += 1;
                     if (write_out) {
-                        unsigned char ub = cur->dfe_index;
+                        unsigned char ub = (unsigned char)cur->dfe_size;
                         *data = ub;
                         data += 1;
                     }
@@ -1055,15 +1077,17 @@ determine_file_content_size(Dwarf_P_Debug dbg,
                 case DW_FORM_data2:
                     calculated_size += DWARF_HALF_SIZE;
                     if (write_out) {
-                        Dwarf_Half uh = cur->dfe_index;
-                        memcpy(data,&uh,DWARF_HALF_SIZE);
-
+                        Dwarf_Half uh = (Dwarf_Half)cur->dfe_size;
+                        WRITE_UNALIGNED(dbg, (void *) data,
+                            (const void *) &uh,
+                            sizeof(uh), DWARF_HALF_SIZE);
+                        data += DWARF_HALF_SIZE;
                     }
                     break;
                 case DW_FORM_data4:
                     calculated_size += DWARF_32BIT_SIZE;
                     if (write_out) {
-                        ASNOUT(data,cur->dfe_index,
+                        ASNOUT(data,cur->dfe_size,
                             DWARF_32BIT_SIZE);
                         data += DWARF_32BIT_SIZE;
                     }
@@ -1071,7 +1095,7 @@ determine_file_content_size(Dwarf_P_Debug dbg,
                 case DW_FORM_data8:
                     calculated_size += DWARF_64BIT_SIZE;
                     if (write_out) {
-                        Dwarf_Unsigned u8 = cur->dfe_index;
+                        Dwarf_Unsigned u8 = cur->dfe_size;
                         WRITE_UNALIGNED(dbg, (void *) data,
                             (const void *) &u8,
                             sizeof(u8), DWARF_64BIT_SIZE);
@@ -1133,6 +1157,7 @@ determine_file_content_size(Dwarf_P_Debug dbg,
 static int
 calculate_size_of_line_header5(Dwarf_P_Debug dbg,
     struct Dwarf_P_Line_Inits_s *inits,
+    Dwarf_P_F_Entry dir0,
     unsigned *prolog_size_out,
     Dwarf_Error *error)
 {
@@ -1152,8 +1177,6 @@ calculate_size_of_line_header5(Dwarf_P_Debug dbg,
         sizeof_ubyte(dbg) + /* linebase */
         sizeof_ubyte(dbg) + /* linerange */
         sizeof_ubyte(dbg);  /* opcode base */
-        /* For maximum_operations_per_instruction. */
-        prolog_size += sizeof_ubyte(dbg);
 
     /* standard_opcode_lengths table len */
     prolog_size += inits->pi_opcode_base-1;
@@ -1172,6 +1195,7 @@ calculate_size_of_line_header5(Dwarf_P_Debug dbg,
     {
         unsigned dir_count_len = 0;
         res = determine_file_content_size(dbg,
+            dir0,
             dbg->de_inc_dirs,
             dbg->de_line_inits.pi_directory_entry_format_count,
             dbg->de_line_inits.pi_incformats,
@@ -1199,6 +1223,7 @@ calculate_size_of_line_header5(Dwarf_P_Debug dbg,
     {
         unsigned file_count_len = 0;
         res = determine_file_content_size(dbg,
+            dbg->de_file_entries,
             dbg->de_file_entries,
             dbg->de_line_inits.pi_file_entry_format_count,
             dbg->de_line_inits.pi_fileformats,
@@ -1264,6 +1289,382 @@ calculate_size_of_line_header4(Dwarf_P_Debug dbg,
     return DW_DLV_OK;
 }
 
+/*  Unless the caller set them up, DWARF5 directory
+    and file entries carry the path inline and files
+    their directory index, plus the timestamp and size
+    when any file has them and the MD5 when every
+    file has one. */
+static void
+setup_line_formats5(Dwarf_P_Debug dbg,
+    struct Dwarf_P_Line_Inits_s *inits)
+{
+    Dwarf_P_F_Entry cur = 0;
+    Dwarf_Bool any_time = FALSE;
+    Dwarf_Bool any_size = FALSE;
+    Dwarf_Bool all_md5 = TRUE;
+    struct Dwarf_P_Line_format_s *lf = 0;
+    unsigned n = 0;
+
+    if (!inits->pi_directory_entry_format_count) {
+        lf = inits->pi_incformats;
+        lf->def_content_type = DW_LNCT_path;
+        lf->def_form_code = DW_FORM_string;
+        inits->pi_directory_entry_format_count = 1;
+    }
+    if (inits->pi_file_entry_format_count) {
+        return;
+    }
+    for (cur = dbg->de_file_entries; cur; cur = cur->dfe_next) {
+        if (cur->dfe_timestamp) {
+            any_time = TRUE;
+        }
+        if (cur->dfe_size) {
+            any_size = TRUE;
+        }
+        if (!cur->dfe_md5_present) {
+            all_md5 = FALSE;
+        }
+    }
+    lf = inits->pi_fileformats;
+    lf[n].def_content_type = DW_LNCT_path;
+    lf[n++].def_form_code = DW_FORM_string;
+    lf[n].def_content_type = DW_LNCT_directory_index;
+    lf[n++].def_form_code = DW_FORM_udata;
+    if (any_time) {
+        lf[n].def_content_type = DW_LNCT_timestamp;
+        lf[n++].def_form_code = DW_FORM_udata;
+    }
+    if (any_size) {
+        lf[n].def_content_type = DW_LNCT_size;
+        lf[n++].def_form_code = DW_FORM_udata;
+    }
+    if (all_md5 && dbg->de_file_entries) {
+        lf[n].def_content_type = DW_LNCT_MD5;
+        lf[n++].def_form_code = DW_FORM_data16;
+    }
+    inits->pi_file_entry_format_count = n;
+}
+
+/*  With optimize_line_table=1 each row is written
+    as the shortest of: a special opcode,
+    DW_LNS_const_add_pc or DW_LNS_advance_pc followed
+    by a special opcode, each optionally preceded
+    by DW_LNS_advance_line when the line advance
+    is out of range of the special opcodes (then
+    the special opcode has a line advance of zero).
+    line_base and line_range are chosen to minimize
+    the total over all the rows, always with zero
+    in the special opcode line range. */
+#define ROW_COPY          0
+#define ROW_SPECIAL       1
+#define ROW_CONST_ADD_PC  2
+#define ROW_ADVANCE_PC    3
+
+/*  Largest line_range tried. GNU as uses 14. */
+#define OPT_LINE_RANGE_MAX 32
+
+/*  The factored address advance of DW_LNS_const_add_pc. */
+#define CONST_ADD_PC_ADVANCE(opcode_base,line_range) \
+    ((MAX_OPCODE - (opcode_base))/(line_range))
+
+static unsigned
+uleb_length(Dwarf_Unsigned v)
+{
+    unsigned n = 1;
+
+    for ( ; v >= 0x80; v >>= 7) {
+        ++n;
+    }
+    return n;
+}
+
+static unsigned
+sleb_length(Dwarf_Signed v)
+{
+    /*  ~v of a negative value needs the same number
+        of sleb bytes as v. */
+    Dwarf_Unsigned u = (v < 0)? (Dwarf_Unsigned)~v :
+        (Dwarf_Unsigned)v;
+    unsigned n = 1;
+
+    for ( ; u >= 0x40; u >>= 7) {
+        ++n;
+    }
+    return n;
+}
+
+/*  Returns the special opcode for the factored address
+    advance and line advance, or -1 if there is none. */
+static int
+special_opcode(int line_base, int line_range,
+    unsigned opcode_base,
+    Dwarf_Unsigned fadv, int line_adv)
+{
+    Dwarf_Unsigned opc = 0;
+
+    if (line_adv < line_base || line_adv >= line_base + line_range) {
+        return -1;
+    }
+    if (fadv > MAX_OPCODE) {
+        return -1;
+    }
+    opc = (line_adv - line_base) + fadv*line_range + opcode_base;
+    if (opc > MAX_OPCODE) {
+        return -1;
+    }
+    return (int)opc;
+}
+
+/*  Decides how one row is written and returns
+    its size in bytes. */
+static unsigned
+plan_line_row(int line_base, int line_range,
+    unsigned opcode_base,
+    Dwarf_Unsigned fadv, int line_adv,
+    Dwarf_Bool *advance_line_out,
+    int *how_out)
+{
+    unsigned size = 0;
+
+    *advance_line_out = FALSE;
+    if (line_adv < line_base || line_adv >= line_base + line_range) {
+        *advance_line_out = TRUE;
+        size = 1 + sleb_length(line_adv);
+        line_adv = 0;
+    }
+    if (!fadv && !line_adv) {
+        *how_out = ROW_COPY;
+        return size + 1;
+    }
+    if (special_opcode(line_base,line_range,opcode_base,
+        fadv,line_adv) >= 0) {
+        *how_out = ROW_SPECIAL;
+        return size + 1;
+    }
+    if (opcode_base > DW_LNS_const_add_pc) {
+        Dwarf_Unsigned k = CONST_ADD_PC_ADVANCE(opcode_base,
+            line_range);
+
+        if (fadv >= k && special_opcode(line_base,line_range,
+            opcode_base,fadv - k,line_adv) >= 0) {
+            *how_out = ROW_CONST_ADD_PC;
+            return size + 2;
+        }
+    }
+    *how_out = ROW_ADVANCE_PC;
+    return size + 1 + uleb_length(fadv) + 1;
+}
+
+static int
+write_line_row(Dwarf_P_Debug dbg,
+    struct Dwarf_P_Line_Inits_s *inits,
+    int elfsectno,
+    Dwarf_Unsigned fadv,
+    int line_adv,
+    unsigned *len_out,
+    Dwarf_Error *error)
+{
+    int line_base = inits->pi_line_base;
+    int line_range = inits->pi_line_range;
+    unsigned opcode_base = inits->pi_opcode_base;
+    Dwarf_Bool advance_line = FALSE;
+    int how = 0;
+    unsigned writelen = 0;
+    unsigned total = 0;
+    int res = 0;
+
+    (void)plan_line_row(line_base,line_range,opcode_base,
+        fadv,line_adv,&advance_line,&how);
+    if (advance_line) {
+        res = write_ubyte(DW_LNS_advance_line,dbg,elfsectno,
+            &writelen,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        total += writelen;
+        res = write_sval(line_adv,dbg,elfsectno,&writelen,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        total += writelen;
+        line_adv = 0;
+    }
+    switch (how) {
+    case ROW_COPY:
+        res = write_ubyte(DW_LNS_copy,dbg,elfsectno,
+            &writelen,error);
+        break;
+    case ROW_SPECIAL:
+        res = write_ubyte(special_opcode(line_base,line_range,
+            opcode_base,fadv,line_adv),
+            dbg,elfsectno,&writelen,error);
+        break;
+    case ROW_CONST_ADD_PC:
+        res = write_ubyte(DW_LNS_const_add_pc,dbg,elfsectno,
+            &writelen,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        total += writelen;
+        fadv -= CONST_ADD_PC_ADVANCE(opcode_base,line_range);
+        res = write_ubyte(special_opcode(line_base,line_range,
+            opcode_base,fadv,line_adv),
+            dbg,elfsectno,&writelen,error);
+        break;
+    default:
+        res = write_opcode_uval(DW_LNS_advance_pc,dbg,elfsectno,
+            fadv,&writelen,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+        total += writelen;
+        res = write_ubyte(special_opcode(line_base,line_range,
+            opcode_base,0,line_adv),
+            dbg,elfsectno,&writelen,error);
+        break;
+    }
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    total += writelen;
+    *len_out = total;
+    return DW_DLV_OK;
+}
+
+/*  One distinct row advance and how many rows use it. */
+struct Dwarf_Line_Delta_s {
+    Dwarf_Unsigned ld_fadv;
+    int            ld_line_adv;
+    Dwarf_Unsigned ld_count;
+};
+
+static int
+line_delta_compare(const void *l, const void *r)
+{
+    const struct Dwarf_Line_Delta_s *ld = l;
+    const struct Dwarf_Line_Delta_s *rd = r;
+
+    if (ld->ld_fadv != rd->ld_fadv) {
+        return (ld->ld_fadv < rd->ld_fadv)? -1 : 1;
+    }
+    if (ld->ld_line_adv != rd->ld_line_adv) {
+        return (ld->ld_line_adv < rd->ld_line_adv)? -1 : 1;
+    }
+    return 0;
+}
+
+/*  Sets inits->pi_line_base and inits->pi_line_range
+    to the pair giving the smallest line program
+    for the rows in dbg->de_lines. */
+static int
+choose_line_base_and_range(Dwarf_P_Debug dbg,
+    struct Dwarf_P_Line_Inits_s *inits,
+    Dwarf_Error *error)
+{
+    struct Dwarf_Line_Delta_s *deltas = 0;
+    Dwarf_Unsigned rowcount = 0;
+    Dwarf_Unsigned ndistinct = 0;
+    Dwarf_Unsigned i = 0;
+    Dwarf_P_Line cur = 0;
+    Dwarf_Addr addr = 0;
+    Dwarf_Unsigned line = 1;
+    unsigned minlen = inits->pi_minimum_instruction_length;
+    unsigned opcode_base = inits->pi_opcode_base;
+    Dwarf_Unsigned best_size = 0;
+    int best_base = 0;
+    int best_range = 0;
+    int line_range = 0;
+
+    if (!minlen) {
+        minlen = 1;
+    }
+    for (cur = dbg->de_lines; cur; cur = cur->dpl_next) {
+        if (!cur->dpl_opc) {
+            ++rowcount;
+        }
+    }
+    if (!rowcount || opcode_base >= MAX_OPCODE) {
+        return DW_DLV_OK;
+    }
+    if (rowcount > (Dwarf_Unsigned)((size_t)-1)/
+        sizeof(struct Dwarf_Line_Delta_s)) {
+        _dwarf_p_error(dbg, error, DW_DLE_ALLOC_FAIL);
+        return DW_DLV_ERROR;
+    }
+    deltas = (struct Dwarf_Line_Delta_s *)malloc(
+        (size_t)rowcount*sizeof(struct Dwarf_Line_Delta_s));
+    if (!deltas) {
+        _dwarf_p_error(dbg, error, DW_DLE_ALLOC_FAIL);
+        return DW_DLV_ERROR;
+    }
+    /*  Replay the address and line registers as
+        _dwarf_pro_generate_debugline() does. */
+    for (cur = dbg->de_lines; cur; cur = cur->dpl_next) {
+        switch (cur->dpl_opc) {
+        case 0:
+            deltas[i].ld_fadv = (cur->dpl_address - addr)/minlen;
+            deltas[i].ld_line_adv = (int)(cur->dpl_line - line);
+            deltas[i].ld_count = 1;
+            ++i;
+            addr = cur->dpl_address;
+            line = cur->dpl_line;
+            break;
+        case DW_LNE_set_address:
+            addr = cur->dpl_address;
+            break;
+        case DW_LNE_end_sequence:
+            addr = 0;
+            line = 1;
+            break;
+        default:
+            break;
+        }
+    }
+    qsort(deltas,(size_t)rowcount,sizeof(struct Dwarf_Line_Delta_s),
+        line_delta_compare);
+    for (i = 0; i < rowcount; ++i) {
+        if (ndistinct && !line_delta_compare(deltas+ndistinct-1,
+            deltas+i)) {
+            deltas[ndistinct-1].ld_count++;
+            continue;
+        }
+        deltas[ndistinct++] = deltas[i];
+    }
+
+    best_size = (Dwarf_Unsigned)-1;
+    for (line_range = 1; line_range <= OPT_LINE_RANGE_MAX &&
+        line_range <= (int)(MAX_OPCODE - opcode_base);
+        ++line_range) {
+        int line_base = 0;
+
+        for (line_base = 1 - line_range; line_base <= 0;
+            ++line_base) {
+            Dwarf_Unsigned size = 0;
+
+            for (i = 0; i < ndistinct && size < best_size; ++i) {
+                Dwarf_Bool advance_line = FALSE;
+                int how = 0;
+
+                size += deltas[i].ld_count *
+                    plan_line_row(line_base,line_range,
+                    opcode_base,deltas[i].ld_fadv,
+                    deltas[i].ld_line_adv,&advance_line,&how);
+            }
+            if (size < best_size) {
+                best_size = size;
+                best_base = line_base;
+                best_range = line_range;
+            }
+        }
+    }
+    free(deltas);
+    if (best_range) {
+        inits->pi_line_base = best_base;
+        inits->pi_line_range = best_range;
+    }
+    return DW_DLV_OK;
+}
+
 /* Generate debug_line section
    Dwarf2, dwarf3 headers are the same (DW3 acknowledges 64bit).
    DWARF4 adds the maximum_operations_per_instruction field.
@@ -1281,6 +1682,7 @@ _dwarf_pro_generate_debugline(Dwarf_P_Debug dbg,
     Dwarf_P_Line curline = 0;
     Dwarf_P_Line prevline = 0;
     struct Dwarf_P_Line_Inits_s *inits = 0;
+    struct Dwarf_P_F_Entry_s dir0;
 
     /* all data named cur* are used to loop thru linked lists */
 
@@ -1309,8 +1711,16 @@ _dwarf_pro_generate_debugline(Dwarf_P_Debug dbg,
         res  = calculate_size_of_line_header4(dbg,inits,&prolog_size,
             error);
     } else if (version == 5) {
-        res  = calculate_size_of_line_header5(dbg,inits,&prolog_size,
-            error);
+        setup_line_formats5(dbg,inits);
+        memset(&dir0,0,sizeof(dir0));
+        /*  Directory 0 is the compilation directory,
+            file 0 the primary source file, which we take
+            to be the first file declared. So the
+            1-based indexes of dwarf_add_directory_decl_a()
+            and dwarf_add_file_decl_a() stay correct. */
+        dir0.dfe_name = dbg->de_comp_dir? dbg->de_comp_dir:".";
+        res  = calculate_size_of_line_header5(dbg,inits,&dir0,
+            &prolog_size,error);
     } else {
         _dwarf_p_error(dbg, error,DW_DLE_VERSION_STAMP_ERROR );
         return DW_DLV_ERROR;
@@ -1318,6 +1728,12 @@ _dwarf_pro_generate_debugline(Dwarf_P_Debug dbg,
     if (res != DW_DLV_OK) {
         return res;
     }
+    if (dbg->de_optimize_line_table) {
+        res = choose_line_base_and_range(dbg,inits,error);
+        if (res != DW_DLV_OK) {
+            return res;
+        }
+    }
     /* Allocate a chunk, put address in 'data' */
     GET_CHUNK_ERR(dbg, elfsectno, data, prolog_size, error);
 
@@ -1444,6 +1860,7 @@ _dwarf_pro_generate_debugline(Dwarf_P_Debug dbg,
         {
             unsigned dir_count_len = 0;
             res = determine_file_content_size(dbg,
+                &dir0,
                 dbg->de_inc_dirs,
                 inits->pi_directory_entry_format_count,
                 inits->pi_incformats,
@@ -1471,6 +1888,7 @@ _dwarf_pro_generate_debugline(Dwarf_P_Debug dbg,
         {
             unsigned file_count_len = 0;
             res = determine_file_content_size(dbg,
+                dbg->de_file_entries,
                 dbg->de_file_entries,
                 dbg->de_line_inits.pi_file_entry_format_count,
                 dbg->de_line_inits.pi_fileformats,
@@ -1642,8 +2060,6 @@ _dwarf_pro_generate_debugline(Dwarf_P_Debug dbg,
                 if (res != DW_DLV_OK) {
                     return res;
                 }
-                val_len++;
-
                 res = write_uval(val_len +1,dbg,elfsectno,
                     &writelen,error);
                 if (res != DW_DLV_OK) {
@@ -1769,7 +2185,6 @@ _dwarf_pro_generate_debugline(Dwarf_P_Debug dbg,
                 if (res != DW_DLV_OK) {
                     return res;
                 }
-                val_len ++;
                 res = write_uval(val_len +1,dbg,elfsectno,
                     &writelen,error);
                 if (res != DW_DLV_OK) {
@@ -1801,8 +2216,21 @@ _dwarf_pro_generate_debugline(Dwarf_P_Debug dbg,
                 DWARF_P_DBG_ERROR(dbg, DW_DLE_WRONG_ADDRESS,
                     DW_DLV_ERROR);
             }
-            opc = _dwarf_pro_get_opc(inits,addr_adv, line_adv);
-            if (opc > 0) {
+            opc = dbg->de_optimize_line_table? 0 :
+                _dwarf_pro_get_opc(inits,addr_adv, line_adv);
+            if (dbg->de_optimize_line_table) {
+                res = write_line_row(dbg,inits,elfsectno,
+                    addr_adv/inits->pi_minimum_instruction_length,
+                    line_adv,&writelen,error);
+                if (res != DW_DLV_OK) {
+                    return res;
+                }
+                sum_bytes += writelen;
+                no_lns_copy = 1;
+                prevline->dpl_basic_block = FALSE;
+                prevline->dpl_address = curline->dpl_address;
+                prevline->dpl_line = curline->dpl_line;
+            } else if (opc > 0) {
                 /* Use special opcode. */
                 no_lns_copy = 1;
                 res = write_ubyte(opc,dbg,elfsectno,&writelen,error);
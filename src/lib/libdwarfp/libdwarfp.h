@@ -211,6 +211,21 @@ DWP_API int dwarf_get_section_bytes_a(Dwarf_P_Debug /*dbg*/,
     Dwarf_Ptr     *  /*section_bytes*/,
     Dwarf_Error*     /*error*/);
 
+/*  New 2026. Requires compress_type=1 (zlib) or
+    compress_type=2 (zstd) in the producer_init extras.
+    Given the complete final bytes of one section returns
+    an Elf Chdr followed by the compressed data, to be
+    written with SHF_COMPRESSED set.
+    Returns DW_DLV_NO_ENTRY if compression was not asked
+    for or would not make the section smaller. */
+DWP_API int dwarf_compress_section_bytes(Dwarf_P_Debug /*dbg*/,
+    Dwarf_Ptr        /*section_bytes*/,
+    Dwarf_Unsigned   /*length*/,
+    Dwarf_Unsigned   /*section_alignment*/,
+    Dwarf_Ptr      * /*compressed_bytes*/,
+    Dwarf_Unsigned * /*compressed_length*/,
+    Dwarf_Error*     /*error*/);
+
 DWP_API int  dwarf_get_relocation_info_count(
     Dwarf_P_Debug    /*dbg*/,
     Dwarf_Unsigned * /*count_of_relocation_sections*/,
@@ -459,6 +474,18 @@ DWP_API int dwarf_add_file_decl_a(Dwarf_P_Debug /*dbg*/,
     Dwarf_Unsigned * /*file_entry_count_out*/,
     Dwarf_Error*    /*error*/);
 
+/*  New October 2026. As dwarf_add_file_decl_a()
+    plus the MD5 of the file (NULL if unknown),
+    emitted in a DWARF5 line table header. */
+DWP_API int dwarf_add_file_decl_b(Dwarf_P_Debug /*dbg*/,
+    char*           /*name*/,
+    Dwarf_Unsigned  /*dir_index*/,
+    Dwarf_Unsigned  /*time_last_modified*/,
+    Dwarf_Unsigned  /*length*/,
+    Dwarf_Form_Data16 * /*md5_or_null*/,
+    Dwarf_Unsigned * /*file_entry_count_out*/,
+    Dwarf_Error*    /*error*/);
+
 /*  New December 2018. Preferred version. */
 DWP_API int dwarf_add_line_entry_c(Dwarf_P_Debug /*dbg*/,
     Dwarf_Unsigned  /*file_index*/,
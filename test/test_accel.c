@@ -0,0 +1,303 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Tests dwarf_accel_sources(), dwarf_accel_lookup_name()
+    and dwarf_accel_lookup_addr().
+    testaccelLE64ELf5a.testme (see testaccelLE64ELfsource3.c)
+    has .debug_names and .debug_aranges covering both of
+    its units, so those sections must be chosen.
+    testaccelLE64ELf5b.testme has them for its first unit
+    only, so both lookups must fall back to the DIEs
+    and still find the names and code of the second unit.
+    .debug_aranges also lists the data of each unit,
+    which the unit DIE ranges do not.
+
+    ./test_accel -f <top source directory>
+    or set environment variable DWTOPSRCDIR. */
+
+#include <config.h>
+
+#include <stdio.h>  /* printf() */
+#include <string.h> /* strcmp() */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "testobj_util.h"
+
+#define TRUE 1
+#define FALSE 0
+
+#define MATCH_MAX 8
+
+#define CU1 0xc
+#define CU2 0x8c
+
+struct name_s {
+    const char *n_name;
+    Dwarf_Half  n_tag;
+    unsigned    n_count;
+};
+
+struct addr_s {
+    Dwarf_Addr a_pc;
+    Dwarf_Off  a_cu;    /* 0 for DW_DLV_NO_ENTRY */
+};
+
+/*  accel_Mode and accel_mode have the same hash. */
+static const struct name_s names_a[] = {
+    { "point",       DW_TAG_structure_type, 2 },
+    { "int",         DW_TAG_base_type,      2 },
+    { "accel_one",   DW_TAG_subprogram,     1 },
+    { "accel_two",   DW_TAG_subprogram,     1 },
+    { "accel_count", DW_TAG_variable,       1 },
+    { "accel_total", DW_TAG_variable,       1 },
+    { "accel_Mode",  DW_TAG_variable,       1 },
+    { "accel_mode",  DW_TAG_variable,       1 },
+    { "ACCEL_MODE",  0, 0 },
+    { "accel_three", 0, 0 },
+    { "p",           0, 0 },
+    { "",            0, 0 },
+    { 0, 0, 0 }
+};
+static const struct addr_s addrs_a[] = {
+    { 0xfff,  0 },
+    { 0x1000, CU1 },
+    { 0x1008, CU1 },
+    { 0x1009, 0 },
+    { 0x1010, CU2 },
+    { 0x1019, CU2 },
+    { 0x101a, 0 },
+    /*  Data, found only in .debug_aranges. */
+    { 0x4000, CU1 },
+    { 0x400c, CU2 },
+    { 0, 0 }
+};
+
+static const struct name_s names_b[] = {
+    { "point",       DW_TAG_structure_type, 2 },
+    { "int",         DW_TAG_base_type,      2 },
+    { "accel_one",   DW_TAG_subprogram,     1 },
+    { "accel_three", DW_TAG_subprogram,     1 },
+    { "accel_count", DW_TAG_variable,       1 },
+    { "accel_scale", DW_TAG_variable,       1 },
+    { "accel_Mode",  DW_TAG_variable,       1 },
+    { "accel_mode",  DW_TAG_variable,       1 },
+    { "ACCEL_MODE",  0, 0 },
+    { "accel_two",   0, 0 },
+    { "p",           0, 0 },
+    { 0, 0, 0 }
+};
+static const struct addr_s addrs_b[] = {
+    { 0xfff,  0 },
+    { 0x1000, CU1 },
+    { 0x1008, CU1 },
+    { 0x1009, 0 },
+    { 0x1010, CU2 },
+    { 0x101c, CU2 },
+    { 0x101d, 0 },
+    { 0x4000, 0 },
+    { 0, 0 }
+};
+
+/*  The DIE at offset must have the name and tag. */
+static void
+check_die(Dwarf_Debug dbg,Dwarf_Off offset,Dwarf_Bool is_info,
+    const char *name,Dwarf_Half tag)
+{
+    Dwarf_Die die = 0;
+    Dwarf_Half dtag = 0;
+    char *dname = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_offdie_b(dbg,offset,is_info,&die,&err);
+    check_int("dwarf_offdie_b",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        return;
+    }
+    res = dwarf_diename(die,&dname,&err);
+    check_int("dwarf_diename",DW_DLV_OK,res,__LINE__);
+    if (res == DW_DLV_OK) {
+        check_string("DIE name",name,dname,__LINE__);
+    }
+    dwarf_tag(die,&dtag,&err);
+    check_unsigned("DIE tag",tag,dtag,__LINE__);
+    dwarf_dealloc_die(die);
+}
+
+/*  Looks up each name with dwarf_accel_lookup_name()
+    and checks the DIEs found are those named, and
+    the same as the DIE name index has. */
+static void
+check_names(Dwarf_Debug dbg,const struct name_s *names)
+{
+    Dwarf_Name_Index nx = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_name_index(dbg,&nx,0,&err);
+    check_int("dwarf_name_index",DW_DLV_OK,res,__LINE__);
+    for ( ; names->n_name; ++names) {
+        Dwarf_Off offsets[MATCH_MAX];
+        Dwarf_Bool is_info[MATCH_MAX];
+        Dwarf_Half tags[MATCH_MAX];
+        Dwarf_Unsigned count = 0;
+        Dwarf_Unsigned first = 0;
+        Dwarf_Unsigned ncount = 0;
+        Dwarf_Unsigned i = 0;
+
+        res = dwarf_accel_lookup_name(dbg,names->n_name,
+            MATCH_MAX,offsets,is_info,tags,&count,&err);
+        if (!names->n_count) {
+            check_int(names->n_name,DW_DLV_NO_ENTRY,res,__LINE__);
+            continue;
+        }
+        check_int(names->n_name,DW_DLV_OK,res,__LINE__);
+        if (res != DW_DLV_OK) {
+            continue;
+        }
+        check_unsigned(names->n_name,names->n_count,count,
+            __LINE__);
+        for (i = 0; i < count && i < MATCH_MAX; ++i) {
+            Dwarf_Unsigned j = 0;
+
+            check_unsigned("match tag",names->n_tag,tags[i],
+                __LINE__);
+            check_die(dbg,offsets[i],is_info[i],names->n_name,
+                names->n_tag);
+            for (j = 0; j < i; ++j) {
+                if (offsets[j] == offsets[i]) {
+                    printf("FAIL %s DIE 0x%llx found twice\n",
+                        names->n_name,
+                        (unsigned long long)offsets[i]);
+                    ++errcount;
+                }
+            }
+        }
+
+        /*  The DIE name index must agree. */
+        if (!nx) {
+            continue;
+        }
+        res = dwarf_name_index_lookup(nx,names->n_name,&first,
+            &ncount,&err);
+        check_int("dwarf_name_index_lookup",DW_DLV_OK,res,
+            __LINE__);
+        if (res != DW_DLV_OK) {
+            continue;
+        }
+        check_unsigned("name index count",count,ncount,__LINE__);
+        for (i = first; i < first + ncount; ++i) {
+            Dwarf_Off offset = 0;
+            Dwarf_Unsigned j = 0;
+
+            dwarf_name_index_entry(nx,i,0,0,0,&offset,0,0,0,&err);
+            for (j = 0; j < count && j < MATCH_MAX; ++j) {
+                if (offsets[j] == offset) {
+                    break;
+                }
+            }
+            if (j == count || j == MATCH_MAX) {
+                printf("FAIL %s DIE 0x%llx of the name index "
+                    "not found\n",names->n_name,
+                    (unsigned long long)offset);
+                ++errcount;
+            }
+        }
+    }
+}
+
+static void
+check_addrs(Dwarf_Debug dbg,const struct addr_s *addrs)
+{
+    for ( ; addrs->a_pc; ++addrs) {
+        Dwarf_Off cu = 0;
+        Dwarf_Error err = 0;
+        int res = 0;
+
+        res = dwarf_accel_lookup_addr(dbg,addrs->a_pc,&cu,&err);
+        if (!addrs->a_cu) {
+            check_int("dwarf_accel_lookup_addr none",
+                DW_DLV_NO_ENTRY,res,__LINE__);
+            continue;
+        }
+        check_int("dwarf_accel_lookup_addr",DW_DLV_OK,res,
+            __LINE__);
+        check_unsigned("unit of pc",addrs->a_cu,cu,__LINE__);
+    }
+}
+
+static void
+test_object(const char *objname,int name_source,
+    int addr_source,const struct name_s *names,
+    const struct addr_s *addrs)
+{
+    Dwarf_Debug dbg = open_obj(objname);
+    Dwarf_Unsigned count = 0;
+    Dwarf_Off offset = 0;
+    Dwarf_Error err = 0;
+    int nsource = DW_ACCEL_NONE;
+    int asource = DW_ACCEL_NONE;
+    int res = 0;
+
+    printf("Object %s\n",objname);
+    res = dwarf_accel_sources(dbg,&nsource,&asource,&err);
+    check_int("dwarf_accel_sources",DW_DLV_OK,res,__LINE__);
+    check_int("name source",name_source,nsource,__LINE__);
+    check_int("address source",addr_source,asource,__LINE__);
+    check_names(dbg,names);
+    check_addrs(dbg,addrs);
+
+    /*  Fewer slots than matches, and none at all. */
+    res = dwarf_accel_lookup_name(dbg,"point",1,&offset,0,0,
+        &count,&err);
+    check_int("lookup short",DW_DLV_OK,res,__LINE__);
+    check_unsigned("lookup short count",2,count,__LINE__);
+    count = 0;
+    res = dwarf_accel_lookup_name(dbg,"point",0,0,0,0,&count,
+        &err);
+    check_int("lookup count only",DW_DLV_OK,res,__LINE__);
+    check_unsigned("lookup count only",2,count,__LINE__);
+    dwarf_finish(dbg);
+}
+
+int
+main(int argc, char **argv)
+{
+    testobj_srcdir(argc,argv);
+    test_object("testaccelLE64ELf5a.testme",DW_ACCEL_DEBUG_NAMES,
+        DW_ACCEL_ARANGES,names_a,addrs_a);
+    test_object("testaccelLE64ELf5b.testme",DW_ACCEL_DIES,
+        DW_ACCEL_DIES,names_b,addrs_b);
+    testobj_exit("test_accel");
+    return 0;
+}
@@ -0,0 +1,288 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Tests dwarf_archive_open(), dwarf_archive_member(),
+    dwarf_archive_init_member() and dwarf_archive_close()
+    on the archives of testarchiveLE64ELfsource.c:
+    testarchiveLE64ELf.a (GNU, with a // long name),
+    testarchiveLE64ELfbsd.a (BSD, with #1/ names) and
+    testarchivetruncLE64ELf.a, which ends inside
+    a member header.
+    Both objects of an archive are opened at once and
+    read alternately through the one archive fd.
+
+    ./test_archive -f <top source directory>
+    or set environment variable DWTOPSRCDIR. */
+
+#include <config.h>
+
+#include <stdio.h>  /* FILE fclose() fopen() fread() fseek()
+    printf() */
+#include <string.h> /* memcmp() strcpy() strstr() */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "testobj_util.h"
+
+#define TRUE 1
+#define FALSE 0
+
+#define MEMBER_COUNT 3
+
+struct member_s {
+    const char    *m_name;
+    Dwarf_Unsigned m_size;
+    unsigned       m_ftype;
+    /*  The start of the member data. */
+    const char    *m_data;
+    unsigned       m_datalen;
+};
+
+static const struct member_s members[MEMBER_COUNT] = {
+    { "testarchive_first_part.o", 2760, DW_FTYPE_ELF,
+        "\177ELF", 4 },
+    { "second.o", 2528, DW_FTYPE_ELF, "\177ELF", 4 },
+    { "notes.txt", 14, DW_FTYPE_UNKNOWN, "not an object\n", 14 }
+};
+
+/*  The member data must be at offset in the file. */
+static void
+check_data(const char *path,Dwarf_Unsigned offset,
+    const struct member_s *m)
+{
+    char buf[20];
+    FILE *f = fopen(path,"rb");
+
+    if (!f) {
+        printf("FAIL cannot open %s\n",path);
+        ++errcount;
+        return;
+    }
+    if (fseek(f,(long)offset,SEEK_SET) ||
+        fread(buf,1,m->m_datalen,f) != m->m_datalen ||
+        memcmp(buf,m->m_data,m->m_datalen)) {
+        printf("FAIL %s: %s not at offset 0x%llx\n",path,
+            m->m_name,(unsigned long long)offset);
+        ++errcount;
+    }
+    fclose(f);
+}
+
+static void
+check_archive_error(const char *msg,Dwarf_Error err,int res,
+    int line)
+{
+    check_int(msg,DW_DLV_ERROR,res,line);
+    if (res == DW_DLV_ERROR) {
+        check_int(msg,DW_DLE_ARCHIVE_ERROR,
+            (int)dwarf_errno(err),line);
+        dwarf_dealloc_error(0,err);
+    }
+}
+
+/*  Returns the DWARF version of the first CU of dbg
+    and sets *fname to the name of its first
+    subprogram, 0 if there is none. */
+static Dwarf_Half
+first_function(Dwarf_Debug dbg,const char **fname)
+{
+    Dwarf_Die cu_die = 0;
+    Dwarf_Die cur = 0;
+    Dwarf_Half version = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    *fname = 0;
+    res = dwarf_next_cu_header_e(dbg,TRUE,&cu_die,0,&version,0,
+        0,0,0,0,0,0,0,&err);
+    check_int("dwarf_next_cu_header_e",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        return 0;
+    }
+    res = dwarf_child(cu_die,&cur,&err);
+    dwarf_dealloc_die(cu_die);
+    while (res == DW_DLV_OK) {
+        Dwarf_Die sib = 0;
+        Dwarf_Half tag = 0;
+        char *name = 0;
+
+        if (dwarf_tag(cur,&tag,&err) == DW_DLV_OK &&
+            tag == DW_TAG_subprogram &&
+            dwarf_diename(cur,&name,&err) == DW_DLV_OK) {
+            *fname = name;
+            dwarf_dealloc_die(cur);
+            break;
+        }
+        res = dwarf_siblingof_c(cur,&sib,&err);
+        dwarf_dealloc_die(cur);
+        cur = sib;
+    }
+    return version;
+}
+
+static void
+test_archive(const char *arname)
+{
+    char path[2000];
+    Dwarf_Archive ar = 0;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Unsigned i = 0;
+    Dwarf_Debug dbg1 = 0;
+    Dwarf_Debug dbg2 = 0;
+    Dwarf_Debug dbg3 = 0;
+    Dwarf_Error err = 0;
+    const char *name1 = 0;
+    const char *name2 = 0;
+    Dwarf_Half version = 0;
+    int res = 0;
+
+    printf("Archive %s\n",arname);
+    strcpy(path,test_obj_path(arname));
+    res = dwarf_archive_open(path,&ar,&count,&err);
+    check_int("dwarf_archive_open",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        if (res == DW_DLV_ERROR) {
+            printf("    %s\n",dwarf_errmsg(err));
+            dwarf_dealloc_error(0,err);
+        }
+        return;
+    }
+    /*  The symbol index is not a member. */
+    check_unsigned("member count",MEMBER_COUNT,count,__LINE__);
+    for (i = 0; i < count && i < MEMBER_COUNT; ++i) {
+        const struct member_s *m = &members[i];
+        const char *name = 0;
+        Dwarf_Unsigned offset = 0;
+        Dwarf_Unsigned size = 0;
+        unsigned ftype = 0;
+
+        res = dwarf_archive_member(ar,i,&name,&offset,&size,
+            &ftype,&err);
+        check_int("dwarf_archive_member",DW_DLV_OK,res,__LINE__);
+        if (res != DW_DLV_OK) {
+            continue;
+        }
+        check_string("member name",m->m_name,name,__LINE__);
+        check_unsigned("member size",m->m_size,size,__LINE__);
+        check_unsigned("member ftype",m->m_ftype,ftype,__LINE__);
+        check_data(path,offset,m);
+    }
+
+    /*  A member number past the end. */
+    res = dwarf_archive_member(ar,count,0,0,0,0,&err);
+    check_archive_error("dwarf_archive_member bad index",err,res,
+        __LINE__);
+    res = dwarf_archive_init_member(ar,count,
+        DW_GROUPNUMBER_ANY,0,0,&dbg3,&err);
+    check_archive_error("dwarf_archive_init_member bad index",
+        err,res,__LINE__);
+    /*  Not an object. */
+    res = dwarf_archive_init_member(ar,2,DW_GROUPNUMBER_ANY,0,0,
+        &dbg3,&err);
+    check_int("init text member",DW_DLV_NO_ENTRY,res,__LINE__);
+
+    /*  Both objects open at once, read alternately. */
+    res = dwarf_archive_init_member(ar,0,DW_GROUPNUMBER_ANY,0,0,
+        &dbg1,&err);
+    check_int("init member 0",DW_DLV_OK,res,__LINE__);
+    res = dwarf_archive_init_member(ar,1,DW_GROUPNUMBER_ANY,0,0,
+        &dbg2,&err);
+    check_int("init member 1",DW_DLV_OK,res,__LINE__);
+    if (dbg1 && dbg2) {
+        version = first_function(dbg2,&name2);
+        check_unsigned("member 1 version",4,version,__LINE__);
+        version = first_function(dbg1,&name1);
+        check_unsigned("member 0 version",5,version,__LINE__);
+        check_string("member 1 function","archive_second",name2,
+            __LINE__);
+        check_string("member 0 function","archive_first",name1,
+            __LINE__);
+    }
+    if (dbg1) {
+        dwarf_finish(dbg1);
+    }
+    /*  The other member still reads after one is closed. */
+    if (dbg2) {
+        dwarf_finish(dbg2);
+        dbg2 = 0;
+        res = dwarf_archive_init_member(ar,1,DW_GROUPNUMBER_ANY,
+            0,0,&dbg2,&err);
+        check_int("reopen member 1",DW_DLV_OK,res,__LINE__);
+        if (res == DW_DLV_OK) {
+            version = first_function(dbg2,&name2);
+            check_string("member 1 function again",
+                "archive_second",name2,__LINE__);
+            dwarf_finish(dbg2);
+        }
+    }
+    dwarf_archive_close(ar);
+}
+
+static void
+test_bad_archives(void)
+{
+    Dwarf_Archive ar = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_archive_open(
+        test_obj_path("testarchivetruncLE64ELf.a"),&ar,0,&err);
+    check_int("truncated archive",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        check_int("truncated archive",DW_DLE_ARCHIVE_ERROR,
+            (int)dwarf_errno(err),__LINE__);
+        check_int("truncated message",TRUE,
+            strstr(dwarf_errmsg(err),"truncated member header") != 0,
+            __LINE__);
+        dwarf_dealloc_error(0,err);
+    } else if (res == DW_DLV_OK) {
+        dwarf_archive_close(ar);
+    }
+    ar = 0;
+    res = dwarf_archive_open(
+        test_obj_path("testrangesLE64ELf5.testme"),&ar,0,&err);
+    check_int("not an archive",DW_DLV_NO_ENTRY,res,__LINE__);
+    if (res == DW_DLV_OK) {
+        dwarf_archive_close(ar);
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    testobj_srcdir(argc,argv);
+    test_archive("testarchiveLE64ELf.a");
+    test_archive("testarchiveLE64ELfbsd.a");
+    test_bad_archives();
+    testobj_exit("test_archive");
+    return 0;
+}
@@ -0,0 +1,102 @@
+#!/bin/sh
+# Copyright (C) 2026 David Anderson
+# This script is hereby placed in the Public Domain
+# for anyone to use in any way for any purpose.
+#
+# Tests dwarfdump --check-cache.  Checks
+# testcheckcacheLE64ELf?a.testme with a new cache,
+# then testcheckcacheLE64ELf?b.testme, which differs
+# only in its second CU, with that cache.  The first
+# and third CUs must be reused and each output
+# (less the cache line) must be the same as
+# checking without a cache.
+#
+# To call this:
+# Either set arg1 to the top source dir
+# or set env var DWTOPSRCDIR to the top source dir.
+# With meson set arg2 to ninja.
+y=
+if [ $# -gt 0  ]
+then
+  t="$1"
+  if [ $# -gt 1  ]
+  then
+    y="$2"
+  fi
+else
+  if [ x$DWTOPSRCDIR = "x" ]
+  then
+    # Running from the source tree
+    t=`pwd`/..
+  else
+    # Running outside of source tree (the usual case)
+    t=$DWTOPSRCDIR
+  fi
+fi
+. $t/test/test_dwarfdumpsetup.sh $t $y
+localsrc=$top_srcdir/test
+cache=junk.checkcache.cache
+fails=0
+
+# Runs dwarfdump -ka -ks on $1, with the cache
+# and without, and compares.  $2 is the cache
+# line expected.
+runone() {
+  obj=$localsrc/$1
+  want="$2"
+  tx=junk.checkcache.$1
+  tx0=junk.checkcache0.$1
+  $dd -ka -ks $obj > $tx0
+  r=$?
+  chkres $r "test_checkcache.sh $dd -ka -ks $obj"
+  if [ $r -ne 0 ]
+  then
+    fails=`expr $fails + 1`
+    return
+  fi
+  $dd -ka -ks --check-cache=$cache $obj > $tx
+  r=$?
+  chkres $r "test_checkcache.sh $dd -ka -ks --check-cache $obj"
+  if [ $r -ne 0 ]
+  then
+    fails=`expr $fails + 1`
+    return
+  fi
+  got=`grep "^Check cache:" $tx`
+  if [ "x$got" != "x$want" ]
+  then
+    echo "FAIL test_checkcache.sh $1: got \"$got\" want \"$want\""
+    fails=`expr $fails + 1`
+  fi
+  grep -v "^Check cache:" $tx > $tx.nocache
+  diff $tx0 $tx.nocache
+  r=$?
+  if [ $r -ne 0 ]
+  then
+    echo "FAIL test_checkcache.sh $1 output differs with the cache"
+    fails=`expr $fails + 1`
+  fi
+  rm -f $tx $tx0 $tx.nocache
+}
+
+for v in 4 5
+do
+  rm -f $cache
+  runone testcheckcacheLE64ELf${v}a.testme \
+    "Check cache: 0 CUs reused, 3 checked"
+  runone testcheckcacheLE64ELf${v}b.testme \
+    "Check cache: 2 CUs reused, 1 checked"
+  # The cache now holds the b CUs, so checking
+  # b again reuses all of them.
+  runone testcheckcacheLE64ELf${v}b.testme \
+    "Check cache: 3 CUs reused, 0 checked"
+done
+rm -f $cache
+rm -f dwarfdump.conf
+if [ $fails -ne 0 ]
+then
+  echo "FAIL test_checkcache.sh $fails failures"
+  exit 1
+fi
+echo "PASS test_checkcache.sh"
+exit 0
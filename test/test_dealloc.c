@@ -0,0 +1,472 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Tests the tracking of allocations that lets
+    dwarf_finish() free whatever the caller did not
+    dwarf_dealloc().  Records are dealloc'd in an
+    order unlike the order they were made in,
+    some are left for dwarf_finish(), some are
+    made while tracking is off with
+    dwarf_set_de_alloc_flag(0), and strings that
+    point into section data are passed to
+    dwarf_dealloc() as DW_DLA_STRING, which must do
+    nothing.  The records left must still be usable.
+    Most of what this checks is that nothing is freed
+    twice, freed early or leaked, so it is most
+    useful built with -fsanitize=address.
+
+    ./test_dealloc -f <top source directory>
+    or set environment variable DWTOPSRCDIR. */
+
+#include <config.h>
+
+#include <stdio.h>  /* printf() */
+#include <string.h> /* strcmp() strcpy() strlen() */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "testobj_util.h"
+
+static const char *objects[] = {
+"dummyexecutable.debug",
+"testnamesLE64ELf5.testme",
+0
+};
+
+#define DIES_MAX 400
+
+/*  Each DIE of an object, got again with
+    dwarf_offdie_b() so each is a record of its own. */
+struct dies_s {
+    Dwarf_Debug d_dbg;
+    Dwarf_Off   d_offset[DIES_MAX];
+    Dwarf_Half  d_tag[DIES_MAX];
+    Dwarf_Die   d_die[DIES_MAX];
+    Dwarf_Attribute *d_attrs[DIES_MAX];
+    Dwarf_Signed d_attrcount[DIES_MAX];
+    int         d_count;
+};
+
+/*  Records the offset and tag of die, its children
+    and its later siblings. */
+static void
+record_dies(struct dies_s *d,Dwarf_Die die)
+{
+    Dwarf_Die cur = die;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    for (;;) {
+        Dwarf_Die child = 0;
+        Dwarf_Die sib = 0;
+
+        if (d->d_count < DIES_MAX) {
+            dwarf_dieoffset(cur,&d->d_offset[d->d_count],&err);
+            dwarf_tag(cur,&d->d_tag[d->d_count],&err);
+            ++d->d_count;
+        }
+        res = dwarf_child(cur,&child,&err);
+        check_int("dwarf_child",1,res != DW_DLV_ERROR,__LINE__);
+        if (res == DW_DLV_OK) {
+            record_dies(d,child);
+            dwarf_dealloc_die(child);
+        }
+        res = dwarf_siblingof_c(cur,&sib,&err);
+        check_int("dwarf_siblingof_c",1,res != DW_DLV_ERROR,
+            __LINE__);
+        if (cur != die) {
+            dwarf_dealloc_die(cur);
+        }
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        cur = sib;
+    }
+}
+
+static void
+record_object(struct dies_s *d,Dwarf_Debug dbg)
+{
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    d->d_dbg = dbg;
+    d->d_count = 0;
+    for (;;) {
+        Dwarf_Die cu_die = 0;
+
+        res = dwarf_next_cu_header_e(dbg,1,&cu_die,
+            0,0,0,0,0,0,0,0,0,0,&err);
+        if (res != DW_DLV_OK) {
+            check_int("dwarf_next_cu_header_e",DW_DLV_NO_ENTRY,
+                res,__LINE__);
+            break;
+        }
+        record_dies(d,cu_die);
+        dwarf_dealloc_die(cu_die);
+    }
+    if (d->d_count < 40) {
+        printf("FAIL only %d DIEs\n",d->d_count);
+        ++errcount;
+    }
+}
+
+/*  Gets each recorded DIE and its attributes. */
+static void
+get_dies(struct dies_s *d)
+{
+    Dwarf_Error err = 0;
+    int i = 0;
+    int res = 0;
+
+    for (i = 0; i < d->d_count; ++i) {
+        d->d_die[i] = 0;
+        d->d_attrs[i] = 0;
+        d->d_attrcount[i] = 0;
+        res = dwarf_offdie_b(d->d_dbg,d->d_offset[i],1,
+            &d->d_die[i],&err);
+        check_int("dwarf_offdie_b",DW_DLV_OK,res,__LINE__);
+        if (res != DW_DLV_OK) {
+            d->d_die[i] = 0;
+            continue;
+        }
+        res = dwarf_attrlist(d->d_die[i],&d->d_attrs[i],
+            &d->d_attrcount[i],&err);
+        check_int("dwarf_attrlist",1,res != DW_DLV_ERROR,
+            __LINE__);
+        if (res != DW_DLV_OK) {
+            d->d_attrs[i] = 0;
+            d->d_attrcount[i] = 0;
+        }
+    }
+}
+
+static void
+dealloc_die(struct dies_s *d,int i)
+{
+    Dwarf_Signed k = 0;
+
+    for (k = 0; k < d->d_attrcount[i]; ++k) {
+        dwarf_dealloc_attribute(d->d_attrs[i][k]);
+    }
+    if (d->d_attrs[i]) {
+        dwarf_dealloc(d->d_dbg,d->d_attrs[i],DW_DLA_LIST);
+    }
+    dwarf_dealloc_die(d->d_die[i]);
+    d->d_die[i] = 0;
+    d->d_attrs[i] = 0;
+    d->d_attrcount[i] = 0;
+}
+
+/*  Deallocs every DIE i with i%3 != keep, or all
+    of them if keep is negative, stepping through
+    the DIEs by a stride prime to the count so the
+    order is unlike the allocation order. */
+static void
+dealloc_dies(struct dies_s *d,int keep)
+{
+    int step = 0;
+    int n = d->d_count;
+
+    for (step = 0; step < n; ++step) {
+        int i = (int)(((long)step * 7919) % n);
+
+        if (!d->d_die[i]) {
+            continue;
+        }
+        if (keep >= 0 && i%3 == keep) {
+            continue;
+        }
+        dealloc_die(d,i);
+    }
+}
+
+/*  The DIEs and attributes not yet dealloc'd must
+    be intact. */
+static void
+check_dies(struct dies_s *d,int line)
+{
+    Dwarf_Error err = 0;
+    int i = 0;
+    int checked = 0;
+
+    for (i = 0; i < d->d_count; ++i) {
+        Dwarf_Off offset = 0;
+        Dwarf_Half tag = 0;
+        Dwarf_Signed k = 0;
+
+        if (!d->d_die[i]) {
+            continue;
+        }
+        ++checked;
+        dwarf_dieoffset(d->d_die[i],&offset,&err);
+        dwarf_tag(d->d_die[i],&tag,&err);
+        if (offset != d->d_offset[i] || tag != d->d_tag[i]) {
+            printf("FAIL die %d is offset 0x%llx tag 0x%x "
+                "test line %d\n",i,(unsigned long long)offset,
+                tag,line);
+            ++errcount;
+        }
+        for (k = 0; k < d->d_attrcount[i]; ++k) {
+            Dwarf_Half attrnum = 0;
+            int res = 0;
+
+            res = dwarf_whatattr(d->d_attrs[i][k],&attrnum,&err);
+            check_int("dwarf_whatattr",DW_DLV_OK,res,line);
+        }
+    }
+    if (!checked) {
+        printf("FAIL no DIEs left to check test line %d\n",line);
+        ++errcount;
+    }
+}
+
+/*  Deallocs the file names of the CU of die in
+    reverse order, all but every fourth, and checks
+    those against a second copy. */
+static void
+test_srcfiles(Dwarf_Debug dbg,Dwarf_Die cu_die)
+{
+    char **files = 0;
+    char **files2 = 0;
+    Dwarf_Signed count = 0;
+    Dwarf_Signed count2 = 0;
+    Dwarf_Signed i = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_srcfiles(cu_die,&files,&count,&err);
+    check_int("dwarf_srcfiles",1,res != DW_DLV_ERROR,__LINE__);
+    if (res != DW_DLV_OK) {
+        return;
+    }
+    res = dwarf_srcfiles(cu_die,&files2,&count2,&err);
+    check_int("dwarf_srcfiles again",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        return;
+    }
+    check_int("file count",(int)count,(int)count2,__LINE__);
+    for (i = count-1; i >= 0; --i) {
+        if (i%4) {
+            dwarf_dealloc(dbg,files[i],DW_DLA_STRING);
+            files[i] = 0;
+        }
+    }
+    for (i = 0; i < count && i < count2; ++i) {
+        if (files[i] && strcmp(files[i],files2[i])) {
+            printf("FAIL file %d is %s not %s\n",(int)i,
+                files[i],files2[i]);
+            ++errcount;
+        }
+    }
+    /*  The first list is left for dwarf_finish(),
+        with the strings not dealloc'd. */
+    for (i = 0; i < count2; ++i) {
+        dwarf_dealloc(dbg,files2[i],DW_DLA_STRING);
+    }
+    dwarf_dealloc(dbg,files2,DW_DLA_LIST);
+}
+
+/*  A name in .debug_str or .debug_info is not an
+    allocation, and dwarf_dealloc() must leave it. */
+static void
+test_section_strings(Dwarf_Debug dbg)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Die cu_die = 0;
+    char *name = 0;
+    char *name2 = 0;
+    char copy[200];
+    int res = 0;
+
+    res = dwarf_next_cu_header_e(dbg,1,&cu_die,
+        0,0,0,0,0,0,0,0,0,0,&err);
+    check_int("dwarf_next_cu_header_e",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        return;
+    }
+    res = dwarf_diename(cu_die,&name,&err);
+    check_int("dwarf_diename",DW_DLV_OK,res,__LINE__);
+    if (res == DW_DLV_OK && strlen(name) < sizeof(copy)) {
+        strcpy(copy,name);
+        dwarf_dealloc(dbg,name,DW_DLA_STRING);
+        dwarf_dealloc(dbg,name,DW_DLA_STRING);
+        check_int("name intact",0,strcmp(name,copy),__LINE__);
+        res = dwarf_diename(cu_die,&name2,&err);
+        check_int("dwarf_diename again",DW_DLV_OK,res,__LINE__);
+        check_int("same name",1,name == name2,__LINE__);
+    }
+    test_srcfiles(dbg,cu_die);
+    dwarf_dealloc_die(cu_die);
+    /*  The rest of the CUs are not read. */
+}
+
+/*  Errors made with a dbg are tracked too. */
+static void
+test_errors(Dwarf_Debug dbg)
+{
+    Dwarf_Error errs[6];
+    Dwarf_Die die = 0;
+    int i = 0;
+    int res = 0;
+
+    for (i = 0; i < 6; ++i) {
+        errs[i] = 0;
+        res = dwarf_offdie_b(dbg,0xffffff00+i,1,&die,&errs[i]);
+        check_int("dwarf_offdie_b bad offset",DW_DLV_ERROR,res,
+            __LINE__);
+    }
+    /*  Half are left for dwarf_finish(). */
+    for (i = 5; i >= 0; i -= 2) {
+        if (errs[i]) {
+            dwarf_dealloc_error(dbg,errs[i]);
+        }
+    }
+}
+
+/*  Tracked: some dealloc'd, the rest left
+    for dwarf_finish(). */
+static void
+test_tracked(const char *obj,struct dies_s *d)
+{
+    Dwarf_Debug dbg = open_obj(obj);
+
+    record_object(d,dbg);
+    get_dies(d);
+    dealloc_dies(d,0);
+    check_dies(d,__LINE__);
+    /*  Get them again, on top of those left. */
+    get_dies(d);
+    dealloc_dies(d,1);
+    check_dies(d,__LINE__);
+    test_section_strings(dbg);
+    test_errors(dbg);
+    dwarf_finish(dbg);
+}
+
+/*  Not tracked: the caller must dealloc
+    everything, in any order. */
+static void
+test_untracked(const char *obj,struct dies_s *d)
+{
+    Dwarf_Debug dbg = 0;
+    int prev = 0;
+
+    prev = dwarf_set_de_alloc_flag(0);
+    check_int("dwarf_set_de_alloc_flag(0)",1,prev,__LINE__);
+    dbg = open_obj(obj);
+    record_object(d,dbg);
+    get_dies(d);
+    dealloc_dies(d,2);
+    check_dies(d,__LINE__);
+    dealloc_dies(d,-1);
+    dwarf_finish(dbg);
+    prev = dwarf_set_de_alloc_flag(1);
+    check_int("dwarf_set_de_alloc_flag(1)",0,prev,__LINE__);
+}
+
+/*  Tracking turned off and on while a dbg is open:
+    records made while it was off are dealloc'd
+    with it on, which must not disturb the tracked
+    records left for dwarf_finish(). */
+static void
+test_switched(const char *obj,struct dies_s *d,
+    struct dies_s *d2)
+{
+    Dwarf_Debug dbg = open_obj(obj);
+
+    record_object(d,dbg);
+    *d2 = *d;
+    get_dies(d2);
+    dwarf_set_de_alloc_flag(0);
+    get_dies(d);
+    dwarf_set_de_alloc_flag(1);
+    dealloc_dies(d2,2);
+    dealloc_dies(d,-1);
+    check_dies(d2,__LINE__);
+    dwarf_finish(dbg);
+}
+
+/*  A record dealloc'd through another dbg is still
+    taken off the list of its own, so neither
+    dwarf_finish() touches it. */
+static void
+test_mixed(const char *obj,struct dies_s *d)
+{
+    Dwarf_Debug dbg = open_obj(obj);
+    Dwarf_Debug other = open_obj(obj);
+    int i = 0;
+
+    record_object(d,dbg);
+    get_dies(d);
+    /*  From the last, the head of the list. */
+    for (i = d->d_count-1; i >= 0; i -= 2) {
+        Dwarf_Signed k = 0;
+
+        if (!d->d_die[i]) {
+            continue;
+        }
+        for (k = 0; k < d->d_attrcount[i]; ++k) {
+            dwarf_dealloc(other,d->d_attrs[i][k],DW_DLA_ATTR);
+        }
+        if (d->d_attrs[i]) {
+            dwarf_dealloc(other,d->d_attrs[i],DW_DLA_LIST);
+        }
+        dwarf_dealloc(other,d->d_die[i],DW_DLA_DIE);
+        d->d_die[i] = 0;
+        d->d_attrs[i] = 0;
+        d->d_attrcount[i] = 0;
+    }
+    check_dies(d,__LINE__);
+    dwarf_finish(other);
+    check_dies(d,__LINE__);
+    dwarf_finish(dbg);
+}
+
+static struct dies_s dies;
+static struct dies_s dies2;
+
+int
+main(int argc, char **argv)
+{
+    int i = 0;
+
+    testobj_srcdir(argc,argv);
+    for (i = 0; objects[i]; ++i) {
+        test_tracked(objects[i],&dies);
+        test_untracked(objects[i],&dies);
+        test_switched(objects[i],&dies,&dies2);
+        test_mixed(objects[i],&dies);
+    }
+    testobj_exit("test_dealloc");
+    return 0;
+}
@@ -0,0 +1,429 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Tests dwarf_die_filter_create(), dwarf_die_filter_start(),
+    dwarf_die_filter_next() and dwarf_dealloc_die_filter().
+    Each filtered walk over the objects in test/ must
+    return the same DIEs, at the same levels, as a walk
+    with dwarf_child() and dwarf_siblingof_c() checking
+    dwarf_tag() and dwarf_hasattr() on every DIE.
+
+    ./test_die_filter -f <top source directory>
+    or set environment variable DWTOPSRCDIR. */
+
+#include <config.h>
+
+#include <stdio.h>  /* printf() */
+#include <stdlib.h> /* exit() free() realloc() */
+#include <string.h> /* memset() */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "testobj_util.h"
+
+struct filter_case_s {
+    const char *fc_name;
+    Dwarf_Half  fc_tags[3];
+    unsigned    fc_tag_count;
+    Dwarf_Half  fc_attrs[2];
+    unsigned    fc_attr_count;
+};
+
+static const struct filter_case_s cases[] = {
+{"all DIEs",{0,0,0},0,{0,0},0},
+{"members with a location",{DW_TAG_member,0,0},1,
+    {DW_AT_data_member_location,0},1},
+{"variables and parameters with a location",
+    {DW_TAG_variable,DW_TAG_formal_parameter,0},2,
+    {DW_AT_location,0},1},
+{"subprograms with an address range",{DW_TAG_subprogram,0,0},1,
+    {DW_AT_low_pc,DW_AT_high_pc},2},
+{"named complete structs",{DW_TAG_structure_type,0,0},1,
+    {DW_AT_name,DW_AT_byte_size},2},
+{"any tag with a type",{0,0,0},0,{DW_AT_type,0},1},
+{"an absent tag",{DW_TAG_coarray_type,0,0},1,{0,0},0},
+{0,{0,0,0},0,{0,0},0}
+};
+
+static const char *objects[] = {
+"dummyexecutable.debug",
+"testuriLE64ELf.testme",
+"testobjLE32PE.exe",
+"test-mach-o-32.dSYM",
+0
+};
+
+/*  The DIE offsets and levels one walk returns. */
+struct walk_s {
+    Dwarf_Off *w_offsets;
+    int       *w_levels;
+    unsigned   w_count;
+    unsigned   w_alloc;
+};
+
+static void
+walk_add(struct walk_s *w,Dwarf_Off off,int level)
+{
+    if (w->w_count >= w->w_alloc) {
+        unsigned newalloc = w->w_alloc? w->w_alloc*2:256;
+        Dwarf_Off *o = 0;
+        int       *l = 0;
+
+        o = (Dwarf_Off *)realloc(w->w_offsets,
+            newalloc*sizeof(Dwarf_Off));
+        l = (int *)realloc(w->w_levels,newalloc*sizeof(int));
+        if (!o || !l) {
+            printf("FAIL out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+        w->w_offsets = o;
+        w->w_levels = l;
+        w->w_alloc = newalloc;
+    }
+    w->w_offsets[w->w_count] = off;
+    w->w_levels[w->w_count] = level;
+    w->w_count++;
+}
+
+static int
+die_matches(Dwarf_Die die,const struct filter_case_s *fc)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Half tag = 0;
+    Dwarf_Bool has = 0;
+    unsigned i = 0;
+    int res = 0;
+
+    if (fc->fc_tag_count) {
+        res = dwarf_tag(die,&tag,&err);
+        check_int("dwarf_tag",DW_DLV_OK,res,__LINE__);
+        for (i = 0; i < fc->fc_tag_count; ++i) {
+            if (tag == fc->fc_tags[i]) {
+                break;
+            }
+        }
+        if (i == fc->fc_tag_count) {
+            return 0;
+        }
+    }
+    for (i = 0; i < fc->fc_attr_count; ++i) {
+        res = dwarf_hasattr(die,fc->fc_attrs[i],&has,&err);
+        check_int("dwarf_hasattr",DW_DLV_OK,res,__LINE__);
+        if (!has) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/*  The walk the filter must agree with. */
+static void
+reference_walk(Dwarf_Die die,int level,
+    const struct filter_case_s *fc,struct walk_s *w)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Die child = 0;
+    Dwarf_Off off = 0;
+    int res = 0;
+
+    if (die_matches(die,fc)) {
+        res = dwarf_dieoffset(die,&off,&err);
+        check_int("dwarf_dieoffset",DW_DLV_OK,res,__LINE__);
+        walk_add(w,off,level);
+    }
+    res = dwarf_child(die,&child,&err);
+    check_int("dwarf_child",1,res != DW_DLV_ERROR,__LINE__);
+    while (res == DW_DLV_OK) {
+        Dwarf_Die sib = 0;
+
+        reference_walk(child,level+1,fc,w);
+        res = dwarf_siblingof_c(child,&sib,&err);
+        check_int("dwarf_siblingof_c",1,res != DW_DLV_ERROR,
+            __LINE__);
+        dwarf_dealloc_die(child);
+        child = sib;
+    }
+}
+
+static void
+filter_walk(Dwarf_Die_Filter filter,Dwarf_Die die,
+    struct walk_s *w)
+{
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_die_filter_start(filter,die,&err);
+    check_int("dwarf_die_filter_start",DW_DLV_OK,res,__LINE__);
+    for (;;) {
+        Dwarf_Die d = 0;
+        Dwarf_Off off = 0;
+        int level = -1;
+
+        res = dwarf_die_filter_next(filter,&d,&level,&err);
+        if (res != DW_DLV_OK) {
+            check_int("dwarf_die_filter_next",DW_DLV_NO_ENTRY,
+                res,__LINE__);
+            break;
+        }
+        res = dwarf_dieoffset(d,&off,&err);
+        check_int("dwarf_dieoffset",DW_DLV_OK,res,__LINE__);
+        walk_add(w,off,level);
+        dwarf_dealloc_die(d);
+    }
+    /*  Stays finished. */
+    {
+        Dwarf_Die d = 0;
+
+        res = dwarf_die_filter_next(filter,&d,NULL,&err);
+        check_int("dwarf_die_filter_next after the end",
+            DW_DLV_NO_ENTRY,res,__LINE__);
+    }
+}
+
+static void
+compare_walks(const char *obj,const char *what,
+    struct walk_s *ref,struct walk_s *got)
+{
+    unsigned i = 0;
+
+    if (ref->w_count != got->w_count) {
+        printf("FAIL %s %s: reference walk %u DIEs, "
+            "filter %u\n",obj,what,ref->w_count,got->w_count);
+        ++errcount;
+        return;
+    }
+    for (i = 0; i < ref->w_count; ++i) {
+        if (ref->w_offsets[i] != got->w_offsets[i] ||
+            ref->w_levels[i] != got->w_levels[i]) {
+            printf("FAIL %s %s: DIE %u reference 0x%llx level %d"
+                " filter 0x%llx level %d\n",obj,what,i,
+                (unsigned long long)ref->w_offsets[i],
+                ref->w_levels[i],
+                (unsigned long long)got->w_offsets[i],
+                got->w_levels[i]);
+            ++errcount;
+            return;
+        }
+    }
+}
+
+/*  The first child of die that has children,
+    to test a walk that starts below the CU. */
+static int
+find_parent_die(Dwarf_Die die,Dwarf_Die *out)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Die child = 0;
+    int res = 0;
+
+    res = dwarf_child(die,&child,&err);
+    while (res == DW_DLV_OK) {
+        Dwarf_Die grandchild = 0;
+        Dwarf_Die sib = 0;
+
+        res = dwarf_child(child,&grandchild,&err);
+        if (res == DW_DLV_OK) {
+            dwarf_dealloc_die(grandchild);
+            *out = child;
+            return DW_DLV_OK;
+        }
+        res = dwarf_siblingof_c(child,&sib,&err);
+        dwarf_dealloc_die(child);
+        child = sib;
+    }
+    return DW_DLV_NO_ENTRY;
+}
+
+static void
+test_object(const char *obj)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Error err = 0;
+    Dwarf_Die_Filter filters[8];
+    unsigned ncases = 0;
+    unsigned c = 0;
+    unsigned cus = 0;
+    unsigned matched = 0;
+    int res = 0;
+
+    dbg = open_obj(obj);
+    for (ncases = 0; cases[ncases].fc_name; ++ncases) {
+        const struct filter_case_s *fc = cases+ncases;
+
+        res = dwarf_die_filter_create(dbg,fc->fc_tags,
+            fc->fc_tag_count,fc->fc_attrs,fc->fc_attr_count,
+            &filters[ncases],&err);
+        check_int("dwarf_die_filter_create",DW_DLV_OK,res,
+            __LINE__);
+        if (res != DW_DLV_OK) {
+            exit(EXIT_FAILURE);
+        }
+    }
+    /*  Each filter is restarted on every CU. */
+    for (;;) {
+        Dwarf_Die cu = 0;
+        Dwarf_Die sub = 0;
+
+        res = dwarf_next_cu_header_e(dbg,1,&cu,
+            0,0,0,0,0,0,0,0,0,0,&err);
+        if (res != DW_DLV_OK) {
+            check_int("dwarf_next_cu_header_e",DW_DLV_NO_ENTRY,
+                res,__LINE__);
+            break;
+        }
+        ++cus;
+        for (c = 0; c < ncases; ++c) {
+            struct walk_s ref;
+            struct walk_s got;
+
+            memset(&ref,0,sizeof(ref));
+            memset(&got,0,sizeof(got));
+            reference_walk(cu,0,cases+c,&ref);
+            filter_walk(filters[c],cu,&got);
+            compare_walks(obj,cases[c].fc_name,&ref,&got);
+            matched += got.w_count;
+            free(ref.w_offsets);
+            free(ref.w_levels);
+            free(got.w_offsets);
+            free(got.w_levels);
+        }
+        if (find_parent_die(cu,&sub) == DW_DLV_OK) {
+            struct walk_s ref;
+            struct walk_s got;
+
+            memset(&ref,0,sizeof(ref));
+            memset(&got,0,sizeof(got));
+            reference_walk(sub,0,cases,&ref);
+            filter_walk(filters[0],sub,&got);
+            compare_walks(obj,"subtree",&ref,&got);
+            check_int("subtree starts at level 0",0,
+                got.w_count? got.w_levels[0]:-1,__LINE__);
+            free(ref.w_offsets);
+            free(ref.w_levels);
+            free(got.w_offsets);
+            free(got.w_levels);
+            dwarf_dealloc_die(sub);
+        }
+        dwarf_dealloc_die(cu);
+    }
+    if (!cus || !matched) {
+        printf("FAIL %s: %u CUs %u DIEs\n",obj,cus,matched);
+        ++errcount;
+    }
+    for (c = 0; c < ncases; ++c) {
+        dwarf_dealloc_die_filter(filters[c]);
+    }
+    dwarf_finish(dbg);
+}
+
+static void
+test_errors(void)
+{
+    static const Dwarf_Half tags[1] = { DW_TAG_member };
+    Dwarf_Debug dbg = 0;
+    Dwarf_Debug dbg2 = 0;
+    Dwarf_Error err = 0;
+    Dwarf_Die_Filter filter = 0;
+    Dwarf_Die cu = 0;
+    Dwarf_Die d = 0;
+    int res = 0;
+
+    dbg = open_obj("dummyexecutable");
+    res = dwarf_die_filter_create(dbg,NULL,1,NULL,0,
+        &filter,&err);
+    check_int("create, NULL tags",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(dbg,err);
+        err = 0;
+    }
+    res = dwarf_die_filter_create(dbg,tags,1,NULL,0,
+        NULL,&err);
+    check_int("create, NULL filter_out",DW_DLV_ERROR,res,
+        __LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(dbg,err);
+        err = 0;
+    }
+    res = dwarf_die_filter_start(NULL,NULL,&err);
+    check_int("start, NULL filter",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(NULL,err);
+        err = 0;
+    }
+    res = dwarf_die_filter_next(NULL,&d,NULL,&err);
+    check_int("next, NULL filter",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(NULL,err);
+        err = 0;
+    }
+    res = dwarf_die_filter_create(dbg,tags,1,NULL,0,
+        &filter,&err);
+    check_int("create",DW_DLV_OK,res,__LINE__);
+    /*  Not started yet. */
+    res = dwarf_die_filter_next(filter,&d,NULL,&err);
+    check_int("next before start",DW_DLV_NO_ENTRY,res,__LINE__);
+
+    /*  A DIE of another Dwarf_Debug. */
+    dbg2 = open_obj("testuriLE64ELf.testme");
+    res = dwarf_next_cu_header_e(dbg2,1,&cu,
+        0,0,0,0,0,0,0,0,0,0,&err);
+    check_int("next cu",DW_DLV_OK,res,__LINE__);
+    if (res == DW_DLV_OK) {
+        res = dwarf_die_filter_start(filter,cu,&err);
+        check_int("start, DIE of another dbg",DW_DLV_ERROR,res,
+            __LINE__);
+        if (res == DW_DLV_ERROR) {
+            dwarf_dealloc_error(dbg2,err);
+            err = 0;
+        }
+        dwarf_dealloc_die(cu);
+    }
+    dwarf_dealloc_die_filter(filter);
+    /*  Harmless. */
+    dwarf_dealloc_die_filter(NULL);
+    dwarf_finish(dbg2);
+    dwarf_finish(dbg);
+}
+
+int
+main(int argc, char **argv)
+{
+    int i = 0;
+
+    testobj_srcdir(argc,argv);
+    for (i = 0; objects[i]; ++i) {
+        test_object(objects[i]);
+    }
+    test_errors();
+    testobj_exit("test_die_filter");
+    return 0;
+}
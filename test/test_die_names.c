@@ -0,0 +1,484 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Tests dwarf_die_resolved_names().
+    Every DIE of the objects in test/ is checked against
+    a walk that tracks the enclosing scopes itself and
+    follows DW_AT_specification and DW_AT_abstract_origin
+    with dwarf_offdie_b(). testnamesLE64ELf4.testme and
+    testnamesLE64ELf5.testme (from testnamesLE64ELfsource.cc)
+    also have their C++ names checked by value.
+
+    ./test_die_names -f <top source directory>
+    or set environment variable DWTOPSRCDIR. */
+
+#include <config.h>
+
+#include <stdio.h>  /* printf() */
+#include <stdlib.h> /* exit() free() malloc() */
+#include <string.h> /* memset() strcat() strcmp() strcpy() strlen()
+    strncmp() strstr() */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "testobj_util.h"
+
+static const char *objects[] = {
+"testnamesLE64ELf4.testme",
+"testnamesLE64ELf5.testme",
+"dummyexecutable.debug",
+"testuriLE64ELf.testme",
+"testobjLE32PE.exe",
+"test-mach-o-32.dSYM",
+0
+};
+
+/*  Expected results in the testnames objects.
+    A NULL ex_linkage is not checked, nor are the line
+    and file when ex_line is zero. */
+struct expect_s {
+    Dwarf_Half     ex_tag;
+    const char    *ex_name;
+    int            ex_has_ref;
+    const char    *ex_scope;
+    const char    *ex_linkage;
+    Dwarf_Unsigned ex_line;
+    unsigned       ex_hits;
+};
+
+static struct expect_s expects[] = {
+{DW_TAG_member,"value",0,"outer::inner::Widget",0,44,0},
+{DW_TAG_enumerator,"On",0,"outer::inner::Widget::Mode",0,0,0},
+/*  Out-of-line definitions take their scope
+    from the declaration in the class. */
+{DW_TAG_variable,"count",1,"outer::inner::Widget",
+    "_ZN5outer5inner6Widget5countE",51,0},
+{DW_TAG_subprogram,"get",1,"outer::inner::Widget",
+    "_ZNK5outer5inner6Widget3getEv",54,0},
+{DW_TAG_inlined_subroutine,"twice",1,"outer",0,61,0},
+{DW_TAG_inlined_subroutine,"get",1,"outer::inner::Widget",
+    "_ZNK5outer5inner6Widget3getEv",54,0},
+{DW_TAG_variable,"hidden",1,"(anonymous namespace)",0,74,0},
+{DW_TAG_subprogram,"file_scope",0,"","_Z10file_scopei",78,0},
+{0,0,0,0,0,0,0}
+};
+
+/*  What the walk knows of the CU. */
+struct cu_s {
+    Dwarf_Half  cu_version;
+    char      **cu_files;
+    Dwarf_Signed cu_filecount;
+};
+
+/*  Either may be NULL. */
+static const char *
+get_string_attr(Dwarf_Die die,Dwarf_Half attrnum)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Attribute attr = 0;
+    char *str = 0;
+    int res = 0;
+
+    res = dwarf_attr(die,attrnum,&attr,&err);
+    check_int("dwarf_attr",1,res != DW_DLV_ERROR,__LINE__);
+    if (res != DW_DLV_OK) {
+        return 0;
+    }
+    res = dwarf_formstring(attr,&str,&err);
+    check_int("dwarf_formstring",DW_DLV_OK,res,__LINE__);
+    dwarf_dealloc_attribute(attr);
+    return str;
+}
+
+static Dwarf_Unsigned
+get_udata_attr(Dwarf_Die die,Dwarf_Half attrnum)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Attribute attr = 0;
+    Dwarf_Unsigned val = 0;
+    int res = 0;
+
+    res = dwarf_attr(die,attrnum,&attr,&err);
+    check_int("dwarf_attr",1,res != DW_DLV_ERROR,__LINE__);
+    if (res != DW_DLV_OK) {
+        return 0;
+    }
+    res = dwarf_formudata(attr,&val,&err);
+    check_int("dwarf_formudata",DW_DLV_OK,res,__LINE__);
+    dwarf_dealloc_attribute(attr);
+    return val;
+}
+
+/*  The DIE DW_AT_specification or DW_AT_abstract_origin
+    refers to, or NULL. */
+static Dwarf_Die
+get_origin(Dwarf_Debug dbg,Dwarf_Die die)
+{
+    static const Dwarf_Half refattrs[2] = {
+        DW_AT_specification, DW_AT_abstract_origin };
+    Dwarf_Error err = 0;
+    unsigned i = 0;
+
+    for (i = 0; i < 2; ++i) {
+        Dwarf_Attribute attr = 0;
+        Dwarf_Off off = 0;
+        Dwarf_Bool is_info = 0;
+        Dwarf_Die target = 0;
+        int res = 0;
+
+        res = dwarf_attr(die,refattrs[i],&attr,&err);
+        check_int("dwarf_attr",1,res != DW_DLV_ERROR,__LINE__);
+        if (res != DW_DLV_OK) {
+            continue;
+        }
+        res = dwarf_global_formref_b(attr,&off,&is_info,&err);
+        check_int("dwarf_global_formref_b",DW_DLV_OK,res,
+            __LINE__);
+        dwarf_dealloc_attribute(attr);
+        res = dwarf_offdie_b(dbg,off,is_info,&target,&err);
+        check_int("dwarf_offdie_b",DW_DLV_OK,res,__LINE__);
+        return res == DW_DLV_OK? target:0;
+    }
+    return 0;
+}
+
+static const char *
+decl_file_name(struct cu_s *cu,Dwarf_Unsigned filenum)
+{
+    if (cu->cu_version >= 5) {
+        if (filenum < (Dwarf_Unsigned)cu->cu_filecount) {
+            return cu->cu_files[filenum];
+        }
+    } else if (filenum &&
+        filenum <= (Dwarf_Unsigned)cu->cu_filecount) {
+        return cu->cu_files[filenum-1];
+    }
+    return 0;
+}
+
+static int
+is_scope(Dwarf_Die die,Dwarf_Half tag)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Bool has = 0;
+    int res = 0;
+
+    switch (tag) {
+    case DW_TAG_namespace:
+    case DW_TAG_class_type:
+    case DW_TAG_structure_type:
+    case DW_TAG_union_type:
+    case DW_TAG_interface_type:
+    case DW_TAG_module:
+        return 1;
+    case DW_TAG_enumeration_type:
+        res = dwarf_hasattr(die,DW_AT_enum_class,&has,&err);
+        check_int("dwarf_hasattr",DW_DLV_OK,res,__LINE__);
+        return has != 0;
+    default:
+        break;
+    }
+    return 0;
+}
+
+static void
+check_expects(Dwarf_Half tag,int has_ref,const char *name,
+    const char *linkage,const char *scope,
+    const char *file,Dwarf_Unsigned line)
+{
+    struct expect_s *ex = 0;
+
+    if (!name) {
+        return;
+    }
+    for (ex = expects; ex->ex_name; ++ex) {
+        if (ex->ex_tag != tag || ex->ex_has_ref != has_ref ||
+            strcmp(ex->ex_name,name)) {
+            continue;
+        }
+        ex->ex_hits++;
+        check_string(name,ex->ex_scope,scope,__LINE__);
+        if (ex->ex_linkage) {
+            check_string(name,ex->ex_linkage,linkage,__LINE__);
+        }
+        if (!ex->ex_line) {
+            continue;
+        }
+        check_unsigned(name,ex->ex_line,line,__LINE__);
+        if (!file || !strstr(file,"testnamesLE64ELfsource.cc")) {
+            printf("FAIL %s decl file \"%s\"\n",name,
+                file?file:"(null)");
+            ++errcount;
+        }
+    }
+}
+
+/*  scope is the qualified name of the scope
+    the walk is in. */
+static void
+check_die(Dwarf_Debug dbg,Dwarf_Die die,const char *scope,
+    struct cu_s *cu,unsigned *count)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Half tag = 0;
+    Dwarf_Die origin = 0;
+    Dwarf_Die child = 0;
+    const char *own_name = 0;
+    const char *own_linkage = 0;
+    const char *own_file = 0;
+    Dwarf_Unsigned own_line = 0;
+    const char *name = 0;
+    const char *linkage = 0;
+    const char *qscope = 0;
+    const char *file = 0;
+    Dwarf_Unsigned line = 0;
+    const char *name2 = 0;
+    const char *qscope2 = 0;
+    char *childscope = 0;
+    Dwarf_Bool has_file = 0;
+    int res = 0;
+
+    ++*count;
+    res = dwarf_tag(die,&tag,&err);
+    check_int("dwarf_tag",DW_DLV_OK,res,__LINE__);
+    own_name = get_string_attr(die,DW_AT_name);
+    own_linkage = get_string_attr(die,DW_AT_linkage_name);
+    if (!own_linkage) {
+        own_linkage = get_string_attr(die,
+            DW_AT_MIPS_linkage_name);
+    }
+    res = dwarf_hasattr(die,DW_AT_decl_file,&has_file,&err);
+    check_int("dwarf_hasattr",DW_DLV_OK,res,__LINE__);
+    if (has_file) {
+        own_file = decl_file_name(cu,
+            get_udata_attr(die,DW_AT_decl_file));
+    }
+    own_line = get_udata_attr(die,DW_AT_decl_line);
+
+    res = dwarf_die_resolved_names(die,&name,&linkage,&qscope,
+        &file,&line,&err);
+    check_int("dwarf_die_resolved_names",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        return;
+    }
+    /*  A second call returns the remembered strings. */
+    res = dwarf_die_resolved_names(die,&name2,0,&qscope2,
+        0,0,&err);
+    check_int("dwarf_die_resolved_names again",DW_DLV_OK,res,
+        __LINE__);
+    check_int("same name",1,name == name2,__LINE__);
+    check_int("same scope",1,qscope == qscope2,__LINE__);
+
+    origin = get_origin(dbg,die);
+    if (origin) {
+        const char *tname = 0;
+        const char *tlinkage = 0;
+        const char *tscope = 0;
+        const char *tfile = 0;
+        Dwarf_Unsigned tline = 0;
+
+        res = dwarf_die_resolved_names(origin,&tname,&tlinkage,
+            &tscope,&tfile,&tline,&err);
+        check_int("dwarf_die_resolved_names origin",DW_DLV_OK,
+            res,__LINE__);
+        check_string("name",own_name?own_name:tname,name,
+            __LINE__);
+        check_string("linkage name",
+            own_linkage?own_linkage:tlinkage,linkage,__LINE__);
+        check_string("scope",tscope,qscope,__LINE__);
+        check_string("decl file",own_file?own_file:tfile,file,
+            __LINE__);
+        check_unsigned("decl line",own_line?own_line:tline,line,
+            __LINE__);
+        dwarf_dealloc_die(origin);
+    } else {
+        check_string("name",own_name,name,__LINE__);
+        check_string("linkage name",own_linkage,linkage,__LINE__);
+        check_string("scope",scope,qscope,__LINE__);
+        check_string("decl file",own_file,file,__LINE__);
+        check_unsigned("decl line",own_line,line,__LINE__);
+    }
+    check_expects(tag,origin != 0,name,linkage,qscope,file,line);
+
+    if (is_scope(die,tag)) {
+        const char *sname = name;
+        size_t len = 0;
+
+        if (!sname) {
+            sname = (tag == DW_TAG_namespace)?
+                "(anonymous namespace)":"(anonymous)";
+        }
+        len = strlen(qscope) + 2 + strlen(sname) + 1;
+        childscope = (char *)malloc(len);
+        if (!childscope) {
+            printf("FAIL out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+        childscope[0] = 0;
+        if (qscope[0]) {
+            strcpy(childscope,qscope);
+            strcat(childscope,"::");
+        }
+        strcat(childscope,sname);
+        scope = childscope;
+    }
+    res = dwarf_child(die,&child,&err);
+    check_int("dwarf_child",1,res != DW_DLV_ERROR,__LINE__);
+    while (res == DW_DLV_OK) {
+        Dwarf_Die sib = 0;
+
+        check_die(dbg,child,scope,cu,count);
+        res = dwarf_siblingof_c(child,&sib,&err);
+        check_int("dwarf_siblingof_c",1,res != DW_DLV_ERROR,
+            __LINE__);
+        dwarf_dealloc_die(child);
+        child = sib;
+    }
+    free(childscope);
+}
+
+static void
+test_object(const char *obj)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Error err = 0;
+    unsigned cus = 0;
+    unsigned dies = 0;
+    struct expect_s *ex = 0;
+    int is_names = !strncmp(obj,"testnames",9);
+    int res = 0;
+
+    dbg = open_obj(obj);
+    for (ex = expects; ex->ex_name; ++ex) {
+        ex->ex_hits = 0;
+    }
+    for (;;) {
+        Dwarf_Die cu_die = 0;
+        Dwarf_Half offset_size = 0;
+        struct cu_s cu;
+
+        res = dwarf_next_cu_header_e(dbg,1,&cu_die,
+            0,0,0,0,0,0,0,0,0,0,&err);
+        if (res != DW_DLV_OK) {
+            check_int("dwarf_next_cu_header_e",DW_DLV_NO_ENTRY,
+                res,__LINE__);
+            break;
+        }
+        ++cus;
+        memset(&cu,0,sizeof(cu));
+        res = dwarf_get_version_of_die(cu_die,&cu.cu_version,
+            &offset_size);
+        check_int("dwarf_get_version_of_die",DW_DLV_OK,res,
+            __LINE__);
+        res = dwarf_srcfiles(cu_die,&cu.cu_files,
+            &cu.cu_filecount,&err);
+        if (res == DW_DLV_ERROR) {
+            dwarf_dealloc_error(dbg,err);
+            err = 0;
+        }
+        if (res != DW_DLV_OK) {
+            cu.cu_files = 0;
+            cu.cu_filecount = 0;
+        }
+        check_die(dbg,cu_die,"",&cu,&dies);
+        if (cu.cu_files) {
+            Dwarf_Signed i = 0;
+
+            for (i = 0; i < cu.cu_filecount; ++i) {
+                dwarf_dealloc(dbg,cu.cu_files[i],DW_DLA_STRING);
+            }
+            dwarf_dealloc(dbg,cu.cu_files,DW_DLA_LIST);
+        }
+        dwarf_dealloc_die(cu_die);
+    }
+    if (!cus || !dies) {
+        printf("FAIL %s: %u CUs %u DIEs\n",obj,cus,dies);
+        ++errcount;
+    }
+    if (is_names) {
+        for (ex = expects; ex->ex_name; ++ex) {
+            if (!ex->ex_hits) {
+                printf("FAIL %s: no %s DIE found\n",obj,
+                    ex->ex_name);
+                ++errcount;
+            }
+        }
+    }
+    dwarf_finish(dbg);
+}
+
+static void
+test_errors(void)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Error err = 0;
+    Dwarf_Die cu_die = 0;
+    const char *name = 0;
+    int res = 0;
+
+    res = dwarf_die_resolved_names(NULL,&name,0,0,0,0,&err);
+    check_int("NULL die",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(NULL,err);
+        err = 0;
+    }
+    /*  Every return pointer is optional. */
+    dbg = open_obj("testnamesLE64ELf5.testme");
+    res = dwarf_next_cu_header_e(dbg,1,&cu_die,
+        0,0,0,0,0,0,0,0,0,0,&err);
+    check_int("next cu",DW_DLV_OK,res,__LINE__);
+    if (res == DW_DLV_OK) {
+        res = dwarf_die_resolved_names(cu_die,0,0,0,0,0,&err);
+        check_int("all NULL returns",DW_DLV_OK,res,__LINE__);
+        res = dwarf_die_resolved_names(cu_die,&name,0,0,0,0,
+            &err);
+        check_int("CU name",DW_DLV_OK,res,__LINE__);
+        check_string("CU name","testnamesLE64ELfsource.cc",name,
+            __LINE__);
+        dwarf_dealloc_die(cu_die);
+    }
+    dwarf_finish(dbg);
+}
+
+int
+main(int argc, char **argv)
+{
+    int i = 0;
+
+    testobj_srcdir(argc,argv);
+    for (i = 0; objects[i]; ++i) {
+        test_object(objects[i]);
+    }
+    test_errors();
+    testobj_exit("test_die_names");
+    return 0;
+}
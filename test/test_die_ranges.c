@@ -0,0 +1,604 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Tests dwarf_die_ranges_start() and dwarf_die_ranges_next().
+    For every DIE of a few objects the iterator must give
+    the same ranges as dwarf_lowpc() and dwarf_highpc_b(),
+    dwarf_get_ranges_b() (DWARF2-4) or
+    dwarf_rnglists_get_rle_head() and
+    dwarf_get_rnglists_entry_fields_a() (DWARF5).
+    testrangesLE64ELf4.testme and testrangesLE64ELf5.testme
+    (see testrangesLE64ELfsource.c) have DW_AT_ranges on
+    the CU, a subprogram, lexical blocks and inlined
+    subroutines.
+    The variable index (dwarf_var_index()) gets its
+    scope ranges from the iterator, so the entries of
+    each variable with a single location expression are
+    checked against the ranges of its scope too.
+
+    ./test_die_ranges -f <top source directory>
+    or set environment variable DWTOPSRCDIR. */
+
+#include <config.h>
+
+#include <stdio.h>  /* printf() */
+#include <stdlib.h> /* exit() */
+#include <string.h> /* memset() strcmp() */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "testobj_util.h"
+
+static const char *objects[] = {
+"testrangesLE64ELf4.testme",
+"testrangesLE64ELf5.testme",
+"testnamesLE64ELf4.testme",
+"testnamesLE64ELf5.testme",
+"dummyexecutable.debug",
+0
+};
+
+#define RANGES_MAX 64
+
+/*  The ranges of a DIE, in order. */
+struct ranges_s {
+    Dwarf_Addr r_low[RANGES_MAX];
+    Dwarf_Addr r_high[RANGES_MAX];
+    int        r_count;
+};
+
+static void
+add_range(struct ranges_s *r,Dwarf_Addr low,Dwarf_Addr high)
+{
+    if (r->r_count >= RANGES_MAX) {
+        printf("FAIL more than %d ranges\n",RANGES_MAX);
+        exit(EXIT_FAILURE);
+    }
+    r->r_low[r->r_count] = low;
+    r->r_high[r->r_count] = high;
+    ++r->r_count;
+}
+
+/*  The CU values the reference ranges need. */
+struct cu_s {
+    Dwarf_Debug cu_dbg;
+    Dwarf_Half  cu_version;
+    Dwarf_Addr  cu_base;
+};
+
+/*  DW_AT_ranges through dwarf_get_ranges_b(). */
+static int
+reference_ranges(struct cu_s *cu,Dwarf_Die die,
+    Dwarf_Unsigned offset,struct ranges_s *r)
+{
+    Dwarf_Ranges *buf = 0;
+    Dwarf_Signed count = 0;
+    Dwarf_Signed i = 0;
+    Dwarf_Unsigned bytes = 0;
+    Dwarf_Off realoffset = 0;
+    Dwarf_Addr base = cu->cu_base;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_get_ranges_b(cu->cu_dbg,offset,die,&realoffset,
+        &buf,&count,&bytes,&err);
+    check_int("dwarf_get_ranges_b",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    for (i = 0; i < count; ++i) {
+        if (buf[i].dwr_type == DW_RANGES_ENTRY) {
+            add_range(r,buf[i].dwr_addr1 + base,
+                buf[i].dwr_addr2 + base);
+        } else if (buf[i].dwr_type ==
+            DW_RANGES_ADDRESS_SELECTION) {
+            base = buf[i].dwr_addr2;
+        } else {
+            break;
+        }
+    }
+    dwarf_dealloc_ranges(cu->cu_dbg,buf,count);
+    return DW_DLV_OK;
+}
+
+/*  DW_AT_ranges through dwarf_rnglists_get_rle_head(). */
+static int
+reference_rnglists(Dwarf_Attribute attr,Dwarf_Half form,
+    Dwarf_Unsigned value,struct ranges_s *r)
+{
+    Dwarf_Rnglists_Head head = 0;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Unsigned global_offset = 0;
+    Dwarf_Unsigned i = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_rnglists_get_rle_head(attr,form,value,&head,
+        &count,&global_offset,&err);
+    check_int("dwarf_rnglists_get_rle_head",DW_DLV_OK,res,
+        __LINE__);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    for (i = 0; i < count; ++i) {
+        unsigned entrylen = 0;
+        unsigned code = 0;
+        Dwarf_Unsigned raw1 = 0;
+        Dwarf_Unsigned raw2 = 0;
+        Dwarf_Bool unavailable = 0;
+        Dwarf_Unsigned low = 0;
+        Dwarf_Unsigned high = 0;
+
+        res = dwarf_get_rnglists_entry_fields_a(head,i,&entrylen,
+            &code,&raw1,&raw2,&unavailable,&low,&high,&err);
+        check_int("dwarf_get_rnglists_entry_fields_a",DW_DLV_OK,
+            res,__LINE__);
+        if (res != DW_DLV_OK || code == DW_RLE_end_of_list) {
+            break;
+        }
+        if (code == DW_RLE_base_addressx ||
+            code == DW_RLE_base_address) {
+            continue;
+        }
+        check_int("debug_addr unavailable",0,unavailable,
+            __LINE__);
+        add_range(r,low,high);
+    }
+    dwarf_dealloc_rnglists_head(head);
+    return res;
+}
+
+/*  The ranges of die the long way. */
+static int
+reference(struct cu_s *cu,Dwarf_Die die,struct ranges_s *r)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Addr low = 0;
+    Dwarf_Addr high = 0;
+    Dwarf_Half form = 0;
+    enum Dwarf_Form_Class fc = DW_FORM_CLASS_UNKNOWN;
+    Dwarf_Attribute attr = 0;
+    Dwarf_Unsigned value = 0;
+    int res = 0;
+
+    r->r_count = 0;
+    res = dwarf_lowpc(die,&low,&err);
+    if (res == DW_DLV_OK) {
+        res = dwarf_highpc_b(die,&high,&form,&fc,&err);
+        if (res == DW_DLV_OK) {
+            if (fc == DW_FORM_CLASS_CONSTANT) {
+                high += low;
+            }
+            add_range(r,low,high);
+            return DW_DLV_OK;
+        }
+    }
+    check_int("dwarf_lowpc or dwarf_highpc_b",1,
+        res != DW_DLV_ERROR,__LINE__);
+    res = dwarf_attr(die,DW_AT_ranges,&attr,&err);
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    res = dwarf_whatform(attr,&form,&err);
+    if (res == DW_DLV_OK) {
+        if (form == DW_FORM_rnglistx) {
+            res = dwarf_formudata(attr,&value,&err);
+        } else {
+            res = dwarf_global_formref(attr,&value,&err);
+        }
+    }
+    check_int("DW_AT_ranges value",DW_DLV_OK,res,__LINE__);
+    if (res == DW_DLV_OK) {
+        if (form != DW_FORM_rnglistx && cu->cu_version < 5) {
+            res = reference_ranges(cu,die,value,r);
+        } else {
+            res = reference_rnglists(attr,form,value,r);
+        }
+    }
+    dwarf_dealloc_attribute(attr);
+    return res;
+}
+
+/*  The iterator and the reference must agree. */
+static void
+check_die(struct cu_s *cu,Dwarf_Die die,struct ranges_s *r,
+    unsigned *ranged)
+{
+    Dwarf_Range_Iter iter;
+    Dwarf_Error err = 0;
+    Dwarf_Addr low = 0;
+    Dwarf_Addr high = 0;
+    Dwarf_Off offset = 0;
+    int count = 0;
+    int rres = 0;
+    int res = 0;
+
+    rres = reference(cu,die,r);
+    dwarf_dieoffset(die,&offset,&err);
+    res = dwarf_die_ranges_start(die,&iter,&err);
+    if (res != rres) {
+        printf("FAIL die 0x%llx dwarf_die_ranges_start "
+            "expected %d got %d\n",(unsigned long long)offset,
+            rres,res);
+        ++errcount;
+    }
+    while (res == DW_DLV_OK) {
+        res = dwarf_die_ranges_next(&iter,&low,&high,&err);
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        if (count >= r->r_count || r->r_low[count] != low ||
+            r->r_high[count] != high) {
+            printf("FAIL die 0x%llx range %d is 0x%llx-0x%llx\n",
+                (unsigned long long)offset,count,
+                (unsigned long long)low,(unsigned long long)high);
+            ++errcount;
+        }
+        ++count;
+    }
+    if (res == DW_DLV_ERROR) {
+        printf("FAIL die 0x%llx %s\n",(unsigned long long)offset,
+            dwarf_errmsg(err));
+        ++errcount;
+        dwarf_dealloc_error(cu->cu_dbg,err);
+        return;
+    }
+    if (rres != DW_DLV_OK) {
+        return;
+    }
+    if (count != r->r_count) {
+        printf("FAIL die 0x%llx expected %d ranges got %d\n",
+            (unsigned long long)offset,r->r_count,count);
+        ++errcount;
+    }
+    /*  It stays at the end. */
+    res = dwarf_die_ranges_next(&iter,&low,&high,&err);
+    check_int("dwarf_die_ranges_next after the end",
+        DW_DLV_NO_ENTRY,res,__LINE__);
+    if (r->r_count > 1) {
+        ++*ranged;
+    }
+}
+
+/*  A variable with a single location expression
+    has one index entry per non-empty range
+    of its scope. */
+static void
+check_var_entries(Dwarf_Var_Index vx,Dwarf_Die die,
+    struct ranges_s *scope,unsigned *vars)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Attribute attr = 0;
+    Dwarf_Half form = 0;
+    Dwarf_Off offset = 0;
+    Dwarf_Unsigned entry_count = 0;
+    Dwarf_Unsigned i = 0;
+    int expect = 0;
+    int found = 0;
+    int k = 0;
+    int res = 0;
+
+    res = dwarf_attr(die,DW_AT_location,&attr,&err);
+    if (res != DW_DLV_OK) {
+        return;
+    }
+    res = dwarf_whatform(attr,&form,&err);
+    dwarf_dealloc_attribute(attr);
+    if (res != DW_DLV_OK || (form != DW_FORM_exprloc &&
+        form != DW_FORM_block1)) {
+        return;
+    }
+    ++*vars;
+    dwarf_dieoffset(die,&offset,&err);
+    dwarf_var_index_info(vx,0,0,&entry_count,&err);
+    for (k = 0; k < scope->r_count; ++k) {
+        if (scope->r_low[k] < scope->r_high[k]) {
+            ++expect;
+        }
+    }
+    for (i = 0; i < entry_count; ++i) {
+        Dwarf_Off eoffset = 0;
+        Dwarf_Addr low = 0;
+        Dwarf_Addr high = 0;
+
+        res = dwarf_var_index_entry(vx,i,&eoffset,0,&low,&high,
+            0,0,0,&err);
+        check_int("dwarf_var_index_entry",DW_DLV_OK,res,__LINE__);
+        if (res != DW_DLV_OK || eoffset != offset) {
+            continue;
+        }
+        ++found;
+        for (k = 0; k < scope->r_count; ++k) {
+            if (scope->r_low[k] == low && scope->r_high[k] == high) {
+                break;
+            }
+        }
+        if (k == scope->r_count) {
+            printf("FAIL variable 0x%llx entry 0x%llx-0x%llx "
+                "is not a range of its scope\n",
+                (unsigned long long)offset,(unsigned long long)low,
+                (unsigned long long)high);
+            ++errcount;
+        }
+    }
+    if (found != expect) {
+        printf("FAIL variable 0x%llx expected %d entries got %d\n",
+            (unsigned long long)offset,expect,found);
+        ++errcount;
+    }
+}
+
+struct walk_s {
+    struct cu_s w_cu;
+    unsigned    w_dies;
+    unsigned    w_ranged;
+    unsigned    w_vars;
+};
+
+/*  Checks die, its children and later siblings.
+    scope and vx are those of the innermost
+    enclosing subprogram, lexical block or inlined
+    subroutine with code, vx zero outside subprograms. */
+static void
+walk_dies(struct walk_s *w,Dwarf_Die die,
+    struct ranges_s *scope,Dwarf_Var_Index vx)
+{
+    Dwarf_Die cur = die;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    for (;;) {
+        struct ranges_s r;
+        struct ranges_s *inner_scope = scope;
+        Dwarf_Var_Index inner_vx = vx;
+        Dwarf_Half tag = 0;
+        Dwarf_Die child = 0;
+        Dwarf_Die sib = 0;
+
+        ++w->w_dies;
+        memset(&r,0,sizeof(r));
+        check_die(&w->w_cu,cur,&r,&w->w_ranged);
+        dwarf_tag(cur,&tag,&err);
+        switch (tag) {
+        case DW_TAG_subprogram:
+            inner_vx = 0;
+            res = dwarf_var_index(cur,&inner_vx,&err);
+            check_int("dwarf_var_index",1,res != DW_DLV_ERROR,
+                __LINE__);
+            if (res != DW_DLV_OK) {
+                inner_vx = 0;
+            }
+            inner_scope = &r;
+            break;
+        case DW_TAG_lexical_block:
+        case DW_TAG_inlined_subroutine: {
+            int k = 0;
+
+            for (k = 0; k < r.r_count; ++k) {
+                if (r.r_low[k] < r.r_high[k]) {
+                    inner_scope = &r;
+                    break;
+                }
+            }
+            }
+            break;
+        case DW_TAG_variable:
+        case DW_TAG_formal_parameter:
+            if (vx) {
+                check_var_entries(vx,cur,scope,&w->w_vars);
+            }
+            break;
+        default:
+            break;
+        }
+        res = dwarf_child(cur,&child,&err);
+        check_int("dwarf_child",1,res != DW_DLV_ERROR,__LINE__);
+        if (res == DW_DLV_OK) {
+            walk_dies(w,child,inner_scope,inner_vx);
+            dwarf_dealloc_die(child);
+        }
+        res = dwarf_siblingof_c(cur,&sib,&err);
+        check_int("dwarf_siblingof_c",1,res != DW_DLV_ERROR,
+            __LINE__);
+        if (cur != die) {
+            dwarf_dealloc_die(cur);
+        }
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        cur = sib;
+    }
+}
+
+static void
+test_object(const char *obj,unsigned min_ranged,unsigned min_vars)
+{
+    struct walk_s w;
+    struct ranges_s noscope;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    memset(&w,0,sizeof(w));
+    memset(&noscope,0,sizeof(noscope));
+    w.w_cu.cu_dbg = open_obj(obj);
+    for (;;) {
+        Dwarf_Die cu_die = 0;
+        Dwarf_Half version = 0;
+
+        res = dwarf_next_cu_header_e(w.w_cu.cu_dbg,1,&cu_die,
+            0,&version,0,0,0,0,0,0,0,0,&err);
+        if (res != DW_DLV_OK) {
+            check_int("dwarf_next_cu_header_e",DW_DLV_NO_ENTRY,
+                res,__LINE__);
+            break;
+        }
+        w.w_cu.cu_version = version;
+        w.w_cu.cu_base = 0;
+        dwarf_lowpc(cu_die,&w.w_cu.cu_base,&err);
+        walk_dies(&w,cu_die,&noscope,0);
+        dwarf_dealloc_die(cu_die);
+    }
+    if (!w.w_dies || w.w_ranged < min_ranged ||
+        w.w_vars < min_vars) {
+        printf("FAIL %s: %u dies, %u with more than one range, "
+            "%u variables checked\n",
+            obj,w.w_dies,w.w_ranged,w.w_vars);
+        ++errcount;
+    }
+    dwarf_finish(w.w_cu.cu_dbg);
+}
+
+/*  The ranges of the CU and of walk(), whose
+    unlikely code gcc moved to walk.cold. */
+static void
+test_values(const char *obj)
+{
+    static const Dwarf_Addr cu_low[] =
+        {0x1044,0x1030,0x1060,0x10e0};
+    static const Dwarf_Addr cu_high[] =
+        {0x1052,0x1044,0x10dc,0x1139};
+    static const Dwarf_Addr walk_low[] = {0x1060,0x1044};
+    static const Dwarf_Addr walk_high[] = {0x10dc,0x1052};
+    Dwarf_Debug dbg = 0;
+    Dwarf_Error err = 0;
+    Dwarf_Die cu_die = 0;
+    Dwarf_Die die = 0;
+    Dwarf_Range_Iter iter;
+    Dwarf_Addr low = 0;
+    Dwarf_Addr high = 0;
+    unsigned count = 0;
+    int res = 0;
+
+    dbg = open_obj(obj);
+    res = dwarf_next_cu_header_e(dbg,1,&cu_die,
+        0,0,0,0,0,0,0,0,0,0,&err);
+    check_int("dwarf_next_cu_header_e",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        dwarf_finish(dbg);
+        return;
+    }
+    res = dwarf_die_ranges_start(cu_die,&iter,&err);
+    check_int("CU ranges",DW_DLV_OK,res,__LINE__);
+    while (res == DW_DLV_OK &&
+        dwarf_die_ranges_next(&iter,&low,&high,&err) ==
+        DW_DLV_OK) {
+        if (count < 4) {
+            check_unsigned("CU range low",cu_low[count],low,
+                __LINE__);
+            check_unsigned("CU range high",cu_high[count],high,
+                __LINE__);
+        }
+        ++count;
+    }
+    check_unsigned("CU range count",4,count,__LINE__);
+
+    /*  The first child is the variable sink,
+        with no code. */
+    res = dwarf_child(cu_die,&die,&err);
+    check_int("dwarf_child",DW_DLV_OK,res,__LINE__);
+    res = dwarf_die_ranges_start(die,&iter,&err);
+    check_int("sink has no ranges",DW_DLV_NO_ENTRY,res,__LINE__);
+    for (;;) {
+        Dwarf_Die sib = 0;
+        char *name = 0;
+
+        if (dwarf_diename(die,&name,&err) == DW_DLV_OK &&
+            !strcmp(name,"walk")) {
+            break;
+        }
+        res = dwarf_siblingof_c(die,&sib,&err);
+        dwarf_dealloc_die(die);
+        die = 0;
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        die = sib;
+    }
+    check_int("found walk",1,die != 0,__LINE__);
+    if (die) {
+        count = 0;
+        res = dwarf_die_ranges_start(die,&iter,&err);
+        check_int("walk ranges",DW_DLV_OK,res,__LINE__);
+        while (res == DW_DLV_OK &&
+            dwarf_die_ranges_next(&iter,&low,&high,&err) ==
+            DW_DLV_OK) {
+            if (count < 2) {
+                check_unsigned("walk range low",walk_low[count],low,
+                    __LINE__);
+                check_unsigned("walk range high",walk_high[count],
+                    high,__LINE__);
+            }
+            ++count;
+        }
+        check_unsigned("walk range count",2,count,__LINE__);
+        dwarf_dealloc_die(die);
+    }
+
+    res = dwarf_die_ranges_start(NULL,&iter,&err);
+    check_int("NULL die",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        /*  With no die there is no dbg to hang it on. */
+        dwarf_dealloc_error(NULL,err);
+        err = 0;
+    }
+    res = dwarf_die_ranges_start(cu_die,NULL,&err);
+    check_int("NULL iterator",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(dbg,err);
+        err = 0;
+    }
+    res = dwarf_die_ranges_next(NULL,&low,&high,&err);
+    check_int("next, NULL iterator",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(NULL,err);
+        err = 0;
+    }
+    dwarf_dealloc_die(cu_die);
+    dwarf_finish(dbg);
+}
+
+int
+main(int argc, char **argv)
+{
+    int i = 0;
+
+    testobj_srcdir(argc,argv);
+    for (i = 0; objects[i]; ++i) {
+        /*  The testranges objects must have DIEs
+            with several ranges, and keep in walk(). */
+        test_object(objects[i],i < 2? 4:0,1);
+    }
+    test_values("testrangesLE64ELf4.testme");
+    test_values("testrangesLE64ELf5.testme");
+    testobj_exit("test_die_ranges");
+    return 0;
+}
@@ -0,0 +1,118 @@
+#!/bin/sh
+# Copyright (C) 2026 David Anderson
+# This script is hereby placed in the Public Domain
+# for anyone to use in any way for any purpose.
+#
+# Tests the line tables dwarfgen writes.  Each test
+# object is written by dwarfgen as DWARF4 and as
+# DWARF5, each with the default line_base and
+# line_range and with --optimize-line-table.
+# The line table version must be as asked and the
+# rows dwarfdump -l prints (read with dwarf_srclines_b())
+# must be those of the input, discriminators included.
+# dwarfgen writes the file names with the directory
+# prepended, so only the last part of each uri is
+# compared.
+#
+# To call this:
+# Either set arg1 to the top source dir
+# or set env var DWTOPSRCDIR to the top source dir.
+# With meson set arg2 to ninja.
+y=
+if [ $# -gt 0  ]
+then
+  t="$1"
+  if [ $# -gt 1  ]
+  then
+    y="$2"
+  fi
+else
+  if [ x$DWTOPSRCDIR = "x" ]
+  then
+    # Running from the source tree
+    t=`pwd`/..
+  else
+    # Running outside of source tree (the usual case)
+    t=$DWTOPSRCDIR
+  fi
+fi
+. $t/test/test_dwarfdumpsetup.sh $t $y
+localsrc=$top_srcdir/test
+dg=$top_blddir/src/bin/dwarfgen/dwarfgen
+n=test_dwarfgen-lines.sh
+fails=0
+
+# The rows of dwarfdump -l output on $1, to $2.
+getrows() {
+  $dd -l $1 > $2.all
+  r=$?
+  chkres $r "$n $dd -l $1"
+  grep "^0x" $2.all | \
+    sed 's|uri: ".*/\([^/]*\)"|uri: "\1"|' > $2
+  rm -f $2.all
+  return $r
+}
+
+# Writes $1 with dwarfgen -v $2, $3 holds any other
+# options, and compares the rows with $4.
+runone() {
+  tx=junk.dglines.v$2$3.$1
+  $dg -t obj -c 0 -v $2 $3 -o $tx $localsrc/$1 > $tx.log 2>&1
+  r=$?
+  chkres $r "$n dwarfgen -v $2 $3 $1"
+  if [ $r -ne 0 ]
+  then
+    fails=`expr $fails + 1`
+    return
+  fi
+  $dd -l -v $tx | grep "^ version number *0x$2 " >/dev/null
+  if [ $? -ne 0 ]
+  then
+    echo "FAIL $n $1 -v $2 $3: line table is not version $2"
+    fails=`expr $fails + 1`
+  fi
+  getrows $tx $tx.rows
+  if [ $? -ne 0 ]
+  then
+    fails=`expr $fails + 1`
+    return
+  fi
+  diff $4 $tx.rows
+  if [ $? -ne 0 ]
+  then
+    echo "FAIL $n $1 -v $2 $3: rows differ from the input"
+    fails=`expr $fails + 1`
+  fi
+  rm -f $tx $tx.log $tx.rows
+}
+
+for f in testrangesLE64ELf4.testme testuriLE64ELf.testme
+do
+  in=junk.dglines.in.$f
+  getrows $localsrc/$f $in
+  if [ $? -ne 0 ]
+  then
+    fails=`expr $fails + 1`
+    continue
+  fi
+  grep " DI=" $in >/dev/null
+  if [ $? -ne 0 ]
+  then
+    echo "FAIL $n $f has no discriminators to compare"
+    fails=`expr $fails + 1`
+  fi
+  for v in 4 5
+  do
+    runone $f $v "" $in
+    runone $f $v --optimize-line-table $in
+  done
+  rm -f $in
+done
+rm -f dwarfdump.conf
+if [ $fails -ne 0 ]
+then
+  echo "FAIL $n $fails failures"
+  exit 1
+fi
+echo "PASS $n"
+exit 0
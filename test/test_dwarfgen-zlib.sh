@@ -0,0 +1,32 @@
+#!/bin/sh
+# Copyright (C) 2026 David Anderson
+# This script is hereby placed in the Public Domain
+# for anyone to use in any way for any purpose.
+#
+# Tests dwarfgen --compress-debug-sections=zlib.
+# See test_dwarfgencompress.sh.
+#
+# To call this:
+# Either set arg1 to the top source dir
+# or set env var DWTOPSRCDIR to the top source dir.
+# With meson set arg2 to ninja.
+y=
+if [ $# -gt 0  ]
+then
+  t="$1"
+  if [ $# -gt 1  ]
+  then
+    y="$2"
+  fi
+else
+  if [ x$DWTOPSRCDIR = "x" ]
+  then
+    # Running from the source tree
+    t=`pwd`/..
+  else
+    # Running outside of source tree (the usual case)
+    t=$DWTOPSRCDIR
+  fi
+fi
+ctype=zlib
+. $t/test/test_dwarfgencompress.sh
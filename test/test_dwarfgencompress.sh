@@ -0,0 +1,105 @@
+#!/bin/sh
+# Copyright (C) 2026 David Anderson
+# This script is hereby placed in the Public Domain
+# for anyone to use in any way for any purpose.
+#
+# Sourced by test_dwarfgen-zlib.sh and test_dwarfgen-zstd.sh
+# which set t (the top source dir), y (ninja with meson)
+# and ctype (zlib or zstd) first.
+#
+# Runs dwarfgen on each test object twice, once
+# plainly and once with --compress-debug-sections=$ctype.
+# .debug_info must be compressed and dwarfdump must
+# show it as SHF_COMPRESSED.  dwarfdump -i -l output
+# (less that mark) must be the same for both.
+#
+# libdwarfp compresses only when built with both zlib
+# and zstd.  Otherwise dwarfgen reports
+# DW_DLE_ZDEBUG_REQUIRES_ZLIB and we SKIP.
+. $t/test/test_dwarfdumpsetup.sh $t $y
+localsrc=$top_srcdir/test
+dg=$top_blddir/src/bin/dwarfgen/dwarfgen
+n=test_dwarfgen-$ctype.sh
+fails=0
+
+# Writes $1 with dwarfgen, $2 holds any extra
+# dwarfgen options.  Output to $3, the dwarfgen
+# messages to $3.log
+rundwarfgen() {
+  $dg -t obj -c 0 $2 -o $3 $localsrc/$1 > $3.log 2>&1
+}
+
+# Runs one test object.
+runone() {
+  tx=junk.dgc.$ctype.$1
+  rundwarfgen $1 "" $tx.plain
+  r=$?
+  chkres $r "$n dwarfgen $1"
+  if [ $r -ne 0 ]
+  then
+    fails=`expr $fails + 1`
+    return
+  fi
+  rundwarfgen $1 "--compress-debug-sections=$ctype" $tx.comp
+  r=$?
+  if [ $r -ne 0 ]
+  then
+    grep DW_DLE_ZDEBUG_REQUIRES_ZLIB $tx.comp.log >/dev/null
+    if [ $? -eq 0 ]
+    then
+      echo "SKIP $n, libdwarfp built without compression"
+      rm -f $tx.plain $tx.plain.log $tx.comp $tx.comp.log
+      rm -f dwarfdump.conf
+      exit 0
+    fi
+    chkres $r "$n dwarfgen --compress-debug-sections=$ctype $1"
+    fails=`expr $fails + 1`
+    return
+  fi
+  grep "^Compressed .debug_info " $tx.comp.log >/dev/null
+  if [ $? -ne 0 ]
+  then
+    echo "FAIL $n $1: dwarfgen did not compress .debug_info"
+    fails=`expr $fails + 1`
+  fi
+  $dd -i -l $tx.plain > $tx.plain.out
+  r=$?
+  chkres $r "$n $dd -i -l $1 plain"
+  $dd -i -l $tx.comp > $tx.comp.out
+  r2=$?
+  chkres $r2 "$n $dd -i -l $1 $ctype"
+  if [ $r -ne 0 -o $r2 -ne 0 ]
+  then
+    fails=`expr $fails + 1`
+    return
+  fi
+  grep "^.debug_info SHF_COMPRESSED" $tx.comp.out >/dev/null
+  if [ $? -ne 0 ]
+  then
+    echo "FAIL $n $1: .debug_info not shown as SHF_COMPRESSED"
+    fails=`expr $fails + 1`
+  fi
+  sed 's/ SHF_COMPRESSED .*//' < $tx.comp.out > $tx.comp.fix
+  diff $tx.plain.out $tx.comp.fix
+  r=$?
+  if [ $r -ne 0 ]
+  then
+    echo "FAIL $n $1 output differs when compressed"
+    fails=`expr $fails + 1`
+  fi
+  rm -f $tx.plain $tx.plain.log $tx.plain.out
+  rm -f $tx.comp $tx.comp.log $tx.comp.out $tx.comp.fix
+}
+
+for f in testrangesLE64ELf4.testme testnamesLE64ELf4.testme
+do
+  runone $f
+done
+rm -f dwarfdump.conf
+if [ $fails -ne 0 ]
+then
+  echo "FAIL $n $fails failures"
+  exit 1
+fi
+echo "PASS $n"
+exit 0
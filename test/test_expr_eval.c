@@ -0,0 +1,852 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Tests dwarf_expr_compile() and dwarf_expr_evaluate().
+    The variables of testexprLE64ELf.testme are named
+    for the expression in their DW_AT_location, and
+    those expressions, each with its expected result
+    here, cover the operators, pieces, the context
+    functions and the error and DW_DLV_NO_ENTRY
+    returns. Then every DW_AT_location and DW_AT_frame_base
+    of a few objects is compiled and evaluated, and
+    single operator expressions are checked against
+    the operator values dwarf_get_location_op_value_c()
+    returns.
+
+    ./test_expr_eval -f <top source directory>
+    or set environment variable DWTOPSRCDIR. */
+
+#include <config.h>
+
+#include <stdio.h>  /* printf() */
+#include <stdlib.h> /* exit() */
+#include <string.h> /* memcmp() memset() strcmp() strlen() */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "testobj_util.h"
+
+/*  What the context functions return. */
+#define REGVAL(r)      (0x10000 + (Dwarf_Unsigned)(r)*0x100)
+#define REG_LIMIT      64
+#define MEMVAL(a)      ((a) ^ 0xa5a5a5a5a5a5a5a5ULL)
+#define MEM_LOWEST     0x1000
+#define FRAME_BASE     0x7000
+#define CFA            0x8000
+#define OBJECT_ADDRESS 0x9000
+#define TLS_BASE       0x100000
+
+#define ALL_ONES (~(Dwarf_Unsigned)0)
+
+static int
+read_register(void *user_data,Dwarf_Unsigned regnum,
+    Dwarf_Unsigned *value)
+{
+    (void)user_data;
+    if (regnum >= REG_LIMIT) {
+        return DW_DLV_NO_ENTRY;
+    }
+    *value = REGVAL(regnum);
+    return DW_DLV_OK;
+}
+
+static int
+read_memory(void *user_data,Dwarf_Addr addr,
+    Dwarf_Unsigned size,Dwarf_Unsigned *value)
+{
+    (void)user_data;
+    if (addr < MEM_LOWEST || !size || size > 8) {
+        return DW_DLV_NO_ENTRY;
+    }
+    *value = MEMVAL(addr);
+    return DW_DLV_OK;
+}
+
+static int
+frame_base(void *user_data,Dwarf_Unsigned *value)
+{
+    (void)user_data;
+    *value = FRAME_BASE;
+    return DW_DLV_OK;
+}
+
+static int
+call_frame_cfa(void *user_data,Dwarf_Unsigned *value)
+{
+    (void)user_data;
+    *value = CFA;
+    return DW_DLV_OK;
+}
+
+static int
+object_address(void *user_data,Dwarf_Unsigned *value)
+{
+    (void)user_data;
+    *value = OBJECT_ADDRESS;
+    return DW_DLV_OK;
+}
+
+static int
+tls_address(void *user_data,Dwarf_Unsigned offset,
+    Dwarf_Unsigned *address)
+{
+    (void)user_data;
+    *address = TLS_BASE + offset;
+    return DW_DLV_OK;
+}
+
+static void
+full_context(Dwarf_Expr_Context *ctx)
+{
+    memset(ctx,0,sizeof(*ctx));
+    ctx->ec_read_register = read_register;
+    ctx->ec_read_memory = read_memory;
+    ctx->ec_frame_base = frame_base;
+    ctx->ec_call_frame_cfa = call_frame_cfa;
+    ctx->ec_object_address = object_address;
+    ctx->ec_tls_address = tls_address;
+}
+
+/*  Finds the DW_TAG_variable named name in
+    testexprLE64ELf.testme and returns the head of its
+    DW_AT_location. */
+static int
+named_location(Dwarf_Debug dbg,const char *name,
+    Dwarf_Loc_Head_c *head_out,Dwarf_Locdesc_c *locdesc_out)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Bool is_info = 1;
+    Dwarf_Die cu_die = 0;
+    int found = 0;
+    int res = 0;
+
+    /*  Restart at the first CU. */
+    while (dwarf_next_cu_header_e(dbg,is_info,&cu_die,
+        0,0,0,0,0,0,0,0,0,0,&err) == DW_DLV_OK) {
+        dwarf_dealloc_die(cu_die);
+    }
+    while (!found && dwarf_next_cu_header_e(dbg,is_info,&cu_die,
+        0,0,0,0,0,0,0,0,0,0,&err) == DW_DLV_OK) {
+        Dwarf_Die die = 0;
+
+        res = dwarf_child(cu_die,&die,&err);
+        while (!found && res == DW_DLV_OK) {
+            Dwarf_Die sib = 0;
+            char *diename = 0;
+
+            if (dwarf_diename(die,&diename,&err) == DW_DLV_OK &&
+                !strcmp(diename,name)) {
+                Dwarf_Attribute attr = 0;
+                Dwarf_Unsigned count = 0;
+
+                found = 1;
+                res = dwarf_attr(die,DW_AT_location,&attr,&err);
+                if (res == DW_DLV_OK) {
+                    res = dwarf_get_loclist_c(attr,head_out,
+                        &count,&err);
+                    dwarf_dealloc_attribute(attr);
+                }
+            } else {
+                res = dwarf_siblingof_c(die,&sib,&err);
+            }
+            dwarf_dealloc_die(die);
+            die = sib;
+        }
+        dwarf_dealloc_die(cu_die);
+    }
+    if (!found || res != DW_DLV_OK) {
+        printf("FAIL no expression %s in testexprLE64ELf.testme\n",
+            name);
+        exit(EXIT_FAILURE);
+    }
+    {
+        Dwarf_Small lle = 0;
+        Dwarf_Small source = 0;
+        Dwarf_Unsigned u = 0;
+        Dwarf_Bool unavail = 0;
+        Dwarf_Addr a = 0;
+
+        res = dwarf_get_locdesc_entry_d(*head_out,0,&lle,&u,&u,
+            &unavail,&a,&a,&u,locdesc_out,&source,&u,&u,&err);
+    }
+    if (res != DW_DLV_OK) {
+        printf("FAIL no location description for %s\n",name);
+        exit(EXIT_FAILURE);
+    }
+    return DW_DLV_OK;
+}
+
+/*  Compiles the expression of the variable name.
+    The program outlives the Dwarf_Loc_Head_c,
+    which is freed here. */
+static int
+compile_named(Dwarf_Debug dbg,const char *name,
+    Dwarf_Expr_Program *prog,Dwarf_Error *err)
+{
+    Dwarf_Loc_Head_c head = 0;
+    Dwarf_Locdesc_c locdesc = 0;
+    int res = 0;
+
+    named_location(dbg,name,&head,&locdesc);
+    res = dwarf_expr_compile(locdesc,prog,err);
+    dwarf_dealloc_loc_head_c(head);
+    return res;
+}
+
+struct expr_case_s {
+    const char     *ec_name;
+    /*  Expected returns of dwarf_expr_compile() and
+        dwarf_expr_evaluate(). */
+    int             ec_compile_res;
+    int             ec_eval_res;
+    Dwarf_Small     ec_kind;
+    Dwarf_Unsigned  ec_value;
+};
+
+#define OK    DW_DLV_OK
+#define NOENT DW_DLV_NO_ENTRY
+#define ERR   DW_DLV_ERROR
+#define MEM   DW_EXPR_LOC_MEMORY
+
+static struct expr_case_s expr_cases[] = {
+{"minus",OK,OK,MEM,2},
+{"minus wraps",OK,OK,MEM,ALL_ONES-1},
+{"minus address size 4",OK,OK,MEM,
+    0xffffffff},
+{"signed div",OK,OK,MEM,ALL_ONES-3},
+{"div by -1",OK,OK,MEM,8},
+{"mod",OK,OK,MEM,1},
+{"shl",OK,OK,MEM,16},
+{"shr",OK,OK,MEM,8},
+{"shra",OK,OK,MEM,ALL_ONES-3},
+{"shra address size 4",OK,OK,MEM,
+    0xfffffffc},
+{"rot",OK,OK,MEM,2},
+{"rot drop drop",OK,OK,MEM,3},
+{"swap",OK,OK,MEM,1},
+{"over",OK,OK,MEM,1},
+{"pick",OK,OK,MEM,5},
+{"dup mul",OK,OK,MEM,16},
+{"abs",OK,OK,MEM,5},
+{"neg",OK,OK,MEM,ALL_ONES-4},
+{"not",OK,OK,MEM,ALL_ONES},
+{"and or xor",OK,OK,MEM,0xf2},
+{"lt is signed",OK,OK,MEM,1},
+{"ge",OK,OK,MEM,0},
+{"gt",OK,OK,MEM,1},
+{"le",OK,OK,MEM,0},
+{"eq",OK,OK,MEM,1},
+{"ne",OK,OK,MEM,1},
+{"bra taken",OK,OK,MEM,9},
+{"bra not taken",OK,OK,MEM,7},
+{"count down loop",OK,OK,MEM,0},
+{"plus_uconst",OK,OK,MEM,133},
+{"constu consts plus",OK,OK,MEM,624484},
+{"nop",OK,OK,MEM,5},
+{"breg6",OK,OK,MEM,REGVAL(6)+16},
+{"breg7 negative",OK,OK,MEM,REGVAL(7)-8},
+{"bregx",OK,OK,MEM,REGVAL(40)+8},
+{"breg then plus",OK,OK,MEM,REGVAL(6)+2},
+{"fbreg",OK,OK,MEM,FRAME_BASE-8},
+{"reg3",OK,OK,DW_EXPR_LOC_REGISTER,3},
+{"regx",OK,OK,DW_EXPR_LOC_REGISTER,40},
+{"addr",OK,OK,MEM,0x1234},
+{"addr address size 4",OK,OK,MEM,0x1234},
+{"call_frame_cfa",OK,OK,MEM,CFA},
+{"push_object_address",OK,OK,MEM,
+    OBJECT_ADDRESS+8},
+{"deref",OK,OK,MEM,MEMVAL(REGVAL(7))},
+{"deref_size",OK,OK,MEM,
+    MEMVAL(REGVAL(7)) & 0xffff},
+{"deref address size 4",OK,OK,MEM,
+    MEMVAL(REGVAL(7)) & 0xffffffff},
+{"stack_value",OK,OK,DW_EXPR_LOC_VALUE,5},
+{"form_tls_address",OK,OK,MEM,TLS_BASE+16},
+{"implicit_pointer",OK,OK,
+    DW_EXPR_LOC_IMPLICIT_POINTER,0x12345678},
+{"empty",OK,OK,DW_EXPR_LOC_EMPTY,0},
+
+/*  The value is not available. */
+{"missing register",OK,NOENT,0,0},
+{"missing register in stack machine",
+    OK,NOENT,0,0},
+{"unreadable memory",OK,NOENT,0,0},
+{"entry_value",OK,NOENT,0,0},
+{"call4",OK,NOENT,0,0},
+
+/*  Invalid expressions. */
+{"stack underflow",OK,ERR,0,0},
+{"div by zero",OK,ERR,0,0},
+{"mod by zero",OK,ERR,0,0},
+{"stack_value not last",OK,ERR,0,0},
+{"reg not last",OK,ERR,0,0},
+{"endless loop",OK,ERR,0,0},
+{"branch into an operator",ERR,0,0,0},
+{"branch into another piece",ERR,0,0,0},
+{"piece of size zero",ERR,0,0,0},
+{"operations after the last piece",ERR,0,0,0},
+{0,0,0,0,0}
+};
+
+static void
+test_expr_cases(Dwarf_Debug dbg)
+{
+    struct expr_case_s *c = 0;
+    Dwarf_Expr_Context ctx;
+
+    full_context(&ctx);
+    for (c = expr_cases; c->ec_name; ++c) {
+        Dwarf_Expr_Program prog = 0;
+        Dwarf_Expr_Program again = 0;
+        Dwarf_Error err = 0;
+        Dwarf_Expr_Piece piece;
+        Dwarf_Unsigned count = 0;
+        int res = 0;
+
+        res = compile_named(dbg,c->ec_name,&prog,&err);
+        if (res != c->ec_compile_res) {
+            printf("FAIL %s: compile expected %d got %d\n",
+                c->ec_name,c->ec_compile_res,res);
+            ++errcount;
+        }
+        if (res == DW_DLV_ERROR) {
+            check_unsigned(c->ec_name,DW_DLE_LOC_EXPR_BAD,
+                dwarf_errno(err),__LINE__);
+            dwarf_dealloc_error(dbg,err);
+            continue;
+        }
+        if (res != DW_DLV_OK) {
+            continue;
+        }
+        /*  The second compile is a cache lookup. */
+        res = compile_named(dbg,c->ec_name,&again,&err);
+        check_int(c->ec_name,DW_DLV_OK,res,__LINE__);
+        if (again != prog) {
+            printf("FAIL %s: compiled twice\n",c->ec_name);
+            ++errcount;
+        }
+        memset(&piece,0,sizeof(piece));
+        res = dwarf_expr_evaluate(prog,&ctx,&piece,1,&count,&err);
+        if (res != c->ec_eval_res) {
+            printf("FAIL %s: evaluate expected %d got %d\n",
+                c->ec_name,c->ec_eval_res,res);
+            ++errcount;
+        }
+        if (res == DW_DLV_ERROR) {
+            check_unsigned(c->ec_name,DW_DLE_LOC_EXPR_BAD,
+                dwarf_errno(err),__LINE__);
+            dwarf_dealloc_error(dbg,err);
+            continue;
+        }
+        if (res != DW_DLV_OK) {
+            continue;
+        }
+        check_unsigned(c->ec_name,1,count,__LINE__);
+        if (piece.ep_kind != c->ec_kind ||
+            piece.ep_value != c->ec_value) {
+            printf("FAIL %s: expected kind %u value 0x%llx "
+                "got kind %u value 0x%llx\n",c->ec_name,
+                c->ec_kind,(unsigned long long)c->ec_value,
+                piece.ep_kind,(unsigned long long)piece.ep_value);
+            ++errcount;
+        }
+        check_unsigned(c->ec_name,0,piece.ep_size_bits,__LINE__);
+        if (c->ec_kind == DW_EXPR_LOC_IMPLICIT_POINTER) {
+            check_unsigned(c->ec_name,8,
+                (Dwarf_Unsigned)piece.ep_offset,__LINE__);
+        }
+    }
+}
+
+/*  DW_OP_piece, DW_OP_bit_piece and DW_OP_implicit_value. */
+static void
+test_pieces(Dwarf_Debug dbg)
+{
+    static const Dwarf_Small implicit_bytes[] = {1,2,3,4};
+    Dwarf_Expr_Program prog = 0;
+    Dwarf_Expr_Context ctx;
+    Dwarf_Expr_Piece pieces[5];
+    Dwarf_Unsigned count = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    full_context(&ctx);
+    /*  reg0 piece 4, piece 4, fbreg 8 piece 8,
+        lit5 stack_value bit_piece 3 2 */
+    res = compile_named(dbg,"pieces",&prog,&err);
+    check_int("pieces compile",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        return;
+    }
+    memset(pieces,0,sizeof(pieces));
+    res = dwarf_expr_evaluate(prog,&ctx,pieces,5,&count,&err);
+    check_int("pieces",DW_DLV_OK,res,__LINE__);
+    check_unsigned("piece count",4,count,__LINE__);
+    check_int("piece 0 kind",DW_EXPR_LOC_REGISTER,
+        pieces[0].ep_kind,__LINE__);
+    check_unsigned("piece 0 register",0,pieces[0].ep_value,
+        __LINE__);
+    check_unsigned("piece 0 bits",32,pieces[0].ep_size_bits,
+        __LINE__);
+    check_int("piece 1 kind",DW_EXPR_LOC_EMPTY,
+        pieces[1].ep_kind,__LINE__);
+    check_unsigned("piece 1 bits",32,pieces[1].ep_size_bits,
+        __LINE__);
+    check_int("piece 2 kind",DW_EXPR_LOC_MEMORY,
+        pieces[2].ep_kind,__LINE__);
+    check_unsigned("piece 2 address",FRAME_BASE+8,
+        pieces[2].ep_value,__LINE__);
+    check_unsigned("piece 2 bits",64,pieces[2].ep_size_bits,
+        __LINE__);
+    check_int("piece 3 kind",DW_EXPR_LOC_VALUE,
+        pieces[3].ep_kind,__LINE__);
+    check_unsigned("piece 3 value",5,pieces[3].ep_value,
+        __LINE__);
+    check_unsigned("piece 3 bits",3,pieces[3].ep_size_bits,
+        __LINE__);
+    check_unsigned("piece 3 bit offset",2,
+        pieces[3].ep_bit_offset,__LINE__);
+
+    /*  Fewer pieces than the expression has. */
+    memset(pieces,0,sizeof(pieces));
+    res = dwarf_expr_evaluate(prog,&ctx,pieces,2,&count,&err);
+    check_int("two pieces",DW_DLV_OK,res,__LINE__);
+    check_unsigned("two pieces count",4,count,__LINE__);
+    check_int("two pieces, third untouched",0,pieces[2].ep_kind,
+        __LINE__);
+    res = dwarf_expr_evaluate(prog,&ctx,NULL,0,&count,&err);
+    check_int("no pieces",DW_DLV_OK,res,__LINE__);
+    check_unsigned("no pieces count",4,count,__LINE__);
+
+    res = compile_named(dbg,"implicit_value",&prog,&err);
+    check_int("implicit_value compile",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        return;
+    }
+    memset(pieces,0,sizeof(pieces));
+    res = dwarf_expr_evaluate(prog,&ctx,pieces,5,&count,&err);
+    check_int("implicit_value",DW_DLV_OK,res,__LINE__);
+    check_int("implicit_value kind",DW_EXPR_LOC_IMPLICIT,
+        pieces[0].ep_kind,__LINE__);
+    check_unsigned("implicit_value length",4,
+        pieces[0].ep_data_len,__LINE__);
+    if (!pieces[0].ep_data ||
+        memcmp(pieces[0].ep_data,implicit_bytes,4)) {
+        printf("FAIL implicit_value data\n");
+        ++errcount;
+    }
+}
+
+/*  The context: missing functions, an initial value. */
+static void
+test_context(Dwarf_Debug dbg)
+{
+    Dwarf_Expr_Program prog = 0;
+    Dwarf_Expr_Program other = 0;
+    Dwarf_Expr_Context ctx;
+    Dwarf_Expr_Piece piece;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    memset(&ctx,0,sizeof(ctx));
+    compile_named(dbg,"fbreg",&prog,&err);
+    res = dwarf_expr_evaluate(prog,&ctx,&piece,1,&count,&err);
+    check_int("no frame base function",DW_DLV_NO_ENTRY,res,
+        __LINE__);
+    compile_named(dbg,"breg then plus",&prog,&err);
+    res = dwarf_expr_evaluate(prog,&ctx,&piece,1,&count,&err);
+    check_int("no register function",DW_DLV_NO_ENTRY,res,
+        __LINE__);
+    compile_named(dbg,"call_frame_cfa",&prog,&err);
+    res = dwarf_expr_evaluate(prog,&ctx,&piece,1,&count,&err);
+    check_int("no cfa function",DW_DLV_NO_ENTRY,res,__LINE__);
+    compile_named(dbg,"form_tls_address",&prog,&err);
+    res = dwarf_expr_evaluate(prog,&ctx,&piece,1,&count,&err);
+    check_int("no tls function",DW_DLV_NO_ENTRY,res,__LINE__);
+    /*  64 + 64, then deref */
+    compile_named(dbg,"deref below memory",&prog,&err);
+    res = dwarf_expr_evaluate(prog,&ctx,&piece,1,&count,&err);
+    check_int("no memory function",DW_DLV_NO_ENTRY,res,__LINE__);
+    full_context(&ctx);
+    res = dwarf_expr_evaluate(prog,&ctx,&piece,1,&count,&err);
+    check_int("below the memory",DW_DLV_NO_ENTRY,res,__LINE__);
+
+    /*  As DW_AT_data_member_location pushes the
+        address of the containing object. */
+    compile_named(dbg,"member",&prog,&err);
+    ctx.ec_push_initial = 1;
+    ctx.ec_initial_value = 0x5000;
+    res = dwarf_expr_evaluate(prog,&ctx,&piece,1,&count,&err);
+    check_int("initial value",DW_DLV_OK,res,__LINE__);
+    check_unsigned("initial value",0x5008,piece.ep_value,__LINE__);
+    ctx.ec_push_initial = 0;
+
+    /*  The same bytes elsewhere are another program,
+        with the same result. */
+    compile_named(dbg,"fbreg",&prog,&err);
+    res = compile_named(dbg,"fbreg copy",&other,&err);
+    check_int("copy",DW_DLV_OK,res,__LINE__);
+    check_int("copy is another program",1,prog != other,__LINE__);
+    res = dwarf_expr_evaluate(other,&ctx,&piece,1,&count,&err);
+    check_int("copy",DW_DLV_OK,res,__LINE__);
+    check_unsigned("copy",FRAME_BASE-8,piece.ep_value,__LINE__);
+}
+
+static void
+test_overflow(Dwarf_Debug dbg)
+{
+    Dwarf_Expr_Program prog = 0;
+    Dwarf_Expr_Context ctx;
+    Dwarf_Expr_Piece piece;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    /*  64 values fit on the stack, 65 do not. */
+    full_context(&ctx);
+    res = compile_named(dbg,"64 values",&prog,&err);
+    check_int("64 values",DW_DLV_OK,res,__LINE__);
+    res = dwarf_expr_evaluate(prog,&ctx,&piece,1,&count,&err);
+    check_int("64 values",DW_DLV_OK,res,__LINE__);
+    check_unsigned("64 values",1,piece.ep_value,__LINE__);
+    res = compile_named(dbg,"65 values",&prog,&err);
+    check_int("65 values",DW_DLV_OK,res,__LINE__);
+    res = dwarf_expr_evaluate(prog,&ctx,&piece,1,&count,&err);
+    check_int("65 values",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(dbg,err);
+    }
+}
+
+static void
+test_errors(Dwarf_Debug dbg)
+{
+    Dwarf_Expr_Program prog = 0;
+    Dwarf_Expr_Context ctx;
+    Dwarf_Expr_Piece piece;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Error err = 0;
+    Dwarf_Loc_Head_c head = 0;
+    Dwarf_Locdesc_c locdesc = 0;
+    int res = 0;
+
+    full_context(&ctx);
+    res = dwarf_expr_compile(NULL,&prog,&err);
+    check_int("compile NULL locdesc",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(NULL,err);
+        err = 0;
+    }
+    named_location(dbg,"minus",&head,&locdesc);
+    res = dwarf_expr_compile(locdesc,NULL,&err);
+    check_int("compile NULL program_out",DW_DLV_ERROR,res,
+        __LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(dbg,err);
+        err = 0;
+    }
+    res = dwarf_expr_compile(locdesc,&prog,&err);
+    check_int("compile",DW_DLV_OK,res,__LINE__);
+    dwarf_dealloc_loc_head_c(head);
+    if (res != DW_DLV_OK) {
+        return;
+    }
+
+    res = dwarf_expr_evaluate(NULL,&ctx,&piece,1,&count,&err);
+    check_int("evaluate NULL program",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(NULL,err);
+        err = 0;
+    }
+    res = dwarf_expr_evaluate(prog,NULL,&piece,1,&count,&err);
+    check_int("evaluate NULL context",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(dbg,err);
+        err = 0;
+    }
+    res = dwarf_expr_evaluate(prog,&ctx,&piece,1,NULL,&err);
+    check_int("evaluate NULL count",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(dbg,err);
+        err = 0;
+    }
+    res = dwarf_expr_evaluate(prog,&ctx,NULL,1,&count,&err);
+    check_int("evaluate NULL pieces",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(dbg,err);
+        err = 0;
+    }
+}
+
+/*  The result of a one operator expression from the
+    operator and operands libdwarf decoded.
+    Returns 0 for an operator not checked here. */
+static int
+expected_single_op(Dwarf_Small op,Dwarf_Unsigned op1,
+    Dwarf_Unsigned op2,Dwarf_Half address_size,
+    Dwarf_Small *kind,Dwarf_Unsigned *value)
+{
+    Dwarf_Unsigned mask = address_size < 8?
+        ((Dwarf_Unsigned)1 << (address_size*8)) - 1:ALL_ONES;
+
+    *kind = DW_EXPR_LOC_MEMORY;
+    if (op >= DW_OP_reg0 && op <= DW_OP_reg31) {
+        *kind = DW_EXPR_LOC_REGISTER;
+        *value = op - DW_OP_reg0;
+    } else if (op == DW_OP_regx) {
+        *kind = DW_EXPR_LOC_REGISTER;
+        *value = op1;
+    } else if (op >= DW_OP_breg0 && op <= DW_OP_breg31) {
+        *value = (REGVAL(op - DW_OP_breg0) + op1) & mask;
+    } else if (op == DW_OP_bregx) {
+        if (op1 >= REG_LIMIT) {
+            return 0;
+        }
+        *value = (REGVAL(op1) + op2) & mask;
+    } else if (op == DW_OP_fbreg) {
+        *value = (FRAME_BASE + op1) & mask;
+    } else if (op == DW_OP_addr) {
+        *value = op1;
+    } else if (op == DW_OP_call_frame_cfa) {
+        *value = CFA;
+    } else {
+        return 0;
+    }
+    return 1;
+}
+
+struct walk_s {
+    Dwarf_Debug    w_dbg;
+    Dwarf_Half     w_address_size;
+    unsigned       w_exprs;
+    unsigned       w_checked;
+};
+
+static void
+check_location(struct walk_s *w,Dwarf_Attribute attr)
+{
+    Dwarf_Loc_Head_c head = 0;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Unsigned i = 0;
+    Dwarf_Error err = 0;
+    Dwarf_Expr_Context ctx;
+    int res = 0;
+
+    full_context(&ctx);
+    res = dwarf_get_loclist_c(attr,&head,&count,&err);
+    check_int("dwarf_get_loclist_c",1,res != DW_DLV_ERROR,
+        __LINE__);
+    if (res != DW_DLV_OK) {
+        if (res == DW_DLV_ERROR) {
+            dwarf_dealloc_error(w->w_dbg,err);
+        }
+        return;
+    }
+    for (i = 0; i < count; ++i) {
+        Dwarf_Locdesc_c locdesc = 0;
+        Dwarf_Expr_Program prog = 0;
+        Dwarf_Expr_Program again = 0;
+        Dwarf_Expr_Piece pieces[8];
+        Dwarf_Unsigned piece_count = 0;
+        Dwarf_Small lle = 0;
+        Dwarf_Small source = 0;
+        Dwarf_Unsigned op_count = 0;
+        Dwarf_Unsigned u = 0;
+        Dwarf_Bool unavail = 0;
+        Dwarf_Addr a = 0;
+        Dwarf_Small op = 0;
+        Dwarf_Unsigned op1 = 0;
+        Dwarf_Unsigned op2 = 0;
+        Dwarf_Unsigned op3 = 0;
+        Dwarf_Small kind = 0;
+        Dwarf_Unsigned value = 0;
+
+        res = dwarf_get_locdesc_entry_d(head,i,&lle,&u,&u,
+            &unavail,&a,&a,&op_count,&locdesc,&source,&u,&u,&err);
+        check_int("dwarf_get_locdesc_entry_d",DW_DLV_OK,res,
+            __LINE__);
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        res = dwarf_expr_compile(locdesc,&prog,&err);
+        check_int("dwarf_expr_compile",DW_DLV_OK,res,__LINE__);
+        if (res != DW_DLV_OK) {
+            if (res == DW_DLV_ERROR) {
+                printf("  %s\n",dwarf_errmsg(err));
+                dwarf_dealloc_error(w->w_dbg,err);
+            }
+            continue;
+        }
+        ++w->w_exprs;
+        res = dwarf_expr_compile(locdesc,&again,&err);
+        check_int("dwarf_expr_compile again",DW_DLV_OK,res,
+            __LINE__);
+        check_int("dwarf_expr_compile again",1,prog == again,
+            __LINE__);
+        memset(pieces,0,sizeof(pieces));
+        res = dwarf_expr_evaluate(prog,&ctx,pieces,8,
+            &piece_count,&err);
+        /*  Real expressions may use DW_OP_entry_value etc,
+            but they are not invalid. */
+        check_int("dwarf_expr_evaluate",1,res != DW_DLV_ERROR,
+            __LINE__);
+        if (res != DW_DLV_OK) {
+            if (res == DW_DLV_ERROR) {
+                printf("  %s\n",dwarf_errmsg(err));
+                dwarf_dealloc_error(w->w_dbg,err);
+            }
+            continue;
+        }
+        if (op_count != 1) {
+            continue;
+        }
+        res = dwarf_get_location_op_value_c(locdesc,0,&op,&op1,
+            &op2,&op3,&u,&err);
+        check_int("dwarf_get_location_op_value_c",DW_DLV_OK,res,
+            __LINE__);
+        if (res != DW_DLV_OK ||
+            !expected_single_op(op,op1,op2,w->w_address_size,
+            &kind,&value)) {
+            continue;
+        }
+        ++w->w_checked;
+        check_unsigned("single op piece count",1,piece_count,
+            __LINE__);
+        if (pieces[0].ep_kind != kind ||
+            pieces[0].ep_value != value) {
+            printf("FAIL op 0x%x expected kind %u value 0x%llx "
+                "got kind %u value 0x%llx\n",op,kind,
+                (unsigned long long)value,pieces[0].ep_kind,
+                (unsigned long long)pieces[0].ep_value);
+            ++errcount;
+        }
+    }
+    dwarf_dealloc_loc_head_c(head);
+}
+
+/*  Checks die, its children and its later siblings.
+    die belongs to the caller. */
+static void
+walk_dies(struct walk_s *w,Dwarf_Die die)
+{
+    static const Dwarf_Half attrs[] = {
+        DW_AT_location, DW_AT_frame_base, 0 };
+    Dwarf_Die cur = die;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    for (;;) {
+        Dwarf_Die child = 0;
+        Dwarf_Die sib = 0;
+        int a = 0;
+
+        for (a = 0; attrs[a]; ++a) {
+            Dwarf_Attribute attr = 0;
+
+            res = dwarf_attr(cur,attrs[a],&attr,&err);
+            if (res == DW_DLV_OK) {
+                check_location(w,attr);
+                dwarf_dealloc_attribute(attr);
+            }
+        }
+        res = dwarf_child(cur,&child,&err);
+        check_int("dwarf_child",1,res != DW_DLV_ERROR,__LINE__);
+        if (res == DW_DLV_OK) {
+            walk_dies(w,child);
+            dwarf_dealloc_die(child);
+        }
+        res = dwarf_siblingof_c(cur,&sib,&err);
+        check_int("dwarf_siblingof_c",1,res != DW_DLV_ERROR,
+            __LINE__);
+        if (cur != die) {
+            dwarf_dealloc_die(cur);
+        }
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        cur = sib;
+    }
+}
+
+static void
+test_object(const char *obj)
+{
+    struct walk_s w;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    memset(&w,0,sizeof(w));
+    w.w_dbg = open_obj(obj);
+    for (;;) {
+        Dwarf_Die cu_die = 0;
+        Dwarf_Half address_size = 0;
+
+        res = dwarf_next_cu_header_e(w.w_dbg,1,&cu_die,
+            0,0,0,&address_size,0,0,0,0,0,0,&err);
+        if (res != DW_DLV_OK) {
+            check_int("dwarf_next_cu_header_e",DW_DLV_NO_ENTRY,
+                res,__LINE__);
+            break;
+        }
+        w.w_address_size = address_size;
+        walk_dies(&w,cu_die);
+        dwarf_dealloc_die(cu_die);
+    }
+    if (!w.w_exprs || !w.w_checked) {
+        printf("FAIL %s: %u expressions, %u checked\n",obj,
+            w.w_exprs,w.w_checked);
+        ++errcount;
+    }
+    dwarf_finish(w.w_dbg);
+}
+
+int
+main(int argc, char **argv)
+{
+    Dwarf_Debug dbg = 0;
+
+    testobj_srcdir(argc,argv);
+    dbg = open_obj("testexprLE64ELf.testme");
+    test_expr_cases(dbg);
+    test_pieces(dbg);
+    test_context(dbg);
+    test_overflow(dbg);
+    test_errors(dbg);
+    dwarf_finish(dbg);
+
+    test_object("dummyexecutable.debug");
+    test_object("testnamesLE64ELf4.testme");
+    test_object("testnamesLE64ELf5.testme");
+    testobj_exit("test_expr_eval");
+    return 0;
+}
@@ -260,6 +260,60 @@ test3(Dwarf_P_Debug dbg)
 
 }
 
+static void
+test4(Dwarf_P_Debug dbg)
+{
+    int res = 0;
+    int err = 0;
+
+    res = _dwarf_log_extra_flagstrings(dbg,
+        "compress_threads=4",&err);
+    check_expected(DW_DLV_OK,res,0,err,
+        4,dbg->de_compress_threads,
+        __LINE__);
+
+    resetdbg(dbg);
+    err = 0;
+    res = _dwarf_log_extra_flagstrings(dbg,
+        "compress_type=3",&err);
+    check_expected(DW_DLV_ERROR,res,
+        DW_DLE_PRO_INIT_EXTRAS_ERR,err,
+        0,dbg->de_compress_type,
+        __LINE__);
+
+    resetdbg(dbg);
+    err = 0;
+    res = _dwarf_log_extra_flagstrings(dbg,
+        "compress_type=2",&err);
+#if defined(HAVE_ZLIB) && defined(HAVE_ZSTD)
+    check_expected(DW_DLV_OK,res,0,err,
+        2,dbg->de_compress_type,
+        __LINE__);
+#else
+    check_expected(DW_DLV_ERROR,res,
+        DW_DLE_ZDEBUG_REQUIRES_ZLIB,err,
+        0,dbg->de_compress_type,
+        __LINE__);
+#endif
+
+    resetdbg(dbg);
+    err = 0;
+    res = _dwarf_log_extra_flagstrings(dbg,
+        "opcode_base=13,optimize_line_table=1",&err);
+    check_expected(DW_DLV_OK,res,0,err,
+        1,dbg->de_optimize_line_table,
+        __LINE__);
+
+    resetdbg(dbg);
+    err = 0;
+    res = _dwarf_log_extra_flagstrings(dbg,
+        "optimize_line_table=2",&err);
+    check_expected(DW_DLV_ERROR,res,
+        DW_DLE_PRO_INIT_EXTRAS_ERR,err,
+        0,dbg->de_optimize_line_table,
+        __LINE__);
+}
+
 int main(void)
 {
 
@@ -275,6 +329,8 @@ int main(void)
     test2(dbg);
     resetdbg(dbg);
     test3(dbg);
+    resetdbg(dbg);
+    test4(dbg);
 
     if (errcount) {
         return 1;
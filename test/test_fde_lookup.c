@@ -0,0 +1,285 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Tests dwarf_find_fde_at_pc() against
+    dwarf_get_fde_list() (or dwarf_get_fde_list_eh())
+    followed by dwarf_get_fde_at_pc(), at the first,
+    last and one past the last address of every FDE
+    and just before the first one.
+    The two must find the same FDE with the same
+    range, CIE and instructions.
+
+    ./test_fde_lookup -f <top source directory>
+    or set environment variable DWTOPSRCDIR. */
+
+#include <config.h>
+
+#include <stdio.h>  /* printf() */
+#include <string.h> /* memcmp() memset() */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "testobj_util.h"
+
+/*  The two FDEs, from different Dwarf_Debug,
+    must describe the same bytes. */
+static void
+compare_fdes(Dwarf_Fde expect,Dwarf_Fde got,Dwarf_Addr pc)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Addr elow = 0;
+    Dwarf_Addr glow = 0;
+    Dwarf_Unsigned elen = 0;
+    Dwarf_Unsigned glen = 0;
+    Dwarf_Off ecie = 0;
+    Dwarf_Off gcie = 0;
+    Dwarf_Off eoff = 0;
+    Dwarf_Off goff = 0;
+    Dwarf_Small *einstr = 0;
+    Dwarf_Small *ginstr = 0;
+    Dwarf_Unsigned einstrlen = 0;
+    Dwarf_Unsigned ginstrlen = 0;
+    Dwarf_Small vtype = 0;
+    Dwarf_Unsigned offrel = 0;
+    Dwarf_Unsigned reg = 0;
+    Dwarf_Signed eoffset = 0;
+    Dwarf_Signed goffset = 0;
+    Dwarf_Block block;
+    Dwarf_Addr row = 0;
+    Dwarf_Bool more = 0;
+    Dwarf_Addr next = 0;
+    int res = 0;
+
+    res = dwarf_get_fde_range(got,&glow,&glen,0,0,&gcie,0,
+        &goff,&err);
+    check_int("dwarf_get_fde_range",DW_DLV_OK,res,__LINE__);
+    res = dwarf_get_fde_range(expect,&elow,&elen,0,0,&ecie,0,
+        &eoff,&err);
+    check_int("dwarf_get_fde_range",DW_DLV_OK,res,__LINE__);
+    check_unsigned("fde low pc",elow,glow,__LINE__);
+    check_unsigned("fde length",elen,glen,__LINE__);
+    check_unsigned("fde cie offset",ecie,gcie,__LINE__);
+    check_unsigned("fde offset",eoff,goff,__LINE__);
+
+    res = dwarf_get_fde_instr_bytes(got,&ginstr,&ginstrlen,&err);
+    check_int("dwarf_get_fde_instr_bytes",DW_DLV_OK,res,__LINE__);
+    res = dwarf_get_fde_instr_bytes(expect,&einstr,&einstrlen,
+        &err);
+    check_int("dwarf_get_fde_instr_bytes",DW_DLV_OK,res,__LINE__);
+    check_unsigned("fde instructions length",einstrlen,ginstrlen,
+        __LINE__);
+    if (einstrlen == ginstrlen && einstrlen &&
+        memcmp(einstr,ginstr,einstrlen)) {
+        printf("FAIL fde instructions differ at pc 0x%llx\n",
+            (unsigned long long)pc);
+        ++errcount;
+    }
+
+    /*  The CIE must have been read as well. */
+    memset(&block,0,sizeof(block));
+    res = dwarf_get_fde_info_for_cfa_reg3_c(got,pc,&vtype,
+        &offrel,&reg,&goffset,&block,&row,&more,&next,&err);
+    check_int("cfa rule",DW_DLV_OK,res,__LINE__);
+    res = dwarf_get_fde_info_for_cfa_reg3_c(expect,pc,&vtype,
+        &offrel,&reg,&eoffset,&block,&row,&more,&next,&err);
+    check_int("cfa rule",DW_DLV_OK,res,__LINE__);
+    check_unsigned("cfa offset",(Dwarf_Unsigned)eoffset,
+        (Dwarf_Unsigned)goffset,__LINE__);
+}
+
+/*  Look up pc both ways. */
+static void
+lookup_pc(Dwarf_Debug dbg,Dwarf_Bool is_eh,Dwarf_Fde *fdes,
+    Dwarf_Addr pc)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Fde efde = 0;
+    Dwarf_Fde gfde = 0;
+    Dwarf_Fde again = 0;
+    Dwarf_Addr elo = 0;
+    Dwarf_Addr ehi = 0;
+    Dwarf_Addr glo = 0;
+    Dwarf_Addr ghi = 0;
+    int eres = 0;
+    int gres = 0;
+
+    eres = dwarf_get_fde_at_pc(fdes,pc,&efde,&elo,&ehi,&err);
+    check_int("dwarf_get_fde_at_pc",1,eres != DW_DLV_ERROR,
+        __LINE__);
+    gres = dwarf_find_fde_at_pc(dbg,is_eh,pc,&gfde,&glo,&ghi,
+        &err);
+    if (gres != eres) {
+        printf("FAIL dwarf_find_fde_at_pc pc 0x%llx "
+            "expected %d got %d\n",
+            (unsigned long long)pc,eres,gres);
+        ++errcount;
+        if (gres == DW_DLV_ERROR) {
+            dwarf_dealloc_error(dbg,err);
+        }
+        return;
+    }
+    if (gres != DW_DLV_OK) {
+        return;
+    }
+    check_unsigned("low pc",elo,glo,__LINE__);
+    check_unsigned("high pc",ehi,ghi,__LINE__);
+    compare_fdes(efde,gfde,pc);
+
+    /*  Found once, then the same FDE again. */
+    gres = dwarf_find_fde_at_pc(dbg,is_eh,pc,&again,0,0,&err);
+    check_int("dwarf_find_fde_at_pc again",DW_DLV_OK,gres,
+        __LINE__);
+    if (gres == DW_DLV_OK && again != gfde) {
+        printf("FAIL dwarf_find_fde_at_pc pc 0x%llx "
+            "created the FDE twice\n",(unsigned long long)pc);
+        ++errcount;
+    }
+}
+
+static void
+test_object(const char *name,Dwarf_Bool is_eh)
+{
+    Dwarf_Debug ldbg = 0;
+    Dwarf_Debug fdbg = 0;
+    Dwarf_Error err = 0;
+    Dwarf_Cie *cies = 0;
+    Dwarf_Fde *fdes = 0;
+    Dwarf_Signed cie_count = 0;
+    Dwarf_Signed fde_count = 0;
+    Dwarf_Signed i = 0;
+    Dwarf_Fde fde = 0;
+    int res = 0;
+
+    /*  The list in one Dwarf_Debug, so the lookups
+        in the other one start from nothing. */
+    ldbg = open_obj(name);
+    if (is_eh) {
+        res = dwarf_get_fde_list_eh(ldbg,&cies,&cie_count,
+            &fdes,&fde_count,&err);
+    } else {
+        res = dwarf_get_fde_list(ldbg,&cies,&cie_count,
+            &fdes,&fde_count,&err);
+    }
+    check_int(name,DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        dwarf_finish(ldbg);
+        return;
+    }
+    fdbg = open_obj(name);
+    /*  Highest FDE first, so the index is not just
+        filled in address order. */
+    for (i = fde_count; i > 0; --i) {
+        Dwarf_Addr low = 0;
+        Dwarf_Unsigned len = 0;
+
+        res = dwarf_get_fde_range(fdes[i-1],&low,&len,0,0,0,0,0,
+            &err);
+        check_int("dwarf_get_fde_range",DW_DLV_OK,res,__LINE__);
+        if (!len) {
+            continue;
+        }
+        lookup_pc(fdbg,is_eh,fdes,low + len - 1);
+        lookup_pc(fdbg,is_eh,fdes,low);
+        lookup_pc(fdbg,is_eh,fdes,low + len);
+        lookup_pc(fdbg,is_eh,fdes,low - 1);
+    }
+    /*  Nothing at the ends of the address space. */
+    res = dwarf_find_fde_at_pc(fdbg,is_eh,0,&fde,0,0,&err);
+    check_int("pc 0",DW_DLV_NO_ENTRY,res,__LINE__);
+    res = dwarf_find_fde_at_pc(fdbg,is_eh,~(Dwarf_Addr)0,&fde,
+        0,0,&err);
+    check_int("highest pc",DW_DLV_NO_ENTRY,res,__LINE__);
+    /*  The other section is absent. */
+    res = dwarf_find_fde_at_pc(fdbg,!is_eh,0x401000,&fde,0,0,
+        &err);
+    check_int("other section",DW_DLV_NO_ENTRY,res,__LINE__);
+    dwarf_dealloc_fde_cie_list(ldbg,cies,cie_count,
+        fdes,fde_count);
+    dwarf_finish(ldbg);
+    dwarf_finish(fdbg);
+}
+
+static void
+test_errors(void)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Error err = 0;
+    Dwarf_Fde fde = 0;
+    Dwarf_Addr lo = 0;
+    Dwarf_Addr hi = 0;
+    int res = 0;
+
+    dbg = open_obj("testunwindehLE64ELf.testme");
+    res = dwarf_find_fde_at_pc(dbg,1,0x401000,NULL,&lo,&hi,&err);
+    check_int("NULL returned_fde",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        check_unsigned("NULL returned_fde",DW_DLE_FDE_PTR_NULL,
+            dwarf_errno(err),__LINE__);
+        dwarf_dealloc_error(dbg,err);
+        err = 0;
+    }
+    /*  lopc and hipc are optional. */
+    res = dwarf_find_fde_at_pc(dbg,1,0x401000,&fde,0,0,&err);
+    check_int("NULL lopc and hipc",DW_DLV_OK,res,__LINE__);
+    res = dwarf_find_fde_at_pc(dbg,1,0x401003,&fde,&lo,&hi,&err);
+    check_int("_start",DW_DLV_OK,res,__LINE__);
+    check_unsigned("_start low pc",0x401000,lo,__LINE__);
+    check_unsigned("_start high pc",0x401006,hi,__LINE__);
+    dwarf_finish(dbg);
+
+    res = dwarf_find_fde_at_pc(NULL,1,0x401000,&fde,0,0,&err);
+    check_int("NULL dbg",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(NULL,err);
+        err = 0;
+    }
+
+    /*  No frame sections at all. */
+    dbg = open_obj("testsupaltLE64ELf.testme");
+    res = dwarf_find_fde_at_pc(dbg,1,0x401000,&fde,0,0,&err);
+    check_int("no .eh_frame",DW_DLV_NO_ENTRY,res,__LINE__);
+    res = dwarf_find_fde_at_pc(dbg,0,0x401000,&fde,0,0,&err);
+    check_int("no .debug_frame",DW_DLV_NO_ENTRY,res,__LINE__);
+    dwarf_finish(dbg);
+}
+
+int
+main(int argc, char **argv)
+{
+    testobj_srcdir(argc,argv);
+    test_object("dummyexecutable",1);
+    test_object("testunwindehLE64ELf.testme",1);
+    test_object("testunwinddfLE64ELf.testme",0);
+    test_errors();
+    testobj_exit("test_fde_lookup");
+    return 0;
+}
@@ -0,0 +1,444 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Tests dwarf_init_path_sections().
+    Opening an object with only the sections line
+    tables need, or only a frame section, must give
+    the same line rows, FDEs and section bytes as a
+    full dwarf_init_path(), on Elf executables,
+    Elf relocatable objects (where the named sections
+    are relocated), PE and Mach-O.  Every other
+    section must be absent.
+
+    ./test_init_sections -f <top source directory>
+    or set environment variable DWTOPSRCDIR. */
+
+#include <config.h>
+
+#include <stdio.h>  /* printf() */
+#include <stdlib.h> /* exit() */
+#include <string.h> /* memcmp() strcmp() strlen() */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "testobj_util.h"
+
+static const char *line_sections[] = {
+".debug_info",
+".debug_abbrev",
+".debug_line",
+".debug_str",
+".debug_line_str",
+".debug_str_offsets",
+};
+#define LINE_SECTIONS_COUNT 6
+
+static const char *eh_sections[] = {".eh_frame"};
+static const char *frame_sections[] = {".debug_frame"};
+
+static const char *line_objects[] = {
+"dummyexecutable.debug",
+"testnamesLE64ELf4.testme",
+"testnamesLE64ELf5.testme",
+"testobjLE32PE.exe",
+"test-mach-o-32.dSYM",
+0
+};
+
+/*  Sections whose bytes are compared, present or not. */
+static const char *all_sections[] = {
+".debug_info",
+".debug_abbrev",
+".debug_line",
+".debug_str",
+".debug_line_str",
+".debug_str_offsets",
+".debug_frame",
+".eh_frame",
+".debug_aranges",
+".debug_ranges",
+".debug_rnglists",
+".debug_loc",
+".debug_loclists",
+".debug_addr",
+".debug_names",
+".debug_pubnames",
+0
+};
+
+/*  Counts and sums of what was read, to compare
+    a subset init with a full one. */
+struct summary_s {
+    Dwarf_Unsigned s_count;
+    Dwarf_Unsigned s_sum;
+};
+
+static Dwarf_Debug
+open_sections(const char *name,const char **names,
+    unsigned count)
+{
+    const char *path = test_obj_path(name);
+    Dwarf_Debug dbg = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_init_path_sections(path,0,0,
+        DW_GROUPNUMBER_ANY,0,names,count,0,0,&dbg,&err);
+    if (res != DW_DLV_OK) {
+        printf("FAIL dwarf_init_path_sections %s: %d %s\n",
+            path,res,
+            res == DW_DLV_ERROR? dwarf_errmsg(err):"");
+        if (res == DW_DLV_ERROR) {
+            dwarf_dealloc_error(dbg,err);
+        }
+        exit(EXIT_FAILURE);
+    }
+    return dbg;
+}
+
+static void
+add_bytes(struct summary_s *s,const void *p,Dwarf_Unsigned len)
+{
+    const unsigned char *b = (const unsigned char *)p;
+    Dwarf_Unsigned i = 0;
+
+    for (i = 0; i < len; ++i) {
+        s->s_sum = s->s_sum*31 + b[i];
+    }
+}
+
+/*  The line rows of every CU, with their file names. */
+static void
+line_summary(Dwarf_Debug dbg,struct summary_s *s)
+{
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    s->s_count = 0;
+    s->s_sum = 0;
+    for (;;) {
+        Dwarf_Die cu_die = 0;
+        Dwarf_Unsigned version = 0;
+        Dwarf_Small table_count = 0;
+        Dwarf_Line_Context context = 0;
+        Dwarf_Line *lines = 0;
+        Dwarf_Signed count = 0;
+        Dwarf_Signed i = 0;
+
+        res = dwarf_next_cu_header_e(dbg,1,&cu_die,
+            0,0,0,0,0,0,0,0,0,0,&err);
+        if (res != DW_DLV_OK) {
+            check_int("dwarf_next_cu_header_e",DW_DLV_NO_ENTRY,
+                res,__LINE__);
+            break;
+        }
+        res = dwarf_srclines_b(cu_die,&version,&table_count,
+            &context,&err);
+        check_int("dwarf_srclines_b",1,res != DW_DLV_ERROR,
+            __LINE__);
+        if (res == DW_DLV_OK) {
+            res = dwarf_srclines_from_linecontext(context,
+                &lines,&count,&err);
+            check_int("dwarf_srclines_from_linecontext",
+                DW_DLV_OK,res,__LINE__);
+            for (i = 0; res == DW_DLV_OK && i < count; ++i) {
+                Dwarf_Addr addr = 0;
+                Dwarf_Unsigned lineno = 0;
+                char *name = 0;
+
+                dwarf_lineaddr(lines[i],&addr,&err);
+                dwarf_lineno(lines[i],&lineno,&err);
+                add_bytes(s,&addr,sizeof(addr));
+                add_bytes(s,&lineno,sizeof(lineno));
+                if (dwarf_linesrc(lines[i],&name,&err) ==
+                    DW_DLV_OK) {
+                    add_bytes(s,name,strlen(name));
+                    dwarf_dealloc(dbg,name,DW_DLA_STRING);
+                }
+                ++s->s_count;
+            }
+            dwarf_srclines_dealloc_b(context);
+        }
+        dwarf_dealloc_die(cu_die);
+    }
+}
+
+/*  The range, CIE and instructions of every FDE. */
+static int
+frame_summary(Dwarf_Debug dbg,int is_eh,struct summary_s *s)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Cie *cies = 0;
+    Dwarf_Signed cie_count = 0;
+    Dwarf_Fde *fdes = 0;
+    Dwarf_Signed fde_count = 0;
+    Dwarf_Signed i = 0;
+    int res = 0;
+
+    s->s_count = 0;
+    s->s_sum = 0;
+    if (is_eh) {
+        res = dwarf_get_fde_list_eh(dbg,&cies,&cie_count,
+            &fdes,&fde_count,&err);
+    } else {
+        res = dwarf_get_fde_list(dbg,&cies,&cie_count,
+            &fdes,&fde_count,&err);
+    }
+    if (res == DW_DLV_ERROR) {
+        printf("FAIL fde list: %s\n",dwarf_errmsg(err));
+        ++errcount;
+        dwarf_dealloc_error(dbg,err);
+        return res;
+    }
+    if (res != DW_DLV_OK) {
+        return res;
+    }
+    for (i = 0; i < fde_count; ++i) {
+        Dwarf_Addr low = 0;
+        Dwarf_Unsigned len = 0;
+        Dwarf_Off cie_offset = 0;
+        Dwarf_Off fde_offset = 0;
+        Dwarf_Small *instr = 0;
+        Dwarf_Unsigned instrlen = 0;
+
+        res = dwarf_get_fde_range(fdes[i],&low,&len,0,0,
+            &cie_offset,0,&fde_offset,&err);
+        check_int("dwarf_get_fde_range",DW_DLV_OK,res,__LINE__);
+        add_bytes(s,&low,sizeof(low));
+        add_bytes(s,&len,sizeof(len));
+        add_bytes(s,&cie_offset,sizeof(cie_offset));
+        add_bytes(s,&fde_offset,sizeof(fde_offset));
+        res = dwarf_get_fde_instr_bytes(fdes[i],&instr,&instrlen,
+            &err);
+        check_int("dwarf_get_fde_instr_bytes",DW_DLV_OK,res,
+            __LINE__);
+        if (res == DW_DLV_OK) {
+            add_bytes(s,instr,instrlen);
+        }
+        ++s->s_count;
+    }
+    dwarf_dealloc_fde_cie_list(dbg,cies,cie_count,fdes,fde_count);
+    return DW_DLV_OK;
+}
+
+static int
+in_list(const char *name,const char **names,unsigned count)
+{
+    unsigned i = 0;
+
+    for (i = 0; i < count; ++i) {
+        if (!strcmp(name,names[i])) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*  Named sections have the bytes of a full init,
+    relocated the same way; all others are absent.
+    Returns the number of sections present in full
+    but not named. */
+static int
+compare_sections(const char *obj,Dwarf_Debug full,
+    Dwarf_Debug sub,const char **names,unsigned count)
+{
+    Dwarf_Error err = 0;
+    int left_out = 0;
+    int i = 0;
+
+    for (i = 0; all_sections[i]; ++i) {
+        const Dwarf_Small *fdata = 0;
+        const Dwarf_Small *sdata = 0;
+        Dwarf_Unsigned fsize = 0;
+        Dwarf_Unsigned ssize = 0;
+        int fres = 0;
+        int sres = 0;
+
+        fres = dwarf_get_section_bytes(full,all_sections[i],
+            &fdata,&fsize,&err);
+        check_int("dwarf_get_section_bytes",1,
+            fres != DW_DLV_ERROR,__LINE__);
+        sres = dwarf_get_section_bytes(sub,all_sections[i],
+            &sdata,&ssize,&err);
+        check_int("dwarf_get_section_bytes",1,
+            sres != DW_DLV_ERROR,__LINE__);
+        if (!in_list(all_sections[i],names,count)) {
+            if (sres != DW_DLV_NO_ENTRY) {
+                printf("FAIL %s %s is present\n",obj,
+                    all_sections[i]);
+                ++errcount;
+            }
+            if (fres == DW_DLV_OK) {
+                ++left_out;
+            }
+            continue;
+        }
+        if (fres != sres) {
+            printf("FAIL %s %s: %d in a full init, %d\n",obj,
+                all_sections[i],fres,sres);
+            ++errcount;
+            continue;
+        }
+        if (fres == DW_DLV_OK &&
+            (fsize != ssize || memcmp(fdata,sdata,fsize))) {
+            printf("FAIL %s %s bytes differ\n",obj,
+                all_sections[i]);
+            ++errcount;
+        }
+    }
+    return left_out;
+}
+
+static void
+test_lines(const char *obj)
+{
+    Dwarf_Debug full = open_obj(obj);
+    Dwarf_Debug sub = open_sections(obj,line_sections,
+        LINE_SECTIONS_COUNT);
+    struct summary_s fs;
+    struct summary_s ss;
+    int res = 0;
+
+    line_summary(full,&fs);
+    line_summary(sub,&ss);
+    if (!fs.s_count || fs.s_count != ss.s_count ||
+        fs.s_sum != ss.s_sum) {
+        printf("FAIL %s: %lu line rows in a full init, %lu\n",
+            obj,(unsigned long)fs.s_count,
+            (unsigned long)ss.s_count);
+        ++errcount;
+    }
+    if (!compare_sections(obj,full,sub,line_sections,
+        LINE_SECTIONS_COUNT)) {
+        printf("FAIL %s: no section was left out\n",obj);
+        ++errcount;
+    }
+    res = frame_summary(sub,1,&ss);
+    check_int(".eh_frame absent",DW_DLV_NO_ENTRY,res,__LINE__);
+    res = frame_summary(sub,0,&ss);
+    check_int(".debug_frame absent",DW_DLV_NO_ENTRY,res,__LINE__);
+    dwarf_finish(sub);
+    dwarf_finish(full);
+}
+
+static void
+test_frames(const char *obj,int is_eh)
+{
+    const char **names = is_eh? eh_sections:frame_sections;
+    Dwarf_Debug full = open_obj(obj);
+    Dwarf_Debug sub = open_sections(obj,names,1);
+    Dwarf_Error err = 0;
+    Dwarf_Die cu_die = 0;
+    struct summary_s fs;
+    struct summary_s ss;
+    int res = 0;
+
+    res = frame_summary(full,is_eh,&fs);
+    check_int("full frames",DW_DLV_OK,res,__LINE__);
+    res = frame_summary(sub,is_eh,&ss);
+    check_int("subset frames",DW_DLV_OK,res,__LINE__);
+    if (!fs.s_count || fs.s_count != ss.s_count ||
+        fs.s_sum != ss.s_sum) {
+        printf("FAIL %s: %lu FDEs in a full init, %lu\n",
+            obj,(unsigned long)fs.s_count,
+            (unsigned long)ss.s_count);
+        ++errcount;
+    }
+    compare_sections(obj,full,sub,names,1);
+    res = dwarf_next_cu_header_e(sub,1,&cu_die,
+        0,0,0,0,0,0,0,0,0,0,&err);
+    check_int("no .debug_info",DW_DLV_NO_ENTRY,res,__LINE__);
+    dwarf_finish(sub);
+    dwarf_finish(full);
+}
+
+static void
+test_no_entry_and_errors(void)
+{
+    const char *absent[] = {".debug_nonesuch"};
+    Dwarf_Debug dbg = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_init_path_sections(
+        test_obj_path("dummyexecutable.debug"),0,0,
+        DW_GROUPNUMBER_ANY,0,absent,1,0,0,&dbg,&err);
+    check_int("no named section present",DW_DLV_NO_ENTRY,res,
+        __LINE__);
+    check_int("no dbg",1,dbg == 0,__LINE__);
+    if (res == DW_DLV_OK) {
+        dwarf_finish(dbg);
+        dbg = 0;
+    }
+
+    res = dwarf_init_path_sections(
+        test_obj_path("dummyexecutable.debug"),0,0,
+        DW_GROUPNUMBER_ANY,0,0,3,0,0,&dbg,&err);
+    check_int("NULL names",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        check_int("NULL names errno",DW_DLE_STRING_PTR_NULL,
+            (int)dwarf_errno(err),__LINE__);
+        /*  No dbg was created to hang it on. */
+        dwarf_dealloc_error(0,err);
+        err = 0;
+    }
+    check_int("NULL names, no dbg",1,dbg == 0,__LINE__);
+
+    res = dwarf_init_path_sections(
+        test_obj_path("dummyexecutable.debug"),0,0,
+        DW_GROUPNUMBER_ANY,0,line_sections,0,0,0,&dbg,&err);
+    check_int("zero names",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        check_int("zero names errno",DW_DLE_STRING_PTR_NULL,
+            (int)dwarf_errno(err),__LINE__);
+        dwarf_dealloc_error(0,err);
+        err = 0;
+    }
+    check_int("zero names, no dbg",1,dbg == 0,__LINE__);
+}
+
+int
+main(int argc, char **argv)
+{
+    int i = 0;
+
+    testobj_srcdir(argc,argv);
+    for (i = 0; line_objects[i]; ++i) {
+        test_lines(line_objects[i]);
+    }
+    test_frames("dummyexecutable",1);
+    test_frames("testunwindehLE64ELf.testme",1);
+    test_frames("testunwinddfLE64ELf.testme",0);
+    test_no_entry_and_errors();
+    testobj_exit("test_init_sections");
+    return 0;
+}
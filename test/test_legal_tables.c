@@ -0,0 +1,596 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Checks the legality tables dwarfdump -ka uses against
+    the lists they are generated from.
+    legal_tag_attr_combination(), legal_tag_tree_combination()
+    and legal_attr_formclass_combination() probe bit tables
+    and perfect hashes; here every (tag,attr), (parent,child)
+    and (attr,formclass) pair, over the whole 16 bit range
+    of the second member and with codes above DW_TAG_last
+    and extension codes for the first, is compared with a
+    plain search of tag_attr.list, tag_tree.list,
+    attr_formclass.list and their _ext lists, with
+    the extension tables both checked and suppressed.
+    The per-tag legal counts of the usage report must be
+    the number of distinct pairs in the standard lists.
+
+    ./test_legal_tables -f <top source directory>
+    or set environment variable DWTOPSRCDIR. */
+
+#include "print_tag_attributes_usage.c"
+
+#include <stdlib.h> /* strtoul() */
+#include <string.h> /* memcpy() strchr() strcmp() strcspn()
+    strlen() strncmp() strspn() strstr() */
+
+#include "dd_minimal.h"
+#include "testobj_util.h"
+
+#define LIST_SEPARATOR 0xffffffff
+#define MAX_NAMES      2000
+#define MAX_NAME_LEN   64
+#define MAX_PAIRS      8000
+#define MAX_DOMAIN     1000
+#define ALL_SECOND     0x10000
+
+/*  What dwarfdump proper would supply. */
+struct glflags_s glflags;
+void dd_minimal_count_global_error(void) {}
+
+void
+DWARF_CHECK_COUNT(Dwarf_Check_Categories category,int inc)
+{
+    (void)category;
+    (void)inc;
+}
+
+void
+DWARF_CHECK_ERROR3(Dwarf_Check_Categories category,
+    const char *str1,const char *str2,const char *strexpl)
+{
+    (void)category;
+    (void)str1;
+    (void)str2;
+    (void)strexpl;
+}
+
+void
+checkcache_note_usage(int kind,unsigned k1,unsigned k2,
+    unsigned k3)
+{
+    (void)kind;
+    (void)k1;
+    (void)k2;
+    (void)k3;
+}
+
+const char *
+get_TAG_name(unsigned int val_in,int printonerr)
+{
+    (void)val_in;
+    (void)printonerr;
+    return "";
+}
+
+const char *
+get_AT_name(unsigned int val_in,int printonerr)
+{
+    (void)val_in;
+    (void)printonerr;
+    return "";
+}
+
+const char *
+get_FORM_name(unsigned int val_in,int printonerr)
+{
+    (void)val_in;
+    (void)printonerr;
+    return "";
+}
+
+const char *
+get_FORM_CLASS_name(unsigned int val_in,int printonerr)
+{
+    (void)val_in;
+    (void)printonerr;
+    return "";
+}
+
+void
+tag_specific_globals_setup(Dwarf_Debug dbg,Dwarf_Half val,
+    int die_indent_level)
+{
+    (void)dbg;
+    (void)val;
+    (void)die_indent_level;
+}
+
+/*  The DW_ names of dwarf.h and the DW_FORM_CLASS
+    names of libdwarf.h, which is all the lists use. */
+struct name_s {
+    char         n_name[MAX_NAME_LEN];
+    unsigned int n_value;
+};
+static struct name_s names[MAX_NAMES];
+static unsigned name_count;
+
+/*  (first<<16)|second for every pair of one list,
+    sorted and without duplicates. */
+struct pairs_s {
+    unsigned int p_key[MAX_PAIRS];
+    unsigned     p_count;
+};
+static struct pairs_s ta_std;
+static struct pairs_s ta_ext;
+static struct pairs_s tt_std;
+static struct pairs_s tt_ext;
+static struct pairs_s af_std;
+static struct pairs_s af_ext;
+
+static unsigned int tag_domain[MAX_DOMAIN];
+static unsigned tag_domain_count;
+
+static char *
+read_file(const char *relpath)
+{
+    const char *path = test_src_path(relpath);
+    FILE *f = fopen(path,"r");
+    char *buf = 0;
+    long len = 0;
+
+    if (!f) {
+        printf("FAIL cannot open %s\n",path);
+        exit(EXIT_FAILURE);
+    }
+    fseek(f,0,SEEK_END);
+    len = ftell(f);
+    fseek(f,0,SEEK_SET);
+    buf = (char *)malloc(len+1);
+    if (!buf || fread(buf,1,len,f) != (size_t)len) {
+        printf("FAIL cannot read %s\n",path);
+        exit(EXIT_FAILURE);
+    }
+    buf[len] = 0;
+    fclose(f);
+    return buf;
+}
+
+/*  Blanks out C comments so only tokens remain. */
+static void
+strip_comments(char *buf)
+{
+    char *p = buf;
+
+    while ((p = strstr(p,"/*"))) {
+        char *e = strstr(p+2,"*/");
+
+        if (!e) {
+            e = p + strlen(p) - 2;
+        }
+        for ( ; p < e+2; ++p) {
+            if (*p != '\n') {
+                *p = ' ';
+            }
+        }
+    }
+}
+
+static void
+add_name(const char *name,size_t len,unsigned int value)
+{
+    if (name_count >= MAX_NAMES || len >= MAX_NAME_LEN) {
+        printf("FAIL too many or too long names\n");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(names[name_count].n_name,name,len);
+    names[name_count].n_name[len] = 0;
+    names[name_count].n_value = value;
+    ++name_count;
+}
+
+static int
+lookup_name(const char *name,size_t len,unsigned int *value)
+{
+    unsigned i = 0;
+
+    for (i = 0; i < name_count; ++i) {
+        if (strlen(names[i].n_name) == len &&
+            !strncmp(names[i].n_name,name,len)) {
+            *value = names[i].n_value;
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/*  A number or a name already seen. */
+static int
+token_value(const char *tok,size_t len,unsigned int *value)
+{
+    if (tok[0] >= '0' && tok[0] <= '9') {
+        *value = (unsigned int)strtoul(tok,0,0);
+        return 1;
+    }
+    return lookup_name(tok,len,value);
+}
+
+static void
+read_names(void)
+{
+    char *buf = read_file("src/lib/libdwarf/dwarf.h");
+    char *line = buf;
+
+    strip_comments(buf);
+    while (line && *line) {
+        char *next = strchr(line,'\n');
+
+        if (next) {
+            *next++ = 0;
+        }
+        if (!strncmp(line,"#define DW_",11)) {
+            char *name = line + 8;
+            size_t len = strcspn(name," \t");
+            char *val = name + len;
+            unsigned int value = 0;
+
+            val += strspn(val," \t");
+            if (*val &&
+                token_value(val,strcspn(val," \t"),&value)) {
+                add_name(name,len,value);
+            }
+        }
+        line = next;
+    }
+    free(buf);
+
+    /*  The DW_FORM_CLASS_ enum. */
+    buf = read_file("src/lib/libdwarf/libdwarf.h");
+    strip_comments(buf);
+    for (line = strstr(buf,"DW_FORM_CLASS_"); line;
+        line = strstr(line,"DW_FORM_CLASS_")) {
+        size_t len = strcspn(line," \t=,");
+        char *val = line + len;
+
+        val += strspn(val," \t");
+        if (*val == '=') {
+            ++val;
+            val += strspn(val," \t");
+            add_name(line,len,(unsigned int)strtoul(val,0,0));
+        }
+        line += len;
+    }
+    free(buf);
+}
+
+static int
+cmp_key(const void *l,const void *r)
+{
+    unsigned int a = *(const unsigned int *)l;
+    unsigned int b = *(const unsigned int *)r;
+
+    return a < b ? -1 : (a > b);
+}
+
+static void
+add_pair(struct pairs_s *p,unsigned int first,
+    unsigned int second)
+{
+    if (p->p_count >= MAX_PAIRS) {
+        printf("FAIL too many pairs\n");
+        exit(EXIT_FAILURE);
+    }
+    p->p_key[p->p_count++] = (first << 16) | second;
+}
+
+/*  After 0xffffffff comes the tag (or attribute) and then
+    what is legal with it, up to the next 0xffffffff. */
+static void
+read_list(const char *relpath,struct pairs_s *p)
+{
+    char *buf = read_file(relpath);
+    char *line = buf;
+    unsigned int first = 0;
+    int have_first = 0;
+    unsigned i = 0;
+    unsigned out = 0;
+
+    strip_comments(buf);
+    while (line && *line) {
+        char *next = strchr(line,'\n');
+        char *tok = line;
+        size_t len = 0;
+        unsigned int value = 0;
+
+        if (next) {
+            *next++ = 0;
+        }
+        tok += strspn(tok," \t\r");
+        len = strcspn(tok," \t\r");
+        line = next;
+        if (!len || tok[0] == '#') {
+            continue;
+        }
+        if (!token_value(tok,len,&value)) {
+            printf("FAIL %s: unknown name %.*s\n",relpath,
+                (int)len,tok);
+            ++errcount;
+            continue;
+        }
+        if (value == LIST_SEPARATOR) {
+            have_first = 0;
+        } else if (!have_first) {
+            first = value;
+            have_first = 1;
+        } else {
+            add_pair(p,first,value);
+        }
+    }
+    free(buf);
+    qsort(p->p_key,p->p_count,sizeof(p->p_key[0]),cmp_key);
+    for (i = 0; i < p->p_count; ++i) {
+        if (!out || p->p_key[out-1] != p->p_key[i]) {
+            p->p_key[out++] = p->p_key[i];
+        }
+    }
+    p->p_count = out;
+    if (p->p_count < 10) {
+        printf("FAIL %s: only %u pairs\n",relpath,p->p_count);
+        ++errcount;
+    }
+}
+
+static int
+in_pairs(struct pairs_s *p,unsigned int first,
+    unsigned int second)
+{
+    unsigned int key = (first << 16) | second;
+
+    return bsearch(&key,p->p_key,p->p_count,
+        sizeof(p->p_key[0]),cmp_key) != 0;
+}
+
+static void
+add_domain(unsigned int v)
+{
+    unsigned i = 0;
+
+    if (v > 0xffff) {
+        return;
+    }
+    for (i = 0; i < tag_domain_count; ++i) {
+        if (tag_domain[i] == v) {
+            return;
+        }
+    }
+    if (tag_domain_count >= MAX_DOMAIN) {
+        printf("FAIL tag domain too large\n");
+        exit(EXIT_FAILURE);
+    }
+    tag_domain[tag_domain_count++] = v;
+}
+
+/*  Every standard tag and a little beyond, every tag
+    named in a list and its neighbours, and the user
+    range limits. */
+static void
+build_tag_domain(void)
+{
+    struct pairs_s *lists[4];
+    unsigned l = 0;
+    unsigned i = 0;
+
+    lists[0] = &ta_std;
+    lists[1] = &ta_ext;
+    lists[2] = &tt_std;
+    lists[3] = &tt_ext;
+    for (i = 0; i <= DW_TAG_last + 2; ++i) {
+        add_domain(i);
+    }
+    for (l = 0; l < 4; ++l) {
+        for (i = 0; i < lists[l]->p_count; ++i) {
+            unsigned int t = lists[l]->p_key[i] >> 16;
+
+            add_domain(t);
+            add_domain(t+1);
+            if (t) {
+                add_domain(t-1);
+            }
+            if (l >= 2) {
+                t = lists[l]->p_key[i] & 0xffff;
+                add_domain(t);
+                add_domain(t+1);
+            }
+        }
+    }
+    add_domain(DW_TAG_lo_user);
+    add_domain(DW_TAG_hi_user);
+    add_domain(0x8000);
+}
+
+static void
+report(const char *what,unsigned int first,
+    unsigned int second,int expect,int got,
+    unsigned *reported)
+{
+    ++errcount;
+    if (*reported < 10) {
+        printf("FAIL %s 0x%x 0x%x expected %d got %d\n",
+            what,first,second,expect,got);
+    }
+    ++*reported;
+}
+
+static void
+compare_tag_attr(int use_ext)
+{
+    unsigned reported = 0;
+    unsigned i = 0;
+    unsigned int attr = 0;
+
+    for (i = 0; i < tag_domain_count; ++i) {
+        unsigned int tag = tag_domain[i];
+
+        for (attr = 0; attr < ALL_SECOND; ++attr) {
+            int expect = in_pairs(&ta_std,tag,attr) ||
+                (use_ext && in_pairs(&ta_ext,tag,attr));
+            int got = legal_tag_attr_combination(
+                (Dwarf_Half)tag,(Dwarf_Half)attr) ? 1 : 0;
+
+            if (got != expect) {
+                report("tag attr",tag,attr,expect,got,&reported);
+            }
+        }
+    }
+}
+
+static void
+compare_tag_tree(int use_ext)
+{
+    unsigned reported = 0;
+    unsigned i = 0;
+    unsigned int child = 0;
+
+    for (i = 0; i < tag_domain_count; ++i) {
+        unsigned int parent = tag_domain[i];
+
+        for (child = 0; child < ALL_SECOND; ++child) {
+            int expect = in_pairs(&tt_std,parent,child) ||
+                (use_ext && in_pairs(&tt_ext,parent,child));
+            int got = legal_tag_tree_combination(
+                (Dwarf_Half)parent,(Dwarf_Half)child) ? 1 : 0;
+
+            if (got != expect) {
+                report("tag tree",parent,child,expect,got,
+                    &reported);
+            }
+        }
+    }
+}
+
+static void
+compare_attr_formclass(int use_ext)
+{
+    unsigned reported = 0;
+    unsigned int attr = 0;
+    unsigned int fc = 0;
+
+    for (attr = 0; attr < ALL_SECOND; ++attr) {
+        for (fc = 0; fc < BITS_PER_WORD + 2; ++fc) {
+            int expect = in_pairs(&af_std,attr,fc) ||
+                (use_ext && in_pairs(&af_ext,attr,fc));
+            int got = legal_attr_formclass_combination(
+                (Dwarf_Half)attr,(Dwarf_Half)fc) ? 1 : 0;
+
+            if (got != expect) {
+                report("attr formclass",attr,fc,expect,got,
+                    &reported);
+            }
+        }
+    }
+}
+
+/*  The usage report lists, per tag, the legal attributes
+    and children and counts them. */
+static void
+compare_usage_tables(void)
+{
+    unsigned int tag = 0;
+
+    for (tag = 1; tag < DW_TAG_last; ++tag) {
+        Usage_Tag_Attr *ua = usage_tag_attr[tag];
+        Usage_Tag_Tree *ut = usage_tag_tree[tag];
+        unsigned listed = 0;
+        unsigned expect = 0;
+        unsigned i = 0;
+
+        for (i = 0; i < ta_std.p_count; ++i) {
+            expect += (ta_std.p_key[i] >> 16) == tag;
+        }
+        for ( ; ua && ua->attr; ++ua) {
+            if (!in_pairs(&ta_std,tag,ua->attr)) {
+                printf("FAIL usage tag 0x%x lists attr 0x%x\n",
+                    tag,ua->attr);
+                ++errcount;
+            }
+            ++listed;
+        }
+        check_unsigned("usage_tag_attr entries",expect,listed,
+            __LINE__);
+        check_unsigned("rate_tag_attr legal",expect,
+            rate_tag_attr[tag].legal,__LINE__);
+
+        expect = 0;
+        listed = 0;
+        for (i = 0; i < tt_std.p_count; ++i) {
+            expect += (tt_std.p_key[i] >> 16) == tag;
+        }
+        for ( ; ut && ut->tag; ++ut) {
+            if (!in_pairs(&tt_std,tag,ut->tag)) {
+                printf("FAIL usage tag 0x%x lists child 0x%x\n",
+                    tag,ut->tag);
+                ++errcount;
+            }
+            ++listed;
+        }
+        check_unsigned("usage_tag_tree entries",expect,listed,
+            __LINE__);
+        check_unsigned("rate_tag_tree legal",expect,
+            rate_tag_tree[tag].legal,__LINE__);
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    int use_ext = 0;
+
+    testobj_srcdir(argc,argv);
+    read_names();
+    read_list("src/bin/tag_attr/tag_attr.list",&ta_std);
+    read_list("src/bin/tag_attr/tag_attr_ext.list",&ta_ext);
+    read_list("src/bin/tag_tree/tag_tree.list",&tt_std);
+    read_list("src/bin/tag_tree/tag_tree_ext.list",&tt_ext);
+    read_list("src/bin/attr_form/attr_formclass.list",&af_std);
+    read_list("src/bin/attr_form/attr_formclass_ext.list",
+        &af_ext);
+    build_tag_domain();
+    for (use_ext = 0; use_ext <= 1; ++use_ext) {
+        glflags.gf_suppress_check_extensions_tables = !use_ext;
+        compare_tag_attr(use_ext);
+        compare_tag_tree(use_ext);
+        compare_attr_formclass(use_ext);
+    }
+    compare_usage_tables();
+    testobj_exit("test_legal_tables");
+    return 0;
+}
@@ -0,0 +1,198 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Tests dwarf_addr_ranges_for_source_line().
+    testnamesLE64ELf5.testme (see testnamesLE64ELfsource.cc)
+    has one CU with rows for line 56 at three places,
+    some with is_stmt and some without.
+    testlineindexLE64ELf5.testme (see
+    testlineindexLE64ELfsource.c) has two CUs naming
+    the same file differently, one through "sub/..",
+    with code for line 50 in each.
+
+    ./test_line_index -f <top source directory>
+    or set environment variable DWTOPSRCDIR. */
+
+#include <config.h>
+
+#include <stdio.h>  /* printf() */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "testobj_util.h"
+
+#define TRUE 1
+#define FALSE 0
+
+#define RANGES_MAX 8
+
+struct expect_s {
+    int        e_count;
+    Dwarf_Addr e_low[RANGES_MAX];
+    Dwarf_Addr e_high[RANGES_MAX];
+};
+
+/*  Looks up file:line and compares the ranges
+    with ex, or expects DW_DLV_NO_ENTRY if ex is 0. */
+static void
+check_lookup(Dwarf_Debug dbg,const char *file,
+    Dwarf_Unsigned line,Dwarf_Bool stmt_only,
+    const struct expect_s *ex,int srcline)
+{
+    Dwarf_Ranges *ranges = 0;
+    Dwarf_Signed count = 0;
+    Dwarf_Signed i = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_addr_ranges_for_source_line(dbg,file,line,
+        stmt_only,&ranges,&count,&err);
+    if (!ex) {
+        check_int(file,DW_DLV_NO_ENTRY,res,srcline);
+        if (res == DW_DLV_OK) {
+            dwarf_dealloc_ranges(dbg,ranges,count);
+        }
+        return;
+    }
+    check_int(file,DW_DLV_OK,res,srcline);
+    if (res != DW_DLV_OK) {
+        if (res == DW_DLV_ERROR) {
+            printf("    %s\n",dwarf_errmsg(err));
+            dwarf_dealloc_error(dbg,err);
+        }
+        return;
+    }
+    check_int("range count",ex->e_count,(int)count,srcline);
+    for (i = 0; i < count && i < ex->e_count; ++i) {
+        check_int("range type",DW_RANGES_ENTRY,
+            ranges[i].dwr_type,srcline);
+        check_unsigned("range low",ex->e_low[i],
+            ranges[i].dwr_addr1,srcline);
+        check_unsigned("range high",ex->e_high[i],
+            ranges[i].dwr_addr2,srcline);
+    }
+    dwarf_dealloc_ranges(dbg,ranges,count);
+}
+
+/*  Line 56 of testnamesLE64ELfsource.cc.  The rows at
+    0x0 and 0x20 follow is_stmt rows at the same
+    address and count as statements, the one at 0x10
+    does not. */
+static const struct expect_s names_56 = {
+    3,
+    { 0x0, 0x10, 0x20 },
+    { 0x8, 0x18, 0x29 }
+};
+static const struct expect_s names_56_stmt = {
+    2,
+    { 0x0, 0x20 },
+    { 0x8, 0x29 }
+};
+
+static void
+test_names(void)
+{
+    Dwarf_Debug dbg = open_obj("testnamesLE64ELf5.testme");
+    const char *n = "testnamesLE64ELfsource.cc";
+
+    check_lookup(dbg,n,56,FALSE,&names_56,__LINE__);
+    /*  The index is built now; the same answers again. */
+    check_lookup(dbg,n,56,FALSE,&names_56,__LINE__);
+    check_lookup(dbg,"./testnamesLE64ELfsource.cc",56,FALSE,
+        &names_56,__LINE__);
+    check_lookup(dbg,".//testnamesLE64ELfsource.cc",56,FALSE,
+        &names_56,__LINE__);
+    check_lookup(dbg,"dir/../testnamesLE64ELfsource.cc",56,
+        FALSE,&names_56,__LINE__);
+    check_lookup(dbg,n,56,TRUE,&names_56_stmt,__LINE__);
+    /*  Only whole path components match. */
+    check_lookup(dbg,"source.cc",56,FALSE,0,__LINE__);
+    check_lookup(dbg,"LE64ELfsource.cc",56,FALSE,0,__LINE__);
+    check_lookup(dbg,"testnamesLE64ELfsource.c",56,FALSE,0,
+        __LINE__);
+    check_lookup(dbg,"dir/testnamesLE64ELfsource.cc",56,FALSE,0,
+        __LINE__);
+    /*  No code for this line. */
+    check_lookup(dbg,n,58,FALSE,0,__LINE__);
+    check_lookup(dbg,n,0,FALSE,0,__LINE__);
+    dwarf_finish(dbg);
+}
+
+/*  Line 50, in common_scale(), has code in both CUs,
+    and line 57 only in the first. */
+static const struct expect_s index_50 = {
+    4,
+    { 0x1024, 0x1030, 0x1064, 0x1070 },
+    { 0x102c, 0x1033, 0x106c, 0x1073 }
+};
+static const struct expect_s index_57 = {
+    2,
+    { 0x1044, 0x104d },
+    { 0x1049, 0x1050 }
+};
+
+static void
+test_two_cus(void)
+{
+    Dwarf_Debug dbg = open_obj("testlineindexLE64ELf5.testme");
+    const char *n = "testlineindexLE64ELfsource.c";
+
+    check_lookup(dbg,n,50,FALSE,&index_50,__LINE__);
+    /*  An absolute name must match exactly;
+        both CUs' names reduce to it. */
+    check_lookup(dbg,"/tmp/lineindex/testlineindexLE64ELfsource.c",
+        50,FALSE,&index_50,__LINE__);
+    check_lookup(dbg,
+        "/tmp/lineindex/sub/../testlineindexLE64ELfsource.c",
+        50,FALSE,&index_50,__LINE__);
+    check_lookup(dbg,"/lineindex/testlineindexLE64ELfsource.c",
+        50,FALSE,0,__LINE__);
+    check_lookup(dbg,"sub/testlineindexLE64ELfsource.c",
+        50,FALSE,0,__LINE__);
+    check_lookup(dbg,"lineindex/testlineindexLE64ELfsource.c",
+        57,FALSE,&index_57,__LINE__);
+    /*  The only is_stmt rows for these lines are
+        empty, no address has them. */
+    check_lookup(dbg,n,50,TRUE,0,__LINE__);
+    check_lookup(dbg,n,57,TRUE,0,__LINE__);
+    dwarf_finish(dbg);
+}
+
+int
+main(int argc, char **argv)
+{
+    testobj_srcdir(argc,argv);
+    test_names();
+    test_two_cus();
+    testobj_exit("test_line_index");
+    return 0;
+}
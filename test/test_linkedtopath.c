@@ -60,6 +60,26 @@ int _dwarf_load_section(Dwarf_Debug dbg,
     return DW_DLV_OK;
 }
 
+/*  dummy func, dwarf_get_sup_paths() is not
+    tested here */
+int dwarf_get_debug_sup(Dwarf_Debug dbg,
+    Dwarf_Half     * version,
+    Dwarf_Small    * is_supplementary,
+    char          ** filename,
+    Dwarf_Unsigned * checksum_len,
+    Dwarf_Small   ** checksum,
+    Dwarf_Error    * error)
+{
+    (void)dbg;
+    (void)version;
+    (void)is_supplementary;
+    (void)filename;
+    (void)checksum_len;
+    (void)checksum;
+    (void)error;
+    return DW_DLV_NO_ENTRY;
+}
+
 /* A horrible fake version for these tests */
 void
 _dwarf_error(Dwarf_Debug dbg,
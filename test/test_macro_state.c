@@ -0,0 +1,314 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Tests dwarf_macro_state(), dwarf_macro_state_position(),
+    dwarf_macro_state_lookup() and dwarf_macro_state_defines()
+    on testmacroLE64ELf5.testme (.debug_macro, with imports)
+    and testmacroLE64ELf4.testme (.debug_macinfo), see
+    testmacroLE64ELfsource.c.  Macros are defined, redefined
+    and undefined before and after the includes of
+    limits.h and stdint.h, which take the operation count
+    past the first saved state, so lookups there replay
+    from it.
+
+    ./test_macro_state -f <top source directory>
+    or set environment variable DWTOPSRCDIR. */
+
+#include <config.h>
+
+#include <stdio.h>  /* printf() */
+#include <string.h> /* strcmp() */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "testobj_util.h"
+
+#define TRUE 1
+#define FALSE 0
+
+#define SOURCE "testmacroLE64ELfsource.c"
+
+/*  The saved state interval of dwarf_macro_state.c. */
+#define STATE_INTERVAL 512
+
+/*  What SHAPE_SIDES, SHAPE_NAME and SHAPE_AREA are,
+    0 if undefined, at a line of SOURCE, with the line
+    of each define.  A define on the line itself is
+    not yet in effect. */
+struct point_s {
+    Dwarf_Unsigned p_line;
+    int            p_after_includes;
+    const char    *p_sides;
+    Dwarf_Unsigned p_sides_line;
+    const char    *p_name;
+    Dwarf_Unsigned p_name_line;
+    const char    *p_area;
+};
+
+#define AREA "SHAPE_AREA(b,h) ((b)*(h)/2)"
+
+static const struct point_s points[] = {
+    { 1,   FALSE, 0, 0, 0, 0, 0 },
+    { 49,  FALSE, 0, 0, 0, 0, 0 },
+    { 50,  FALSE, "SHAPE_SIDES 3", 49, 0, 0, 0 },
+    { 52,  FALSE, "SHAPE_SIDES 3", 49,
+        "SHAPE_NAME \"triangle\"", 50, AREA },
+    { 55,  TRUE,  "SHAPE_SIDES 3", 49,
+        "SHAPE_NAME \"triangle\"", 50, AREA },
+    /*  After the undef. */
+    { 57,  TRUE,  0, 0, "SHAPE_NAME \"triangle\"", 50, AREA },
+    /*  After the redefines. */
+    { 58,  TRUE,  "SHAPE_SIDES 4", 57,
+        "SHAPE_NAME \"triangle\"", 50, AREA },
+    { 60,  TRUE,  "SHAPE_SIDES 4", 57,
+        "SHAPE_NAME \"square\"", 59, AREA },
+    { 67,  TRUE,  "SHAPE_SIDES 4", 57,
+        "SHAPE_NAME \"square\"", 59, AREA },
+    { 68,  TRUE,  "SHAPE_SIDES 4", 57,
+        "SHAPE_NAME \"square\"", 59, 0 },
+    { 69,  TRUE,  0, 0, "SHAPE_NAME \"square\"", 59, 0 },
+    { 70,  TRUE,  "SHAPE_SIDES 5", 69,
+        "SHAPE_NAME \"square\"", 59, 0 },
+    { 500, TRUE,  "SHAPE_SIDES 5", 69,
+        "SHAPE_NAME \"square\"", 59, 0 },
+    { 0, 0, 0, 0, 0, 0, 0 }
+};
+
+static void
+check_macro(Dwarf_Macro_State ms,Dwarf_Unsigned pos,
+    const char *name,const char *expect,
+    Dwarf_Unsigned expect_line,int srcline)
+{
+    const char *def = 0;
+    Dwarf_Unsigned line = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_macro_state_lookup(ms,pos,name,&def,&line,&err);
+    if (!expect) {
+        check_int(name,DW_DLV_NO_ENTRY,res,srcline);
+        return;
+    }
+    check_int(name,DW_DLV_OK,res,srcline);
+    if (res != DW_DLV_OK) {
+        return;
+    }
+    check_string(name,expect,def,srcline);
+    if (expect_line) {
+        check_unsigned("define line",expect_line,line,srcline);
+    }
+}
+
+/*  The defines at pos must be in name order and,
+    if lookup, each must be found by name. */
+static void
+check_defines(Dwarf_Macro_State ms,Dwarf_Unsigned pos,
+    int lookup,Dwarf_Unsigned *count_out)
+{
+    static const char *defs[1000];
+    Dwarf_Unsigned count = 0;
+    Dwarf_Unsigned i = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    *count_out = 0;
+    res = dwarf_macro_state_defines(ms,pos,1000,defs,&count,&err);
+    if (res == DW_DLV_NO_ENTRY) {
+        return;
+    }
+    check_int("dwarf_macro_state_defines",DW_DLV_OK,res,
+        __LINE__);
+    if (res != DW_DLV_OK) {
+        return;
+    }
+    *count_out = count;
+    check_int("defines fit",TRUE,count <= 1000,__LINE__);
+    for (i = 0; i < count && i < 1000; ++i) {
+        const char *def = 0;
+
+        if (i && strcmp(defs[i-1],defs[i]) >= 0) {
+            printf("FAIL position %llu: %s after %s\n",
+                (unsigned long long)pos,defs[i],defs[i-1]);
+            ++errcount;
+        }
+        if (!lookup) {
+            continue;
+        }
+        res = dwarf_macro_state_lookup(ms,pos,defs[i],&def,0,
+            &err);
+        check_int(defs[i],DW_DLV_OK,res,__LINE__);
+        if (res == DW_DLV_OK) {
+            check_string("lookup of a define",defs[i],def,
+                __LINE__);
+        }
+    }
+}
+
+static void
+test_object(const char *objname)
+{
+    Dwarf_Debug dbg = open_obj(objname);
+    Dwarf_Die cu_die = 0;
+    Dwarf_Macro_State ms = 0;
+    Dwarf_Macro_State ms2 = 0;
+    Dwarf_Unsigned op_count = 0;
+    Dwarf_Unsigned pos = 0;
+    Dwarf_Unsigned prev_count = 0;
+    Dwarf_Unsigned count = 0;
+    const struct point_s *pt = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    printf("Object %s\n",objname);
+    res = dwarf_next_cu_header_e(dbg,TRUE,&cu_die,0,0,0,0,0,0,
+        0,0,0,0,&err);
+    check_int("dwarf_next_cu_header_e",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        dwarf_finish(dbg);
+        return;
+    }
+    res = dwarf_macro_state(cu_die,&ms,&op_count,&err);
+    check_int("dwarf_macro_state",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        dwarf_dealloc_die(cu_die);
+        dwarf_finish(dbg);
+        return;
+    }
+    /*  Built once: the same state again. */
+    res = dwarf_macro_state(cu_die,&ms2,0,&err);
+    check_int("dwarf_macro_state again",DW_DLV_OK,res,__LINE__);
+    check_int("same state",TRUE,ms == ms2,__LINE__);
+    dwarf_dealloc_die(cu_die);
+    check_int("more than one saved state",TRUE,
+        op_count > STATE_INTERVAL,__LINE__);
+
+    for (pt = points; pt->p_line; ++pt) {
+        res = dwarf_macro_state_position(ms,SOURCE,pt->p_line,
+            &pos,&err);
+        check_int("dwarf_macro_state_position",DW_DLV_OK,res,
+            __LINE__);
+        if (res != DW_DLV_OK) {
+            continue;
+        }
+        check_int("past the first saved state",
+            pt->p_after_includes,pos > STATE_INTERVAL,__LINE__);
+        check_macro(ms,pos,"SHAPE_SIDES",pt->p_sides,
+            pt->p_sides_line,__LINE__);
+        check_macro(ms,pos,"SHAPE_NAME",pt->p_name,
+            pt->p_name_line,__LINE__);
+        check_macro(ms,pos,"SHAPE_AREA",pt->p_area,0,__LINE__);
+        /*  The parameter list is ignored. */
+        check_macro(ms,pos,"SHAPE_AREA(x,y)",pt->p_area,0,
+            __LINE__);
+        /*  The predefined macros come before the source. */
+        check_macro(ms,pos,"__STDC__","__STDC__ 1",0,__LINE__);
+        if (pt->p_after_includes) {
+            check_macro(ms,pos,"INT8_MAX","INT8_MAX (127)",0,
+                __LINE__);
+        } else {
+            check_macro(ms,pos,"INT8_MAX",0,0,__LINE__);
+        }
+    }
+
+    /*  Through every position, across the saved
+        states, each operation changes the number of
+        defines by at most one. Looking up every define
+        everywhere would be slow, so that is done
+        around the saved states and now and then. */
+    for (pos = 0; pos <= op_count; ++pos) {
+        Dwarf_Unsigned m = pos % STATE_INTERVAL;
+
+        check_defines(ms,pos,m < 2 || m > STATE_INTERVAL - 2 ||
+            !(pos % 61),&count);
+        if (pos && (count > prev_count + 1 ||
+            prev_count > count + 1)) {
+            printf("FAIL position %llu has %llu defines, "
+                "the one before %llu\n",(unsigned long long)pos,
+                (unsigned long long)count,
+                (unsigned long long)prev_count);
+            ++errcount;
+        }
+        prev_count = count;
+    }
+    check_macro(ms,0,"__STDC__",0,0,__LINE__);
+
+    /*  NULL is the end of the unit. */
+    res = dwarf_macro_state_position(ms,0,0,&pos,&err);
+    check_int("end position",DW_DLV_OK,res,__LINE__);
+    check_unsigned("end position",op_count,pos,__LINE__);
+    check_macro(ms,pos,"SHAPE_SIDES","SHAPE_SIDES 5",69,__LINE__);
+
+    /*  Trailing path components name a file. */
+    res = dwarf_macro_state_position(ms,"limits.h",1,&pos,&err);
+    check_int("limits.h",DW_DLV_OK,res,__LINE__);
+    check_macro(ms,pos,"SHAPE_SIDES","SHAPE_SIDES 3",49,__LINE__);
+    check_macro(ms,pos,"INT8_MAX",0,0,__LINE__);
+    res = dwarf_macro_state_position(ms,"nosuchfile.h",1,&pos,
+        &err);
+    check_int("nosuchfile.h",DW_DLV_NO_ENTRY,res,__LINE__);
+    res = dwarf_macro_state_position(ms,"macroLE64ELfsource.c",1,
+        &pos,&err);
+    check_int("part of a name",DW_DLV_NO_ENTRY,res,__LINE__);
+    dwarf_finish(dbg);
+}
+
+/*  A unit without macro information. */
+static void
+test_no_macros(void)
+{
+    Dwarf_Debug dbg = open_obj("testrangesLE64ELf5.testme");
+    Dwarf_Die cu_die = 0;
+    Dwarf_Macro_State ms = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_next_cu_header_e(dbg,TRUE,&cu_die,0,0,0,0,0,0,
+        0,0,0,0,&err);
+    check_int("dwarf_next_cu_header_e",DW_DLV_OK,res,__LINE__);
+    if (res == DW_DLV_OK) {
+        res = dwarf_macro_state(cu_die,&ms,0,&err);
+        check_int("no macros",DW_DLV_NO_ENTRY,res,__LINE__);
+        dwarf_dealloc_die(cu_die);
+    }
+    dwarf_finish(dbg);
+}
+
+int
+main(int argc, char **argv)
+{
+    testobj_srcdir(argc,argv);
+    test_object("testmacroLE64ELf4.testme");
+    test_object("testmacroLE64ELf5.testme");
+    test_no_macros();
+    testobj_exit("test_macro_state");
+    return 0;
+}
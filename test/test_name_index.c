@@ -0,0 +1,322 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Tests dwarf_name_index(), dwarf_name_index_lookup()
+    and dwarf_name_index_entry().
+    testnamesLE64ELf4.testme and testnamesLE64ELf5.testme
+    (see testnamesLE64ELfsource.cc) have a class with a
+    nested enumeration inside two nested namespaces, so
+    the parent of each entry is checked, as are the
+    names that must not be indexed (members, enumerators,
+    parameters, declarations).
+    In testaccelLE64ELf5a.testme (see
+    testaccelLE64ELfsource3.c) accel_Mode and accel_mode
+    have the same hash, so are ordered by name.
+
+    ./test_name_index -f <top source directory>
+    or set environment variable DWTOPSRCDIR. */
+
+#include <config.h>
+
+#include <stdio.h>  /* printf() */
+#include <string.h> /* strcmp() */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "testobj_util.h"
+
+#define TRUE 1
+#define FALSE 0
+
+/*  n_parent is the name of the enclosing scope,
+    0 for a child of the unit DIE. */
+struct name_s {
+    const char *n_name;
+    Dwarf_Half  n_tag;
+    unsigned    n_count;
+    const char *n_parent;
+};
+
+static const struct name_s names[] = {
+    { "outer",        DW_TAG_namespace,        1, 0 },
+    { "inner",        DW_TAG_namespace,        1, "outer" },
+    { "Widget",       DW_TAG_class_type,       1, "inner" },
+    { "Mode",         DW_TAG_enumeration_type, 1, "Widget" },
+    /*  The definitions are children of the unit DIE,
+        and get() and use() also have a concrete
+        out-of-line instance. */
+    { "count",        DW_TAG_variable,         1, 0 },
+    { "_ZN5outer5inner6Widget5countE",
+                      DW_TAG_variable,         1, 0 },
+    { "get",          DW_TAG_subprogram,       2, 0 },
+    { "_ZNK5outer5inner6Widget3getEv",
+                      DW_TAG_subprogram,       2, 0 },
+    { "use",          DW_TAG_subprogram,       2, 0 },
+    { "_ZN5outer3useEPNS_5inner6WidgetE",
+                      DW_TAG_subprogram,       2, 0 },
+    { "twice",        DW_TAG_subprogram,       1, 0 },
+    { "hidden",       DW_TAG_variable,         1, 0 },
+    { "file_scope",   DW_TAG_subprogram,       1, 0 },
+    { "_Z10file_scopei",
+                      DW_TAG_subprogram,       1, 0 },
+    { "int",          DW_TAG_base_type,        1, 0 },
+    { 0, 0, 0, 0 }
+};
+#define NAME_ENTRIES 19
+
+/*  Members, enumerators, parameters and a name
+    with the wrong case. */
+static const char *not_indexed[] = {
+    "value", "mode", "Off", "On", "this", "w", "x", "v",
+    "widget", "", 0
+};
+
+/*  The hash of .debug_names, DWARF5 section 6.1.1.4.5,
+    with ASCII case folding. */
+static Dwarf_Unsigned
+dnames_hash(const char *name)
+{
+    const unsigned char *cp = (const unsigned char *)name;
+    Dwarf_Unsigned h = 5381;
+
+    for ( ; *cp; ++cp) {
+        unsigned c = *cp;
+
+        if (c >= 'A' && c <= 'Z') {
+            c += 'a' - 'A';
+        }
+        h = (h * 33 + c) & 0xffffffff;
+    }
+    return h;
+}
+
+/*  Checks the entries are ordered by hash and then by
+    name, that each hash is right and that each
+    parent and unit offset names a suitable DIE. */
+static void
+check_order(Dwarf_Debug dbg,Dwarf_Name_Index nx,
+    Dwarf_Unsigned count)
+{
+    Dwarf_Unsigned prev_hash = 0;
+    const char *prev_name = 0;
+    Dwarf_Unsigned i = 0;
+
+    for (i = 0; i < count; ++i) {
+        const char *name = 0;
+        Dwarf_Unsigned hash = 0;
+        Dwarf_Off parent = 0;
+        Dwarf_Off cu_offset = 0;
+        Dwarf_Bool is_info = FALSE;
+        Dwarf_Die die = 0;
+        Dwarf_Half tag = 0;
+        Dwarf_Error err = 0;
+        int res = 0;
+
+        res = dwarf_name_index_entry(nx,i,&name,&hash,0,0,
+            &is_info,&parent,&cu_offset,&err);
+        check_int("dwarf_name_index_entry",DW_DLV_OK,res,
+            __LINE__);
+        if (res != DW_DLV_OK) {
+            continue;
+        }
+        check_unsigned(name,dnames_hash(name),hash,__LINE__);
+        if (prev_name && (hash < prev_hash ||
+            (hash == prev_hash && strcmp(prev_name,name) > 0))) {
+            printf("FAIL entry %llu %s (0x%llx) after %s "
+                "(0x%llx)\n",(unsigned long long)i,name,
+                (unsigned long long)hash,prev_name,
+                (unsigned long long)prev_hash);
+            ++errcount;
+        }
+        prev_hash = hash;
+        prev_name = name;
+
+        res = dwarf_offdie_b(dbg,cu_offset,is_info,&die,&err);
+        check_int("unit DIE",DW_DLV_OK,res,__LINE__);
+        if (res == DW_DLV_OK) {
+            dwarf_tag(die,&tag,&err);
+            check_unsigned("unit DIE tag",DW_TAG_compile_unit,
+                tag,__LINE__);
+            dwarf_dealloc_die(die);
+        }
+    }
+}
+
+/*  Looks up each name of expect, checking the count,
+    tag and parent of its entries. */
+static void
+check_names(Dwarf_Debug dbg,Dwarf_Name_Index nx,
+    const struct name_s *expect)
+{
+    for ( ; expect->n_name; ++expect) {
+        Dwarf_Unsigned first = 0;
+        Dwarf_Unsigned count = 0;
+        Dwarf_Unsigned i = 0;
+        Dwarf_Error err = 0;
+        int res = 0;
+
+        res = dwarf_name_index_lookup(nx,expect->n_name,&first,
+            &count,&err);
+        check_int(expect->n_name,DW_DLV_OK,res,__LINE__);
+        if (res != DW_DLV_OK) {
+            continue;
+        }
+        check_unsigned(expect->n_name,expect->n_count,count,
+            __LINE__);
+        for (i = first; i < first + count; ++i) {
+            const char *name = 0;
+            Dwarf_Half tag = 0;
+            Dwarf_Off parent = 0;
+            Dwarf_Die die = 0;
+            char *pname = 0;
+
+            res = dwarf_name_index_entry(nx,i,&name,0,&tag,0,0,
+                &parent,0,&err);
+            check_int("dwarf_name_index_entry",DW_DLV_OK,res,
+                __LINE__);
+            if (res != DW_DLV_OK) {
+                continue;
+            }
+            check_string("entry name",expect->n_name,name,
+                __LINE__);
+            check_unsigned(expect->n_name,expect->n_tag,tag,
+                __LINE__);
+            if (!expect->n_parent) {
+                check_unsigned("no parent",0,parent,__LINE__);
+                continue;
+            }
+            res = dwarf_offdie_b(dbg,parent,TRUE,&die,&err);
+            check_int("parent DIE",DW_DLV_OK,res,__LINE__);
+            if (res != DW_DLV_OK) {
+                continue;
+            }
+            res = dwarf_diename(die,&pname,&err);
+            check_int("parent name",DW_DLV_OK,res,__LINE__);
+            if (res == DW_DLV_OK) {
+                check_string("parent name",expect->n_parent,pname,
+                    __LINE__);
+            }
+            dwarf_dealloc_die(die);
+        }
+    }
+}
+
+static void
+test_names(const char *objname)
+{
+    Dwarf_Debug dbg = open_obj(objname);
+    Dwarf_Name_Index nx = 0;
+    Dwarf_Name_Index nx2 = 0;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Unsigned first = 0;
+    Dwarf_Unsigned n = 0;
+    Dwarf_Error err = 0;
+    const char **np = 0;
+    int res = 0;
+
+    printf("Object %s\n",objname);
+    res = dwarf_name_index(dbg,&nx,&count,&err);
+    check_int("dwarf_name_index",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        dwarf_finish(dbg);
+        return;
+    }
+    check_unsigned("entry count",NAME_ENTRIES,count,__LINE__);
+    /*  Built once: the same index again. */
+    res = dwarf_name_index(dbg,&nx2,0,&err);
+    check_int("dwarf_name_index again",DW_DLV_OK,res,__LINE__);
+    check_int("same index",TRUE,nx == nx2,__LINE__);
+    check_order(dbg,nx,count);
+    check_names(dbg,nx,names);
+    for (np = not_indexed; *np; ++np) {
+        res = dwarf_name_index_lookup(nx,*np,&first,&n,&err);
+        check_int(*np,DW_DLV_NO_ENTRY,res,__LINE__);
+    }
+    res = dwarf_name_index_entry(nx,count,0,0,0,0,0,0,0,&err);
+    check_int("entry past the end",DW_DLV_NO_ENTRY,res,__LINE__);
+    dwarf_finish(dbg);
+}
+
+/*  Two names with one hash. */
+static void
+test_same_hash(void)
+{
+    Dwarf_Debug dbg = open_obj("testaccelLE64ELf5a.testme");
+    Dwarf_Name_Index nx = 0;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Unsigned upper = 0;
+    Dwarf_Unsigned lower = 0;
+    Dwarf_Unsigned n = 0;
+    Dwarf_Unsigned hash_upper = 0;
+    Dwarf_Unsigned hash_lower = 0;
+    const char *name = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    printf("Object testaccelLE64ELf5a.testme\n");
+    res = dwarf_name_index(dbg,&nx,&count,&err);
+    check_int("dwarf_name_index",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        dwarf_finish(dbg);
+        return;
+    }
+    check_order(dbg,nx,count);
+    res = dwarf_name_index_lookup(nx,"accel_Mode",&upper,&n,&err);
+    check_int("accel_Mode",DW_DLV_OK,res,__LINE__);
+    check_unsigned("accel_Mode count",1,n,__LINE__);
+    res = dwarf_name_index_lookup(nx,"accel_mode",&lower,&n,&err);
+    check_int("accel_mode",DW_DLV_OK,res,__LINE__);
+    check_unsigned("accel_mode count",1,n,__LINE__);
+    check_unsigned("accel_mode follows accel_Mode",upper + 1,
+        lower,__LINE__);
+    dwarf_name_index_entry(nx,upper,&name,&hash_upper,0,0,0,0,0,
+        &err);
+    check_string("first of the hash","accel_Mode",name,__LINE__);
+    dwarf_name_index_entry(nx,lower,&name,&hash_lower,0,0,0,0,0,
+        &err);
+    check_string("second of the hash","accel_mode",name,__LINE__);
+    check_unsigned("same hash",hash_upper,hash_lower,__LINE__);
+    res = dwarf_name_index_lookup(nx,"ACCEL_MODE",&upper,&n,&err);
+    check_int("ACCEL_MODE",DW_DLV_NO_ENTRY,res,__LINE__);
+    dwarf_finish(dbg);
+}
+
+int
+main(int argc, char **argv)
+{
+    testobj_srcdir(argc,argv);
+    test_names("testnamesLE64ELf4.testme");
+    test_names("testnamesLE64ELf5.testme");
+    test_same_hash();
+    testobj_exit("test_name_index");
+    return 0;
+}
@@ -0,0 +1,272 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Tests dwarf_prefetch_sections() on Elf (executable
+    and relocatable), PE and Mach-O test objects.
+    Only the return values can be seen: the hint
+    must load nothing into libdwarf, and section
+    bytes and line rows must be the same as
+    without it.
+
+    ./test_prefetch -f <top source directory>
+    or set environment variable DWTOPSRCDIR. */
+
+#include <config.h>
+
+#include <stdio.h>  /* printf() */
+#include <string.h> /* memcmp() */
+
+#ifdef HAVE_FCNTL_H
+#include <fcntl.h> /* POSIX_FADV_WILLNEED */
+#endif /* HAVE_FCNTL_H */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "testobj_util.h"
+
+/*  What a prefetch of sections present and not
+    loaded returns, as in dwarf_init_finish.c. */
+#if defined(POSIX_FADV_WILLNEED) && !defined(_WIN32)
+#define HINT_RES DW_DLV_OK
+#else
+#define HINT_RES DW_DLV_NO_ENTRY
+#endif
+
+static const char *objects[] = {
+"dummyexecutable.debug",
+"testnamesLE64ELf5.testme",
+"testobjLE32PE.exe",
+"test-mach-o-32.dSYM",
+0
+};
+
+static const char *line_sections[] = {
+".debug_line",
+".debug_line_str",
+".debug_str",
+};
+
+static const char *compare_sections[] = {
+".debug_info",
+".debug_abbrev",
+".debug_line",
+".debug_str",
+0
+};
+
+static int
+prefetch(Dwarf_Debug dbg,const char **names,unsigned count)
+{
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_prefetch_sections(dbg,names,count,&err);
+    if (res == DW_DLV_ERROR) {
+        printf("FAIL dwarf_prefetch_sections: %s\n",
+            dwarf_errmsg(err));
+        dwarf_dealloc_error(dbg,err);
+    }
+    return res;
+}
+
+/*  Adds up the line rows of every CU, and their
+    addresses and line numbers. */
+static void
+sum_lines(Dwarf_Debug dbg,Dwarf_Unsigned *rows,
+    Dwarf_Unsigned *sum)
+{
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    *rows = 0;
+    *sum = 0;
+    for (;;) {
+        Dwarf_Die cu_die = 0;
+        Dwarf_Unsigned version = 0;
+        Dwarf_Small table_count = 0;
+        Dwarf_Line_Context context = 0;
+        Dwarf_Line *lines = 0;
+        Dwarf_Signed count = 0;
+        Dwarf_Signed i = 0;
+
+        res = dwarf_next_cu_header_e(dbg,1,&cu_die,
+            0,0,0,0,0,0,0,0,0,0,&err);
+        if (res != DW_DLV_OK) {
+            check_int("dwarf_next_cu_header_e",DW_DLV_NO_ENTRY,
+                res,__LINE__);
+            break;
+        }
+        res = dwarf_srclines_b(cu_die,&version,&table_count,
+            &context,&err);
+        check_int("dwarf_srclines_b",1,res != DW_DLV_ERROR,
+            __LINE__);
+        if (res == DW_DLV_OK) {
+            res = dwarf_srclines_from_linecontext(context,
+                &lines,&count,&err);
+            check_int("dwarf_srclines_from_linecontext",
+                DW_DLV_OK,res,__LINE__);
+            for (i = 0; res == DW_DLV_OK && i < count; ++i) {
+                Dwarf_Addr addr = 0;
+                Dwarf_Unsigned lineno = 0;
+
+                dwarf_lineaddr(lines[i],&addr,&err);
+                dwarf_lineno(lines[i],&lineno,&err);
+                *sum += addr*3 + lineno;
+                ++*rows;
+            }
+            dwarf_srclines_dealloc_b(context);
+        }
+        dwarf_dealloc_die(cu_die);
+    }
+}
+
+/*  The same object read with and without prefetching
+    gives the same section bytes and line rows. */
+static void
+compare(const char *obj,Dwarf_Debug dbg,Dwarf_Debug plain)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Unsigned rows = 0;
+    Dwarf_Unsigned sum = 0;
+    Dwarf_Unsigned prows = 0;
+    Dwarf_Unsigned psum = 0;
+    int i = 0;
+
+    for (i = 0; compare_sections[i]; ++i) {
+        const Dwarf_Small *data = 0;
+        const Dwarf_Small *pdata = 0;
+        Dwarf_Unsigned size = 0;
+        Dwarf_Unsigned psize = 0;
+        int res = 0;
+        int pres = 0;
+
+        res = dwarf_get_section_bytes(dbg,compare_sections[i],
+            &data,&size,&err);
+        pres = dwarf_get_section_bytes(plain,compare_sections[i],
+            &pdata,&psize,&err);
+        check_int("dwarf_get_section_bytes",pres,res,__LINE__);
+        if (res == DW_DLV_OK && pres == DW_DLV_OK &&
+            (size != psize || memcmp(data,pdata,size))) {
+            printf("FAIL %s %s differs after prefetch\n",
+                obj,compare_sections[i]);
+            ++errcount;
+        }
+    }
+    sum_lines(dbg,&rows,&sum);
+    sum_lines(plain,&prows,&psum);
+    if (rows != prows || sum != psum || !rows) {
+        printf("FAIL %s %lu line rows after prefetch, %lu "
+            "without\n",obj,(unsigned long)rows,
+            (unsigned long)prows);
+        ++errcount;
+    }
+}
+
+static void
+test_object(const char *obj)
+{
+    Dwarf_Debug dbg = open_obj(obj);
+    Dwarf_Debug plain = open_obj(obj);
+    const Dwarf_Small *data = 0;
+    Dwarf_Unsigned size = 0;
+    Dwarf_Error err = 0;
+    const char *absent[2];
+    int res = 0;
+
+    absent[0] = ".debug_nonesuch";
+    absent[1] = 0;
+    check_int("prefetch line sections",HINT_RES,
+        prefetch(dbg,line_sections,3),__LINE__);
+    /*  Nothing was loaded, so again. */
+    check_int("prefetch line sections again",HINT_RES,
+        prefetch(dbg,line_sections,3),__LINE__);
+    check_int("prefetch all",HINT_RES,prefetch(dbg,0,0),
+        __LINE__);
+    check_int("prefetch absent",DW_DLV_NO_ENTRY,
+        prefetch(dbg,absent,2),__LINE__);
+    check_int("prefetch zero names",DW_DLV_NO_ENTRY,
+        prefetch(dbg,line_sections,0),__LINE__);
+
+    res = dwarf_get_section_bytes(dbg,".debug_line",&data,
+        &size,&err);
+    check_int("dwarf_get_section_bytes .debug_line",DW_DLV_OK,
+        res,__LINE__);
+    /*  Loaded, so nothing to hint. */
+    check_int("prefetch loaded",DW_DLV_NO_ENTRY,
+        prefetch(dbg,line_sections,1),__LINE__);
+    compare(obj,dbg,plain);
+    check_int("prefetch all loaded",DW_DLV_NO_ENTRY,
+        prefetch(dbg,compare_sections,4),__LINE__);
+    dwarf_finish(plain);
+    dwarf_finish(dbg);
+}
+
+static void
+test_errors(void)
+{
+    Dwarf_Debug dbg = open_obj(objects[0]);
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_prefetch_sections(0,line_sections,3,&err);
+    check_int("NULL dbg",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        check_int("NULL dbg errno",DW_DLE_DBG_NULL,
+            (int)dwarf_errno(err),__LINE__);
+        /*  There is no dbg to hang it on. */
+        dwarf_dealloc_error(0,err);
+        err = 0;
+    }
+    res = dwarf_prefetch_sections(dbg,0,2,&err);
+    check_int("NULL names",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        check_int("NULL names errno",DW_DLE_DBG_NULL,
+            (int)dwarf_errno(err),__LINE__);
+        dwarf_dealloc_error(dbg,err);
+        err = 0;
+    }
+    dwarf_finish(dbg);
+}
+
+int
+main(int argc, char **argv)
+{
+    int i = 0;
+
+    testobj_srcdir(argc,argv);
+    for (i = 0; objects[i]; ++i) {
+        test_object(objects[i]);
+    }
+    test_errors();
+    testobj_exit("test_prefetch");
+    return 0;
+}
@@ -0,0 +1,370 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Tests the libdwarfp allocator, which carves
+    producer objects (DIEs, attributes and their
+    data, strings) out of large chunks freed at
+    dwarf_producer_finish_a(), giving large blocks
+    an allocation of their own.
+    Builds a CU with thousands of variables, some with
+    DW_AT_location blocks of sizes from a few bytes to
+    well over a chunk, in two producers at once, then
+    checks that every name and block comes out intact
+    in .debug_info and that both producers write the
+    same bytes. A DIE that fails to link is left to
+    dwarf_producer_finish_a() and the producer must go
+    on working.
+    Best run built with -fsanitize=address.
+
+    ./test_pro_arena
+    No test objects are read. */
+
+#include <config.h>
+
+#include <stdio.h>  /* printf() snprintf() */
+#include <stdlib.h> /* exit() free() realloc() */
+#include <string.h> /* memcmp() memcpy() memset() strcmp() strlen()
+    strncmp() */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "libdwarfp.h"
+#include "testobj_util.h"
+
+#define VARS_COUNT  6000
+#define BLOCK_MAX   (80*1024)
+#define SECTIONS_MAX 40
+
+/*  The section names, by section index,
+    of each producer. */
+struct producer_s {
+    Dwarf_P_Debug p_dbg;
+    const char   *p_names[SECTIONS_MAX];
+    int           p_count;
+    Dwarf_P_Die   p_cu;
+    Dwarf_P_Die   p_last;
+    unsigned char *p_info;
+    Dwarf_Unsigned p_info_len;
+};
+
+static unsigned char blockbuf[BLOCK_MAX];
+
+/*  Section numbers start at 1, 0 means no section
+    (as for relocation sections here). */
+static int
+section_callback(const char *name,int size,
+    Dwarf_Unsigned type,Dwarf_Unsigned flags,
+    Dwarf_Unsigned link,Dwarf_Unsigned info,
+    Dwarf_Unsigned *sect_name_index,void *user_data,
+    int *error)
+{
+    struct producer_s *p = (struct producer_s *)user_data;
+
+    (void)size;
+    (void)type;
+    (void)flags;
+    (void)link;
+    (void)info;
+    (void)error;
+    if (!strncmp(name,".rel",4)) {
+        return 0;
+    }
+    if (p->p_count+1 >= SECTIONS_MAX) {
+        printf("FAIL too many sections\n");
+        exit(EXIT_FAILURE);
+    }
+    ++p->p_count;
+    p->p_names[p->p_count] = name;
+    *sect_name_index = p->p_count;
+    return p->p_count;
+}
+
+/*  The size of the DW_AT_location block of
+    variable i, zero for none. Some are over the
+    single-object limit, a few over a whole chunk. */
+static unsigned
+block_size(int i)
+{
+    if (i%97 == 5) {
+        return 9000 + i%7000;
+    }
+    if (i%1201 == 7) {
+        return 65*1024 + i%100;
+    }
+    if (i%3 == 0) {
+        return 4 + i%61;
+    }
+    return 0;
+}
+
+static unsigned char *
+block_data(int i,unsigned size)
+{
+    unsigned k = 0;
+
+    for (k = 0; k < size; ++k) {
+        blockbuf[k] = (unsigned char)(i*7 + k*13 + 1);
+    }
+    return blockbuf;
+}
+
+static void
+start_producer(struct producer_s *p)
+{
+    Dwarf_Error err = 0;
+    Dwarf_P_Attribute attr = 0;
+    int res = 0;
+
+    memset(p,0,sizeof(*p));
+    res = dwarf_producer_init(DW_DLC_TARGET_LITTLEENDIAN|
+        DW_DLC_POINTER64|DW_DLC_OFFSET32|
+        DW_DLC_ELF_OFFSET_SIZE_64|DW_DLC_SYMBOLIC_RELOCATIONS,
+        section_callback,0,0,p,"x86_64","V5",0,
+        &p->p_dbg,&err);
+    if (res != DW_DLV_OK) {
+        printf("FAIL dwarf_producer_init %d\n",res);
+        exit(EXIT_FAILURE);
+    }
+    res = dwarf_new_die_a(p->p_dbg,DW_TAG_compile_unit,
+        0,0,0,0,&p->p_cu,&err);
+    check_int("dwarf_new_die_a CU",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        exit(EXIT_FAILURE);
+    }
+    res = dwarf_add_AT_name_a(p->p_cu,"test_pro_arena.c",
+        &attr,&err);
+    check_int("dwarf_add_AT_name_a CU",DW_DLV_OK,res,__LINE__);
+}
+
+static void
+add_var(struct producer_s *p,int i)
+{
+    Dwarf_Error err = 0;
+    Dwarf_P_Die die = 0;
+    Dwarf_P_Attribute attr = 0;
+    char name[20];
+    unsigned size = block_size(i);
+    int res = 0;
+
+    res = dwarf_new_die_a(p->p_dbg,DW_TAG_variable,
+        p->p_cu,0,0,0,&die,&err);
+    check_int("dwarf_new_die_a",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        return;
+    }
+    snprintf(name,sizeof(name),"v%05d",i);
+    res = dwarf_add_AT_name_a(die,name,&attr,&err);
+    check_int("dwarf_add_AT_name_a",DW_DLV_OK,res,__LINE__);
+    res = dwarf_add_AT_unsigned_const_a(p->p_dbg,die,
+        DW_AT_const_value,(Dwarf_Unsigned)i,&attr,&err);
+    check_int("dwarf_add_AT_unsigned_const_a",DW_DLV_OK,res,
+        __LINE__);
+    if (size) {
+        res = dwarf_add_AT_block_a(p->p_dbg,die,DW_AT_location,
+            block_data(i,size),size,&attr,&err);
+        check_int("dwarf_add_AT_block_a",DW_DLV_OK,res,__LINE__);
+    }
+    p->p_last = die;
+}
+
+/*  A DIE whose child already has a parent fails to
+    link. Its space and the error are left for
+    dwarf_producer_finish_a(). */
+static void
+add_bad_die(struct producer_s *p)
+{
+    Dwarf_Error err = 0;
+    Dwarf_P_Die die = 0;
+    int res = 0;
+
+    res = dwarf_new_die_a(p->p_dbg,DW_TAG_lexical_block,
+        0,p->p_last,0,0,&die,&err);
+    check_int("dwarf_new_die_a, child has a parent",
+        DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        check_int("dwarf_new_die_a error",DW_DLE_PARENT_EXISTS,
+            (int)dwarf_errno(err),__LINE__);
+    }
+    check_int("no die returned",1,die == 0,__LINE__);
+}
+
+/*  Copies out the .debug_info bytes. */
+static void
+finish_info(struct producer_s *p)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Unsigned nbufs = 0;
+    Dwarf_Unsigned i = 0;
+    int res = 0;
+
+    res = dwarf_add_die_to_debug_a(p->p_dbg,p->p_cu,&err);
+    check_int("dwarf_add_die_to_debug_a",DW_DLV_OK,res,__LINE__);
+    res = dwarf_transform_to_disk_form_a(p->p_dbg,&nbufs,&err);
+    check_int("dwarf_transform_to_disk_form_a",DW_DLV_OK,res,
+        __LINE__);
+    if (res != DW_DLV_OK) {
+        return;
+    }
+    for (i = 0; i < nbufs; ++i) {
+        Dwarf_Unsigned index = 0;
+        Dwarf_Unsigned len = 0;
+        Dwarf_Ptr bytes = 0;
+        unsigned char *grown = 0;
+
+        res = dwarf_get_section_bytes_a(p->p_dbg,i,&index,&len,
+            &bytes,&err);
+        check_int("dwarf_get_section_bytes_a",DW_DLV_OK,res,
+            __LINE__);
+        if (res != DW_DLV_OK) {
+            break;
+        }
+        if (index == 0 || index > (Dwarf_Unsigned)p->p_count ||
+            strcmp(p->p_names[index],".debug_info")) {
+            continue;
+        }
+        grown = (unsigned char *)realloc(p->p_info,
+            p->p_info_len + len);
+        if (!grown) {
+            printf("FAIL out of memory\n");
+            exit(EXIT_FAILURE);
+        }
+        p->p_info = grown;
+        memcpy(p->p_info + p->p_info_len,bytes,len);
+        p->p_info_len += len;
+    }
+}
+
+/*  Position of needle in p_info at or after from
+    and ending by to, or -1. */
+static long
+find_bytes(struct producer_s *p,long from,long to,
+    const unsigned char *needle,unsigned len)
+{
+    long i = 0;
+    long last = to - (long)len;
+
+    for (i = from; i <= last; ++i) {
+        if (p->p_info[i] == needle[0] &&
+            !memcmp(p->p_info+i,needle,len)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static long namepos[VARS_COUNT+1];
+
+/*  The names appear in order, and each block
+    between the names of the variables either side
+    of its own. */
+static void
+check_info(struct producer_s *p)
+{
+    long end = (long)p->p_info_len;
+    long pos = 0;
+    int i = 0;
+
+    if (p->p_info_len < 100000) {
+        printf("FAIL .debug_info is only %lu bytes\n",
+            (unsigned long)p->p_info_len);
+        ++errcount;
+        return;
+    }
+    for (i = 0; i < VARS_COUNT; ++i) {
+        char name[20];
+
+        snprintf(name,sizeof(name),"v%05d",i);
+        pos = find_bytes(p,pos,end,(unsigned char *)name,
+            (unsigned)strlen(name)+1);
+        if (pos < 0) {
+            printf("FAIL name %s missing\n",name);
+            ++errcount;
+            return;
+        }
+        namepos[i] = pos;
+    }
+    namepos[VARS_COUNT] = end;
+    for (i = 0; i < VARS_COUNT; ++i) {
+        unsigned size = block_size(i);
+
+        if (size && find_bytes(p,i? namepos[i-1]:0,namepos[i+1],
+            block_data(i,size),size) < 0) {
+            printf("FAIL block of v%05d (%u bytes) missing\n",
+                i,size);
+            ++errcount;
+            return;
+        }
+    }
+}
+
+int
+main(int argc, char **argv)
+{
+    struct producer_s one;
+    struct producer_s two;
+    Dwarf_Error err = 0;
+    int i = 0;
+    int res = 0;
+
+    (void)argc;
+    (void)argv;
+    start_producer(&one);
+    start_producer(&two);
+    /*  Interleaved, so neither producer's objects
+        are contiguous in memory. */
+    for (i = 0; i < VARS_COUNT; ++i) {
+        add_var(&one,i);
+        add_var(&two,i);
+        if (i == VARS_COUNT/2) {
+            add_bad_die(&one);
+        }
+    }
+    add_bad_die(&two);
+    finish_info(&one);
+    finish_info(&two);
+    check_info(&one);
+    check_int("same .debug_info length",(int)one.p_info_len,
+        (int)two.p_info_len,__LINE__);
+    if (one.p_info_len == two.p_info_len) {
+        check_int("same .debug_info bytes",0,
+            memcmp(one.p_info,two.p_info,one.p_info_len) != 0,
+            __LINE__);
+    }
+    res = dwarf_producer_finish_a(one.p_dbg,&err);
+    check_int("dwarf_producer_finish_a",DW_DLV_OK,res,__LINE__);
+    res = dwarf_producer_finish_a(two.p_dbg,&err);
+    check_int("dwarf_producer_finish_a",DW_DLV_OK,res,__LINE__);
+    free(one.p_info);
+    free(two.p_info);
+    testobj_exit("test_pro_arena");
+    return 0;
+}
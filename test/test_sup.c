@@ -0,0 +1,263 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Tests dwarf_get_sup_paths(), dwarf_set_sup_dbg(),
+    dwarf_get_sup_dbg() and dwarf_formref_sup_die()
+    on the objects built from test/testsup*LE64ELf.s.
+    testsupmainLE64ELf.testme is a GNU dwz style
+    object (.gnu_debugaltlink), testsup5LE64ELf.testme
+    a DWARF5 one (.debug_sup), and both take their
+    strings and one type from testsupaltLE64ELf.testme.
+
+    ./test_sup -f <top source directory>
+    or set environment variable DWTOPSRCDIR. */
+
+#include <config.h>
+
+#include <stdio.h>  /* printf() */
+#include <stdlib.h> /* exit() free() */
+#include <string.h> /* memcmp() strcmp() strlen() */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "testobj_util.h"
+
+/*  Returns the CU DIE and its first child, the
+    variable with a name and type in the
+    supplementary file. */
+static void
+get_cu_and_var(Dwarf_Debug dbg,Dwarf_Die *cu_out,
+    Dwarf_Die *var_out)
+{
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_next_cu_header_e(dbg,1,cu_out,
+        0,0,0,0,0,0,0,0,0,0,&err);
+    check_int("next cu",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        exit(EXIT_FAILURE);
+    }
+    res = dwarf_child(*cu_out,var_out,&err);
+    check_int("cu child",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void
+test_paths(Dwarf_Debug dbg,const unsigned char *id,
+    Dwarf_Unsigned idlen)
+{
+    char          *name = 0;
+    Dwarf_Small   *idout = 0;
+    Dwarf_Unsigned idlenout = 0;
+    char         **paths = 0;
+    unsigned       count = 0;
+    Dwarf_Error    err = 0;
+    const char    *want = 0;
+    size_t         plen = 0;
+    int            res = 0;
+
+    res = dwarf_get_sup_paths(dbg,NULL,NULL,NULL,NULL,NULL,&err);
+    check_int("sup paths, no outputs",DW_DLV_OK,res,__LINE__);
+    res = dwarf_get_sup_paths(dbg,&name,&idout,&idlenout,
+        &paths,&count,&err);
+    check_int("sup paths",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        return;
+    }
+    check_string("sup name","testsupaltLE64ELf.testme",
+        name,__LINE__);
+    check_unsigned("sup id length",idlen,idlenout,__LINE__);
+    if (idlenout == idlen && memcmp(id,idout,idlen)) {
+        printf("FAIL sup id bytes differ test line %d\n",
+            __LINE__);
+        ++errcount;
+    }
+    /*  The name, relative to the directory of the
+        object, comes first. */
+    check_int("sup path count at least 1",1,count >= 1,
+        __LINE__);
+    want = test_obj_path("testsupaltLE64ELf.testme");
+    if (count) {
+        plen = strlen(paths[0]);
+    }
+    if (!count || plen < 25 ||
+        strcmp(paths[0]+plen-25,"/testsupaltLE64ELf.testme")) {
+        printf("FAIL sup path[0] expected %s got %s "
+            "test line %d\n",want,count?paths[0]:"<none>",
+            __LINE__);
+        ++errcount;
+    }
+    free(paths);
+}
+
+static void
+test_main(const char *objname,const unsigned char *id,
+    Dwarf_Unsigned idlen,Dwarf_Debug sup)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Debug got = 0;
+    Dwarf_Die cu = 0;
+    Dwarf_Die var = 0;
+    Dwarf_Die tdie = 0;
+    Dwarf_Attribute attr = 0;
+    Dwarf_Error err = 0;
+    char *name = 0;
+    Dwarf_Half tag = 0;
+    Dwarf_Unsigned size = 0;
+    int res = 0;
+
+    dbg = open_obj(objname);
+    test_paths(dbg,id,idlen);
+
+    res = dwarf_get_sup_dbg(dbg,&got,&err);
+    check_int("get sup, none set",DW_DLV_OK,res,__LINE__);
+    check_int("get sup, none set is NULL",1,got == 0,__LINE__);
+    get_cu_and_var(dbg,&cu,&var);
+    res = dwarf_attr(var,DW_AT_type,&attr,&err);
+    check_int("type attr",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        exit(EXIT_FAILURE);
+    }
+    res = dwarf_formref_sup_die(attr,&tdie,&err);
+    check_int("sup die, none set",DW_DLV_NO_ENTRY,res,__LINE__);
+
+    res = dwarf_set_sup_dbg(dbg,sup,&err);
+    check_int("set sup",DW_DLV_OK,res,__LINE__);
+    res = dwarf_get_sup_dbg(dbg,&got,&err);
+    check_int("get sup",DW_DLV_OK,res,__LINE__);
+    check_int("get sup is sup",1,got == sup,__LINE__);
+
+    res = dwarf_diename(cu,&name,&err);
+    check_int("cu name",DW_DLV_OK,res,__LINE__);
+    if (res == DW_DLV_OK) {
+        check_string("cu name","shared_name",name,__LINE__);
+    }
+    res = dwarf_diename(var,&name,&err);
+    check_int("var name",DW_DLV_OK,res,__LINE__);
+    if (res == DW_DLV_OK) {
+        check_string("var name","alt_int",name,__LINE__);
+    }
+    res = dwarf_formref_sup_die(attr,&tdie,&err);
+    check_int("sup die",DW_DLV_OK,res,__LINE__);
+    if (res == DW_DLV_OK) {
+        Dwarf_Off off = 0;
+
+        res = dwarf_tag(tdie,&tag,&err);
+        check_int("sup die tag",DW_DLV_OK,res,__LINE__);
+        check_int("sup die tag value",DW_TAG_base_type,tag,
+            __LINE__);
+        res = dwarf_dieoffset(tdie,&off,&err);
+        check_int("sup die offset",DW_DLV_OK,res,__LINE__);
+        check_unsigned("sup die offset value",0x12,off,
+            __LINE__);
+        res = dwarf_diename(tdie,&name,&err);
+        check_int("sup die name",DW_DLV_OK,res,__LINE__);
+        if (res == DW_DLV_OK) {
+            check_string("sup die name","alt_int",name,
+                __LINE__);
+        }
+        res = dwarf_bytesize(tdie,&size,&err);
+        check_int("sup die size",DW_DLV_OK,res,__LINE__);
+        check_unsigned("sup die size value",4,size,__LINE__);
+        dwarf_dealloc_die(tdie);
+    }
+    /*  Any other form is not a supplementary reference. */
+    {
+        Dwarf_Attribute nattr = 0;
+
+        res = dwarf_attr(var,DW_AT_name,&nattr,&err);
+        check_int("name attr",DW_DLV_OK,res,__LINE__);
+        if (res == DW_DLV_OK) {
+            res = dwarf_formref_sup_die(nattr,&tdie,&err);
+            check_int("sup die of a string",DW_DLV_ERROR,res,
+                __LINE__);
+            if (res == DW_DLV_ERROR) {
+                dwarf_dealloc_error(dbg,err);
+                err = 0;
+            } else if (res == DW_DLV_OK) {
+                dwarf_dealloc_die(tdie);
+            }
+            dwarf_dealloc_attribute(nattr);
+        }
+    }
+    dwarf_dealloc_attribute(attr);
+
+    /*  Detach. */
+    res = dwarf_set_sup_dbg(dbg,NULL,&err);
+    check_int("detach sup",DW_DLV_OK,res,__LINE__);
+    res = dwarf_get_sup_dbg(dbg,&got,&err);
+    check_int("get sup, detached",DW_DLV_OK,res,__LINE__);
+    check_int("get sup, detached is NULL",1,got == 0,__LINE__);
+    dwarf_dealloc_die(var);
+    dwarf_dealloc_die(cu);
+    dwarf_finish(dbg);
+}
+
+int
+main(int argc, char **argv)
+{
+    static const unsigned char altid[4] =
+        { 0xde,0xad,0xbe,0xef };
+    static const unsigned char sup5id[2] = { 0x12,0x34 };
+    Dwarf_Debug sup = 0;
+    Dwarf_Debug dbg = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    testobj_srcdir(argc,argv);
+    sup = open_obj("testsupaltLE64ELf.testme");
+    /*  The supplementary file itself names no other. */
+    res = dwarf_get_sup_paths(sup,NULL,NULL,NULL,NULL,NULL,&err);
+    check_int("sup paths of the sup file",DW_DLV_NO_ENTRY,res,
+        __LINE__);
+
+    /*  One supplementary dbg serves several objects. */
+    test_main("testsupmainLE64ELf.testme",altid,4,sup);
+    test_main("testsup5LE64ELf.testme",sup5id,2,sup);
+
+    dbg = open_obj("dummyexecutable");
+    res = dwarf_get_sup_paths(dbg,NULL,NULL,NULL,NULL,NULL,&err);
+    check_int("sup paths, none",DW_DLV_NO_ENTRY,res,__LINE__);
+    res = dwarf_set_sup_dbg(NULL,sup,&err);
+    check_int("set sup, NULL dbg",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(NULL,err);
+        err = 0;
+    }
+    dwarf_finish(dbg);
+    dwarf_finish(sup);
+    testobj_exit("test_sup");
+    return 0;
+}
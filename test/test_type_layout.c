@@ -0,0 +1,711 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Tests dwarf_type_size(), dwarf_type_layout(),
+    dwarf_type_layout_info(), dwarf_type_layout_member()
+    and dwarf_cu_type_layouts().
+    Every layout of the objects in test/ is checked
+    against the DIEs of the type: the size, the data
+    members in order, their locations and sizes, and
+    the members of nested aggregates.
+    testtypelayoutLE64ELf.testme (DWARF3, from
+    testtypelayoutLE64ELf.s) is also checked by value:
+    a DW_FORM_data4 member location is a location list,
+    a pointer to member without DW_AT_byte_size has no
+    known size, and a typedef chain longer than the
+    depth limit does not spoil the sizes of the
+    shorter chains inside it.
+
+    ./test_type_layout -f <top source directory>
+    or set environment variable DWTOPSRCDIR. */
+
+#include <config.h>
+
+#include <stdio.h>  /* printf() */
+#include <stdlib.h> /* exit() */
+#include <string.h> /* strcmp() strlen() strncmp() */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "testobj_util.h"
+
+static const char *objects[] = {
+"testtypelayoutLE64ELf.testme",
+"dummyexecutable.debug",
+"testuriLE64ELf.testme",
+"testobjLE32PE.exe",
+"test-mach-o-32.dSYM",
+"testnamesLE64ELf5.testme",
+0
+};
+
+static Dwarf_Die
+first_cu_die(Dwarf_Debug dbg)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Die cu_die = 0;
+    int res = 0;
+
+    res = dwarf_next_cu_header_e(dbg,1,&cu_die,
+        0,0,0,0,0,0,0,0,0,0,&err);
+    check_int("dwarf_next_cu_header_e",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        exit(EXIT_FAILURE);
+    }
+    return cu_die;
+}
+
+static int
+has_attr(Dwarf_Die die,Dwarf_Half attrnum)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Bool has = 0;
+    int res = 0;
+
+    res = dwarf_hasattr(die,attrnum,&has,&err);
+    check_int("dwarf_hasattr",DW_DLV_OK,res,__LINE__);
+    return has != 0;
+}
+
+static Dwarf_Unsigned
+get_udata_attr(Dwarf_Die die,Dwarf_Half attrnum)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Attribute attr = 0;
+    Dwarf_Unsigned val = 0;
+    int res = 0;
+
+    res = dwarf_attr(die,attrnum,&attr,&err);
+    check_int("dwarf_attr",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        return 0;
+    }
+    res = dwarf_formudata(attr,&val,&err);
+    check_int("dwarf_formudata",DW_DLV_OK,res,__LINE__);
+    dwarf_dealloc_attribute(attr);
+    return val;
+}
+
+/*  DW_OP_plus_uconst or DW_OP_constu and nothing else. */
+static int
+decode_offset_expr(Dwarf_Small *expr,Dwarf_Unsigned len,
+    Dwarf_Unsigned *val)
+{
+    Dwarf_Unsigned leblen = 0;
+
+    if (len < 2 || (expr[0] != DW_OP_plus_uconst &&
+        expr[0] != DW_OP_constu)) {
+        return 0;
+    }
+    if (dwarf_decode_leb128((char *)expr+1,&leblen,val,
+        (char *)expr+len) != DW_DLV_OK) {
+        return 0;
+    }
+    return leblen + 1 == len;
+}
+
+/*  The reading of DW_AT_data_member_location the
+    layout must agree with. Returns 1 and the byte
+    offset if it is a constant. */
+static int
+member_location(Dwarf_Debug dbg,Dwarf_Die die,
+    Dwarf_Unsigned *loc)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Attribute attr = 0;
+    Dwarf_Half version = 0;
+    Dwarf_Half offset_size = 0;
+    Dwarf_Half form = 0;
+    enum Dwarf_Form_Class fc = DW_FORM_CLASS_UNKNOWN;
+    int known = 0;
+    int res = 0;
+
+    res = dwarf_attr(die,DW_AT_data_member_location,&attr,&err);
+    check_int("dwarf_attr",1,res != DW_DLV_ERROR,__LINE__);
+    if (res == DW_DLV_NO_ENTRY) {
+        *loc = 0;
+        return 1;
+    }
+    if (res != DW_DLV_OK) {
+        return 0;
+    }
+    res = dwarf_get_version_of_die(die,&version,&offset_size);
+    check_int("dwarf_get_version_of_die",DW_DLV_OK,res,__LINE__);
+    res = dwarf_whatform(attr,&form,&err);
+    check_int("dwarf_whatform",DW_DLV_OK,res,__LINE__);
+    fc = dwarf_get_form_class(version,DW_AT_data_member_location,
+        offset_size,form);
+    if (fc == DW_FORM_CLASS_CONSTANT) {
+        res = dwarf_formudata(attr,loc,&err);
+        check_int("dwarf_formudata",DW_DLV_OK,res,__LINE__);
+        known = 1;
+    } else if (form == DW_FORM_exprloc) {
+        Dwarf_Unsigned len = 0;
+        Dwarf_Ptr ptr = 0;
+
+        res = dwarf_formexprloc(attr,&len,&ptr,&err);
+        check_int("dwarf_formexprloc",DW_DLV_OK,res,__LINE__);
+        known = decode_offset_expr((Dwarf_Small *)ptr,len,loc);
+    } else if (fc == DW_FORM_CLASS_EXPRLOC ||
+        fc == DW_FORM_CLASS_BLOCK) {
+        Dwarf_Block *block = 0;
+
+        res = dwarf_formblock(attr,&block,&err);
+        check_int("dwarf_formblock",DW_DLV_OK,res,__LINE__);
+        if (res == DW_DLV_OK) {
+            known = decode_offset_expr(
+                (Dwarf_Small *)block->bl_data,
+                block->bl_len,loc);
+            dwarf_dealloc(dbg,block,DW_DLA_BLOCK);
+        }
+    }
+    dwarf_dealloc_attribute(attr);
+    return known;
+}
+
+static int
+is_data_member(Dwarf_Die die)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Half tag = 0;
+    int res = 0;
+
+    res = dwarf_tag(die,&tag,&err);
+    check_int("dwarf_tag",DW_DLV_OK,res,__LINE__);
+    if (tag != DW_TAG_member && tag != DW_TAG_inheritance) {
+        return 0;
+    }
+    return !has_attr(die,DW_AT_external) &&
+        !has_attr(die,DW_AT_declaration);
+}
+
+/*  The nested aggregate layout of a member, if any. */
+static Dwarf_Type_Layout
+member_type_layout(Dwarf_Debug dbg,Dwarf_Die die)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Attribute attr = 0;
+    Dwarf_Off off = 0;
+    Dwarf_Bool is_info = 0;
+    Dwarf_Die tdie = 0;
+    Dwarf_Type_Layout sub = 0;
+    int res = 0;
+
+    res = dwarf_attr(die,DW_AT_type,&attr,&err);
+    check_int("dwarf_attr",1,res != DW_DLV_ERROR,__LINE__);
+    if (res != DW_DLV_OK) {
+        return 0;
+    }
+    res = dwarf_global_formref_b(attr,&off,&is_info,&err);
+    check_int("dwarf_global_formref_b",DW_DLV_OK,res,__LINE__);
+    dwarf_dealloc_attribute(attr);
+    res = dwarf_offdie_b(dbg,off,is_info,&tdie,&err);
+    check_int("dwarf_offdie_b",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        return 0;
+    }
+    res = dwarf_type_layout(tdie,&sub,&err);
+    check_int("dwarf_type_layout",1,res != DW_DLV_ERROR,__LINE__);
+    dwarf_dealloc_die(tdie);
+    return res == DW_DLV_OK? sub:0;
+}
+
+/*  Checks the member_count entries of layout
+    against the children of its DIE. */
+static void
+check_members(Dwarf_Debug dbg,const char *obj,
+    Dwarf_Type_Layout layout,Dwarf_Die die,
+    Dwarf_Unsigned member_count)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Die child = 0;
+    Dwarf_Unsigned i = 0;
+    int res = 0;
+
+    res = dwarf_child(die,&child,&err);
+    check_int("dwarf_child",1,res != DW_DLV_ERROR,__LINE__);
+    while (res == DW_DLV_OK) {
+        Dwarf_Die sib = 0;
+
+        if (is_data_member(child)) {
+            const char *name = 0;
+            Dwarf_Half depth = 0;
+            Dwarf_Off moff = 0;
+            Dwarf_Off coff = 0;
+            Dwarf_Bool known = 0;
+            Dwarf_Unsigned bitoff = 0;
+            Dwarf_Unsigned bitsize = 0;
+            Dwarf_Unsigned bytesize = 0;
+            Dwarf_Unsigned tsize = 0;
+            Dwarf_Unsigned loc = 0;
+            Dwarf_Type_Layout sub = 0;
+
+            res = dwarf_type_layout_member(layout,i,&name,
+                &depth,&moff,0,&known,&bitoff,&bitsize,
+                &bytesize,&err);
+            check_int("dwarf_type_layout_member",DW_DLV_OK,res,
+                __LINE__);
+            if (res != DW_DLV_OK) {
+                printf("FAIL %s: too few members\n",obj);
+                dwarf_dealloc_die(child);
+                return;
+            }
+            ++i;
+            res = dwarf_dieoffset(child,&coff,&err);
+            check_unsigned("member DIE",coff,moff,__LINE__);
+            check_int("member depth",0,depth,__LINE__);
+            res = dwarf_type_size(child,&tsize,0,&err);
+            check_int("dwarf_type_size",1,res != DW_DLV_ERROR,
+                __LINE__);
+            check_unsigned("member size",
+                res == DW_DLV_OK? tsize:0,bytesize,__LINE__);
+            if (has_attr(child,DW_AT_bit_size)) {
+                check_unsigned("bit size",
+                    get_udata_attr(child,DW_AT_bit_size),
+                    bitsize,__LINE__);
+            } else {
+                int lknown = 0;
+
+                if (has_attr(child,DW_AT_data_bit_offset)) {
+                    lknown = 1;
+                    loc = get_udata_attr(child,
+                        DW_AT_data_bit_offset);
+                } else {
+                    lknown = member_location(dbg,child,&loc);
+                    loc *= 8;
+                }
+                check_unsigned("bit size",0,bitsize,__LINE__);
+                check_int("offset known",lknown,known,__LINE__);
+                if (lknown) {
+                    check_unsigned("bit offset",loc,bitoff,
+                        __LINE__);
+                }
+                if (known) {
+                    sub = member_type_layout(dbg,child);
+                }
+            }
+            if (sub) {
+                Dwarf_Unsigned subcount = 0;
+                Dwarf_Unsigned j = 0;
+                size_t namelen = strlen(name);
+
+                res = dwarf_type_layout_info(sub,0,0,0,0,
+                    &subcount,&err);
+                check_int("dwarf_type_layout_info",DW_DLV_OK,
+                    res,__LINE__);
+                for (j = 0; j < subcount; ++j, ++i) {
+                    const char *sname = 0;
+                    const char *nname = 0;
+                    Dwarf_Half sdepth = 0;
+                    Dwarf_Half ndepth = 0;
+                    Dwarf_Bool sknown = 0;
+                    Dwarf_Bool nknown = 0;
+                    Dwarf_Unsigned soff = 0;
+                    Dwarf_Unsigned noff = 0;
+
+                    dwarf_type_layout_member(sub,j,&sname,
+                        &sdepth,0,0,&sknown,&soff,0,0,&err);
+                    res = dwarf_type_layout_member(layout,i,
+                        &nname,&ndepth,0,0,&nknown,&noff,0,0,
+                        &err);
+                    check_int("nested member",DW_DLV_OK,res,
+                        __LINE__);
+                    if (res != DW_DLV_OK) {
+                        break;
+                    }
+                    check_int("nested depth",sdepth+1,ndepth,
+                        __LINE__);
+                    check_int("nested known",sknown,nknown,
+                        __LINE__);
+                    if (sknown) {
+                        check_unsigned("nested offset",
+                            bitoff+soff,noff,__LINE__);
+                    }
+                    if (namelen && sname[0]) {
+                        check_int("nested name",1,
+                            !strncmp(nname,name,namelen) &&
+                            nname[namelen] == '.' &&
+                            !strcmp(nname+namelen+1,sname),
+                            __LINE__);
+                    } else {
+                        check_string("nested name",
+                            namelen? name:sname,nname,__LINE__);
+                    }
+                }
+            }
+        }
+        res = dwarf_siblingof_c(child,&sib,&err);
+        check_int("dwarf_siblingof_c",1,res != DW_DLV_ERROR,
+            __LINE__);
+        dwarf_dealloc_die(child);
+        child = sib;
+    }
+    check_unsigned("member count",i,member_count,__LINE__);
+    res = dwarf_type_layout_member(layout,member_count,0,0,0,0,
+        0,0,0,0,&err);
+    check_int("member past the end",DW_DLV_NO_ENTRY,res,__LINE__);
+}
+
+static void
+test_object(const char *obj)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Error err = 0;
+    unsigned cus = 0;
+    unsigned layouts = 0;
+    int res = 0;
+
+    dbg = open_obj(obj);
+    for (;;) {
+        Dwarf_Die cu_die = 0;
+        Dwarf_Type_Layout *list = 0;
+        Dwarf_Unsigned count = 0;
+        Dwarf_Unsigned i = 0;
+
+        res = dwarf_next_cu_header_e(dbg,1,&cu_die,
+            0,0,0,0,0,0,0,0,0,0,&err);
+        if (res != DW_DLV_OK) {
+            check_int("dwarf_next_cu_header_e",DW_DLV_NO_ENTRY,
+                res,__LINE__);
+            break;
+        }
+        ++cus;
+        res = dwarf_cu_type_layouts(cu_die,&list,&count,&err);
+        check_int("dwarf_cu_type_layouts",1,
+            res != DW_DLV_ERROR,__LINE__);
+        for (i = 0; res == DW_DLV_OK && i < count; ++i) {
+            Dwarf_Off off = 0;
+            Dwarf_Bool is_info = 0;
+            Dwarf_Unsigned size = 0;
+            Dwarf_Unsigned align = 0;
+            Dwarf_Unsigned members = 0;
+            Dwarf_Unsigned tsize = 0;
+            Dwarf_Unsigned talign = 0;
+            Dwarf_Type_Layout again = 0;
+            Dwarf_Die die = 0;
+            int lres = 0;
+
+            ++layouts;
+            lres = dwarf_type_layout_info(list[i],&off,&is_info,
+                &size,&align,&members,&err);
+            check_int("dwarf_type_layout_info",DW_DLV_OK,lres,
+                __LINE__);
+            lres = dwarf_offdie_b(dbg,off,is_info,&die,&err);
+            check_int("dwarf_offdie_b",DW_DLV_OK,lres,__LINE__);
+            if (lres != DW_DLV_OK) {
+                continue;
+            }
+            check_unsigned("byte size",
+                get_udata_attr(die,DW_AT_byte_size),size,
+                __LINE__);
+            lres = dwarf_type_size(die,&tsize,&talign,&err);
+            check_int("dwarf_type_size",DW_DLV_OK,lres,__LINE__);
+            check_unsigned("type size",size,tsize,__LINE__);
+            check_unsigned("alignment",align,talign,__LINE__);
+            check_int("alignment a power of two",0,
+                (int)(talign & (talign-1)),__LINE__);
+            lres = dwarf_type_layout(die,&again,&err);
+            check_int("dwarf_type_layout",DW_DLV_OK,lres,
+                __LINE__);
+            check_int("same layout",1,again == list[i],__LINE__);
+            check_members(dbg,obj,list[i],die,members);
+            dwarf_dealloc_die(die);
+        }
+        if (res == DW_DLV_OK) {
+            dwarf_dealloc(dbg,list,DW_DLA_LIST);
+        }
+        dwarf_dealloc_die(cu_die);
+    }
+    if (!cus || !layouts) {
+        printf("FAIL %s: %u CUs %u layouts\n",obj,cus,layouts);
+        ++errcount;
+    }
+    dwarf_finish(dbg);
+}
+
+/*  The children of the CU DIE of testtypelayoutLE64ELf
+    by name, ptr_to_member types as "pm" and "pn". */
+static Dwarf_Die
+find_die(Dwarf_Debug dbg,Dwarf_Die cu_die,const char *want)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Die child = 0;
+    unsigned ptm = 0;
+    int res = 0;
+
+    res = dwarf_child(cu_die,&child,&err);
+    while (res == DW_DLV_OK) {
+        Dwarf_Die sib = 0;
+        Dwarf_Half tag = 0;
+        char *name = 0;
+
+        dwarf_tag(child,&tag,&err);
+        if (tag == DW_TAG_ptr_to_member_type) {
+            name = ptm++? "pn":"pm";
+        } else {
+            res = dwarf_diename(child,&name,&err);
+            check_int("dwarf_diename",DW_DLV_OK,res,__LINE__);
+        }
+        if (name && !strcmp(name,want)) {
+            return child;
+        }
+        res = dwarf_siblingof_c(child,&sib,&err);
+        dwarf_dealloc_die(child);
+        child = sib;
+    }
+    printf("FAIL no DIE %s\n",want);
+    dwarf_finish(dbg);
+    exit(EXIT_FAILURE);
+    return 0;
+}
+
+static void
+check_size(Dwarf_Debug dbg,Dwarf_Die cu_die,const char *name,
+    int expres,Dwarf_Unsigned expsize,Dwarf_Unsigned expalign,
+    int line)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Die die = find_die(dbg,cu_die,name);
+    Dwarf_Unsigned size = 0;
+    Dwarf_Unsigned align = 0;
+    int res = 0;
+
+    res = dwarf_type_size(die,&size,&align,&err);
+    check_int(name,expres,res,line);
+    if (res == DW_DLV_OK && expres == DW_DLV_OK) {
+        check_unsigned(name,expsize,size,line);
+        check_unsigned(name,expalign,align,line);
+    }
+    dwarf_dealloc_die(die);
+}
+
+struct member_s {
+    const char    *me_name;
+    Dwarf_Half     me_depth;
+    Dwarf_Bool     me_known;
+    Dwarf_Unsigned me_bit_offset;
+    Dwarf_Unsigned me_byte_size;
+};
+
+static void
+check_layout(Dwarf_Debug dbg,Dwarf_Die cu_die,const char *name,
+    Dwarf_Unsigned expsize,Dwarf_Unsigned expalign,
+    const struct member_s *expm,Dwarf_Unsigned expcount)
+{
+    Dwarf_Error err = 0;
+    Dwarf_Die die = find_die(dbg,cu_die,name);
+    Dwarf_Type_Layout layout = 0;
+    Dwarf_Unsigned size = 0;
+    Dwarf_Unsigned align = 0;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Unsigned i = 0;
+    int res = 0;
+
+    res = dwarf_type_layout(die,&layout,&err);
+    check_int(name,DW_DLV_OK,res,__LINE__);
+    dwarf_dealloc_die(die);
+    if (res != DW_DLV_OK) {
+        return;
+    }
+    dwarf_type_layout_info(layout,0,0,&size,&align,&count,&err);
+    check_unsigned(name,expsize,size,__LINE__);
+    check_unsigned(name,expalign,align,__LINE__);
+    check_unsigned(name,expcount,count,__LINE__);
+    for (i = 0; i < count && i < expcount; ++i) {
+        const struct member_s *e = expm+i;
+        const char *mname = 0;
+        Dwarf_Half depth = 0;
+        Dwarf_Bool known = 0;
+        Dwarf_Unsigned bitoff = 0;
+        Dwarf_Unsigned bytesize = 0;
+
+        res = dwarf_type_layout_member(layout,i,&mname,&depth,
+            0,0,&known,&bitoff,0,&bytesize,&err);
+        check_int("dwarf_type_layout_member",DW_DLV_OK,res,
+            __LINE__);
+        check_string(name,e->me_name,mname,__LINE__);
+        check_int(e->me_name,e->me_depth,depth,__LINE__);
+        check_int(e->me_name,e->me_known,known,__LINE__);
+        if (e->me_known) {
+            check_unsigned(e->me_name,e->me_bit_offset,bitoff,
+                __LINE__);
+        }
+        check_unsigned(e->me_name,e->me_byte_size,bytesize,
+            __LINE__);
+    }
+}
+
+static const struct member_s s_members[] = {
+{"a",0,1,0,4},
+{"b",0,1,32,1},
+/*  DW_FORM_data4 in DWARF3, a location list. */
+{"c",0,0,0,4},
+{"pm",0,1,64,8},
+/*  No DW_AT_byte_size on the ptr_to_member_type. */
+{"pn",0,1,128,0}
+};
+
+static const struct member_s s2_members[] = {
+{"s",0,1,0,24},
+{"s.a",1,1,0,4},
+{"s.b",1,1,32,1},
+{"s.c",1,0,0,4},
+{"s.pm",1,1,64,8},
+{"s.pn",1,1,128,0},
+{"x",0,1,192,4}
+};
+
+static void
+test_values(void)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Die cu_die = 0;
+
+    dbg = open_obj("testtypelayoutLE64ELf.testme");
+    cu_die = first_cu_die(dbg);
+    /*  T0 is 70 typedefs from int, beyond the limit.
+        That must not leave T10 or T5, evaluated on
+        the way, unknown. */
+    check_size(dbg,cu_die,"T0",DW_DLV_NO_ENTRY,0,0,__LINE__);
+    check_size(dbg,cu_die,"T10",DW_DLV_OK,4,4,__LINE__);
+    check_size(dbg,cu_die,"T5",DW_DLV_OK,4,4,__LINE__);
+    check_size(dbg,cu_die,"T69",DW_DLV_OK,4,4,__LINE__);
+    check_size(dbg,cu_die,"T0",DW_DLV_NO_ENTRY,0,0,__LINE__);
+
+    /*  Not the size of the int member type. */
+    check_size(dbg,cu_die,"pm",DW_DLV_OK,8,8,__LINE__);
+    check_size(dbg,cu_die,"pn",DW_DLV_NO_ENTRY,0,0,__LINE__);
+
+    check_layout(dbg,cu_die,"S",24,8,s_members,
+        sizeof(s_members)/sizeof(s_members[0]));
+    check_layout(dbg,cu_die,"S2",28,8,s2_members,
+        sizeof(s2_members)/sizeof(s2_members[0]));
+    dwarf_dealloc_die(cu_die);
+    dwarf_finish(dbg);
+}
+
+static void
+test_errors(void)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Error err = 0;
+    Dwarf_Die cu_die = 0;
+    Dwarf_Die die = 0;
+    Dwarf_Type_Layout layout = 0;
+    Dwarf_Type_Layout *list = 0;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Unsigned size = 0;
+    int res = 0;
+
+    res = dwarf_type_size(NULL,&size,0,&err);
+    check_int("type size, NULL die",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(NULL,err);
+        err = 0;
+    }
+    res = dwarf_type_layout(NULL,&layout,&err);
+    check_int("layout, NULL die",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(NULL,err);
+        err = 0;
+    }
+    res = dwarf_type_layout_info(NULL,0,0,&size,0,0,&err);
+    check_int("info, NULL layout",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(NULL,err);
+        err = 0;
+    }
+    res = dwarf_type_layout_member(NULL,0,0,0,0,0,0,0,0,0,&err);
+    check_int("member, NULL layout",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(NULL,err);
+        err = 0;
+    }
+
+    dbg = open_obj("testtypelayoutLE64ELf.testme");
+    cu_die = first_cu_die(dbg);
+    res = dwarf_type_layout(cu_die,NULL,&err);
+    check_int("layout, NULL layout_out",DW_DLV_ERROR,res,
+        __LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(dbg,err);
+        err = 0;
+    }
+    res = dwarf_cu_type_layouts(cu_die,NULL,&count,&err);
+    check_int("cu layouts, NULL layouts_out",DW_DLV_ERROR,res,
+        __LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(dbg,err);
+        err = 0;
+    }
+    /*  Not an aggregate. */
+    die = find_die(dbg,cu_die,"int");
+    res = dwarf_type_layout(die,&layout,&err);
+    check_int("layout of int",DW_DLV_NO_ENTRY,res,__LINE__);
+    dwarf_dealloc_die(die);
+    die = find_die(dbg,cu_die,"T0");
+    res = dwarf_type_layout(die,&layout,&err);
+    check_int("layout of T0",DW_DLV_NO_ENTRY,res,__LINE__);
+    dwarf_dealloc_die(die);
+    res = dwarf_cu_type_layouts(cu_die,&list,&count,&err);
+    check_int("cu layouts",DW_DLV_OK,res,__LINE__);
+    if (res == DW_DLV_OK) {
+        check_unsigned("cu layouts",2,count,__LINE__);
+        dwarf_dealloc(dbg,list,DW_DLA_LIST);
+    }
+    dwarf_dealloc_die(cu_die);
+    dwarf_finish(dbg);
+
+    /*  Only a base type here. */
+    dbg = open_obj("testsupaltLE64ELf.testme");
+    cu_die = first_cu_die(dbg);
+    res = dwarf_cu_type_layouts(cu_die,&list,&count,&err);
+    check_int("cu layouts, no aggregates",DW_DLV_NO_ENTRY,res,
+        __LINE__);
+    dwarf_dealloc_die(cu_die);
+    dwarf_finish(dbg);
+}
+
+int
+main(int argc, char **argv)
+{
+    int i = 0;
+
+    testobj_srcdir(argc,argv);
+    test_values();
+    for (i = 0; objects[i]; ++i) {
+        test_object(objects[i]);
+    }
+    test_errors();
+    testobj_exit("test_type_layout");
+    return 0;
+}
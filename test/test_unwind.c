@@ -0,0 +1,612 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Tests dwarf_unwinder_create(), dwarf_unwind_step(),
+    dwarf_unwind_stack() and dwarf_dealloc_unwinder().
+    testunwindehLE64ELf.testme and testunwinddfLE64ELf.testme,
+    from testunwindLE64ELf.s, have the same code with
+    the frame tables in .eh_frame and in .debug_frame.
+    A stack for that code is built here, in a table
+    the memory read function looks up, and unwound
+    frame by frame with the registers of each frame
+    checked. The .eh_frame of dummyexecutable is
+    checked against dwarf_get_fde_info_for_cfa_reg3_c()
+    and dwarf_get_fde_info_for_reg3_c() at the start of
+    each function.
+
+    ./test_unwind -f <top source directory>
+    or set environment variable DWTOPSRCDIR. */
+
+#include <config.h>
+
+#include <stdio.h>  /* printf() */
+#include <stdlib.h> /* exit() */
+#include <string.h> /* memset() */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "testobj_util.h"
+
+/*  x86_64 DWARF register numbers. */
+#define REG_RBX  3
+#define REG_RBP  6
+#define REG_RSP  7
+#define REG_R12 12
+#define REG_R13 13
+#define REG_RA  16
+#define REG_COUNT 17
+
+/*  From nm of the testunwind objects. */
+#define ADDR_OUTER_RET  0x401006
+#define ADDR_MIDDLE_RET 0x401011
+#define ADDR_EXPRS_RET  0x40101d
+#define ADDR_LEAF       0x401028
+#define ADDR_LEAF_PC    0x401029
+#define ADDR_SIGFRAME   0x40102a
+
+/*  The CFA of exprs, the stack is built around it.
+    See testunwindLE64ELf.s for the frame sizes. */
+#define CFA_EXPRS  0x7fff0100
+#define SP_LEAF    (CFA_EXPRS - 48)
+#define CFA_MIDDLE (CFA_EXPRS + 24)
+#define RBP_OUTER  0x7fff0800
+#define RBP_MIDDLE (CFA_EXPRS + 8)
+
+struct mem_s {
+    Dwarf_Addr     m_addr;
+    Dwarf_Unsigned m_value;
+};
+
+static const struct mem_s stack_mem[] = {
+/*  leaf: the return address at its CFA-8. */
+{SP_LEAF,          ADDR_EXPRS_RET},
+/*  exprs: the CFA is *(rsp), r13 at CFA-16. */
+{CFA_EXPRS - 40,   CFA_EXPRS},
+{CFA_EXPRS - 16,   0x1313},
+{CFA_EXPRS - 8,    ADDR_MIDDLE_RET},
+/*  middle: rbx at CFA-24, rbp at CFA-16. */
+{CFA_MIDDLE - 24,  0xb0b0},
+{CFA_MIDDLE - 16,  RBP_OUTER},
+{CFA_MIDDLE - 8,   ADDR_OUTER_RET},
+/*  Below lastcall and leaf, and sigframe. */
+{0x7ffe0000,       0xdead},
+{0x7ffe0008,       ADDR_OUTER_RET},
+{0x7ffd0000,       ADDR_MIDDLE_RET},
+{0,0}
+};
+
+/*  What the memory read function is given
+    as dw_user_data. */
+struct sample_s {
+    const struct mem_s *s_mem;
+    /*  If non-zero any address reads as itself
+        exclusive-or s_pattern. */
+    Dwarf_Unsigned      s_pattern;
+    unsigned            s_reads;
+};
+
+static int
+read_memory(void *user_data,Dwarf_Addr addr,
+    Dwarf_Unsigned size,Dwarf_Unsigned *value)
+{
+    struct sample_s *sample = (struct sample_s *)user_data;
+    const struct mem_s *m = 0;
+
+    sample->s_reads++;
+    if (size != 8) {
+        return DW_DLV_NO_ENTRY;
+    }
+    if (sample->s_pattern) {
+        *value = addr ^ sample->s_pattern;
+        return DW_DLV_OK;
+    }
+    for (m = sample->s_mem; m && m->m_addr; ++m) {
+        if (m->m_addr == addr) {
+            *value = m->m_value;
+            return DW_DLV_OK;
+        }
+    }
+    return DW_DLV_NO_ENTRY;
+}
+
+static Dwarf_Unwinder
+create_unwinder(Dwarf_Debug dbg)
+{
+    Dwarf_Unwinder uw = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_unwinder_create(dbg,read_memory,REG_RSP,
+        &uw,&err);
+    check_int("dwarf_unwinder_create",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        exit(EXIT_FAILURE);
+    }
+    return uw;
+}
+
+struct regs_s {
+    Dwarf_Unwind_Regs r_regs;
+    Dwarf_Unsigned    r_values[REG_COUNT];
+    Dwarf_Small       r_valid[REG_COUNT];
+};
+
+static void
+regs_init(struct regs_s *r,Dwarf_Addr pc,
+    Dwarf_Bool is_return_address)
+{
+    memset(r,0,sizeof(*r));
+    r->r_regs.ur_pc = pc;
+    r->r_regs.ur_pc_is_return_address = is_return_address;
+    r->r_regs.ur_reg_count = REG_COUNT;
+    r->r_regs.ur_values = r->r_values;
+    r->r_regs.ur_valid = r->r_valid;
+}
+
+static void
+regs_set(struct regs_s *r,unsigned reg,Dwarf_Unsigned value)
+{
+    r->r_values[reg] = value;
+    r->r_valid[reg] = 1;
+}
+
+/*  Expect reg to have value, or if known is
+    zero, to be unknown. */
+static void
+check_reg(const char *what,struct regs_s *r,unsigned reg,
+    int known,Dwarf_Unsigned value,int line)
+{
+    check_int(what,known,r->r_valid[reg],line);
+    if (known && r->r_valid[reg]) {
+        check_unsigned(what,value,r->r_values[reg],line);
+    }
+}
+
+/*  The innermost frame of the sample: stopped in leaf. */
+static void
+leaf_regs(struct regs_s *r)
+{
+    regs_init(r,ADDR_LEAF_PC,0);
+    regs_set(r,REG_RSP,SP_LEAF);
+    regs_set(r,REG_RBP,RBP_MIDDLE);
+    regs_set(r,REG_RBX,0x3333);
+    regs_set(r,REG_R12,0x1212);
+}
+
+/*  One frame at a time from leaf to the outermost. */
+static void
+test_steps(const char *obj)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Unwinder uw = 0;
+    Dwarf_Error err = 0;
+    struct sample_s sample;
+    struct regs_s leaf;
+    struct regs_s exprs;
+    struct regs_s middle;
+    struct regs_s outer;
+    struct regs_s none;
+    int pass = 0;
+    int res = 0;
+
+    dbg = open_obj(obj);
+    uw = create_unwinder(dbg);
+    memset(&sample,0,sizeof(sample));
+    sample.s_mem = stack_mem;
+    /*  The second pass uses the cached rows. */
+    for (pass = 0; pass < 2; ++pass) {
+        leaf_regs(&leaf);
+        regs_init(&exprs,0,0);
+        res = dwarf_unwind_step(uw,&sample,&leaf.r_regs,
+            &exprs.r_regs,&err);
+        check_int("leaf to exprs",DW_DLV_OK,res,__LINE__);
+        check_unsigned("exprs pc",ADDR_EXPRS_RET,
+            exprs.r_regs.ur_pc,__LINE__);
+        check_int("exprs pc is a return address",1,
+            exprs.r_regs.ur_pc_is_return_address != 0,__LINE__);
+        check_unsigned("leaf cfa",SP_LEAF+8,exprs.r_regs.ur_cfa,
+            __LINE__);
+        check_reg("exprs rsp",&exprs,REG_RSP,1,SP_LEAF+8,
+            __LINE__);
+        check_reg("exprs rbp",&exprs,REG_RBP,1,RBP_MIDDLE,
+            __LINE__);
+        check_reg("exprs rbx",&exprs,REG_RBX,1,0x3333,__LINE__);
+        check_reg("exprs r13",&exprs,REG_R13,0,0,__LINE__);
+
+        /*  DW_CFA_def_cfa_expression, DW_CFA_val_expression
+            and DW_CFA_expression. */
+        regs_init(&middle,0,0);
+        res = dwarf_unwind_step(uw,&sample,&exprs.r_regs,
+            &middle.r_regs,&err);
+        check_int("exprs to middle",DW_DLV_OK,res,__LINE__);
+        check_unsigned("middle pc",ADDR_MIDDLE_RET,
+            middle.r_regs.ur_pc,__LINE__);
+        check_unsigned("exprs cfa",CFA_EXPRS,
+            middle.r_regs.ur_cfa,__LINE__);
+        check_reg("middle rsp",&middle,REG_RSP,1,CFA_EXPRS,
+            __LINE__);
+        check_reg("middle r12",&middle,REG_R12,1,CFA_EXPRS+8,
+            __LINE__);
+        check_reg("middle r13",&middle,REG_R13,1,0x1313,
+            __LINE__);
+        check_reg("middle rbp",&middle,REG_RBP,1,RBP_MIDDLE,
+            __LINE__);
+
+        /*  CFA from rbp, saved rbp and rbx. */
+        regs_init(&outer,0,0);
+        res = dwarf_unwind_step(uw,&sample,&middle.r_regs,
+            &outer.r_regs,&err);
+        check_int("middle to outer",DW_DLV_OK,res,__LINE__);
+        check_unsigned("outer pc",ADDR_OUTER_RET,
+            outer.r_regs.ur_pc,__LINE__);
+        check_unsigned("middle cfa",CFA_MIDDLE,
+            outer.r_regs.ur_cfa,__LINE__);
+        check_reg("outer rsp",&outer,REG_RSP,1,CFA_MIDDLE,
+            __LINE__);
+        check_reg("outer rbp",&outer,REG_RBP,1,RBP_OUTER,
+            __LINE__);
+        check_reg("outer rbx",&outer,REG_RBX,1,0xb0b0,__LINE__);
+        check_reg("outer r12",&outer,REG_R12,1,CFA_EXPRS+8,
+            __LINE__);
+
+        /*  The return address is undefined. */
+        regs_init(&none,0,0);
+        res = dwarf_unwind_step(uw,&sample,&outer.r_regs,
+            &none.r_regs,&err);
+        check_int("outer has no caller",DW_DLV_NO_ENTRY,res,
+            __LINE__);
+    }
+    dwarf_dealloc_unwinder(uw);
+    dwarf_finish(dbg);
+}
+
+static void
+test_stack(const char *obj)
+{
+    static const Dwarf_Addr expect_pcs[4] = {
+        ADDR_LEAF_PC, ADDR_EXPRS_RET, ADDR_MIDDLE_RET,
+        ADDR_OUTER_RET };
+    Dwarf_Debug dbg = 0;
+    Dwarf_Unwinder uw = 0;
+    Dwarf_Error err = 0;
+    struct sample_s sample;
+    struct regs_s r;
+    Dwarf_Addr pcs[8];
+    Dwarf_Unsigned count = 0;
+    Dwarf_Unsigned i = 0;
+    int res = 0;
+
+    dbg = open_obj(obj);
+    uw = create_unwinder(dbg);
+    memset(&sample,0,sizeof(sample));
+    sample.s_mem = stack_mem;
+    leaf_regs(&r);
+    res = dwarf_unwind_stack(uw,&sample,&r.r_regs,pcs,8,
+        &count,&err);
+    check_int("dwarf_unwind_stack",DW_DLV_OK,res,__LINE__);
+    check_unsigned("frame count",4,count,__LINE__);
+    for (i = 0; i < count && i < 4; ++i) {
+        check_unsigned("stack pc",expect_pcs[i],pcs[i],__LINE__);
+    }
+    /*  Left with the registers of the outermost frame. */
+    check_unsigned("outermost pc",ADDR_OUTER_RET,r.r_regs.ur_pc,
+        __LINE__);
+    check_reg("outermost rbp",&r,REG_RBP,1,RBP_OUTER,__LINE__);
+    check_reg("outermost rbx",&r,REG_RBX,1,0xb0b0,__LINE__);
+
+    /*  Stops at dw_max_frames. */
+    leaf_regs(&r);
+    res = dwarf_unwind_stack(uw,&sample,&r.r_regs,pcs,2,
+        &count,&err);
+    check_int("two frames",DW_DLV_OK,res,__LINE__);
+    check_unsigned("two frames",2,count,__LINE__);
+    check_unsigned("two frames",ADDR_EXPRS_RET,pcs[1],__LINE__);
+    leaf_regs(&r);
+    res = dwarf_unwind_stack(uw,&sample,&r.r_regs,NULL,0,
+        &count,&err);
+    check_int("no frames",DW_DLV_OK,res,__LINE__);
+    check_unsigned("no frames",0,count,__LINE__);
+
+    /*  The stack is not all there. */
+    sample.s_mem = stack_mem+1;
+    leaf_regs(&r);
+    res = dwarf_unwind_stack(uw,&sample,&r.r_regs,pcs,8,
+        &count,&err);
+    check_int("no return address",DW_DLV_OK,res,__LINE__);
+    check_unsigned("no return address",1,count,__LINE__);
+    dwarf_dealloc_unwinder(uw);
+    dwarf_finish(dbg);
+
+    /*  Registers without a rule are now unknown in the
+        caller, so the rbp middle needs is lost. */
+    dbg = open_obj(obj);
+    dwarf_set_frame_rule_initial_value(dbg,DW_FRAME_UNDEFINED_VAL);
+    uw = create_unwinder(dbg);
+    sample.s_mem = stack_mem;
+    leaf_regs(&r);
+    res = dwarf_unwind_stack(uw,&sample,&r.r_regs,pcs,8,
+        &count,&err);
+    check_int("undefined initial rule",DW_DLV_OK,res,__LINE__);
+    check_unsigned("undefined initial rule",3,count,__LINE__);
+    check_reg("undefined initial rule rbx",&r,REG_RBX,0,0,
+        __LINE__);
+    /*  Freed by dwarf_finish(). */
+    dwarf_finish(dbg);
+}
+
+/*  Return addresses and signal frames. */
+static void
+test_pc_lookup(const char *obj)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Unwinder uw = 0;
+    Dwarf_Error err = 0;
+    struct sample_s sample;
+    struct regs_s callee;
+    struct regs_s caller;
+    int res = 0;
+
+    dbg = open_obj(obj);
+    uw = create_unwinder(dbg);
+    memset(&sample,0,sizeof(sample));
+    sample.s_mem = stack_mem;
+
+    /*  lastcall ends with its call to leaf, so the
+        return address is leaf itself. Its row is
+        the one for the call. */
+    regs_init(&callee,ADDR_LEAF,1);
+    regs_set(&callee,REG_RSP,0x7ffe0000);
+    regs_init(&caller,0,0);
+    res = dwarf_unwind_step(uw,&sample,&callee.r_regs,
+        &caller.r_regs,&err);
+    check_int("return to lastcall",DW_DLV_OK,res,__LINE__);
+    check_unsigned("lastcall cfa",0x7ffe0010,caller.r_regs.ur_cfa,
+        __LINE__);
+    check_unsigned("lastcall caller pc",ADDR_OUTER_RET,
+        caller.r_regs.ur_pc,__LINE__);
+
+    /*  The same pc where the sample stopped is in leaf. */
+    regs_init(&callee,ADDR_LEAF,0);
+    regs_set(&callee,REG_RSP,0x7ffe0000);
+    res = dwarf_unwind_step(uw,&sample,&callee.r_regs,
+        &caller.r_regs,&err);
+    check_int("stopped at leaf",DW_DLV_OK,res,__LINE__);
+    check_unsigned("leaf cfa",0x7ffe0008,caller.r_regs.ur_cfa,
+        __LINE__);
+    check_unsigned("leaf caller pc",0xdead,caller.r_regs.ur_pc,
+        __LINE__);
+
+    /*  Below a signal frame the pc is where the
+        signal arrived, not a return address. */
+    regs_init(&callee,ADDR_SIGFRAME+1,0);
+    regs_set(&callee,REG_RSP,0x7ffd0000);
+    res = dwarf_unwind_step(uw,&sample,&callee.r_regs,
+        &caller.r_regs,&err);
+    check_int("signal frame",DW_DLV_OK,res,__LINE__);
+    check_unsigned("signal frame caller pc",ADDR_MIDDLE_RET,
+        caller.r_regs.ur_pc,__LINE__);
+    check_int("signal frame caller pc is not a return address",
+        0,caller.r_regs.ur_pc_is_return_address,__LINE__);
+
+    /*  No FDE. */
+    regs_init(&callee,0x500000,0);
+    regs_set(&callee,REG_RSP,0x7ffe0000);
+    res = dwarf_unwind_step(uw,&sample,&callee.r_regs,
+        &caller.r_regs,&err);
+    check_int("pc without an FDE",DW_DLV_NO_ENTRY,res,__LINE__);
+
+    /*  No rsp, so no CFA. */
+    regs_init(&callee,ADDR_LEAF_PC,0);
+    res = dwarf_unwind_step(uw,&sample,&callee.r_regs,
+        &caller.r_regs,&err);
+    check_int("no rsp",DW_DLV_NO_ENTRY,res,__LINE__);
+    dwarf_dealloc_unwinder(uw);
+    dwarf_finish(dbg);
+}
+
+/*  At the first address of each function the
+    unwinder must agree with the frame table rows. */
+static void
+test_real_eh_frame(void)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Unwinder uw = 0;
+    Dwarf_Error err = 0;
+    Dwarf_Cie *cies = 0;
+    Dwarf_Fde *fdes = 0;
+    Dwarf_Signed cie_count = 0;
+    Dwarf_Signed fde_count = 0;
+    Dwarf_Signed i = 0;
+    struct sample_s sample;
+    unsigned checked = 0;
+    int res = 0;
+
+    dbg = open_obj("dummyexecutable");
+    uw = create_unwinder(dbg);
+    memset(&sample,0,sizeof(sample));
+    sample.s_pattern = 0x5a5a;
+    res = dwarf_get_fde_list_eh(dbg,&cies,&cie_count,
+        &fdes,&fde_count,&err);
+    check_int("dwarf_get_fde_list_eh",DW_DLV_OK,res,__LINE__);
+    for (i = 0; res == DW_DLV_OK && i < fde_count; ++i) {
+        Dwarf_Addr lowpc = 0;
+        Dwarf_Unsigned len = 0;
+        Dwarf_Small vtype = 0;
+        Dwarf_Unsigned offrel = 0;
+        Dwarf_Unsigned reg = 0;
+        Dwarf_Signed off = 0;
+        Dwarf_Block block;
+        Dwarf_Addr rowpc = 0;
+        Dwarf_Bool more = 0;
+        Dwarf_Addr nextpc = 0;
+        Dwarf_Addr cfa = 0;
+        struct regs_s callee;
+        struct regs_s caller;
+        int sres = 0;
+
+        dwarf_get_fde_range(fdes[i],&lowpc,&len,0,0,0,0,0,&err);
+        memset(&block,0,sizeof(block));
+        sres = dwarf_get_fde_info_for_cfa_reg3_c(fdes[i],lowpc,
+            &vtype,&offrel,&reg,&off,&block,&rowpc,&more,
+            &nextpc,&err);
+        check_int("cfa rule",DW_DLV_OK,sres,__LINE__);
+        if (vtype != DW_EXPR_OFFSET || reg != REG_RSP) {
+            continue;
+        }
+        cfa = 0x10000 + (Dwarf_Unsigned)off;
+        sres = dwarf_get_fde_info_for_reg3_c(fdes[i],REG_RA,
+            lowpc,&vtype,&offrel,&reg,&off,&block,&rowpc,&more,
+            &nextpc,&err);
+        check_int("return address rule",DW_DLV_OK,sres,
+            __LINE__);
+        if (vtype != DW_EXPR_OFFSET || !offrel) {
+            continue;
+        }
+        regs_init(&callee,lowpc,0);
+        regs_set(&callee,REG_RSP,0x10000);
+        regs_init(&caller,0,0);
+        sres = dwarf_unwind_step(uw,&sample,&callee.r_regs,
+            &caller.r_regs,&err);
+        check_int("dwarf_unwind_step",DW_DLV_OK,sres,__LINE__);
+        check_unsigned("cfa",cfa,caller.r_regs.ur_cfa,__LINE__);
+        check_unsigned("caller pc",
+            (cfa + (Dwarf_Unsigned)off) ^ sample.s_pattern,
+            caller.r_regs.ur_pc,__LINE__);
+        check_reg("caller rsp",&caller,REG_RSP,1,cfa,__LINE__);
+        ++checked;
+    }
+    if (res == DW_DLV_OK) {
+        dwarf_dealloc_fde_cie_list(dbg,cies,cie_count,
+            fdes,fde_count);
+    }
+    if (!checked) {
+        printf("FAIL no FDEs checked in dummyexecutable\n");
+        ++errcount;
+    }
+    dwarf_dealloc_unwinder(uw);
+    dwarf_finish(dbg);
+}
+
+static void
+test_errors(void)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Unwinder uw = 0;
+    Dwarf_Error err = 0;
+    struct sample_s sample;
+    struct regs_s r;
+    struct regs_s r2;
+    Dwarf_Addr pcs[2];
+    int res = 0;
+
+    memset(&sample,0,sizeof(sample));
+    dbg = open_obj("testunwindehLE64ELf.testme");
+    res = dwarf_unwinder_create(dbg,NULL,REG_RSP,&uw,&err);
+    check_int("create, NULL read_memory",DW_DLV_ERROR,res,
+        __LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(dbg,err);
+        err = 0;
+    }
+    res = dwarf_unwinder_create(dbg,read_memory,REG_RSP,NULL,
+        &err);
+    check_int("create, NULL unwinder_out",DW_DLV_ERROR,res,
+        __LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(dbg,err);
+        err = 0;
+    }
+    uw = create_unwinder(dbg);
+    leaf_regs(&r);
+    res = dwarf_unwind_step(uw,&sample,&r.r_regs,&r.r_regs,&err);
+    check_int("step, callee is caller",DW_DLV_ERROR,res,
+        __LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(dbg,err);
+        err = 0;
+    }
+    regs_init(&r2,0,0);
+    r2.r_regs.ur_valid = 0;
+    res = dwarf_unwind_step(uw,&sample,&r.r_regs,&r2.r_regs,&err);
+    check_int("step, NULL ur_valid",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(dbg,err);
+        err = 0;
+    }
+    res = dwarf_unwind_stack(uw,&sample,&r.r_regs,pcs,2,NULL,
+        &err);
+    check_int("stack, NULL frame_count",DW_DLV_ERROR,res,
+        __LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(dbg,err);
+        err = 0;
+    }
+    dwarf_dealloc_unwinder(uw);
+    /*  Harmless. */
+    dwarf_dealloc_unwinder(NULL);
+    res = dwarf_unwind_step(NULL,&sample,&r.r_regs,&r2.r_regs,
+        &err);
+    check_int("step, NULL unwinder",DW_DLV_ERROR,res,__LINE__);
+    if (res == DW_DLV_ERROR) {
+        dwarf_dealloc_error(NULL,err);
+        err = 0;
+    }
+    dwarf_finish(dbg);
+
+    /*  No frame tables at all. */
+    dbg = open_obj("testsupaltLE64ELf.testme");
+    res = dwarf_unwinder_create(dbg,read_memory,REG_RSP,&uw,
+        &err);
+    check_int("create, no FDEs",DW_DLV_NO_ENTRY,res,__LINE__);
+    dwarf_finish(dbg);
+}
+
+int
+main(int argc, char **argv)
+{
+    static const char *objects[] = {
+        "testunwindehLE64ELf.testme",
+        "testunwinddfLE64ELf.testme",
+        0 };
+    int i = 0;
+
+    testobj_srcdir(argc,argv);
+    for (i = 0; objects[i]; ++i) {
+        test_steps(objects[i]);
+        test_stack(objects[i]);
+        test_pc_lookup(objects[i]);
+    }
+    test_real_eh_frame();
+    test_errors();
+    testobj_exit("test_unwind");
+    return 0;
+}
@@ -0,0 +1,472 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Tests dwarf_var_index(), dwarf_var_index_at_pc() and
+    dwarf_var_index_at_pcs() on walk() of
+    testrangesLE64ELf4.testme and testrangesLE64ELf5.testme
+    (see testrangesLE64ELfsource.c).  Both have the same
+    code addresses. walk() has a hot part at 0x1060 and a
+    cold part at 0x1044, a lexical block over parts of both,
+    a nested block in the cold part and an inlined copy of
+    scale() with its own lexical block.
+    At each pc the variables live there, with their
+    expressions, are compared with those dwarfdump shows.
+    DWARF4 has DW_OP_GNU_entry_value where DWARF5 has
+    DW_OP_entry_value.
+
+    ./test_var_index -f <top source directory>
+    or set environment variable DWTOPSRCDIR. */
+
+#include <config.h>
+
+#include <stdio.h>  /* printf() */
+#include <string.h> /* strcmp() */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "testobj_util.h"
+
+#define TRUE 1
+#define FALSE 0
+
+#define VARS_MAX 10
+#define ENTRIES_MAX 100
+
+#define PARM DW_TAG_formal_parameter
+#define VAR  DW_TAG_variable
+
+/*  v_expr is the expression in hex, with "EV" standing
+    for the entry value operator of the object. */
+struct var_s {
+    const char *v_name;
+    Dwarf_Half  v_tag;
+    const char *v_expr;
+};
+
+struct point_s {
+    Dwarf_Addr   p_pc;
+    int          p_count;
+    struct var_s p_vars[VARS_MAX];
+};
+
+/*  In pc order in the function, not in address order,
+    as dwarf_var_index_at_pcs() does not need it sorted. */
+static const struct point_s points[] = {
+    /*  The entry of walk(), outside the blocks. */
+    { 0x1060, 5, {
+        { "a",     PARM, "55" },
+        { "n",     PARM, "54" },
+        { "total", VAR,  "309f" },
+        { "i",     VAR,  "309f" },
+        { "keep",  VAR,  "9148" } } },
+    /*  In the lexical block with s. */
+    { 0x1085, 6, {
+        { "a",     PARM, "EV01559f" },
+        { "n",     PARM, "5d" },
+        { "total", VAR,  "56" },
+        { "i",     VAR,  "7300EV01551c32259f" },
+        { "keep",  VAR,  "9148" },
+        { "s",     VAR,  "50" } } },
+    /*  In the inlined scale() and its lexical block. */
+    { 0x10aa, 8, {
+        { "a",     PARM, "EV01559f" },
+        { "n",     PARM, "5d" },
+        { "total", VAR,  "56" },
+        { "i",     VAR,  "7300EV01551c32259f" },
+        { "keep",  VAR,  "9148" },
+        { "v",     PARM, "7300" },
+        { "t",     VAR,  "51" },
+        { "u",     VAR,  "55" } } },
+    /*  Still in the inlined scale(), none of its
+        variables has a location here. */
+    { 0x10b5, 5, {
+        { "a",     PARM, "55" },
+        { "n",     PARM, "54" },
+        { "total", VAR,  "309f" },
+        { "i",     VAR,  "309f" },
+        { "keep",  VAR,  "9148" } } },
+    /*  The last byte of walk(). */
+    { 0x10db, 3, {
+        { "a",     PARM, "EV01559f" },
+        { "n",     PARM, "EV01549f" },
+        { "keep",  VAR,  "9148" } } },
+    /*  Past the end of walk(). */
+    { 0x10dc, 0, { { 0, 0, 0 } } },
+    /*  The cold part, in the block with s. */
+    { 0x1044, 6, {
+        { "a",     PARM, "EV01559f" },
+        { "n",     PARM, "5d" },
+        { "total", VAR,  "56" },
+        { "i",     VAR,  "7300EV01551c32259f" },
+        { "keep",  VAR,  "9148" },
+        { "s",     VAR,  "50" } } },
+    /*  In the nested block with r, s is gone. */
+    { 0x104c, 6, {
+        { "a",     PARM, "EV01559f" },
+        { "n",     PARM, "5d" },
+        { "total", VAR,  "56" },
+        { "i",     VAR,  "7300EV01551c32259f" },
+        { "keep",  VAR,  "9148" },
+        { "r",     VAR,  "50" } } },
+    /*  report(), just before the cold part. */
+    { 0x1040, 0, { { 0, 0, 0 } } },
+    /*  After the cold part. */
+    { 0x1052, 0, { { 0, 0, 0 } } }
+};
+#define POINT_COUNT (sizeof(points)/sizeof(points[0]))
+
+/*  Returns the level one subprogram named name
+    of the CU, or 0. */
+static Dwarf_Die
+find_function(Dwarf_Die cu_die,const char *name)
+{
+    Dwarf_Die cur = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_child(cu_die,&cur,&err);
+    while (res == DW_DLV_OK) {
+        Dwarf_Die sib = 0;
+        Dwarf_Half tag = 0;
+        char *diename = 0;
+
+        if (dwarf_tag(cur,&tag,&err) == DW_DLV_OK &&
+            tag == DW_TAG_subprogram &&
+            dwarf_diename(cur,&diename,&err) == DW_DLV_OK &&
+            !strcmp(diename,name)) {
+            return cur;
+        }
+        res = dwarf_siblingof_c(cur,&sib,&err);
+        dwarf_dealloc_die(cur);
+        cur = sib;
+    }
+    printf("FAIL no function %s\n",name);
+    ++errcount;
+    return 0;
+}
+
+/*  Returns the name of the DIE at offset, that of its
+    abstract origin for inlined variables, or "".
+    The string is section data. */
+static const char *
+var_name(Dwarf_Debug dbg,Dwarf_Off offset)
+{
+    Dwarf_Die die = 0;
+    Dwarf_Attribute attr = 0;
+    Dwarf_Off origin = 0;
+    Dwarf_Error err = 0;
+    char *diename = 0;
+    const char *name = "";
+    int res = 0;
+
+    res = dwarf_offdie_b(dbg,offset,TRUE,&die,&err);
+    if (res != DW_DLV_OK) {
+        return name;
+    }
+    res = dwarf_diename(die,&diename,&err);
+    if (res == DW_DLV_OK) {
+        dwarf_dealloc_die(die);
+        return diename;
+    }
+    res = dwarf_attr(die,DW_AT_abstract_origin,&attr,&err);
+    dwarf_dealloc_die(die);
+    if (res != DW_DLV_OK) {
+        return name;
+    }
+    res = dwarf_global_formref(attr,&origin,&err);
+    dwarf_dealloc_attribute(attr);
+    if (res == DW_DLV_OK) {
+        name = var_name(dbg,origin);
+    }
+    return name;
+}
+
+/*  TRUE if the expression bytes are those of hex. */
+static int
+expr_matches(const char *hex,Dwarf_Small *expr,
+    Dwarf_Unsigned len,Dwarf_Small ev_op)
+{
+    static const char digits[] = "0123456789abcdef";
+    Dwarf_Unsigned i = 0;
+
+    for (i = 0; i < len; ++i, hex += 2) {
+        unsigned v = 0;
+
+        if (!hex[0] || !hex[1]) {
+            return FALSE;
+        }
+        if (hex[0] == 'E' && hex[1] == 'V') {
+            v = ev_op;
+        } else {
+            v = (unsigned)(strchr(digits,hex[0]) - digits) * 16 +
+                (unsigned)(strchr(digits,hex[1]) - digits);
+        }
+        if (expr[i] != v) {
+            return FALSE;
+        }
+    }
+    return !hex[0];
+}
+
+/*  Checks the count entries of vx live at pt->p_pc
+    against pt. */
+static void
+check_entries(Dwarf_Debug dbg,Dwarf_Var_Index vx,
+    const struct point_s *pt,Dwarf_Unsigned *entries,
+    Dwarf_Unsigned count,Dwarf_Small ev_op,int srcline)
+{
+    int matched[VARS_MAX];
+    Dwarf_Unsigned i = 0;
+    int k = 0;
+
+    check_unsigned("entries at pc",pt->p_count,count,srcline);
+    for (k = 0; k < VARS_MAX; ++k) {
+        matched[k] = FALSE;
+    }
+    for (i = 0; i < count; ++i) {
+        Dwarf_Off offset = 0;
+        Dwarf_Half tag = 0;
+        Dwarf_Addr low = 0;
+        Dwarf_Addr high = 0;
+        Dwarf_Small *expr = 0;
+        Dwarf_Unsigned len = 0;
+        Dwarf_Expr_Program program = 0;
+        Dwarf_Error err = 0;
+        const char *name = 0;
+        int res = 0;
+
+        if (i && entries[i] <= entries[i-1]) {
+            printf("FAIL pc 0x%llx entries not ascending "
+                "line %d\n",(unsigned long long)pt->p_pc,srcline);
+            ++errcount;
+        }
+        res = dwarf_var_index_entry(vx,entries[i],&offset,&tag,
+            &low,&high,&expr,&len,&program,&err);
+        check_int("dwarf_var_index_entry",DW_DLV_OK,res,srcline);
+        if (res != DW_DLV_OK) {
+            continue;
+        }
+        if (pt->p_pc < low || pt->p_pc >= high) {
+            printf("FAIL pc 0x%llx not in entry 0x%llx-0x%llx "
+                "line %d\n",(unsigned long long)pt->p_pc,
+                (unsigned long long)low,(unsigned long long)high,
+                srcline);
+            ++errcount;
+        }
+        if (!program) {
+            printf("FAIL pc 0x%llx entry %llu has no program "
+                "line %d\n",(unsigned long long)pt->p_pc,
+                (unsigned long long)entries[i],srcline);
+            ++errcount;
+        }
+        name = var_name(dbg,offset);
+        for (k = 0; k < pt->p_count; ++k) {
+            const struct var_s *v = &pt->p_vars[k];
+
+            if (!matched[k] && !strcmp(v->v_name,name) &&
+                v->v_tag == tag &&
+                expr_matches(v->v_expr,expr,len,ev_op)) {
+                matched[k] = TRUE;
+                break;
+            }
+        }
+        if (k == pt->p_count) {
+            printf("FAIL pc 0x%llx unexpected entry %s tag 0x%x "
+                "line %d\n",(unsigned long long)pt->p_pc,name,
+                tag,srcline);
+            ++errcount;
+        }
+    }
+    for (k = 0; k < pt->p_count; ++k) {
+        if (!matched[k]) {
+            printf("FAIL pc 0x%llx missing %s %s line %d\n",
+                (unsigned long long)pt->p_pc,pt->p_vars[k].v_name,
+                pt->p_vars[k].v_expr,srcline);
+            ++errcount;
+        }
+    }
+}
+
+static void
+test_object(const char *objname,Dwarf_Small ev_op)
+{
+    Dwarf_Debug dbg = open_obj(objname);
+    Dwarf_Die cu_die = 0;
+    Dwarf_Die walk = 0;
+    Dwarf_Die scale = 0;
+    Dwarf_Var_Index vx = 0;
+    Dwarf_Var_Index vx2 = 0;
+    Dwarf_Off walk_offset = 0;
+    Dwarf_Off offset = 0;
+    Dwarf_Bool is_info = FALSE;
+    Dwarf_Unsigned entry_count = 0;
+    Dwarf_Addr pcs[POINT_COUNT];
+    Dwarf_Unsigned single[POINT_COUNT][VARS_MAX];
+    Dwarf_Unsigned single_count[POINT_COUNT];
+    Dwarf_Unsigned entries[ENTRIES_MAX];
+    Dwarf_Unsigned first[POINT_COUNT+1];
+    Dwarf_Unsigned total = 0;
+    Dwarf_Unsigned count = 0;
+    Dwarf_Error err = 0;
+    unsigned p = 0;
+    int res = 0;
+
+    printf("Object %s\n",objname);
+    res = dwarf_next_cu_header_e(dbg,TRUE,&cu_die,0,0,0,0,0,0,
+        0,0,0,0,&err);
+    check_int("dwarf_next_cu_header_e",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        dwarf_finish(dbg);
+        return;
+    }
+    walk = find_function(cu_die,"walk");
+    if (!walk) {
+        dwarf_dealloc_die(cu_die);
+        dwarf_finish(dbg);
+        return;
+    }
+    dwarf_dieoffset(walk,&walk_offset,&err);
+    res = dwarf_var_index(walk,&vx,&err);
+    check_int("dwarf_var_index",DW_DLV_OK,res,__LINE__);
+    if (res != DW_DLV_OK) {
+        dwarf_dealloc_die(walk);
+        dwarf_dealloc_die(cu_die);
+        dwarf_finish(dbg);
+        return;
+    }
+    /*  Built once: the same index again. */
+    res = dwarf_var_index(walk,&vx2,&err);
+    check_int("dwarf_var_index again",DW_DLV_OK,res,__LINE__);
+    check_int("same index",TRUE,vx == vx2,__LINE__);
+    res = dwarf_var_index_info(vx,&offset,&is_info,&entry_count,
+        &err);
+    check_int("dwarf_var_index_info",DW_DLV_OK,res,__LINE__);
+    check_unsigned("index die offset",walk_offset,offset,
+        __LINE__);
+    check_int("index is_info",TRUE,is_info,__LINE__);
+    check_unsigned("index entry count",30,entry_count,__LINE__);
+    res = dwarf_var_index_entry(vx,entry_count,0,0,0,0,0,0,0,
+        &err);
+    check_int("entry past the end",DW_DLV_NO_ENTRY,res,__LINE__);
+
+    for (p = 0; p < POINT_COUNT; ++p) {
+        const struct point_s *pt = &points[p];
+
+        pcs[p] = pt->p_pc;
+        single_count[p] = 0;
+        res = dwarf_var_index_at_pc(vx,pt->p_pc,single[p],
+            VARS_MAX,&single_count[p],&err);
+        if (!pt->p_count) {
+            check_int("dwarf_var_index_at_pc none",
+                DW_DLV_NO_ENTRY,res,__LINE__);
+            single_count[p] = 0;
+            continue;
+        }
+        check_int("dwarf_var_index_at_pc",DW_DLV_OK,res,
+            __LINE__);
+        if (res != DW_DLV_OK) {
+            single_count[p] = 0;
+            continue;
+        }
+        check_entries(dbg,vx,pt,single[p],single_count[p],ev_op,
+            __LINE__);
+    }
+
+    /*  Fewer slots than entries: the full count,
+        the first entries stored. */
+    res = dwarf_var_index_at_pc(vx,points[2].p_pc,entries,2,
+        &count,&err);
+    check_int("dwarf_var_index_at_pc short",DW_DLV_OK,res,
+        __LINE__);
+    check_unsigned("short count",points[2].p_count,count,
+        __LINE__);
+    check_unsigned("short first",single[2][0],entries[0],
+        __LINE__);
+    check_unsigned("short second",single[2][1],entries[1],
+        __LINE__);
+
+    /*  The batch query gives what the single queries do. */
+    res = dwarf_var_index_at_pcs(vx,pcs,POINT_COUNT,entries,
+        ENTRIES_MAX,first,&err);
+    check_int("dwarf_var_index_at_pcs",DW_DLV_OK,res,__LINE__);
+    if (res == DW_DLV_OK) {
+        for (p = 0; p < POINT_COUNT; ++p) {
+            Dwarf_Unsigned i = 0;
+
+            total += single_count[p];
+            check_unsigned("batch count",single_count[p],
+                first[p+1] - first[p],__LINE__);
+            if (first[p+1] - first[p] != single_count[p]) {
+                continue;
+            }
+            for (i = 0; i < single_count[p]; ++i) {
+                check_unsigned("batch entry",single[p][i],
+                    entries[first[p]+i],__LINE__);
+            }
+        }
+        check_unsigned("batch total",total,first[POINT_COUNT],
+            __LINE__);
+    }
+    /*  And the full total when entries is too short. */
+    res = dwarf_var_index_at_pcs(vx,pcs,POINT_COUNT,entries,3,
+        first,&err);
+    check_int("dwarf_var_index_at_pcs short",DW_DLV_OK,res,
+        __LINE__);
+    check_unsigned("batch short total",total,first[POINT_COUNT],
+        __LINE__);
+    check_unsigned("batch short first",single[0][0],entries[0],
+        __LINE__);
+    check_unsigned("batch short third",single[0][2],entries[2],
+        __LINE__);
+    dwarf_dealloc_die(walk);
+
+    /*  The abstract instance of scale() has no code. */
+    scale = find_function(cu_die,"scale");
+    if (scale) {
+        res = dwarf_var_index(scale,&vx2,&err);
+        check_int("dwarf_var_index abstract",DW_DLV_NO_ENTRY,res,
+            __LINE__);
+        dwarf_dealloc_die(scale);
+    }
+    dwarf_dealloc_die(cu_die);
+    dwarf_finish(dbg);
+}
+
+int
+main(int argc, char **argv)
+{
+    testobj_srcdir(argc,argv);
+    test_object("testrangesLE64ELf4.testme",DW_OP_GNU_entry_value);
+    test_object("testrangesLE64ELf5.testme",DW_OP_entry_value);
+    testobj_exit("test_var_index");
+    return 0;
+}
@@ -0,0 +1,48 @@
+; Part 2 of testaccelLE64ELf5a.testme (with part 1), used by
+; test_accel.c. LLVM IR rather than C because gcc writes
+; no .debug_names. See testaccelLE64ELfsource3.c for the
+; build commands.
+
+source_filename = "testaccelLE64ELfsource2.ll"
+target datalayout = "e-m:e-p270:32:32-p271:32:32-p272:64:64-i64:64-f80:128-n8:16:32:64-S128"
+target triple = "x86_64-pc-linux-gnu"
+
+%struct.point = type { i32, i32 }
+
+@accel_total = dso_local global i32 0, align 4, !dbg !0
+
+define dso_local i32 @accel_two(%struct.point* %p) !dbg !20 {
+entry:
+  call void @llvm.dbg.value(metadata %struct.point* %p, metadata !26, metadata !DIExpression()), !dbg !27
+  %x = getelementptr inbounds %struct.point, %struct.point* %p, i64 0, i32 0, !dbg !28
+  %v = load i32, i32* %x, align 4, !dbg !28
+  %c = load i32, i32* @accel_total, align 4, !dbg !28
+  %r = mul i32 %v, %c, !dbg !28
+  ret i32 %r, !dbg !28
+}
+
+declare void @llvm.dbg.value(metadata, metadata, metadata)
+
+!llvm.dbg.cu = !{!2}
+!llvm.module.flags = !{!10, !11}
+
+!0 = !DIGlobalVariableExpression(var: !1, expr: !DIExpression())
+!1 = distinct !DIGlobalVariable(name: "accel_total", scope: !2, file: !3, line: 3, type: !6, isLocal: false, isDefinition: true)
+!2 = distinct !DICompileUnit(language: DW_LANG_C99, file: !3, producer: "hand written", isOptimized: true, runtimeVersion: 0, emissionKind: FullDebug, globals: !5, nameTableKind: Default)
+!3 = !DIFile(filename: "testaccelLE64ELfsource2.ll", directory: "/tmp/accel")
+!5 = !{!0}
+!6 = !DIBasicType(name: "int", size: 32, encoding: DW_ATE_signed)
+!10 = !{i32 7, !"Dwarf Version", i32 5}
+!11 = !{i32 2, !"Debug Info Version", i32 3}
+!20 = distinct !DISubprogram(name: "accel_two", scope: !3, file: !3, line: 5, type: !21, scopeLine: 6, flags: DIFlagPrototyped, spFlags: DISPFlagDefinition | DISPFlagOptimized, unit: !2, retainedNodes: !25)
+!21 = !DISubroutineType(types: !22)
+!22 = !{!6, !23}
+!23 = !DIDerivedType(tag: DW_TAG_pointer_type, baseType: !24, size: 64)
+!24 = !DICompositeType(tag: DW_TAG_structure_type, name: "point", file: !3, line: 1, size: 64, elements: !29)
+!25 = !{!26}
+!26 = !DILocalVariable(name: "p", arg: 1, scope: !20, file: !3, line: 5, type: !23)
+!27 = !DILocation(line: 0, scope: !20)
+!28 = !DILocation(line: 7, scope: !20)
+!29 = !{!30, !31}
+!30 = !DIDerivedType(tag: DW_TAG_member, name: "x", scope: !24, file: !3, line: 1, baseType: !6, size: 32)
+!31 = !DIDerivedType(tag: DW_TAG_member, name: "y", scope: !24, file: !3, line: 1, baseType: !6, size: 32, offset: 32)
@@ -0,0 +1,61 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Part 3 of testaccelLE64ELf5b.testme, used by test_accel.c.
+    Parts 1 and 2 are testaccelLE64ELfsource1.ll and
+    testaccelLE64ELfsource2.ll, LLVM IR for llc 14, which
+    writes .debug_names and .debug_aranges when asked.
+    gcc writes .debug_aranges but no .debug_names; its
+    .debug_aranges is removed here too. Built on x86_64:
+    llc -O2 -filetype=obj -relocation-model=pic \
+        -accel-tables=Dwarf -generate-arange-section \
+        testaccelLE64ELfsource1.ll -o part1.o
+    and the same for part2.o, then
+    gcc -O2 -gdwarf-5 -fPIC -c testaccelLE64ELfsource3.c \
+        -o part3.o
+    objcopy --remove-section .debug_aranges \
+        --remove-section .rela.debug_aranges part3.o
+    ld -shared part1.o part2.o -o testaccelLE64ELf5a.testme
+    ld -shared part1.o part3.o -o testaccelLE64ELf5b.testme
+    So the first has .debug_names and .debug_aranges
+    for both of its units, the second only for
+    its first unit. */
+
+struct point { int x; int y; };
+
+int accel_scale = 3;
+
+int
+accel_three(struct point *p)
+{
+    return p->x * accel_scale;
+}
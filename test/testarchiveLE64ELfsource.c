@@ -0,0 +1,65 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  The source of the members of testarchiveLE64ELf.a,
+    testarchiveLE64ELfbsd.a and testarchivetruncLE64ELf.a,
+    used by test_archive.c. Built with gcc 12, GNU ar 2.40
+    and llvm-ar 14 on x86_64:
+    gcc -O2 -gdwarf-5 -DPART=1 -c testarchiveLE64ELfsource.c \
+        -o testarchive_first_part.o
+    gcc -O2 -gdwarf-4 -DPART=2 -c testarchiveLE64ELfsource.c \
+        -o second.o
+    echo "not an object" > notes.txt
+    ar rcs testarchiveLE64ELf.a testarchive_first_part.o \
+        second.o notes.txt
+    llvm-ar rcs --format=bsd testarchiveLE64ELfbsd.a \
+        testarchive_first_part.o second.o notes.txt
+    head -c 3046 testarchiveLE64ELf.a > testarchivetruncLE64ELf.a
+    The first member name is too long for the ar header,
+    so it is a GNU // long name in the first archive and a
+    BSD #1/ name in the second. Both have a symbol index.
+    The third archive ends inside the header of its
+    second member. */
+
+#if PART == 1
+int
+archive_first(int v)
+{
+    return v + 1;
+}
+#else
+int
+archive_second(int v)
+{
+    return v * 2;
+}
+#endif
@@ -0,0 +1,156 @@
+/*
+  Copyright (c) 2026, David Anderson
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with
+  or without modification, are permitted provided that the
+  following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  The source of the testcheckcacheLE64ELf*.testme
+    objects used by test_checkcache.sh.
+    Each object has three CUs, all built from this file
+    with gcc 12 on x86_64:
+    gcc -O2 -gdwarf-4 -ffunction-sections -c -DPART=1 \
+        testcheckcacheLE64ELfsource.c -o part1.o
+    and the same with -DPART=2 and -DPART=3, then
+    ld -r part1.o part2.o part3.o \
+        -o testcheckcacheLE64ELf4a.testme
+    testcheckcacheLE64ELf4b.testme is the same but
+    with -DCHANGED added for part2.o only, so its
+    second CU has more strings, code, location lists
+    and line table rows, moving what the third CU
+    has in the shared sections.
+    The 5a and 5b objects are built the same way
+    with -gdwarf-5. */
+
+extern int external_accumulator_function(int);
+extern volatile int checkcache_sink;
+
+#if PART == 1
+struct first_part_record {
+    int first_part_count;
+    long first_part_total;
+};
+
+int
+first_part_walker(struct first_part_record *record, int limit)
+{
+    int first_part_index = 0;
+    long first_part_sum = 0;
+
+    for ( ; first_part_index < limit; ++first_part_index) {
+        first_part_sum += external_accumulator_function(
+            first_part_index);
+    }
+    record->first_part_count = limit;
+    record->first_part_total = first_part_sum;
+    return (int)first_part_sum;
+}
+#endif /* PART == 1 */
+
+#if PART == 2
+struct second_part_record {
+    int second_part_count;
+#ifdef CHANGED
+    long second_part_extra_changed_member;
+#endif /* CHANGED */
+};
+
+int
+second_part_walker(struct second_part_record *record, int limit)
+{
+    int second_part_index = 0;
+    int second_part_sum = 0;
+
+    for ( ; second_part_index < limit; ++second_part_index) {
+        second_part_sum += external_accumulator_function(
+            second_part_index);
+    }
+    record->second_part_count = second_part_sum;
+#ifdef CHANGED
+    {
+        long second_part_changed_local = second_part_sum;
+
+        while (second_part_changed_local > 3) {
+            second_part_changed_local =
+                external_accumulator_function(
+                (int)second_part_changed_local / 2);
+            checkcache_sink = (int)second_part_changed_local;
+        }
+        record->second_part_extra_changed_member =
+            second_part_changed_local;
+    }
+#endif /* CHANGED */
+    return second_part_sum;
+}
+#endif /* PART == 2 */
+
+#if PART == 3
+struct third_part_record {
+    int third_part_count;
+    long third_part_total;
+};
+
+static inline int
+third_part_scale(int third_part_value)
+{
+    int third_part_scaled = third_part_value * 3;
+
+    if (third_part_scaled > 100) {
+        checkcache_sink = third_part_scaled;
+        return external_accumulator_function(third_part_scaled);
+    }
+    return third_part_scaled + 1;
+}
+
+__attribute__((cold,noinline)) static int
+third_part_report(int third_part_value)
+{
+    checkcache_sink = third_part_value;
+    return external_accumulator_function(third_part_value) + 2;
+}
+
+int
+third_part_walker(struct third_part_record *record, int limit)
+{
+    int third_part_index = 0;
+    long third_part_sum = 0;
+
+    for ( ; third_part_index < limit; ++third_part_index) {
+        int third_part_step = third_part_scale(third_part_index);
+
+        if (__builtin_expect(third_part_step < 0,0)) {
+            third_part_sum += third_part_report(third_part_step);
+        } else {
+            third_part_sum += third_part_step;
+        }
+    }
+    record->third_part_count = limit;
+    record->third_part_total = third_part_sum;
+    return (int)third_part_sum;
+}
+#endif /* PART == 3 */
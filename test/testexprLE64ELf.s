@@ -0,0 +1,339 @@
+# The object file for test_expr_eval.c: two DWARF5 CUs,
+# one with 8 byte and one with 4 byte addresses, whose
+# variables are named for the expression test case
+# in their DW_AT_location.  Built with:
+#   as --64 -o testexprLE64ELf.testme testexprLE64ELf.s
+    .section .debug_abbrev,"",@progbits
+    .uleb128 1
+    .uleb128 0x11      # DW_TAG_compile_unit
+    .byte 1
+    .uleb128 0x03      # DW_AT_name
+    .uleb128 0x08      # DW_FORM_string
+    .byte 0,0
+    .uleb128 2
+    .uleb128 0x34      # DW_TAG_variable
+    .byte 0
+    .uleb128 0x03      # DW_AT_name
+    .uleb128 0x08      # DW_FORM_string
+    .uleb128 0x02      # DW_AT_location
+    .uleb128 0x18      # DW_FORM_exprloc
+    .byte 0,0
+    .byte 0
+
+    .section .debug_info,"",@progbits
+.Lcu8:
+    .long .Lcu8end - .Lcu8start
+.Lcu8start:
+    .value 5
+    .byte 0x01         # DW_UT_compile
+    .byte 8
+    .long 0
+    .uleb128 1
+    .string "expr8.c"
+    .uleb128 2
+    .string "minus"
+    .uleb128 3         # lit5 lit3 minus
+    .byte 0x35,0x33,0x1c
+    .uleb128 2
+    .string "minus wraps"
+    .uleb128 3         # lit3 lit5 minus
+    .byte 0x33,0x35,0x1c
+    .uleb128 2
+    .string "signed div"
+    .uleb128 4         # const1s -8 lit2 div
+    .byte 0x09,0xf8,0x32,0x1b
+    .uleb128 2
+    .string "div by -1"
+    .uleb128 5         # const1s -8 const1s -1 div
+    .byte 0x09,0xf8,0x09,0xff,0x1b
+    .uleb128 2
+    .string "mod"
+    .uleb128 3         # lit7 lit3 mod
+    .byte 0x37,0x33,0x1d
+    .uleb128 2
+    .string "shl"
+    .uleb128 3         # lit1 lit4 shl
+    .byte 0x31,0x34,0x24
+    .uleb128 2
+    .string "shr"
+    .uleb128 4         # const1u 0x80 lit4 shr
+    .byte 0x08,0x80,0x34,0x25
+    .uleb128 2
+    .string "shra"
+    .uleb128 4         # const1s -16 lit2 shra
+    .byte 0x09,0xf0,0x32,0x26
+    .uleb128 2
+    .string "rot"
+    .uleb128 4         # lit1 lit2 lit3 rot
+    .byte 0x31,0x32,0x33,0x17
+    .uleb128 2
+    .string "rot drop drop"
+    .uleb128 6         # lit1 lit2 lit3 rot drop drop
+    .byte 0x31,0x32,0x33,0x17,0x13,0x13
+    .uleb128 2
+    .string "swap"
+    .uleb128 3         # lit1 lit2 swap
+    .byte 0x31,0x32,0x16
+    .uleb128 2
+    .string "over"
+    .uleb128 3         # lit1 lit2 over
+    .byte 0x31,0x32,0x14
+    .uleb128 2
+    .string "pick"
+    .uleb128 5         # lit5 lit6 lit7 pick 2
+    .byte 0x35,0x36,0x37,0x15,0x02
+    .uleb128 2
+    .string "dup mul"
+    .uleb128 3         # lit4 dup mul
+    .byte 0x34,0x12,0x1e
+    .uleb128 2
+    .string "abs"
+    .uleb128 3         # const1s -5 abs
+    .byte 0x09,0xfb,0x19
+    .uleb128 2
+    .string "neg"
+    .uleb128 2         # lit5 neg
+    .byte 0x35,0x1f
+    .uleb128 2
+    .string "not"
+    .uleb128 2         # lit0 not
+    .byte 0x30,0x20
+    .uleb128 2
+    .string "and or xor"
+    .uleb128 9         # const1u 0xf lit12 and lit1 or const1u 0xff xor
+    .byte 0x08,0x0f,0x3c,0x1a,0x31,0x21,0x08,0xff,0x27
+    .uleb128 2
+    .string "lt is signed"
+    .uleb128 4         # const1s -1 lit0 lt
+    .byte 0x09,0xff,0x30,0x2d
+    .uleb128 2
+    .string "ge"
+    .uleb128 3         # lit3 lit4 ge
+    .byte 0x33,0x34,0x2a
+    .uleb128 2
+    .string "gt"
+    .uleb128 3         # lit4 lit3 gt
+    .byte 0x34,0x33,0x2b
+    .uleb128 2
+    .string "le"
+    .uleb128 3         # lit4 lit3 le
+    .byte 0x34,0x33,0x2c
+    .uleb128 2
+    .string "eq"
+    .uleb128 3         # lit3 lit3 eq
+    .byte 0x33,0x33,0x29
+    .uleb128 2
+    .string "ne"
+    .uleb128 3         # lit3 lit4 ne
+    .byte 0x33,0x34,0x2e
+    .uleb128 2
+    .string "bra taken"
+    .uleb128 9         # lit1 bra +4 lit7 skip +1 lit9
+    .byte 0x31,0x28,0x04,0x00,0x37,0x2f,0x01,0x00,0x39
+    .uleb128 2
+    .string "bra not taken"
+    .uleb128 9         # lit0 bra +4 lit7 skip +1 lit9
+    .byte 0x30,0x28,0x04,0x00,0x37,0x2f,0x01,0x00,0x39
+    .uleb128 2
+    .string "count down loop"
+    .uleb128 7         # lit3 1: lit1 minus dup bra 1b
+    .byte 0x33,0x31,0x1c,0x12,0x28,0xfa,0xff
+    .uleb128 2
+    .string "plus_uconst"
+    .uleb128 4         # lit5 plus_uconst 128
+    .byte 0x35,0x23,0x80,0x01
+    .uleb128 2
+    .string "constu consts plus"
+    .uleb128 7         # constu 624485 consts -1 plus
+    .byte 0x10,0xe5,0x8e,0x26,0x11,0x7f,0x22
+    .uleb128 2
+    .string "nop"
+    .uleb128 2         # nop lit5
+    .byte 0x96,0x35
+    .uleb128 2
+    .string "breg6"
+    .uleb128 2         # breg6 16
+    .byte 0x76,0x10
+    .uleb128 2
+    .string "breg7 negative"
+    .uleb128 2         # breg7 -8
+    .byte 0x77,0x78
+    .uleb128 2
+    .string "bregx"
+    .uleb128 3         # bregx 40 8
+    .byte 0x92,0x28,0x08
+    .uleb128 2
+    .string "breg then plus"
+    .uleb128 4         # breg6 0 lit2 plus
+    .byte 0x76,0x00,0x32,0x22
+    .uleb128 2
+    .string "fbreg"
+    .uleb128 2         # fbreg -8
+    .byte 0x91,0x78
+    .uleb128 2
+    .string "fbreg copy"
+    .uleb128 2         # fbreg -8, the same bytes again
+    .byte 0x91,0x78
+    .uleb128 2
+    .string "reg3"
+    .uleb128 1         # reg3
+    .byte 0x53
+    .uleb128 2
+    .string "regx"
+    .uleb128 2         # regx 40
+    .byte 0x90,0x28
+    .uleb128 2
+    .string "addr"
+    .uleb128 9         # addr 0x1234
+    .byte 0x03,0x34,0x12,0x00,0x00,0x00,0x00,0x00,0x00
+    .uleb128 2
+    .string "call_frame_cfa"
+    .uleb128 1         # call_frame_cfa
+    .byte 0x9c
+    .uleb128 2
+    .string "push_object_address"
+    .uleb128 3         # push_object_address plus_uconst 8
+    .byte 0x97,0x23,0x08
+    .uleb128 2
+    .string "deref"
+    .uleb128 3         # breg7 0 deref
+    .byte 0x77,0x00,0x06
+    .uleb128 2
+    .string "deref_size"
+    .uleb128 4         # breg7 0 deref_size 2
+    .byte 0x77,0x00,0x94,0x02
+    .uleb128 2
+    .string "stack_value"
+    .uleb128 2         # lit5 stack_value
+    .byte 0x35,0x9f
+    .uleb128 2
+    .string "form_tls_address"
+    .uleb128 3         # const1u 16 form_tls_address
+    .byte 0x08,0x10,0x9b
+    .uleb128 2
+    .string "implicit_pointer"
+    .uleb128 6         # implicit_pointer 0x12345678 8
+    .byte 0xa0,0x78,0x56,0x34,0x12,0x08
+    .uleb128 2
+    .string "empty"
+    .uleb128 0         # no operations
+    .uleb128 2
+    .string "missing register"
+    .uleb128 3         # bregx 99 0
+    .byte 0x92,0x63,0x00
+    .uleb128 2
+    .string "missing register in stack machine"
+    .uleb128 5         # bregx 99 0 lit2 plus
+    .byte 0x92,0x63,0x00,0x32,0x22
+    .uleb128 2
+    .string "unreadable memory"
+    .uleb128 2         # lit0 deref
+    .byte 0x30,0x06
+    .uleb128 2
+    .string "entry_value"
+    .uleb128 4         # entry_value(reg5) stack_value
+    .byte 0xa3,0x01,0x55,0x9f
+    .uleb128 2
+    .string "call4"
+    .uleb128 5         # call4 0
+    .byte 0x99,0x00,0x00,0x00,0x00
+    .uleb128 2
+    .string "stack underflow"
+    .uleb128 1         # plus
+    .byte 0x22
+    .uleb128 2
+    .string "div by zero"
+    .uleb128 3         # lit1 lit0 div
+    .byte 0x31,0x30,0x1b
+    .uleb128 2
+    .string "mod by zero"
+    .uleb128 3         # lit1 lit0 mod
+    .byte 0x31,0x30,0x1d
+    .uleb128 2
+    .string "stack_value not last"
+    .uleb128 3         # lit1 stack_value lit2
+    .byte 0x31,0x9f,0x32
+    .uleb128 2
+    .string "reg not last"
+    .uleb128 2         # reg0 lit1
+    .byte 0x50,0x31
+    .uleb128 2
+    .string "endless loop"
+    .uleb128 3         # 1: skip 1b
+    .byte 0x2f,0xfd,0xff
+    .uleb128 2
+    .string "branch into an operator"
+    .uleb128 6         # lit1 bra +1 const1u 5
+    .byte 0x31,0x28,0x01,0x00,0x08,0x05
+    .uleb128 2
+    .string "branch into another piece"
+    .uleb128 10         # lit1 bra +3 reg0 piece 4 lit5 piece 4
+    .byte 0x31,0x28,0x03,0x00,0x50,0x93,0x04,0x35,0x93,0x04
+    .uleb128 2
+    .string "piece of size zero"
+    .uleb128 3         # reg0 piece 0
+    .byte 0x50,0x93,0x00
+    .uleb128 2
+    .string "operations after the last piece"
+    .uleb128 4         # reg0 piece 4 lit1
+    .byte 0x50,0x93,0x04,0x31
+    .uleb128 2
+    .string "pieces"
+    .uleb128 14         # reg0 piece 4, piece 4, fbreg 8 piece 8, lit5 stack_value bit_piece 3 2
+    .byte 0x50,0x93,0x04,0x93,0x04,0x91,0x08,0x93,0x08,0x35,0x9f,0x9d,0x03,0x02
+    .uleb128 2
+    .string "implicit_value"
+    .uleb128 6         # implicit_value 4 01020304
+    .byte 0x9e,0x04,0x01,0x02,0x03,0x04
+    .uleb128 2
+    .string "deref below memory"
+    .uleb128 6         # const1u 64 consts 64 plus deref
+    .byte 0x08,0x40,0x11,0x40,0x22,0x06
+    .uleb128 2
+    .string "member"
+    .uleb128 2         # plus_uconst 8
+    .byte 0x23,0x08
+    .uleb128 2
+    .string "64 values"
+    .uleb128 64         # lit1, 64 times
+    .byte 0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31
+    .byte 0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31
+    .byte 0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31
+    .byte 0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31
+    .uleb128 2
+    .string "65 values"
+    .uleb128 65         # lit1, 65 times
+    .byte 0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31
+    .byte 0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31
+    .byte 0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31
+    .byte 0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31,0x31
+    .byte 0x31
+    .byte 0
+.Lcu8end:
+.Lcu4:
+    .long .Lcu4end - .Lcu4start
+.Lcu4start:
+    .value 5
+    .byte 0x01         # DW_UT_compile
+    .byte 4
+    .long 0
+    .uleb128 1
+    .string "expr4.c"
+    .uleb128 2
+    .string "minus address size 4"
+    .uleb128 3         # lit0 lit1 minus
+    .byte 0x30,0x31,0x1c
+    .uleb128 2
+    .string "shra address size 4"
+    .uleb128 4         # const1s -16 lit2 shra
+    .byte 0x09,0xf0,0x32,0x26
+    .uleb128 2
+    .string "addr address size 4"
+    .uleb128 5         # addr 0x1234
+    .byte 0x03,0x34,0x12,0x00,0x00
+    .uleb128 2
+    .string "deref address size 4"
+    .uleb128 3         # breg7 0 deref
+    .byte 0x77,0x00,0x06
+    .byte 0
+.Lcu4end:
@@ -0,0 +1,66 @@
+/*
+  Copyright (c) 2026, David Anderson
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with
+  or without modification, are permitted provided that the
+  following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  The source of testlineindexLE64ELf5.testme,
+    used by test_line_index.c.  Built with gcc 12
+    on x86_64 in /tmp/lineindex, which has an empty
+    subdirectory sub:
+    gcc -O2 -gdwarf-5 -fPIC -c -DPART=1 \
+        testlineindexLE64ELfsource.c -o part1.o
+    gcc -O2 -gdwarf-5 -fPIC -c -DPART=2 \
+        ./sub/../testlineindexLE64ELfsource.c -o part2.o
+    gcc -shared -nostdlib part1.o part2.o \
+        -o testlineindexLE64ELf5.testme
+    So there are two CUs naming this file differently,
+    each with its own copy of common_scale(). */
+
+extern int lineindex_ext(int);
+
+static __attribute__((noinline)) int
+common_scale(int v)
+{
+    return lineindex_ext(v * 3) + 1;
+}
+
+#if PART == 1
+int
+lineindex_first(int v)
+{
+    return common_scale(v) + 2;
+}
+#else /* PART == 2 */
+int
+lineindex_second(int v)
+{
+    return common_scale(v) - 2;
+}
+#endif /* PART */
@@ -0,0 +1,75 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  The source of testmacroLE64ELf4.testme and
+    testmacroLE64ELf5.testme, used by test_macro_state.c.
+    Built with gcc 12 on x86_64:
+    gcc -O0 -g3 -gdwarf-5 -fPIC -shared -nostdlib \
+        testmacroLE64ELfsource.c -o testmacroLE64ELf5.testme
+    gcc -O0 -g3 -gdwarf-4 -gstrict-dwarf -fPIC -shared \
+        -nostdlib testmacroLE64ELfsource.c \
+        -o testmacroLE64ELf4.testme
+    so the first has .debug_macro, the second
+    .debug_macinfo. They are linked so that the
+    .debug_macro units gcc imports are in one section. With the predefined macros, those
+    of limits.h and stdint.h come to more than 512
+    operations, so the defines after the includes are
+    past the first saved state of dwarf_macro_state().
+    The test depends on the line numbers here. */
+
+#define SHAPE_SIDES 3
+#define SHAPE_NAME "triangle"
+#define SHAPE_AREA(b,h) ((b)*(h)/2)
+
+#include <limits.h>
+#include <stdint.h>
+
+#undef SHAPE_SIDES
+#define SHAPE_SIDES 4
+#undef SHAPE_NAME
+#define SHAPE_NAME "square"
+
+int
+shape_sides(void)
+{
+    return SHAPE_SIDES + SHAPE_AREA(2,INT8_MAX);
+}
+
+#undef SHAPE_AREA
+#undef SHAPE_SIDES
+#define SHAPE_SIDES 5
+
+const char *
+shape_name(void)
+{
+    return SHAPE_NAME;
+}
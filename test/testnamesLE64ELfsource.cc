@@ -0,0 +1,81 @@
+/*
+  Copyright (c) 2026, David Anderson
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with
+  or without modification, are permitted provided that the
+  following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  The source of testnamesLE64ELf4.testme and
+    testnamesLE64ELf5.testme, used by test_die_names.c.
+    Built with g++ 12 on x86_64:
+    g++ -O2 -gdwarf-4 -fno-eliminate-unused-debug-types \
+        -c testnamesLE64ELfsource.cc -o testnamesLE64ELf4.testme
+    and the same with -gdwarf-5 for testnamesLE64ELf5.testme. */
+
+namespace outer {
+namespace inner {
+class Widget {
+public:
+    int value;
+    int get() const;
+    static int count;
+    enum class Mode { Off, On };
+    Mode mode;
+};
+
+int Widget::count = 3;
+
+int
+Widget::get() const
+{
+    return value + count;
+}
+} /* namespace inner */
+
+static inline int
+twice(int x)
+{
+    return x * 2;
+}
+
+int
+use(inner::Widget *w)
+{
+    return twice(w->get());
+}
+} /* namespace outer */
+
+namespace {
+int hidden = 7;
+}
+
+int
+file_scope(int v)
+{
+    return outer::use(0) + v + hidden;
+}
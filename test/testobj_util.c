@@ -0,0 +1,163 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  The fixture and check functions shared by the
+    tests that read the objects in test/.
+    See testobj_util.h. */
+
+#include <config.h>
+
+#include <stdio.h>  /* printf() */
+#include <stdlib.h> /* exit() getenv() */
+#include <string.h> /* strcmp() strcpy() strlen() */
+
+#include "dwarf.h"
+#include "libdwarf.h"
+#include "testobj_util.h"
+
+int errcount;
+static const char *srcdir;
+static char pathbuf[2000];
+
+void
+testobj_srcdir(int argc,char **argv)
+{
+    if (argc > 2 && !strcmp(argv[1],"-f")) {
+        srcdir = argv[2];
+    } else {
+        srcdir = getenv("DWTOPSRCDIR");
+    }
+    if (!srcdir) {
+        printf("Expected -f <path> or environment variable "
+            "DWTOPSRCDIR with the base source directory\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static const char *
+build_path(const char *dir,const char *name)
+{
+    size_t len = strlen(srcdir);
+    size_t dlen = strlen(dir);
+
+    if (len + dlen + strlen(name) + 2 > sizeof(pathbuf)) {
+        printf("FAIL source path too long: %s\n",srcdir);
+        exit(EXIT_FAILURE);
+    }
+    strcpy(pathbuf,srcdir);
+    pathbuf[len] = '/';
+    strcpy(pathbuf+len+1,dir);
+    strcpy(pathbuf+len+1+dlen,name);
+    return pathbuf;
+}
+
+const char *
+test_obj_path(const char *name)
+{
+    return build_path("test/",name);
+}
+
+const char *
+test_src_path(const char *relpath)
+{
+    return build_path("",relpath);
+}
+
+Dwarf_Debug
+open_obj(const char *name)
+{
+    Dwarf_Debug dbg = 0;
+    Dwarf_Error err = 0;
+    int res = 0;
+
+    res = dwarf_init_path(test_obj_path(name),0,0,
+        DW_GROUPNUMBER_ANY,0,0,&dbg,&err);
+    if (res != DW_DLV_OK) {
+        printf("FAIL cannot open %s\n",pathbuf);
+        if (res == DW_DLV_ERROR) {
+            dwarf_dealloc_error(dbg,err);
+        }
+        exit(EXIT_FAILURE);
+    }
+    return dbg;
+}
+
+void
+check_int(const char *msg,int expect,int got,int line)
+{
+    if (got == expect) {
+        return;
+    }
+    printf("FAIL %s expected %d got %d test line %d\n",
+        msg,expect,got,line);
+    ++errcount;
+}
+
+void
+check_unsigned(const char *msg,Dwarf_Unsigned expect,
+    Dwarf_Unsigned got,int line)
+{
+    if (got == expect) {
+        return;
+    }
+    printf("FAIL %s expected %llu (0x%llx) got %llu (0x%llx)"
+        " test line %d\n",
+        msg,(unsigned long long)expect,(unsigned long long)expect,
+        (unsigned long long)got,(unsigned long long)got,line);
+    ++errcount;
+}
+
+void
+check_string(const char *msg,const char *expect,
+    const char *got,int line)
+{
+    if (!expect && !got) {
+        return;
+    }
+    if (expect && got && !strcmp(expect,got)) {
+        return;
+    }
+    printf("FAIL %s expected \"%s\" got \"%s\" test line %d\n",
+        msg,expect?expect:"(null)",got?got:"(null)",line);
+    ++errcount;
+}
+
+void
+testobj_exit(const char *testname)
+{
+    if (errcount) {
+        printf("FAIL %s %d failures\n",testname,errcount);
+        exit(EXIT_FAILURE);
+    }
+    printf("PASS %s\n",testname);
+    exit(0);
+}
@@ -0,0 +1,68 @@
+/*
+Copyright (c) 2026, David Anderson
+All rights reserved.
+
+Redistribution and use in source and binary forms, with
+or without modification, are permitted provided that the
+following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  Shared by the tests that link libdwarf and read the
+    objects in test/. Include after libdwarf.h.
+    A check that fails prints a FAIL line and counts
+    in errcount; testobj_exit() reports the total. */
+
+#ifndef TESTOBJ_UTIL_H
+#define TESTOBJ_UTIL_H
+
+extern int errcount;
+
+/*  Takes the top source directory from -f <path>
+    or from the environment variable DWTOPSRCDIR.
+    Exits if neither is present. */
+void testobj_srcdir(int argc,char **argv);
+
+/*  The path of name in test/, in a static buffer
+    that the next call overwrites. */
+const char *test_obj_path(const char *name);
+/*  As test_obj_path() for a path relative to the
+    top source directory. */
+const char *test_src_path(const char *relpath);
+
+/*  dwarf_init_path() on test/name. Exits on failure. */
+Dwarf_Debug open_obj(const char *name);
+
+void check_int(const char *msg,int expect,int got,int line);
+void check_unsigned(const char *msg,Dwarf_Unsigned expect,
+    Dwarf_Unsigned got,int line);
+/*  Two NULL strings are equal. */
+void check_string(const char *msg,const char *expect,
+    const char *got,int line);
+
+/*  Prints PASS or FAIL for testname and exits. */
+void testobj_exit(const char *testname);
+
+#endif /* TESTOBJ_UTIL_H */
@@ -0,0 +1,102 @@
+/*
+  Copyright (c) 2026, David Anderson
+  All rights reserved.
+
+  Redistribution and use in source and binary forms, with
+  or without modification, are permitted provided that the
+  following conditions are met:
+
+    Redistributions of source code must retain the above
+    copyright notice, this list of conditions and the following
+    disclaimer.
+
+    Redistributions in binary form must reproduce the above
+    copyright notice, this list of conditions and the following
+    disclaimer in the documentation and/or other materials
+    provided with the distribution.
+
+  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND
+  CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR
+  CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+  SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT
+  NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+  LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+  HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+  CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+  OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+  EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+/*  The source of testrangesLE64ELf4.testme and
+    testrangesLE64ELf5.testme, used by test_die_ranges.c.
+    Built with gcc 12 on x86_64:
+    gcc -O2 -gdwarf-4 -ffunction-sections -fPIC -shared \
+        -nostdlib testrangesLE64ELfsource.c \
+        -o testrangesLE64ELf4.testme
+    and the same with -gdwarf-5 for testrangesLE64ELf5.testme.
+    The functions are in separate sections, so the CU has
+    DW_AT_ranges, and gcc moves the unlikely code of
+    walk() to walk.cold and splits the inlined
+    copies of scale(), giving DW_AT_ranges to the
+    subprogram, lexical blocks and inlined subroutines.
+    One inlined copy has an empty range.
+    keep is in memory, so its location is a single
+    expression valid over both ranges of walk(). */
+
+extern int ext(int);
+extern void use(int *);
+volatile int sink;
+
+static inline int
+scale(int v)
+{
+    int t = v * 3;
+
+    if (t > 100) {
+        int u = t - 100;
+
+        sink = u;
+        return ext(u);
+    }
+    return t + 1;
+}
+
+__attribute__((cold,noinline)) static int
+report(int v)
+{
+    sink = v;
+    return ext(v) + 2;
+}
+
+int
+walk(int *a, int n)
+{
+    int total = 0;
+    int i = 0;
+    int keep[2];
+
+    for (i = 0; i < n; ++i) {
+        int s = scale(a[i]);
+
+        if (__builtin_expect(s < 0, 0)) {
+            int r = report(s);
+
+            total += r;
+            continue;
+        }
+        total += s;
+    }
+    keep[0] = total;
+    keep[1] = n;
+    use(keep);
+    return keep[0];
+}
+
+int
+first(int v)
+{
+    return scale(v) + scale(v + 1);
+}
@@ -0,0 +1,40 @@
+# A DWARF5 object for test_sup.c whose strings and
+# type are in testsupaltLE64ELf.testme, named
+# by .debug_sup. Built with:
+#   as --64 -o testsup5LE64ELf.testme testsup5LE64ELf.s
+    .section .debug_abbrev,"",@progbits
+    .uleb128 1
+    .uleb128 0x11      # DW_TAG_compile_unit
+    .byte 1
+    .uleb128 0x03      # DW_AT_name
+    .uleb128 0x1d      # DW_FORM_strp_sup
+    .byte 0,0
+    .uleb128 2
+    .uleb128 0x34      # DW_TAG_variable
+    .byte 0
+    .uleb128 0x03      # DW_AT_name
+    .uleb128 0x1d      # DW_FORM_strp_sup
+    .uleb128 0x49      # DW_AT_type
+    .uleb128 0x1c      # DW_FORM_ref_sup4
+    .byte 0,0
+    .byte 0
+    .section .debug_info,"",@progbits
+    .long .Lend - .Lstart
+.Lstart:
+    .value 5
+    .byte 1            # DW_UT_compile
+    .byte 8
+    .long 0
+    .uleb128 1
+    .long 16           # "shared_name"
+    .uleb128 2
+    .long 8            # "alt_int"
+    .long 0x12         # the DW_TAG_base_type
+    .byte 0
+.Lend:
+    .section .debug_sup,"",@progbits
+    .value 5           # version
+    .byte 0            # is_supplementary
+    .string "testsupaltLE64ELf.testme"
+    .uleb128 2         # sup_checksum_len
+    .byte 0x12,0x34
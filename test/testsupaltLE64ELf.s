@@ -0,0 +1,47 @@
+# The supplementary object file for test_sup.c, the
+# file testsupmainLE64ELf.testme and testsup5LE64ELf.testme
+# refer to.  Built with:
+#   as --64 -o testsupaltLE64ELf.testme testsupaltLE64ELf.s
+    .section .debug_abbrev,"",@progbits
+    .uleb128 1
+    .uleb128 0x11      # DW_TAG_compile_unit
+    .byte 1
+    .uleb128 0x03      # DW_AT_name
+    .uleb128 0x08      # DW_FORM_string
+    .byte 0,0
+    .uleb128 2
+    .uleb128 0x24      # DW_TAG_base_type
+    .byte 0
+    .uleb128 0x03      # DW_AT_name
+    .uleb128 0x0e      # DW_FORM_strp
+    .uleb128 0x0b      # DW_AT_byte_size
+    .uleb128 0x0b      # DW_FORM_data1
+    .byte 0,0
+    .byte 0
+    .section .debug_info,"",@progbits
+    .long .Lend - .Lstart
+.Lstart:
+    .value 4
+    .long 0
+    .byte 8
+    .uleb128 1
+    .string "alt.c"
+    # At offset 0x12, see the ref_alt in the main objects.
+    .uleb128 2
+    .long .Lintname
+    .byte 4
+    .byte 0
+.Lend:
+    .section .debug_str,"MS",@progbits,1
+    .string "padding"
+    # At offset 8
+.Lintname:
+    .string "alt_int"
+    # At offset 16
+    .string "shared_name"
+    .section .debug_sup,"",@progbits
+    .value 5           # version
+    .byte 1            # is_supplementary
+    .string ""         # sup_filename
+    .uleb128 2         # sup_checksum_len
+    .byte 0x12,0x34
@@ -0,0 +1,35 @@
+# A GNU dwz style object for test_sup.c whose strings
+# and type are in testsupaltLE64ELf.testme. Built with:
+#   as --64 -o testsupmainLE64ELf.testme testsupmainLE64ELf.s
+    .section .debug_abbrev,"",@progbits
+    .uleb128 1
+    .uleb128 0x11      # DW_TAG_compile_unit
+    .byte 1
+    .uleb128 0x03      # DW_AT_name
+    .uleb128 0x1f21    # DW_FORM_GNU_strp_alt
+    .byte 0,0
+    .uleb128 2
+    .uleb128 0x34      # DW_TAG_variable
+    .byte 0
+    .uleb128 0x03      # DW_AT_name
+    .uleb128 0x1f21    # DW_FORM_GNU_strp_alt
+    .uleb128 0x49      # DW_AT_type
+    .uleb128 0x1f20    # DW_FORM_GNU_ref_alt
+    .byte 0,0
+    .byte 0
+    .section .debug_info,"",@progbits
+    .long .Lend - .Lstart
+.Lstart:
+    .value 4
+    .long 0
+    .byte 8
+    .uleb128 1
+    .long 16           # "shared_name"
+    .uleb128 2
+    .long 8            # "alt_int"
+    .long 0x12         # the DW_TAG_base_type
+    .byte 0
+.Lend:
+    .section .gnu_debugaltlink,"",@progbits
+    .string "testsupaltLE64ELf.testme"
+    .byte 0xde,0xad,0xbe,0xef
@@ -0,0 +1,448 @@
+# The object file for test_type_layout.c, a DWARF3 CU
+# with member locations of each form, pointers to members
+# and a chain of typedefs longer than the 64 levels
+# dwarf_type_size() follows.  Built with:
+#   as --64 -o testtypelayoutLE64ELf.testme testtypelayoutLE64ELf.s
+    .section .debug_abbrev,"",@progbits
+    .uleb128 1
+    .uleb128 0x11      # DW_TAG_compile_unit
+    .byte 1
+    .uleb128 0x03      # DW_AT_name
+    .uleb128 0x08      # DW_FORM_string
+    .uleb128 0x13      # DW_AT_language
+    .uleb128 0x0b      # DW_FORM_data1
+    .byte 0,0
+    .uleb128 2
+    .uleb128 0x24      # DW_TAG_base_type
+    .byte 0
+    .uleb128 0x03      # DW_AT_name
+    .uleb128 0x08      # DW_FORM_string
+    .uleb128 0x0b      # DW_AT_byte_size
+    .uleb128 0x0b      # DW_FORM_data1
+    .uleb128 0x3e      # DW_AT_encoding
+    .uleb128 0x0b      # DW_FORM_data1
+    .byte 0,0
+    .uleb128 3
+    .uleb128 0x13      # DW_TAG_structure_type
+    .byte 1
+    .uleb128 0x03      # DW_AT_name
+    .uleb128 0x08      # DW_FORM_string
+    .uleb128 0x0b      # DW_AT_byte_size
+    .uleb128 0x0b      # DW_FORM_data1
+    .byte 0,0
+    .uleb128 4
+    .uleb128 0x0d      # DW_TAG_member
+    .byte 0
+    .uleb128 0x03      # DW_AT_name
+    .uleb128 0x08      # DW_FORM_string
+    .uleb128 0x49      # DW_AT_type
+    .uleb128 0x13      # DW_FORM_ref4
+    .uleb128 0x38      # DW_AT_data_member_location
+    .uleb128 0x0b      # DW_FORM_data1
+    .byte 0,0
+    .uleb128 5
+    .uleb128 0x0d      # DW_TAG_member
+    .byte 0
+    .uleb128 0x03      # DW_AT_name
+    .uleb128 0x08      # DW_FORM_string
+    .uleb128 0x49      # DW_AT_type
+    .uleb128 0x13      # DW_FORM_ref4
+    .uleb128 0x38      # DW_AT_data_member_location
+    .uleb128 0x0a      # DW_FORM_block1
+    .byte 0,0
+    .uleb128 6
+    .uleb128 0x0d      # DW_TAG_member
+    .byte 0
+    .uleb128 0x03      # DW_AT_name
+    .uleb128 0x08      # DW_FORM_string
+    .uleb128 0x49      # DW_AT_type
+    .uleb128 0x13      # DW_FORM_ref4
+    .uleb128 0x38      # DW_AT_data_member_location
+    .uleb128 0x06      # DW_FORM_data4, a loclistptr in DWARF3
+    .byte 0,0
+    .uleb128 7
+    .uleb128 0x1f      # DW_TAG_ptr_to_member_type
+    .byte 0
+    .uleb128 0x49      # DW_AT_type
+    .uleb128 0x13      # DW_FORM_ref4
+    .uleb128 0x1d      # DW_AT_containing_type
+    .uleb128 0x13      # DW_FORM_ref4
+    .uleb128 0x0b      # DW_AT_byte_size
+    .uleb128 0x0b      # DW_FORM_data1
+    .byte 0,0
+    .uleb128 8
+    .uleb128 0x1f      # DW_TAG_ptr_to_member_type
+    .byte 0
+    .uleb128 0x49      # DW_AT_type
+    .uleb128 0x13      # DW_FORM_ref4
+    .uleb128 0x1d      # DW_AT_containing_type
+    .uleb128 0x13      # DW_FORM_ref4
+    .byte 0,0
+    .uleb128 9
+    .uleb128 0x16      # DW_TAG_typedef
+    .byte 0
+    .uleb128 0x03      # DW_AT_name
+    .uleb128 0x08      # DW_FORM_string
+    .uleb128 0x49      # DW_AT_type
+    .uleb128 0x13      # DW_FORM_ref4
+    .byte 0,0
+    .byte 0
+    .section .debug_info,"",@progbits
+.Lcu:
+    .long .Lend - .Lstart
+.Lstart:
+    .value 3
+    .long 0
+    .byte 8
+    .uleb128 1
+    .string "typelayout.cc"
+    .byte 0x04         # DW_LANG_C_plus_plus
+.Lint:
+    .uleb128 2
+    .string "int"
+    .byte 4
+    .byte 0x05         # DW_ATE_signed
+.Lchar:
+    .uleb128 2
+    .string "char"
+    .byte 1
+    .byte 0x06         # DW_ATE_signed_char
+# struct S { int a; char b; int c; int S::*pm; int S::*pn; }
+# with c at a location list and pn of unknown size.
+.LS:
+    .uleb128 3
+    .string "S"
+    .byte 24
+    .uleb128 4
+    .string "a"
+    .long .Lint - .Lcu
+    .byte 0
+    .uleb128 5
+    .string "b"
+    .long .Lchar - .Lcu
+    .byte 2
+    .byte 0x23,4       # DW_OP_plus_uconst 4
+    .uleb128 6
+    .string "c"
+    .long .Lint - .Lcu
+    .long 0            # .debug_loc offset
+    .uleb128 4
+    .string "pm"
+    .long .Lpm - .Lcu
+    .byte 8
+    .uleb128 4
+    .string "pn"
+    .long .Lpn - .Lcu
+    .byte 16
+    .byte 0
+# struct S2 { struct S s; T10 x; }
+.LS2:
+    .uleb128 3
+    .string "S2"
+    .byte 28
+    .uleb128 4
+    .string "s"
+    .long .LS - .Lcu
+    .byte 0
+    .uleb128 4
+    .string "x"
+    .long .Lt10 - .Lcu
+    .byte 24
+    .byte 0
+.Lpm:
+    .uleb128 7
+    .long .Lint - .Lcu
+    .long .LS - .Lcu
+    .byte 8
+.Lpn:
+    .uleb128 8
+    .long .Lint - .Lcu
+    .long .LS - .Lcu
+# typedef int T69; typedef T69 T68; ... typedef T1 T0;
+.Lt0:
+    .uleb128 9
+    .string "T0"
+    .long .Lt1 - .Lcu
+.Lt1:
+    .uleb128 9
+    .string "T1"
+    .long .Lt2 - .Lcu
+.Lt2:
+    .uleb128 9
+    .string "T2"
+    .long .Lt3 - .Lcu
+.Lt3:
+    .uleb128 9
+    .string "T3"
+    .long .Lt4 - .Lcu
+.Lt4:
+    .uleb128 9
+    .string "T4"
+    .long .Lt5 - .Lcu
+.Lt5:
+    .uleb128 9
+    .string "T5"
+    .long .Lt6 - .Lcu
+.Lt6:
+    .uleb128 9
+    .string "T6"
+    .long .Lt7 - .Lcu
+.Lt7:
+    .uleb128 9
+    .string "T7"
+    .long .Lt8 - .Lcu
+.Lt8:
+    .uleb128 9
+    .string "T8"
+    .long .Lt9 - .Lcu
+.Lt9:
+    .uleb128 9
+    .string "T9"
+    .long .Lt10 - .Lcu
+.Lt10:
+    .uleb128 9
+    .string "T10"
+    .long .Lt11 - .Lcu
+.Lt11:
+    .uleb128 9
+    .string "T11"
+    .long .Lt12 - .Lcu
+.Lt12:
+    .uleb128 9
+    .string "T12"
+    .long .Lt13 - .Lcu
+.Lt13:
+    .uleb128 9
+    .string "T13"
+    .long .Lt14 - .Lcu
+.Lt14:
+    .uleb128 9
+    .string "T14"
+    .long .Lt15 - .Lcu
+.Lt15:
+    .uleb128 9
+    .string "T15"
+    .long .Lt16 - .Lcu
+.Lt16:
+    .uleb128 9
+    .string "T16"
+    .long .Lt17 - .Lcu
+.Lt17:
+    .uleb128 9
+    .string "T17"
+    .long .Lt18 - .Lcu
+.Lt18:
+    .uleb128 9
+    .string "T18"
+    .long .Lt19 - .Lcu
+.Lt19:
+    .uleb128 9
+    .string "T19"
+    .long .Lt20 - .Lcu
+.Lt20:
+    .uleb128 9
+    .string "T20"
+    .long .Lt21 - .Lcu
+.Lt21:
+    .uleb128 9
+    .string "T21"
+    .long .Lt22 - .Lcu
+.Lt22:
+    .uleb128 9
+    .string "T22"
+    .long .Lt23 - .Lcu
+.Lt23:
+    .uleb128 9
+    .string "T23"
+    .long .Lt24 - .Lcu
+.Lt24:
+    .uleb128 9
+    .string "T24"
+    .long .Lt25 - .Lcu
+.Lt25:
+    .uleb128 9
+    .string "T25"
+    .long .Lt26 - .Lcu
+.Lt26:
+    .uleb128 9
+    .string "T26"
+    .long .Lt27 - .Lcu
+.Lt27:
+    .uleb128 9
+    .string "T27"
+    .long .Lt28 - .Lcu
+.Lt28:
+    .uleb128 9
+    .string "T28"
+    .long .Lt29 - .Lcu
+.Lt29:
+    .uleb128 9
+    .string "T29"
+    .long .Lt30 - .Lcu
+.Lt30:
+    .uleb128 9
+    .string "T30"
+    .long .Lt31 - .Lcu
+.Lt31:
+    .uleb128 9
+    .string "T31"
+    .long .Lt32 - .Lcu
+.Lt32:
+    .uleb128 9
+    .string "T32"
+    .long .Lt33 - .Lcu
+.Lt33:
+    .uleb128 9
+    .string "T33"
+    .long .Lt34 - .Lcu
+.Lt34:
+    .uleb128 9
+    .string "T34"
+    .long .Lt35 - .Lcu
+.Lt35:
+    .uleb128 9
+    .string "T35"
+    .long .Lt36 - .Lcu
+.Lt36:
+    .uleb128 9
+    .string "T36"
+    .long .Lt37 - .Lcu
+.Lt37:
+    .uleb128 9
+    .string "T37"
+    .long .Lt38 - .Lcu
+.Lt38:
+    .uleb128 9
+    .string "T38"
+    .long .Lt39 - .Lcu
+.Lt39:
+    .uleb128 9
+    .string "T39"
+    .long .Lt40 - .Lcu
+.Lt40:
+    .uleb128 9
+    .string "T40"
+    .long .Lt41 - .Lcu
+.Lt41:
+    .uleb128 9
+    .string "T41"
+    .long .Lt42 - .Lcu
+.Lt42:
+    .uleb128 9
+    .string "T42"
+    .long .Lt43 - .Lcu
+.Lt43:
+    .uleb128 9
+    .string "T43"
+    .long .Lt44 - .Lcu
+.Lt44:
+    .uleb128 9
+    .string "T44"
+    .long .Lt45 - .Lcu
+.Lt45:
+    .uleb128 9
+    .string "T45"
+    .long .Lt46 - .Lcu
+.Lt46:
+    .uleb128 9
+    .string "T46"
+    .long .Lt47 - .Lcu
+.Lt47:
+    .uleb128 9
+    .string "T47"
+    .long .Lt48 - .Lcu
+.Lt48:
+    .uleb128 9
+    .string "T48"
+    .long .Lt49 - .Lcu
+.Lt49:
+    .uleb128 9
+    .string "T49"
+    .long .Lt50 - .Lcu
+.Lt50:
+    .uleb128 9
+    .string "T50"
+    .long .Lt51 - .Lcu
+.Lt51:
+    .uleb128 9
+    .string "T51"
+    .long .Lt52 - .Lcu
+.Lt52:
+    .uleb128 9
+    .string "T52"
+    .long .Lt53 - .Lcu
+.Lt53:
+    .uleb128 9
+    .string "T53"
+    .long .Lt54 - .Lcu
+.Lt54:
+    .uleb128 9
+    .string "T54"
+    .long .Lt55 - .Lcu
+.Lt55:
+    .uleb128 9
+    .string "T55"
+    .long .Lt56 - .Lcu
+.Lt56:
+    .uleb128 9
+    .string "T56"
+    .long .Lt57 - .Lcu
+.Lt57:
+    .uleb128 9
+    .string "T57"
+    .long .Lt58 - .Lcu
+.Lt58:
+    .uleb128 9
+    .string "T58"
+    .long .Lt59 - .Lcu
+.Lt59:
+    .uleb128 9
+    .string "T59"
+    .long .Lt60 - .Lcu
+.Lt60:
+    .uleb128 9
+    .string "T60"
+    .long .Lt61 - .Lcu
+.Lt61:
+    .uleb128 9
+    .string "T61"
+    .long .Lt62 - .Lcu
+.Lt62:
+    .uleb128 9
+    .string "T62"
+    .long .Lt63 - .Lcu
+.Lt63:
+    .uleb128 9
+    .string "T63"
+    .long .Lt64 - .Lcu
+.Lt64:
+    .uleb128 9
+    .string "T64"
+    .long .Lt65 - .Lcu
+.Lt65:
+    .uleb128 9
+    .string "T65"
+    .long .Lt66 - .Lcu
+.Lt66:
+    .uleb128 9
+    .string "T66"
+    .long .Lt67 - .Lcu
+.Lt67:
+    .uleb128 9
+    .string "T67"
+    .long .Lt68 - .Lcu
+.Lt68:
+    .uleb128 9
+    .string "T68"
+    .long .Lt69 - .Lcu
+.Lt69:
+    .uleb128 9
+    .string "T69"
+    .long .Lint - .Lcu
+    .byte 0
+.Lend:
+    .section .debug_loc,"",@progbits
+    .quad 0,8
+    .value 1
+    .byte 0x50         # DW_OP_reg0
+    .quad 0,0
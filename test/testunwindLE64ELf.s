@@ -0,0 +1,91 @@
+# The source of testunwindehLE64ELf.testme (frame tables
+# in .eh_frame) and testunwinddfLE64ELf.testme (in
+# .debug_frame) for test_unwind.c.  The code is never
+# run, test_unwind.c builds a stack for it in memory.
+# Built with:
+#   as --64 -o /tmp/eh.o testunwindLE64ELf.s
+#   ld --build-id=none -o testunwindehLE64ELf.testme /tmp/eh.o
+#   as --64 --defsym DEBUGFRAME=1 -o /tmp/df.o testunwindLE64ELf.s
+#   ld --build-id=none -o testunwinddfLE64ELf.testme /tmp/df.o
+.ifdef DEBUGFRAME
+    .cfi_sections .debug_frame
+.endif
+    .text
+    .globl _start
+# The outermost frame: the return address is undefined.
+_start:
+    .cfi_startproc
+    .cfi_undefined rip
+    push %rbp
+    .cfi_adjust_cfa_offset 8
+    .cfi_rel_offset rbp, 0
+    call middle
+    .globl outer_ret
+outer_ret:
+    hlt
+    .cfi_endproc
+
+# A frame pointer frame saving rbp and rbx.
+middle:
+    .cfi_startproc
+    push %rbp
+    .cfi_def_cfa_offset 16
+    .cfi_offset rbp, -16
+    mov %rsp,%rbp
+    .cfi_def_cfa_register rbp
+    push %rbx
+    .cfi_offset rbx, -24
+    call exprs
+    .globl middle_ret
+middle_ret:
+    pop %rbx
+    pop %rbp
+    .cfi_def_cfa rsp, 8
+    ret
+    .cfi_endproc
+
+# The CFA, r12 and r13 rules are DWARF expressions.
+exprs:
+    .cfi_startproc
+    sub $32,%rsp
+    # DW_CFA_def_cfa_expression: DW_OP_breg7 (rsp) 0, DW_OP_deref
+    .cfi_escape 0x0f,3,0x77,0,0x06
+    # DW_CFA_val_expression r12: DW_OP_plus_uconst 8
+    .cfi_escape 0x16,12,2,0x23,8
+    # DW_CFA_expression r13: DW_OP_lit16, DW_OP_minus
+    .cfi_escape 0x10,13,2,0x40,0x1c
+    call leaf
+    .globl exprs_ret
+exprs_ret:
+    add $32,%rsp
+    ret
+    .cfi_endproc
+
+# Ends with a call, so its return address
+# is the first byte of leaf.
+    .globl lastcall
+lastcall:
+    .cfi_startproc
+    push %rbp
+    .cfi_def_cfa_offset 16
+    call leaf
+    .cfi_endproc
+
+# No frame of its own.
+    .globl leaf
+leaf:
+    .cfi_startproc
+    nop
+    .globl leaf_pc
+leaf_pc:
+    ret
+    .cfi_endproc
+
+# A signal frame (the 'S' augmentation).
+    .globl sigframe
+sigframe:
+    .cfi_startproc
+    .cfi_signal_frame
+    nop
+    ret
+    .cfi_endproc